@@ -0,0 +1,122 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+# Compare two benchmark result files produced by `make benchmark` (i.e. by
+# pytest-benchmark's --benchmark-json output) and fail when the candidate
+# build shows statistically significant slowdowns:
+#
+#     python benchmarks/compare.py baseline.json candidate.json
+#     python benchmarks/compare.py baseline.json candidate.json \
+#            --threshold 10 --tstat 2.5
+#
+# For every benchmark present in both files the script reports the relative
+# change of the mean runtime, together with Welch's t-statistic computed
+# from the per-run mean / stddev / rounds (so raw timing data need not be
+# saved). A benchmark counts as a regression only when it is BOTH slower by
+# more than --threshold percent AND significant (|t| above --tstat); this
+# keeps noisy micro-runs from failing the gate, while a genuine kernel
+# slowdown (many rounds, small variance) is flagged reliably. The exit
+# status is the number of regressions found, so CI can gate on it directly.
+#-------------------------------------------------------------------------------
+import argparse
+import json
+import math
+import sys
+
+
+def load_results(path):
+    """Return {benchmark fullname: stats dict} from a pytest-benchmark JSON."""
+    with open(path) as f:
+        data = json.load(f)
+    return {bm["fullname"]: bm["stats"] for bm in data["benchmarks"]}
+
+
+def welch_tstat(s1, s2):
+    """
+    Welch's t-statistic for the difference of the two benchmarks' means,
+    using each run's (mean, stddev, rounds). Returns 0 when either side
+    has too few rounds or no variance information.
+    """
+    n1, n2 = s1["rounds"], s2["rounds"]
+    if n1 < 2 or n2 < 2:
+        return 0.0
+    v1 = s1["stddev"] ** 2 / n1
+    v2 = s2["stddev"] ** 2 / n2
+    if v1 + v2 == 0:
+        # Identical, perfectly stable timings: any difference in means
+        # would be infinitely significant, equality is not significant.
+        return 0.0 if s1["mean"] == s2["mean"] else math.inf
+    return (s2["mean"] - s1["mean"]) / math.sqrt(v1 + v2)
+
+
+def compare(baseline, candidate, threshold, tstat_cutoff):
+    """
+    Return (report lines, regressions) for the benchmarks common to both
+    result sets. A positive delta means the candidate is slower.
+    """
+    lines = []
+    regressions = []
+    common = sorted(set(baseline) & set(candidate))
+    for name in common:
+        s1 = baseline[name]
+        s2 = candidate[name]
+        delta = 100.0 * (s2["mean"] - s1["mean"]) / s1["mean"]
+        t = welch_tstat(s1, s2)
+        significant = abs(t) >= tstat_cutoff
+        regressed = significant and delta > threshold
+        if regressed:
+            regressions.append(name)
+        marker = "REGRESSED" if regressed else \
+                 "improved" if significant and delta < -threshold else ""
+        lines.append("%+7.1f%%  t=%+6.2f  %-9s %s"
+                     % (delta, t, marker, name))
+    return lines, regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare two benchmark JSON files and exit nonzero if "
+                    "the candidate shows significant regressions.")
+    parser.add_argument("baseline", help="JSON results of the known-good build")
+    parser.add_argument("candidate", help="JSON results of the build under test")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="maximum tolerated slowdown, in percent "
+                             "(default: 10)")
+    parser.add_argument("--tstat", type=float, default=2.0,
+                        help="minimum |t| for a difference to count as "
+                             "significant (default: 2.0, roughly p < 0.05)")
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    candidate = load_results(args.candidate)
+    if not (set(baseline) & set(candidate)):
+        print("error: the two result files have no benchmarks in common")
+        return 1
+
+    lines, regressions = compare(baseline, candidate,
+                                 args.threshold, args.tstat)
+    print("Benchmark comparison (positive delta = candidate slower):")
+    for line in lines:
+        print("  " + line)
+    only_base = set(baseline) - set(candidate)
+    only_cand = set(candidate) - set(baseline)
+    if only_base:
+        print("Missing from candidate: " + ", ".join(sorted(only_base)))
+    if only_cand:
+        print("New in candidate: " + ", ".join(sorted(only_cand)))
+    if regressions:
+        print("\n%d regression%s beyond %.1f%%:"
+              % (len(regressions), "s" if len(regressions) > 1 else "",
+                 args.threshold))
+        for name in regressions:
+            print("  " + name)
+    else:
+        print("\nNo significant regressions.")
+    return len(regressions)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,51 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+# Shared data generators for the microbenchmark suite (see benchmarks/
+# README note in each file). All generators are deterministic so that runs
+# can be compared between revisions; `make benchmark` emits the results as
+# JSON into build/benchmark-reports/.
+#-------------------------------------------------------------------------------
+import random
+
+import pytest
+
+
+def seeded(n):
+    r = random.Random(1234567 + n)
+    return r
+
+
+@pytest.fixture()
+def int_data():
+    def make(n):
+        r = seeded(n)
+        return [r.randint(-2**30, 2**30) for _ in range(n)]
+    return make
+
+
+@pytest.fixture()
+def float_data():
+    def make(n):
+        r = seeded(n)
+        return [r.random() * 1e6 - 5e5 for _ in range(n)]
+    return make
+
+
+@pytest.fixture()
+def str_data():
+    def make(n, avglen=8, nas=True):
+        r = seeded(n)
+        alphabet = "abcdefghijklmnopqrstuvwxyz0123456789"
+        out = []
+        for _ in range(n):
+            if nas and r.random() < 0.05:
+                out.append(None)
+            else:
+                slen = r.randint(1, 2 * avglen)
+                out.append("".join(r.choice(alphabet) for _ in range(slen)))
+        return out
+    return make
@@ -0,0 +1,48 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+# Benchmarks for the binary-op mapper kernels (c/expr/binaryop.cc):
+# arithmetic and comparisons over numeric columns, and the string equality
+# kernels (both column-vs-column and column-vs-constant).
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+from datatable import f
+
+
+SIZES = [10**4, 10**5, 10**6]
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_add_int32(benchmark, int_data, n):
+    f0 = dt.Frame([int_data(n), int_data(n + 1)], names=["A", "B"])
+    benchmark(lambda: f0[:, f.A + f.B])
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_mul_float64(benchmark, float_data, n):
+    f0 = dt.Frame([float_data(n), float_data(n + 1)], names=["A", "B"])
+    benchmark(lambda: f0[:, f.A * f.B])
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_lt_int32(benchmark, int_data, n):
+    f0 = dt.Frame([int_data(n), int_data(n + 1)], names=["A", "B"])
+    benchmark(lambda: f0[:, f.A < f.B])
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_eq_str32_columns(benchmark, str_data, n):
+    f0 = dt.Frame([str_data(n), str_data(n, avglen=8)], names=["A", "B"])
+    benchmark(lambda: f0[:, f.A == f.B])
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_eq_str32_constant(benchmark, str_data, n):
+    src = str_data(n)
+    needle = next(s for s in src if s is not None)
+    f0 = dt.Frame(src, names=["A"])
+    benchmark(lambda: f0[f.A == needle, :])
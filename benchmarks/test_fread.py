@@ -0,0 +1,55 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+# Benchmarks for the fread tokenizer (c/read/fread). The input text is
+# generated once per size and parsed repeatedly from memory, so the numbers
+# track parsing/tokenization cost without filesystem noise.
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+
+from conftest import seeded
+
+
+SIZES = [10**4, 10**5, 10**6]
+
+
+def _make_csv(n, quoted=False):
+    r = seeded(n)
+    alphabet = "abcdefghijklmnopqrstuvwxyz"
+    lines = ["intcol,floatcol,strcol"]
+    for _ in range(n):
+        s = "".join(r.choice(alphabet) for _ in range(r.randint(1, 12)))
+        if quoted:
+            s = '"%s,%s"' % (s, s)
+        lines.append("%d,%r,%s"
+                     % (r.randint(-2**30, 2**30), r.random() * 1e6, s))
+    return "\n".join(lines)
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_fread_mixed(benchmark, n):
+    text = _make_csv(n)
+    benchmark(dt.fread, text=text)
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_fread_quoted_strings(benchmark, n):
+    text = _make_csv(n, quoted=True)
+    benchmark(dt.fread, text=text)
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_fread_integers_wide(benchmark, n):
+    # 20 integer columns: stresses per-field tokenization over type detection
+    r = seeded(n)
+    ncols = 20
+    nrows = max(n // ncols, 1)
+    lines = [",".join("C%d" % i for i in range(ncols))]
+    for _ in range(nrows):
+        lines.append(",".join(str(r.randint(0, 10**9)) for _ in range(ncols)))
+    text = "\n".join(lines)
+    benchmark(dt.fread, text=text)
@@ -0,0 +1,62 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+# Benchmarks for view materialization (Column::reify): the slice and
+# arbitrary-gather paths, for both fixed-width and string columns.
+# Materializing is destructive (the view becomes a data frame), so every
+# round re-creates the view in the setup step, which is O(1) for slices.
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+
+
+SIZES = [10**5, 10**6]
+
+
+def _materialize(f1):
+    f1.materialize()
+    return f1
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_reify_slice_int32(benchmark, int_data, n):
+    f0 = dt.Frame(int_data(n))
+
+    def setup():
+        return (f0[::3, :],), {}
+
+    benchmark.pedantic(_materialize, setup=setup, rounds=5)
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_reify_slice_str32(benchmark, str_data, n):
+    f0 = dt.Frame(str_data(n))
+
+    def setup():
+        return (f0[::3, :],), {}
+
+    benchmark.pedantic(_materialize, setup=setup, rounds=5)
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_reify_gather_int32(benchmark, int_data, n):
+    # Sorting yields an array rowindex: the gather (random access) path
+    f0 = dt.Frame(int_data(n))
+
+    def setup():
+        return (f0.sort(0),), {}
+
+    benchmark.pedantic(_materialize, setup=setup, rounds=5)
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_reify_gather_str32(benchmark, str_data, n):
+    f0 = dt.Frame(str_data(n))
+
+    def setup():
+        return (f0.sort(0),), {}
+
+    benchmark.pedantic(_materialize, setup=setup, rounds=5)
@@ -0,0 +1,70 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+# Benchmarks for the radix/insertion sort kernels (c/sort.cc). Sorting the
+# same frame twice is served from the sort cache, so every round sorts a
+# freshly built frame via `benchmark.pedantic` (the frame construction is
+# excluded from the timing).
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+
+
+SIZES = [10**4, 10**5, 10**6]
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_sort_int32(benchmark, int_data, n):
+    src = int_data(n)
+
+    def setup():
+        return (dt.Frame(src),), {}
+
+    benchmark.pedantic(lambda f0: f0.sort(0), setup=setup, rounds=5)
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_sort_int32_lowcard(benchmark, int_data, n):
+    # Few distinct values: exercises the grouping/counting path
+    src = [x % 100 for x in int_data(n)]
+
+    def setup():
+        return (dt.Frame(src),), {}
+
+    benchmark.pedantic(lambda f0: f0.sort(0), setup=setup, rounds=5)
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_sort_float64(benchmark, float_data, n):
+    src = float_data(n)
+
+    def setup():
+        return (dt.Frame(src),), {}
+
+    benchmark.pedantic(lambda f0: f0.sort(0), setup=setup, rounds=5)
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_sort_str32(benchmark, str_data, n):
+    src = str_data(n)
+
+    def setup():
+        return (dt.Frame(src),), {}
+
+    benchmark.pedantic(lambda f0: f0.sort(0), setup=setup, rounds=5)
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_groupby_sum(benchmark, int_data, n):
+    # Grouped reduction over a low-cardinality key
+    keys = [x % 1000 for x in int_data(n)]
+    vals = int_data(n)
+
+    def setup():
+        return (dt.Frame([keys, vals], names=["key", "x"]),), {}
+
+    benchmark.pedantic(lambda f0: f0[:, dt.sum(dt.f.x), "key"],
+                       setup=setup, rounds=5)
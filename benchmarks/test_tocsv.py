@@ -0,0 +1,40 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+# Benchmarks for the CSV writer (c/csv/): numeric formatting, clean string
+# chunks (memcpy fast path) and strings that require quoting. Output goes
+# to an in-memory string, so the numbers track formatting cost only.
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+
+
+SIZES = [10**4, 10**5, 10**6]
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_tocsv_int32(benchmark, int_data, n):
+    f0 = dt.Frame(int_data(n))
+    benchmark(f0.to_csv)
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_tocsv_float64(benchmark, float_data, n):
+    f0 = dt.Frame(float_data(n))
+    benchmark(f0.to_csv)
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_tocsv_str32_clean(benchmark, str_data, n):
+    f0 = dt.Frame(str_data(n))
+    benchmark(f0.to_csv)
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_tocsv_str32_quoted(benchmark, str_data, n):
+    src = [None if s is None else s + ',"' for s in str_data(n)]
+    f0 = dt.Frame(src)
+    benchmark(f0.to_csv)
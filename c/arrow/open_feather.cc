@@ -0,0 +1,254 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include <cstring>              // std::memcmp, std::memcpy
+#include <string>
+#include <vector>
+#include "arrow/feather_generated.h"
+#include "datatable.h"
+
+
+// Helper functions
+static Column* column_from_feather(const feather::Column* fcol,
+                                   MemoryRange& buf, size_t nrows);
+
+static size_t pad8(size_t n) {
+  return (n + 7) & ~static_cast<size_t>(7);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Open DataTable
+//------------------------------------------------------------------------------
+
+/**
+ * Open a Feather (Arrow interchange) file, produced either by
+ * `DataTable::save_feather` or by another Arrow implementation (pyarrow,
+ * R feather, Spark). Fixed-width columns without NA values map zero-copy
+ * into the file; columns with NAs have the validity bitmap folded back into
+ * datatable's sentinel representation on first access.
+ */
+DataTable* DataTable::open_feather(const std::string& path)
+{
+  std::vector<std::string> colnames;
+  MemoryRange mbuf = MemoryRange::mmap(path);
+
+  const uint8_t* ptr = static_cast<const uint8_t*>(mbuf.rptr());
+  const size_t len = mbuf.size();
+  if (len < 12) {
+    throw IOError() << "Invalid Feather file of size " << len;
+  }
+  if (std::memcmp(ptr, "FEA1", 4) != 0 ||
+      std::memcmp(ptr + len - 4, "FEA1", 4) != 0) {
+    throw IOError() << "Invalid signature for a Feather file";
+  }
+
+  size_t meta_size = *reinterpret_cast<const uint32_t*>(ptr + len - 8);
+  if (meta_size > len - 12) {
+    throw IOError() << "Invalid Feather file: meta information is expected "
+        "to be " << meta_size << " bytes, however file size is only " << len;
+  }
+
+  auto meta_ptr = ptr + len - 8 - meta_size;
+  auto ctable = feather::GetCTable(meta_ptr);
+  flatbuffers::Verifier verifier(meta_ptr, meta_size);
+  if (!ctable->Verify(verifier)) {
+    throw IOError() << "Invalid meta record in a Feather file";
+  }
+
+  auto msg_columns = ctable->columns();
+  size_t ncols = msg_columns? msg_columns->size() : 0;
+  size_t nrows = static_cast<size_t>(ctable->num_rows());
+
+  Column** columns = dt::malloc<Column*>(sizeof(Column*) * size_t(ncols + 1));
+  columns[ncols] = nullptr;
+  size_t i = 0;
+  for (const feather::Column* fcol : *msg_columns) {
+    Column* col = column_from_feather(fcol, mbuf, nrows);
+    columns[i++] = col;
+    colnames.push_back(fcol->name()->str());
+  }
+
+  auto dt = new DataTable(columns);
+  dt->set_names(colnames);
+  return dt;
+}
+
+
+
+//------------------------------------------------------------------------------
+// Open an individual column
+//------------------------------------------------------------------------------
+
+/**
+ * Copy a fixed-width buffer out of the file and overwrite the slots marked
+ * invalid in the bitmap with datatable's NA sentinel. Returns a "computed"
+ * memory range, so the copying happens on first access only.
+ */
+template <typename T>
+static MemoryRange fixed_buffer_with_nas(
+    MemoryRange& src, size_t valpos, size_t bmppos, size_t n)
+{
+  return MemoryRange::computed(n * sizeof(T),
+    [src, valpos, bmppos, n](void* out) {
+      const uint8_t* base = static_cast<const uint8_t*>(src.rptr());
+      std::memcpy(out, base + valpos, n * sizeof(T));
+      const uint8_t* bmp = base + bmppos;
+      T* tdata = static_cast<T*>(out);
+      for (size_t i = 0; i < n; ++i) {
+        if (!(bmp[i / 8] & (1 << (i & 7)))) tdata[i] = GETNA<T>();
+      }
+    });
+}
+
+
+/**
+ * Unpack Feather's bit-packed booleans into datatable's int8 representation,
+ * applying the validity bitmap when present.
+ */
+static MemoryRange bool_buffer(
+    MemoryRange& src, size_t valpos, size_t bmppos, bool has_nulls, size_t n)
+{
+  return MemoryRange::computed(n,
+    [src, valpos, bmppos, has_nulls, n](void* out) {
+      const uint8_t* base = static_cast<const uint8_t*>(src.rptr());
+      const uint8_t* vals = base + valpos;
+      const uint8_t* bmp = base + bmppos;
+      int8_t* tdata = static_cast<int8_t*>(out);
+      for (size_t i = 0; i < n; ++i) {
+        tdata[i] = (has_nulls && !(bmp[i / 8] & (1 << (i & 7))))
+            ? GETNA<int8_t>()
+            : static_cast<int8_t>((vals[i / 8] >> (i & 7)) & 1);
+      }
+    });
+}
+
+
+/**
+ * Convert Feather's int32 begin-offsets into datatable's end-offsets with
+ * the NA flag in the high bit (the layout StringColumn<uint32_t> expects).
+ */
+static MemoryRange str_offsets_buffer(
+    MemoryRange& src, size_t offpos, size_t bmppos, bool has_nulls, size_t n)
+{
+  return MemoryRange::computed((n + 1) * sizeof(uint32_t),
+    [src, offpos, bmppos, has_nulls, n](void* out) {
+      const uint8_t* base = static_cast<const uint8_t*>(src.rptr());
+      const int32_t* aoff = reinterpret_cast<const int32_t*>(base + offpos);
+      const uint8_t* bmp = base + bmppos;
+      uint32_t* toff = static_cast<uint32_t*>(out);
+      toff[0] = 0;
+      for (size_t i = 0; i < n; ++i) {
+        bool isna = has_nulls && !(bmp[i / 8] & (1 << (i & 7)));
+        toff[i + 1] = isna
+            ? ((toff[i] & ~GETNA<uint32_t>()) | GETNA<uint32_t>())
+            : static_cast<uint32_t>(aoff[i + 1]);
+      }
+    });
+}
+
+
+static Column* column_from_feather(
+    const feather::Column* fcol, MemoryRange& buf, size_t nrows)
+{
+  const feather::PrimitiveArray* arr = fcol->values();
+  if (!arr) {
+    throw IOError() << "Invalid Feather file: column has no data record";
+  }
+  if (arr->encoding() != feather::Encoding_PLAIN) {
+    throw IOError() << "Feather columns with " << EnumNameEncoding(
+        arr->encoding()) << " encoding are not supported";
+  }
+  if (arr->length() != static_cast<int64_t>(nrows)) {
+    throw IOError() << "Length of column `" << fcol->name()->str() << "` is "
+        << arr->length() << ", however the file declares " << nrows
+        << " rows";
+  }
+  size_t n = nrows;
+  size_t pos = static_cast<size_t>(arr->offset());
+  size_t end = pos + static_cast<size_t>(arr->total_bytes());
+  bool has_nulls = (arr->null_count() > 0);
+  if (end < pos || end > buf.size()) {
+    throw IOError() << "Invalid data region in a Feather file: offset="
+        << pos << ", length=" << arr->total_bytes() << ", file size is "
+        << buf.size();
+  }
+  size_t bmppos = pos;
+  if (has_nulls) {
+    pos += pad8((n + 7) / 8);
+  }
+
+  Column* col = nullptr;
+  size_t elemsize = 0;
+  switch (arr->type()) {
+    case feather::Type_BOOL: {
+      col = new BoolColumn(0);
+      col->replace_buffer(bool_buffer(buf, pos, bmppos, has_nulls, n));
+      break;
+    }
+    case feather::Type_INT8:    col = new IntColumn<int8_t>(0);  elemsize = 1; break;
+    case feather::Type_INT16:   col = new IntColumn<int16_t>(0); elemsize = 2; break;
+    case feather::Type_INT32:   col = new IntColumn<int32_t>(0); elemsize = 4; break;
+    case feather::Type_INT64:   col = new IntColumn<int64_t>(0); elemsize = 8; break;
+    case feather::Type_FLOAT:   col = new RealColumn<float>(0);  elemsize = 4; break;
+    case feather::Type_DOUBLE:  col = new RealColumn<double>(0); elemsize = 8; break;
+    case feather::Type_UTF8: {
+      size_t offsize = (n + 1) * sizeof(int32_t);
+      size_t valpos = pos + pad8(offsize);
+      if (valpos > end) {
+        throw IOError() << "Invalid string column in a Feather file";
+      }
+      // The total length of the string data is the last recorded offset
+      const int32_t* aoff = reinterpret_cast<const int32_t*>(
+          static_cast<const uint8_t*>(buf.rptr()) + pos);
+      size_t strsize = static_cast<size_t>(aoff[n]);
+      if (valpos + strsize > end) {
+        throw IOError() << "Invalid string column in a Feather file";
+      }
+      col = new StringColumn<uint32_t>(0);
+      col->replace_buffer(
+          str_offsets_buffer(buf, pos, bmppos, has_nulls, n),
+          MemoryRange::view(buf, strsize, valpos));
+      break;
+    }
+    default:
+      throw IOError() << "Feather column of type " << EnumNameType(
+          arr->type()) << " is not supported";
+  }
+  if (elemsize) {
+    if (pos + n * elemsize > end) {
+      throw IOError() << "Invalid data region in a Feather file";
+    }
+    MemoryRange databuf;
+    if (has_nulls) {
+      // NA sentinels differ between integer and floating-point columns, so
+      // the patching must be instantiated with the column's actual type.
+      switch (arr->type()) {
+        case feather::Type_INT8:
+          databuf = fixed_buffer_with_nas<int8_t>(buf, pos, bmppos, n); break;
+        case feather::Type_INT16:
+          databuf = fixed_buffer_with_nas<int16_t>(buf, pos, bmppos, n); break;
+        case feather::Type_INT32:
+          databuf = fixed_buffer_with_nas<int32_t>(buf, pos, bmppos, n); break;
+        case feather::Type_INT64:
+          databuf = fixed_buffer_with_nas<int64_t>(buf, pos, bmppos, n); break;
+        case feather::Type_FLOAT:
+          databuf = fixed_buffer_with_nas<float>(buf, pos, bmppos, n); break;
+        default:
+          databuf = fixed_buffer_with_nas<double>(buf, pos, bmppos, n); break;
+      }
+    } else {
+      databuf = MemoryRange::view(buf, n * elemsize, pos);
+    }
+    col->replace_buffer(std::move(databuf));
+  }
+
+  Stats* stats = col->get_stats();
+  stats->set_countna(arr->null_count());
+  return col;
+}
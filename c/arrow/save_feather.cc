@@ -0,0 +1,264 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include <limits>
+#include <vector>
+#include "arrow/feather_generated.h"
+#include "datatable.h"
+#include "utils/assert.h"
+#include "writebuf.h"
+
+using WritableBufferPtr = std::unique_ptr<WritableBuffer>;
+
+static flatbuffers::Offset<feather::Column> column_to_feather(
+    Column* col, const std::string& name, flatbuffers::FlatBufferBuilder& fbb,
+    WritableBufferPtr& wb);
+static size_t writePadded(const void* data, size_t len, WritableBufferPtr& wb);
+template <typename T>
+static void fillValidityBitmap(const T* data, size_t n,
+                               std::vector<uint8_t>& bitmap);
+
+
+//------------------------------------------------------------------------------
+// Save DataTable
+//------------------------------------------------------------------------------
+
+/**
+ * Save the DataTable as a Feather (Arrow interchange) file. The format is
+ * the one produced by `pyarrow.feather` version 1: data of all columns, then
+ * a flatbuffer with the metadata, framed by the "FEA1" magic at both ends of
+ * the file. Unlike Jay, Feather marks NA values with a validity bitmap
+ * rather than with sentinels, so the bitmap is derived from the data when a
+ * column contains NAs.
+ */
+void DataTable::save_feather(const std::string& path,
+                             const std::vector<std::string>& colnames,
+                             WritableBuffer::Strategy wstrategy)
+{
+  // Cannot store a view frame, so materialize first.
+  reify();
+
+  size_t sizehint = (wstrategy == WritableBuffer::Strategy::Auto)
+                    ? memory_footprint() : 0;
+  auto wb = WritableBuffer::create_target(path, sizehint, wstrategy);
+  wb->write(8, "FEA1\0\0\0\0");
+
+  flatbuffers::FlatBufferBuilder fbb(1024);
+
+  std::vector<flatbuffers::Offset<feather::Column>> msg_columns;
+  for (size_t i = 0; i < static_cast<size_t>(ncols); ++i) {
+    Column* col = columns[i];
+    if (col->stype() == SType::OBJ) {
+      Warning() << "Column '" << colnames[i] << "' of type obj64 was not saved";
+    } else {
+      msg_columns.push_back(column_to_feather(col, colnames[i], fbb, wb));
+    }
+  }
+  xassert((wb->size() & 7) == 0);
+
+  auto ctable = feather::CreateCTableDirect(fbb,
+                    nullptr,
+                    nrows,
+                    &msg_columns,
+                    2 /* kFeatherVersion */);
+  fbb.Finish(ctable);
+
+  uint8_t* metaBytes = fbb.GetBufferPointer();
+  uint32_t metaSize = fbb.GetSize();
+  wb->write(metaSize, metaBytes);
+  wb->write(4, &metaSize);
+  wb->write(4, "FEA1");
+  wb->finalize();
+}
+
+
+
+//------------------------------------------------------------------------------
+// Save a column
+//------------------------------------------------------------------------------
+
+static flatbuffers::Offset<feather::Column> column_to_feather(
+    Column* col, const std::string& name, flatbuffers::FlatBufferBuilder& fbb,
+    WritableBufferPtr& wb)
+{
+  size_t n = static_cast<size_t>(col->nrows);
+  int64_t nullcount = col->countna();
+  MemoryRange mbuf = col->data_buf();  // shallow copy of col's `mbuf`
+
+  feather::Type ftype;
+  switch (col->stype()) {
+    case SType::BOOL:    ftype = feather::Type_BOOL;   break;
+    case SType::INT8:    ftype = feather::Type_INT8;   break;
+    case SType::INT16:   ftype = feather::Type_INT16;  break;
+    case SType::INT32:   ftype = feather::Type_INT32;  break;
+    case SType::INT64:   ftype = feather::Type_INT64;  break;
+    case SType::FLOAT32: ftype = feather::Type_FLOAT;  break;
+    case SType::FLOAT64: ftype = feather::Type_DOUBLE; break;
+    case SType::STR32:
+    case SType::STR64:   ftype = feather::Type_UTF8;   break;
+    default:
+      throw ValueError() << "Column '" << name << "' of type "
+          << col->stype() << " cannot be saved into a Feather file";
+  }
+
+  // The validity bitmap: 1 = valid, LSB bit numbering. Written only when the
+  // column actually contains NA values, as prescribed by the format.
+  std::vector<uint8_t> bitmap;
+  if (nullcount) {
+    const void* cdata = mbuf.rptr();
+    switch (col->stype()) {
+      case SType::BOOL:
+      case SType::INT8:
+        fillValidityBitmap(static_cast<const int8_t*>(cdata), n, bitmap);
+        break;
+      case SType::INT16:
+        fillValidityBitmap(static_cast<const int16_t*>(cdata), n, bitmap);
+        break;
+      case SType::INT32:
+        fillValidityBitmap(static_cast<const int32_t*>(cdata), n, bitmap);
+        break;
+      case SType::INT64:
+        fillValidityBitmap(static_cast<const int64_t*>(cdata), n, bitmap);
+        break;
+      case SType::FLOAT32:
+        fillValidityBitmap(static_cast<const float*>(cdata), n, bitmap);
+        break;
+      case SType::FLOAT64:
+        fillValidityBitmap(static_cast<const double*>(cdata), n, bitmap);
+        break;
+      case SType::STR32: {
+        auto offsets = static_cast<StringColumn<uint32_t>*>(col)->offsets();
+        bitmap.resize((n + 7) / 8, 0xFF);
+        for (size_t i = 0; i < n; ++i) {
+          if (offsets[i] & GETNA<uint32_t>()) {
+            bitmap[i / 8] &= static_cast<uint8_t>(~(1 << (i & 7)));
+          }
+        }
+        break;
+      }
+      case SType::STR64: {
+        auto offsets = static_cast<StringColumn<uint64_t>*>(col)->offsets();
+        bitmap.resize((n + 7) / 8, 0xFF);
+        for (size_t i = 0; i < n; ++i) {
+          if (offsets[i] & GETNA<uint64_t>()) {
+            bitmap[i / 8] &= static_cast<uint8_t>(~(1 << (i & 7)));
+          }
+        }
+        break;
+      }
+      default: break;
+    }
+  }
+
+  int64_t arr_offset = 0;
+  if (nullcount) {
+    arr_offset = static_cast<int64_t>(
+                     writePadded(bitmap.data(), bitmap.size(), wb));
+  }
+
+  switch (col->stype()) {
+    case SType::BOOL: {
+      // Feather stores booleans bit-packed; NA slots leave the value bit 0.
+      const int8_t* cdata = static_cast<const int8_t*>(mbuf.rptr());
+      std::vector<uint8_t> bits((n + 7) / 8, 0);
+      for (size_t i = 0; i < n; ++i) {
+        if (cdata[i] == 1) bits[i / 8] |= static_cast<uint8_t>(1 << (i & 7));
+      }
+      size_t pos = writePadded(bits.data(), bits.size(), wb);
+      if (!nullcount) arr_offset = static_cast<int64_t>(pos);
+      break;
+    }
+    case SType::STR32: {
+      // Feather strings use int32 begin-offsets (n + 1 of them, starting at
+      // zero), with NA entries repeating the previous offset; datatable's
+      // end-offsets convert by simply masking away the NA bit.
+      auto scol = static_cast<StringColumn<uint32_t>*>(col);
+      const uint32_t* offsets = scol->offsets();
+      std::vector<int32_t> aoff(n + 1);
+      aoff[0] = 0;
+      for (size_t i = 0; i < n; ++i) {
+        aoff[i + 1] = static_cast<int32_t>(offsets[i] & ~GETNA<uint32_t>());
+      }
+      size_t pos = writePadded(aoff.data(), aoff.size() * 4, wb);
+      if (!nullcount) arr_offset = static_cast<int64_t>(pos);
+      writePadded(scol->strdata(), scol->datasize(), wb);
+      break;
+    }
+    case SType::STR64: {
+      auto scol = static_cast<StringColumn<uint64_t>*>(col);
+      if (scol->datasize() > std::numeric_limits<int32_t>::max()) {
+        throw ValueError() << "Column '" << name << "' has more string data "
+            "than the Feather format can store (int32 offsets)";
+      }
+      const uint64_t* offsets = scol->offsets();
+      std::vector<int32_t> aoff(n + 1);
+      aoff[0] = 0;
+      for (size_t i = 0; i < n; ++i) {
+        aoff[i + 1] = static_cast<int32_t>(offsets[i] & ~GETNA<uint64_t>());
+      }
+      size_t pos = writePadded(aoff.data(), aoff.size() * 4, wb);
+      if (!nullcount) arr_offset = static_cast<int64_t>(pos);
+      writePadded(scol->strdata(), scol->datasize(), wb);
+      break;
+    }
+    default: {
+      // Fixed-width columns are written as-is: the sentinel values left in
+      // the NA slots are ignored by Arrow readers (the bitmap governs).
+      size_t pos = writePadded(mbuf.rptr(), mbuf.size(), wb);
+      if (!nullcount) arr_offset = static_cast<int64_t>(pos);
+      break;
+    }
+  }
+  int64_t total_bytes = static_cast<int64_t>(wb->size()) - arr_offset;
+
+  auto sname = fbb.CreateString(name.c_str());
+  auto values = feather::CreatePrimitiveArray(fbb,
+                    ftype,
+                    feather::Encoding_PLAIN,
+                    arr_offset,
+                    static_cast<int64_t>(n),
+                    nullcount,
+                    total_bytes);
+  return feather::CreateColumn(fbb, sname, values);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Helpers
+//------------------------------------------------------------------------------
+
+/**
+ * Write `len` bytes at the end of the output buffer, followed by up to 7
+ * zero bytes so that the next write remains 8-aligned (the alignment the
+ * Feather format requires for all buffers). Returns the absolute file offset
+ * at which the data was written.
+ */
+static size_t writePadded(
+    const void* data, size_t len, WritableBufferPtr& wb)
+{
+  size_t pos = wb->prep_write(len, data);
+  wb->write_at(pos, len, data);
+  if (len & 7) {
+    uint64_t zero = 0;
+    wb->write(8 - (len & 7), &zero);
+  }
+  return pos;
+}
+
+
+template <typename T>
+static void fillValidityBitmap(
+    const T* data, size_t n, std::vector<uint8_t>& bitmap)
+{
+  bitmap.resize((n + 7) / 8, 0xFF);
+  for (size_t i = 0; i < n; ++i) {
+    if (ISNA<T>(data[i])) {
+      bitmap[i / 8] &= static_cast<uint8_t>(~(1 << (i & 7)));
+    }
+  }
+}
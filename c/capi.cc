@@ -6,8 +6,58 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include "capi.h"
+#include <cerrno>      // errno, EINTR
+#include <cstring>     // std::memcpy, std::memcmp
+#include <unistd.h>    // read, write
 #include "datatable.h"
 #include "rowindex.h"
+#include "utils/alloc.h"
+#include "utils/exceptions.h"
+
+
+// The handle returned by `datatable_acquire_column`: shallow copies of the
+// column's MemoryRange and RowIndex. Their reference counts keep the
+// underlying buffers alive while the embedding application holds the
+// handle, regardless of what happens to the DataTable itself.
+struct ColumnPin {
+  MemoryRange mbuf;
+  RowIndex ri;
+};
+
+
+// Write / read exactly `n` bytes, looping over short transfers (normal on
+// sockets and pipes) and retrying on EINTR. Return false on I/O error, or
+// (when reading) on end-of-stream before `n` bytes arrived.
+static bool write_all(int fd, const void* data, size_t n) {
+  const char* p = static_cast<const char*>(data);
+  while (n) {
+    ssize_t r = ::write(fd, p, n);
+    if (r < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    p += r;
+    n -= static_cast<size_t>(r);
+  }
+  return true;
+}
+
+static bool read_all(int fd, void* data, size_t n) {
+  char* p = static_cast<char*>(data);
+  while (n) {
+    ssize_t r = ::read(fd, p, n);
+    if (r < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    if (r == 0) return false;
+    p += r;
+    n -= static_cast<size_t>(r);
+  }
+  return true;
+}
+
+
 extern "C" {
 
 
@@ -35,4 +85,124 @@ void datatable_unpack_arrayrowindex(void *dt_, void **indices)
 }
 
 
+void* datatable_acquire_column(void* dt_, int64_t column, dt_ColumnData* out)
+{
+  DataTable* dt = static_cast<DataTable*>(dt_);
+  if (!out || column < 0 || column >= dt->ncols) return nullptr;
+  Column* col = dt->columns[column];
+  if (!col->is_fixedwidth()) return nullptr;
+  ColumnPin* pin = new ColumnPin { col->data_buf(), col->rowindex() };
+  out->data  = pin->mbuf.rptr();
+  out->size  = pin->mbuf.size();
+  out->nrows = col->nrows;
+  out->stype = static_cast<int>(col->stype());
+  out->start = 0;
+  out->step = 0;
+  out->indices = nullptr;
+  const RowIndex& ri = pin->ri;
+  if (!ri) {
+    out->ritype = 0;
+  } else if (ri.isslice()) {
+    out->ritype = RI_SLICE;
+    out->start = ri.slice_start();
+    out->step = ri.slice_step();
+  } else if (ri.isarr32()) {
+    out->ritype = RI_ARR32;
+    out->indices = ri.indices32();
+  } else if (ri.isarr64()) {
+    out->ritype = RI_ARR64;
+    out->indices = ri.indices64();
+  } else {
+    // Virtual (repeat) rowindexes have no index buffer to expose through
+    // this C interface.
+    delete pin;
+    return nullptr;
+  }
+  return pin;
+}
+
+
+void datatable_release_column(void* handle)
+{
+  delete static_cast<ColumnPin*>(handle);
+}
+
+
+void* datatable_from_buffers(int64_t ncols, int64_t nrows,
+                             void** buffers, const int* stypes)
+{
+  if (ncols < 0 || nrows < 0 || (ncols && !(buffers && stypes))) {
+    return nullptr;
+  }
+  Column** cols = nullptr;
+  int64_t i = 0;
+  try {
+    cols = dt::amalloc<Column*>(ncols + 1);
+    for (int64_t k = 0; k <= ncols; ++k) cols[k] = nullptr;
+    for (; i < ncols; ++i) {
+      if (stypes[i] <= static_cast<int>(SType::VOID) ||
+          stypes[i] >= static_cast<int>(DT_STYPES_COUNT)) {
+        throw ValueError() << "Invalid stype for an external buffer";
+      }
+      SType st = static_cast<SType>(stypes[i]);
+      if (info(st).is_varwidth() || st == SType::OBJ) {
+        throw ValueError() << "Invalid stype for an external buffer";
+      }
+      size_t bufsize = info(st).elemsize() * static_cast<size_t>(nrows);
+      cols[i] = Column::new_mbuf_column(
+          st, MemoryRange::external(buffers[i], bufsize));
+    }
+    return new DataTable(cols, nullptr);
+  } catch (...) {
+    if (cols) {
+      for (int64_t k = 0; k < i; ++k) delete cols[k];
+      dt::free(cols);
+    }
+    return nullptr;
+  }
+}
+
+
+void datatable_release(void* dt_)
+{
+  delete static_cast<DataTable*>(dt_);
+}
+
+
+int datatable_send_shard(void* dt_, int fd)
+{
+  try {
+    DataTable* dt = static_cast<DataTable*>(dt_);
+    MemoryRange payload = dt->save_jay_memory(dt->get_names());
+    uint64_t len = payload.size();
+    char header[16];
+    std::memcpy(header, "DTSHARD1", 8);
+    std::memcpy(header + 8, &len, 8);
+    if (!write_all(fd, header, sizeof(header))) return -1;
+    if (!write_all(fd, payload.rptr(), payload.size())) return -1;
+    return 0;
+  } catch (...) {
+    return -1;
+  }
+}
+
+
+void* datatable_recv_shard(int fd)
+{
+  try {
+    char header[16];
+    if (!read_all(fd, header, sizeof(header))) return nullptr;
+    if (std::memcmp(header, "DTSHARD1", 8) != 0) return nullptr;
+    uint64_t len;
+    std::memcpy(&len, header + 8, 8);
+    if (len < 24) return nullptr;  // smaller than the smallest Jay message
+    MemoryRange payload = MemoryRange::mem(static_cast<size_t>(len));
+    if (!read_all(fd, payload.wptr(), payload.size())) return nullptr;
+    return DataTable::open_jay_buffer(std::move(payload));
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+
 } // extern "C"
@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #ifndef dt_CAPI_H
 #define dt_CAPI_H
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -18,6 +19,76 @@ void* datatable_get_column_data(void* dt, int64_t column);
 void  datatable_unpack_slicerowindex(void *dt, int64_t *start, int64_t *step);
 void  datatable_unpack_arrayrowindex(void *dt, void **indices);
 
+
+/**
+ * Zero-copy view of a single column: a pointer straight into the column's
+ * data buffer, the storage type, and the rowindex through which the buffer
+ * must be read if the column is a view. The rowindex codes match the
+ * RowIndexType enum: 0 = no rowindex (the buffer is plain, contiguous),
+ * 1 = int32 index array, 2 = int64 index array, 3 = slice.
+ */
+typedef struct {
+  const void* data;    /* start of the column's data buffer */
+  size_t size;         /* size of that buffer, in bytes */
+  int64_t nrows;       /* number of (logical) rows in the column */
+  int stype;           /* storage type: numeric value of the SType enum */
+  int ritype;          /* rowindex type, see above */
+  int64_t start;       /* slice rowindex: index of the first row */
+  int64_t step;        /* slice rowindex: step between consecutive rows */
+  const void* indices; /* array rowindex: the int32/int64 index array */
+} dt_ColumnData;
+
+/**
+ * Fill `out` with a zero-copy view of column `column` of the DataTable
+ * `dt`, and return an opaque handle that pins the underlying buffer and
+ * rowindex: the pointers in `out` remain valid until the handle is passed
+ * to `datatable_release_column`, even if the DataTable itself is deleted
+ * or modified in the meantime. Returns NULL (and leaves `out` untouched)
+ * if the column index is invalid or the column is not of a fixed-width
+ * type: string data buffers are not exposed through this interface.
+ */
+void* datatable_acquire_column(void* dt, int64_t column, dt_ColumnData* out);
+void  datatable_release_column(void* handle);
+
+/**
+ * Construct a DataTable around `ncols` external data buffers, without
+ * copying: `buffers[i]` must point to `nrows` elements of the fixed-width
+ * storage type `stypes[i]` (numeric SType values). The caller retains
+ * ownership of the buffers and must keep them alive and unchanged in size
+ * for the lifetime of the returned DataTable and of anything derived from
+ * it by shallow copy. Returns NULL if any stype is not a fixed-width type.
+ * The result is destroyed with `datatable_release`.
+ */
+void* datatable_from_buffers(int64_t ncols, int64_t nrows,
+                             void** buffers, const int* stypes);
+void  datatable_release(void* dt);
+
+/**
+ * Write the DataTable `dt` as one shard-exchange message to the file
+ * descriptor `fd` (a connected socket, a pipe, or a regular file). The
+ * message is a 16-byte header -- the magic bytes "DTSHARD1" followed by
+ * the payload length as a little-endian uint64 -- and then the payload,
+ * which is a standard Jay-format serialization of the frame (column
+ * names, types, data and statistics included). Short writes and EINTR
+ * are handled internally. Returns 0 on success, -1 on any error.
+ *
+ * This is the wire half of a simple shard-shipping protocol: worker
+ * processes serialize their local frames (or locally aggregated
+ * partials) straight from the column buffers, with no re-parsing on
+ * either end, and an aggregator receives them with
+ * `datatable_recv_shard` and merges.
+ */
+int datatable_send_shard(void* dt, int fd);
+
+/**
+ * Read one message written by `datatable_send_shard` from `fd` and
+ * reconstruct the frame. Blocks until the full message arrives. Returns
+ * a DataTable handle to be freed with `datatable_release`, or NULL if
+ * the stream does not start with a valid shard header, ends prematurely,
+ * or the payload is not valid Jay data.
+ */
+void* datatable_recv_shard(int fd);
+
 #ifdef __cplusplus
 }
 #endif
@@ -7,17 +7,120 @@
 //------------------------------------------------------------------------------
 #include "column.h"
 #include <cstdlib>     // atoll
+#include <unordered_map>
+#include "options.h"
+#include "perf.h"
 #include "py_utils.h"
 #include "rowindex.h"
 #include "sort.h"
 #include "utils.h"
 #include "utils/assert.h"
 #include "utils/file.h"
+#include "utils/parallel.h"
 
 
+// Source of globally unique mutation ids. Mutation ids are bumped from
+// Python-driven (single-threaded) code paths, so a plain counter suffices.
+static uint64_t mutid_counter = 0;
+
+std::mutex Column::stats_alloc_mutex;
+
 Column::Column(int64_t nrows_)
     : stats(nullptr),
-      nrows(nrows_) {}
+      sortedness(0),
+      bg_reifying(0),
+      nrows(nrows_)
+{
+  bump_mutid();
+}
+
+
+//------------------------------------------------------------------------------
+// Background materialization
+//------------------------------------------------------------------------------
+
+// Finished background materializations, keyed by the original column. Each
+// value is the reified shallow copy, together with the original's mutation
+// id at submission time (a stale result is discarded rather than adopted).
+static std::mutex bg_results_mutex;
+static std::unordered_map<const Column*,
+                          std::pair<std::shared_ptr<Column>, uint64_t>>
+    bg_results;
+
+
+void Column::reify() {
+  if (bg_reifying.load(std::memory_order_acquire)) {
+    std::shared_ptr<Column> result = _take_bg_result();
+    if (result) {
+      adopt_buffer_of(result.get());
+      return;
+    }
+  }
+  if (ri.isabsent()) return;  // not a view: nothing to materialize
+  dt::perf::OpTimer optimer("reify");
+  optimer.set_bytes(static_cast<int64_t>(alloc_size()));
+  reify_impl();
+}
+
+
+void Column::reify_async() {
+  if (!config::view_materialize_async) return;
+  if (ri.isabsent() || stype() == SType::OBJ) return;
+  // Guards against double submission; cleared when the result (or the
+  // still-queued task) is taken back in `_take_bg_result()`.
+  if (bg_reifying.exchange(1, std::memory_order_acq_rel)) return;
+  // The shallow copy is made here, on the calling thread: copying `mbuf`
+  // and `ri` manipulates their reference counts, which must not race with
+  // other main-thread copies.
+  std::shared_ptr<Column> copy(shallowcopy());
+  uint64_t submitted_mutid = mutid;
+  const Column* token = this;
+  dt::bg_submit(token, [copy, submitted_mutid, token] {
+    copy->reify_impl();
+    std::lock_guard<std::mutex> lock(bg_results_mutex);
+    bg_results[token] = std::make_pair(copy, submitted_mutid);
+  });
+}
+
+
+std::shared_ptr<Column> Column::_take_bg_result() const {
+  if (dt::bg_steal(this)) {
+    // The background worker had not picked the task up yet: the column
+    // simply stays lazy and will be reified on demand as usual. (The
+    // shallow copy died together with the stolen task's closure.)
+    bg_reifying.store(0, std::memory_order_release);
+    return nullptr;
+  }
+  dt::bg_wait(this);
+  bg_reifying.store(0, std::memory_order_release);
+  std::lock_guard<std::mutex> lock(bg_results_mutex);
+  auto it = bg_results.find(this);
+  if (it == bg_results.end()) return nullptr;
+  std::shared_ptr<Column> result = std::move(it->second.first);
+  uint64_t submitted_mutid = it->second.second;
+  bg_results.erase(it);
+  if (submitted_mutid != mutid) {
+    // The column's data changed after the task was submitted.
+    return nullptr;
+  }
+  return result;
+}
+
+
+void Column::_discard_bg_reify() const {
+  _take_bg_result();
+}
+
+
+void Column::adopt_buffer_of(Column* donor) {
+  mbuf = std::move(donor->mbuf);
+  ri = RowIndex();
+}
+
+
+void Column::bump_mutid() {
+  mutid = ++mutid_counter;
+}
 
 
 Column* Column::new_column(SType stype) {
@@ -32,6 +135,7 @@ Column* Column::new_column(SType stype) {
     case SType::FLOAT64: return new RealColumn<double>();
     case SType::STR32:   return new StringColumn<uint32_t>();
     case SType::STR64:   return new StringColumn<uint64_t>();
+    case SType::CAT32:   return new CategoricalColumn();
     case SType::OBJ:     return new PyObjectColumn();
     default:
       throw ValueError() << "Unable to create a column of SType = " << stype;
@@ -62,6 +166,38 @@ Column* Column::new_mmap_column(SType stype, int64_t nrows,
 }
 
 
+void Column::set_validity_mask(MemoryRange&& mask) {
+  size_t minsize = (static_cast<size_t>(nrows) + 7) / 8;
+  if (mask.size() < minsize) {
+    throw RuntimeError() << "Validity mask has size " << mask.size()
+        << ", whereas a column with " << nrows << " rows requires at least "
+        << minsize << " bytes";
+  }
+  vmask = std::move(mask);
+}
+
+
+/**
+ * Create a "virtual" column whose data buffer is computed lazily: `fn` is
+ * invoked to fill the buffer the first time the column's data is accessed
+ * (see MemoryRange::computed). Only fixed-width stypes are supported.
+ */
+Column* Column::new_computed_column(SType stype, int64_t nrows,
+                                    std::function<void(void*)> fn)
+{
+  Column* col = new_column(stype);
+  if (!col->is_fixedwidth()) {
+    delete col;
+    throw NotImplError() << "Unable to create a lazily computed column of "
+        "SType = " << stype;
+  }
+  col->nrows = nrows;
+  size_t bufsize = static_cast<size_t>(nrows) * col->elemsize();
+  col->mbuf = MemoryRange::computed(bufsize, std::move(fn));
+  return col;
+}
+
+
 
 /**
  * Save this column's data buffer into file `filename`. Other information
@@ -75,6 +211,23 @@ void Column::save_to_disk(const std::string& filename,
 }
 
 
+void Column::memory_advise(MmmAdvice a) const {
+  mbuf.advise(a);
+}
+
+
+void Column::cow_counters(size_t* ncopies, size_t* nbytes) const {
+  *ncopies += mbuf.cow_count();
+  *nbytes += mbuf.cow_bytes();
+}
+
+
+void Column::reserve_rows(int64_t n) {
+  if (n <= nrows) return;
+  mbuf.reserve(static_cast<size_t>(n) * elemsize());
+}
+
+
 
 /**
  * Restore a Column previously saved via `column_save_to_disk()`. The column's
@@ -158,6 +311,12 @@ Column* Column::shallowcopy(const RowIndex& new_rowindex) const {
   } else if (ri) {
     col->ri = ri;
   }
+  // The copy shares the data buffer, so a cached sortedness verdict carries
+  // over -- but only when the copy is not a view, since the verdict
+  // describes the plain buffer order.
+  if (col->ri.isabsent()) {
+    col->sortedness = sortedness;
+  }
   return col;
 }
 
@@ -197,8 +356,35 @@ Column* Column::rbind(std::vector<const Column*>& columns)
   }
   xassert(res->stype() == new_stype);
 
-  // TODO: Temporary Fix. To be resolved in #301
-  if (res->stats != nullptr) res->stats->reset();
+  // Try to maintain the stats incrementally instead of discarding them:
+  // most of the basic statistics are mergeable, so they can be updated from
+  // per-chunk stats computed over the appended rows only. This is possible
+  // when the column is extended without a type change (appended columns
+  // are either of the same stype, or VOID = all-NA runs); otherwise the
+  // stats are simply dropped as before.
+  if (res->stats != nullptr) {
+    bool can_merge = (res == this);
+    if (can_merge) {
+      for (const Column* col : columns) {
+        can_merge &= (col->stype() == SType::VOID) ||
+                     (col->stype() == new_stype);
+      }
+    }
+    if (can_merge) {
+      int64_t done_nrows = res->nrows;
+      for (const Column* col : columns) {
+        res->stats->merge_stats(col, done_nrows);
+        done_nrows += col->nrows;
+      }
+    } else {
+      res->stats->reset();
+    }
+  }
+  // Full cache reset, not a bare `sortedness = 0`: when the append happens
+  // in-place (the reserved-capacity fast path keeps this very object), a
+  // surviving validity bitmask or zone map would be sized for the old
+  // nrows, and the kernels consuming them would read past its allocation.
+  res->reset_sortedness();
 
   // Use the appropriate strategy to continue appending the columns.
   res->rbind_impl(columns, new_nrows, col_empty);
@@ -206,11 +392,32 @@ Column* Column::rbind(std::vector<const Column*>& columns)
   // If everything is fine, then the current column can be safely discarded
   // -- the upstream caller will replace this column with the `res`.
   if (res != this) delete this;
-  return res;
+
+  // If an intermediate promotion made the offsets wider than the combined
+  // data requires (e.g. str32 + str64 whose total still fits in 32 bits),
+  // shrink the result back.
+  Column* compacted = res->compact();
+  if (compacted != res) delete res;
+  return compacted;
+}
+
+
+Column* Column::compact() {
+  return this;
+}
+
+
+void Column::replace_values_batch(const Column*, const Column*) {
+  throw NotImplError() << "Bulk value replacement is not supported for "
+      "columns of stype " << stype();
 }
 
 
 void Column::replace_rowindex(const RowIndex& newri) {
+  // A pending background materialization belongs to the old rowindex (the
+  // mutation id does not change here, so the stale-result check would not
+  // catch it): discard it.
+  if (bg_reifying.load(std::memory_order_acquire)) _discard_bg_reify();
   ri = newri;
   nrows = ri.length();
 }
@@ -218,6 +425,10 @@ void Column::replace_rowindex(const RowIndex& newri) {
 
 
 Column::~Column() {
+  // Reap any background materialization still in flight, so that its
+  // result does not linger in the stash forever (or get mistaken for a
+  // result belonging to a future column at the same address).
+  if (bg_reifying.load(std::memory_order_acquire)) _discard_bg_reify();
   delete stats;
 }
 
@@ -238,6 +449,34 @@ size_t Column::memory_footprint() const
 
 
 
+RowIndex Column::hash_join(const Column* keycol) const {
+  return join(keycol);
+}
+
+
+RowIndex Column::semi_join(const Column* keycol, bool invert) const {
+  RowIndex jri = join(keycol);
+  arr32_t jidx = jri.extract_as_array32();
+  arr32_t matches(static_cast<size_t>(nrows));
+  int64_t w = 0;
+  for (int64_t i = 0; i < nrows; ++i) {
+    bool found = !ISNA<int32_t>(jidx[static_cast<size_t>(i)]);
+    if (found != invert) {
+      matches[static_cast<size_t>(w++)] = static_cast<int32_t>(i);
+    }
+  }
+  matches.resize(static_cast<size_t>(w));
+  return RowIndex::from_array32(std::move(matches), /* sorted = */ true);
+}
+
+
+RowIndex Column::str_match(int, const uint8_t*, size_t) const {
+  throw TypeError() << "Substring filters can only be applied to string "
+                       "columns, not " << stype();
+}
+
+
+
 //------------------------------------------------------------------------------
 // Stats
 //------------------------------------------------------------------------------
@@ -245,6 +484,9 @@ size_t Column::memory_footprint() const
 int64_t Column::countna() const { return get_stats()->countna(this); }
 int64_t Column::nunique() const { return get_stats()->nunique(this); }
 int64_t Column::nmodal() const  { return get_stats()->nmodal(this); }
+int64_t Column::nunique_estimate() const {
+  return get_stats()->nunique_estimate(this);
+}
 
 
 /**
@@ -304,6 +546,12 @@ Column* Column::cast(SType new_stype, MemoryRange&& mr) const {
   if (new_stype == stype()) {
     return shallowcopy();
   }
+  if (new_stype == SType::CAT32) {
+    // Dictionary encoding builds both the codes and the levels itself, and
+    // handles a rowindexed source; it does not fit the preallocated-target
+    // protocol of `cast_into()`.
+    return CategoricalColumn::from_strings(this);
+  }
   if (ri) {
     // TODO: implement this
     throw RuntimeError() << "Cannot cast a column with rowindex";
@@ -426,11 +674,12 @@ SType VoidColumn::stype() const { return SType::VOID; }
 size_t VoidColumn::elemsize() const { return 0; }
 bool VoidColumn::is_fixedwidth() const { return true; }
 int64_t VoidColumn::data_nrows() const { return nrows; }
-void VoidColumn::reify() {}
+void VoidColumn::reify_impl() {}
 void VoidColumn::resize_and_fill(int64_t) {}
 void VoidColumn::rbind_impl(std::vector<const Column*>&, int64_t, bool) {}
 void VoidColumn::apply_na_mask(const BoolColumn*) {}
 void VoidColumn::replace_values(RowIndex, const Column*) {}
+
 void VoidColumn::init_data() {}
 void VoidColumn::init_mmap(const std::string&) {}
 void VoidColumn::open_mmap(const std::string&, bool) {}
@@ -7,6 +7,10 @@
 //------------------------------------------------------------------------------
 #ifndef dt_COLUMN_h
 #define dt_COLUMN_h
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <Python.h>
@@ -76,6 +80,35 @@ protected:
   MemoryRange mbuf;
   RowIndex ri;
   mutable Stats* stats;
+  // Serializes the lazy allocation of `stats` in the get_stats() methods:
+  // once the GIL is released around native phases, two threads may request
+  // the stats of the same column concurrently. A single process-wide mutex
+  // suffices because the allocation happens at most once per column.
+  static std::mutex stats_alloc_mutex;
+  // Cached sortedness state: 0 = unknown, 1 = known to be sorted in ascending
+  // order with NAs first, 2 = known to be unsorted. This must be reset to 0
+  // whenever the column's data buffer is replaced or modified.
+  mutable int8_t sortedness;
+  // Cached validity bitmask: one bit per row, LSB-first within each byte
+  // (Arrow layout), with a set bit meaning the value is not NA. Empty until
+  // computed; like `sortedness`, must be reset whenever the column's data
+  // buffer is replaced or modified (see `reset_sortedness()`).
+  mutable MemoryRange vmask;
+  // Cached zone map: two doubles {min, max} per ZONE_NROWS-row chunk of the
+  // column (see `zone_map()`). Empty until computed; like `sortedness`, must
+  // be reset whenever the column's data buffer is replaced or modified.
+  mutable MemoryRange zmap;
+  // Mutation counter: a globally unique id assigned when the column is
+  // created, and replaced with a fresh one every time the column's data may
+  // have changed (see `bump_mutid()`). Caches that hold results derived from
+  // this column can use the pair (column, mutid) as a stable version key.
+  uint64_t mutid;
+  // Nonzero while a background materialization of this column is queued or
+  // running (see `reify_async()`). The background task never touches this
+  // column: it reifies a shallow copy, whose buffers `reify()` then adopts.
+  // When the flag is 0 -- the overwhelmingly common case -- checking it is
+  // a single relaxed load.
+  mutable std::atomic<int8_t> bg_reifying;
 
 public:  // TODO: convert this into private
   int64_t nrows;
@@ -84,6 +117,8 @@ public:
   static Column* new_data_column(SType, int64_t nrows);
   static Column* new_na_column(SType, int64_t nrows);
   static Column* new_mmap_column(SType, int64_t nrows, const std::string& filename);
+  static Column* new_computed_column(SType, int64_t nrows,
+                                     std::function<void(void*)> fn);
   static Column* open_mmap_column(SType, int64_t nrows, const std::string& filename,
                                   bool recode = false);
   static Column* new_xbuf_column(SType, int64_t nrows, Py_buffer* pybuffer);
@@ -117,7 +152,103 @@ public:
   virtual int64_t data_nrows() const = 0;
   size_t memory_footprint() const;
 
-  RowIndex sort(Groupby* out_groups) const;
+  /**
+   * Declare the expected access pattern for this column's data buffers (see
+   * `MmmAdvice` in "mmm.h"). For memory-mapped columns the hint is forwarded
+   * to the kernel via `madvise()`; for in-memory columns it is a no-op.
+   */
+  virtual void memory_advise(MmmAdvice a) const;
+
+  /**
+   * Accumulate this column's copy-on-write counters into `ncopies` and
+   * `nbytes` (see `MemoryRange::cow_count`). For string columns the string
+   * data buffer is included too.
+   */
+  virtual void cow_counters(size_t* ncopies, size_t* nbytes) const;
+
+  /**
+   * Ensure the column's data buffer has allocated capacity for at least
+   * `nrows` rows (see `MemoryRange::reserve`). Appends that fit within the
+   * reserved capacity then extend the buffer without reallocating it, so a
+   * long series of small rbinds costs O(1) amortized reallocations.
+   */
+  virtual void reserve_rows(int64_t nrows);
+
+  RowIndex sort(Groupby* out_groups, bool case_fold = false) const;
+
+  /**
+   * Incremental version of `sort()` for append-only data: given the
+   * ordering and groups that were computed when the column had `old_nrows`
+   * rows, sort only the appended tail and merge the two orderings. The
+   * result is identical to a full re-sort.
+   */
+  RowIndex sort_incremental(int64_t old_nrows, const RowIndex& old_order,
+                            const Groupby& old_grps,
+                            Groupby* out_grps) const;
+
+  /**
+   * Return a RowIndex with the rows of the `k` smallest (if `ascending`) or
+   * largest values in the column, in sorted order. See sort.cc for details.
+   */
+  RowIndex topk(size_t k, bool ascending) const;
+
+  /**
+   * Check whether the column's data is sorted in ascending order, with NAs
+   * at the front (i.e. the order that `sort()` produces). The first call
+   * runs a cheap parallel monotonicity scan over the data; the verdict is
+   * cached until the column's buffer is next modified. Columns that have a
+   * rowindex are not scanned and simply report `false`.
+   */
+  bool is_sorted() const;
+
+  /**
+   * Whether the column is already known to be sorted, without running the
+   * scan: true only when a previous `is_sorted()` call returned true (the
+   * verdict carries over to non-view shallow copies of the column).
+   */
+  bool is_sorted_cached() const { return sortedness == 1; }
+
+  void reset_sortedness() {
+    sortedness = 0;
+    vmask = MemoryRange();
+    zmap = MemoryRange();
+    bump_mutid();
+  }
+
+  /**
+   * Replace the column's mutation id with a fresh globally unique value.
+   * This is called from `reset_sortedness()`, i.e. at every point where the
+   * column's data buffer is replaced or modified, and invalidates any
+   * external cache keyed on the previous id.
+   */
+  void bump_mutid();
+  uint64_t mutation_id() const { return mutid; }
+
+  /**
+   * Validity bitmask of the column: one bit per row (LSB-first within each
+   * byte, as in Arrow), where a set bit means the value is not NA. The base
+   * implementation returns nullptr; fixed-width columns compute the mask
+   * from the sentinel values on first call and cache it until the data
+   * buffer is next modified. `has_validity_mask()` reports whether the mask
+   * is currently cached, without computing it. `set_validity_mask()` attaches
+   * a precomputed mask (at least `(nrows + 7) / 8` bytes long).
+   */
+  virtual const uint8_t* validity_mask() const { return nullptr; }
+  bool has_validity_mask() const { return bool(vmask); }
+  void set_validity_mask(MemoryRange&& mask);
+
+  /**
+   * Zone map of the column: per-chunk {min, max} bounds over every
+   * ZONE_NROWS rows, as two doubles per chunk (min first), with min > max
+   * denoting a chunk without valid (non-NA) values. The bounds are widened
+   * by one ulp after conversion, so they remain conservative even for
+   * 64-bit integers that round when cast to double. Filters consult the
+   * map to skip chunks that cannot contain matching rows. The base
+   * implementation returns nullptr; numeric fixed-width columns build the
+   * map on first call and cache it until the data buffer is next modified.
+   */
+  static constexpr int64_t ZONE_NROWS = 65536;
+  virtual const double* zone_map() const { return nullptr; }
 
   /**
    * Resize the column up to `nrows` elements, and fill all new elements with
@@ -179,6 +310,17 @@ public:
   virtual void replace_values(
     RowIndex replace_at, const Column* replace_with) = 0;
 
+  /**
+   * Apply a batch of value-replacement rules to this column in one parallel
+   * pass. `matches` and `repls` are parallel single-column rule lists: every
+   * cell equal to `matches[k]` is overwritten with `repls[k]`, and an NA
+   * match replaces the NA cells. All rules apply simultaneously, i.e. against
+   * the original values, so a `{1 -> 2, 2 -> 1}` swap behaves as expected.
+   * Both rule columns are cast to this column's stype first. Implemented for
+   * fixed-width numeric columns; the default implementation throws.
+   */
+  virtual void replace_values_batch(const Column* matches, const Column* repls);
+
   /**
    * Appends the provided columns to the bottom of the current column and
    * returns the resulting column. This method is equivalent to `list.append()`
@@ -195,6 +337,18 @@ public:
    */
   Column* rbind(std::vector<const Column*>& columns);
 
+  /**
+   * Returns a column with the same content but a smaller memory footprint,
+   * or `this` when no compaction applies. When a different column is
+   * returned the caller is expected to replace this column with the result
+   * and delete the original. Currently the only compaction is the demotion
+   * of str64 columns whose string data fits within 32-bit offsets back to
+   * str32; it is applied automatically after rbind and after materializing
+   * a view, so that a column promoted to 64-bit offsets by an intermediate
+   * operation does not keep double-width offsets forever.
+   */
+  virtual Column* compact();
+
   /**
    * "Materialize" the Column. If the Column has no rowindex, this is a no-op.
    * Otherwise, this method "applies" the rowindex to the column's data and
@@ -208,16 +362,69 @@ public:
    * If the Column's rowindex carries groupby information, then we retain it
    * by replacing the current rowindex with the "plain slice" (i.e. a slice
    * with step 1).
+   *
+   * The public `reify()` first joins any pending background materialization
+   * of this column, then dispatches to the virtual `reify_impl()` that does
+   * the actual work.
+   */
+  void reify();
+
+  /**
+   * Request that this view column be materialized on the background worker
+   * thread (see `dt::bg_submit`), overlapping the `reify()` cost with
+   * whatever the main thread does next -- typically Python-side think time.
+   * A no-op unless the `view.materialize_async` option is enabled; columns
+   * of PyObjects are never materialized in the background (their reify
+   * manipulates Python reference counts, which requires the GIL).
+   *
+   * The background task works on a shallow copy, so this column remains a
+   * perfectly valid view throughout -- consumers that never call `reify()`
+   * are unaffected. `reify()` adopts the precomputed buffers in O(1) if
+   * they are ready, blocks for them if the task is mid-flight, and steals
+   * the task (leaving the column lazy) if it has not started yet.
    */
-  virtual void reify() = 0;
+  void reify_async();
 
   virtual RowIndex join(const Column* keycol) const = 0;
 
+  /**
+   * Same as `join()`, but instead of binary-searching the sorted `keycol`,
+   * build an open-addressing hash table over it and then probe in parallel.
+   * `keycol` does not need to be sorted. The default implementation falls
+   * back to `join()`.
+   */
+  virtual RowIndex hash_join(const Column* keycol) const;
+
+  /**
+   * Membership filter: return a RowIndex of the rows whose value appears
+   * (`invert = false`, semi-join) or does not appear (`invert = true`,
+   * anti-join) in `keycol`. Only the table over `keycol` is built and the
+   * probes are counted -- no per-row join indices are materialized. The
+   * default implementation falls back to `join()`.
+   */
+  virtual RowIndex semi_join(const Column* keycol, bool invert) const;
+
+  /**
+   * Substring filter: return a RowIndex of the rows whose string value
+   * contains (`method = 0`), starts with (`method = 1`), or ends with
+   * (`method = 2`) the byte sequence `[pat, pat + len)`. NA rows never
+   * match; an empty pattern matches every non-NA row. Only string columns
+   * implement this; the default implementation raises a TypeError.
+   */
+  virtual RowIndex str_match(int method, const uint8_t* pat,
+                             size_t len) const;
+
   virtual void save_to_disk(const std::string&, WritableBuffer::Strategy);
 
   int64_t countna() const;
   int64_t nunique() const;
   int64_t nmodal() const;
+
+  /**
+   * Cheap sampled estimate of `nunique()`, for planning decisions (see
+   * Stats::nunique_estimate). Never scans the full column.
+   */
+  int64_t nunique_estimate() const;
   virtual int64_t min_int64() const { return GETNA<int64_t>(); }
   virtual int64_t max_int64() const { return GETNA<int64_t>(); }
 
@@ -243,6 +450,16 @@ public:
   virtual Column* nmodal_column() const;
   virtual Column* mode_column() const;
 
+  /**
+   * Build a two-column (value, count) DataTable tallying how many times
+   * each distinct value (including NA) occurs in this column. Fixed-width
+   * columns are counted via parallel per-thread hash tables (see CountTable
+   * in stats.cc); strings and very high-cardinality columns fall back to a
+   * groupby sort. With `sort_by_count` the rows are ordered by decreasing
+   * count (ties by value); otherwise by value, NA first.
+   */
+  DataTable* value_counts(bool sort_by_count) const;
+
   virtual PyObject* min_pyscalar() const;
   virtual PyObject* max_pyscalar() const;
   virtual PyObject* sum_pyscalar() const;
@@ -276,6 +493,24 @@ public:
 
 protected:
   Column(int64_t nrows = 0);
+  virtual void reify_impl() = 0;
+
+  /**
+   * Take over `donor`'s data buffers: `donor` is the reified shallow copy
+   * produced by a background materialization (same stype and nrows), so
+   * adopting its buffers and dropping our rowindex leaves the logical
+   * content of this column unchanged -- cached stats remain valid.
+   */
+  virtual void adopt_buffer_of(Column* donor);
+
+  // Synchronization with the background materialization task, used by
+  // `reify()`, `replace_rowindex()` and the destructor. `_take_bg_result()`
+  // steals-or-waits and returns the reified copy if one was produced and is
+  // still current; `_discard_bg_reify()` does the same but throws the
+  // result away.
+  std::shared_ptr<Column> _take_bg_result() const;
+  void _discard_bg_reify() const;
+
   virtual void init_data() = 0;
   virtual void init_mmap(const std::string& filename) = 0;
   virtual void open_mmap(const std::string& filename, bool recode) = 0;
@@ -343,9 +578,14 @@ public:
   void apply_na_mask(const BoolColumn* mask) override;
   size_t elemsize() const override;
   bool is_fixedwidth() const override;
-  virtual void reify() override;
+  virtual void reify_impl() override;
   virtual void replace_values(RowIndex at, const Column* with) override;
+  void replace_values_batch(const Column* matches, const Column* repls) override;
   virtual RowIndex join(const Column* keycol) const override;
+  virtual RowIndex hash_join(const Column* keycol) const override;
+  virtual RowIndex semi_join(const Column* keycol, bool invert) const override;
+  const uint8_t* validity_mask() const override;
+  const double* zone_map() const override;
 
 protected:
   void init_data() override;
@@ -363,6 +603,9 @@ protected:
 
 
 template <> void FwColumn<PyObject*>::set_elem(int64_t, PyObject*);
+template <> void FwColumn<PyObject*>::replace_values_batch(const Column*, const Column*);
+template <> const uint8_t* FwColumn<PyObject*>::validity_mask() const;
+template <> const double* FwColumn<PyObject*>::zone_map() const;
 extern template class FwColumn<int8_t>;
 extern template class FwColumn<int16_t>;
 extern template class FwColumn<int32_t>;
@@ -598,7 +841,7 @@ protected:
 
   void resize_and_fill(int64_t nrows) override;
   void fill_na() override;
-  void reify() override;
+  void reify_impl() override;
   friend Column;
 };
 
@@ -611,6 +854,22 @@ protected:
 template <typename T> class StringColumn : public Column
 {
   MemoryRange strbuf;
+  // Cached point-lookup hash index (see `index_equal_rows()`): `hidx_slots`
+  // holds open-addressing slots of (hash, head row) pairs, and `hidx_next`
+  // chains the remaining rows carrying the same hash. Keyed on the column's
+  // mutation id, so any change to the data invalidates the index implicitly.
+  // `hidx_query_mutid` remembers the last data version that received a point
+  // query: the index is only built on the second query against the same
+  // data, so one-off lookups keep the plain single-scan cost.
+  mutable MemoryRange hidx_slots;
+  mutable MemoryRange hidx_next;
+  mutable int hidx_shift = 0;
+  mutable uint64_t hidx_mutid = 0;
+  mutable uint64_t hidx_query_mutid = 0;
+  // Cached per-row string hashes (see `row_hashes()`), likewise keyed on the
+  // mutation id. Shared by every hash-consuming operation on the column.
+  mutable MemoryRange rhash_buf;
+  mutable uint64_t rhash_mutid = 0;
 
 public:
   StringColumn(int64_t nrows);
@@ -623,12 +882,43 @@ public:
   size_t elemsize() const override;
   bool is_fixedwidth() const override;
 
-  void reify() override;
+  void reify_impl() override;
+  void adopt_buffer_of(Column* donor) override;
   void resize_and_fill(int64_t nrows) override;
   void apply_na_mask(const BoolColumn* mask) override;
   RowIndex join(const Column* keycol) const override;
+  RowIndex hash_join(const Column* keycol) const override;
+  RowIndex semi_join(const Column* keycol, bool invert) const override;
+  RowIndex str_match(int method, const uint8_t* pat,
+                     size_t len) const override;
+
+  /**
+   * Equality point-lookup through the cached hash index: write into `out`
+   * (an `nrows`-sized boolean buffer) the result of comparing every row of
+   * this column against the single string `[str, str + len)`, or against NA
+   * when `isna` is true. With `invert` the comparison is `!=` instead of
+   * `==`; NA rows compare equal only to an NA needle, matching `strop_eq`.
+   * Returns false without touching `out` when the index path cannot be used
+   * (view column, or the first query against this version of the data), in
+   * which case the caller should fall back to the scan kernel.
+   */
+  bool index_equal_rows(const uint8_t* str, size_t len, bool isna,
+                        bool invert, int8_t* out) const;
+
+  /**
+   * Per-row FNV-1a hashes over the column's physical data rows, indexed by
+   * storage row number (so view columns may use them too, via the physical
+   * indices their rowindex yields). Computed chunk-parallel on first use and
+   * cached against the column's mutation id, so every hash-consuming
+   * operation (joins, point-lookup index, encoding) shares one computation
+   * per data version. NA rows hash to 0 and must be skipped by the caller.
+   */
+  const uint64_t* row_hashes() const;
 
   MemoryRange str_buf() { return strbuf; }
+  void memory_advise(MmmAdvice a) const override;
+  void cow_counters(size_t* ncopies, size_t* nbytes) const override;
+  void reserve_rows(int64_t nrows) override;
   size_t datasize() const;
   int64_t data_nrows() const override;
   const char* strdata() const;
@@ -636,11 +926,18 @@ public:
   const T* offsets() const;
   T* offsets_w();
 
+  CString min() const;
+  CString max() const;
   CString mode() const;
+  PyObject* min_pyscalar() const override;
+  PyObject* max_pyscalar() const override;
   PyObject* mode_pyscalar() const override;
+  Column* min_column() const override;
+  Column* max_column() const override;
   Column* mode_column() const override;
 
   Column* shallowcopy(const RowIndex& new_rowindex) const override;
+  Column* compact() override;
   void replace_values(RowIndex at, const Column* with) override;
 
   void verify_integrity(const std::string& name) const override;
@@ -656,6 +953,7 @@ protected:
                   bool isempty) override;
 
   StringStats<T>* get_stats() const override;
+  static Column* onevalue_column(const CString& v);
 
   // void cast_into(BoolColumn*) const override;
   // void cast_into(IntColumn<int8_t>*) const override;
@@ -668,6 +966,7 @@ protected:
   // void cast_into(StringColumn<uint32_t>*) const;
   void cast_into(StringColumn<uint64_t>*) const override;
   void fill_na() override;
+  void build_hash_index() const;
 
   //int verify_meta_integrity(std::vector<char>*, int, const char* = "Column") const override;
 
@@ -678,11 +977,75 @@ protected:
 
 template <> void StringColumn<uint32_t>::cast_into(StringColumn<uint64_t>*) const;
 template <> void StringColumn<uint64_t>::cast_into(StringColumn<uint64_t>*) const;
+// str64 columns can demote themselves back to str32, see column_string.cc
+template <> Column* StringColumn<uint64_t>::compact();
+
 extern template class StringColumn<uint32_t>;
 extern template class StringColumn<uint64_t>;
 
 
 
+//==============================================================================
+// Categorical column
+//==============================================================================
+
+/**
+ * Dictionary-encoded string column (SType::CAT32).
+ *
+ * The column's `mbuf` holds int32 codes, and two additional shared buffers
+ * `levels_offbuf` / `levels_strbuf` hold the dictionary of distinct values in
+ * the same layout as an STR32 column (without NAs). The levels are stored in
+ * ascending string order, so code order coincides with string order: by
+ * deriving from `IntColumn<int32_t>` this column reuses the entire
+ * fixed-width machinery -- sorting, grouping, filtering, zone maps and
+ * validity masks all operate on the codes and never touch the strings again
+ * after the initial encoding. An NA string is represented by an NA code.
+ *
+ * Note that the codes of two categorical columns are only comparable when
+ * the columns share the same dictionary; for this reason rbinding
+ * categorical columns is not supported (decode to strings first).
+ */
+class CategoricalColumn : public IntColumn<int32_t>
+{
+  MemoryRange levels_offbuf;
+  MemoryRange levels_strbuf;
+
+public:
+  CategoricalColumn(int64_t nrows, MemoryRange&& codes,
+                    MemoryRange&& offbuf, MemoryRange&& strbuf);
+
+  /**
+   * Dictionary-encode the string column `src` (STR32 or STR64), returning a
+   * new CategoricalColumn with the same logical content. The levels are
+   * collected via the sort/groupby machinery, i.e. each distinct string is
+   * hashed and compared exactly once.
+   */
+  static Column* from_strings(const Column* src);
+
+  SType stype() const override;
+  Column* shallowcopy(const RowIndex& new_rowindex) const override;
+  void cow_counters(size_t* ncopies, size_t* nbytes) const override;
+
+  int64_t nlevels() const;
+  const uint32_t* level_offsets() const;
+  const char* level_strdata() const;
+  CString level(int32_t code) const;
+
+  void verify_integrity(const std::string& name) const override;
+
+protected:
+  CategoricalColumn();
+  void rbind_impl(std::vector<const Column*>& columns, int64_t nrows,
+                  bool isempty) override;
+  void cast_into(StringColumn<uint32_t>*) const override;
+  void cast_into(StringColumn<uint64_t>*) const override;
+  void cast_into(PyObjectColumn*) const override;
+
+  friend Column;
+};
+
+
+
 //==============================================================================
 
 // "Fake" column, its only use is to serve as a placeholder for a Column with an
@@ -694,7 +1057,7 @@ class VoidColumn : public Column {
     size_t elemsize() const override;
     bool is_fixedwidth() const override;
     int64_t data_nrows() const override;
-    void reify() override;
+    void reify_impl() override;
     void resize_and_fill(int64_t) override;
     void rbind_impl(std::vector<const Column*>&, int64_t, bool) override;
     void apply_na_mask(const BoolColumn*) override;
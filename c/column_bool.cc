@@ -23,7 +23,10 @@ SType BoolColumn::stype() const {
 //------------------------------------------------------------------------------
 
 BooleanStats* BoolColumn::get_stats() const {
-  if (stats == nullptr) stats = new BooleanStats();
+  if (stats == nullptr) {
+    std::lock_guard<std::mutex> lock(Column::stats_alloc_mutex);
+    if (stats == nullptr) stats = new BooleanStats();
+  }
   return static_cast<BooleanStats*>(stats);
 }
 
@@ -87,10 +90,13 @@ typedef std::unique_ptr<MemoryWritableBuffer> MWBPtr;
 
 template <typename T>
 inline static void cast_helper(int64_t nrows, const int8_t* src, T* trg) {
-  #pragma omp parallel for schedule(static)
+  // Branchless (compute-then-select) so the loop autovectorizes.
+  constexpr int8_t na_src = GETNA<int8_t>();
+  #pragma omp parallel for simd schedule(static)
   for (int64_t i = 0; i < nrows; ++i) {
     int8_t x = src[i];
-    trg[i] = ISNA<int8_t>(x)? GETNA<T>() : static_cast<T>(x);
+    T v = static_cast<T>(x);
+    trg[i] = (x == na_src)? GETNA<T>() : v;
   }
 }
 
@@ -0,0 +1,312 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include "column.h"
+#include <cstring>
+#include "options.h"
+#include "py_utils.h"
+#include "utils/assert.h"
+#include "utils/omp.h"
+
+
+
+CategoricalColumn::CategoricalColumn() : IntColumn<int32_t>() {}
+
+CategoricalColumn::CategoricalColumn(
+    int64_t nrows_, MemoryRange&& codes, MemoryRange&& offbuf,
+    MemoryRange&& strbuf)
+  : IntColumn<int32_t>(nrows_, std::move(codes))
+{
+  levels_offbuf = std::move(offbuf);
+  levels_strbuf = std::move(strbuf);
+}
+
+
+SType CategoricalColumn::stype() const {
+  return SType::CAT32;
+}
+
+
+Column* CategoricalColumn::shallowcopy(const RowIndex& new_rowindex) const {
+  Column* newcol = Column::shallowcopy(new_rowindex);
+  CategoricalColumn* col = static_cast<CategoricalColumn*>(newcol);
+  col->levels_offbuf = levels_offbuf;
+  col->levels_strbuf = levels_strbuf;
+  return col;
+}
+
+
+void CategoricalColumn::cow_counters(size_t* ncopies, size_t* nbytes) const {
+  Column::cow_counters(ncopies, nbytes);
+  *ncopies += levels_offbuf.cow_count() + levels_strbuf.cow_count();
+  *nbytes += levels_offbuf.cow_bytes() + levels_strbuf.cow_bytes();
+}
+
+
+int64_t CategoricalColumn::nlevels() const {
+  return static_cast<int64_t>(levels_offbuf.size() / sizeof(uint32_t)) - 1;
+}
+
+// The offsets are stored with an extra 0 at the front, same as in a
+// StringColumn: `level_offsets()[-1]` is a valid read returning 0.
+const uint32_t* CategoricalColumn::level_offsets() const {
+  return static_cast<const uint32_t*>(levels_offbuf.rptr()) + 1;
+}
+
+const char* CategoricalColumn::level_strdata() const {
+  return static_cast<const char*>(levels_strbuf.rptr());
+}
+
+
+CString CategoricalColumn::level(int32_t code) const {
+  if (ISNA<int32_t>(code)) return CString { nullptr, -1 };
+  xassert(code >= 0 && code < nlevels());
+  const uint32_t* offs = level_offsets();
+  uint32_t start = offs[code - 1];
+  return CString { level_strdata() + start,
+                   static_cast<int64_t>(offs[code] - start) };
+}
+
+
+
+//------------------------------------------------------------------------------
+// Encoding
+//------------------------------------------------------------------------------
+
+/**
+ * Read out the distinct values of the sorted & grouped column `col` into the
+ * STR32-like level buffers, and report which group (if any) holds the NAs.
+ * `riarr` / `goffs` describe the grouping: rows `riarr[goffs[g]] ..
+ * riarr[goffs[g+1] - 1]` of `col` all contain the value of group `g`.
+ */
+template <typename T>
+static void gather_levels(
+    const StringColumn<T>* col, const arr32_t& riarr, const int32_t* goffs,
+    size_t ngroups, int64_t& na_group,
+    MemoryRange& out_offbuf, MemoryRange& out_strbuf)
+{
+  const T* offs = col->offsets();
+  const char* strs = col->strdata();
+
+  // First pass: locate the NA group and measure the total level size.
+  size_t total_size = 0;
+  for (size_t g = 0; g < ngroups; ++g) {
+    int32_t row = riarr[static_cast<size_t>(goffs[g])];
+    T end = offs[row];
+    if (ISNA<T>(end)) {
+      na_group = static_cast<int64_t>(g);
+      continue;
+    }
+    T start = offs[row - 1] & ~GETNA<T>();
+    total_size += static_cast<size_t>(end - start);
+  }
+  if (total_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+    throw ValueError() << "Cannot create a categorical column: the combined "
+        "size of the distinct values is " << total_size << " bytes, which "
+        "exceeds the 2GB dictionary limit";
+  }
+
+  size_t nlevels = ngroups - (na_group >= 0);
+  out_offbuf = MemoryRange::mem((nlevels + 1) * sizeof(uint32_t));
+  out_strbuf = MemoryRange::mem(total_size);
+  auto lvl_offs = static_cast<uint32_t*>(out_offbuf.wptr());
+  auto lvl_strs = static_cast<char*>(out_strbuf.wptr());
+
+  // Second pass: copy each group's first string into the level buffers.
+  lvl_offs[0] = 0;
+  uint32_t cur = 0;
+  size_t k = 1;
+  for (size_t g = 0; g < ngroups; ++g) {
+    if (static_cast<int64_t>(g) == na_group) continue;
+    int32_t row = riarr[static_cast<size_t>(goffs[g])];
+    T end = offs[row];
+    T start = offs[row - 1] & ~GETNA<T>();
+    size_t len = static_cast<size_t>(end - start);
+    std::memcpy(lvl_strs + cur, strs + start, len);
+    cur += static_cast<uint32_t>(len);
+    lvl_offs[k++] = cur;
+  }
+}
+
+
+Column* CategoricalColumn::from_strings(const Column* src) {
+  SType st = src->stype();
+  if (st != SType::STR32 && st != SType::STR64) {
+    throw TypeError() << "Column of type `" << info(st).name() << "` cannot "
+        "be converted into a categorical: a string column is required";
+  }
+  int64_t nrows = src->nrows;
+  if (nrows == 0) {
+    MemoryRange offbuf = MemoryRange::mem(sizeof(uint32_t));
+    static_cast<uint32_t*>(offbuf.wptr())[0] = 0;
+    return new CategoricalColumn(0, MemoryRange::mem(size_t(0)),
+                                 std::move(offbuf),
+                                 MemoryRange::mem(size_t(0)));
+  }
+
+  // Group the equal values via the sort machinery: each distinct string is
+  // compared / hashed exactly once, here.
+  Column* col = src->shallowcopy();
+  col->reify();
+  Groupby gb;
+  RowIndex sort_ri = col->sort(&gb);
+  arr32_t riarr = sort_ri.extract_as_array32();
+  const int32_t* goffs = gb.offsets_r();
+  size_t ngroups = gb.ngroups();
+
+  int64_t na_group = -1;
+  MemoryRange offbuf, strbuf;
+  if (col->stype() == SType::STR32) {
+    gather_levels(static_cast<const StringColumn<uint32_t>*>(col),
+                  riarr, goffs, ngroups, na_group, offbuf, strbuf);
+  } else {
+    gather_levels(static_cast<const StringColumn<uint64_t>*>(col),
+                  riarr, goffs, ngroups, na_group, offbuf, strbuf);
+  }
+  delete col;
+
+  // Scatter the codes: all rows of group `g` share one code. The groups are
+  // in ascending value order, so the codes come out dictionary-ordered.
+  MemoryRange codes = MemoryRange::mem(
+      static_cast<size_t>(nrows) * sizeof(int32_t));
+  auto d_codes = static_cast<int32_t*>(codes.wptr());
+  int64_t zgroups = static_cast<int64_t>(ngroups);
+  config::thread_grant tgrant;
+  #pragma omp parallel for schedule(dynamic) num_threads(tgrant.nthreads())
+  for (int64_t g = 0; g < zgroups; ++g) {
+    int32_t code = (g == na_group)
+        ? GETNA<int32_t>()
+        : static_cast<int32_t>(g - (na_group >= 0 && g > na_group));
+    for (int32_t j = goffs[g]; j < goffs[g + 1]; ++j) {
+      d_codes[riarr[static_cast<size_t>(j)]] = code;
+    }
+  }
+
+  return new CategoricalColumn(nrows, std::move(codes), std::move(offbuf),
+                               std::move(strbuf));
+}
+
+
+
+//------------------------------------------------------------------------------
+// Decoding
+//------------------------------------------------------------------------------
+
+template <typename T>
+static MemoryRange decode_helper(
+    const CategoricalColumn* src, StringColumn<T>* target)
+{
+  const int32_t* codes = src->elements_r();
+  const uint32_t* loffs = src->level_offsets();
+  const char* lstrs = src->level_strdata();
+  T* toffsets = target->offsets_w();
+
+  size_t total_size = 0;
+  for (int64_t i = 0; i < src->nrows; ++i) {
+    int32_t x = codes[i];
+    if (ISNA<int32_t>(x)) continue;
+    total_size += loffs[x] - loffs[x - 1];
+  }
+  MemoryRange strbuf = MemoryRange::mem(total_size);
+  auto trg = static_cast<char*>(strbuf.wptr());
+
+  toffsets[-1] = 0;
+  T offset = 0;
+  for (int64_t i = 0; i < src->nrows; ++i) {
+    int32_t x = codes[i];
+    if (ISNA<int32_t>(x)) {
+      toffsets[i] = offset | GETNA<T>();
+    } else {
+      uint32_t start = loffs[x - 1];
+      size_t len = loffs[x] - start;
+      std::memcpy(trg + offset, lstrs + start, len);
+      offset += static_cast<T>(len);
+      toffsets[i] = offset;
+    }
+  }
+  return strbuf;
+}
+
+
+void CategoricalColumn::cast_into(StringColumn<uint32_t>* target) const {
+  MemoryRange strbuf = decode_helper<uint32_t>(this, target);
+  target->replace_buffer(target->data_buf(), std::move(strbuf));
+}
+
+void CategoricalColumn::cast_into(StringColumn<uint64_t>* target) const {
+  MemoryRange strbuf = decode_helper<uint64_t>(this, target);
+  target->replace_buffer(target->data_buf(), std::move(strbuf));
+}
+
+void CategoricalColumn::cast_into(PyObjectColumn* target) const {
+  const int32_t* codes = elements_r();
+  PyObject** trg_data = target->elements_w();
+  for (int64_t i = 0; i < nrows; ++i) {
+    CString val = level(codes[i]);
+    trg_data[i] = val.size < 0
+        ? none() : PyUnicode_FromStringAndSize(val.ch, val.size);
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+// Other overrides
+//------------------------------------------------------------------------------
+
+void CategoricalColumn::rbind_impl(
+    std::vector<const Column*>&, int64_t, bool)
+{
+  // The codes of two categorical columns are only comparable when the columns
+  // share the same dictionary, which rbind cannot assume.
+  throw NotImplError() << "Categorical columns cannot be rbinded: convert "
+      "them to strings first";
+}
+
+
+void CategoricalColumn::verify_integrity(const std::string& name) const {
+  Column::verify_integrity(name);
+
+  size_t offsize = levels_offbuf.size();
+  if (offsize < sizeof(uint32_t) || offsize % sizeof(uint32_t)) {
+    throw AssertionError()
+        << "Level offsets buffer in " << name << " has size " << offsize
+        << ", which is not a positive multiple of " << sizeof(uint32_t);
+  }
+  int64_t nlvls = nlevels();
+  const uint32_t* loffs = level_offsets();
+  if (loffs[-1] != 0) {
+    throw AssertionError()
+        << "Level offsets in " << name << " do not start with 0";
+  }
+  for (int64_t k = 0; k < nlvls; ++k) {
+    if (loffs[k] < loffs[k - 1]) {
+      throw AssertionError()
+          << "Level offsets in " << name << " are not monotonic: offset of "
+          << "level " << k << " is " << loffs[k] << ", previous is "
+          << loffs[k - 1];
+    }
+  }
+  if (nlvls > 0 && loffs[nlvls - 1] > levels_strbuf.size()) {
+    throw AssertionError()
+        << "Level offsets in " << name << " exceed the string data buffer "
+        << "size " << levels_strbuf.size();
+  }
+  if (!ri) {
+    const int32_t* codes = elements_r();
+    int64_t ndata = data_nrows();
+    for (int64_t i = 0; i < ndata; ++i) {
+      int32_t x = codes[i];
+      if (!ISNA<int32_t>(x) && (x < 0 || x >= nlvls)) {
+        throw AssertionError()
+            << "Code " << x << " in row " << i << " of " << name
+            << " is out of bounds for a dictionary with " << nlvls
+            << " levels";
+      }
+    }
+  }
+}
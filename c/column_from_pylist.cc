@@ -6,10 +6,13 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include "column.h"
+#include <atomic>
 #include <cstdlib>         // std::abs
 #include <limits>          // std::numeric_limits
 #include <type_traits>     // std::is_same
+#include <vector>
 #include "py_types.h"      // PyLong_AsInt64AndOverflow
+#include "py_utils.h"      // GILReleased
 #include "python/dict.h"   // py::rdict
 #include "python/float.h"  // py::float
 #include "python/int.h"    // py::oint
@@ -184,6 +187,58 @@ static bool parse_as_int(const iterable* list, MemoryRange& membuf, size_t& from
   membuf.resize(nrows * sizeof(T));
   T* outdata = static_cast<T*>(membuf.wptr());
 
+  // Fast bulk path: one pass under the GIL verifies that every element is
+  // either None or a plain `int` (an exact-type check is a single field
+  // comparison), staging the object pointers into an array; the numeric
+  // payloads are then decoded outside the GIL, in parallel.
+  // PyLong_AsInt64AndOverflow on an exact PyLong neither allocates, nor
+  // raises, nor touches interpreter state, so it is safe to call without
+  // the GIL while the staged (borrowed) pointers are kept alive by the
+  // source list. Subclassed ints and other oddities fall through to the
+  // generic loop below.
+  {
+    std::vector<PyObject*> ptrs;
+    ptrs.reserve(nrows);
+    bool plain = true;
+    for (size_t i = 0; i < nrows; ++i) {
+      PyObject* p = list->item(i).to_borrowed_ref();
+      if (p && (p == Py_None || PyLong_CheckExact(p))) {
+        ptrs.push_back(p);
+      } else {
+        plain = false;
+        break;
+      }
+    }
+    if (plain) {
+      int64_t n = static_cast<int64_t>(nrows);
+      std::atomic<int64_t> bad(-1);
+      constexpr int64_t MAX =
+          static_cast<int64_t>(std::numeric_limits<T>::max());
+      {
+        GILReleased gil;
+        #pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < n; ++i) {
+          PyObject* p = ptrs[static_cast<size_t>(i)];
+          if (p == Py_None) {
+            outdata[i] = GETNA<T>();
+            continue;
+          }
+          int ovf = 0;
+          int64_t x = PyLong_AsInt64AndOverflow(p, &ovf);
+          if (ovf || (sizeof(T) < 8 && (x > MAX || x < -MAX))) {
+            int64_t expected = -1;
+            bad.compare_exchange_strong(expected, i);
+          } else {
+            outdata[i] = static_cast<T>(x);
+          }
+        }
+      }
+      if (bad.load() < 0) return true;
+      from = static_cast<size_t>(bad.load());
+      return false;
+    }
+  }
+
   int overflow = 0;
   for (int j = 0; j < 2; ++j) {
     size_t ifrom = j ? 0 : from;
@@ -253,6 +308,50 @@ static bool parse_as_double(const iterable* list, MemoryRange& membuf, size_t& f
   membuf.resize(nrows * sizeof(double));
   double* outdata = static_cast<double*>(membuf.wptr());
 
+  // Fast bulk path, mirroring the one in `parse_as_int`: stage the object
+  // pointers under the GIL (verifying each is None, a plain int, or a
+  // plain float), then decode outside the GIL in parallel -- reading a
+  // PyFloat's payload is a plain field access. Ints too large for int64
+  // need PyLong_AsDouble, which can raise and thus requires the GIL, so
+  // if any is encountered the whole list is re-parsed by the generic loop.
+  {
+    std::vector<PyObject*> ptrs;
+    ptrs.reserve(nrows);
+    bool plain = true;
+    for (size_t i = 0; i < nrows; ++i) {
+      PyObject* p = list->item(i).to_borrowed_ref();
+      if (p && (p == Py_None || PyLong_CheckExact(p) ||
+                PyFloat_CheckExact(p))) {
+        ptrs.push_back(p);
+      } else {
+        plain = false;
+        break;
+      }
+    }
+    if (plain) {
+      int64_t n = static_cast<int64_t>(nrows);
+      std::atomic<bool> big(false);
+      {
+        GILReleased gil;
+        #pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < n; ++i) {
+          PyObject* p = ptrs[static_cast<size_t>(i)];
+          if (p == Py_None) {
+            outdata[i] = GETNA<double>();
+          } else if (PyFloat_CheckExact(p)) {
+            outdata[i] = PyFloat_AS_DOUBLE(p);
+          } else {
+            int ovf = 0;
+            int64_t x = PyLong_AsInt64AndOverflow(p, &ovf);
+            if (ovf) big = true;
+            else outdata[i] = static_cast<double>(x);
+          }
+        }
+      }
+      if (!big) return true;
+    }
+  }
+
   int overflow = 0;
   for (int j = 0; j < 2; ++j) {
     size_t ifrom = j ? 0 : from;
@@ -478,6 +577,68 @@ static bool parse_as_pyobj(const iterable* list, MemoryRange& membuf)
 // Parse controller
 //------------------------------------------------------------------------------
 
+/**
+ * Sampling pre-scan: look at ~1000 evenly spaced elements of the list and
+ * pick the smallest stype that would accommodate all of them under the
+ * same rules the parse cascade applies. Starting the cascade at that stype
+ * avoids the repeated full-list restarts that a cold start from BOOL
+ * incurs on large homogeneous lists; if the sample missed an outlier, the
+ * cascade's normal type-bump logic still corrects it. Returns 0 when no
+ * suggestion can be made.
+ */
+static int prescan_stype(const iterable* list) {
+  constexpr size_t NSAMPLE = 1000;
+  size_t nrows = list->size();
+  if (nrows == 0) return 0;
+  size_t step = nrows <= NSAMPLE? 1 : nrows / NSAMPLE;
+  bool seen_bool = false, seen_int = false, seen_float = false,
+       seen_str = false, seen_other = false;
+  int64_t vmin = 0, vmax = 0;
+  auto classify = [&](size_t i) {
+    py::obj item = list->item(i);
+    if (item.is_none()) {}
+    else if (item.is_bool()) seen_bool = true;
+    else if (item.is_int()) {
+      int overflow = 0;
+      int64_t x = item.to_pyint().value<int64_t>(&overflow);
+      if (overflow) { seen_float = true; return; }
+      if (!seen_int) { vmin = vmax = x; seen_int = true; }
+      else if (x < vmin) vmin = x;
+      else if (x > vmax) vmax = x;
+    }
+    else if (item.is_float()) seen_float = true;
+    else if (item.is_string()) seen_str = true;
+    else seen_other = true;
+  };
+  for (size_t i = 0; i < nrows && !seen_other; i += step) {
+    classify(i);
+  }
+  // Extremes are often at the ends; make sure the last element is sampled.
+  if (!seen_other) classify(nrows - 1);
+
+  if (seen_other) return static_cast<int>(SType::OBJ);
+  // `parse_as_bool` also accepts plain ints 0 and 1, so such lists must
+  // start (and stay) at BOOL, same as the unassisted cascade would.
+  if (!seen_str && !seen_float && (!seen_int || (vmin >= 0 && vmax <= 1))) {
+    return static_cast<int>(SType::BOOL);
+  }
+  if (seen_str) {
+    return (seen_bool || seen_int || seen_float)? static_cast<int>(SType::OBJ)
+                                                : static_cast<int>(SType::STR32);
+  }
+  // Bools mixed with wider numbers fail every numeric candidate (`is_int`
+  // and `is_float` both exclude bools), ending up as OBJ.
+  if (seen_bool) return static_cast<int>(SType::OBJ);
+  if (seen_float) return static_cast<int>(SType::FLOAT64);
+  // Ints only: bounds are symmetric, mirroring `py::oint::value<T>`.
+  if (vmin >= -127 && vmax <= 127) return static_cast<int>(SType::INT8);
+  if (vmin >= -32767 && vmax <= 32767) return static_cast<int>(SType::INT16);
+  constexpr int64_t MAX32 = std::numeric_limits<int32_t>::max();
+  if (vmin >= -MAX32 && vmax <= MAX32) return static_cast<int>(SType::INT32);
+  return static_cast<int>(SType::INT64);
+}
+
+
 static int find_next_stype(int curr_stype, int stype0) {
   if (stype0 > 0) {
     return stype0;
@@ -499,6 +660,12 @@ Column* Column::from_py_iterable(const iterable* il, int stype0)
   MemoryRange strbuf;
   // TODO: Perhaps `stype` and `curr_stype` should have type SType ?
   int stype = find_next_stype(0, stype0);
+  if (stype0 == 0) {
+    // In auto-detect mode, let the sampling pre-scan pick the starting
+    // candidate; the cascade below remains as the correctness net.
+    int guess = prescan_stype(il);
+    if (guess > stype) stype = guess;
+  }
   size_t i = 0;
   while (stype) {
     int next_stype = find_next_stype(stype, stype0);
@@ -5,10 +5,16 @@
 //
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
+#include <algorithm>    // std::min
+#include <cstring>      // std::memcpy, std::memset
+#include <memory>       // std::make_shared
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 #include "column.h"
 #include "utils.h"
 #include "utils/assert.h"
+#include "utils/exceptions.h"
 #include "utils/omp.h"
 
 
@@ -91,8 +97,104 @@ void FwColumn<T>::replace_buffer(MemoryRange&& new_mbuf) {
   }
   mbuf = std::move(new_mbuf);
   nrows = static_cast<int64_t>(mbuf.size() / sizeof(T));
+  reset_sortedness();
 }
 
+/**
+ * Return the column's validity bitmask (see column.h), computing it from the
+ * sentinel values on first call. The mask is only available on materialized
+ * columns: when a rowindex is present this returns nullptr.
+ */
+template <typename T>
+const uint8_t* FwColumn<T>::validity_mask() const {
+  if (!vmask) {
+    if (!ri.isabsent()) return nullptr;
+    size_t nbytes = (static_cast<size_t>(nrows) + 7) / 8;
+    MemoryRange mr = MemoryRange::mem(nbytes);
+    uint8_t* bits = static_cast<uint8_t*>(mr.wptr());
+    const T* vals = static_cast<const T*>(mbuf.rptr());
+    int64_t nb = static_cast<int64_t>(nbytes);
+    #pragma omp parallel for schedule(static)
+    for (int64_t b = 0; b < nb; ++b) {
+      int64_t i0 = b * 8;
+      int jmax = nrows - i0 < 8? static_cast<int>(nrows - i0) : 8;
+      uint8_t m = 0;
+      for (int j = 0; j < jmax; ++j) {
+        m = static_cast<uint8_t>(m | (!ISNA<T>(vals[i0 + j]) << j));
+      }
+      bits[b] = m;
+    }
+    vmask = std::move(mr);
+  }
+  return static_cast<const uint8_t*>(vmask.rptr());
+}
+
+template <>
+const uint8_t* FwColumn<PyObject*>::validity_mask() const {
+  return nullptr;
+}
+
+
+template <>
+const double* FwColumn<PyObject*>::zone_map() const {
+  return nullptr;
+}
+
+template <typename T>
+const double* FwColumn<T>::zone_map() const {
+  // The buffer's size encodes the chunk count it was built for: if it does
+  // not match the current nrows (e.g. a mutator resized the column without
+  // going through `reset_sortedness()`), discard it rather than let the
+  // filter kernels index past its allocation.
+  if (zmap) {
+    int64_t nchunks = (nrows + ZONE_NROWS - 1) / ZONE_NROWS;
+    if (zmap.size() != static_cast<size_t>(nchunks) * 2 * sizeof(double)) {
+      zmap = MemoryRange();
+    }
+  }
+  if (!zmap) {
+    if (!ri.isabsent()) return nullptr;
+    int64_t nchunks = (nrows + ZONE_NROWS - 1) / ZONE_NROWS;
+    if (nchunks < 2) return nullptr;  // pruning needs more than one chunk
+    MemoryRange mr = MemoryRange::mem(
+        static_cast<size_t>(nchunks) * 2 * sizeof(double));
+    double* zones = static_cast<double*>(mr.wptr());
+    const T* vals = static_cast<const T*>(mbuf.rptr());
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    #pragma omp parallel for schedule(static)
+    for (int64_t c = 0; c < nchunks; ++c) {
+      int64_t i0 = c * ZONE_NROWS;
+      int64_t i1 = std::min(i0 + ZONE_NROWS, nrows);
+      bool have = false;
+      T tmin = T();
+      T tmax = T();
+      for (int64_t i = i0; i < i1; ++i) {
+        T x = vals[i];
+        if (ISNA<T>(x)) continue;
+        if (!have) {
+          tmin = tmax = x;
+          have = true;
+        } else {
+          if (x < tmin) tmin = x;
+          if (x > tmax) tmax = x;
+        }
+      }
+      if (have) {
+        // Widen by one ulp so the bounds stay conservative even when a
+        // 64-bit integer rounds during the conversion to double.
+        zones[c*2]     = std::nextafter(static_cast<double>(tmin), -inf);
+        zones[c*2 + 1] = std::nextafter(static_cast<double>(tmax), +inf);
+      } else {
+        zones[c*2]     = 1.0;   // min > max: no valid values in this chunk
+        zones[c*2 + 1] = -1.0;
+      }
+    }
+    zmap = std::move(mr);
+  }
+  return static_cast<const double*>(zmap.rptr());
+}
+
+
 template <typename T>
 size_t FwColumn<T>::elemsize() const {
   return sizeof(T);
@@ -135,13 +237,53 @@ void FwColumn<T>::set_elem(int64_t i, T value) {
 }
 
 
+/**
+ * Gather `n` elements of `src` selected by the index array `idx` into
+ * `dest`, copying each run of consecutive indices with one memcpy. NA
+ * indices produce NA values and break the runs; when the rowindex bounds
+ * guarantee there are no NA indices (`min >= 0`), the caller passes
+ * `may_have_nas = false` and the per-element NA test is skipped.
+ */
+template <typename TI, typename T>
+static void gather_runs(const T* src, const TI* idx, int64_t n, T* dest,
+                        bool may_have_nas) {
+  // Threads own disjoint chunks of the output, so the run-detection can
+  // proceed within each chunk with no coordination.
+  #pragma omp parallel
+  {
+    int nths = omp_get_num_threads();
+    int ith = omp_get_thread_num();
+    int64_t chunksize = (n + nths - 1) / nths;
+    int64_t r0 = ith * chunksize;
+    int64_t rend = std::min(r0 + chunksize, n);
+    while (r0 < rend) {
+      TI j0 = idx[r0];
+      if (may_have_nas && ISNA<TI>(j0)) {
+        dest[r0++] = GETNA<T>();
+        continue;
+      }
+      int64_t r1 = r0 + 1;
+      while (r1 < rend && idx[r1] == j0 + static_cast<TI>(r1 - r0)) r1++;
+      std::memcpy(dest + r0, src + j0,
+                  static_cast<size_t>(r1 - r0) * sizeof(T));
+      r0 = r1;
+    }
+  }
+}
+
+
 template <typename T>
-void FwColumn<T>::reify() {
+void FwColumn<T>::reify_impl() {
   // If the rowindex is absent, then the column is already materialized.
   if (ri.isabsent()) return;
+  dt::cow::Operation cowop("reify");
   bool simple_slice = ri.isslice() && ri.slice_step() == 1;
   bool ascending    = ri.isslice() && ri.slice_step() > 0;
 
+  // An array rowindex gathers from the data buffer in arbitrary order:
+  // tell the kernel not to waste effort on read-ahead.
+  if (ri.isarray()) mbuf.advise(MmmAdvice::Random);
+
   size_t elemsize = sizeof(T);
   size_t newsize = elemsize * static_cast<size_t>(nrows);
 
@@ -153,6 +295,10 @@ void FwColumn<T>::reify() {
   // this must be taken into consideration.
   MemoryRange newmr;
 
+  bool full_reverse = ri.isslice() && ri.slice_step() == -1 &&
+                      ri.slice_start() == nrows - 1 &&
+                      newsize == mbuf.size();
+
   if (simple_slice) {
     // Slice with step 1: a portion of the buffer can be simply mem-copied onto
     // the new buffer.
@@ -163,19 +309,67 @@ void FwColumn<T>::reify() {
         : newmr.resize(newsize).wptr();
     std::memmove(dest, src, newsize);
 
+  } else if (full_reverse && mbuf.is_writable()) {
+    // The view is a straight reversal of the column (DT[::-1]): flip the
+    // buffer in place by swapping mirrored pairs, with no allocation at
+    // all. The pairs are disjoint, so the loop parallelizes trivially.
+    T* data = static_cast<T*>(mbuf.wptr());
+    int64_t half = nrows / 2;
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < half; ++i) {
+      std::swap(data[i], data[nrows - 1 - i]);
+    }
+
+  } else if (ri.isarray()) {
+    // Clustered selections (e.g. range filters on sorted frames) produce
+    // long runs of consecutive indices: gather each run with a single
+    // memcpy instead of an element-by-element loop. The destination is a
+    // fresh buffer, so this is safe for indices in any order.
+    const T* data_src = static_cast<const T*>(mbuf.rptr());
+    T* data_dest = static_cast<T*>(newmr.resize(newsize).wptr());
+    bool may_have_nas = (ri.min() < 0);
+    if (ri.isarr32()) {
+      gather_runs<int32_t>(data_src, ri.indices32(), nrows, data_dest,
+                           may_have_nas);
+    } else {
+      gather_runs<int64_t>(data_src, ri.indices64(), nrows, data_dest,
+                           may_have_nas);
+    }
+
   } else {
-    // In all other cases we have to manually loop over the rowindex and
-    // copy array elements onto the new positions. This can be done in-place
-    // only if we know that the indices are monotonically increasing (otherwise
-    // there is a risk of scrambling the data).
+    // The rowindex is a slice with step != 1, or a virtual (repeat/tile)
+    // index. When the data is gathered into a fresh buffer, the strided
+    // loads are independent and the loop is run in parallel (the
+    // stride-indexed form also lets the compiler emit vector gathers). The
+    // in-place variant must stay sequential: rows are overwritten that
+    // later iterations still need to read -- which is only safe when
+    // processed in ascending order.
     const T* data_src = static_cast<const T*>(mbuf.rptr());
-    T* data_dest = mbuf.is_writable() && ascending
-       ? static_cast<T*>(mbuf.wptr())
-       : static_cast<T*>(newmr.resize(newsize).wptr());
-    ri.strided_loop(0, nrows, 1,
-      [&](int64_t i) {
-        *data_dest++ = ISNA(i)? GETNA<T>() : data_src[i];
-      });
+    if (mbuf.is_writable() && ascending) {
+      T* data_dest = static_cast<T*>(mbuf.wptr());
+      ri.strided_loop(0, nrows, 1,
+        [&](int64_t i) {
+          *data_dest++ = data_src[i];
+        });
+    } else if (ri.isslice()) {
+      T* data_dest = static_cast<T*>(newmr.resize(newsize).wptr());
+      int64_t sstart = ri.slice_start();
+      int64_t sstep = ri.slice_step();
+      #pragma omp parallel for schedule(static)
+      for (int64_t i = 0; i < nrows; ++i) {
+        data_dest[i] = data_src[sstart + i * sstep];
+      }
+    } else {
+      // Repeat/tile: the mapping is computed arithmetically per row, so
+      // no index array is ever materialized.
+      T* data_dest = static_cast<T*>(newmr.resize(newsize).wptr());
+      int64_t period = ri.repeat_period();
+      int64_t inner = ri.repeat_inner();
+      #pragma omp parallel for schedule(static)
+      for (int64_t i = 0; i < nrows; ++i) {
+        data_dest[i] = data_src[(i / inner) % period];
+      }
+    }
   }
 
   if (newmr) {
@@ -184,6 +378,7 @@ void FwColumn<T>::reify() {
     mbuf.resize(newsize);
   }
   ri.clear();
+  reset_sortedness();
 }
 
 
@@ -207,6 +402,7 @@ void FwColumn<T>::resize_and_fill(int64_t new_nrows)
 
   // TODO(#301): Temporary fix.
   if (this->stats != nullptr) this->stats->reset();
+  this->reset_sortedness();
 }
 
 
@@ -215,31 +411,71 @@ void FwColumn<T>::rbind_impl(std::vector<const Column*>& columns,
                              int64_t new_nrows, bool col_empty)
 {
   const T na = na_elem;
-  const void* naptr = static_cast<const void*>(&na);
 
-  // Reallocate the column's data buffer
-  size_t old_nrows = static_cast<size_t>(nrows);
   size_t old_alloc_size = alloc_size();
   size_t new_alloc_size = sizeof(T) * static_cast<size_t>(new_nrows);
-  mbuf.resize(new_alloc_size);
-  nrows = new_nrows;
 
-  // Copy the data
-  char* resptr = static_cast<char*>(mbuf.wptr());
-  char* resptr0 = resptr;
+  // Fast path: if the buffer has spare capacity (see `Column::reserve_rows`)
+  // and we own it exclusively, append the new data in-place. The resize
+  // below stays within the reserved allocation and therefore neither
+  // reallocates nor copies the existing rows.
+  if (!col_empty && new_alloc_size <= mbuf.capacity() && mbuf.is_writable()) {
+    mbuf.resize(new_alloc_size);
+    char* resptr = static_cast<char*>(mbuf.wptr()) + old_alloc_size;
+    size_t rows_to_fill = 0;
+    for (const Column* col : columns) {
+      if (col->stype() == SType::VOID) {
+        rows_to_fill += static_cast<size_t>(col->nrows);
+      } else {
+        if (rows_to_fill) {
+          set_value(resptr, static_cast<const void*>(&na),
+                    sizeof(T), rows_to_fill);
+          resptr += rows_to_fill * sizeof(T);
+          rows_to_fill = 0;
+        }
+        if (col->stype() != stype()) {
+          Column* newcol = col->cast(stype());
+          delete col;
+          col = newcol;
+        }
+        std::memcpy(resptr, col->data(), col->alloc_size());
+        resptr += col->alloc_size();
+      }
+      delete col;
+    }
+    if (rows_to_fill) {
+      set_value(resptr, static_cast<const void*>(&na),
+                sizeof(T), rows_to_fill);
+    }
+    nrows = new_nrows;
+    return;
+  }
+
+  // Instead of copying the data immediately, assemble the result as a plan
+  // of pieces: refcounted references to the constituent columns' buffers,
+  // interspersed with runs of NAs. Appending many frames is then
+  // O(metadata) per column; the actual concatenation runs once, when the
+  // result buffer is first touched. Copy-on-write semantics of MemoryRange
+  // keep the referenced pieces intact even if a source column is modified
+  // in the meantime.
+  struct Piece {
+    MemoryRange buf;     // an empty buffer denotes a run of NAs
+    size_t nbytes;
+  };
+  auto pieces = std::make_shared<std::vector<Piece>>();
+
   size_t rows_to_fill = 0;
   if (col_empty) {
-    rows_to_fill = old_nrows;
+    rows_to_fill = static_cast<size_t>(nrows);
   } else {
-    resptr += old_alloc_size;
+    pieces->push_back(Piece { mbuf, old_alloc_size });
   }
   for (const Column* col : columns) {
     if (col->stype() == SType::VOID) {
       rows_to_fill += static_cast<size_t>(col->nrows);
     } else {
       if (rows_to_fill) {
-        set_value(resptr, naptr, sizeof(T), rows_to_fill);
-        resptr += rows_to_fill * sizeof(T);
+        pieces->push_back(Piece { MemoryRange(), rows_to_fill * sizeof(T) });
         rows_to_fill = 0;
       }
       if (col->stype() != stype()) {
@@ -247,17 +483,28 @@ void FwColumn<T>::rbind_impl(std::vector<const Column*>& columns,
         delete col;
         col = newcol;
       }
-      std::memcpy(resptr, col->data(), col->alloc_size());
-      resptr += col->alloc_size();
+      pieces->push_back(Piece { col->data_buf(), col->alloc_size() });
     }
     delete col;
   }
   if (rows_to_fill) {
-    set_value(resptr, naptr, sizeof(T), rows_to_fill);
-    resptr += rows_to_fill * sizeof(T);
+    pieces->push_back(Piece { MemoryRange(), rows_to_fill * sizeof(T) });
   }
-  xassert(resptr == resptr0 + new_alloc_size);
-  (void)resptr0;
+
+  mbuf = MemoryRange::computed(new_alloc_size,
+    [pieces, na](void* dest) {
+      char* resptr = static_cast<char*>(dest);
+      for (const Piece& p : *pieces) {
+        if (p.buf) {
+          std::memcpy(resptr, p.buf.rptr(), p.nbytes);
+        } else {
+          set_value(resptr, static_cast<const void*>(&na),
+                    sizeof(T), p.nbytes / sizeof(T));
+        }
+        resptr += p.nbytes;
+      }
+    });
+  nrows = new_nrows;
 }
 
 
@@ -277,6 +524,7 @@ void FwColumn<T>::apply_na_mask(const BoolColumn* mask) {
     if (maskdata[j] == 1) coldata[j] = na;
   }
   if (stats != nullptr) stats->reset();
+  this->reset_sortedness();
 }
 
 
@@ -316,6 +564,135 @@ void FwColumn<T>::replace_values(
         ++data_src;
       });
   }
+  if (stats != nullptr) stats->reset();
+  this->reset_sortedness();
+}
+
+
+// Helper for `replace_values_batch`: for integer columns whose match values
+// span a small domain, the rules are compiled into a dense lookup table, so
+// the replacement pass costs one bounds check and one load per row. Returns
+// false when the domain is too wide (the caller then falls back to a hash
+// map). Overload resolution on the `std::is_integral` tag keeps this variant
+// from being instantiated for floating-point element types.
+template <typename T>
+static bool replace_via_table(std::true_type, T* data, int64_t nrows,
+                              const std::vector<T>& vals,
+                              const std::vector<T>& reps,
+                              bool has_na_rule, T na_repl)
+{
+  static const int64_t MAX_TABLE_SPAN = 65536;
+  int64_t vmin = static_cast<int64_t>(vals[0]);
+  int64_t vmax = vmin;
+  for (T v : vals) {
+    int64_t x = static_cast<int64_t>(v);
+    if (x < vmin) vmin = x;
+    if (x > vmax) vmax = x;
+  }
+  int64_t span = vmax - vmin + 1;
+  if (span > MAX_TABLE_SPAN) return false;
+  std::vector<T> table(static_cast<size_t>(span));
+  std::vector<int8_t> filled(static_cast<size_t>(span), 0);
+  for (size_t k = 0; k < vals.size(); ++k) {
+    size_t t = static_cast<size_t>(static_cast<int64_t>(vals[k]) - vmin);
+    table[t] = reps[k];
+    filled[t] = 1;
+  }
+  const T* tbl = table.data();
+  const int8_t* fil = filled.data();
+  constexpr T na = GETNA<T>();
+  #pragma omp parallel for schedule(static)
+  for (int64_t i = 0; i < nrows; ++i) {
+    T x = data[i];
+    if (x == na) {
+      if (has_na_rule) data[i] = na_repl;
+      continue;
+    }
+    int64_t t = static_cast<int64_t>(x) - vmin;
+    if (t >= 0 && t < span && fil[t]) data[i] = tbl[t];
+  }
+  return true;
+}
+
+template <typename T>
+static bool replace_via_table(std::false_type, T*, int64_t,
+                              const std::vector<T>&, const std::vector<T>&,
+                              bool, T)
+{
+  return false;
+}
+
+
+template <typename T>
+void FwColumn<T>::replace_values_batch(
+    const Column* matches, const Column* repls)
+{
+  xassert(matches->nrows == repls->nrows);
+  Column* mtmp = nullptr;
+  Column* rtmp = nullptr;
+  if (matches->stype() != stype()) matches = mtmp = matches->cast(stype());
+  if (repls->stype() != stype())   repls = rtmp = repls->cast(stype());
+
+  // Split the NA-match rule off from the rest: NA floats do not compare
+  // equal to themselves, and the integer NA sentinel would blow the lookup
+  // table's domain wide open.
+  const T* mdata = static_cast<const T*>(matches->data());
+  const T* rdata = static_cast<const T*>(repls->data());
+  std::vector<T> vals, reps;
+  vals.reserve(static_cast<size_t>(matches->nrows));
+  reps.reserve(static_cast<size_t>(matches->nrows));
+  bool has_na_rule = false;
+  T na_repl = na_elem;
+  for (int64_t k = 0; k < matches->nrows; ++k) {
+    if (ISNA<T>(mdata[k])) {
+      has_na_rule = true;
+      na_repl = rdata[k];
+    } else {
+      vals.push_back(mdata[k]);
+      reps.push_back(rdata[k]);
+    }
+  }
+  delete mtmp;
+  delete rtmp;
+
+  // Every pass checks NA first and the rules second, so all rules apply
+  // against the original values: a replacement that produces an NA (or a
+  // value matched by another rule) is never replaced again.
+  T* data = elements_w();
+  if (!vals.empty()) {
+    bool done = replace_via_table<T>(std::is_integral<T>(), data, nrows,
+                                     vals, reps, has_na_rule, na_repl);
+    if (!done) {
+      std::unordered_map<T, T> rules;
+      for (size_t k = 0; k < vals.size(); ++k) rules[vals[k]] = reps[k];
+      #pragma omp parallel for schedule(static)
+      for (int64_t i = 0; i < nrows; ++i) {
+        T x = data[i];
+        if (ISNA<T>(x)) {
+          if (has_na_rule) data[i] = na_repl;
+          continue;
+        }
+        auto it = rules.find(x);
+        if (it != rules.end()) data[i] = it->second;
+      }
+    }
+  } else if (has_na_rule) {
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < nrows; ++i) {
+      if (ISNA<T>(data[i])) data[i] = na_repl;
+    }
+  }
+  if (stats != nullptr) stats->reset();
+  this->reset_sortedness();
+}
+
+
+template <>
+void FwColumn<PyObject*>::replace_values_batch(const Column*, const Column*) {
+  // The generic implementation would compare Python objects by identity,
+  // which is not what a value remap means.
+  throw NotImplError() << "Bulk value replacement is not supported for "
+      "columns of stype " << stype();
 }
 
 
@@ -356,6 +733,367 @@ RowIndex FwColumn<T>::join(const Column* keycol) const {
 }
 
 
+template <typename T>
+static inline uint64_t fwhash(T value) {
+  uint64_t h = 0;
+  std::memcpy(&h, &value, sizeof(T));
+  return h * 0x9E3779B97F4A7C15ULL;  // Fibonacci hashing
+}
+
+// When the key column has more entries than this, a single hash table no
+// longer fits into the L2 cache and `hash_join()` switches to the radix-
+// partitioned mode below.
+static constexpr size_t HASHJOIN_PARTITION_NKEYS = 1 << 15;
+
+
+/**
+ * Build the open-addressing table used by `hash_join()` / `semi_join()`:
+ * power-of-two sized so that it stays at most half-full, linear probing.
+ * Each slot holds the index of a key row, or -1 when empty. Key values are
+ * expected to be unique; if they are not, the first occurrence wins.
+ * Returns the right-shift to apply to a hash to obtain its slot.
+ */
+template <typename T>
+static int build_fw_hash_table(const T* key_data, size_t key_n,
+                               std::vector<int32_t>& table)
+{
+  size_t tsize = 8;
+  int tshift = 61;
+  while (tsize < 2 * key_n) { tsize <<= 1; tshift--; }
+  size_t tmask = tsize - 1;
+  table.assign(tsize, -1);
+  for (size_t i = 0; i < key_n; ++i) {
+    size_t t = fwhash<T>(key_data[i]) >> tshift;
+    while (table[t] != -1) {
+      if (key_data[table[t]] == key_data[i]) break;
+      t = (t + 1) & tmask;
+    }
+    if (table[t] == -1) table[t] = static_cast<int32_t>(i);
+  }
+  return tshift;
+}
+
+
+/**
+ * Radix-partitioned hash join, for the case when both sides are too large
+ * for a single cache-resident hash table. Both columns are co-partitioned
+ * by the top bits of the hash into roughly L2-sized buckets (chunked
+ * histogram + scatter, same scheme as the radix sort in "sort.cc"), and
+ * then each bucket pair is hash-joined independently in parallel. Writes
+ * the index of the matching key row (or NA) for each probe row `i` into
+ * `trg_indices[i]`.
+ */
+template <typename T>
+static void radix_hash_join(const T* key_data, size_t key_n,
+                            const T* src_data, const RowIndex& ri,
+                            int64_t nrows, int32_t* trg_indices)
+{
+  constexpr int32_t EMPTY = -1;
+  size_t zn = static_cast<size_t>(nrows);
+
+  // Aim for partitions of ~16K keys, so that a half-full table of int32
+  // slots stays within 256KB of L2.
+  int nbits = 1;
+  while ((key_n >> nbits) > HASHJOIN_PARTITION_NKEYS / 2 && nbits < 12) {
+    nbits++;
+  }
+  size_t nparts = size_t(1) << nbits;
+  int hshift = 64 - nbits;
+
+  // Partition the key side: count, scan, scatter key row indices.
+  arr32_t key_part_idx(key_n);
+  std::vector<size_t> key_offs(nparts + 1, 0);
+  for (size_t i = 0; i < key_n; ++i) {
+    key_offs[(fwhash<T>(key_data[i]) >> hshift) + 1]++;
+  }
+  for (size_t p = 0; p < nparts; ++p) {
+    key_offs[p + 1] += key_offs[p];
+  }
+  {
+    std::vector<size_t> cursor(key_offs.begin(), key_offs.end() - 1);
+    for (size_t i = 0; i < key_n; ++i) {
+      size_t p = fwhash<T>(key_data[i]) >> hshift;
+      key_part_idx[cursor[p]++] = static_cast<int32_t>(i);
+    }
+  }
+
+  // Partition the probe side in parallel: per-chunk histograms, exclusive
+  // scan in column-major order, then scatter (value, original position)
+  // pairs. Both passes decompose the rows into the same chunks.
+  size_t nchunks = static_cast<size_t>(omp_get_max_threads());
+  size_t chunklen = (zn + nchunks - 1) / nchunks;
+  std::vector<size_t> hist(nchunks * nparts, 0);
+  #pragma omp parallel for schedule(static, 1)
+  for (size_t k = 0; k < nchunks; ++k) {
+    size_t* h = hist.data() + k * nparts;
+    int64_t i0 = static_cast<int64_t>(k * chunklen);
+    int64_t i1 = std::min(i0 + static_cast<int64_t>(chunklen), nrows);
+    ri.strided_loop2(i0, i1, 1,
+      [&](int64_t, int64_t j) {
+        h[fwhash<T>(src_data[j]) >> hshift]++;
+      });
+  }
+  size_t cum = 0;
+  for (size_t p = 0; p < nparts; ++p) {
+    for (size_t k = 0; k < nchunks; ++k) {
+      size_t t = hist[k * nparts + p];
+      hist[k * nparts + p] = cum;
+      cum += t;
+    }
+  }
+  xassert(cum == zn);
+  // Chunk 0's cursors are the partition start offsets; stash them before
+  // the scatter advances the cursors.
+  std::vector<size_t> probe_offs(nparts + 1);
+  for (size_t p = 0; p < nparts; ++p) probe_offs[p] = hist[p];
+  probe_offs[nparts] = zn;
+
+  dt::array<T> pvals(zn);
+  arr32_t ppos(zn);
+  #pragma omp parallel for schedule(static, 1)
+  for (size_t k = 0; k < nchunks; ++k) {
+    size_t* h = hist.data() + k * nparts;
+    int64_t i0 = static_cast<int64_t>(k * chunklen);
+    int64_t i1 = std::min(i0 + static_cast<int64_t>(chunklen), nrows);
+    ri.strided_loop2(i0, i1, 1,
+      [&](int64_t i, int64_t j) {
+        T value = src_data[j];
+        size_t d = h[fwhash<T>(value) >> hshift]++;
+        pvals[d] = value;
+        ppos[d] = static_cast<int32_t>(i);
+      });
+  }
+
+  // Join each bucket pair independently. Within a partition all hashes
+  // share their top `nbits`, so the per-partition tables are indexed by
+  // the bits below those.
+  #pragma omp parallel for schedule(dynamic)
+  for (size_t p = 0; p < nparts; ++p) {
+    size_t z0 = probe_offs[p];
+    size_t z1 = probe_offs[p + 1];
+    if (z0 == z1) continue;
+    size_t k0 = key_offs[p];
+    size_t k1 = key_offs[p + 1];
+    size_t tsize = 8;
+    int tshift = 61;
+    while (tsize < 2 * (k1 - k0)) { tsize <<= 1; tshift--; }
+    size_t tmask = tsize - 1;
+    std::vector<int32_t> table(tsize, EMPTY);
+    for (size_t s = k0; s < k1; ++s) {
+      int32_t ki = key_part_idx[s];
+      size_t t = (fwhash<T>(key_data[ki]) << nbits) >> tshift;
+      while (table[t] != EMPTY) t = (t + 1) & tmask;
+      table[t] = ki;
+    }
+    for (size_t s = z0; s < z1; ++s) {
+      T value = pvals[s];
+      size_t t = (fwhash<T>(value) << nbits) >> tshift;
+      int32_t res = GETNA<int32_t>();
+      while (table[t] != EMPTY) {
+        if (key_data[table[t]] == value) {
+          res = table[t];
+          break;
+        }
+        t = (t + 1) & tmask;
+      }
+      trg_indices[ppos[s]] = res;
+    }
+  }
+}
+
+
+template <typename T>
+RowIndex FwColumn<T>::hash_join(const Column* keycol) const {
+  xassert(stype() == keycol->stype());
+
+  auto kcol = static_cast<const FwColumn<T>*>(keycol);
+  xassert(!kcol->ri);
+  const T* key_data = kcol->elements_r();
+  size_t key_n = static_cast<size_t>(keycol->nrows);
+
+  if (key_n > HASHJOIN_PARTITION_NKEYS) {
+    arr32_t part_indices(static_cast<size_t>(nrows));
+    radix_hash_join<T>(key_data, key_n, elements_r(), ri, nrows,
+                       part_indices.data());
+    return RowIndex::from_array32(std::move(part_indices));
+  }
+
+  constexpr int32_t EMPTY = -1;
+  std::vector<int32_t> table;
+  int tshift = build_fw_hash_table<T>(key_data, key_n, table);
+  const int32_t* tdata = table.data();
+  size_t tmask = table.size() - 1;
+
+  // Probe the table in parallel chunks. Unlike `join()`, the probes do not
+  // depend on `keycol` being sorted.
+  arr32_t target_indices(static_cast<size_t>(nrows));
+  int32_t* trg_indices = target_indices.data();
+  const T* src_data = elements_r();
+
+  #pragma omp parallel
+  {
+    int ith = omp_get_thread_num();
+    int nths = omp_get_num_threads();
+    int64_t chunklen = (nrows + nths - 1) / nths;
+    int64_t i0 = ith * chunklen;
+    int64_t i1 = std::min(i0 + chunklen, nrows);
+    ri.strided_loop2(i0, i1, 1,
+      [&](int64_t i, int64_t j) {
+        T value = src_data[j];
+        size_t t = fwhash<T>(value) >> tshift;
+        int32_t res = GETNA<int32_t>();
+        while (tdata[t] != EMPTY) {
+          if (key_data[tdata[t]] == value) {
+            res = tdata[t];
+            break;
+          }
+          t = (t + 1) & tmask;
+        }
+        trg_indices[i] = res;
+      });
+  }
+
+  return RowIndex::from_array32(std::move(target_indices));
+}
+
+
+/**
+ * Try to compile the key set into a bitset indexed by `value - kmin`.
+ * Possible only for integer keys that span a small range: the bitset is
+ * capped at 2^22 bits (512 KB), which bounds its memory and keeps the
+ * probe side cache-resident. Returns false when the keys are floating-
+ * point or too spread out (including a key set containing the NA
+ * sentinel of a wide integer type, which sits at the far end of the
+ * value range), in which case the hash table handles them.
+ */
+template <typename T>
+static typename std::enable_if<std::is_integral<T>::value, bool>::type
+build_fw_key_bitset(const T* key_data, size_t key_n,
+                    std::vector<uint64_t>& bits, T* out_min,
+                    uint64_t* out_range)
+{
+  if (key_n == 0) return false;
+  T kmin = key_data[0];
+  T kmax = key_data[0];
+  for (size_t i = 1; i < key_n; ++i) {
+    T v = key_data[i];
+    if (v < kmin) kmin = v;
+    if (v > kmax) kmax = v;
+  }
+  uint64_t range = static_cast<uint64_t>(kmax) - static_cast<uint64_t>(kmin);
+  if (range >= (1 << 22)) return false;
+  bits.assign(static_cast<size_t>(range >> 6) + 1, 0);
+  for (size_t i = 0; i < key_n; ++i) {
+    uint64_t d = static_cast<uint64_t>(key_data[i]) -
+                 static_cast<uint64_t>(kmin);
+    bits[static_cast<size_t>(d >> 6)] |= uint64_t(1) << (d & 63);
+  }
+  *out_min = kmin;
+  *out_range = range;
+  return true;
+}
+
+template <typename T>
+static typename std::enable_if<!std::is_integral<T>::value, bool>::type
+build_fw_key_bitset(const T*, size_t, std::vector<uint64_t>&, T*, uint64_t*) {
+  return false;
+}
+
+template <typename T>
+static inline typename std::enable_if<std::is_integral<T>::value, bool>::type
+fw_bitset_contains(T value, T kmin, uint64_t range, const uint64_t* bits) {
+  uint64_t d = static_cast<uint64_t>(value) - static_cast<uint64_t>(kmin);
+  return (d <= range) && ((bits[static_cast<size_t>(d >> 6)] >> (d & 63)) & 1);
+}
+
+template <typename T>
+static inline typename std::enable_if<!std::is_integral<T>::value, bool>::type
+fw_bitset_contains(T, T, uint64_t, const uint64_t*) {
+  return false;
+}
+
+
+template <typename T>
+RowIndex FwColumn<T>::semi_join(const Column* keycol, bool invert) const {
+  xassert(stype() == keycol->stype());
+
+  auto kcol = static_cast<const FwColumn<T>*>(keycol);
+  xassert(!kcol->ri);
+  const T* key_data = kcol->elements_r();
+  size_t key_n = static_cast<size_t>(keycol->nrows);
+
+  // Compile the key set once, into the cheapest representation that fits:
+  // a bitset when the keys are integers within a small range (membership
+  // is then a single indexed load per row), an open-addressing hash table
+  // otherwise.
+  std::vector<uint64_t> bits;
+  T kmin = 0;
+  uint64_t krange = 0;
+  bool use_bitset = build_fw_key_bitset<T>(key_data, key_n, bits,
+                                           &kmin, &krange);
+  constexpr int32_t EMPTY = -1;
+  std::vector<int32_t> table;
+  int tshift = 0;
+  if (!use_bitset) {
+    tshift = build_fw_hash_table<T>(key_data, key_n, table);
+  }
+  const uint64_t* bdata = bits.data();
+  const int32_t* tdata = table.data();
+  size_t tmask = table.empty()? 0 : table.size() - 1;
+
+  // Probe-only pass: each chunk writes its surviving row numbers into its
+  // own slice of the output array, then the slices are compacted. Nothing
+  // else is materialized.
+  arr32_t matches(static_cast<size_t>(nrows));
+  int32_t* mdata = matches.data();
+  const T* src_data = elements_r();
+  size_t nchunks = static_cast<size_t>(omp_get_max_threads());
+  int64_t chunklen = (nrows + static_cast<int64_t>(nchunks) - 1)
+                     / static_cast<int64_t>(nchunks);
+  std::vector<int64_t> counts(nchunks, 0);
+  #pragma omp parallel for schedule(static, 1)
+  for (size_t k = 0; k < nchunks; ++k) {
+    int64_t i0 = static_cast<int64_t>(k) * chunklen;
+    int64_t i1 = std::min(i0 + chunklen, nrows);
+    int64_t w = i0;
+    if (use_bitset) {
+      ri.strided_loop2(i0, i1, 1,
+        [&](int64_t i, int64_t j) {
+          bool found = fw_bitset_contains<T>(src_data[j], kmin, krange, bdata);
+          if (found != invert) mdata[w++] = static_cast<int32_t>(i);
+        });
+    } else {
+      ri.strided_loop2(i0, i1, 1,
+        [&](int64_t i, int64_t j) {
+          T value = src_data[j];
+          size_t t = fwhash<T>(value) >> tshift;
+          bool found = false;
+          while (tdata[t] != EMPTY) {
+            if (key_data[tdata[t]] == value) {
+              found = true;
+              break;
+            }
+            t = (t + 1) & tmask;
+          }
+          if (found != invert) mdata[w++] = static_cast<int32_t>(i);
+        });
+    }
+    counts[k] = w - i0;
+  }
+  int64_t total = 0;
+  for (size_t k = 0; k < nchunks; ++k) {
+    int64_t i0 = static_cast<int64_t>(k) * chunklen;
+    if (total != i0 && counts[k]) {
+      std::memmove(mdata + total, mdata + i0,
+                   static_cast<size_t>(counts[k]) * sizeof(int32_t));
+    }
+    total += counts[k];
+  }
+  matches.resize(static_cast<size_t>(total));
+  return RowIndex::from_array32(std::move(matches), /* sorted = */ true);
+}
+
+
 
 // Explicit instantiations
 template class FwColumn<int8_t>;
@@ -29,7 +29,10 @@ SType IntColumn<T>::stype() const {
 
 template <typename T>
 IntegerStats<T>* IntColumn<T>::get_stats() const {
-  if (stats == nullptr) stats = new IntegerStats<T>();
+  if (stats == nullptr) {
+    std::lock_guard<std::mutex> lock(Column::stats_alloc_mutex);
+    if (stats == nullptr) stats = new IntegerStats<T>();
+  }
   return static_cast<IntegerStats<T>*>(stats);
 }
 
@@ -131,10 +134,15 @@ typedef std::unique_ptr<MemoryWritableBuffer> MWBPtr;
 
 template<typename IT, typename OT>
 inline static void cast_helper(int64_t nrows, const IT* src, OT* trg) {
-  #pragma omp parallel for schedule(static)
+  // The conversion is computed unconditionally and the NA sentinel blended
+  // in with a select, so the loop body is branchless and the compiler can
+  // emit SIMD widening/narrowing converts instead of a per-element branch.
+  constexpr IT na_src = GETNA<IT>();
+  #pragma omp parallel for simd schedule(static)
   for (int64_t i = 0; i < nrows; ++i) {
     IT x = src[i];
-    trg[i] = ISNA<IT>(x)? GETNA<OT>() : static_cast<OT>(x);
+    OT v = static_cast<OT>(x);
+    trg[i] = (x == na_src)? GETNA<OT>() : v;
   }
 }
 
@@ -177,7 +185,7 @@ void IntColumn<T>::cast_into(BoolColumn* target) const {
   constexpr int8_t na_trg = GETNA<int8_t>();
   const T* src_data = this->elements_r();
   int8_t* trg_data = target->elements_w();
-  #pragma omp parallel for schedule(static)
+  #pragma omp parallel for simd schedule(static)
   for (int64_t i = 0; i < this->nrows; ++i) {
     T x = src_data[i];
     trg_data[i] = x == na_src? na_trg : (x != 0);
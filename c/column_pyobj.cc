@@ -75,12 +75,13 @@ void PyObjectColumn::resize_and_fill(int64_t new_nrows) {
 
   // TODO(#301): Temporary fix.
   if (this->stats != nullptr) this->stats->reset();
+  this->reset_sortedness();
 }
 
 
-void PyObjectColumn::reify() {
+void PyObjectColumn::reify_impl() {
   if (ri.isabsent()) return;
-  FwColumn<PyObject*>::reify();
+  FwColumn<PyObject*>::reify_impl();
 
   // ???
   // After regular reification, we need to increment ref-counts for each
@@ -152,6 +153,9 @@ void PyObjectColumn::cast_into(PyObjectColumn* target) const {
 //----- Stats ------------------------------------------------------------------
 
 PyObjectStats* PyObjectColumn::get_stats() const {
-  if (stats == nullptr) stats = new PyObjectStats();
+  if (stats == nullptr) {
+    std::lock_guard<std::mutex> lock(Column::stats_alloc_mutex);
+    if (stats == nullptr) stats = new PyObjectStats();
+  }
   return static_cast<PyObjectStats*>(stats);
 }
@@ -6,12 +6,17 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include "column.h"
-#include <cmath>  // abs
-#include <limits> // numeric_limits::max()
+#include <algorithm>  // min
+#include <cmath>      // abs
+#include <cstring>    // memcmp, memset
+#include <limits>     // numeric_limits::max()
+#include <vector>
+#include "options.h"
 #include "py_utils.h"
 #include "utils.h"
 #include "encodings.h"
 #include "utils/assert.h"
+#include "utils/omp.h"
 
 // Returns the expected path of the string data file given
 // the path to the offsets
@@ -151,6 +156,7 @@ void StringColumn<T>::replace_buffer(MemoryRange&& new_offbuf,
   strbuf = std::move(new_strbuf);
   mbuf = std::move(new_offbuf);
   nrows = new_nrows;
+  reset_sortedness();
 }
 
 
@@ -172,6 +178,28 @@ bool StringColumn<T>::is_fixedwidth() const {
 }
 
 
+template <typename T>
+void StringColumn<T>::memory_advise(MmmAdvice a) const {
+  mbuf.advise(a);
+  strbuf.advise(a);
+}
+
+template <typename T>
+void StringColumn<T>::reserve_rows(int64_t n) {
+  if (n <= nrows) return;
+  // Only the offsets buffer has a size knowable in advance; the string data
+  // buffer grows by however many bytes the appended strings bring.
+  mbuf.reserve((static_cast<size_t>(n) + 1) * sizeof(T));
+}
+
+
+template <typename T>
+void StringColumn<T>::cow_counters(size_t* ncopies, size_t* nbytes) const {
+  Column::cow_counters(ncopies, nbytes);
+  *ncopies += strbuf.cow_count();
+  *nbytes += strbuf.cow_bytes();
+}
+
 template <typename T>
 size_t StringColumn<T>::datasize() const{
   size_t sz = mbuf.size();
@@ -207,12 +235,23 @@ T* StringColumn<T>::offsets_w() {
 
 
 template <typename T>
-void StringColumn<T>::reify() {
+void StringColumn<T>::adopt_buffer_of(Column* donor) {
+  Column::adopt_buffer_of(donor);
+  strbuf = std::move(static_cast<StringColumn<T>*>(donor)->strbuf);
+}
+
+
+template <typename T>
+void StringColumn<T>::reify_impl() {
   // If our rowindex is null, then we're already done
   if (ri.isabsent()) return;
+  dt::cow::Operation cowop("reify");
   bool simple_slice = ri.isslice() && ri.slice_step() == 1;
   bool ascending    = ri.isslice() && ri.slice_step() > 0;
 
+  // An array rowindex gathers rows in arbitrary order: disable read-ahead
+  if (ri.isarray()) memory_advise(MmmAdvice::Random);
+
   size_t new_mbuf_size = (ri.zlength() + 1) * sizeof(T);
   size_t new_strbuf_size = 0;
   MemoryRange new_strbuf = strbuf;
@@ -282,9 +321,10 @@ void StringColumn<T>::reify() {
     const char* strs_src = strdata();
     char* strs_dest = static_cast<char*>(new_strbuf.wptr());
     T prev_off = 0;
+    bool may_have_nas = (ri.min() < 0);  // exact bounds => no NA index test
     ri.strided_loop(0, nrows, 1,
       [&](int64_t i) {
-        if (ISNA(i) || ISNA<T>(offs1[i])) {
+        if ((may_have_nas && ISNA(i)) || ISNA<T>(offs1[i])) {
           *offs_dest++ = prev_off | GETNA<T>();
         } else {
           T off0 = offs0[i] & ~GETNA<T>();
@@ -306,11 +346,182 @@ void StringColumn<T>::reify() {
 }
 
 
+// str32 columns are already as compact as string columns get.
+template <typename T>
+Column* StringColumn<T>::compact() {
+  return this;
+}
+
+
+/**
+ * Demote a str64 column back to str32 when its string data fits within
+ * 32-bit offsets: whether it does is read off the final offset in O(1).
+ * Only the offsets are rewritten (narrowed in parallel); the string data
+ * buffer is shared with the original column. View columns are left alone,
+ * since their strdata extent is not described by the final offset.
+ */
+template <>
+Column* StringColumn<uint64_t>::compact() {
+  if (!ri.isabsent() || nrows == 0) return this;
+  const uint64_t* offs = offsets();
+  uint64_t total = offs[nrows - 1] & ~GETNA<uint64_t>();
+  if (total >= static_cast<uint64_t>(GETNA<uint32_t>())) return this;
+  if (strbuf.size() != total) return this;  // e.g. pre-reserved for rbind
+
+  size_t zrows = static_cast<size_t>(nrows);
+  MemoryRange offbuf = MemoryRange::mem((zrows + 1) * sizeof(uint32_t));
+  uint32_t* out = static_cast<uint32_t*>(offbuf.wptr());
+  out[0] = 0;
+  #pragma omp parallel for schedule(static)
+  for (int64_t i = 0; i < nrows; ++i) {
+    uint64_t o = offs[i];
+    out[i + 1] = static_cast<uint32_t>(o & ~GETNA<uint64_t>()) |
+                 (ISNA<uint64_t>(o)? GETNA<uint32_t>() : 0);
+  }
+
+  MemoryRange sbuf = strbuf;  // shared, not copied
+  return Column::new_mbuf_column(SType::STR32, std::move(offbuf),
+                                 std::move(sbuf));
+}
+
+
+/**
+ * The string data is stored as one contiguous buffer with cumulative
+ * offsets, so a point-update cannot simply overwrite an entry. Instead we
+ * handle two cases:
+ *   - if every replacement string has exactly the same length as the string
+ *     it replaces, the bytes are patched in-place and the offsets are left
+ *     untouched, making the update proportional to the change only;
+ *   - otherwise the column is rebuilt in a single pass, where the runs of
+ *     untouched strings between replacement points are moved with bulk
+ *     memcpy's (chunk-at-a-time) rather than row-by-row.
+ */
 template <typename T>
 void StringColumn<T>::replace_values(
-    RowIndex /*replace_at*/, const Column* /*replace_with*/)
+    RowIndex replace_at, const Column* replace_with)
 {
-  // TODO
+  if (replace_with->stype() != stype()) {
+    replace_with = replace_with->cast(stype());
+  }
+  auto repl = static_cast<const StringColumn<T>*>(replace_with);
+  int64_t replace_n = replace_at.length();
+  if (replace_n == 0) return;
+  bool repeat_value = (replace_with->nrows == 1);
+  if (!repeat_value) xassert(replace_with->nrows == replace_n);
+
+  // Collect the target rows together with the index of the replacement
+  // string for each, then order them by target row: the rebuild pass below
+  // must walk the column front-to-back.
+  std::vector<std::pair<int64_t, int64_t>> repls;
+  repls.reserve(static_cast<size_t>(replace_n));
+  int64_t k = 0;
+  replace_at.strided_loop(0, replace_n, 1,
+    [&](int64_t i) {
+      repls.push_back(std::make_pair(i, repeat_value? 0 : k));
+      ++k;
+    });
+  std::sort(repls.begin(), repls.end());
+
+  const T* offs1 = offsets();
+  const T* offs0 = offs1 - 1;
+  const T* repl_offs1 = repl->offsets();
+  const T* repl_offs0 = repl_offs1 - 1;
+  const char* repl_strs = repl->strdata();
+
+  // Check whether each replacement string has the same length (and NA-ness)
+  // as the string it replaces.
+  bool same_lengths = true;
+  int64_t size_delta = 0;
+  for (const auto& p : repls) {
+    int64_t i = p.first;
+    int64_t j = p.second;
+    bool old_na = ISNA<T>(offs1[i]);
+    bool new_na = ISNA<T>(repl_offs1[j]);
+    T old_len = old_na? 0 : offs1[i] - (offs0[i] & ~GETNA<T>());
+    T new_len = new_na? 0 : repl_offs1[j] - (repl_offs0[j] & ~GETNA<T>());
+    if (old_na != new_na || old_len != new_len) same_lengths = false;
+    size_delta += static_cast<int64_t>(new_len) - static_cast<int64_t>(old_len);
+  }
+
+  if (same_lengths) {
+    char* strs_dest = static_cast<char*>(strbuf.wptr());
+    for (const auto& p : repls) {
+      int64_t i = p.first;
+      int64_t j = p.second;
+      if (ISNA<T>(offs1[i])) continue;
+      T len = offs1[i] - (offs0[i] & ~GETNA<T>());
+      if (len) {
+        std::memcpy(strs_dest + (offs0[i] & ~GETNA<T>()),
+                    repl_strs + (repl_offs0[j] & ~GETNA<T>()),
+                    static_cast<size_t>(len));
+      }
+    }
+  } else {
+    size_t new_strbuf_size =
+        static_cast<size_t>(static_cast<int64_t>(strbuf.size()) + size_delta);
+    if (sizeof(T) == 4 && new_strbuf_size > INT32_MAX) {
+      throw ValueError() << "Replacement makes string data size " <<
+        new_strbuf_size << ", which is too big for a str32 column";
+    }
+    size_t new_mbuf_size = sizeof(T) * (static_cast<size_t>(nrows) + 1);
+    MemoryRange new_mbuf = MemoryRange::mem(new_mbuf_size);
+    MemoryRange new_strbuf = MemoryRange::mem(new_strbuf_size);
+    T* offs_dest = static_cast<T*>(new_mbuf.wptr()) + 1;
+    offs_dest[-1] = 0;
+    const char* strs_src = strdata();
+    char* strs_dest = static_cast<char*>(new_strbuf.wptr());
+    int64_t row0 = 0;     // first row of the current untouched run
+    T delta = 0;          // offset shift accumulated so far
+    T prev_off = 0;       // end offset of the last string written
+    for (const auto& p : repls) {
+      int64_t i = p.first;
+      int64_t j = p.second;
+      // Copy the run of rows [row0; i) unchanged, shifting their offsets
+      if (i > row0) {
+        T run_start = offs0[row0] & ~GETNA<T>();
+        T run_size = (offs0[i] & ~GETNA<T>()) - run_start;
+        if (run_size) {
+          std::memcpy(strs_dest + run_start + delta, strs_src + run_start,
+                      static_cast<size_t>(run_size));
+        }
+        for (int64_t r = row0; r < i; ++r) {
+          offs_dest[r] = offs1[r] + delta;
+        }
+        prev_off = (offs0[i] & ~GETNA<T>()) + delta;
+      }
+      // Write the replacement string
+      if (ISNA<T>(repl_offs1[j])) {
+        offs_dest[i] = prev_off | GETNA<T>();
+      } else {
+        T len = repl_offs1[j] - (repl_offs0[j] & ~GETNA<T>());
+        if (len) {
+          std::memcpy(strs_dest + prev_off,
+                      repl_strs + (repl_offs0[j] & ~GETNA<T>()),
+                      static_cast<size_t>(len));
+        }
+        prev_off += len;
+        offs_dest[i] = prev_off;
+      }
+      delta = prev_off - (offs1[i] & ~GETNA<T>());
+      row0 = i + 1;
+    }
+    // Copy the final run after the last replacement
+    if (row0 < nrows) {
+      T run_start = offs0[row0] & ~GETNA<T>();
+      T run_size = (offs1[nrows - 1] & ~GETNA<T>()) - run_start;
+      if (run_size) {
+        std::memcpy(strs_dest + run_start + delta, strs_src + run_start,
+                    static_cast<size_t>(run_size));
+      }
+      for (int64_t r = row0; r < nrows; ++r) {
+        offs_dest[r] = offs1[r] + delta;
+      }
+    }
+    mbuf = std::move(new_mbuf);
+    strbuf = std::move(new_strbuf);
+  }
+  if (stats != nullptr) stats->reset();
+  reset_sortedness();
 }
 
 
@@ -369,6 +580,7 @@ void StringColumn<T>::resize_and_fill(int64_t new_nrows)
   nrows = new_nrows;
   // TODO: Temporary fix. To be resolved in #301
   if (stats != nullptr) stats->reset();
+  reset_sortedness();
 }
 
 
@@ -470,6 +682,7 @@ void StringColumn<T>::apply_na_mask(const BoolColumn* mask) {
     offp = offa;
   }
   if (stats) stats->reset();
+  reset_sortedness();
 }
 
 template <typename T>
@@ -573,6 +786,407 @@ RowIndex StringColumn<T>::join(const Column* keycol) const {
 }
 
 
+// FNV-1a over the string's bytes.
+static inline uint64_t strhash(const uint8_t* strdata, size_t len) {
+  uint64_t h = 14695981039346656037ULL;
+  for (size_t i = 0; i < len; ++i) {
+    h = (h ^ strdata[i]) * 1099511628211ULL;
+  }
+  return h;
+}
+
+
+template <typename T>
+const uint64_t* StringColumn<T>::row_hashes() const {
+  if (rhash_mutid == mutid && rhash_buf) {
+    return static_cast<const uint64_t*>(rhash_buf.rptr());
+  }
+  int64_t n = data_nrows();
+  rhash_buf = MemoryRange::mem(static_cast<size_t>(n) * sizeof(uint64_t));
+  auto hashes = static_cast<uint64_t*>(rhash_buf.wptr());
+  const T* offs = offsets();
+  const uint8_t* strs = ustrdata();
+  config::thread_grant tgrant;
+  #pragma omp parallel for schedule(static) num_threads(tgrant.nthreads())
+  for (int64_t i = 0; i < n; ++i) {
+    T oend = offs[i];
+    if (ISNA<T>(oend)) {
+      hashes[i] = 0;
+      continue;
+    }
+    T ostart = offs[i - 1] & ~GETNA<T>();
+    hashes[i] = strhash(strs + ostart, static_cast<size_t>(oend - ostart));
+  }
+  rhash_mutid = mutid;
+  return hashes;
+}
+
+
+/**
+ * Build the open-addressing table used by `hash_join()` / `semi_join()`:
+ * power-of-two sized so that it stays at most half-full, linear probing.
+ * Each slot holds the index of a key row, or -1 when empty. NA strings are
+ * not inserted and thus never match; if the keys are not unique, the first
+ * occurrence wins. `key_hashes` are the keys' cached per-row hashes.
+ * Returns the right-shift to apply to a hash to obtain its slot.
+ */
+template <typename T>
+static int build_str_hash_table(const uint64_t* key_hashes,
+                                const T* key_offsets, size_t key_n,
+                                std::vector<int32_t>& table)
+{
+  size_t tsize = 8;
+  int tshift = 61;
+  while (tsize < 2 * key_n) { tsize <<= 1; tshift--; }
+  size_t tmask = tsize - 1;
+  table.assign(tsize, -1);
+  for (size_t i = 0; i < key_n; ++i) {
+    if (ISNA<T>(key_offsets[i])) continue;
+    size_t t = key_hashes[i] >> tshift;
+    while (table[t] != -1) t = (t + 1) & tmask;
+    table[t] = static_cast<int32_t>(i);
+  }
+  return tshift;
+}
+
+
+template <typename T>
+RowIndex StringColumn<T>::hash_join(const Column* keycol) const {
+  xassert(stype() == keycol->stype());
+
+  auto kcol = static_cast<const StringColumn<T>*>(keycol);
+  xassert(!kcol->ri);
+  const T* key_offsets = kcol->offsets();
+  const uint8_t* key_strdata = kcol->ustrdata();
+  size_t key_n = static_cast<size_t>(keycol->nrows);
+
+  constexpr int32_t EMPTY = -1;
+  std::vector<int32_t> table;
+  int tshift = build_str_hash_table<T>(kcol->row_hashes(), key_offsets,
+                                       key_n, table);
+  const int32_t* tdata = table.data();
+  size_t tmask = table.size() - 1;
+
+  // Probe the table in parallel chunks. Unlike `join()`, the probes do not
+  // depend on `keycol` being sorted.
+  arr32_t target_indices(static_cast<size_t>(nrows));
+  int32_t* trg_indices = target_indices.data();
+  const T* src_offsets = offsets();
+  const uint8_t* src_strdata = ustrdata();
+  const uint64_t* src_hashes = row_hashes();
+
+  #pragma omp parallel
+  {
+    int ith = omp_get_thread_num();
+    int nths = omp_get_num_threads();
+    int64_t chunklen = (nrows + nths - 1) / nths;
+    int64_t i0 = ith * chunklen;
+    int64_t i1 = std::min(i0 + chunklen, nrows);
+    ri.strided_loop2(i0, i1, 1,
+      [&](int64_t i, int64_t j) {
+        T oend = src_offsets[j];
+        if (ISNA<T>(oend)) {
+          trg_indices[i] = GETNA<int32_t>();
+          return;
+        }
+        T ostart = src_offsets[j - 1] & ~GETNA<T>();
+        size_t len = static_cast<size_t>(oend - ostart);
+        const uint8_t* str = src_strdata + ostart;
+        size_t t = src_hashes[j] >> tshift;
+        int32_t res = GETNA<int32_t>();
+        while (tdata[t] != EMPTY) {
+          int32_t ki = tdata[t];
+          T kend = key_offsets[ki];
+          T kstart = key_offsets[ki - 1] & ~GETNA<T>();
+          if (static_cast<size_t>(kend - kstart) == len &&
+              std::memcmp(key_strdata + kstart, str, len) == 0) {
+            res = ki;
+            break;
+          }
+          t = (t + 1) & tmask;
+        }
+        trg_indices[i] = res;
+      });
+  }
+
+  return RowIndex::from_array32(std::move(target_indices));
+}
+
+
+template <typename T>
+RowIndex StringColumn<T>::semi_join(const Column* keycol, bool invert) const {
+  xassert(stype() == keycol->stype());
+
+  auto kcol = static_cast<const StringColumn<T>*>(keycol);
+  xassert(!kcol->ri);
+  const T* key_offsets = kcol->offsets();
+  const uint8_t* key_strdata = kcol->ustrdata();
+  size_t key_n = static_cast<size_t>(keycol->nrows);
+
+  constexpr int32_t EMPTY = -1;
+  std::vector<int32_t> table;
+  int tshift = build_str_hash_table<T>(kcol->row_hashes(), key_offsets,
+                                       key_n, table);
+  const int32_t* tdata = table.data();
+  size_t tmask = table.size() - 1;
+
+  // Probe-only pass: each chunk writes its surviving row numbers into its
+  // own slice of the output array, then the slices are compacted. Nothing
+  // else is materialized. NA strings never match, so they survive only an
+  // anti-join.
+  arr32_t matches(static_cast<size_t>(nrows));
+  int32_t* mdata = matches.data();
+  const T* src_offsets = offsets();
+  const uint8_t* src_strdata = ustrdata();
+  const uint64_t* src_hashes = row_hashes();
+  size_t nchunks = static_cast<size_t>(omp_get_max_threads());
+  int64_t chunklen = (nrows + static_cast<int64_t>(nchunks) - 1)
+                     / static_cast<int64_t>(nchunks);
+  std::vector<int64_t> counts(nchunks, 0);
+  #pragma omp parallel for schedule(static, 1)
+  for (size_t k = 0; k < nchunks; ++k) {
+    int64_t i0 = static_cast<int64_t>(k) * chunklen;
+    int64_t i1 = std::min(i0 + chunklen, nrows);
+    int64_t w = i0;
+    ri.strided_loop2(i0, i1, 1,
+      [&](int64_t i, int64_t j) {
+        T oend = src_offsets[j];
+        bool found = false;
+        if (!ISNA<T>(oend)) {
+          T ostart = src_offsets[j - 1] & ~GETNA<T>();
+          size_t len = static_cast<size_t>(oend - ostart);
+          const uint8_t* str = src_strdata + ostart;
+          size_t t = src_hashes[j] >> tshift;
+          while (tdata[t] != EMPTY) {
+            int32_t ki = tdata[t];
+            T kend = key_offsets[ki];
+            T kstart = key_offsets[ki - 1] & ~GETNA<T>();
+            if (static_cast<size_t>(kend - kstart) == len &&
+                std::memcmp(key_strdata + kstart, str, len) == 0) {
+              found = true;
+              break;
+            }
+            t = (t + 1) & tmask;
+          }
+        }
+        if (found != invert) mdata[w++] = static_cast<int32_t>(i);
+      });
+    counts[k] = w - i0;
+  }
+  int64_t total = 0;
+  for (size_t k = 0; k < nchunks; ++k) {
+    int64_t i0 = static_cast<int64_t>(k) * chunklen;
+    if (total != i0 && counts[k]) {
+      std::memmove(mdata + total, mdata + i0,
+                   static_cast<size_t>(counts[k]) * sizeof(int32_t));
+    }
+    total += counts[k];
+  }
+  matches.resize(static_cast<size_t>(total));
+  return RowIndex::from_array32(std::move(matches), /* sorted = */ true);
+}
+
+
+// Shift-or (bitap) substring search: `cmasks[c]` has a zero bit at every
+// position where the pattern holds byte `c`. Feeding a text byte shifts the
+// state left and ORs its mask in, so the bit for "matched the first k bytes"
+// survives only while the text keeps agreeing with the pattern; the search
+// runs in two arithmetic ops per text byte with no inner comparison loop.
+// Patterns longer than 63 bytes fall back to a plain windowed memcmp.
+static bool bitap_contains(const uint8_t* str, size_t len,
+                           const uint8_t* pat, size_t plen,
+                           const uint64_t* cmasks)
+{
+  if (plen > len) return false;
+  if (plen > 63) {
+    for (size_t i = 0; i + plen <= len; ++i) {
+      if (std::memcmp(str + i, pat, plen) == 0) return true;
+    }
+    return false;
+  }
+  uint64_t hibit = 1ULL << (plen - 1);
+  uint64_t state = ~0ULL;
+  for (size_t i = 0; i < len; ++i) {
+    state = (state << 1) | cmasks[str[i]];
+    if (!(state & hibit)) return true;
+  }
+  return false;
+}
+
+
+template <typename T>
+RowIndex StringColumn<T>::str_match(int method, const uint8_t* pat,
+                                    size_t plen) const
+{
+  uint64_t cmasks[256];
+  if (method == 0 && plen > 0 && plen <= 63) {
+    for (size_t c = 0; c < 256; ++c) cmasks[c] = ~0ULL;
+    for (size_t k = 0; k < plen; ++k) cmasks[pat[k]] &= ~(1ULL << k);
+  }
+
+  // Chunked scan with per-chunk compaction, same as `semi_join()`.
+  arr32_t matches(static_cast<size_t>(nrows));
+  int32_t* mdata = matches.data();
+  const T* src_offsets = offsets();
+  const uint8_t* src_strdata = ustrdata();
+  size_t nchunks = static_cast<size_t>(omp_get_max_threads());
+  int64_t chunklen = (nrows + static_cast<int64_t>(nchunks) - 1)
+                     / static_cast<int64_t>(nchunks);
+  std::vector<int64_t> counts(nchunks, 0);
+  #pragma omp parallel for schedule(static, 1)
+  for (size_t k = 0; k < nchunks; ++k) {
+    int64_t i0 = static_cast<int64_t>(k) * chunklen;
+    int64_t i1 = std::min(i0 + chunklen, nrows);
+    int64_t w = i0;
+    ri.strided_loop2(i0, i1, 1,
+      [&](int64_t i, int64_t j) {
+        T oend = src_offsets[j];
+        if (ISNA<T>(oend)) return;
+        T ostart = src_offsets[j - 1] & ~GETNA<T>();
+        size_t len = static_cast<size_t>(oend - ostart);
+        const uint8_t* str = src_strdata + ostart;
+        bool found = false;
+        switch (method) {
+          case 0:
+            found = plen == 0 || bitap_contains(str, len, pat, plen, cmasks);
+            break;
+          case 1:
+            found = plen <= len && std::memcmp(str, pat, plen) == 0;
+            break;
+          case 2:
+            found = plen <= len &&
+                    std::memcmp(str + (len - plen), pat, plen) == 0;
+            break;
+        }
+        if (found) mdata[w++] = static_cast<int32_t>(i);
+      });
+    counts[k] = w - i0;
+  }
+  int64_t total = 0;
+  for (size_t k = 0; k < nchunks; ++k) {
+    int64_t i0 = static_cast<int64_t>(k) * chunklen;
+    if (total != i0 && counts[k]) {
+      std::memmove(mdata + total, mdata + i0,
+                   static_cast<size_t>(counts[k]) * sizeof(int32_t));
+    }
+    total += counts[k];
+  }
+  matches.resize(static_cast<size_t>(total));
+  return RowIndex::from_array32(std::move(matches), /* sorted = */ true);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Point-lookup hash index
+//------------------------------------------------------------------------------
+
+// One slot of the cached hash index: the full 64-bit hash plus the first row
+// holding it; the remaining rows with the same hash are chained through the
+// `hidx_next` array. Rows whose strings differ but hash equal share a chain
+// and are told apart by the string comparison at query time.
+struct HidxSlot {
+  uint64_t hash;
+  int32_t head;
+  int32_t : 32;
+};
+
+
+/**
+ * Build the point-lookup index: a power-of-two open-addressing table (at
+ * most half full, linear probing) of HidxSlot entries over all non-NA rows.
+ * The per-row hashes come from the shared `row_hashes()` cache; the
+ * insertion pass is a cheap serial loop that never reads the string data.
+ */
+template <typename T>
+void StringColumn<T>::build_hash_index() const {
+  size_t n = static_cast<size_t>(nrows);
+  size_t tsize = 8;
+  int tshift = 61;
+  while (tsize < 2 * n) { tsize <<= 1; tshift--; }
+  size_t tmask = tsize - 1;
+
+  const uint64_t* hashes = row_hashes();
+  const T* offs = offsets();
+  int64_t zn = nrows;
+
+  hidx_slots = MemoryRange::mem(tsize * sizeof(HidxSlot));
+  hidx_next = MemoryRange::mem(n * sizeof(int32_t));
+  auto slots = static_cast<HidxSlot*>(hidx_slots.wptr());
+  auto next = static_cast<int32_t*>(hidx_next.wptr());
+  std::memset(slots, 0xFF, tsize * sizeof(HidxSlot));  // all heads = -1
+
+  for (int64_t i = 0; i < zn; ++i) {
+    if (ISNA<T>(offs[i])) continue;
+    uint64_t h = hashes[i];
+    size_t t = h >> tshift;
+    while (slots[t].head != -1 && slots[t].hash != h) t = (t + 1) & tmask;
+    if (slots[t].head == -1) {
+      slots[t].hash = h;
+      next[i] = -1;
+    } else {
+      next[i] = slots[t].head;
+    }
+    slots[t].head = static_cast<int32_t>(i);
+  }
+
+  hidx_shift = tshift;
+  hidx_mutid = mutid;
+}
+
+
+template <typename T>
+bool StringColumn<T>::index_equal_rows(
+    const uint8_t* str, size_t len, bool isna, bool invert, int8_t* out) const
+{
+  if (ri) return false;
+  if (nrows > std::numeric_limits<int32_t>::max()) return false;
+  if (hidx_mutid != mutid || !hidx_slots) {
+    if (hidx_query_mutid != mutid) {
+      // First point query against this version of the data: answer it with
+      // the plain scan, and only invest in the index if another one comes.
+      hidx_query_mutid = mutid;
+      return false;
+    }
+    build_hash_index();
+  }
+
+  int8_t match = invert? 0 : 1;
+  std::memset(out, invert? 1 : 0, static_cast<size_t>(nrows));
+  const T* offs = offsets();
+  const uint8_t* strs = ustrdata();
+
+  if (isna) {
+    // An NA needle matches exactly the NA rows; no hashing involved.
+    for (int64_t i = 0; i < nrows; ++i) {
+      if (ISNA<T>(offs[i])) out[i] = match;
+    }
+    return true;
+  }
+
+  auto slots = static_cast<const HidxSlot*>(hidx_slots.rptr());
+  auto next = static_cast<const int32_t*>(hidx_next.rptr());
+  size_t tmask = hidx_slots.size() / sizeof(HidxSlot) - 1;
+  uint64_t h = strhash(str, len);
+  size_t t = h >> hidx_shift;
+  while (slots[t].head != -1) {
+    if (slots[t].hash == h) {
+      for (int32_t r = slots[t].head; r != -1; r = next[r]) {
+        T end = offs[r];
+        T start = offs[r - 1] & ~GETNA<T>();
+        if (static_cast<size_t>(end - start) == len &&
+            std::memcmp(strs + start, str, len) == 0) {
+          out[r] = match;
+        }
+      }
+      break;
+    }
+    t = (t + 1) & tmask;
+  }
+  return true;
+}
+
+
 
 //------------------------------------------------------------------------------
 // Stats
@@ -580,34 +1194,72 @@ RowIndex StringColumn<T>::join(const Column* keycol) const {
 
 template <typename T>
 StringStats<T>* StringColumn<T>::get_stats() const {
-  if (stats == nullptr) stats = new StringStats<T>();
+  if (stats == nullptr) {
+    std::lock_guard<std::mutex> lock(Column::stats_alloc_mutex);
+    if (stats == nullptr) stats = new StringStats<T>();
+  }
   return static_cast<StringStats<T>*>(stats);
 }
 
+template <typename T>
+CString StringColumn<T>::min() const {
+  return get_stats()->min(this);
+}
+
+template <typename T>
+CString StringColumn<T>::max() const {
+  return get_stats()->max(this);
+}
+
 template <typename T>
 CString StringColumn<T>::mode() const {
   return get_stats()->mode(this);
 }
 
+template <typename T>
+PyObject* StringColumn<T>::min_pyscalar() const {
+  return string_to_py(min());
+}
+
+template <typename T>
+PyObject* StringColumn<T>::max_pyscalar() const {
+  return string_to_py(max());
+}
+
 template <typename T>
 PyObject* StringColumn<T>::mode_pyscalar() const {
   return string_to_py(mode());
 }
 
+// Wrap a single (possibly NA) string value into a 1-row column.
 template <typename T>
-Column* StringColumn<T>::mode_column() const {
-  CString m = mode();
+Column* StringColumn<T>::onevalue_column(const CString& v) {
   auto col = new StringColumn<T>(1);
-  if (m.size >= 0) {
-    col->mbuf.set_element(1, static_cast<T>(m.size));
-    col->strbuf.resize(static_cast<size_t>(m.size));
-    std::memcpy(col->strbuf.wptr(), m.ch, static_cast<size_t>(m.size));
+  if (v.size >= 0) {
+    col->mbuf.set_element(1, static_cast<T>(v.size));
+    col->strbuf.resize(static_cast<size_t>(v.size));
+    std::memcpy(col->strbuf.wptr(), v.ch, static_cast<size_t>(v.size));
   } else {
     col->mbuf.set_element(1, GETNA<T>());
   }
   return col;
 }
 
+template <typename T>
+Column* StringColumn<T>::min_column() const {
+  return onevalue_column(min());
+}
+
+template <typename T>
+Column* StringColumn<T>::max_column() const {
+  return onevalue_column(max());
+}
+
+template <typename T>
+Column* StringColumn<T>::mode_column() const {
+  return onevalue_column(mode());
+}
+
 
 
 
@@ -8,11 +8,47 @@
 #include "columnset.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include "options.h"
 #include "utils.h"
 #include "utils/alloc.h"
 #include "utils/exceptions.h"
 
 
+/**
+ * Apply the `view.materialization` policy to freshly created view columns.
+ * "lazy" leaves them as views, materialized on first access (or started in
+ * the background when `view.materialize_async` is set); "eager" reifies
+ * them immediately; "auto" materializes a selection only when the copy is
+ * estimated to be cheaper than keeping the view around: small results
+ * (typical of interactive inspection) and highly selective filters (where
+ * a long-lived view would pin the much larger source buffers in memory)
+ * are reified, while large low-selectivity slices stay lazy.
+ */
+static void apply_materialization_policy(Column** columns, int64_t count,
+                                         const RowIndex& rowindex,
+                                         int64_t src_nrows)
+{
+  bool eager = (config::view_materialization ==
+                config::MaterializationPolicy::Eager);
+  if (config::view_materialization == config::MaterializationPolicy::Auto) {
+    // The columns may also be views through the source columns' own
+    // rowindexes; the explicit selection is what the policy grades.
+    int64_t selrows = rowindex.isabsent()? src_nrows : rowindex.length();
+    eager = (selrows <= 4096) || (selrows * 4 <= src_nrows);
+  }
+  for (int64_t i = 0; i < count; i++) {
+    if (eager) {
+      columns[i]->reify();
+    } else {
+      // Optionally start materializing the view right away on the
+      // background thread, so that the first access does not pay the
+      // whole reify() cost.
+      columns[i]->reify_async();
+    }
+  }
+}
+
+
 /**
  * Create an array of columns by taking a slice from columns of DataTable `dt`.
  */
@@ -35,6 +71,7 @@ Column** columns_from_slice(DataTable* dt, const RowIndex& rowindex,
   for (int64_t i = 0, j = start; i < count; i++, j += step) {
     columns[i] = srccols[j]->shallowcopy(rowindex);
   }
+  apply_materialization_policy(columns, count, rowindex, dt->nrows);
   return columns;
 }
 
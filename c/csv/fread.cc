@@ -35,7 +35,7 @@ std::unique_ptr<DataTable> FreadReader::read()
   detect_lf();
   skip_preamble();
 
-  if (verbose) fo.t_initialized = wallclock();
+  fo.t_initialized = wallclock();
 
   detect_sep_and_qr();    // [2]
   detect_column_types();  // [3]
@@ -55,7 +55,7 @@ std::unique_ptr<DataTable> FreadReader::read()
     sof = fctx.ch;  // Update sof to point to the first line after the columns
     line++;
   }
-  if (verbose) fo.t_column_types_detected = wallclock();
+  fo.t_column_types_detected = wallclock();
 
 
   //*********************************************************************************************
@@ -100,12 +100,10 @@ std::unique_ptr<DataTable> FreadReader::read()
 
     columns.set_nrows(allocnrow);
 
-    if (verbose) {
-      fo.t_frame_allocated = wallclock();
-      fo.n_rows_allocated = allocnrow;
-      fo.n_cols_allocated = ncols - ndropped;
-      fo.allocation_size = columns.totalAllocSize();
-    }
+    fo.t_frame_allocated = wallclock();
+    fo.n_rows_allocated = allocnrow;
+    fo.n_cols_allocated = ncols - ndropped;
+    fo.allocation_size = columns.totalAllocSize();
   }
 
 
@@ -114,13 +112,19 @@ std::unique_ptr<DataTable> FreadReader::read()
   //*********************************************************************************************
   bool firstTime = true;
 
+  // Journal of the chunks committed by the initial pass over the data. If
+  // any column's type gets bumped out-of-sample, the reread pass replays
+  // these chunks verbatim: no chunk-boundary detection, and the columns that
+  // did not bump are merely field-skipped (see FreadThreadContext).
+  dt::read::ChunkJournal journal;
+
   std::unique_ptr<PT[]> typesPtr = columns.getTypes();
   PT* types = typesPtr.get();  // This pointer is valid until `typesPtr` goes out of scope
 
   trace("[6] Read the data");
   read:  // we'll return here to reread any columns with out-of-sample type exceptions
   {
-    dt::read::FreadParallelReader scr(*this, types);
+    dt::read::FreadParallelReader scr(*this, types, &journal);
     scr.read_all();
 
     if (firstTime) {
@@ -159,5 +163,10 @@ std::unique_ptr<DataTable> FreadReader::read()
   trace("[7] Finalize the datatable");
   auto res = makeDatatable();
   if (verbose) fo.report();
+  // Attach the machine-readable read report to the python reader object,
+  // where the frontend exposes it as `GenericReader.read_report`
+  py::oobj report = fo.get_report();
+  PyObject_SetAttrString(pyreader().to_borrowed_ref(), "_read_report",
+                         report.to_borrowed_ref());
   return res;
 }
@@ -39,6 +39,8 @@ PyObject* write_csv(PyObject*, PyObject* args)
   cwriter.set_logger(arg1);
   cwriter.set_verbose(pywr.get_attr("verbose").to_bool());
   cwriter.set_usehex(pywr.get_attr("hex").to_bool());
+  cwriter.set_compress(pywr.get_attr("compress").to_bool());
+  cwriter.set_append(pywr.get_attr("append").to_bool());
   cwriter.set_strategy(sstrategy);
 
   auto colnames = pywr.get_attr("column_names").to_stringlist();
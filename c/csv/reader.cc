@@ -10,11 +10,13 @@
 #include "csv/reader_fread.h"
 #include <stdlib.h>   // strtod
 #include <strings.h>  // strcasecmp
+#include <zlib.h>     // z_stream, inflate
 #include <cerrno>     // errno
 #include <cstring>    // std::memcmp
 #include "datatable.h"
 #include "encodings.h"
 #include "options.h"
+#include "perf.h"
 #include "utils/exceptions.h"
 #include "utils/omp.h"
 #include "python/list.h"
@@ -289,7 +291,12 @@ void GenericReader::init_overridecolumntypes() {
 
 std::unique_ptr<DataTable> GenericReader::read()
 {
+  dt::perf::OpTimer optimer("fread");
+  optimer.set_nthreads(nthreads);
+  if (optimer.is_active()) perf_timer = &optimer;
   open_input();
+  optimer.set_bytes(static_cast<int64_t>(datasize()));
+  detect_and_decompress();
   detect_and_skip_bom();
   skip_to_line_number();
   skip_to_line_with_string();
@@ -539,6 +546,11 @@ void GenericReader::open_input() {
   eof = sof + input_mbuf.size() - extra_byte;
   if (eof) xassert(*eof == '\0');
 
+  // The input is parsed front-to-back: enable aggressive read-ahead, so
+  // that a cold-start read of a memory-mapped file does not proceed at
+  // page-fault speed.
+  input_mbuf.advise(MmmAdvice::Sequential);
+
   if (verbose) {
     trace("==== file sample ====");
     const char* ch = sof;
@@ -569,6 +581,94 @@ void GenericReader::open_input() {
 }
 
 
+/**
+ * Check whether the input is a gzip stream (magic bytes 1F 8B), and if so
+ * replace `input_mbuf` with a new buffer containing the inflated data. The
+ * stream is decoded directly out of the memory-mapped source into the parse
+ * buffer, so the compressed file never takes a round trip through a
+ * temporary file or an intermediate Python bytes object.
+ *
+ * The output buffer is sized from the ISIZE field in the gzip trailer (the
+ * uncompressed length modulo 2^32), and grows geometrically if that guess
+ * turns out to be too small (e.g. for files larger than 4GB, or files made
+ * of several concatenated gzip members).
+ */
+void GenericReader::detect_and_decompress() {
+  constexpr size_t CHUNK = size_t(1) << 30;  // zlib counts are 32-bit
+  size_t size = datasize();
+  const auto* usof = reinterpret_cast<const unsigned char*>(sof);
+  if (size < 18 || usof[0] != 0x1F || usof[1] != 0x8B) return;
+  double t0 = wallclock();
+
+  size_t alloc_size = static_cast<size_t>(usof[size - 4]) |
+                      (static_cast<size_t>(usof[size - 3]) << 8) |
+                      (static_cast<size_t>(usof[size - 2]) << 16) |
+                      (static_cast<size_t>(usof[size - 1]) << 24);
+  if (alloc_size < size * 3) alloc_size = size * 3;
+  MemoryRange outbuf = MemoryRange::mem(alloc_size + 1);
+
+  z_stream zs;
+  std::memset(&zs, 0, sizeof(zs));
+  int r = inflateInit2(&zs, 15 + 16);  // +16: expect gzip wrapper
+  if (r != Z_OK) {
+    throw RuntimeError() << "Unable to initialize zlib (error " << r << ")";
+  }
+  const char* in_ptr = sof;
+  size_t in_left = size;
+  size_t out_size = 0;
+  while (true) {
+    if (zs.avail_in == 0 && in_left) {
+      size_t n = std::min(in_left, CHUNK);
+      zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in_ptr));
+      zs.avail_in = static_cast<uInt>(n);
+      in_ptr += n;
+      in_left -= n;
+    }
+    if (out_size == alloc_size) {
+      alloc_size *= 2;
+      outbuf.resize(alloc_size + 1);
+    }
+    zs.next_out = static_cast<Bytef*>(outbuf.wptr()) + out_size;
+    size_t out_avail = std::min(alloc_size - out_size, CHUNK);
+    zs.avail_out = static_cast<uInt>(out_avail);
+    r = inflate(&zs, Z_NO_FLUSH);
+    out_size += out_avail - zs.avail_out;
+    if (r == Z_STREAM_END) {
+      if (zs.avail_in == 0 && in_left) {  // refill across a member boundary
+        size_t n = std::min(in_left, CHUNK);
+        zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in_ptr));
+        zs.avail_in = static_cast<uInt>(n);
+        in_ptr += n;
+        in_left -= n;
+      }
+      if (zs.avail_in >= 2 && zs.next_in[0] == 0x1F && zs.next_in[1] == 0x8B) {
+        inflateReset(&zs);  // concatenated gzip members
+        continue;
+      }
+      break;  // ignore trailing non-gzip bytes, same as the `gzip` utility
+    }
+    if (r == Z_OK) continue;
+    if (r == Z_BUF_ERROR && (zs.avail_in || in_left || out_size == alloc_size)) {
+      continue;
+    }
+    const char* zmsg = zs.msg;
+    inflateEnd(&zs);
+    throw RuntimeError() << "Unable to decompress gzip input: "
+                         << (zmsg? zmsg : "the stream appears to be truncated");
+  }
+  inflateEnd(&zs);
+
+  outbuf.resize(out_size + 1);
+  static_cast<char*>(outbuf.wptr())[out_size] = '\0';
+  input_mbuf = std::move(outbuf);
+  sof = static_cast<char*>(input_mbuf.wptr());
+  eof = sof + out_size;
+  input_is_string = false;
+  trace("Decompressed gzip input: %zu -> %zu bytes in %.3fs",
+        size, out_size, wallclock() - t0);
+}
+
+
 /**
  * Check whether the input contains BOM (Byte Order Mark), and if so skip it
  * modifying `sof`. If BOM indicates UTF-16 file, then recode the file into
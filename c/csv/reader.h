@@ -13,6 +13,7 @@
 #include "read/columns.h"   // dt::read::Columns
 
 class DataTable;
+namespace dt { namespace perf { class OpTimer; }}
 
 
 /**
@@ -88,6 +89,9 @@ class GenericReader
     bool cr_is_newline;
     bool input_is_string{ false };
     int : 16;
+    // Set for the duration of `read()` when perf tracking is on; parallel
+    // reading loops report their per-thread busy times here (see perf.h)
+    dt::perf::OpTimer* perf_timer{ nullptr };
     dt::read::Columns columns;
     double t_open_input{ 0 };
 
@@ -168,6 +172,7 @@ class GenericReader
 
   protected:
     void open_input();
+    void detect_and_decompress();
     void detect_and_skip_bom();
     void skip_initial_whitespace();
     void skip_trailing_whitespace();
@@ -11,6 +11,7 @@
 #include <cmath>       // std::exp
 #include <exception>
 #include <map>         // std::map
+#include <vector>      // std::vector
 #include "csv/reader.h"
 #include "csv/reader_parsers.h"
 #include "csv/fread.h"
@@ -18,6 +19,11 @@
 #include "column.h"
 #include "py_datatable.h"
 #include "py_encodings.h"
+#include "python/dict.h"
+#include "python/float.h"
+#include "python/int.h"
+#include "python/list.h"
+#include "python/string.h"
 #include "py_utils.h"
 #include "utils/assert.h"
 #include "utils/file.h"
@@ -367,8 +373,8 @@ void FreadReader::detect_sep_and_qr() {
     else if (sep >= ' ') trace("sep = '%c'", sep);
     else trace("sep = '\\x%02x'", int(sep));
     trace("Quote rule = %d", quoteRule);
-    fo.t_parse_parameters_detected = wallclock();
   }
+  fo.t_parse_parameters_detected = wallclock();
 }
 
 
@@ -467,8 +473,11 @@ class ColumnTypeDetectionChunkster {
  *
  * If the line cannot be parsed (because it contains a string that is not
  * parseable under the current quoting rule), then return -1.
+ *
+ * If `field_sizes` is given, then the byte length of each parsed field is
+ * added to `field_sizes[j]` (for fields with index below ncols).
  */
-int64_t FreadReader::parse_single_line(FreadTokenizer& fctx)
+int64_t FreadReader::parse_single_line(FreadTokenizer& fctx, size_t* field_sizes)
 {
   const char*& tch = fctx.ch;
 
@@ -521,6 +530,9 @@ int64_t FreadReader::parse_single_line(FreadTokenizer& fctx)
       // Finally, bump the column's type and try again
       ++ptype_iter;
     }
+    if (field_sizes && j < ncols) {
+      field_sizes[j] += static_cast<size_t>(tch - fieldStart);
+    }
     if (j < ncols && ptype_iter.has_incremented()) {
       col.set_ptype(ptype_iter);
     }
@@ -571,6 +583,11 @@ void FreadReader::detect_column_types()
   // so that we can revert to them if the jump proves to be invalid.
   auto saved_types = std::unique_ptr<PT[]>(new PT[ncols]);
 
+  // Accumulated byte lengths of the sampled fields, per column. These
+  // estimate how many data bytes each column will need per row, which we use
+  // to pre-size the string buffers of the output columns.
+  std::vector<size_t> field_sizes(ncols, 0);
+
   for (size_t j = 0; j < nChunks; ++j) {
     dt::read::ChunkCoordinates cc = chunkster.compute_chunk_boundaries(j);
     tch = cc.start;
@@ -581,7 +598,7 @@ void FreadReader::detect_column_types()
     for (int i = 0; i < rows_to_sample; ++i) {
       if (tch >= eof) break;
       const char* lineStart = tch;
-      int64_t incols = parse_single_line(fctx);
+      int64_t incols = parse_single_line(fctx, field_sizes.data());
       if (incols == 0 && (skip_blank_lines || ncols == 1)) {
         continue;
       }
@@ -665,6 +682,17 @@ void FreadReader::detect_column_types()
       estnrow = allocnrow = max_nrows;
     }
   }
+
+  // `allocnrow` covers the fixed-width part of the output columns; string
+  // columns additionally need an estimate of their total data size, which
+  // we take from the average width of the sampled fields (see
+  // Column::allocate()).
+  if (n_sample_lines > 0) {
+    for (size_t j = 0; j < ncols; ++j) {
+      columns[j].set_bytes_per_row(
+          static_cast<double>(field_sizes[j]) / n_sample_lines);
+    }
+  }
   fo.n_lines_sampled = n_sample_lines;
 }
 
@@ -1113,7 +1141,7 @@ bool FreadTokenizer::next_good_line_start(
   const char* end = cc.end;
   int attempts = 0;
   while (ch < end && attempts++ < 10) {
-    while (ch < end && *ch != '\n' && *ch != '\r') ch++;
+    ch = fread_scan4(ch, end, '\n', '\r', '\n', '\r');
     if (ch == end) break;
     skip_eol();  // updates `ch`
     // countfields() below moves the parse location, so store it in `ch1` in
@@ -1161,6 +1189,10 @@ FreadObserver::FreadObserver(const GenericReader& g_) : g(g_) {
   n_cols_reread = 0;
   allocation_size = 0;
   read_data_nthreads = 0;
+  n_chunks = 0;
+  n_reallocs = 0;
+  n_type_bumps = 0;
+  n_str64_bumps = 0;
 }
 
 FreadObserver::~FreadObserver() {}
@@ -1255,6 +1287,7 @@ void FreadObserver::type_bump_info(
     static_cast<int>(len), field, lineno);
   n = std::min(n, BUF_SIZE);
   messages.push_back(std::string(temp, static_cast<size_t>(n)));
+  n_type_bumps++;
 }
 
 
@@ -1267,4 +1300,58 @@ void FreadObserver::str64_bump(size_t icol, const dt::read::Column& col) {
     icol, col.repr_name(g));
   n = std::min(n, BUF_SIZE);
   messages.push_back(std::string(temp, static_cast<size_t>(n)));
+  n_str64_bumps++;
+}
+
+
+py::oobj FreadObserver::get_report() const {
+  double t_end = wallclock();
+  double total_time = std::max(t_end - t_start + g.t_open_input, 1e-6);
+  size_t nth = std::max<size_t>(read_data_nthreads, 1);
+  double read_time = t_data_read - t_frame_allocated;
+  double reread_time = t_data_reread - t_data_read;
+  double busy_time = (time_read_data + time_push_data) / nth;
+  double data_time = std::max(read_time + reread_time, 1e-9);
+
+  py::odict phases;
+  phases.set(py::ostring("open_input"), py::ofloat(g.t_open_input));
+  phases.set(py::ostring("detect_parse_parameters"),
+             py::ofloat(t_parse_parameters_detected - t_initialized));
+  phases.set(py::ostring("detect_column_types"),
+             py::ofloat(t_column_types_detected -
+                        t_parse_parameters_detected));
+  phases.set(py::ostring("allocate_frame"),
+             py::ofloat(t_frame_allocated - t_column_types_detected));
+  phases.set(py::ostring("read_data"), py::ofloat(read_time));
+  phases.set(py::ostring("reread_data"), py::ofloat(reread_time));
+  phases.set(py::ostring("create_frame"), py::ofloat(t_end - t_data_reread));
+
+  py::olist msgs(messages.size());
+  for (size_t i = 0; i < messages.size(); ++i) {
+    msgs.set(i, py::ostring(messages[i]));
+  }
+
+  py::odict res;
+  res.set(py::ostring("input_size"), py::oint(input_size));
+  res.set(py::ostring("nrows"), py::oint(n_rows_read));
+  res.set(py::ostring("ncols"), py::oint(n_cols_read));
+  res.set(py::ostring("nrows_allocated"), py::oint(n_rows_allocated));
+  res.set(py::ostring("allocation_size"), py::oint(allocation_size));
+  res.set(py::ostring("nthreads"), py::oint(read_data_nthreads));
+  res.set(py::ostring("nchunks"), py::oint(n_chunks));
+  res.set(py::ostring("nreallocs"), py::oint(n_reallocs));
+  res.set(py::ostring("ntype_bumps"), py::oint(n_type_bumps));
+  res.set(py::ostring("nstr64_bumps"), py::oint(n_str64_bumps));
+  res.set(py::ostring("ncols_reread"), py::oint(n_cols_reread));
+  res.set(py::ostring("nlines_sampled"), py::oint(n_lines_sampled));
+  res.set(py::ostring("time_total"), py::ofloat(total_time));
+  res.set(py::ostring("phases"), phases);
+  // Average fraction of the data-reading phase that worker threads spent
+  // doing useful work (parsing or pushing rows), as opposed to waiting
+  res.set(py::ostring("thread_busy_fraction"),
+          py::ofloat(std::min(busy_time / data_time, 1.0)));
+  res.set(py::ostring("read_speed"),
+          py::ofloat(input_size / total_time));
+  res.set(py::ostring("messages"), msgs);
+  return std::move(res);
 }
@@ -57,6 +57,10 @@ class FreadObserver {
     size_t n_cols_reread;
     size_t allocation_size;
     size_t read_data_nthreads;
+    size_t n_chunks;
+    size_t n_reallocs;
+    size_t n_type_bumps;
+    size_t n_str64_bumps;
     std::vector<std::string> messages;
 
   public:
@@ -68,6 +72,11 @@ class FreadObserver {
     void str64_bump(size_t icol, const dt::read::Column& col);
 
     void report();
+
+    // Machine-readable counterpart of `report()`: a python dict of
+    // counters and per-phase timings, attached to the python reader
+    // object as `_read_report` (see `gread` in csv/py_csv.cc).
+    py::oobj get_report() const;
 };
 
 
@@ -141,7 +150,7 @@ private:
   void detect_sep_and_qr();
   void detect_column_types();
   void detect_header();
-  int64_t parse_single_line(FreadTokenizer&);
+  int64_t parse_single_line(FreadTokenizer&, size_t* field_sizes = nullptr);
 
   friend dt::read::FreadThreadContext;
   friend dt::read::FreadParallelReader;
@@ -575,6 +575,126 @@ void parse_float64_hex(FreadTokenizer& ctx) {
 
 
 
+//------------------------------------------------------------------------------
+// Date / time
+//------------------------------------------------------------------------------
+
+/**
+ * Read exactly `n` consecutive digits into `*value`, returning false if any
+ * of the characters is not a digit (in which case `*value` is undefined).
+ * Each character is examined only after the previous one matched, so the
+ * function never reads past a field terminator.
+ */
+static inline bool read_digits(const char* ch, int n, int* value) {
+  int v = 0;
+  for (int i = 0; i < n; ++i) {
+    uint8_t digit = static_cast<uint8_t>(ch[i] - '0');
+    if (digit > 9) return false;
+    v = v * 10 + digit;
+  }
+  *value = v;
+  return true;
+}
+
+/**
+ * Number of days between the given civil date and the Unix epoch 1970-01-01.
+ * This is the branchless algorithm from Howard Hinnant's "chrono-compatible
+ * low-level date algorithms"; it is valid for all dates in years 0 .. 9999.
+ */
+static inline int64_t days_from_civil(int64_t y, int64_t m, int64_t d) {
+  y -= (m <= 2);
+  int64_t era = (y >= 0? y : y - 399) / 400;
+  int64_t yoe = y - era * 400;
+  int64_t doy = (153 * (m + (m > 2? -3 : 9)) + 2) / 5 + d - 1;
+  int64_t doe = yoe * 365 + yoe/4 - yoe/100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+static inline bool valid_ymd(int year, int month, int day) {
+  static const int8_t days_in_month[13] =
+      {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  if (month < 1 || month > 12 || day < 1) return false;
+  bool leap = (year % 4 == 0) && (year % 100 != 0 || year % 400 == 0);
+  return day <= days_in_month[month] + (leap && month == 2);
+}
+
+
+/**
+ * Parse a date in the ISO-8601 "YYYY-MM-DD" format, storing it as the number
+ * of seconds since the Unix epoch (at midnight UTC of that day). Only fully
+ * valid calendar dates are accepted; anything else bumps the column further,
+ * eventually to string.
+ */
+void parse_date_iso(FreadTokenizer& ctx) {
+  const char* ch = ctx.ch;
+  int year, month, day;
+  if (read_digits(ch, 4, &year) && ch[4] == '-' &&
+      read_digits(ch + 5, 2, &month) && ch[7] == '-' &&
+      read_digits(ch + 8, 2, &day) &&
+      valid_ymd(year, month, day)) {
+    ctx.target->int64 = days_from_civil(year, month, day) * 86400;
+    ctx.ch = ch + 10;
+  } else {
+    ctx.target->int64 = NA_INT64;
+  }
+}
+
+
+/**
+ * Parse a timestamp in the ISO-8601 format "YYYY-MM-DD[T ]hh:mm:ss" with an
+ * optional zero fractional part and an optional timezone designator ("Z" or
+ * "+hh:mm" / "-hh:mm"), storing the value as seconds since the Unix epoch.
+ * A nonzero fractional part is rejected: it cannot be represented in integer
+ * seconds, and silently truncating it would lose data -- such columns bump
+ * to string instead.
+ */
+void parse_timestamp_iso(FreadTokenizer& ctx) {
+  const char* ch = ctx.ch;
+  int year, month, day, hour, minute, second;
+  if (!(read_digits(ch, 4, &year) && ch[4] == '-' &&
+        read_digits(ch + 5, 2, &month) && ch[7] == '-' &&
+        read_digits(ch + 8, 2, &day) &&
+        (ch[10] == 'T' || ch[10] == ' ') &&
+        read_digits(ch + 11, 2, &hour) && ch[13] == ':' &&
+        read_digits(ch + 14, 2, &minute) && ch[16] == ':' &&
+        read_digits(ch + 17, 2, &second) &&
+        valid_ymd(year, month, day) &&
+        hour < 24 && minute < 60 && second < 60)) {
+    ctx.target->int64 = NA_INT64;
+    return;
+  }
+  int64_t value = (days_from_civil(year, month, day) * 24 + hour) * 3600
+                  + minute * 60 + second;
+  ch += 19;
+  if (*ch == '.') {
+    const char* ch2 = ch + 1;
+    while (*ch2 == '0') ch2++;
+    if (ch2 == ch + 1) {  // "." not followed by any digits
+      ctx.target->int64 = NA_INT64;
+      return;
+    }
+    ch = ch2;  // a nonzero digit here will fail the end-of-field check
+  }
+  if (*ch == 'Z') {
+    ch++;
+  } else if (*ch == '+' || *ch == '-') {
+    int tzh, tzm;
+    if (read_digits(ch + 1, 2, &tzh) && ch[3] == ':' &&
+        read_digits(ch + 4, 2, &tzm) && tzh < 24 && tzm < 60) {
+      int64_t offset = tzh * 3600 + tzm * 60;
+      value += (*ch == '-')? offset : -offset;
+      ch += 6;
+    } else {
+      ctx.target->int64 = NA_INT64;
+      return;
+    }
+  }
+  ctx.target->int64 = value;
+  ctx.ch = ch;
+}
+
+
+
 //------------------------------------------------------------------------------
 // String
 //------------------------------------------------------------------------------
@@ -594,6 +714,10 @@ void parse_string(FreadTokenizer& ctx) {
     // If field contains sep|eol then it should have been quoted and we do not
     // try to heal that.
     while (1) {
+      // Skip 8 bytes at a time to the next candidate terminator; the exact
+      // field-ending rules (e.g. \r inside \n-terminated files) are then
+      // checked one byte at a time, exactly as before.
+      ch = fread_scan4(ch, ctx.eof, sep, '\n', '\r', '\0');
       if (*ch == sep) break;
       if (static_cast<uint8_t>(*ch) <= 13) {
         if (*ch == '\n' || ch == ctx.eof) break;
@@ -604,6 +728,7 @@ void parse_string(FreadTokenizer& ctx) {
           if (*tch == '\n') break;
         }
       }
+      if (ch == ctx.eof) break;
       ch++;  // sep, \r, \n or \0 will end
     }
     ctx.ch = ch;
@@ -712,6 +837,46 @@ void parse_string(FreadTokenizer& ctx) {
 
 
 
+/**
+ * Pseudo-parser used for columns that the user excluded from the output: the
+ * field is scanned to its end using the same boundary rules as
+ * `parse_string`, but no value is produced -- type conversion, NA-string
+ * lookup and whitespace trimming are all skipped. On wide inputs where only
+ * a few columns are selected this makes the cost of the dropped columns
+ * proportional to their raw byte length only.
+ */
+void parse_skip(FreadTokenizer& ctx) {
+  const char* ch = ctx.ch;
+  const char sep = ctx.sep;
+  if (*ch == ' ' && ctx.strip_whitespace) while (*++ch == ' ');
+  if (*ch == ctx.quote && ctx.quoteRule != 3) {
+    // Quoted fields are comparatively rare and fiddly (escapes, 3 quote
+    // rules): delegate to the full string parser. The value it writes goes
+    // into a scratch slot of the row buffer which is never pushed for a
+    // dropped column.
+    parse_string(ctx);
+    return;
+  }
+  while (1) {
+    ch = fread_scan4(ch, ctx.eof, sep, '\n', '\r', '\0');
+    if (*ch == sep) break;
+    if (static_cast<uint8_t>(*ch) <= 13) {
+      if (*ch == '\n' || ch == ctx.eof) break;
+      if (*ch == '\r') {
+        if (!ctx.LFpresent || ch[1] == '\n') break;
+        const char* tch = ch + 1;
+        while (*tch == '\r') tch++;
+        if (*tch == '\n') break;
+      }
+    }
+    if (ch == ctx.eof) break;
+    ch++;
+  }
+  ctx.ch = ch;
+}
+
+
+
 //------------------------------------------------------------------------------
 // ParserLibrary
 //------------------------------------------------------------------------------
@@ -746,6 +911,8 @@ void ParserLibrary::init_parsers() {
   add(PT::Float64Plain, "Float64",         'F', 8, SType::FLOAT64, parse_float64_simple);
   add(PT::Float64Ext,   "Float64/ext",     'F', 8, SType::FLOAT64, parse_float64_extended);
   add(PT::Float64Hex,   "Float64/hex",     'F', 8, SType::FLOAT64, parse_float64_hex);
+  add(PT::DateIso,      "Date/iso",        'D', 8, SType::INT64,   parse_date_iso);
+  add(PT::TimestampIso, "Timestamp/iso",   'T', 8, SType::INT64,   parse_timestamp_iso);
   add(PT::Str32,        "Str32",           's', 4, SType::STR32,   parse_string);
   add(PT::Str64,        "Str64",           'S', 8, SType::STR64,   parse_string);
 }
@@ -36,7 +36,10 @@ void parse_float32_hex(FreadTokenizer&);
 void parse_float64_simple(FreadTokenizer& ctx);
 void parse_float64_extended(FreadTokenizer& ctx);
 void parse_float64_hex(FreadTokenizer&);
+void parse_date_iso(FreadTokenizer&);
+void parse_timestamp_iso(FreadTokenizer&);
 void parse_string(FreadTokenizer&);
+void parse_skip(FreadTokenizer&);
 
 
 //------------------------------------------------------------------------------
@@ -62,6 +65,8 @@ enum PT : uint8_t {
   Float64Plain,
   Float64Ext,
   Float64Hex,
+  DateIso,
+  TimestampIso,
   Str32,
   Str64,
 };
@@ -6,27 +6,37 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include "csv/writer.h"
+#include <cstring>      // std::memcpy
 #include <new>          // placement new
 #include <stdexcept>    // std::runtime_error
 #include <math.h>
 #include <stdint.h>     // int32_t, etc
 #include <stdio.h>      // printf
+#include <vector>       // std::vector
+#include <zlib.h>       // deflate
 #include "column.h"
 #include "csv/toa.h"
 #include "datatable.h"
 #include "memrange.h"
+#include "options.h"
+#include "utils/file.h"
 #include "utils/omp.h"
+#include "utils/progress.h"
 #include "types.h"
 #include "utils.h"
 
 
 class CsvColumn;
 static void write_string(char** pch, const char* value);
+static const uint8_t* scan_unquoted(const uint8_t* sch, const uint8_t* strend);
 
 typedef void (*writer_fn)(char** pch, CsvColumn* col, int64_t row);
 
 static size_t bytes_per_stype[DT_STYPES_COUNT];
 static writer_fn writers_per_stype[DT_STYPES_COUNT];
+// Fast-path writers used for string cells inside a chunk whose entire
+// strdata extent was pre-scanned and found free of quote-forcing bytes.
+static writer_fn writers_clean_per_stype[DT_STYPES_COUNT];
 
 
 
@@ -36,21 +46,29 @@ public:
   const void* data;
   const char* strbuf;
   writer_fn writer;
+  writer_fn writer_clean;
+  int8_t strtype;  // 0 = not a string column, 1 = str32, 2 = str64
+  int64_t : 56;
 
   CsvColumn(Column *col) {
     data = col->data();
     strbuf = nullptr;
+    strtype = 0;
     writer = writers_per_stype[static_cast<int>(col->stype())];
     if (!writer) {
       throw ValueError() << "Cannot write type " << col->stype();
     }
+    writer_clean = writers_clean_per_stype[static_cast<int>(col->stype())];
+    if (!writer_clean) writer_clean = writer;
     if (col->stype() == SType::STR32) {
       strbuf = static_cast<StringColumn<uint32_t>*>(col)->strdata();
       data = static_cast<StringColumn<uint32_t>*>(col)->offsets();
+      strtype = 1;
     }
     else if (col->stype() == SType::STR64) {
       strbuf = static_cast<StringColumn<uint64_t>*>(col)->strdata();
       data = static_cast<StringColumn<uint64_t>*>(col)->offsets();
+      strtype = 2;
     }
   }
 
@@ -64,6 +82,19 @@ public:
     const T* offsets = static_cast<const T*>(data);
     return (offsets[row1 - 1] - offsets[row0 - 1]) & ~GETNA<T>();
   }
+
+  // True when the chunk's entire string extent holds no byte that forces
+  // quoting. The offsets array gives the extent of rows row0..row1 up
+  // front, so one contiguous SWAR scan vets every cell of the chunk at
+  // once; the per-cell writer can then skip its own scan and copy.
+  template <typename T>
+  bool chunk_is_clean(int64_t row0, int64_t row1) {
+    const T* offsets = static_cast<const T*>(data);
+    T off0 = offsets[row0 - 1] & ~GETNA<T>();
+    T off1 = offsets[row1 - 1] & ~GETNA<T>();
+    const uint8_t* s = reinterpret_cast<const uint8_t*>(strbuf);
+    return scan_unquoted(s + off0, s + off1) == s + off1;
+  }
 };
 
 #define VLOG(...)  do { if (verbose) log_message(logger, __VA_ARGS__); } while (0)
@@ -91,6 +122,44 @@ void write_iN(char** pch, CsvColumn* col, int64_t row) {
 }
 
 
+/**
+ * Scan the string `[sch, strend)` and return a pointer to the first byte
+ * that forces the field to be quoted: a double quote, a comma, or a control
+ * character (which includes \n and \r). If the string contains no such
+ * bytes, `strend` is returned.
+ *
+ * The scan tests 8 bytes per iteration: each of the three conditions is a
+ * variation of the SWAR "does this word contain a zero byte" trick (the
+ * `c < 32` test only fires for bytes with the high bit clear, which is
+ * exactly right -- UTF-8 continuation bytes never need escaping).
+ */
+static const uint8_t* scan_unquoted(const uint8_t* sch, const uint8_t* strend)
+{
+  constexpr uint64_t ONES = 0x0101010101010101ULL;
+  constexpr uint64_t HIGH = 0x8080808080808080ULL;
+  constexpr uint64_t MQUOTE = ONES * '"';
+  constexpr uint64_t MCOMMA = ONES * ',';
+  while (sch + 8 <= strend) {
+    uint64_t v;
+    std::memcpy(&v, sch, 8);
+    uint64_t vq = v ^ MQUOTE;
+    uint64_t vc = v ^ MCOMMA;
+    uint64_t flags = ((vq - ONES) & ~vq & HIGH) |
+                     ((vc - ONES) & ~vc & HIGH) |
+                     ((v - ONES * 32) & ~v & HIGH);
+    if (flags) break;
+    sch += 8;
+  }
+  while (sch < strend) {  // ',' is 44, '"' is 34
+    uint8_t c = *sch;
+    // First `c <= 44` is to give an opportunity to short-circuit early.
+    if (c <= 44 && (c == 44 || c == 34 || c < 32)) break;
+    sch++;
+  }
+  return sch;
+}
+
+
 template <typename T>
 void write_str(char** pch, CsvColumn* col, int64_t row)
 {
@@ -107,27 +176,57 @@ void write_str(char** pch, CsvColumn* col, int64_t row)
   }
   const uint8_t* strstart = reinterpret_cast<const uint8_t*>(col->strbuf) + offset0;
   const uint8_t* strend = reinterpret_cast<const uint8_t*>(col->strbuf) + offset1;
-  const uint8_t* sch = strstart;
-  if (*sch == 32) goto quote;
-  while (sch < strend) {  // ',' is 44, '"' is 34
-    uint8_t c = *sch;
-    // First `c <= 44` is to give an opportunity to short-circuit early.
-    if (c <= 44 && (c == 44 || c == 34 || c < 32)) break;
-    *ch++ = static_cast<char>(c);
-    sch++;
+  const uint8_t* sch = scan_unquoted(strstart, strend);
+  if (sch == strend && *strstart != 32 && strend[-1] != 32) {
+    // Common case: the string requires no quoting, copy it in one go.
+    size_t size = static_cast<size_t>(strend - strstart);
+    std::memcpy(ch, strstart, size);
+    *pch = ch + size;
+    return;
   }
-  if (sch < strend || sch[-1] == 32) {
-    quote:
-    ch = *pch;
-    std::memcpy(ch + 1, strstart, static_cast<size_t>(sch - strstart));
-    *ch = '"';
-    ch += sch - strstart + 1;
-    while (sch < strend) {
-      if (*sch == '"') *ch++ = '"';  // double the quote
-      *ch++ = static_cast<char>(*sch++);
-    }
-    *ch++ = '"';
+  // The field has to be quoted (a special character, or a leading / trailing
+  // space): copy the clean prefix verbatim, then escape the remainder one
+  // character at a time.
+  std::memcpy(ch + 1, strstart, static_cast<size_t>(sch - strstart));
+  *ch = '"';
+  ch += sch - strstart + 1;
+  while (sch < strend) {
+    if (*sch == '"') *ch++ = '"';  // double the quote
+    *ch++ = static_cast<char>(*sch++);
+  }
+  *ch++ = '"';
+  *pch = ch;
+}
+
+
+/**
+ * Same as `write_str()`, but for cells inside a chunk that
+ * `chunk_is_clean()` has already vetted: no byte in the chunk's extent can
+ * force escaping, so the cell is a straight memcpy. Leading or trailing
+ * spaces still require wrapping in quotes (but never doubling), and NA /
+ * empty cells are handled as usual.
+ */
+template <typename T>
+void write_str_clean(char** pch, CsvColumn* col, int64_t row)
+{
+  T offset1 = (static_cast<const T*>(col->data))[row];
+  T offset0 = (static_cast<const T*>(col->data))[row - 1] & ~GETNA<T>();
+  char *ch = *pch;
+
+  if (ISNA<T>(offset1)) return;
+  if (offset0 == offset1) {
+    ch[0] = '"';
+    ch[1] = '"';
+    *pch = ch + 2;
+    return;
   }
+  const char* strstart = col->strbuf + offset0;
+  size_t size = static_cast<size_t>(offset1 - offset0);
+  bool quote = (strstart[0] == ' ') | (strstart[size - 1] == ' ');
+  if (quote) *ch++ = '"';
+  std::memcpy(ch, strstart, size);
+  ch += size;
+  if (quote) *ch++ = '"';
   *pch = ch;
 }
 
@@ -274,6 +373,43 @@ static void write_string(char** pch, const char *value)
 
 
 
+/**
+ * Compress `len` bytes from `src` into the buffer `dest` (which is grown if
+ * necessary), and return the size of the compressed data. The data is
+ * written as a complete, self-contained gzip member. The gzip format allows
+ * members to be simply concatenated, so individual chunks of the output can
+ * be compressed independently (and thus in parallel), and then committed in
+ * their original order.
+ */
+static size_t compress_chunk(const char* src, size_t len,
+                             std::vector<char>& dest)
+{
+  z_stream zs;
+  std::memset(&zs, 0, sizeof(zs));
+  int ret = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                         15 + 16 /* gzip format */, 8, Z_DEFAULT_STRATEGY);
+  if (ret != Z_OK) {
+    throw RuntimeError() << "Unable to initialize the gzip compressor: "
+                            "error " << ret;
+  }
+  size_t maxsize = deflateBound(&zs, static_cast<uLong>(len));
+  if (dest.size() < maxsize) dest.resize(maxsize);
+  zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(src));
+  zs.avail_in = static_cast<uInt>(len);
+  zs.next_out = reinterpret_cast<Bytef*>(dest.data());
+  zs.avail_out = static_cast<uInt>(dest.size());
+  ret = deflate(&zs, Z_FINISH);
+  size_t zsize = zs.total_out;
+  deflateEnd(&zs);
+  if (ret != Z_STREAM_END) {
+    throw RuntimeError() << "Error " << ret << " while compressing a chunk "
+                            "of csv output";
+  }
+  return zsize;
+}
+
+
+
 //=================================================================================================
 //
 // Main CSV-writing functions
@@ -287,6 +423,8 @@ CsvWriter::CsvWriter(DataTable *dt_, const std::string& path_)
     nthreads(1),
     usehex(false),
     verbose(false),
+    compress(false),
+    append(false),
     wb(nullptr),
     fixed_size_per_row(0),
     t_last(0)
@@ -304,15 +442,25 @@ void CsvWriter::write()
 {
   int64_t nrows = dt->nrows;
   size_t ncols = static_cast<size_t>(dt->ncols);
+  // All columns will be scanned front-to-back; let the kernel read ahead
+  // aggressively when they are memory-mapped (e.g. an opened Jay frame).
+  for (size_t i = 0; i < ncols; i++) {
+    dt->columns[i]->memory_advise(MmmAdvice::Sequential);
+  }
   size_t bytes_total = estimate_output_size();
   create_target(bytes_total);
-  write_column_names();
+  if (!append) write_column_names();
+  // Claim the writing team out of the global thread budget, in case the
+  // caller is itself running in parallel.
+  config::thread_grant tgrant(nthreads);
+  if (tgrant.nthreads() < nthreads) nthreads = tgrant.nthreads();
   determine_chunking_strategy(bytes_total, nrows);
   create_column_writers(ncols);
   size_t nstrcols32 = strcolumns32.size();
   size_t nstrcols64 = strcolumns64.size();
 
   OmpExceptionManager oem;
+  dt::progress::work pjob("to_csv", nrows);
 
   // Start writing the CSV
   #pragma omp parallel num_threads(nthreads)
@@ -327,8 +475,16 @@ void CsvWriter::write()
     // Initialize thread-local variables
     size_t thbufsize = bytes_per_chunk * 2;
     char*  thbuf = nullptr;
+    // Per-chunk writer choice for each column: string columns flip to their
+    // clean-chunk writer when the chunk's extent passes `chunk_is_clean()`.
+    std::vector<writer_fn> thwriters(ncols);
+    for (size_t col = 0; col < ncols; col++) {
+      thwriters[col] = columns[col]->writer;
+    }
+    const char* th_write_buf = nullptr;
     size_t th_write_at = 0;
     size_t th_write_size = 0;
+    std::vector<char> zbuf;  // compressed chunk, when `compress` is on
     try {
       // Note: do not use new[] here, as it can't be safely realloced
       thbuf = static_cast<char*>(malloc(thbufsize));
@@ -351,7 +507,7 @@ void CsvWriter::write()
       try {
         // write the thread-local buffer into the output
         if (th_write_size) {
-          wb->write_at(th_write_at, th_write_size, thbuf);
+          wb->write_at(th_write_at, th_write_size, th_write_buf);
         }
 
         // Compute the required size of the thread-local buffer, and then
@@ -376,12 +532,25 @@ void CsvWriter::write()
           }
         }
 
+        // Vet each string column's extent for this chunk in one scan, and
+        // pick the per-cell writers accordingly. Only valid when the rows
+        // being written are the physical rows, i.e. the frame is not a view.
+        if (dt->rowindex.isabsent())
+        for (size_t col = 0; col < ncols; col++) {
+          CsvColumn* cc = columns[col];
+          if (!cc->strtype) continue;
+          bool clean = (cc->strtype == 1)
+              ? cc->chunk_is_clean<uint32_t>(row0, row1)
+              : cc->chunk_is_clean<uint64_t>(row0, row1);
+          thwriters[col] = clean? cc->writer_clean : cc->writer;
+        }
+
         // Write the data in rows row0..row1 and in all columns
         char* thch = thbuf;
         dt->rowindex.strided_loop(row0, row1, 1,
           [&](int64_t row) {
             for (size_t col = 0; col < ncols; col++) {
-              columns[col]->write(&thch, row);
+              thwriters[col](&thch, columns[col], row);
               *thch++ = ',';
             }
             thch[-1] = '\n';
@@ -389,6 +558,14 @@ void CsvWriter::write()
         // for (int64_t row = row0; row < row1; row++) {
         // }
         th_write_size = static_cast<size_t>(thch - thbuf);
+        th_write_buf = thbuf;
+        if (compress) {
+          // Compress the chunk into its own gzip member, still in parallel;
+          // only the (much smaller) compressed data goes through the ordered
+          // commit below.
+          th_write_size = compress_chunk(thbuf, th_write_size, zbuf);
+          th_write_buf = zbuf.data();
+        }
       } catch (...) {
         oem.capture_exception();
       }
@@ -396,15 +573,17 @@ void CsvWriter::write()
       #pragma omp ordered
       {
         try {
-          th_write_at = wb->prep_write(th_write_size, thbuf);
+          th_write_at = wb->prep_write(th_write_size, th_write_buf);
         } catch (...) {
           oem.capture_exception();
         }
       }
+      dt::progress::add_done(row1 - row0);
+      if (omp_get_thread_num() == 0) dt::progress::update();
     }
     try {
       if (th_write_size && !oem.exception_caught()) {
-        wb->write_at(th_write_at, th_write_size, thbuf);
+        wb->write_at(th_write_at, th_write_size, th_write_buf);
       }
       free(thbuf);
     } catch (...) {
@@ -486,10 +665,16 @@ size_t CsvWriter::estimate_output_size()
 
 
 /**
- * Create the target memory region (either in RAM, or on disk).
+ * Create the target memory region (either in RAM, or on disk). In append
+ * mode the existing file is kept, and writing continues from its end.
  */
 void CsvWriter::create_target(size_t size) {
-  wb = WritableBuffer::create_target(path, size, strategy);
+  if (append) {
+    wb = std::unique_ptr<WritableBuffer>(
+             new FileWritableBuffer(path, File::asize(path)));
+  } else {
+    wb = WritableBuffer::create_target(path, size, strategy);
+  }
   t_create_target = checkpoint();
 }
 
@@ -516,8 +701,16 @@ void CsvWriter::write_column_names()
     // Replace the last ',' with a newline. This is valid since `ncolnames > 0`.
     ch[-1] = '\n';
 
-    // Write this string buffer into the target.
-    wb->write(static_cast<size_t>(ch - ch0), ch0);
+    // Write this string buffer into the target (as its own gzip member if
+    // the output is compressed).
+    size_t size = static_cast<size_t>(ch - ch0);
+    if (compress) {
+      std::vector<char> zbuf;
+      size_t zsize = compress_chunk(ch0, size, zbuf);
+      wb->write(zsize, zbuf.data());
+    } else {
+      wb->write(size, ch0);
+    }
     delete[] ch0;
   }
 }
@@ -621,4 +814,10 @@ void init_csvwrite_constants() {
   writers_per_stype[int(SType::FLOAT64)] = write_f8_dec;
   writers_per_stype[int(SType::STR32)]   = write_str<uint32_t>;
   writers_per_stype[int(SType::STR64)]   = write_str<uint64_t>;
+
+  for (size_t i = 0; i < DT_STYPES_COUNT; i++) {
+    writers_clean_per_stype[i] = nullptr;
+  }
+  writers_clean_per_stype[int(SType::STR32)] = write_str_clean<uint32_t>;
+  writers_clean_per_stype[int(SType::STR64)] = write_str_clean<uint64_t>;
 }
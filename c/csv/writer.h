@@ -28,7 +28,8 @@ class CsvWriter {
   WritableBuffer::Strategy strategy;
   bool usehex;
   bool verbose;
-  int : 8;
+  bool compress;
+  bool append;
 
   // Intermediate values used while writing the file
   std::unique_ptr<WritableBuffer> wb;
@@ -54,6 +55,8 @@ public:
   void set_nthreads(int n) { nthreads = n; }
   void set_usehex(bool v) { usehex = v; }
   void set_verbose(bool v) { verbose = v; }
+  void set_compress(bool v) { compress = v; }
+  void set_append(bool v) { append = v; }
   void set_strategy(WritableBuffer::Strategy s) { strategy = s; }
   void set_column_names(std::vector<std::string>& names) {
     column_names = std::move(names);
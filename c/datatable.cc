@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #include "datatable.h"
 #include <stdlib.h>
+#include "options.h"
 #include "utils/omp.h"
 #include "py_utils.h"
 #include "rowindex.h"
@@ -50,7 +51,7 @@ DataTable::DataTable(Column** cols)
     ncols(0),
     nkeys(0),
     columns(cols),
-    py_inames(nullptr)
+    ninfo(std::make_shared<NamesInfo>())
 {
   if (cols == nullptr) {
     throw ValueError() << "Column array cannot be null";
@@ -116,6 +117,7 @@ DataTable* DataTable::copy() const {
 DataTable* DataTable::delete_columns(int *cols_to_remove, int64_t n)
 {
   if (n == 0) return this;
+  invalidate_sort_cache();
   qsort(cols_to_remove, static_cast<size_t>(n), sizeof(int), _compare_ints);
   int j = 0;
   int next_col_to_remove = cols_to_remove[0];
@@ -142,6 +144,7 @@ DataTable* DataTable::delete_columns(int *cols_to_remove, int64_t n)
 
 
 void DataTable::resize_rows(int64_t new_nrows) {
+  invalidate_sort_cache();
   if (rowindex) {
     if (new_nrows < nrows) {
       rowindex.shrink(new_nrows, ncols);
@@ -165,10 +168,12 @@ void DataTable::resize_rows(int64_t new_nrows) {
 
 void DataTable::replace_rowindex(const RowIndex& newri) {
   if (newri.isabsent() && rowindex.isabsent()) return;
+  invalidate_sort_cache();
   rowindex = newri;
   nrows = rowindex.length();
   for (int64_t i = 0; i < ncols; ++i) {
     columns[i]->replace_rowindex(rowindex);
+    columns[i]->reify_async();
   }
 }
 
@@ -230,8 +235,15 @@ static inline int _compare_ints(const void *a, const void *b) {
  */
 void DataTable::reify() {
   if (rowindex.isabsent()) return;
+  invalidate_sort_cache();
   for (int64_t i = 0; i < ncols; ++i) {
     columns[i]->reify();
+    // A filtered str64 column may now fit within 32-bit offsets
+    Column* compacted = columns[i]->compact();
+    if (compacted != columns[i]) {
+      delete columns[i];
+      columns[i] = compacted;
+    }
   }
   rowindex.clear();
 }
@@ -255,6 +267,37 @@ size_t DataTable::memory_footprint()
 }
 
 
+void DataTable::release_memory() const
+{
+  for (int64_t i = 0; i < ncols; ++i) {
+    columns[i]->memory_advise(MmmAdvice::DontNeed);
+  }
+}
+
+
+void DataTable::reserve(int64_t new_nrows)
+{
+  if (new_nrows <= nrows) return;
+  for (int64_t i = 0; i < ncols; ++i) {
+    columns[i]->reserve_rows(new_nrows);
+  }
+}
+
+
+uint64_t DataTable::cache_version() const
+{
+  // Polynomial fold of the columns' mutation ids: since mutation ids are
+  // globally unique, any data change, column addition/removal, or reorder
+  // changes the result.
+  uint64_t h = static_cast<uint64_t>(nrows);
+  h = h * 1000003u + static_cast<uint64_t>(ncols);
+  for (int64_t i = 0; i < ncols; ++i) {
+    h = h * 1000003u + columns[i]->mutation_id();
+  }
+  return h;
+}
+
+
 
 //------------------------------------------------------------------------------
 // Compute stats
@@ -262,12 +305,40 @@ size_t DataTable::memory_footprint()
 
 DataTable* DataTable::_statdt(colmakerfn f) const {
   Column** out_cols = new Column*[ncols + 1];
+  for (int64_t i = 0; i <= ncols; ++i) out_cols[i] = nullptr;
+
+  // Each column's stats are independent, so on a wide frame the columns
+  // themselves become the parallel tasks. On a skinny frame (fewer columns
+  // than threads) stay serial here instead: each column's own stat scan is
+  // parallel and will use the full thread pool by itself. Python columns
+  // must be processed from the master thread only.
+  bool has_obj_columns = false;
+  for (int64_t i = 0; i < ncols; ++i) {
+    has_obj_columns |= (columns[i]->stype() == SType::OBJ);
+  }
+  bool go_wide = !has_obj_columns && ncols >= omp_get_max_threads();
+
+  OmpExceptionManager oem;
+  config::thread_grant tgrant;
+  #pragma omp parallel for schedule(dynamic) if (go_wide) \
+          num_threads(tgrant.nthreads())
   for (int64_t i = 0; i < ncols; ++i) {
-    out_cols[i] = (columns[i]->*f)();
+    if (oem.stop_requested()) continue;
+    try {
+      out_cols[i] = (columns[i]->*f)();
+    } catch (...) {
+      oem.capture_exception();
+      oem.stop_iterations();
+    }
   }
-  out_cols[ncols] = nullptr;
+  if (oem.exception_caught()) {
+    for (int64_t i = 0; i < ncols; ++i) delete out_cols[i];
+    delete[] out_cols;
+    oem.rethrow_exception_if_any();
+  }
+
   DataTable* res = new DataTable(out_cols);
-  res->names = names;
+  res->ninfo = ninfo;
   return res;
 }
 
@@ -284,6 +355,94 @@ DataTable* DataTable::mode_datatable() const    { return _statdt(&Column::mode_c
 DataTable* DataTable::sum_datatable() const     { return _statdt(&Column::sum_column); }
 
 
+DataTable* DataTable::groupwise_statdt(colmakerfn f, const Groupby& grpby,
+                                       const RowIndex& sortri) const
+{
+  auto ng = static_cast<int64_t>(grpby.ngroups());
+  const int32_t* goffs = grpby.offsets_r();
+
+  Column** out_cols = new Column*[ncols + 1];
+  for (int64_t i = 0; i <= ncols; ++i) out_cols[i] = nullptr;
+
+  OmpExceptionManager oem;
+  for (int64_t j = 0; j < ncols; ++j) {
+    const Column* col0 = columns[j];
+
+    if (ng == 0) {
+      // No groups: emit a 0-row column of the stat's stype by computing it
+      // over an empty view and then discarding the single resulting row.
+      Column* subcol = col0->shallowcopy();
+      subcol->replace_rowindex(RowIndex::from_slice(0, 0, 1));
+      Column* stat1 = (subcol->*f)();
+      delete subcol;
+      stat1->replace_rowindex(RowIndex::from_slice(0, 0, 1));
+      out_cols[j] = stat1;
+      continue;
+    }
+
+    // Build the per-group views serially: shallow copies bump the shared
+    // buffer's refcount, which is not thread-safe. The rowindex of each
+    // view is the group's slice of the sorted order, mapped back to the
+    // source rows.
+    std::vector<Column*> subcols(static_cast<size_t>(ng), nullptr);
+    std::vector<Column*> gcols(static_cast<size_t>(ng), nullptr);
+    for (int64_t g = 0; g < ng; ++g) {
+      int64_t off0 = goffs[g];
+      RowIndex gri = RowIndex::from_slice(off0, goffs[g + 1] - off0, 1);
+      if (sortri) gri = gri.uplift(sortri);
+      if (col0->rowindex()) gri = gri.uplift(col0->rowindex());
+      Column* subcol = col0->shallowcopy();
+      subcol->replace_rowindex(gri);
+      subcols[static_cast<size_t>(g)] = subcol;
+    }
+
+    // The groups are independent, so they become the parallel tasks. The
+    // stat scan within each group stays effectively serial (nested OpenMP
+    // regions do not spawn threads). Python columns must be processed from
+    // the master thread only.
+    bool go_parallel = (col0->stype() != SType::OBJ) && ng > 1;
+    config::thread_grant tgrant;
+    #pragma omp parallel for schedule(dynamic) if (go_parallel) \
+            num_threads(tgrant.nthreads())
+    for (int64_t g = 0; g < ng; ++g) {
+      if (oem.stop_requested()) continue;
+      try {
+        gcols[static_cast<size_t>(g)] = (subcols[static_cast<size_t>(g)]->*f)();
+      } catch (...) {
+        oem.capture_exception();
+        oem.stop_iterations();
+      }
+    }
+    for (Column* subcol : subcols) delete subcol;
+    if (oem.exception_caught()) {
+      for (Column* gcol : gcols) delete gcol;
+      break;
+    }
+
+    // Stitch the per-group 1-row results into the output column. Note
+    // that `Column::rbind` consumes its arguments (the appended columns
+    // are deleted inside `rbind_impl`), and deletes `this` as well when
+    // type promotion replaces it.
+    Column* res = gcols[0];
+    if (ng > 1) {
+      std::vector<const Column*> rest(gcols.begin() + 1, gcols.end());
+      res = res->rbind(rest);
+    }
+    out_cols[j] = res;
+  }
+
+  if (oem.exception_caught()) {
+    for (int64_t i = 0; i < ncols; ++i) delete out_cols[i];
+    delete[] out_cols;
+    oem.rethrow_exception_if_any();
+  }
+
+  DataTable* res = new DataTable(out_cols);
+  res->ninfo = ninfo;
+  return res;
+}
+
+
 
 
 /**
@@ -360,6 +519,7 @@ void DataTable::verify_integrity() const {
         << "Last entry in the `columns` array of Frame is not null";
   }
 
+  const std::vector<std::string>& names = ninfo->names;
   if (names.size() != static_cast<size_t>(ncols)) {
     throw AssertionError()
         << "Number of column names, " << names.size() << ", is not equal "
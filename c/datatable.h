@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 #ifndef dt_DATATABLE_h
 #define dt_DATATABLE_h
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include "python/dict.h"
@@ -63,9 +65,50 @@ class DataTable {
     Column** columns;
 
   private:
-    std::vector<std::string> names;
-    mutable py::otuple py_names;   // memoized tuple of column names
-    mutable py::odict  py_inames;  // memoized dict of {column name: index}
+    /**
+     * Shared holder for the column names and the lookup structures memoized
+     * from them. Shallow copies of a DataTable share a single instance
+     * (extending the copy-on-write discipline used for `MemoryRange`s), and
+     * a fresh instance is installed only when a Frame actually changes its
+     * names. The `version` tag is unique per instance, so caches keyed on
+     * it can detect renames without comparing the name lists.
+     */
+    struct NamesInfo {
+      std::vector<std::string> names;
+      py::otuple py_names;   // memoized tuple of column names
+      py::odict  py_inames;  // memoized dict of {column name: index}
+      std::unordered_map<std::string, size_t> name_index;
+                             // memoized native {column name: index} map
+      uint64_t version;
+
+      NamesInfo();
+      NamesInfo(const NamesInfo&) = delete;
+    };
+    std::shared_ptr<NamesInfo> ninfo;
+
+    // Memoized results of single-column `sortby()` calls, keyed by the
+    // column's index. Invalidated by any operation that changes the frame's
+    // rows or column layout (see `invalidate_sort_cache()`). The cache is
+    // bounded: when a new column's result would exceed `SORT_CACHE_MAXSIZE`
+    // entries, the least recently used one is evicted.
+    static constexpr size_t SORT_CACHE_MAXSIZE = 8;
+    struct SortCacheEntry {
+      RowIndex rowindex;
+      Groupby  groupby;
+      // Mutation id of the column at the time the entry was stored: in-place
+      // value replacement does not go through `invalidate_sort_cache()`, so
+      // the lookup re-validates the entry against the column's current id.
+      uint64_t mutid;
+      uint64_t last_used;
+      bool     has_groups;
+      int64_t : 56;
+    };
+    mutable std::unordered_map<int32_t, SortCacheEntry> sort_cache;
+    mutable uint64_t sort_cache_clock = 0;
+    // Serializes all access to `sort_cache` / `sort_cache_clock`: `sortby()`
+    // runs with the GIL released, so two Python threads may probe the cache
+    // of the same frame concurrently.
+    mutable std::mutex sort_cache_mutex;
 
   public:
     DataTable(Column** cols, std::nullptr_t);
@@ -80,9 +123,42 @@ class DataTable {
     void reify();
     void rbind(DataTable**, int**, int64_t, int64_t);
     DataTable* cbind(DataTable**, int64_t);
+    DataTable* melt(int64_t nid) const;
+    DataTable* pivot() const;
+    DataTable* cross_join(const DataTable* other) const;
     DataTable* copy() const;
+
+    /**
+     * Merge frames that are each already sorted by column `keycol` into a
+     * single frame sorted by that column, using a k-way merge instead of a
+     * full re-sort. Throws ValueError if any input is not sorted. Defined
+     * in sort.cc.
+     */
+    static DataTable* merge_sorted(const std::vector<DataTable*>& parts,
+                                   int64_t keycol);
     size_t memory_footprint();
 
+    /**
+     * Release as much of this frame's resident memory as possible without
+     * losing data: advises the kernel (MADV_DONTNEED) that the pages of all
+     * memory-mapped column buffers may be reclaimed. Intended for pipeline
+     * orchestration: call it when a stage is done with a frame, so that its
+     * pages do not push the next stage's data out of RAM. The frame remains
+     * fully usable afterwards; evicted pages are simply re-read from disk
+     * on next access.
+     */
+    void release_memory() const;
+
+    /**
+     * Preallocate enough buffer capacity in every column to hold `nrows`
+     * rows, without changing the frame's current row count. A subsequent
+     * sequence of rbinds that stays within the reserved capacity appends
+     * in-place instead of reallocating, so `n` micro-appends cost O(n)
+     * amortized instead of O(n^2). A no-op if `nrows` does not exceed the
+     * current row count.
+     */
+    void reserve(int64_t nrows);
+
     /**
      * Sort the DataTable by specified columns, and return the corresponding
      * RowIndex. The array `colindices` provides the indices of columns to
@@ -92,11 +168,39 @@ class DataTable {
      * If `make_groups` is true, then in addition to sorting, the grouping
      * information will be computed and stored with the RowIndex.
      */
-    RowIndex sortby(const arr32_t& colindices, Groupby* out_grps) const;
+    RowIndex sortby(const arr32_t& colindices, Groupby* out_grps,
+                    bool case_fold = false) const;
+
+    /**
+     * Return a RowIndex selecting the first occurrence of every distinct
+     * row of the frame, in the original row order. The rows are compared
+     * by value across all columns; the operation is hash-based (one
+     * parallel hashing sweep plus an insert per row) and does not sort.
+     */
+    RowIndex unique_rowindex();
+
+    /**
+     * Drop all memoized sort indices. Must be called by any operation that
+     * mutates the frame's data, rows, or column layout.
+     */
+    void invalidate_sort_cache() const {
+      std::lock_guard<std::mutex> lock(sort_cache_mutex);
+      sort_cache.clear();
+    }
+
+    /**
+     * Version stamp of the frame's current content, folding the mutation ids
+     * of all columns (in order) together with the frame's shape. Any change
+     * to the data, to the set of columns, or to their order produces a new
+     * value, so the stamp can be used to key caches of derived results.
+     */
+    uint64_t cache_version() const;
 
     const std::vector<std::string>& get_names() const;
     py::otuple get_pynames() const;
+    uint64_t names_version() const;
     int64_t colindex(const py::_obj& pyname) const;
+    int64_t colindex(const std::string& name) const;
     void copy_names_from(const DataTable* other);
     void set_names_to_default();
     void set_names(const py::olist& names_list);
@@ -117,6 +221,17 @@ class DataTable {
     DataTable* nunique_datatable() const;
     DataTable* nmodal_datatable() const;
 
+    /**
+     * Compute the statistic produced by the column-maker `f` (one of the
+     * `Column::*_column` methods) separately within each group of `grpby`,
+     * for every column of this DataTable. `sortri` must be the RowIndex
+     * produced by the sort that created the Groupby, or an empty RowIndex
+     * if the frame is already laid out in group order. Returns a new Frame
+     * with one row per group; the groups are processed in parallel.
+     */
+    DataTable* groupwise_statdt(colmakerfn f, const Groupby& grpby,
+                                const RowIndex& sortri) const;
+
     void verify_integrity() const;
 
     static DataTable* load(DataTable* schema, int64_t nrows,
@@ -124,12 +239,37 @@ class DataTable {
 
     void save_jay(const std::string& path,
                   const std::vector<std::string>& colnames,
-                  WritableBuffer::Strategy wstrategy);
+                  WritableBuffer::Strategy wstrategy,
+                  bool compress = false,
+                  size_t rowgroup_size = 0);
+    void save_jay_append(const std::string& path,
+                         const std::vector<std::string>& colnames);
+    MemoryRange save_jay_memory(const std::vector<std::string>& colnames);
+    void save_jay_shmem(const std::string& name,
+                        const std::vector<std::string>& colnames);
     static DataTable* open_jay(const std::string& path);
+    static DataTable* open_jay(const std::string& path,
+                               const std::string& filter_column,
+                               double filter_min, double filter_max);
+    static DataTable* open_jay_buffer(MemoryRange&& mbuf);
+    static DataTable* open_jay_shmem(const std::string& name);
+
+    void save_feather(const std::string& path,
+                      const std::vector<std::string>& colnames,
+                      WritableBuffer::Strategy wstrategy);
+    static DataTable* open_feather(const std::string& path);
 
   private:
     DataTable(Column**);
+    void save_jay_impl(std::unique_ptr<WritableBuffer>& wb,
+                       const std::vector<std::string>& colnames,
+                       bool compress, size_t rowgroup_size);
+    static DataTable* open_jay_impl(MemoryRange&& mbuf,
+                                    const std::string& source,
+                                    const std::string& filter_column,
+                                    double filter_min, double filter_max);
     void _init_pynames() const;
+    void _init_name_index() const;
     void _set_names_impl(NameProvider*);
     void _integrity_check_names() const;
     void _integrity_check_pynames() const;
@@ -37,7 +37,7 @@ DataTable* DataTable::cbind(DataTable **dts, int64_t ndts)
   }
 
   // Append columns from `dts` into the "main" datatable
-  std::vector<std::string> newnames = names;
+  std::vector<std::string> newnames = ninfo->names;
   columns = dt::arealloc(columns, t_ncols + 1);
   columns[t_ncols] = nullptr;
   int64_t j = ncols;
@@ -50,7 +50,7 @@ DataTable* DataTable::cbind(DataTable **dts, int64_t ndts)
       if (nrowsi < t_nrows) c->resize_and_fill(t_nrows);
       columns[j++] = c;
     }
-    const auto& namesi = dts[i]->names;
+    const auto& namesi = dts[i]->ninfo->names;
     xassert(namesi.size() == static_cast<size_t>(ncolsi));
     newnames.insert(newnames.end(), namesi.begin(), namesi.end());
   }
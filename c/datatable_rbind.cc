@@ -10,6 +10,8 @@
 #include "column.h"
 #include "utils.h"
 #include "utils/assert.h"
+#include "utils/exceptions.h"  // OmpExceptionManager
+#include "utils/omp.h"
 
 
 
@@ -32,6 +34,7 @@ void DataTable::rbind(
 
   // If this is a view datatable, then it must be materialized.
   this->reify();
+  int64_t old_nrows = nrows;
 
   columns = dt::arealloc<Column*>(columns, new_ncols + 1);
   for (int64_t i = ncols; i < new_ncols; ++i) {
@@ -44,18 +47,96 @@ void DataTable::rbind(
     new_nrows += dts[i]->nrows;
   }
 
+  // Snapshot the columns to append for every output column up front. This
+  // also determines whether any column involved holds Python objects:
+  // those cannot be processed off the main thread.
   size_t undts = static_cast<size_t>(ndts);
-  std::vector<const Column*> cols_to_append(undts);
+  std::vector<std::vector<const Column*>> plan(static_cast<size_t>(new_ncols));
+  bool has_obj_columns = false;
   for (int64_t i = 0; i < new_ncols; ++i) {
+    std::vector<const Column*>& cols_to_append = plan[static_cast<size_t>(i)];
+    cols_to_append.resize(undts);
+    has_obj_columns |= (columns[i]->stype() == SType::OBJ);
     for (size_t j = 0; j < undts; ++j) {
       int k = cols[i][j];
       Column* col = k < 0 ? new VoidColumn(dts[j]->nrows)
                           : dts[j]->columns[k]->shallowcopy();
-      col->reify();
       cols_to_append[j] = col;
+      has_obj_columns |= (col->stype() == SType::OBJ);
     }
-    columns[i] = columns[i]->rbind(cols_to_append);
   }
+
+  // Append the columns, each one independently of the others. Appending a
+  // column is memcpy/cast work (see e.g. rbind_impl in "column_fw.cc"), so
+  // wide-frame concatenation scales with the number of cores.
+  OmpExceptionManager oem;
+  #pragma omp parallel for schedule(dynamic) if (!has_obj_columns)
+  for (int64_t i = 0; i < new_ncols; ++i) {
+    if (oem.stop_requested()) continue;
+    try {
+      std::vector<const Column*>& cols_to_append = plan[static_cast<size_t>(i)];
+      for (const Column* col : cols_to_append) {
+        const_cast<Column*>(col)->reify();
+      }
+      columns[i] = columns[i]->rbind(cols_to_append);
+    } catch (...) {
+      oem.capture_exception();
+      oem.stop_iterations();
+    }
+  }
+  oem.rethrow_exception_if_any();
   ncols = new_ncols;
   nrows = new_nrows;
+
+  // If the frame is keyed, restore the key invariant (physically sorted by
+  // the key column, all values unique) incrementally: sort only the
+  // appended tail and merge it into the existing order, instead of
+  // re-sorting the whole frame. Before the merge the first `old_nrows`
+  // rows are still key-sorted and unique, i.e. every row is its own group.
+  if (nkeys > 0 && nrows > old_nrows) {
+    int64_t nk = nkeys;
+    nkeys = 0;  // dropped if re-keying fails below
+    size_t zold = static_cast<size_t>(old_nrows);
+    MemoryRange offs_mr = MemoryRange::mem((zold + 1) * sizeof(int32_t));
+    int32_t* offs = static_cast<int32_t*>(offs_mr.wptr());
+    for (size_t i = 0; i <= zold; ++i) {
+      offs[i] = static_cast<int32_t>(i);
+    }
+    Groupby old_grps(zold, std::move(offs_mr));
+    Groupby new_grps;
+    RowIndex new_ri = columns[0]->sort_incremental(
+        old_nrows, RowIndex(), old_grps, &new_grps);
+    if (new_grps.ngroups() != static_cast<size_t>(nrows)) {
+      throw ValueError() << "Cannot rbind to a keyed frame: the appended "
+          "rows contain duplicate keys. The data was appended, but the "
+          "frame's key was removed";
+    }
+    replace_rowindex(new_ri);
+    reify();
+    nkeys = nk;
+    return;  // replace_rowindex has invalidated the sort cache
+  }
+
+  // Refresh the memoized sort results incrementally: sort only the appended
+  // tail of each cached column and merge it into the previous ordering,
+  // which is far cheaper than re-sorting the whole history on the next
+  // groupby. Entries without group information, or whose column type the
+  // merge does not support, are simply dropped.
+  for (auto it = sort_cache.begin(); it != sort_cache.end();) {
+    SortCacheEntry& entry = it->second;
+    bool refreshed = entry.has_groups;
+    if (refreshed) {
+      try {
+        Groupby new_grps;
+        RowIndex new_ri = columns[it->first]->sort_incremental(
+            old_nrows, entry.rowindex, entry.groupby, &new_grps);
+        entry.rowindex = new_ri;
+        entry.groupby = new_grps;
+      } catch (const std::exception&) {
+        refreshed = false;
+      }
+    }
+    if (refreshed) ++it;
+    else it = sort_cache.erase(it);
+  }
 }
@@ -0,0 +1,400 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include "datatable.h"
+#include <cstring>
+#include <vector>
+#include "column.h"
+#include "memrange.h"
+#include "options.h"
+#include "rowindex.h"
+#include "types.h"
+#include "utils/alloc.h"
+#include "utils/assert.h"
+#include "utils/exceptions.h"
+#include "utils/omp.h"
+
+
+
+//==============================================================================
+// Helpers
+//==============================================================================
+
+/**
+ * Read the fixed-width numeric column `col` (which must be materialized) as
+ * doubles into `out[0 .. nrows)`. NA values become NA doubles.
+ */
+template <typename T>
+static void gather_as_double(const Column* col, double* out, int64_t nrows) {
+  auto d = static_cast<const T*>(col->data());
+  for (int64_t i = 0; i < nrows; ++i) {
+    out[i] = ISNA<T>(d[i]) ? GETNA<double>() : static_cast<double>(d[i]);
+  }
+}
+
+static void gather_column_as_double(const Column* col, double* out,
+                                    int64_t nrows) {
+  switch (col->stype()) {
+    case SType::BOOL:
+    case SType::INT8:    gather_as_double<int8_t>(col, out, nrows); break;
+    case SType::INT16:   gather_as_double<int16_t>(col, out, nrows); break;
+    case SType::INT32:   gather_as_double<int32_t>(col, out, nrows); break;
+    case SType::INT64:   gather_as_double<int64_t>(col, out, nrows); break;
+    case SType::FLOAT32: gather_as_double<float>(col, out, nrows); break;
+    case SType::FLOAT64: std::memcpy(out, col->data(),
+                             static_cast<size_t>(nrows) * sizeof(double));
+                         break;
+    default: xassert(false);  // guarded by the caller
+  }
+}
+
+
+/**
+ * Build a string column of `nblocks * blockrows` rows where all rows of
+ * block `j` hold `names[j]`. The NFF string format stores each row's
+ * characters separately, so the names are physically repeated; the strbuf
+ * is sized exactly and filled in parallel over blocks.
+ */
+template <typename T>
+static Column* make_block_string_column(const std::vector<std::string>& names,
+                                        int64_t blockrows) {
+  int64_t nblocks = static_cast<int64_t>(names.size());
+  int64_t outrows = nblocks * blockrows;
+  size_t total_chars = 0;
+  std::vector<size_t> block_starts(names.size());
+  for (size_t j = 0; j < names.size(); ++j) {
+    block_starts[j] = total_chars;
+    total_chars += names[j].size() * static_cast<size_t>(blockrows);
+  }
+
+  MemoryRange offbuf = MemoryRange::mem(
+      (static_cast<size_t>(outrows) + 1) * sizeof(T));
+  MemoryRange strbuf = MemoryRange::mem(total_chars);
+  T* offs = static_cast<T*>(offbuf.wptr()) + 1;
+  offs[-1] = 0;
+  char* strs = static_cast<char*>(strbuf.wptr());
+
+  config::thread_grant tgrant;
+  #pragma omp parallel for schedule(dynamic) num_threads(tgrant.nthreads())
+  for (int64_t j = 0; j < nblocks; ++j) {
+    const std::string& name = names[static_cast<size_t>(j)];
+    size_t len = name.size();
+    size_t pos = block_starts[static_cast<size_t>(j)];
+    T* boffs = offs + j * blockrows;
+    char* bstrs = strs + pos;
+    for (int64_t i = 0; i < blockrows; ++i) {
+      std::memcpy(bstrs + static_cast<size_t>(i) * len, name.data(), len);
+      boffs[i] = static_cast<T>(pos + static_cast<size_t>(i + 1) * len);
+    }
+  }
+
+  return new StringColumn<T>(outrows, std::move(offbuf), std::move(strbuf));
+}
+
+
+static bool is_numeric(SType st) {
+  LType lt = info(st).ltype();
+  return lt == LType::BOOL || lt == LType::INT || lt == LType::REAL;
+}
+
+
+
+//==============================================================================
+// Melt (wide to long)
+//==============================================================================
+
+/**
+ * Reshape the frame from wide to long format. The first `nid` columns are
+ * treated as identifier columns and are carried over (repeated once per
+ * value column); the remaining columns must be numeric and are stacked into
+ * a single float64 `value` column, with a string `variable` column naming
+ * the source column of each row. The output has `nrows * (ncols - nid)`
+ * rows, laid out as one block of `nrows` rows per value column, in column
+ * order. All output buffers are sized up front and filled in parallel.
+ */
+DataTable* DataTable::melt(int64_t nid) const {
+  if (nid < 0 || nid >= ncols) {
+    throw ValueError() << "Invalid number of id columns " << nid
+                       << " for a frame with " << ncols << " columns";
+  }
+  int64_t nvars = ncols - nid;
+  for (int64_t j = nid; j < ncols; ++j) {
+    if (!is_numeric(columns[j]->stype())) {
+      throw TypeError() << "Column " << j << " of type `"
+          << info(columns[j]->stype()).name() << "` cannot be melted: all "
+             "value columns must be numeric";
+    }
+  }
+  int64_t outrows = nrows * nvars;
+  const std::vector<std::string>& names = get_names();
+
+  // Materialize the value columns up-front (a no-op for non-views), so the
+  // parallel gather below reads plain buffers.
+  std::vector<Column*> vcols;
+  vcols.reserve(static_cast<size_t>(nvars));
+  for (int64_t j = nid; j < ncols; ++j) {
+    Column* c = columns[j]->shallowcopy();
+    c->reify();
+    vcols.push_back(c);
+  }
+
+  MemoryRange valbuf = MemoryRange::mem(
+      static_cast<size_t>(outrows) * sizeof(double));
+  auto valptr = static_cast<double*>(valbuf.wptr());
+  {
+    config::thread_grant tgrant;
+    #pragma omp parallel for schedule(dynamic) num_threads(tgrant.nthreads())
+    for (int64_t j = 0; j < nvars; ++j) {
+      gather_column_as_double(vcols[static_cast<size_t>(j)],
+                              valptr + j * nrows, nrows);
+    }
+  }
+  for (Column* c : vcols) delete c;
+
+  std::vector<std::string> varnames(names.begin() + nid, names.end());
+  size_t var_chars = 0;
+  for (const std::string& s : varnames) {
+    var_chars += s.size() * static_cast<size_t>(nrows);
+  }
+  Column* varcol = (var_chars <= 0x7FFFFFFF)
+      ? make_block_string_column<uint32_t>(varnames, nrows)
+      : make_block_string_column<uint64_t>(varnames, nrows);
+
+  // Each id column is the original column tiled `nvars` times over, via a
+  // virtual repeat rowindex (no data or index duplication).
+  RowIndex repeat_ri = nrows? RowIndex::from_repeat(nrows, 1, outrows)
+                            : RowIndex();
+
+  Column** outcols = dt::amalloc<Column*>(nid + 3);
+  std::vector<std::string> outnames;
+  for (int64_t j = 0; j < nid; ++j) {
+    Column* c = columns[j]->shallowcopy();
+    c->reify();
+    outcols[j] = c->shallowcopy(repeat_ri);
+    delete c;
+    outnames.push_back(names[static_cast<size_t>(j)]);
+  }
+  outcols[nid] = varcol;
+  outcols[nid + 1] = Column::new_mbuf_column(SType::FLOAT64,
+                                             std::move(valbuf));
+  outcols[nid + 2] = nullptr;
+  outnames.push_back("variable");
+  outnames.push_back("value");
+  return new DataTable(outcols, outnames);
+}
+
+
+
+//==============================================================================
+// Pivot (long to wide)
+//==============================================================================
+
+/**
+ * Reshape the frame from long to wide format. The frame must have exactly
+ * three columns: an identifier column, a string `variable` column, and a
+ * numeric value column. The output has one row per distinct identifier
+ * (in sorted order) and one float64 column per distinct variable (named
+ * after it, in sorted order), preceded by the identifier column itself.
+ * Cells with no matching input row are NA; if several input rows map to the
+ * same cell, it is unspecified which one wins. Rows whose variable is NA
+ * are dropped. The output value columns share a single preallocated arena
+ * and are filled by a parallel scatter over the input rows.
+ */
+DataTable* DataTable::pivot() const {
+  if (ncols != 3) {
+    throw ValueError() << "pivot() requires a frame with exactly 3 columns "
+                          "(id, variable, value), got " << ncols;
+  }
+  SType vst = columns[1]->stype();
+  if (vst != SType::STR32 && vst != SType::STR64) {
+    throw TypeError() << "The variable column must be a string column, got `"
+                      << info(vst).name() << "`";
+  }
+  if (!is_numeric(columns[2]->stype())) {
+    throw TypeError() << "The value column must be numeric, got `"
+                      << info(columns[2]->stype()).name() << "`";
+  }
+
+  // Group the rows by identifier: group `g` becomes output row `g`.
+  arr32_t sortcols(1);
+  sortcols[0] = 0;
+  Groupby gb_id;
+  RowIndex ri_id = sortby(sortcols, &gb_id);
+  const int32_t* id_offsets = gb_id.offsets_r();
+  const arr32_t id_rows = ri_id.extract_as_array32();
+  int64_t nids = static_cast<int64_t>(gb_id.ngroups());
+
+  std::vector<int32_t> rowmap(static_cast<size_t>(nrows));
+  for (int64_t g = 0; g < nids; ++g) {
+    for (int32_t k = id_offsets[g]; k < id_offsets[g + 1]; ++k) {
+      rowmap[static_cast<size_t>(id_rows[static_cast<size_t>(k)])] =
+          static_cast<int32_t>(g);
+    }
+  }
+
+  // Group the rows by variable: group `v` becomes output column `v` (the NA
+  // group, if present, maps to -1 and its rows are dropped).
+  sortcols[0] = 1;
+  Groupby gb_var;
+  RowIndex ri_var = sortby(sortcols, &gb_var);
+  const int32_t* var_offsets = gb_var.offsets_r();
+  const arr32_t var_rows = ri_var.extract_as_array32();
+  int64_t ngroups_var = static_cast<int64_t>(gb_var.ngroups());
+
+  Column* strcol = columns[1]->shallowcopy();
+  strcol->reify();
+  std::vector<std::string> varnames;
+  std::vector<int32_t> colmap(static_cast<size_t>(nrows));
+  {
+    int32_t next_col = 0;
+    for (int64_t v = 0; v < ngroups_var; ++v) {
+      int32_t first = var_rows[static_cast<size_t>(var_offsets[v])];
+      bool isna;
+      std::string value;
+      if (strcol->stype() == SType::STR32) {
+        auto sc = static_cast<const StringColumn<uint32_t>*>(strcol);
+        uint32_t off = sc->offsets()[first];
+        isna = ISNA<uint32_t>(off);
+        if (!isna) {
+          uint32_t start = sc->offsets()[first - 1] & ~GETNA<uint32_t>();
+          value.assign(sc->strdata() + start, off - start);
+        }
+      } else {
+        auto sc = static_cast<const StringColumn<uint64_t>*>(strcol);
+        uint64_t off = sc->offsets()[first];
+        isna = ISNA<uint64_t>(off);
+        if (!isna) {
+          uint64_t start = sc->offsets()[first - 1] & ~GETNA<uint64_t>();
+          value.assign(sc->strdata() + start,
+                       static_cast<size_t>(off - start));
+        }
+      }
+      int32_t colid = isna ? -1 : next_col++;
+      if (!isna) varnames.push_back(value);
+      for (int32_t k = var_offsets[v]; k < var_offsets[v + 1]; ++k) {
+        colmap[static_cast<size_t>(var_rows[static_cast<size_t>(k)])] = colid;
+      }
+    }
+  }
+  delete strcol;
+  int64_t nvars = static_cast<int64_t>(varnames.size());
+
+  // Preallocate the wide table as one arena and scatter the values into it.
+  Column* valcol = columns[2]->shallowcopy();
+  valcol->reify();
+  std::vector<double> vals(static_cast<size_t>(nrows));
+  gather_column_as_double(valcol, vals.data(), nrows);
+  delete valcol;
+  MemoryRange arena = MemoryRange::mem(
+      static_cast<size_t>(nids * nvars) * sizeof(double));
+  auto arena_ptr = static_cast<double*>(arena.wptr());
+  {
+    config::thread_grant tgrant;
+    #pragma omp parallel num_threads(tgrant.nthreads())
+    {
+      #pragma omp for schedule(static)
+      for (int64_t i = 0; i < nids * nvars; ++i) {
+        arena_ptr[i] = GETNA<double>();
+      }
+      #pragma omp for schedule(static)
+      for (int64_t i = 0; i < nrows; ++i) {
+        int32_t c = colmap[static_cast<size_t>(i)];
+        if (c < 0) continue;
+        arena_ptr[c * nids + rowmap[static_cast<size_t>(i)]] =
+            vals[static_cast<size_t>(i)];
+      }
+    }
+  }
+
+  // The id column selects the first row of every id group, in group order.
+  arr32_t first_rows(static_cast<size_t>(nids));
+  for (int64_t g = 0; g < nids; ++g) {
+    first_rows[static_cast<size_t>(g)] =
+        id_rows[static_cast<size_t>(id_offsets[g])];
+  }
+  Column* idcol = columns[0]->shallowcopy();
+  idcol->reify();
+  Column* idview = idcol->shallowcopy(
+      RowIndex::from_array32(std::move(first_rows), false));
+  delete idcol;
+
+  Column** outcols = dt::amalloc<Column*>(nvars + 2);
+  outcols[0] = idview;
+  size_t colsize = static_cast<size_t>(nids) * sizeof(double);
+  for (int64_t v = 0; v < nvars; ++v) {
+    outcols[v + 1] = Column::new_mbuf_column(
+        SType::FLOAT64,
+        MemoryRange::view(arena, colsize, static_cast<size_t>(v) * colsize));
+  }
+  outcols[nvars + 1] = nullptr;
+
+  std::vector<std::string> outnames;
+  outnames.push_back(get_names()[0]);
+  for (const std::string& s : varnames) outnames.push_back(s);
+  return new DataTable(outcols, outnames);
+}
+
+
+
+//==============================================================================
+// Cross join
+//==============================================================================
+
+/**
+ * Cartesian product of this frame with `other`: every row of this frame is
+ * paired with every row of `other`, producing `nrows * other->nrows` rows.
+ * The pairing is expressed entirely through virtual repeat rowindices
+ * (left columns repeat each row `other->nrows` times in a row, right
+ * columns tile end-to-end), so no index arrays are ever materialized --
+ * the composition costs O(1) memory per column until the columns
+ * themselves are materialized.
+ */
+DataTable* DataTable::cross_join(const DataTable* other) const {
+  int64_t n1 = nrows;
+  int64_t n2 = other->nrows;
+  int64_t outrows = n1 * n2;
+
+  // An empty slice handles the degenerate case where either side has no
+  // rows (a repeat index requires a positive period).
+  RowIndex left_ri = outrows? RowIndex::from_repeat(n1, n2, outrows)
+                            : RowIndex::from_slice(0, 0, 1);
+  RowIndex right_ri = outrows? RowIndex::from_repeat(n2, 1, outrows)
+                             : RowIndex::from_slice(0, 0, 1);
+
+  Column** outcols = dt::amalloc<Column*>(ncols + other->ncols + 1);
+  int64_t k = 0;
+  for (int64_t i = 0; i < ncols; ++i) {
+    Column* c = columns[i];
+    if (c->rowindex().isabsent()) {
+      outcols[k++] = c->shallowcopy(left_ri);
+    } else {
+      // `shallowcopy(ri)` replaces rather than composes the rowindex, so a
+      // view column must be materialized before the repeat is applied.
+      Column* tmp = c->shallowcopy();
+      tmp->reify();
+      outcols[k++] = tmp->shallowcopy(left_ri);
+      delete tmp;
+    }
+  }
+  for (int64_t i = 0; i < other->ncols; ++i) {
+    Column* c = other->columns[i];
+    if (c->rowindex().isabsent()) {
+      outcols[k++] = c->shallowcopy(right_ri);
+    } else {
+      Column* tmp = c->shallowcopy();
+      tmp->reify();
+      outcols[k++] = tmp->shallowcopy(right_ri);
+      delete tmp;
+    }
+  }
+  outcols[k] = nullptr;
+
+  std::vector<std::string> outnames(get_names());
+  const std::vector<std::string>& names2 = other->get_names();
+  outnames.insert(outnames.end(), names2.begin(), names2.end());
+  return new DataTable(outcols, outnames);
+}
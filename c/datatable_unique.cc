@@ -0,0 +1,179 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+// This file implements the unique-rows (distinct) operation: return a
+// RowIndex selecting the first occurrence of every distinct row of the
+// frame, in the original row order. Unlike deduplication via a multi-key
+// sort, this is hash-based: every column contributes a per-row hash
+// (computed in parallel, reusing the string columns' cached row hashes),
+// the per-column hashes are folded into one 64-bit hash per row, and a
+// single pass over the combined hashes fills an open-addressing
+// first-occurrence set. Candidate matches are verified by comparing the
+// actual row values, so hash collisions never merge distinct rows. On a
+// mostly-unique frame the cost is one parallel hashing sweep plus an
+// insert per row, instead of a full sort of all the columns.
+//------------------------------------------------------------------------------
+#include "datatable.h"
+#include <cstring>    // std::memcmp, std::memcpy
+#include <limits>
+#include "column.h"
+#include "rowindex.h"
+#include "types.h"
+#include "utils/exceptions.h"
+#include "utils/omp.h"
+
+
+// Mix a 64-bit value into a well-distributed hash (splitmix64 finalizer).
+static inline uint64_t umix64(uint64_t x) {
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4B9F9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+
+// Fold the hash `ch` of one column's value into the row's combined hash.
+static inline uint64_t hash_combine(uint64_t h, uint64_t ch) {
+  return h ^ (ch + 0x9E3779B97F4A7C15ULL + (h << 12) + (h >> 4));
+}
+
+
+// Hash a fixed-width column element-wise into `hashes`. The raw bytes of
+// every element are hashed, so equality of hashes follows equality of the
+// stored values (the NA sentinel included).
+static void hash_fw_column(const Column* col, uint64_t* hashes, bool first)
+{
+  const uint8_t* data = static_cast<const uint8_t*>(col->data());
+  size_t esz = col->elemsize();
+  int64_t n = col->nrows;
+  #pragma omp parallel for schedule(static)
+  for (int64_t i = 0; i < n; ++i) {
+    uint64_t v = 0;
+    std::memcpy(&v, data + static_cast<size_t>(i) * esz, esz);
+    uint64_t h = umix64(v);
+    hashes[i] = first? h : hash_combine(hashes[i], h);
+  }
+}
+
+
+// Compare one element of a string column between rows `i` and `j`.
+template <typename T>
+static bool str_elems_equal(const Column* col, int64_t i, int64_t j)
+{
+  auto scol = static_cast<const StringColumn<T>*>(col);
+  const T* offs = scol->offsets();
+  const char* strs = scol->strdata();
+  T iend = offs[i];
+  T jend = offs[j];
+  bool ina = ISNA<T>(iend);
+  bool jna = ISNA<T>(jend);
+  if (ina || jna) return ina && jna;
+  T istart = offs[i - 1] & ~GETNA<T>();
+  T jstart = offs[j - 1] & ~GETNA<T>();
+  if (iend - istart != jend - jstart) return false;
+  return std::memcmp(strs + istart, strs + jstart,
+                     static_cast<size_t>(iend - istart)) == 0;
+}
+
+
+// Full-row equality check, used to confirm candidate matches found by the
+// hash probe. Only runs on hash collisions, so the per-call stype switch
+// is not on the hot path.
+static bool rows_equal(const DataTable* dt, int64_t i, int64_t j)
+{
+  for (int64_t c = 0; c < dt->ncols; ++c) {
+    const Column* col = dt->columns[c];
+    switch (col->stype()) {
+      case SType::STR32:
+        if (!str_elems_equal<uint32_t>(col, i, j)) return false;
+        break;
+      case SType::STR64:
+        if (!str_elems_equal<uint64_t>(col, i, j)) return false;
+        break;
+      default: {
+        size_t esz = col->elemsize();
+        const uint8_t* data = static_cast<const uint8_t*>(col->data());
+        if (std::memcmp(data + static_cast<size_t>(i) * esz,
+                        data + static_cast<size_t>(j) * esz, esz) != 0)
+          return false;
+        break;
+      }
+    }
+  }
+  return true;
+}
+
+
+RowIndex DataTable::unique_rowindex()
+{
+  if (nrows <= 1 || ncols == 0) {
+    return RowIndex::from_slice(0, nrows, 1);
+  }
+  if (nrows > std::numeric_limits<int32_t>::max()) {
+    throw NotImplError() << "unique() cannot be applied to a Frame with "
+        << nrows << " rows";
+  }
+  for (int64_t c = 0; c < ncols; ++c) {
+    if (columns[c]->stype() == SType::OBJ) {
+      throw TypeError() << "unique() cannot be applied to a Frame with a "
+          "column of stype " << SType::OBJ;
+    }
+  }
+  reify();
+  int64_t n = nrows;
+
+  // Combined per-row hashes, one column at a time. Each column's pass is
+  // parallel; string columns reuse their cached per-row hashes.
+  dt::array<uint64_t> hashes(static_cast<size_t>(n));
+  uint64_t* hp = hashes.data();
+  for (int64_t c = 0; c < ncols; ++c) {
+    Column* col = columns[c];
+    SType st = col->stype();
+    if (st == SType::STR32 || st == SType::STR64) {
+      const uint64_t* rh = (st == SType::STR32)
+          ? static_cast<const StringColumn<uint32_t>*>(col)->row_hashes()
+          : static_cast<const StringColumn<uint64_t>*>(col)->row_hashes();
+      #pragma omp parallel for schedule(static)
+      for (int64_t i = 0; i < n; ++i) {
+        hp[i] = (c == 0)? rh[i] : hash_combine(hp[i], rh[i]);
+      }
+    } else {
+      hash_fw_column(col, hp, c == 0);
+    }
+  }
+
+  // Open-addressing first-occurrence set: power-of-two sized, at most
+  // half-full, linear probing. Rows are inserted in order, so the row
+  // kept for every distinct value is always its first occurrence and the
+  // resulting index comes out sorted.
+  size_t tsize = 16;
+  while (tsize < static_cast<size_t>(2 * n)) tsize <<= 1;
+  size_t tmask = tsize - 1;
+  dt::array<int32_t> slots(tsize);
+  std::memset(slots.data(), 0xFF, tsize * sizeof(int32_t));
+  int32_t* slotp = slots.data();
+
+  arr32_t ind(static_cast<size_t>(n));
+  int32_t* indp = ind.data();
+  int64_t nuniques = 0;
+  for (int64_t i = 0; i < n; ++i) {
+    size_t s = static_cast<size_t>(hp[i]) & tmask;
+    while (true) {
+      int32_t r = slotp[s];
+      if (r < 0) {
+        slotp[s] = static_cast<int32_t>(i);
+        indp[nuniques++] = static_cast<int32_t>(i);
+        break;
+      }
+      if (hp[r] == hp[i] && rows_equal(this, r, i)) break;
+      s = (s + 1) & tmask;
+    }
+  }
+
+  ind.resize(static_cast<size_t>(nuniques));
+  return RowIndex::from_array32(std::move(ind), true);
+}
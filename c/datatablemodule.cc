@@ -12,8 +12,12 @@
 #include "csv/writer.h"
 #include "expr/py_expr.h"
 #include "extras/aggregator.h"
+#include "extras/encoding.h"
+#include "extras/score.h"
 #include "frame/py_frame.h"
+#include "memrange.h"
 #include "options.h"
+#include "perf.h"
 #include "py_column.h"
 #include "py_columnset.h"
 #include "py_datatable.h"
@@ -23,7 +27,9 @@
 #include "py_rowindex.h"
 #include "py_types.h"
 #include "py_utils.h"
+#include "utils/alloc.h"
 #include "utils/assert.h"
+#include "utils/progress.h"
 #include "ztest.h"
 
 extern void init_jay();
@@ -63,6 +69,71 @@ DECLARE_FUNCTION(
   "is_debug_mode()\n\n",
   HOMEFLAG)
 
+DECLARE_FUNCTION(
+  cow_stats,
+  "cow_stats()\n\n"
+  "Return a dict describing all copy-on-write materializations performed\n"
+  "since start-up (or since the last `cow_stats_reset()` call): the keys\n"
+  "are the names of the triggering operations, the values are tuples\n"
+  "(number of copies, bytes copied). Use this to find operations that\n"
+  "deep-copy data unexpectedly.\n",
+  HOMEFLAG)
+
+DECLARE_FUNCTION(
+  cow_stats_reset,
+  "cow_stats_reset()\n\n"
+  "Reset the process-wide copy-on-write counters (see `cow_stats()`).\n",
+  HOMEFLAG)
+
+DECLARE_FUNCTION(
+  alloc_stats,
+  "alloc_stats()\n\n"
+  "Return a dict of allocation statistics collected while\n"
+  "`options.memory.alloc_trace` was enabled: the number of live bytes\n"
+  "(`current`), the high-water mark (`peak`), total allocation count and\n"
+  "bytes, a log2 size-class `histogram` (mapping the lower bound of each\n"
+  "class to its allocation count), and `by_tag` -- bytes attributed to\n"
+  "each instrumented operation.\n",
+  HOMEFLAG)
+
+DECLARE_FUNCTION(
+  alloc_stats_reset,
+  "alloc_stats_reset()\n\n"
+  "Reset all allocation-tracing counters (see `alloc_stats()`).\n",
+  HOMEFLAG)
+
+DECLARE_FUNCTION(
+  perf_records,
+  "perf_records()\n\n"
+  "Return a list of dicts, one per recently completed operation, oldest\n"
+  "first. Each dict has keys `op`, `seq`, `time_ns`, `bytes`,\n"
+  "`cache_misses`, `branch_misses`, `busy_total_ns`, `busy_max_ns`,\n"
+  "`imbalance` (busiest thread's busy time over the per-thread mean, when\n"
+  "the operation reports it), `nthreads` and `nchunks`. Records are\n"
+  "only collected while `options.perf.track` is True, and only the last\n"
+  "few hundred operations are retained. The hardware-counter fields are\n"
+  "-1 unless `options.perf.hw_counters` is also enabled (Linux only).\n",
+  HOMEFLAG)
+
+DECLARE_FUNCTION(
+  perf_reset,
+  "perf_reset()\n\n"
+  "Discard all collected operation records (see `perf_records()`).\n",
+  HOMEFLAG)
+
+#ifdef DTTEST
+DECLARE_FUNCTION(
+  fuzz_parallel_kernels,
+  "fuzz_parallel_kernels(seed, niters)\n\n"
+  "Run `niters` iterations of randomized stress-testing of the parallel\n"
+  "kernels (sort, grouping, rowindex materialization), checking structural\n"
+  "invariants and that results do not depend on the number of threads.\n"
+  "Deterministic for a given seed; raises ValueError with a reproducer\n"
+  "(seed, iteration, thread count) on the first violated invariant.\n"
+  "Only available in DTTEST builds (see `make ztest-stress`).\n",
+  HOMEFLAG)
+#endif
+
 DECLARE_FUNCTION(
   has_omp_support,
   "has_omp_support()\n\n"
@@ -100,6 +171,7 @@ PyObject* register_function(PyObject*, PyObject *args) {
   else if (n == 6) replace_dtWarning(fnref);
   else if (n == 7) py::Frame_Type = fnref;
   else if (n == 8) py::fread_fn = fnref;
+  else if (n == 9) dt::progress::set_callback(fnref);
   else {
     throw ValueError() << "Incorrect function index: " << n;
   }
@@ -154,6 +226,120 @@ PyObject* is_debug_mode(PyObject*, PyObject*) {
   #endif
 }
 
+PyObject* cow_stats(PyObject*, PyObject*) {
+  PyObject* res = PyDict_New();
+  if (!res) return nullptr;
+  for (const auto& kv : dt::cow::by_operation()) {
+    PyObject* val = Py_BuildValue("(nn)",
+        static_cast<Py_ssize_t>(kv.second.ncopies),
+        static_cast<Py_ssize_t>(kv.second.bytes_copied));
+    if (!val || PyDict_SetItemString(res, kv.first.c_str(), val)) {
+      Py_XDECREF(val);
+      Py_DECREF(res);
+      return nullptr;
+    }
+    Py_DECREF(val);
+  }
+  return res;
+}
+
+PyObject* cow_stats_reset(PyObject*, PyObject*) {
+  dt::cow::reset();
+  return none();
+}
+
+PyObject* alloc_stats(PyObject*, PyObject*) {
+  dt::alloctrace::Snapshot snap = dt::alloctrace::snapshot();
+  PyObject* hist = PyDict_New();
+  if (!hist) return nullptr;
+  for (size_t i = 0; i < dt::alloctrace::NBUCKETS; ++i) {
+    if (!snap.histogram[i]) continue;
+    PyObject* key = PyLong_FromUnsignedLongLong(1ULL << i);
+    PyObject* val = PyLong_FromSize_t(snap.histogram[i]);
+    if (!key || !val || PyDict_SetItem(hist, key, val)) {
+      Py_XDECREF(key); Py_XDECREF(val); Py_DECREF(hist);
+      return nullptr;
+    }
+    Py_DECREF(key); Py_DECREF(val);
+  }
+  PyObject* bytag = PyDict_New();
+  if (!bytag) { Py_DECREF(hist); return nullptr; }
+  for (const auto& kv : snap.by_tag) {
+    PyObject* val = Py_BuildValue("(nn)",
+        static_cast<Py_ssize_t>(kv.second.nallocs),
+        static_cast<Py_ssize_t>(kv.second.bytes));
+    if (!val || PyDict_SetItemString(bytag, kv.first.c_str(), val)) {
+      Py_XDECREF(val); Py_DECREF(hist); Py_DECREF(bytag);
+      return nullptr;
+    }
+    Py_DECREF(val);
+  }
+  return Py_BuildValue("{s:n, s:n, s:n, s:n, s:N, s:N}",
+      "current", static_cast<Py_ssize_t>(snap.current_bytes),
+      "peak", static_cast<Py_ssize_t>(snap.peak_bytes),
+      "nallocs", static_cast<Py_ssize_t>(snap.total_allocs),
+      "allocated", static_cast<Py_ssize_t>(snap.total_bytes),
+      "histogram", hist,
+      "by_tag", bytag);
+}
+
+PyObject* alloc_stats_reset(PyObject*, PyObject*) {
+  dt::alloctrace::reset();
+  return none();
+}
+
+PyObject* perf_records(PyObject*, PyObject*) {
+  std::vector<dt::perf::Record> records = dt::perf::records();
+  PyObject* res = PyList_New(static_cast<Py_ssize_t>(records.size()));
+  if (!res) return nullptr;
+  Py_ssize_t j = 0;
+  for (const dt::perf::Record& r : records) {
+    // Imbalance = busiest thread's busy time over the per-thread mean:
+    // 1.0 is a perfectly balanced region, nthreads is the worst case
+    // (all work done by one thread).
+    double imbalance = 0.0;
+    if (r.busy_total_ns > 0 && r.nthreads > 0) {
+      imbalance = static_cast<double>(r.busy_max_ns) * r.nthreads
+                  / static_cast<double>(r.busy_total_ns);
+    }
+    PyObject* item = Py_BuildValue(
+        "{s:s, s:L, s:L, s:L, s:L, s:L, s:L, s:L, s:d, s:i, s:i}",
+        "op", r.op,
+        "seq", static_cast<long long>(r.seq),
+        "time_ns", static_cast<long long>(r.walltime_ns),
+        "bytes", static_cast<long long>(r.bytes),
+        "cache_misses", static_cast<long long>(r.cache_misses),
+        "branch_misses", static_cast<long long>(r.branch_misses),
+        "busy_total_ns", static_cast<long long>(r.busy_total_ns),
+        "busy_max_ns", static_cast<long long>(r.busy_max_ns),
+        "imbalance", imbalance,
+        "nthreads", r.nthreads,
+        "nchunks", r.nchunks);
+    if (!item) {
+      Py_DECREF(res);
+      return nullptr;
+    }
+    PyList_SET_ITEM(res, j++, item);
+  }
+  return res;
+}
+
+PyObject* perf_reset(PyObject*, PyObject*) {
+  dt::perf::reset();
+  return none();
+}
+
+#ifdef DTTEST
+PyObject* fuzz_parallel_kernels(PyObject*, PyObject* args) {
+  int64_t seed = 0;
+  int64_t niters = 100;
+  if (!PyArg_ParseTuple(args, "L|L:fuzz_parallel_kernels", &seed, &niters))
+      return nullptr;
+  dttest::fuzz_parallel_kernels(seed, niters);
+  return none();
+}
+#endif
+
 PyObject* has_omp_support(PyObject*, PyObject*) {
   #ifdef DTNOOPENMP
     return incref(Py_False);
@@ -180,6 +366,11 @@ static PyMethodDef DatatableModuleMethods[] = {
     METHODv(pyrowindex::rowindex_from_filterfn),
     METHODv(pydatatable::datatable_load),
     METHODv(pydatatable::open_jay),
+    METHODv(pydatatable::open_jay_buffer),
+    METHODv(pydatatable::open_jay_shmem),
+    METHODv(pydatatable::shmem_unlink),
+    METHODv(pydatatable::open_feather),
+    METHODv(pydatatable::merge_sorted),
     METHODv(pydatatable::install_buffer_hooks),
     METHODv(config::set_option),
     METHODv(gread),
@@ -189,14 +380,40 @@ static PyMethodDef DatatableModuleMethods[] = {
     METHOD0(get_internal_function_ptrs),
     METHOD0(get_integer_sizes),
     METHODv(expr_binaryop),
+    METHODv(expr_fused_binaryop),
+    METHODv(expr_filter_conjunction),
+    METHODv(expr_cache_lookup),
+    METHODv(expr_cache_store),
     METHODv(expr_cast),
     METHODv(expr_column),
     METHODv(expr_reduceop),
+    METHODv(expr_reduceop_multi),
+    METHODv(expr_stringop),
+    METHODv(expr_cumulativeop),
+    METHODv(expr_shiftop),
+    METHODv(expr_fillna_const),
+    METHODv(expr_fillna_dir),
+    METHODv(expr_rollingop),
     METHODv(expr_count),
+    METHODv(expr_ternaryop),
     METHODv(expr_unaryop),
+    METHODv(expr_clip),
+    METHODv(expr_bucketize),
     METHOD0(is_debug_mode),
     METHOD0(has_omp_support),
+    #ifdef DTTEST
+      METHODv(fuzz_parallel_kernels),
+    #endif
+    METHOD0(cow_stats),
+    METHOD0(cow_stats_reset),
+    METHOD0(perf_records),
+    METHOD0(perf_reset),
+    METHOD0(alloc_stats),
+    METHOD0(alloc_stats_reset),
     METHODv(aggregate),
+    METHODv(onehot),
+    METHODv(label_encode),
+    METHODv(score_linear),
 
     {nullptr, nullptr, 0, nullptr}  /* Sentinel */
 };
@@ -12,6 +12,27 @@
 extern const uint8_t hexdigits[256];  // defined in c/csv/freadLookups.h
 
 
+// Helpers for the word-at-a-time ("SWAR") fast paths below. Most of the text
+// that flows through these functions is plain ASCII, so instead of inspecting
+// it byte by byte we load 8 bytes at once and test all of their high bits in
+// a single operation. `std::memcpy` compiles to a single unaligned load; we
+// deliberately avoid vendor intrinsics here, since this file must build on
+// every platform the package targets.
+static constexpr uint64_t HIGH_BITS = 0x8080808080808080ULL;
+static constexpr uint64_t LOW_BITS  = 0x0101010101010101ULL;
+
+static inline uint64_t load8(const void* p) {
+  uint64_t w;
+  std::memcpy(&w, p, sizeof(uint64_t));
+  return w;
+}
+
+// Nonzero iff any byte of `w` is zero (the classic `haszero` bit-trick).
+static inline uint64_t zero_byte_mask(uint64_t w) {
+  return (w - LOW_BITS) & ~w & HIGH_BITS;
+}
+
+
 
 /**
  * Decode a string from the provided single-byte character set. On success
@@ -48,6 +69,15 @@ int decode_sbcs(
     unsigned char ch = *src;
     if (ch < 0x80) {
       *d++ = ch;
+      // Bulk path: ASCII maps to itself in every supported code page, so a
+      // run of ASCII bytes is copied 8 bytes at a time.
+      while (src + 8 < end) {
+        uint64_t w = load8(src + 1);
+        if (w & HIGH_BITS) break;
+        std::memcpy(d, &w, sizeof(uint64_t));
+        d += 8;
+        src += 8;
+      }
     } else {
       uint32_t m = map[ch];
       if (m == 0) return -static_cast<int>(1 + d - dest);
@@ -71,6 +101,9 @@ int is_valid_utf8(const uint8_t* src, size_t len)
     uint8_t c = *ch;
     if (c < 0x80) {
       ch++;
+      // Bulk path: validate whole 8-byte words of ASCII with a single
+      // high-bits test each, instead of one branch per byte.
+      while (ch + 8 <= end && !(load8(ch) & HIGH_BITS)) ch += 8;
     } else {
       uint8_t cc = ch[1];
       if ((c & 0xE0) == 0xC0) {
@@ -123,11 +156,21 @@ int check_escaped_string(const uint8_t* src, size_t len, uint8_t ech)
   const uint8_t* ch = src;
   const uint8_t* end = src + len;
   int has_escapes = 0;
+  uint64_t echw = LOW_BITS * ech;  // `ech` broadcast into every byte
   while (ch < end) {
     uint8_t c = *ch;
     if (c < 0x80) {
       has_escapes |= (c == ech);
       ch++;
+      // Bulk path: scan whole 8-byte words of ASCII, testing all 8 bytes
+      // against `ech` at once. A non-ASCII `ech` has its high bit set and
+      // can never equal an ASCII byte, so the word test ignores it too.
+      while (ch + 8 <= end) {
+        uint64_t w = load8(ch);
+        if (w & HIGH_BITS) break;
+        has_escapes |= (zero_byte_mask(w ^ echw) != 0);
+        ch += 8;
+      }
     } else {
       uint8_t cc = ch[1];
       if ((c & 0xE0) == 0xC0) {
@@ -24,36 +24,24 @@
 // heavily in this source file.
 //------------------------------------------------------------------------------
 #include "expr/py_expr.h"
+#include <algorithm>           // std::max, std::min
 #include <cmath>               // std::fmod
+#include <cstring>             // std::memcpy
+#include <memory>              // std::shared_ptr
 #include <type_traits>         // std::is_integral
+#include <vector>
+#include "perf.h"
 #include "types.h"
 #include "utils/exceptions.h"
+#include "utils/interrupts.h"
+#include "utils/omp.h"
+#include "utils/parallel.h"
 
 
 namespace expr
 {
 
 // Should be in sync with a map in binary_expr.py
-enum OpCode {
-  Plus           = 1,
-  Minus          = 2,
-  Multiply       = 3,
-  Divide         = 4,
-  IntDivide      = 5,
-  Power          = 6,
-  Modulo         = 7,
-  LogicalAnd     = 8,
-  LogicalOr      = 9,
-  LeftShift      = 10,
-  RightShift     = 11,
-  Equal          = 12,  // ==
-  NotEqual       = 13,  // !=
-  Greater        = 14,  // >
-  Less           = 15,  // <
-  GreaterOrEqual = 16,  // >=
-  LessOrEqual    = 17,  // <=
-};
-
 enum OpMode {
   Error = 0,
   N_to_N = 1,
@@ -66,6 +54,14 @@ enum OpMode {
 //------------------------------------------------------------------------------
 // Final mapper functions
 //------------------------------------------------------------------------------
+// The generic mappers iterate through their operands' rowindex indirection
+// directly, so columns that carry a rowindex (views obtained from a filter
+// or a groupby sort) do not need to be materialized first. At most one
+// distinct rowindex may be present among the operands -- the driver
+// materializes one side otherwise -- and when none is present the loops
+// degenerate into plain contiguous scans. A rowindex entry of NA (possible
+// in array rowindices, and passed through as a negative value) yields an NA
+// result.
 
 template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
 static void map_n_to_n(int64_t row0, int64_t row1, void** params) {
@@ -75,9 +71,14 @@ static void map_n_to_n(int64_t row0, int64_t row1, void** params) {
   const LT* lhs_data = static_cast<const LT*>(col0->data());
   const RT* rhs_data = static_cast<const RT*>(col1->data());
   VT* res_data = static_cast<VT*>(col2->data_w());
-  for (int64_t i = row0; i < row1; ++i) {
-    res_data[i] = OP(lhs_data[i], rhs_data[i]);
-  }
+  bool lmap = bool(col0->rowindex());
+  bool rmap = bool(col1->rowindex());
+  const RowIndex& ri = lmap? col0->rowindex() : col1->rowindex();
+  ri.strided_loop2(row0, row1, 1,
+    [&](int64_t i, int64_t j) {
+      res_data[i] = (j < 0)? GETNA<VT>()
+                  : OP(lhs_data[lmap? j : i], rhs_data[rmap? j : i]);
+    });
 }
 
 template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
@@ -86,11 +87,14 @@ static void map_n_to_1(int64_t row0, int64_t row1, void** params) {
   Column* col1 = static_cast<Column*>(params[1]);
   Column* col2 = static_cast<Column*>(params[2]);
   const LT* lhs_data = static_cast<const LT*>(col0->data());
-  RT rhs_value = static_cast<const RT*>(col1->data())[0];
+  const RT* rhs_data = static_cast<const RT*>(col1->data());
+  int64_t k = col1->rowindex()? col1->rowindex().nth(0) : 0;
+  RT rhs_value = rhs_data[k];
   VT* res_data = static_cast<VT*>(col2->data_w());
-  for (int64_t i = row0; i < row1; ++i) {
-    res_data[i] = OP(lhs_data[i], rhs_value);
-  }
+  col0->rowindex().strided_loop2(row0, row1, 1,
+    [&](int64_t i, int64_t j) {
+      res_data[i] = (j < 0)? GETNA<VT>() : OP(lhs_data[j], rhs_value);
+    });
 }
 
 template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
@@ -98,12 +102,15 @@ static void map_1_to_n(int64_t row0, int64_t row1, void** params) {
   Column* col0 = static_cast<Column*>(params[0]);
   Column* col1 = static_cast<Column*>(params[1]);
   Column* col2 = static_cast<Column*>(params[2]);
-  LT lhs_value = static_cast<const LT*>(col0->data())[0];
+  const LT* lhs_data = static_cast<const LT*>(col0->data());
+  int64_t k = col0->rowindex()? col0->rowindex().nth(0) : 0;
+  LT lhs_value = lhs_data[k];
   const RT* rhs_data = static_cast<const RT*>(col1->data());
   VT* res_data = static_cast<VT*>(col2->data_w());
-  for (int64_t i = row0; i < row1; ++i) {
-    res_data[i] = OP(lhs_value, rhs_data[i]);
-  }
+  col1->rowindex().strided_loop2(row0, row1, 1,
+    [&](int64_t i, int64_t j) {
+      res_data[i] = (j < 0)? GETNA<VT>() : OP(lhs_value, rhs_data[j]);
+    });
 }
 
 
@@ -157,24 +164,115 @@ static void strmap_n_to_1(int64_t row0, int64_t row1, void** params) {
 
 
 //------------------------------------------------------------------------------
-// Arithmetic operators
+// Vectorized mapper functions
 //------------------------------------------------------------------------------
+// For simple arithmetic ops (Plus, Minus, Multiply) the per-element NA check
+// in a generic `VT (*OP)(LT, RT)` kernel compiles into a branch, which stops
+// the compiler from emitting SIMD code. These kernels instead compute the
+// result unconditionally and then blend in the NA value with a mask-style
+// select, so the loop body is branchless and autovectorizes. For floating
+// point operands `IsIntNA` is identically false (NAs are NaNs and propagate
+// through the arithmetic on their own), and the select folds away entirely.
+
+template<typename LT, typename RT, typename VT, int OP>
+inline static VT vec_op_raw(LT x, RT y) {
+  VT vx = static_cast<VT>(x);
+  VT vy = static_cast<VT>(y);
+  return OP == OpCode::Plus  ? vx + vy :
+         OP == OpCode::Minus ? vx - vy : vx * vy;
+}
 
-template<typename LT, typename RT, typename VT>
-inline static VT op_add(LT x, RT y) {
-  return IsIntNA<LT>(x) || IsIntNA<RT>(y)? GETNA<VT>() : static_cast<VT>(x) + static_cast<VT>(y);
+template<typename LT, typename RT, typename VT, int OP>
+inline static VT vec_op(LT x, RT y) {
+  VT r = vec_op_raw<LT, RT, VT, OP>(x, y);
+  bool isna = IsIntNA<LT>(x) | IsIntNA<RT>(y);
+  return isna? GETNA<VT>() : r;
 }
 
-template<typename LT, typename RT, typename VT>
-inline static VT op_sub(LT x, RT y) {
-  return IsIntNA<LT>(x) || IsIntNA<RT>(y)? GETNA<VT>() : static_cast<VT>(x) - static_cast<VT>(y);
+template<typename LT, typename RT, typename VT, int OP>
+static void vecmap_n_to_n(int64_t row0, int64_t row1, void** params) {
+  Column* col0 = static_cast<Column*>(params[0]);
+  Column* col1 = static_cast<Column*>(params[1]);
+  Column* col2 = static_cast<Column*>(params[2]);
+  const LT* lhs_data = static_cast<const LT*>(col0->data());
+  const RT* rhs_data = static_cast<const RT*>(col1->data());
+  VT* res_data = static_cast<VT*>(col2->data_w());
+  #pragma omp simd
+  for (int64_t i = row0; i < row1; ++i) {
+    res_data[i] = vec_op<LT, RT, VT, OP>(lhs_data[i], rhs_data[i]);
+  }
 }
 
-template<typename LT, typename RT, typename VT>
-inline static VT op_mul(LT x, RT y) {
-  return IsIntNA<LT>(x) || IsIntNA<RT>(y)? GETNA<VT>() : static_cast<VT>(x) * static_cast<VT>(y);
+// Variant of `vecmap_n_to_n` used when both operands carry a cached validity
+// bitmask (see Column::validity_mask): the op is computed with no per-element
+// NA logic at all, after which NA values are blended back in using the AND of
+// the two bitmasks. Bytes where all 8 rows are valid are skipped entirely, so
+// on mostly-valid data the fix-up pass touches almost nothing.
+template<typename LT, typename RT, typename VT, int OP>
+static void vecmap_masked_n_to_n(int64_t row0, int64_t row1, void** params) {
+  Column* col0 = static_cast<Column*>(params[0]);
+  Column* col1 = static_cast<Column*>(params[1]);
+  Column* col2 = static_cast<Column*>(params[2]);
+  const uint8_t* lmask = col0->validity_mask();
+  const uint8_t* rmask = col1->validity_mask();
+  if (!lmask || !rmask) {
+    vecmap_n_to_n<LT, RT, VT, OP>(row0, row1, params);
+    return;
+  }
+  const LT* lhs_data = static_cast<const LT*>(col0->data());
+  const RT* rhs_data = static_cast<const RT*>(col1->data());
+  VT* res_data = static_cast<VT*>(col2->data_w());
+  #pragma omp simd
+  for (int64_t i = row0; i < row1; ++i) {
+    res_data[i] = vec_op_raw<LT, RT, VT, OP>(lhs_data[i], rhs_data[i]);
+  }
+  for (int64_t b = row0 / 8; b * 8 < row1; ++b) {
+    uint8_t m = static_cast<uint8_t>(lmask[b] & rmask[b]);
+    if (m == 0xFF) continue;
+    int64_t i0 = b * 8;
+    int jmin = i0 < row0? static_cast<int>(row0 - i0) : 0;
+    int jmax = row1 - i0 < 8? static_cast<int>(row1 - i0) : 8;
+    for (int j = jmin; j < jmax; ++j) {
+      if (!((m >> j) & 1)) res_data[i0 + j] = GETNA<VT>();
+    }
+  }
+}
+
+template<typename LT, typename RT, typename VT, int OP>
+static void vecmap_n_to_1(int64_t row0, int64_t row1, void** params) {
+  Column* col0 = static_cast<Column*>(params[0]);
+  Column* col1 = static_cast<Column*>(params[1]);
+  Column* col2 = static_cast<Column*>(params[2]);
+  const LT* lhs_data = static_cast<const LT*>(col0->data());
+  RT rhs_value = static_cast<const RT*>(col1->data())[0];
+  VT* res_data = static_cast<VT*>(col2->data_w());
+  #pragma omp simd
+  for (int64_t i = row0; i < row1; ++i) {
+    res_data[i] = vec_op<LT, RT, VT, OP>(lhs_data[i], rhs_value);
+  }
+}
+
+template<typename LT, typename RT, typename VT, int OP>
+static void vecmap_1_to_n(int64_t row0, int64_t row1, void** params) {
+  Column* col0 = static_cast<Column*>(params[0]);
+  Column* col1 = static_cast<Column*>(params[1]);
+  Column* col2 = static_cast<Column*>(params[2]);
+  LT lhs_value = static_cast<const LT*>(col0->data())[0];
+  const RT* rhs_data = static_cast<const RT*>(col1->data());
+  VT* res_data = static_cast<VT*>(col2->data_w());
+  #pragma omp simd
+  for (int64_t i = row0; i < row1; ++i) {
+    res_data[i] = vec_op<LT, RT, VT, OP>(lhs_value, rhs_data[i]);
+  }
 }
 
+
+
+
+//------------------------------------------------------------------------------
+// Arithmetic operators
+//------------------------------------------------------------------------------
+
 template<typename LT, typename RT, typename VT>
 inline static VT op_div(LT x, RT y) {
   if (IsIntNA<LT>(x) || IsIntNA<RT>(y) || y == 0) return GETNA<VT>();
@@ -264,18 +362,33 @@ inline static int8_t op_le(LT x, RT y) {  // x <= y
          (x_isna && y_isna);
 }
 
+// Compare two byte ranges of equal length `n`, eight bytes at a time. Both
+// ranges live inside string data buffers whose lengths are known, so the word
+// loads never read past `a + n` / `b + n` by more than the loop condition
+// allows; the tail is compared byte-wise. The length check itself is done by
+// the caller: most non-equal rows in real data differ in length, and that
+// case never touches the string bytes at all.
+inline static bool streq_bytes(const char* a, const char* b, size_t n) {
+  while (n >= 8) {
+    uint64_t wa, wb;
+    std::memcpy(&wa, a, 8);
+    std::memcpy(&wb, b, 8);
+    if (wa != wb) return false;
+    a += 8; b += 8; n -= 8;
+  }
+  while (n--) {
+    if (*a++ != *b++) return false;
+  }
+  return true;
+}
+
 template<typename T1, typename T2>
 inline static int8_t strop_eq(T1 start1, T1 end1, const char* strdata1,
                               T2 start2, T2 end2, const char* strdata2) {
   if (!ISNA<T1>(end1) && !ISNA<T2>(end2)) {
     if (end1 - start1 == end2 - start2) {
-      const char* ch1 = strdata1 + start1;
-      const char* ch2 = strdata2 + start2;
-      const char* end = strdata1 + end1;
-      while (ch1 < end) {
-        if (*ch1++ != *ch2++) return 0;
-      }
-      return 1;
+      return streq_bytes(strdata1 + start1, strdata2 + start2,
+                         static_cast<size_t>(end1 - start1));
     } else {
       return 0;
     }
@@ -287,21 +400,7 @@ inline static int8_t strop_eq(T1 start1, T1 end1, const char* strdata1,
 template<typename T1, typename T2>
 inline static int8_t strop_ne(T1 start1, T1 end1, const char* strdata1,
                               T2 start2, T2 end2, const char* strdata2) {
-  if (!ISNA<T1>(end1) && !ISNA<T2>(end2)) {
-    if (end1 - start1 == end2 - start2) {
-      const char* ch1 = strdata1 + start1;
-      const char* ch2 = strdata2 + start2;
-      const char* end = strdata1 + end1;
-      while (ch1 < end) {
-        if (*ch1++ != *ch2++) return 1;
-      }
-      return 0;
-    } else {
-      return 1;
-    }
-  } else {
-    return !(ISNA<T1>(end1) && ISNA<T2>(end2));
-  }
+  return !strop_eq<T1, T2>(start1, end1, strdata1, start2, end2, strdata2);
 }
 
 
@@ -339,6 +438,60 @@ static mapperfn resolve2(OpMode mode) {
   }
 }
 
+template<typename LT, typename RT, typename VT, int OP>
+static mapperfn resolve2vec(OpMode mode, void** params) {
+  // The vectorized kernels assume contiguous data; operands that carry a
+  // rowindex go through the generic (indirection-aware) mappers instead.
+  Column* c0 = static_cast<Column*>(params[0]);
+  Column* c1 = static_cast<Column*>(params[1]);
+  if (c0->rowindex() || c1->rowindex()) {
+    return resolve2<LT, RT, VT, vec_op<LT, RT, VT, OP>>(mode);
+  }
+  switch (mode) {
+    case N_to_N: {
+      // When both operands already carry validity bitmasks, use the
+      // branch-free masked kernel; computing a mask from scratch here would
+      // cost the same pass it is meant to save, so masks are only consumed
+      // opportunistically.
+      if (c0->has_validity_mask() && c1->has_validity_mask()) {
+        return vecmap_masked_n_to_n<LT, RT, VT, OP>;
+      }
+      return vecmap_n_to_n<LT, RT, VT, OP>;
+    }
+    case N_to_One: return vecmap_n_to_1<LT, RT, VT, OP>;
+    case One_to_N: return vecmap_1_to_n<LT, RT, VT, OP>;
+    case Error:    return nullptr;
+  }
+  return nullptr;  // LCOV_EXCL_LINE
+}
+
+// Equality of a string column against a single value. When the same column
+// version receives repeated point queries, the lookup goes through the
+// column's cached hash index (see StringColumn::index_equal_rows) instead of
+// scanning and comparing every row; otherwise this falls through to the
+// regular scan kernel.
+template<typename T0, typename T1, bool INVERT>
+static void strmap_eq_n_to_1(int64_t row0, int64_t row1, void** params) {
+  auto col0 = static_cast<StringColumn<T0>*>(params[0]);
+  auto col1 = static_cast<StringColumn<T1>*>(params[1]);
+  auto col2 = static_cast<Column*>(params[2]);
+  if (row0 == 0 && row1 == col0->nrows) {
+    const T1* offsets1 = col1->offsets();
+    T1 end1 = offsets1[0];
+    bool isna = ISNA<T1>(end1);
+    size_t len = isna? 0 : static_cast<size_t>(end1);
+    auto res_data = static_cast<int8_t*>(col2->data_w());
+    if (col0->index_equal_rows(col1->ustrdata(), len, isna, INVERT,
+                               res_data)) return;
+  }
+  if (INVERT) {
+    strmap_n_to_1<T0, T1, int8_t, strop_ne<T0, T1>>(row0, row1, params);
+  } else {
+    strmap_n_to_1<T0, T1, int8_t, strop_eq<T0, T1>>(row0, row1, params);
+  }
+}
+
+
 template<typename T0, typename T1, typename T2,
          T2 (*OP)(T0, T0, const char*, T1, T1, const char*)>
 static mapperfn resolve2str(OpMode mode) {
@@ -361,9 +514,9 @@ static mapperfn resolve1(int opcode, SType stype, void** params, int64_t nrows,
   }
   params[2] = Column::new_data_column(stype, nrows);
   switch (opcode) {
-    case OpCode::Plus:      return resolve2<LT, RT, VT, op_add<LT, RT, VT>>(mode);
-    case OpCode::Minus:     return resolve2<LT, RT, VT, op_sub<LT, RT, VT>>(mode);
-    case OpCode::Multiply:  return resolve2<LT, RT, VT, op_mul<LT, RT, VT>>(mode);
+    case OpCode::Plus:      return resolve2vec<LT, RT, VT, OpCode::Plus>(mode, params);
+    case OpCode::Minus:     return resolve2vec<LT, RT, VT, OpCode::Minus>(mode, params);
+    case OpCode::Multiply:  return resolve2vec<LT, RT, VT, OpCode::Multiply>(mode, params);
     case OpCode::IntDivide: return resolve2<LT, RT, VT, op_div<LT, RT, VT>>(mode);
     case OpCode::Modulo:    return resolve2<LT, RT, VT, Mod<LT, RT, VT>::impl>(mode);
     case OpCode::Divide:
@@ -393,8 +546,12 @@ static mapperfn resolve1str(int opcode, void** params, int64_t nrows, OpMode mod
   }
   params[2] = Column::new_data_column(SType::BOOL, nrows);
   switch (opcode) {
-    case OpCode::Equal:    return resolve2str<T0, T1, int8_t, strop_eq<T0, T1>>(mode);
-    case OpCode::NotEqual: return resolve2str<T0, T1, int8_t, strop_ne<T0, T1>>(mode);
+    case OpCode::Equal:
+      if (mode == OpMode::N_to_One) return strmap_eq_n_to_1<T0, T1, false>;
+      return resolve2str<T0, T1, int8_t, strop_eq<T0, T1>>(mode);
+    case OpCode::NotEqual:
+      if (mode == OpMode::N_to_One) return strmap_eq_n_to_1<T0, T1, true>;
+      return resolve2str<T0, T1, int8_t, strop_ne<T0, T1>>(mode);
   }
   delete static_cast<Column*>(params[2]);
   return nullptr;
@@ -506,14 +663,314 @@ static mapperfn resolve0(SType lhs_type, SType rhs_type, int opcode, void** para
 }
 
 
+//------------------------------------------------------------------------------
+// Fused evaluation of expression trees
+//------------------------------------------------------------------------------
+// `binaryop` materializes a full result column for every node of an
+// expression tree, so `(f.a - f.b) / (f.a + f.b)` allocates two nrows-sized
+// intermediates before the division even starts. The fused evaluator below
+// instead executes the whole tree in one pass over the data: the tree is
+// flattened (on the Python side) into a postfix program where a non-negative
+// instruction pushes an input column onto the value stack and a negative
+// instruction applies the binary op with that opcode to the top two values.
+// Evaluation proceeds chunk by chunk, with each thread keeping its
+// intermediates in a small chunk-sized arena, so the only nrows-sized
+// allocation is the final result.
+//
+// Only fixed-width numeric operands are supported; strings raise NotImplError
+// and the caller falls back to node-at-a-time evaluation.
+
+template<typename LT, typename RT, typename VT, VT (*OP)(LT, RT)>
+static void fused_map(int64_t n, const void* x, int64_t xstride,
+                      const void* y, int64_t ystride, void* out)
+{
+  const LT* lhs_data = static_cast<const LT*>(x);
+  const RT* rhs_data = static_cast<const RT*>(y);
+  VT* res_data = static_cast<VT*>(out);
+  for (int64_t i = 0; i < n; ++i) {
+    res_data[i] = OP(lhs_data[i * xstride], rhs_data[i * ystride]);
+  }
+}
+
+
+template<typename LT, typename RT, typename VT>
+static fusedfn fused_resolve1(int opcode, SType stype, SType& out_stype) {
+  out_stype = stype;
+  if (opcode >= OpCode::Equal) {
+    out_stype = SType::BOOL;
+  } else if (opcode == OpCode::Divide && std::is_integral<VT>::value) {
+    out_stype = SType::FLOAT64;
+  }
+  switch (opcode) {
+    case OpCode::Plus:      return fused_map<LT, RT, VT, vec_op<LT, RT, VT, OpCode::Plus>>;
+    case OpCode::Minus:     return fused_map<LT, RT, VT, vec_op<LT, RT, VT, OpCode::Minus>>;
+    case OpCode::Multiply:  return fused_map<LT, RT, VT, vec_op<LT, RT, VT, OpCode::Multiply>>;
+    case OpCode::IntDivide: return fused_map<LT, RT, VT, op_div<LT, RT, VT>>;
+    case OpCode::Modulo:    return fused_map<LT, RT, VT, Mod<LT, RT, VT>::impl>;
+    case OpCode::Divide:
+      if (std::is_integral<VT>::value)
+        return fused_map<LT, RT, double, op_div<LT, RT, double>>;
+      else
+        return fused_map<LT, RT, VT, op_div<LT, RT, VT>>;
+
+    // Relational operators
+    case OpCode::Equal:          return fused_map<LT, RT, int8_t, op_eq<LT, RT, VT>>;
+    case OpCode::NotEqual:       return fused_map<LT, RT, int8_t, op_ne<LT, RT, VT>>;
+    case OpCode::Greater:        return fused_map<LT, RT, int8_t, op_gt<LT, RT, VT>>;
+    case OpCode::Less:           return fused_map<LT, RT, int8_t, op_lt<LT, RT, VT>>;
+    case OpCode::GreaterOrEqual: return fused_map<LT, RT, int8_t, op_ge<LT, RT, VT>>;
+    case OpCode::LessOrEqual:    return fused_map<LT, RT, int8_t, op_le<LT, RT, VT>>;
+  }
+  return nullptr;
+}
+
+
+fusedfn fused_resolve0(SType lhs_type, SType rhs_type, int opcode,
+                       SType& out_stype)
+{
+  switch (lhs_type) {
+    case SType::BOOL:
+      if (rhs_type == SType::BOOL && (opcode == OpCode::LogicalAnd ||
+                                      opcode == OpCode::LogicalOr)) {
+        out_stype = SType::BOOL;
+        if (opcode == OpCode::LogicalAnd) return fused_map<int8_t, int8_t, int8_t, op_and>;
+        if (opcode == OpCode::LogicalOr)  return fused_map<int8_t, int8_t, int8_t, op_or>;
+      }
+      [[clang::fallthrough]];
+
+    case SType::INT8:
+      switch (rhs_type) {
+        case SType::BOOL:
+        case SType::INT8:    return fused_resolve1<int8_t, int8_t, int8_t>(opcode, SType::INT8, out_stype);
+        case SType::INT16:   return fused_resolve1<int8_t, int16_t, int16_t>(opcode, SType::INT16, out_stype);
+        case SType::INT32:   return fused_resolve1<int8_t, int32_t, int32_t>(opcode, SType::INT32, out_stype);
+        case SType::INT64:   return fused_resolve1<int8_t, int64_t, int64_t>(opcode, SType::INT64, out_stype);
+        case SType::FLOAT32: return fused_resolve1<int8_t, float, float>(opcode, SType::FLOAT32, out_stype);
+        case SType::FLOAT64: return fused_resolve1<int8_t, double, double>(opcode, SType::FLOAT64, out_stype);
+        default: break;
+      }
+      break;
+
+    case SType::INT16:
+      switch (rhs_type) {
+        case SType::BOOL:
+        case SType::INT8:    return fused_resolve1<int16_t, int8_t, int16_t>(opcode, SType::INT16, out_stype);
+        case SType::INT16:   return fused_resolve1<int16_t, int16_t, int16_t>(opcode, SType::INT16, out_stype);
+        case SType::INT32:   return fused_resolve1<int16_t, int32_t, int32_t>(opcode, SType::INT32, out_stype);
+        case SType::INT64:   return fused_resolve1<int16_t, int64_t, int64_t>(opcode, SType::INT64, out_stype);
+        case SType::FLOAT32: return fused_resolve1<int16_t, float, float>(opcode, SType::FLOAT32, out_stype);
+        case SType::FLOAT64: return fused_resolve1<int16_t, double, double>(opcode, SType::FLOAT64, out_stype);
+        default: break;
+      }
+      break;
+
+    case SType::INT32:
+      switch (rhs_type) {
+        case SType::BOOL:
+        case SType::INT8:    return fused_resolve1<int32_t, int8_t, int32_t>(opcode, SType::INT32, out_stype);
+        case SType::INT16:   return fused_resolve1<int32_t, int16_t, int32_t>(opcode, SType::INT32, out_stype);
+        case SType::INT32:   return fused_resolve1<int32_t, int32_t, int32_t>(opcode, SType::INT32, out_stype);
+        case SType::INT64:   return fused_resolve1<int32_t, int64_t, int64_t>(opcode, SType::INT64, out_stype);
+        case SType::FLOAT32: return fused_resolve1<int32_t, float, float>(opcode, SType::FLOAT32, out_stype);
+        case SType::FLOAT64: return fused_resolve1<int32_t, double, double>(opcode, SType::FLOAT64, out_stype);
+        default: break;
+      }
+      break;
+
+    case SType::INT64:
+      switch (rhs_type) {
+        case SType::BOOL:
+        case SType::INT8:    return fused_resolve1<int64_t, int8_t, int64_t>(opcode, SType::INT64, out_stype);
+        case SType::INT16:   return fused_resolve1<int64_t, int16_t, int64_t>(opcode, SType::INT64, out_stype);
+        case SType::INT32:   return fused_resolve1<int64_t, int32_t, int64_t>(opcode, SType::INT64, out_stype);
+        case SType::INT64:   return fused_resolve1<int64_t, int64_t, int64_t>(opcode, SType::INT64, out_stype);
+        case SType::FLOAT32: return fused_resolve1<int64_t, float, float>(opcode, SType::FLOAT32, out_stype);
+        case SType::FLOAT64: return fused_resolve1<int64_t, double, double>(opcode, SType::FLOAT64, out_stype);
+        default: break;
+      }
+      break;
+
+    case SType::FLOAT32:
+      switch (rhs_type) {
+        case SType::BOOL:
+        case SType::INT8:    return fused_resolve1<float, int8_t, float>(opcode, SType::FLOAT32, out_stype);
+        case SType::INT16:   return fused_resolve1<float, int16_t, float>(opcode, SType::FLOAT32, out_stype);
+        case SType::INT32:   return fused_resolve1<float, int32_t, float>(opcode, SType::FLOAT32, out_stype);
+        case SType::INT64:   return fused_resolve1<float, int64_t, float>(opcode, SType::FLOAT32, out_stype);
+        case SType::FLOAT32: return fused_resolve1<float, float, float>(opcode, SType::FLOAT32, out_stype);
+        case SType::FLOAT64: return fused_resolve1<float, double, double>(opcode, SType::FLOAT64, out_stype);
+        default: break;
+      }
+      break;
+
+    case SType::FLOAT64:
+      switch (rhs_type) {
+        case SType::BOOL:
+        case SType::INT8:    return fused_resolve1<double, int8_t, double>(opcode, SType::FLOAT64, out_stype);
+        case SType::INT16:   return fused_resolve1<double, int16_t, double>(opcode, SType::FLOAT64, out_stype);
+        case SType::INT32:   return fused_resolve1<double, int32_t, double>(opcode, SType::FLOAT64, out_stype);
+        case SType::INT64:   return fused_resolve1<double, int64_t, double>(opcode, SType::FLOAT64, out_stype);
+        case SType::FLOAT32: return fused_resolve1<double, float, double>(opcode, SType::FLOAT64, out_stype);
+        case SType::FLOAT64: return fused_resolve1<double, double, double>(opcode, SType::FLOAT64, out_stype);
+        default: break;
+      }
+      break;
+
+    default:
+      break;
+  }
+  return nullptr;
+}
+
+
+Column* fused_binaryop(const std::vector<int>& program,
+                       const std::vector<Column*>& columns)
+{
+  // Number of rows evaluated per value-stack slot in one step. Intermediates
+  // of the deepest stack must fit comfortably in the L2 cache.
+  static const int64_t FUSED_CHUNK = 4096;
+
+  int64_t nrows = 0;
+  for (Column* col : columns) {
+    col->reify();
+    nrows = std::max(nrows, col->nrows);
+  }
+  for (Column* col : columns) {
+    if (col->nrows != nrows && col->nrows != 1) {
+      throw ValueError() << "Cannot fuse expression over columns of "
+          "incompatible sizes " << col->nrows << " and " << nrows;
+    }
+  }
+
+  // First pass: run the program over a stack of stypes only, resolving the
+  // kernel for each op instruction and the final result stype.
+  std::vector<fusedfn> kernels(program.size(), nullptr);
+  std::vector<SType> stypes_stack;
+  size_t max_depth = 0;
+  for (size_t k = 0; k < program.size(); ++k) {
+    int instr = program[k];
+    if (instr >= 0) {
+      if (instr >= static_cast<int>(columns.size())) {
+        throw ValueError() << "Invalid column reference " << instr
+            << " in fused expression program";
+      }
+      SType st = columns[instr]->stype();
+      switch (st) {
+        case SType::BOOL:  case SType::INT8:    case SType::INT16:
+        case SType::INT32: case SType::INT64:   case SType::FLOAT32:
+        case SType::FLOAT64: break;
+        default:
+          throw NotImplError() << "Fused evaluation is not supported for "
+              "columns of stype " << st;
+      }
+      stypes_stack.push_back(st);
+    } else {
+      if (stypes_stack.size() < 2) {
+        throw ValueError() << "Invalid fused expression program";
+      }
+      SType rt = stypes_stack.back(); stypes_stack.pop_back();
+      SType lt = stypes_stack.back(); stypes_stack.pop_back();
+      SType ost = SType::VOID;
+      fusedfn fn = fused_resolve0(lt, rt, -instr, ost);
+      if (!fn) {
+        throw NotImplError() << "Unable to fuse op " << -instr
+            << " on operands of stypes " << lt << " and " << rt;
+      }
+      kernels[k] = fn;
+      stypes_stack.push_back(ost);
+    }
+    max_depth = std::max(max_depth, stypes_stack.size());
+  }
+  if (stypes_stack.size() != 1) {
+    throw ValueError() << "Invalid fused expression program";
+  }
+  SType res_stype = stypes_stack[0];
+  Column* res = Column::new_data_column(res_stype, nrows);
+  char* res_data = static_cast<char*>(res->data_w());
+  size_t res_elemsize = info(res_stype).elemsize();
+
+  // Second pass: execute the program chunk by chunk. Input columns are
+  // pushed as pointers into their data buffers (stride 0 broadcasts a 1-row
+  // column); op results go into per-thread chunk-sized scratch slots, except
+  // the final op which writes straight into the result column.
+  struct StackVal {
+    const void* ptr;
+    int64_t stride;
+  };
+  int64_t nchunks = (nrows + FUSED_CHUNK - 1) / FUSED_CHUNK;
+  dt::clear_interrupt();
+  dt::run_parallel([&](int ith, int nth) {
+    std::vector<char> arena(max_depth * FUSED_CHUNK * 8);
+    std::vector<StackVal> vstack(max_depth);
+    // Static chunk->thread assignment: elementwise kernels have uniform
+    // per-row cost, so dynamic chunk-stealing buys no balance here and
+    // only scrambles which core touches which rows. With a fixed
+    // partition, consecutive expressions over the same frame walk the
+    // same rows on the same (persistent) pool threads, keeping the
+    // operands' cache lines warm from one kernel to the next.
+    int64_t cfirst = nchunks * ith / nth;
+    int64_t clast = nchunks * (ith + 1) / nth;
+    for (int64_t ci = cfirst; ci < clast; ++ci) {
+      // Cancellation point, once per chunk: thread 0 polls for pending
+      // Python signals, the others just watch the abort flag.
+      if (ith == 0) dt::poll_interrupts();
+      if (dt::interrupt_requested()) break;
+      int64_t i0 = ci * FUSED_CHUNK;
+      int64_t cn = std::min(FUSED_CHUNK, nrows - i0);
+      size_t sp = 0;
+      for (size_t k = 0; k < program.size(); ++k) {
+        int instr = program[k];
+        if (instr >= 0) {
+          Column* col = columns[instr];
+          size_t esz = info(col->stype()).elemsize();
+          bool scalar = (col->nrows == 1);
+          vstack[sp].ptr = static_cast<const char*>(col->data()) +
+                           (scalar? 0 : i0 * static_cast<int64_t>(esz));
+          vstack[sp].stride = scalar? 0 : 1;
+          sp++;
+        } else {
+          void* out = (k == program.size() - 1)
+              ? static_cast<void*>(res_data + i0 * static_cast<int64_t>(res_elemsize))
+              : static_cast<void*>(arena.data() + (sp - 2) * FUSED_CHUNK * 8);
+          kernels[k](cn, vstack[sp-2].ptr, vstack[sp-2].stride,
+                         vstack[sp-1].ptr, vstack[sp-1].stride, out);
+          sp--;
+          vstack[sp-1].ptr = out;
+          vstack[sp-1].stride = 1;
+        }
+      }
+    }
+  });
+  if (dt::interrupt_requested()) {
+    delete res;
+    dt::throw_if_interrupted();
+  }
+  return res;
+}
+
+
+
 //------------------------------------------------------------------------------
 // Exported binaryop function
 //------------------------------------------------------------------------------
 
 Column* binaryop(int opcode, Column* lhs, Column* rhs)
 {
-  lhs->reify();
-  rhs->reify();
+  dt::perf::OpTimer optimer("expr.binaryop");
+  optimer.set_bytes(static_cast<int64_t>(lhs->alloc_size()) +
+                    static_cast<int64_t>(rhs->alloc_size()));
+  // Numeric operands that carry a rowindex (views from a filter or groupby
+  // sort) are no longer materialized: the generic mappers iterate through
+  // the indirection directly. String columns are still materialized, since
+  // the string mappers walk both offset arrays cumulatively; and when the
+  // operands carry two different rowindexes one side is materialized so
+  // that a single indirection serves the whole loop.
+  if (!lhs->is_fixedwidth()) lhs->reify();
+  if (!rhs->is_fixedwidth()) rhs->reify();
+  if (lhs->rowindex() && rhs->rowindex() &&
+      lhs->rowindex().ptr() != rhs->rowindex().ptr()) {
+    rhs->reify();
+  }
   int64_t lhs_nrows = lhs->nrows;
   int64_t rhs_nrows = rhs->nrows;
   if (lhs_nrows == 0 || rhs_nrows == 0) {
@@ -541,7 +998,110 @@ Column* binaryop(int opcode, Column* lhs, Column* rhs)
   int64_t nrows = std::max(lhs_nrows, rhs_nrows);
   (*mapfn)(0, nrows, params);
 
-  return static_cast<Column*>(params[2]);
+  Column* res = static_cast<Column*>(params[2]);
+
+  // Propagate validity bitmasks: for +, -, * the result is NA exactly where
+  // either operand is NA, so when both operands carry cached masks the
+  // result's mask is their byte-wise AND. This keeps masks flowing through
+  // chained expressions without ever rescanning the data.
+  if ((opcode == OpCode::Plus || opcode == OpCode::Minus ||
+       opcode == OpCode::Multiply) &&
+      lhs_nrows == rhs_nrows && nrows > 0 &&
+      lhs->has_validity_mask() && rhs->has_validity_mask()) {
+    const uint8_t* lmask = lhs->validity_mask();
+    const uint8_t* rmask = rhs->validity_mask();
+    if (lmask && rmask) {
+      size_t nbytes = (static_cast<size_t>(nrows) + 7) / 8;
+      MemoryRange mr = MemoryRange::mem(nbytes);
+      uint8_t* bits = static_cast<uint8_t*>(mr.wptr());
+      #pragma omp simd
+      for (size_t b = 0; b < nbytes; ++b) {
+        bits[b] = static_cast<uint8_t>(lmask[b] & rmask[b]);
+      }
+      res->set_validity_mask(std::move(mr));
+    }
+  }
+
+  // The relational kernels return false (not NA) for NA operands -- the
+  // semantics boolean filters rely on -- but consumers that must tell
+  // "false" apart from "NA operand" (e.g. ifelse(), which yields NA for an
+  // NA condition) need that information preserved. Attach it as a validity
+  // mask on the result, leaving the stored 0/1 values untouched. Operands
+  // that still carry a rowindex have no computable mask (validity_mask()
+  // returns nullptr on views), in which case nothing is attached.
+  if ((opcode == OpCode::Greater || opcode == OpCode::Less ||
+       opcode == OpCode::GreaterOrEqual || opcode == OpCode::LessOrEqual) &&
+      nrows > 0) {
+    const uint8_t* lmask = lhs->validity_mask();
+    const uint8_t* rmask = rhs->validity_mask();
+    if (lmask && rmask) {
+      size_t nbytes = (static_cast<size_t>(nrows) + 7) / 8;
+      MemoryRange mr = MemoryRange::mem(nbytes);
+      uint8_t* bits = static_cast<uint8_t*>(mr.wptr());
+      if (lhs_nrows == rhs_nrows) {
+        #pragma omp simd
+        for (size_t b = 0; b < nbytes; ++b) {
+          bits[b] = static_cast<uint8_t>(lmask[b] & rmask[b]);
+        }
+      } else {
+        // One side is a broadcast scalar: an NA scalar invalidates every
+        // row, a valid one leaves the other side's mask as the result.
+        const uint8_t* vec = (lhs_nrows == 1)? rmask : lmask;
+        bool scalar_valid = ((lhs_nrows == 1? lmask : rmask)[0] & 1) != 0;
+        if (scalar_valid) {
+          std::memcpy(bits, vec, nbytes);
+        } else {
+          std::memset(bits, 0, nbytes);
+        }
+      }
+      res->set_validity_mask(std::move(mr));
+    }
+  }
+
+  return res;
+}
+
+
+/**
+ * Lazy counterpart of `binaryop`: instead of computing the result eagerly,
+ * return a virtual column (see `Column::new_computed_column`) that stores the
+ * op and shallow copies of the operands, and only evaluates when the data is
+ * actually accessed. Chained transformations whose results are later filtered
+ * down, or never read at all, thus avoid materializing full-size
+ * intermediates. Falls back to eager evaluation for operand types the lazy
+ * path cannot handle (strings, incompatible shapes).
+ */
+Column* binaryop_virtual(int opcode, Column* lhs, Column* rhs)
+{
+  int64_t lhs_nrows = lhs->nrows;
+  int64_t rhs_nrows = rhs->nrows;
+  int64_t nrows = std::max(lhs_nrows, rhs_nrows);
+  bool compatible = (lhs_nrows == rhs_nrows ||
+                     lhs_nrows == 1 || rhs_nrows == 1);
+  // The ordering comparisons must stay eager: their result carries a
+  // validity mask recording which rows had NA operands (see `binaryop`),
+  // and a computed column materializes through a plain buffer write that
+  // would lose it.
+  bool relational = (opcode == OpCode::Greater || opcode == OpCode::Less ||
+                     opcode == OpCode::GreaterOrEqual ||
+                     opcode == OpCode::LessOrEqual);
+  SType ost = SType::VOID;
+  if (nrows == 0 || !compatible || relational ||
+      !fused_resolve0(lhs->stype(), rhs->stype(), opcode, ost)) {
+    return binaryop(opcode, lhs, rhs);
+  }
+  // The shallow copies (shared via the closure) keep the operands' data
+  // buffers alive until the column materializes, regardless of what happens
+  // to the original Column objects in the meantime.
+  std::shared_ptr<Column> arg1(lhs->shallowcopy());
+  std::shared_ptr<Column> arg2(rhs->shallowcopy());
+  return Column::new_computed_column(ost, nrows,
+    [opcode, arg1, arg2](void* out) {
+      Column* res = binaryop(opcode, arg1.get(), arg2.get());
+      std::memcpy(out, res->data(),
+                  static_cast<size_t>(res->nrows) * res->elemsize());
+      delete res;
+    });
 }
 
 };  // namespace expr
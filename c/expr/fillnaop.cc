@@ -0,0 +1,260 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+// This file implements the NA-imputation operation
+//     fillna(col, ...)
+// in two flavours:
+//
+//   * constant fill: every NA is replaced with a given value, in a single
+//     fused pass over the data (the blend against the NA sentinel is a
+//     plain branch-minimal loop that the compiler vectorizes);
+//
+//   * forward / backward fill: every NA takes the nearest preceding
+//     (resp. following) non-NA value, via a rowindex that maps every row
+//     either to itself or to the physical row holding the carried value.
+//     When every row finds a carry the result is a plain virtual view and
+//     no data is copied; rows with no carry (a leading NA run) cannot be
+//     represented in a RowIndex, so in that case the view is materialized
+//     and those rows are overwritten with NA (see shiftop.cc).
+//     The ungrouped scan is parallelized with a two-pass chunk algorithm:
+//     each chunk is scanned independently carrying its own last-valid row,
+//     the per-chunk carries are stitched sequentially, and a second pass
+//     patches the leading NA run of every chunk. When a Groupby is given
+//     the carry restarts at every group boundary instead.
+//------------------------------------------------------------------------------
+#include "expr/py_expr.h"
+#include "types.h"
+#include "utils/omp.h"
+
+
+namespace expr
+{
+
+//------------------------------------------------------------------------------
+// Constant fill
+//------------------------------------------------------------------------------
+
+template <typename T>
+static Column* fillna_const_fw(Column* arg, Column* val)
+{
+  int64_t n = arg->nrows;
+  T fill = static_cast<const T*>(val->data())[0];
+  Column* res = Column::new_data_column(arg->stype(), n);
+  const T* in = static_cast<const T*>(arg->data());
+  T* out = static_cast<T*>(res->data_w());
+  #pragma omp parallel for schedule(static)
+  for (int64_t i = 0; i < n; ++i) {
+    T x = in[i];
+    out[i] = ISNA<T>(x)? fill : x;
+  }
+  return res;
+}
+
+
+Column* fillna_const(Column* arg, Column* val)
+{
+  if (val->stype() != arg->stype()) {
+    throw ValueError() << "The fill value must have the same stype as the "
+        "column being filled: " << arg->stype() << " vs " << val->stype();
+  }
+  if (val->nrows != 1) {
+    throw ValueError() << "The fill value must be a single-row column, got "
+        << val->nrows << " rows";
+  }
+  arg->reify();
+  val->reify();
+  switch (arg->stype()) {
+    case SType::BOOL:
+    case SType::INT8:    return fillna_const_fw<int8_t>(arg, val);
+    case SType::INT16:   return fillna_const_fw<int16_t>(arg, val);
+    case SType::INT32:   return fillna_const_fw<int32_t>(arg, val);
+    case SType::INT64:   return fillna_const_fw<int64_t>(arg, val);
+    case SType::FLOAT32: return fillna_const_fw<float>(arg, val);
+    case SType::FLOAT64: return fillna_const_fw<double>(arg, val);
+    default:
+      throw TypeError() << "fillna() with a constant cannot be applied to a "
+          "column of stype " << arg->stype();
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+// Forward / backward fill
+//------------------------------------------------------------------------------
+
+// Check whether a physical row of the column holds a valid (non-NA) value.
+// `data` is the column's data buffer for fixed-width types, or the offsets
+// buffer for string types (where NA is encoded in the offset's NA bit).
+typedef bool (*validfn)(const void* data, int64_t j);
+
+template <typename T>
+static bool elem_valid(const void* data, int64_t j) {
+  return !ISNA<T>(static_cast<const T*>(data)[j]);
+}
+
+
+// Scan the logical rows [r0; r1) in the direction `dir` (+1 forward, -1
+// backward), writing into `indp[i]` the physical index of the row whose
+// value row `i` should take: its own when valid, the carried last-valid
+// row otherwise, GETNA while no valid row has been seen yet. Returns the
+// final carry.
+static int32_t fill_scan(validfn is_valid, const void* data,
+                         const int32_t* srcp, int32_t* indp,
+                         int64_t r0, int64_t r1, int dir)
+{
+  int32_t carry = GETNA<int32_t>();
+  int64_t i0 = dir > 0? r0 : r1 - 1;
+  int64_t i1 = dir > 0? r1 : r0 - 1;
+  for (int64_t i = i0; i != i1; i += dir) {
+    int32_t j = srcp? srcp[i] : static_cast<int32_t>(i);
+    if (!ISNA<int32_t>(j) && is_valid(data, j)) {
+      carry = j;
+      indp[i] = j;
+    } else {
+      indp[i] = carry;
+    }
+  }
+  return carry;
+}
+
+
+// Patch the leading NA run of the chunk [r0; r1) (trailing run when
+// scanning backward) with the carry `p` stitched from the previous chunks.
+static void fill_fixup(int32_t* indp, int64_t r0, int64_t r1, int dir,
+                       int32_t p)
+{
+  if (ISNA<int32_t>(p)) return;
+  int64_t i0 = dir > 0? r0 : r1 - 1;
+  int64_t i1 = dir > 0? r1 : r0 - 1;
+  for (int64_t i = i0; i != i1; i += dir) {
+    if (!ISNA<int32_t>(indp[i])) break;
+    indp[i] = p;
+  }
+}
+
+
+Column* fillna_dir(Column* arg, bool backward, const Groupby& groupby)
+{
+  int64_t n = arg->nrows;
+  Column* res = arg->shallowcopy();
+  if (n == 0) return res;
+  if (n > std::numeric_limits<int32_t>::max()) {
+    throw NotImplError() << "fillna() cannot be applied to a column with "
+        << n << " rows";
+  }
+  int dir = backward? -1 : +1;
+
+  validfn is_valid = nullptr;
+  const void* data = arg->data();
+  switch (arg->stype()) {
+    case SType::BOOL:
+    case SType::INT8:    is_valid = elem_valid<int8_t>; break;
+    case SType::INT16:   is_valid = elem_valid<int16_t>; break;
+    case SType::INT32:   is_valid = elem_valid<int32_t>; break;
+    case SType::INT64:   is_valid = elem_valid<int64_t>; break;
+    case SType::FLOAT32: is_valid = elem_valid<float>; break;
+    case SType::FLOAT64: is_valid = elem_valid<double>; break;
+    case SType::STR32:
+      is_valid = elem_valid<uint32_t>;
+      data = static_cast<StringColumn<uint32_t>*>(arg)->offsets();
+      break;
+    case SType::STR64:
+      is_valid = elem_valid<uint64_t>;
+      data = static_cast<StringColumn<uint64_t>*>(arg)->offsets();
+      break;
+    default:
+      throw TypeError() << "fillna() cannot be applied to a column of stype "
+          << arg->stype();
+  }
+
+  // Logical-to-physical map of the argument (see shiftop.cc): both the
+  // validity test and the stored indices must refer to physical rows.
+  arr32_t src;
+  const int32_t* srcp = nullptr;
+  if (arg->rowindex()) {
+    src = arg->rowindex().extract_as_array32();
+    srcp = src.data();
+  }
+
+  arr32_t ind(static_cast<size_t>(n));
+  int32_t* indp = ind.data();
+
+  int32_t ngrps = static_cast<int32_t>(groupby.ngroups());
+  if (ngrps > 1) {
+    const int32_t* grps = groupby.offsets_r();
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (int32_t g = 0; g < ngrps; ++g) {
+      fill_scan(is_valid, data, srcp, indp, grps[g], grps[g + 1], dir);
+    }
+  } else {
+    int nth = omp_get_max_threads();
+    if (n < 65536 || nth <= 1) {
+      fill_scan(is_valid, data, srcp, indp, 0, n, dir);
+    } else {
+      int64_t chunklen = (n + nth - 1) / nth;
+      std::vector<int32_t> carries(static_cast<size_t>(nth));
+      #pragma omp parallel num_threads(nth)
+      {
+        int k = omp_get_thread_num();
+        int64_t c0 = k * chunklen;
+        int64_t c1 = std::min(c0 + chunklen, n);
+        int32_t carry = GETNA<int32_t>();
+        if (c0 < c1) {
+          carry = fill_scan(is_valid, data, srcp, indp, c0, c1, dir);
+        }
+        carries[static_cast<size_t>(k)] = carry;
+        #pragma omp barrier
+        #pragma omp single
+        {
+          // Sequential stitch: replace each chunk's carry with the last
+          // valid row seen in any chunk before it (in scan order).
+          int32_t run = GETNA<int32_t>();
+          int kb = dir > 0? 0 : nth - 1;
+          for (int t = 0; t < nth; ++t, kb += dir) {
+            int32_t c = carries[static_cast<size_t>(kb)];
+            carries[static_cast<size_t>(kb)] = run;
+            if (!ISNA<int32_t>(c)) run = c;
+          }
+        }
+        // (implicit barrier at the end of `single`)
+        if (c0 < c1) {
+          fill_fixup(indp, c0, c1, dir, carries[static_cast<size_t>(k)]);
+        }
+      }
+    }
+  }
+
+  // Rows with no carry at all (nothing valid before/after them) are still
+  // GETNA in `ind`. NA entries are not legal in a RowIndex outside the
+  // join materialization path, so when any remain, point them at
+  // themselves, materialize the view, and overwrite them with NA.
+  int64_t nempty = 0;
+  #pragma omp parallel for schedule(static) reduction(+:nempty)
+  for (int64_t i = 0; i < n; ++i) {
+    nempty += ISNA<int32_t>(indp[i]);
+  }
+  if (nempty == 0) {
+    res->replace_rowindex(RowIndex::from_array32(std::move(ind)));
+    return res;
+  }
+  BoolColumn* mask = new BoolColumn(n);
+  int8_t* maskp = mask->elements_w();
+  #pragma omp parallel for schedule(static)
+  for (int64_t i = 0; i < n; ++i) {
+    bool empty = ISNA<int32_t>(indp[i]);
+    if (empty) indp[i] = srcp? srcp[i] : static_cast<int32_t>(i);
+    maskp[i] = empty;
+  }
+  res->replace_rowindex(RowIndex::from_array32(std::move(ind)));
+  res->reify();
+  res->apply_na_mask(mask);
+  delete mask;
+  return res;
+}
+
+};  // namespace expr
@@ -0,0 +1,658 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+// This file implements the fast path for conjunctive row filters such as
+// `(f.a > 0) & (f.b < 5)`. Instead of materializing each comparison into a
+// full boolean column and then ANDing those columns in further passes, the
+// predicates are evaluated together, one chunk of rows at a time, and the
+// indices of the surviving rows are written directly into the output
+// RowIndex. The only nrows-sized allocation is the index array itself.
+//
+// Within a chunk the predicates are ANDed in order, and as soon as no rows
+// of the chunk survive the remaining predicates are skipped. Each chunk
+// emits its indices independently; a prefix sum over the per-chunk counts
+// then stitches the results together in row order, so the resulting index
+// array is sorted and no chunk ever waits on another.
+//------------------------------------------------------------------------------
+#include "expr/py_expr.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "rowindex.h"
+#include "types.h"
+#include "utils/array.h"
+#include "utils/exceptions.h"
+#include "utils/interrupts.h"
+#include "utils/parallel.h"
+
+
+namespace expr
+{
+
+//------------------------------------------------------------------------------
+// Between (range) predicates
+//------------------------------------------------------------------------------
+
+/**
+ * A fused range predicate `a <op> x <op> b` over one numeric column: both
+ * bounds are checked in a single pass over the data (one load, two compares,
+ * one mask op per row) instead of two comparison passes plus an AND. For
+ * integer columns the bounds are pre-normalized to inclusive form and
+ * clamped to the type's valid range, so that the NA sentinel (the type's
+ * minimum) can never satisfy the lower bound; floating columns keep the
+ * strictness flags and rely on NaN comparisons being false to exclude NAs.
+ */
+struct BetweenInfo {
+  const Column* col;
+  const char* data;
+  SType st;
+  bool lo_strict;
+  bool hi_strict;
+  int : 8;
+  int32_t : 32;
+  int64_t ilo, ihi;    // inclusive bounds, integer columns
+  double flo, fhi;     // bounds, floating columns
+};
+
+
+template <typename T>
+static void between_int(const T* data, int64_t n, int64_t lo, int64_t hi,
+                        int8_t* out)
+{
+  for (int64_t i = 0; i < n; ++i) {
+    T v = data[i];
+    out[i] = static_cast<int8_t>((v >= lo) & (v <= hi));
+  }
+}
+
+template <typename T>
+static void between_real(const T* data, int64_t n, double lo, double hi,
+                         bool lo_strict, bool hi_strict, int8_t* out)
+{
+  for (int64_t i = 0; i < n; ++i) {
+    double v = static_cast<double>(data[i]);
+    out[i] = static_cast<int8_t>((lo_strict? v > lo : v >= lo) &&
+                                 (hi_strict? v < hi : v <= hi));
+  }
+}
+
+static void eval_between(const BetweenInfo& b, int64_t row0, int64_t n,
+                         int8_t* out)
+{
+  const void* ptr = b.data;
+  switch (b.st) {
+    case SType::BOOL:
+    case SType::INT8:
+      between_int(static_cast<const int8_t*>(ptr) + row0, n,
+                  b.ilo, b.ihi, out);
+      break;
+    case SType::INT16:
+      between_int(static_cast<const int16_t*>(ptr) + row0, n,
+                  b.ilo, b.ihi, out);
+      break;
+    case SType::INT32:
+      between_int(static_cast<const int32_t*>(ptr) + row0, n,
+                  b.ilo, b.ihi, out);
+      break;
+    case SType::INT64:
+      between_int(static_cast<const int64_t*>(ptr) + row0, n,
+                  b.ilo, b.ihi, out);
+      break;
+    case SType::FLOAT32:
+      between_real(static_cast<const float*>(ptr) + row0, n,
+                   b.flo, b.fhi, b.lo_strict, b.hi_strict, out);
+      break;
+    case SType::FLOAT64:
+      between_real(static_cast<const double*>(ptr) + row0, n,
+                   b.flo, b.fhi, b.lo_strict, b.hi_strict, out);
+      break;
+    default: break;
+  }
+}
+
+
+/**
+ * Binary searches over a column known to be sorted ascending with NAs at
+ * the front. Both predicates used here ("satisfies the lower bound" and
+ * "exceeds the upper bound") are false for NAs and monotone in that order,
+ * so a plain binary search finds the boundary.
+ */
+template <typename T>
+static int64_t bsearch_int(const T* data, int64_t n, int64_t c, bool ge) {
+  int64_t l = 0, r = n;
+  while (l < r) {
+    int64_t m = l + (r - l) / 2;
+    int64_t v = static_cast<int64_t>(data[m]);
+    bool pass = ge? (v >= c) : (v > c);
+    if (pass) r = m; else l = m + 1;
+  }
+  return l;
+}
+
+template <typename T>
+static int64_t bsearch_real(const T* data, int64_t n, double c,
+                            bool strict, bool lower)
+{
+  int64_t l = 0, r = n;
+  while (l < r) {
+    int64_t m = l + (r - l) / 2;
+    double v = static_cast<double>(data[m]);
+    bool pass = lower? (strict? v > c : v >= c)
+                     : (strict? v >= c : v > c);
+    if (pass) r = m; else l = m + 1;
+  }
+  return l;
+}
+
+static bool between_sorted_range(const BetweenInfo& b, int64_t n,
+                                 int64_t* start, int64_t* end)
+{
+  const void* ptr = b.data;
+  switch (b.st) {
+    case SType::BOOL:
+    case SType::INT8: {
+      auto data = static_cast<const int8_t*>(ptr);
+      *start = bsearch_int(data, n, b.ilo, true);
+      *end   = bsearch_int(data, n, b.ihi, false);
+      return true;
+    }
+    case SType::INT16: {
+      auto data = static_cast<const int16_t*>(ptr);
+      *start = bsearch_int(data, n, b.ilo, true);
+      *end   = bsearch_int(data, n, b.ihi, false);
+      return true;
+    }
+    case SType::INT32: {
+      auto data = static_cast<const int32_t*>(ptr);
+      *start = bsearch_int(data, n, b.ilo, true);
+      *end   = bsearch_int(data, n, b.ihi, false);
+      return true;
+    }
+    case SType::INT64: {
+      auto data = static_cast<const int64_t*>(ptr);
+      *start = bsearch_int(data, n, b.ilo, true);
+      *end   = bsearch_int(data, n, b.ihi, false);
+      return true;
+    }
+    case SType::FLOAT32: {
+      auto data = static_cast<const float*>(ptr);
+      *start = bsearch_real(data, n, b.flo, b.lo_strict, true);
+      *end   = bsearch_real(data, n, b.fhi, b.hi_strict, false);
+      return true;
+    }
+    case SType::FLOAT64: {
+      auto data = static_cast<const double*>(ptr);
+      *start = bsearch_real(data, n, b.flo, b.lo_strict, true);
+      *end   = bsearch_real(data, n, b.fhi, b.hi_strict, false);
+      return true;
+    }
+    default: return false;
+  }
+}
+
+
+/**
+ * Value of a 1-row numeric column as a double. Returns false when the
+ * value is NA, the column is not numeric, or (for int64) the value is too
+ * large to round-trip through a double exactly.
+ */
+static bool scalar_as_double(const Column* col, double* out) {
+  const void* p = col->data();
+  switch (col->stype()) {
+    case SType::BOOL:
+    case SType::INT8: {
+      int8_t v = *static_cast<const int8_t*>(p);
+      if (ISNA<int8_t>(v)) return false;
+      *out = static_cast<double>(v);
+      return true;
+    }
+    case SType::INT16: {
+      int16_t v = *static_cast<const int16_t*>(p);
+      if (ISNA<int16_t>(v)) return false;
+      *out = static_cast<double>(v);
+      return true;
+    }
+    case SType::INT32: {
+      int32_t v = *static_cast<const int32_t*>(p);
+      if (ISNA<int32_t>(v)) return false;
+      *out = static_cast<double>(v);
+      return true;
+    }
+    case SType::INT64: {
+      int64_t v = *static_cast<const int64_t*>(p);
+      if (ISNA<int64_t>(v)) return false;
+      if (v != static_cast<int64_t>(static_cast<double>(v))) return false;
+      *out = static_cast<double>(v);
+      return true;
+    }
+    case SType::FLOAT32: {
+      float v = *static_cast<const float*>(p);
+      if (ISNA<float>(v)) return false;
+      *out = static_cast<double>(v);
+      return true;
+    }
+    case SType::FLOAT64: {
+      double v = *static_cast<const double*>(p);
+      if (ISNA<double>(v)) return false;
+      *out = v;
+      return true;
+    }
+    default: return false;
+  }
+}
+
+
+RowIndex filter_conjunction(const std::vector<int>& opcodes,
+                            const std::vector<Column*>& lhs_cols,
+                            const std::vector<Column*>& rhs_cols,
+                            int64_t nrows)
+{
+  size_t np = opcodes.size();
+  if (np == 0 || np != lhs_cols.size() || np != rhs_cols.size()) {
+    throw ValueError() << "filter_conjunction: `ops`, `lhs_cols` and "
+        "`rhs_cols` must be non-empty lists of the same length";
+  }
+  if (nrows > std::numeric_limits<int32_t>::max()) {
+    throw NotImplError() << "filter_conjunction cannot be applied to a Frame "
+        "with " << nrows << " rows";
+  }
+
+  // Resolve each predicate into a fused kernel, and precompute the data
+  // pointer, element size and stride of each operand. A 1-row operand is
+  // broadcast over the whole column by giving it stride 0.
+  std::vector<fusedfn> fns(np);
+  std::vector<const char*> xptr(np), yptr(np);
+  std::vector<int64_t> xstep(np), ystep(np), xesz(np), yesz(np);
+  for (size_t p = 0; p < np; ++p) {
+    Column* lhs = lhs_cols[p];
+    Column* rhs = rhs_cols[p];
+    lhs->reify();
+    rhs->reify();
+    if (!((lhs->nrows == nrows || lhs->nrows == 1) &&
+          (rhs->nrows == nrows || rhs->nrows == 1))) {
+      throw ValueError() << "Cannot apply predicate " << p << " of a "
+          "conjunctive filter: operands have " << lhs->nrows << " and "
+          << rhs->nrows << " rows, while the Frame has " << nrows << " rows";
+    }
+    SType out_stype = lhs->stype();
+    fusedfn fn = fused_resolve0(lhs->stype(), rhs->stype(), opcodes[p],
+                                out_stype);
+    if (!fn || out_stype != SType::BOOL) {
+      throw NotImplError() << "Unable to compile predicate " << p << " of a "
+          "conjunctive filter: op " << opcodes[p] << " on stypes "
+          << lhs->stype() << " and " << rhs->stype();
+    }
+    fns[p] = fn;
+    xptr[p] = static_cast<const char*>(lhs->data());
+    yptr[p] = static_cast<const char*>(rhs->data());
+    xesz[p] = static_cast<int64_t>(info(lhs->stype()).elemsize());
+    yesz[p] = static_cast<int64_t>(info(rhs->stype()).elemsize());
+    xstep[p] = (lhs->nrows == 1)? 0 : 1;
+    ystep[p] = (rhs->nrows == 1)? 0 : 1;
+  }
+
+  // Zone-map pruning: for relational predicates between a full column and a
+  // scalar, fetch the column's per-chunk {min, max} bounds (built lazily,
+  // see Column::zone_map), so that chunks which cannot contain any matching
+  // row are skipped without reading their data. `op` is normalized to the
+  // form "column <op> constant". NotEqual is left out: rounded bounds
+  // cannot prove that every value of a chunk equals the constant.
+  struct PruneInfo {
+    const double* zones;
+    double c;
+    int op;
+    int op2;     // second bound of a fused range predicate, or 0
+    double c2;
+  };
+  std::vector<PruneInfo> prune(np, PruneInfo { nullptr, 0.0, 0, 0, 0.0 });
+  for (size_t p = 0; p < np; ++p) {
+    int op = opcodes[p];
+    if (!(op == OpCode::Equal || (op >= OpCode::Greater &&
+          op <= OpCode::LessOrEqual))) continue;
+    Column* colop = nullptr;
+    Column* cstop = nullptr;
+    if (lhs_cols[p]->nrows == nrows && rhs_cols[p]->nrows == 1) {
+      colop = lhs_cols[p];
+      cstop = rhs_cols[p];
+    } else if (lhs_cols[p]->nrows == 1 && rhs_cols[p]->nrows == nrows) {
+      colop = rhs_cols[p];
+      cstop = lhs_cols[p];
+      // mirror the comparison: `c > x` is `x < c`, etc.
+      op = op == OpCode::Greater? OpCode::Less :
+           op == OpCode::Less? OpCode::Greater :
+           op == OpCode::GreaterOrEqual? OpCode::LessOrEqual :
+           op == OpCode::LessOrEqual? OpCode::GreaterOrEqual : op;
+    }
+    if (!colop) continue;
+    double cval = 0;
+    const void* cdata = cstop->data();
+    switch (cstop->stype()) {
+      case SType::BOOL:
+      case SType::INT8: {
+        int8_t v = *static_cast<const int8_t*>(cdata);
+        if (ISNA<int8_t>(v)) continue;
+        cval = static_cast<double>(v);
+        break;
+      }
+      case SType::INT16: {
+        int16_t v = *static_cast<const int16_t*>(cdata);
+        if (ISNA<int16_t>(v)) continue;
+        cval = static_cast<double>(v);
+        break;
+      }
+      case SType::INT32: {
+        int32_t v = *static_cast<const int32_t*>(cdata);
+        if (ISNA<int32_t>(v)) continue;
+        cval = static_cast<double>(v);
+        break;
+      }
+      case SType::INT64: {
+        int64_t v = *static_cast<const int64_t*>(cdata);
+        if (ISNA<int64_t>(v)) continue;
+        cval = static_cast<double>(v);
+        break;
+      }
+      case SType::FLOAT32: {
+        float v = *static_cast<const float*>(cdata);
+        if (ISNA<float>(v)) continue;
+        cval = static_cast<double>(v);
+        break;
+      }
+      case SType::FLOAT64: {
+        double v = *static_cast<const double*>(cdata);
+        if (ISNA<double>(v)) continue;
+        cval = v;
+        break;
+      }
+      default: continue;
+    }
+    const double* zones = colop->zone_map();
+    if (zones) {
+      prune[p] = PruneInfo { zones, cval, op, 0, 0.0 };
+    }
+  }
+
+  // Between-fusion: `(f.x >= a) & (f.x < b)` -- the most common filter
+  // shape -- arrives here as two column-vs-scalar predicates over the same
+  // column. Each such pair is fused into a single range predicate that
+  // reads the column once per row, halving the memory traffic of the
+  // dominant case; the fused predicate inherits the zone-map bounds of
+  // both halves. When the whole filter reduces to one range over a column
+  // whose cached sorted flag is set, the result is found by binary search
+  // without scanning any data at all.
+  std::vector<BetweenInfo> between;
+  std::vector<int> bidx(np, -1);
+  std::vector<char> drop(np, 0);
+  {
+    struct BoundInfo { const Column* col; double c; int op; bool valid; };
+    std::vector<BoundInfo> bounds(np, BoundInfo { nullptr, 0.0, 0, false });
+    for (size_t p = 0; p < np; ++p) {
+      int op = opcodes[p];
+      if (!(op >= OpCode::Greater && op <= OpCode::LessOrEqual)) continue;
+      Column* colop = nullptr;
+      Column* cstop = nullptr;
+      if (lhs_cols[p]->nrows == nrows && rhs_cols[p]->nrows == 1) {
+        colop = lhs_cols[p];
+        cstop = rhs_cols[p];
+      } else if (lhs_cols[p]->nrows == 1 && rhs_cols[p]->nrows == nrows) {
+        colop = rhs_cols[p];
+        cstop = lhs_cols[p];
+        op = op == OpCode::Greater? OpCode::Less :
+             op == OpCode::Less? OpCode::Greater :
+             op == OpCode::GreaterOrEqual? OpCode::LessOrEqual :
+             OpCode::GreaterOrEqual;
+      }
+      if (!colop) continue;
+      SType st = colop->stype();
+      if (!(st == SType::BOOL || st == SType::INT8 || st == SType::INT16 ||
+            st == SType::INT32 || st == SType::INT64 ||
+            st == SType::FLOAT32 || st == SType::FLOAT64)) continue;
+      double c;
+      if (!scalar_as_double(cstop, &c)) continue;
+      bounds[p] = BoundInfo { colop, c, op, true };
+    }
+    for (size_t p = 0; p < np; ++p) {
+      if (bidx[p] >= 0 || !bounds[p].valid) continue;
+      bool p_lower = (bounds[p].op == OpCode::Greater ||
+                      bounds[p].op == OpCode::GreaterOrEqual);
+      for (size_t q = p + 1; q < np; ++q) {
+        if (bidx[q] >= 0 || !bounds[q].valid) continue;
+        if (bounds[q].col->data() != bounds[p].col->data()) continue;
+        if (bounds[q].col->stype() != bounds[p].col->stype()) continue;
+        bool q_lower = (bounds[q].op == OpCode::Greater ||
+                        bounds[q].op == OpCode::GreaterOrEqual);
+        if (q_lower == p_lower) continue;
+        const BoundInfo& lob = p_lower? bounds[p] : bounds[q];
+        const BoundInfo& upb = p_lower? bounds[q] : bounds[p];
+        BetweenInfo b;
+        b.col = lob.col;
+        b.data = static_cast<const char*>(lob.col->data());
+        b.st = lob.col->stype();
+        b.lo_strict = (lob.op == OpCode::Greater);
+        b.hi_strict = (upb.op == OpCode::Less);
+        b.flo = lob.c;
+        b.fhi = upb.c;
+        b.ilo = 0;
+        b.ihi = -1;
+        if (b.st != SType::FLOAT32 && b.st != SType::FLOAT64) {
+          // Normalize to inclusive integer bounds: `x > 2.5` is `x >= 3`,
+          // `x < 2.5` is `x <= 2`, etc.
+          int64_t ilo = b.lo_strict
+              ? static_cast<int64_t>(std::floor(b.flo)) + 1
+              : static_cast<int64_t>(std::ceil(b.flo));
+          int64_t ihi = b.hi_strict
+              ? static_cast<int64_t>(std::ceil(b.fhi)) - 1
+              : static_cast<int64_t>(std::floor(b.fhi));
+          int64_t tmin, tmax;
+          switch (b.st) {
+            case SType::BOOL:
+            case SType::INT8:  tmin = -127;   tmax = 127;   break;
+            case SType::INT16: tmin = -32767; tmax = 32767; break;
+            case SType::INT32: tmin = -std::numeric_limits<int32_t>::max();
+                               tmax = std::numeric_limits<int32_t>::max();
+                               break;
+            default:           tmin = -std::numeric_limits<int64_t>::max();
+                               tmax = std::numeric_limits<int64_t>::max();
+                               break;
+          }
+          b.ilo = std::max(ilo, tmin);
+          b.ihi = std::min(ihi, tmax);
+        }
+        // Predicate `p` becomes the range predicate and absorbs `q`'s
+        // zone-map bound; predicate `q` is dropped.
+        if (prune[q].zones) {
+          if (prune[p].zones) {
+            prune[p].op2 = prune[q].op;
+            prune[p].c2 = prune[q].c;
+          } else {
+            prune[p] = prune[q];
+          }
+        }
+        bidx[p] = static_cast<int>(between.size());
+        between.push_back(b);
+        drop[q] = 1;
+        break;
+      }
+    }
+    if (!between.empty()) {
+      size_t k = 0;
+      for (size_t p = 0; p < np; ++p) {
+        if (drop[p]) continue;
+        if (k != p) {
+          fns[k] = fns[p];
+          xptr[k] = xptr[p];   yptr[k] = yptr[p];
+          xstep[k] = xstep[p]; ystep[k] = ystep[p];
+          xesz[k] = xesz[p];   yesz[k] = yesz[p];
+          prune[k] = prune[p];
+          bidx[k] = bidx[p];
+        }
+        k++;
+      }
+      np = k;
+    }
+  }
+
+  // A single range predicate over a column already known to be sorted:
+  // both boundaries are found by binary search, and the result is a slice.
+  if (np == 1 && bidx[0] >= 0 &&
+      between[static_cast<size_t>(bidx[0])].col->is_sorted_cached()) {
+    const BetweenInfo& b = between[static_cast<size_t>(bidx[0])];
+    int64_t start = 0, end = 0;
+    if (between_sorted_range(b, nrows, &start, &end)) {
+      if (end < start) end = start;
+      return RowIndex::from_slice(start, end - start, 1);
+    }
+  }
+
+  // Each chunk writes the indices of its surviving rows into its own slot
+  // of `scratch` (at the chunk's base row, so slots never overlap), and
+  // records how many it wrote. An exclusive prefix sum over those counts
+  // then gives every chunk its final position, and the results are stitched
+  // together with parallel memcpys -- no ordered section, so chunks never
+  // wait on one another.
+  arr32_t scratch(static_cast<size_t>(nrows));
+  // One filter chunk per zone-map chunk, so zone indices line up directly
+  int64_t rows_per_chunk = Column::ZONE_NROWS;
+  int64_t num_chunks = (nrows + rows_per_chunk - 1) / rows_per_chunk;
+  size_t zrows_per_chunk = static_cast<size_t>(rows_per_chunk);
+  dt::array<int64_t> offs(static_cast<size_t>(num_chunks) + 1);
+
+  dt::clear_interrupt();
+  dt::run_parallel([&](int ith, int nth) {
+    // `mask` accumulates the conjunction over the current chunk; `tmp` holds
+    // the raw output of the second and subsequent predicates before it is
+    // ANDed into `mask`.
+    std::vector<int8_t> mask(zrows_per_chunk);
+    std::vector<int8_t> tmp(np > 1? zrows_per_chunk : 0);
+
+    // Static chunk->thread assignment, matching the partition that an
+    // expression kernel over the same frame would use: the operand rows a
+    // thread is about to scan are then the ones it already pulled into its
+    // core's cache while computing them. Zone-map pruning can skew the real
+    // per-chunk cost, but a pruned chunk costs so little that the imbalance
+    // stays negligible next to the affinity win.
+    int64_t cfirst = num_chunks * ith / nth;
+    int64_t clast = num_chunks * (ith + 1) / nth;
+    for (int64_t ichunk = cfirst; ichunk < clast; ++ichunk) {
+      // Cancellation point, once per chunk: thread 0 polls for pending
+      // Python signals, the others just watch the abort flag.
+      if (ith == 0) dt::poll_interrupts();
+      if (dt::interrupt_requested()) break;
+      int64_t row0 = ichunk * rows_per_chunk;
+      int64_t row1 = std::min(row0 + rows_per_chunk, nrows);
+      int64_t cn = row1 - row0;
+
+      // Consult the zone maps first: if any predicate's bounds prove that
+      // no row of this chunk can match, skip the chunk without touching
+      // its data. NA rows never satisfy a relational predicate, so chunks
+      // with no valid values (min > max) are always prunable here.
+      bool pruned = false;
+      for (size_t p = 0; p < np; ++p) {
+        if (!prune[p].zones) continue;
+        double zmin = prune[p].zones[ichunk * 2];
+        double zmax = prune[p].zones[ichunk * 2 + 1];
+        double c = prune[p].c;
+        bool may = zmin <= zmax;
+        if (may) {
+          switch (prune[p].op) {
+            case OpCode::Greater:        may = zmax > c; break;
+            case OpCode::GreaterOrEqual: may = zmax >= c; break;
+            case OpCode::Less:           may = zmin < c; break;
+            case OpCode::LessOrEqual:    may = zmin <= c; break;
+            case OpCode::Equal:          may = zmin <= c && zmax >= c; break;
+            default: break;
+          }
+        }
+        if (may && prune[p].op2) {
+          double c2 = prune[p].c2;
+          switch (prune[p].op2) {
+            case OpCode::Greater:        may = zmax > c2; break;
+            case OpCode::GreaterOrEqual: may = zmax >= c2; break;
+            case OpCode::Less:           may = zmin < c2; break;
+            case OpCode::LessOrEqual:    may = zmin <= c2; break;
+            default: break;
+          }
+        }
+        if (!may) { pruned = true; break; }
+      }
+      if (pruned) {
+        offs[static_cast<size_t>(ichunk)] = 0;
+        continue;
+      }
+
+      // Evaluate the predicates over this chunk, ANDing the results into
+      // `mask`. A predicate yields 1/0/NA per row; only 1 keeps the row.
+      // Once no rows of the chunk survive, the remaining predicates are
+      // skipped entirely.
+      int8_t any = 0;
+      for (size_t p = 0; p < np; ++p) {
+        int8_t* out = (p == 0)? mask.data() : tmp.data();
+        if (bidx[p] >= 0) {
+          eval_between(between[static_cast<size_t>(bidx[p])], row0, cn, out);
+        } else {
+          fns[p](cn, xptr[p] + row0 * xstep[p] * xesz[p], xstep[p],
+                     yptr[p] + row0 * ystep[p] * yesz[p], ystep[p], out);
+        }
+        any = 0;
+        if (p == 0) {
+          for (int64_t i = 0; i < cn; ++i) {
+            int8_t v = (mask[i] == 1);
+            mask[i] = v;
+            any |= v;
+          }
+        } else {
+          for (int64_t i = 0; i < cn; ++i) {
+            int8_t v = mask[i] & (tmp[i] == 1);
+            mask[i] = v;
+            any |= v;
+          }
+        }
+        if (!any) break;
+      }
+
+      int32_t* out = scratch.data() + row0;
+      int64_t k = 0;
+      if (any) {
+        for (int64_t i = 0; i < cn; ++i) {
+          if (mask[i]) out[k++] = static_cast<int32_t>(row0 + i);
+        }
+      }
+      offs[static_cast<size_t>(ichunk)] = k;
+    }
+  });
+  // Rethrow a pending KeyboardInterrupt before stitching: aborted chunks
+  // left their `offs` slots unfilled, so the partial result is unusable.
+  dt::throw_if_interrupted();
+
+  int64_t total = 0;
+  for (int64_t c = 0; c < num_chunks; ++c) {
+    int64_t t = offs[static_cast<size_t>(c)];
+    offs[static_cast<size_t>(c)] = total;
+    total += t;
+  }
+  offs[static_cast<size_t>(num_chunks)] = total;
+
+  arr32_t ind(static_cast<size_t>(total));
+  // Same static partition as the predicate pass, so each chunk's indices
+  // are copied out by the thread that wrote them into `scratch`.
+  dt::parallel_for_static(num_chunks, 1,
+    [&](int64_t c0, int64_t c1, int) {
+      for (int64_t c = c0; c < c1; ++c) {
+        int64_t dest0 = offs[static_cast<size_t>(c)];
+        int64_t len = offs[static_cast<size_t>(c) + 1] - dest0;
+        if (len) {
+          std::memcpy(ind.data() + dest0, scratch.data() + c * rows_per_chunk,
+                      static_cast<size_t>(len) * sizeof(int32_t));
+        }
+      }
+    });
+  return RowIndex::from_array32(std::move(ind), true);
+}
+
+};  // namespace expr
@@ -8,8 +8,74 @@
 #define dt_EXPR_PY_EXPR_CC
 #include "expr/py_expr.h"
 #include <Python.h>
+#include <string>
+#include <unordered_map>
 #include "python/obj.h"
 #include "py_column.h"
+#include "py_rowindex.h"
+
+
+//------------------------------------------------------------------------------
+// Expression-result cache
+//------------------------------------------------------------------------------
+// Materialized results of whole-expression evaluations, keyed by a string
+// that encodes the expression together with the source frame's
+// `cache_version` stamp (the key is assembled on the Python side, see
+// cols_node.py). Since the stamp folds in the mutation ids of the frame's
+// columns, any mutation of the frame changes the key and the stale entry
+// simply ages out. Both storing and retrieving use shallow copies, so the
+// cache never shares a Column object with its clients. Eviction is LRU with
+// a small fixed capacity, same scheme as the frame's sort cache.
+
+struct ExprCacheEntry {
+  Column* column;
+  uint64_t last_used;
+};
+
+static std::unordered_map<std::string, ExprCacheEntry> expr_cache;
+static uint64_t expr_cache_clock = 0;
+static constexpr size_t EXPR_CACHE_MAXSIZE = 64;
+
+
+PyObject* expr_cache_lookup(PyObject*, PyObject* args)
+{
+  const char* key;
+  if (!PyArg_ParseTuple(args, "s:expr_cache_lookup", &key))
+    return nullptr;
+
+  auto it = expr_cache.find(key);
+  if (it == expr_cache.end()) return none();
+  it->second.last_used = ++expr_cache_clock;
+  return pycolumn::from_column(it->second.column->shallowcopy(), nullptr, 0);
+}
+
+
+PyObject* expr_cache_store(PyObject*, PyObject* args)
+{
+  const char* key;
+  PyObject* arg2;
+  if (!PyArg_ParseTuple(args, "sO:expr_cache_store", &key, &arg2))
+    return nullptr;
+  Column* col = py::obj(arg2).to_column();
+
+  auto it = expr_cache.find(key);
+  if (it != expr_cache.end()) {
+    delete it->second.column;
+    it->second.column = col->shallowcopy();
+    it->second.last_used = ++expr_cache_clock;
+    return none();
+  }
+  if (expr_cache.size() >= EXPR_CACHE_MAXSIZE) {
+    auto lru = expr_cache.begin();
+    for (auto j = expr_cache.begin(); j != expr_cache.end(); ++j) {
+      if (j->second.last_used < lru->second.last_used) lru = j;
+    }
+    delete lru->second.column;
+    expr_cache.erase(lru);
+  }
+  expr_cache[key] = ExprCacheEntry { col->shallowcopy(), ++expr_cache_clock };
+  return none();
+}
 
 
 PyObject* expr_binaryop(PyObject*, PyObject* args)
@@ -24,11 +90,125 @@ PyObject* expr_binaryop(PyObject*, PyObject* args)
 
   Column* lhs = py_lhs.to_column();
   Column* rhs = py_rhs.to_column();
-  Column* res = expr::binaryop(opcode, lhs, rhs);
+  Column* res = expr::binaryop_virtual(opcode, lhs, rhs);
+  return pycolumn::from_column(res, nullptr, 0);
+}
+
+
+PyObject* expr_fused_binaryop(PyObject*, PyObject* args)
+{
+  PyObject *arg1, *arg2;
+  if (!PyArg_ParseTuple(args, "OO:expr_fused_binaryop", &arg1, &arg2))
+    return nullptr;
+
+  PyObject* progseq = PySequence_Fast(arg1, "expr_fused_binaryop: `program` "
+                                            "must be a list of instructions");
+  if (!progseq) return nullptr;
+  PyObject* colseq = PySequence_Fast(arg2, "expr_fused_binaryop: `cols` must "
+                                           "be a list of columns");
+  if (!colseq) {
+    Py_DECREF(progseq);
+    return nullptr;
+  }
+  size_t prog_n = static_cast<size_t>(PySequence_Fast_GET_SIZE(progseq));
+  size_t cols_n = static_cast<size_t>(PySequence_Fast_GET_SIZE(colseq));
+
+  std::vector<int> program;
+  program.reserve(prog_n);
+  for (size_t k = 0; k < prog_n; ++k) {
+    program.push_back(static_cast<int>(
+        PyLong_AsLong(PySequence_Fast_GET_ITEM(progseq, k))));
+  }
+  std::vector<Column*> columns;
+  columns.reserve(cols_n);
+  for (size_t k = 0; k < cols_n; ++k) {
+    columns.push_back(py::obj(PySequence_Fast_GET_ITEM(colseq, k)).to_column());
+  }
+  Py_DECREF(progseq);
+  Py_DECREF(colseq);
+
+  // The fused evaluator is pure native code (object columns are rejected
+  // during kernel resolution), so other queries may run while it works.
+  bool native_only = true;
+  for (Column* c : columns) native_only &= (c->stype() != SType::OBJ);
+  Column* res = nullptr;
+  if (native_only) {
+    GILReleased gil;
+    res = expr::fused_binaryop(program, columns);
+  } else {
+    res = expr::fused_binaryop(program, columns);
+  }
   return pycolumn::from_column(res, nullptr, 0);
 }
 
 
+PyObject* expr_filter_conjunction(PyObject*, PyObject* args)
+{
+  PyObject *arg1, *arg2, *arg3;
+  long long nrows;
+  if (!PyArg_ParseTuple(args, "OOOL:expr_filter_conjunction",
+                        &arg1, &arg2, &arg3, &nrows))
+    return nullptr;
+
+  PyObject* opseq = PySequence_Fast(arg1, "expr_filter_conjunction: `ops` "
+                                          "must be a list of opcodes");
+  if (!opseq) return nullptr;
+  PyObject* lseq = PySequence_Fast(arg2, "expr_filter_conjunction: "
+                                         "`lhs_cols` must be a list of columns");
+  if (!lseq) {
+    Py_DECREF(opseq);
+    return nullptr;
+  }
+  PyObject* rseq = PySequence_Fast(arg3, "expr_filter_conjunction: "
+                                         "`rhs_cols` must be a list of columns");
+  if (!rseq) {
+    Py_DECREF(opseq);
+    Py_DECREF(lseq);
+    return nullptr;
+  }
+  size_t nops = static_cast<size_t>(PySequence_Fast_GET_SIZE(opseq));
+  if (nops != static_cast<size_t>(PySequence_Fast_GET_SIZE(lseq)) ||
+      nops != static_cast<size_t>(PySequence_Fast_GET_SIZE(rseq))) {
+    Py_DECREF(opseq);
+    Py_DECREF(lseq);
+    Py_DECREF(rseq);
+    throw ValueError() << "expr_filter_conjunction: `ops`, `lhs_cols` and "
+        "`rhs_cols` must have the same length";
+  }
+
+  std::vector<int> opcodes;
+  std::vector<Column*> lhs_cols, rhs_cols;
+  opcodes.reserve(nops);
+  lhs_cols.reserve(nops);
+  rhs_cols.reserve(nops);
+  for (size_t k = 0; k < nops; ++k) {
+    opcodes.push_back(static_cast<int>(
+        PyLong_AsLong(PySequence_Fast_GET_ITEM(opseq, k))));
+    lhs_cols.push_back(py::obj(PySequence_Fast_GET_ITEM(lseq, k)).to_column());
+    rhs_cols.push_back(py::obj(PySequence_Fast_GET_ITEM(rseq, k)).to_column());
+  }
+  Py_DECREF(opseq);
+  Py_DECREF(lseq);
+  Py_DECREF(rseq);
+
+  bool native_only = true;
+  for (size_t k = 0; k < nops; ++k) {
+    native_only &= (lhs_cols[k]->stype() != SType::OBJ) &&
+                   (rhs_cols[k]->stype() != SType::OBJ);
+  }
+  RowIndex ri;
+  if (native_only) {
+    GILReleased gil;
+    ri = expr::filter_conjunction(opcodes, lhs_cols, rhs_cols,
+                                  static_cast<int64_t>(nrows));
+  } else {
+    ri = expr::filter_conjunction(opcodes, lhs_cols, rhs_cols,
+                                  static_cast<int64_t>(nrows));
+  }
+  return pyrowindex::wrap(ri);
+}
+
+
 PyObject* expr_cast(PyObject*, PyObject* args)
 {
   int stype;
@@ -85,6 +265,161 @@ PyObject* expr_reduceop(PyObject*, PyObject* args)
   return pycolumn::from_column(res, nullptr, 0);
 }
 
+PyObject* expr_cumulativeop(PyObject*, PyObject* args)
+{
+  int opcode;
+  PyObject* arg1, *arg2;
+  if (!PyArg_ParseTuple(args, "iOO:expr_cumulativeop", &opcode, &arg1, &arg2))
+    return nullptr;
+  py::obj pyarg1(arg1);
+  py::obj pyarg2(arg2);
+
+  Column* col = pyarg1.to_column();
+  Groupby* grpby = pyarg2.to_groupby();
+  Column* res = nullptr;
+  if (grpby) {
+    res = expr::cumulativeop(opcode, col, *grpby);
+  } else {
+    Groupby gb = Groupby::single_group(col->nrows);
+    res = expr::cumulativeop(opcode, col, gb);
+  }
+  return pycolumn::from_column(res, nullptr, 0);
+}
+
+PyObject* expr_shiftop(PyObject*, PyObject* args)
+{
+  long long k;
+  PyObject* arg1, *arg2;
+  if (!PyArg_ParseTuple(args, "OLO:expr_shiftop", &arg1, &k, &arg2))
+    return nullptr;
+  py::obj pyarg1(arg1);
+  py::obj pyarg2(arg2);
+
+  Column* col = pyarg1.to_column();
+  Groupby* grpby = pyarg2.to_groupby();
+  Column* res = nullptr;
+  if (grpby) {
+    res = expr::shiftop(col, static_cast<int64_t>(k), *grpby);
+  } else {
+    Groupby gb = Groupby::single_group(col->nrows);
+    res = expr::shiftop(col, static_cast<int64_t>(k), gb);
+  }
+  return pycolumn::from_column(res, nullptr, 0);
+}
+
+PyObject* expr_fillna_const(PyObject*, PyObject* args)
+{
+  PyObject* arg1;
+  PyObject* arg2;
+  if (!PyArg_ParseTuple(args, "OO:expr_fillna_const", &arg1, &arg2))
+    return nullptr;
+
+  Column* col = py::obj(arg1).to_column();
+  Column* val = py::obj(arg2).to_column();
+  Column* res = expr::fillna_const(col, val);
+  return pycolumn::from_column(res, nullptr, 0);
+}
+
+PyObject* expr_fillna_dir(PyObject*, PyObject* args)
+{
+  int backward;
+  PyObject* arg1, *arg2;
+  if (!PyArg_ParseTuple(args, "OpO:expr_fillna_dir", &arg1, &backward, &arg2))
+    return nullptr;
+  py::obj pyarg1(arg1);
+  py::obj pyarg2(arg2);
+
+  Column* col = pyarg1.to_column();
+  Groupby* grpby = pyarg2.to_groupby();
+  Column* res = nullptr;
+  if (grpby) {
+    res = expr::fillna_dir(col, backward != 0, *grpby);
+  } else {
+    Groupby gb = Groupby::single_group(col->nrows);
+    res = expr::fillna_dir(col, backward != 0, gb);
+  }
+  return pycolumn::from_column(res, nullptr, 0);
+}
+
+PyObject* expr_rollingop(PyObject*, PyObject* args)
+{
+  int opcode;
+  long long window;
+  PyObject *arg1, *arg2;
+  if (!PyArg_ParseTuple(args, "iOOL:expr_rollingop",
+                        &opcode, &arg1, &arg2, &window))
+    return nullptr;
+  py::obj pyarg1(arg1);
+  py::obj pyarg2(arg2);
+
+  Column* col = pyarg1.to_column();
+  Groupby* grpby = pyarg2.to_groupby();
+  Column* res = nullptr;
+  if (grpby) {
+    res = expr::rollingop(opcode, col, *grpby,
+                          static_cast<int64_t>(window));
+  } else {
+    Groupby gb = Groupby::single_group(col->nrows);
+    res = expr::rollingop(opcode, col, gb, static_cast<int64_t>(window));
+  }
+  return pycolumn::from_column(res, nullptr, 0);
+}
+
+
+PyObject* expr_reduceop_multi(PyObject*, PyObject* args)
+{
+  PyObject *arg1, *arg2, *arg3;
+  if (!PyArg_ParseTuple(args, "OOO:expr_reduceop_multi", &arg1, &arg2, &arg3))
+    return nullptr;
+  py::obj pyarg3(arg3);
+  Groupby* grpby = pyarg3.to_groupby();
+
+  PyObject* opseq = PySequence_Fast(arg1, "expr_reduceop_multi: `ops` must "
+                                          "be a list of opcodes");
+  if (!opseq) return nullptr;
+  PyObject* colseq = PySequence_Fast(arg2, "expr_reduceop_multi: `cols` must "
+                                           "be a list of columns");
+  if (!colseq) {
+    Py_DECREF(opseq);
+    return nullptr;
+  }
+  size_t nops = static_cast<size_t>(PySequence_Fast_GET_SIZE(opseq));
+  if (nops != static_cast<size_t>(PySequence_Fast_GET_SIZE(colseq))) {
+    Py_DECREF(opseq);
+    Py_DECREF(colseq);
+    throw ValueError() << "expr_reduceop_multi: `ops` and `cols` must have "
+        "the same length";
+  }
+
+  std::vector<std::pair<int, Column*>> ops;
+  ops.reserve(nops);
+  for (size_t k = 0; k < nops; ++k) {
+    int opcode = static_cast<int>(
+        PyLong_AsLong(PySequence_Fast_GET_ITEM(opseq, k)));
+    Column* col = py::obj(PySequence_Fast_GET_ITEM(colseq, k)).to_column();
+    ops.push_back({opcode, col});
+  }
+  Py_DECREF(opseq);
+  Py_DECREF(colseq);
+
+  std::vector<Column*> results;
+  if (grpby) {
+    results = expr::reduceop_fused(ops, *grpby);
+  } else {
+    Groupby gb = Groupby::single_group(nops? ops[0].second->nrows : 0);
+    results = expr::reduceop_fused(ops, gb);
+  }
+
+  PyObject* reslist = PyList_New(static_cast<Py_ssize_t>(nops));
+  if (!reslist) return nullptr;
+  for (size_t k = 0; k < nops; ++k) {
+    PyList_SET_ITEM(reslist, static_cast<Py_ssize_t>(k),
+                    pycolumn::from_column(results[k], nullptr, 0));
+  }
+  return reslist;
+}
+
+
 PyObject* expr_count(PyObject*, PyObject* args)
 {
   PyObject* arg1;
@@ -120,6 +455,74 @@ PyObject* expr_count(PyObject*, PyObject* args)
 }
 
 
+PyObject* expr_stringop(PyObject*, PyObject* args)
+{
+  int opcode;
+  long long start = 0;
+  long long stop = 0;
+  PyObject* arg1;
+  if (!PyArg_ParseTuple(args, "iOLL:expr_stringop",
+                        &opcode, &arg1, &start, &stop))
+    return nullptr;
+  py::obj pyarg1(arg1);
+
+  Column* col = pyarg1.to_column();
+  Column* res = expr::stringop(opcode, col,
+                               static_cast<int64_t>(start),
+                               static_cast<int64_t>(stop));
+  return pycolumn::from_column(res, nullptr, 0);
+}
+
+
+PyObject* expr_ternaryop(PyObject*, PyObject* args)
+{
+  PyObject* arg1;
+  PyObject* arg2;
+  PyObject* arg3;
+  if (!PyArg_ParseTuple(args, "OOO:expr_ternaryop", &arg1, &arg2, &arg3))
+    return nullptr;
+
+  Column* cond = py::obj(arg1).to_column();
+  Column* acol = py::obj(arg2).to_column();
+  Column* bcol = py::obj(arg3).to_column();
+  Column* res = expr::ternaryop(cond, acol, bcol);
+  return pycolumn::from_column(res, nullptr, 0);
+}
+
+
+PyObject* expr_clip(PyObject*, PyObject* args)
+{
+  PyObject* arg1;
+  PyObject* arg2;
+  PyObject* arg3;
+  if (!PyArg_ParseTuple(args, "OOO:expr_clip", &arg1, &arg2, &arg3))
+    return nullptr;
+
+  bool has_lo = (arg2 != Py_None);
+  bool has_hi = (arg3 != Py_None);
+  double lo = has_lo? PyFloat_AsDouble(arg2) : 0.0;
+  double hi = has_hi? PyFloat_AsDouble(arg3) : 0.0;
+  if (PyErr_Occurred()) return nullptr;
+  Column* col = py::obj(arg1).to_column();
+  Column* res = expr::clipop(col, lo, hi, has_lo, has_hi);
+  return pycolumn::from_column(res, nullptr, 0);
+}
+
+
+PyObject* expr_bucketize(PyObject*, PyObject* args)
+{
+  PyObject* arg1;
+  int nbins;
+  double lo, hi;
+  if (!PyArg_ParseTuple(args, "Oidd:expr_bucketize", &arg1, &nbins, &lo, &hi))
+    return nullptr;
+
+  Column* col = py::obj(arg1).to_column();
+  Column* res = expr::bucketizeop(col, nbins, lo, hi);
+  return pycolumn::from_column(res, nullptr, 0);
+}
+
+
 PyObject* expr_unaryop(PyObject*, PyObject* args)
 {
   int opcode;
@@ -7,17 +7,78 @@
 //------------------------------------------------------------------------------
 #ifndef dt_EXPR_PY_EXPR_h
 #define dt_EXPR_PY_EXPR_h
+#include <utility>
+#include <vector>
 #include "py_utils.h"
 #include "column.h"
 #include "groupby.h"
 
 
+// Binary operation codes, as used by `expr_binaryop` and the fused/filter
+// evaluators. These values are fixed by the Python side (see the `BinaryOpExpr`
+// translation) and must not be renumbered.
+enum OpCode {
+  Plus           = 1,
+  Minus          = 2,
+  Multiply       = 3,
+  Divide         = 4,
+  IntDivide      = 5,
+  Power          = 6,
+  Modulo         = 7,
+  LogicalAnd     = 8,
+  LogicalOr      = 9,
+  LeftShift      = 10,
+  RightShift     = 11,
+  Equal          = 12,  // ==
+  NotEqual       = 13,  // !=
+  Greater        = 14,  // >
+  Less           = 15,  // <
+  GreaterOrEqual = 16,  // >=
+  LessOrEqual    = 17,  // <=
+};
+
+
 DECLARE_FUNCTION(
   expr_binaryop,
   "expr_binaryop(op, lhs, rhs)\n\n"
   "\n",
   dt_EXPR_PY_EXPR_CC)
 
+DECLARE_FUNCTION(
+  expr_fused_binaryop,
+  "expr_fused_binaryop(program, cols)\n\n"
+  "Evaluate a whole tree of binary operations in a single pass over the\n"
+  "data. `program` is the tree flattened into postfix form: a non-negative\n"
+  "entry pushes the column with that index from `cols`, a negative entry\n"
+  "applies the binary op with opcode `-entry` to the top two values.\n",
+  dt_EXPR_PY_EXPR_CC)
+
+DECLARE_FUNCTION(
+  expr_cache_lookup,
+  "expr_cache_lookup(key)\n\n"
+  "Look up the expression-result cache, returning a shallow copy of the\n"
+  "stored column if an entry with this key exists, or None otherwise.\n",
+  dt_EXPR_PY_EXPR_CC)
+
+DECLARE_FUNCTION(
+  expr_cache_store,
+  "expr_cache_store(key, col)\n\n"
+  "Store (a shallow copy of) the column `col` in the expression-result\n"
+  "cache under the given key, evicting the least recently used entry if the\n"
+  "cache is full.\n",
+  dt_EXPR_PY_EXPR_CC)
+
+DECLARE_FUNCTION(
+  expr_filter_conjunction,
+  "expr_filter_conjunction(ops, lhs_cols, rhs_cols, nrows)\n\n"
+  "Evaluate a conjunction of simple predicates as a row filter, returning\n"
+  "the RowIndex of the rows on which every predicate holds. `ops` is a list\n"
+  "of relational opcodes and `lhs_cols`/`rhs_cols` the matching operand\n"
+  "columns (1-row columns are broadcast). The predicates are evaluated\n"
+  "chunk-wise with per-chunk early exit, so no intermediate boolean columns\n"
+  "are ever materialized.\n",
+  dt_EXPR_PY_EXPR_CC)
+
 DECLARE_FUNCTION(
   expr_cast,
   "expr_cast(col, stype)\n\n"
@@ -38,6 +99,91 @@ DECLARE_FUNCTION(
   "object.\n",
   dt_EXPR_PY_EXPR_CC)
 
+DECLARE_FUNCTION(
+  expr_reduceop_multi,
+  "expr_reduceop_multi(ops, cols, groupby)\n\n"
+  "Compute several reductions at once: `ops` is a list of opcodes and `cols`\n"
+  "a matching list of columns. All reductions are evaluated in a single\n"
+  "parallel sweep over the grouped data, and a list of the resulting columns\n"
+  "is returned.\n",
+  dt_EXPR_PY_EXPR_CC)
+
+DECLARE_FUNCTION(
+  expr_cumulativeop,
+  "expr_cumulativeop(op, col, groupby)\n\n"
+  "Compute a cumulative aggregate (cumsum, cummin, cummax, cumprod) of\n"
+  "`col`, returning a column with one value per row. If a Groupby object\n"
+  "is provided, the running aggregate restarts at every group boundary.\n",
+  dt_EXPR_PY_EXPR_CC)
+
+DECLARE_FUNCTION(
+  expr_shiftop,
+  "expr_shiftop(col, k, groupby)\n\n"
+  "Lag/lead: return a view of `col` whose every row holds the value from\n"
+  "`k` rows earlier (later when `k` is negative), with NA at the rows that\n"
+  "have no such neighbour. If a Groupby object is provided, rows never\n"
+  "look across group boundaries. No data is copied.\n",
+  dt_EXPR_PY_EXPR_CC)
+
+DECLARE_FUNCTION(
+  expr_fillna_const,
+  "expr_fillna_const(col, val)\n\n"
+  "Replace every NA in `col` with the value held by the single-row column\n"
+  "`val` (which must have the same stype), in one fused pass over the\n"
+  "data.\n",
+  dt_EXPR_PY_EXPR_CC)
+
+DECLARE_FUNCTION(
+  expr_fillna_dir,
+  "expr_fillna_dir(col, backward, groupby)\n\n"
+  "Forward fill (backward when `backward` is true): replace every NA in\n"
+  "`col` with the nearest preceding (resp. following) non-NA value,\n"
+  "returning a virtual view over the column's data. If a Groupby object\n"
+  "is provided, the fill never crosses group boundaries.\n",
+  dt_EXPR_PY_EXPR_CC)
+
+DECLARE_FUNCTION(
+  expr_rollingop,
+  "expr_rollingop(op, col, groupby, window)\n\n"
+  "Compute a rolling aggregate of `col` over the trailing `window` rows\n"
+  "within each group of the provided Groupby object, returning a column\n"
+  "with one value per row.\n",
+  dt_EXPR_PY_EXPR_CC)
+
+DECLARE_FUNCTION(
+  expr_stringop,
+  "expr_stringop(op, col, start, stop)\n\n"
+  "Apply string operation `op` (upper, lower, strip, slice) to the string\n"
+  "column `col` and return the resulting column. `start` and `stop` are\n"
+  "only used by the slice op (they index code points, with Python-style\n"
+  "negative index semantics).\n",
+  dt_EXPR_PY_EXPR_CC)
+
+DECLARE_FUNCTION(
+  expr_ternaryop,
+  "expr_ternaryop(cond, a, b)\n\n"
+  "Ternary select: return a column that takes the value of `a` where the\n"
+  "boolean column `cond` is true, of `b` where it is false, and NA where\n"
+  "it is NA. `a` and `b` must have the same stype; either may be a\n"
+  "single-row column, which is then broadcast.\n",
+  dt_EXPR_PY_EXPR_CC)
+
+DECLARE_FUNCTION(
+  expr_clip,
+  "expr_clip(col, lower, upper)\n\n"
+  "Limit the values of `col` to the range [lower, upper]; either bound may\n"
+  "be None to leave that side unclipped. NA values remain NA, and the\n"
+  "result keeps the stype of the argument.\n",
+  dt_EXPR_PY_EXPR_CC)
+
+DECLARE_FUNCTION(
+  expr_bucketize,
+  "expr_bucketize(col, nbins, lower, upper)\n\n"
+  "Map every value of `col` into one of `nbins` equal-width bins spanning\n"
+  "[lower, upper), returning an int32 column of bin indices clamped to the\n"
+  "range [0, nbins - 1]. NA values map to NA.\n",
+  dt_EXPR_PY_EXPR_CC)
+
 DECLARE_FUNCTION(
   expr_unaryop,
   "expr_unaryop(op, col)\n\n"
@@ -57,10 +203,33 @@ namespace expr {
 
 typedef void (*mapperfn)(int64_t row0, int64_t row1, void** params);
 typedef void (*gmapperfn)(const int32_t* groups, int32_t grp, void** params);
+typedef void (*fusedfn)(int64_t n, const void* x, int64_t xstride,
+                        const void* y, int64_t ystride, void* out);
 
 Column* unaryop(int opcode, Column* arg);
 Column* binaryop(int opcode, Column* lhs, Column* rhs);
+Column* binaryop_virtual(int opcode, Column* lhs, Column* rhs);
+Column* fused_binaryop(const std::vector<int>& program,
+                       const std::vector<Column*>& columns);
+fusedfn fused_resolve0(SType lhs_type, SType rhs_type, int opcode,
+                       SType& out_stype);
+RowIndex filter_conjunction(const std::vector<int>& opcodes,
+                            const std::vector<Column*>& lhs_cols,
+                            const std::vector<Column*>& rhs_cols,
+                            int64_t nrows);
 Column* reduceop(int opcode, Column* arg, const Groupby& groupby);
+Column* cumulativeop(int opcode, Column* arg, const Groupby& groupby);
+Column* shiftop(Column* arg, int64_t k, const Groupby& groupby);
+std::vector<Column*> reduceop_fused(
+    const std::vector<std::pair<int, Column*>>& ops, const Groupby& groupby);
+Column* rollingop(int opcode, Column* arg, const Groupby& groupby,
+                  int64_t window);
+Column* stringop(int opcode, Column* arg, int64_t start, int64_t stop);
+Column* ternaryop(Column* cond, Column* acol, Column* bcol);
+Column* clipop(Column* arg, double lo, double hi, bool has_lo, bool has_hi);
+Column* fillna_const(Column* arg, Column* val);
+Column* fillna_dir(Column* arg, bool backward, const Groupby& groupby);
+Column* bucketizeop(Column* arg, int nbins, double lo, double hi);
 
 };
 
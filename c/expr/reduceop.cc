@@ -6,25 +6,44 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include "expr/py_expr.h"
+#include <algorithm>  // std::min
 #include <cmath>      // std::sqrt
+#include <cstring>    // std::memcmp, std::memcpy
 #include <limits>     // std::numeric_limits<?>::max, ::infinity
 #include <type_traits>
+#include <utility>    // std::pair
+#include <vector>
+#include "perf.h"
+#include "sort.h"     // compare_offstrings
 #include "types.h"
+#include "utils/omp.h"
 
 namespace expr
 {
 
 // Synchronize with expr/consts.py
 enum OpCode {
-  Mean  = 1,
-  Min   = 2,
-  Max   = 3,
-  Stdev = 4,
-  First = 5,
-  Sum   = 6,
-  Count = 7,
+  Mean    = 1,
+  Min     = 2,
+  Max     = 3,
+  Stdev   = 4,
+  First   = 5,
+  Sum     = 6,
+  Count   = 7,
+  Nunique = 8,
+  Concat  = 9,
+  Last    = 10,
 };
 
+// Synchronize with expr/consts.py
+enum CumOpCode {
+  CumSum  = 1,
+  CumMin  = 2,
+  CumMax  = 3,
+  CumProd = 4,
+};
+
+
 template<typename T>
 constexpr T infinity() {
   return std::numeric_limits<T>::has_infinity
@@ -56,6 +75,31 @@ static Column* reduce_first(const Column* arg, const Groupby& groupby) {
 
 
 
+//------------------------------------------------------------------------------
+// "Last" reducer
+//------------------------------------------------------------------------------
+
+static Column* reduce_last(const Column* arg, const Groupby& groupby) {
+  if (arg->nrows == 0) {
+    return Column::new_data_column(arg->stype(), 0);
+  }
+  size_t ngrps = groupby.ngroups();
+  // Same trick as in `reduce_first`, except that the rowindex is built from
+  // the rows just before each group's end offset (groups are never empty).
+  const int32_t* offsets = groupby.offsets_r();
+  arr32_t indices(ngrps);
+  for (size_t g = 0; g < ngrps; ++g) {
+    indices[g] = offsets[g + 1] - 1;
+  }
+  RowIndex ri = RowIndex::from_array32(std::move(indices), true)
+                .uplift(arg->rowindex());
+  Column* res = arg->shallowcopy(ri);
+  if (ngrps == 1) res->reify();
+  return res;
+}
+
+
+
 //------------------------------------------------------------------------------
 // Sum calculation
 //------------------------------------------------------------------------------
@@ -105,6 +149,185 @@ static void count_skipna(const int32_t* groups, int32_t grp, void** params) {
 
 
 
+//------------------------------------------------------------------------------
+// Nunique calculation
+//------------------------------------------------------------------------------
+
+// Scratch table shared by the nunique kernels across all groups handled by
+// one thread, so that aggregating many small groups does not allocate for
+// every group.
+static thread_local std::vector<int32_t> nunique_arena;
+
+static inline uint64_t hash_bytes(const uint8_t* data, size_t len) {
+  uint64_t h = 14695981039346656037ULL;  // FNV-1a
+  for (size_t i = 0; i < len; ++i) {
+    h = (h ^ data[i]) * 1099511628211ULL;
+  }
+  return h;
+}
+
+
+template<typename IT>
+static void nunique_fw(const int32_t* groups, int32_t grp, void** params) {
+  Column* col0 = static_cast<Column*>(params[0]);
+  Column* col1 = static_cast<Column*>(params[1]);
+  const IT* inputs = static_cast<const IT*>(col0->data());
+  int64_t* outputs = static_cast<int64_t*>(col1->data_w());
+  int32_t row0 = groups[grp];
+  int32_t row1 = groups[grp + 1];
+  size_t tsize = 8;
+  int tshift = 61;
+  while (tsize < 2 * static_cast<size_t>(row1 - row0)) { tsize <<= 1; tshift--; }
+  size_t tmask = tsize - 1;
+  nunique_arena.assign(tsize, -1);
+  int32_t* slots = nunique_arena.data();
+  int64_t count = 0;
+  col0->rowindex().strided_loop(row0, row1, 1,
+    [&](int64_t i) {
+      IT x = inputs[i];
+      if (ISNA<IT>(x)) return;
+      uint64_t h = 0;
+      std::memcpy(&h, &x, sizeof(IT));
+      size_t t = (h * 0x9E3779B97F4A7C15ULL) >> tshift;
+      while (slots[t] >= 0) {
+        if (inputs[slots[t]] == x) return;
+        t = (t + 1) & tmask;
+      }
+      slots[t] = static_cast<int32_t>(i);
+      count++;
+    });
+  outputs[grp] = count;
+}
+
+
+template<typename T>
+static void nunique_str(const int32_t* groups, int32_t grp, void** params) {
+  auto col0 = static_cast<const StringColumn<T>*>(
+                  static_cast<Column*>(params[0]));
+  Column* col1 = static_cast<Column*>(params[1]);
+  const T* soffs = col0->offsets();
+  const uint8_t* strdata = col0->ustrdata();
+  int64_t* outputs = static_cast<int64_t*>(col1->data_w());
+  int32_t row0 = groups[grp];
+  int32_t row1 = groups[grp + 1];
+  size_t tsize = 8;
+  int tshift = 61;
+  while (tsize < 2 * static_cast<size_t>(row1 - row0)) { tsize <<= 1; tshift--; }
+  size_t tmask = tsize - 1;
+  nunique_arena.assign(tsize, -1);
+  int32_t* slots = nunique_arena.data();
+  int64_t count = 0;
+  col0->rowindex().strided_loop(row0, row1, 1,
+    [&](int64_t i) {
+      T oend = soffs[i];
+      if (ISNA<T>(oend)) return;
+      T ostart = soffs[i - 1] & ~GETNA<T>();
+      size_t len = static_cast<size_t>(oend - ostart);
+      size_t t = hash_bytes(strdata + ostart, len) >> tshift;
+      while (slots[t] >= 0) {
+        int32_t r = slots[t];
+        T rend = soffs[r];
+        T rstart = soffs[r - 1] & ~GETNA<T>();
+        if (static_cast<size_t>(rend - rstart) == len &&
+            std::memcmp(strdata + rstart, strdata + ostart, len) == 0) {
+          return;
+        }
+        t = (t + 1) & tmask;
+      }
+      slots[t] = static_cast<int32_t>(i);
+      count++;
+    });
+  outputs[grp] = count;
+}
+
+
+
+//------------------------------------------------------------------------------
+// Grouped string concatenation
+//------------------------------------------------------------------------------
+
+/**
+ * Join each group's strings with a comma, skipping NAs; a group with no
+ * valid values produces NA. Operates directly on the offsets/strdata
+ * buffers: one parallel pass computes per-group output lengths, and after
+ * a prefix scan a second parallel pass fills the output buffers.
+ */
+template <typename T>
+static Column* reduce_concat(const Column* arg, const Groupby& groupby) {
+  static const char SEP = ',';
+  auto col = static_cast<const StringColumn<T>*>(arg);
+  const T* soffs = col->offsets();
+  const uint8_t* strdata = col->ustrdata();
+  int32_t ngrps = static_cast<int32_t>(groupby.ngroups());
+  if (ngrps == 0) ngrps = 1;
+  int32_t _grps[2] = {0, static_cast<int32_t>(arg->nrows)};
+  const int32_t* grps = ngrps == 1? _grps : groupby.offsets_r();
+  size_t zgrps = static_cast<size_t>(ngrps);
+
+  std::vector<size_t> gstart(zgrps + 1);
+  std::vector<char> gna(zgrps);
+  #pragma omp parallel for schedule(dynamic, 16)
+  for (int32_t g = 0; g < ngrps; ++g) {
+    size_t total = 0;
+    size_t nvals = 0;
+    arg->rowindex().strided_loop(grps[g], grps[g + 1], 1,
+      [&](int64_t i) {
+        T oend = soffs[i];
+        if (ISNA<T>(oend)) return;
+        total += static_cast<size_t>(oend - (soffs[i - 1] & ~GETNA<T>()));
+        nvals++;
+      });
+    gstart[g + 1] = nvals? total + nvals - 1 : 0;
+    gna[g] = !nvals;
+  }
+  for (size_t g = 0; g < zgrps; ++g) {
+    gstart[g + 1] += gstart[g];
+  }
+
+  MemoryRange offbuf = MemoryRange::mem((zgrps + 1) * sizeof(T));
+  T* outoffs = static_cast<T*>(offbuf.wptr());
+  outoffs[0] = 0;
+  for (size_t g = 0; g < zgrps; ++g) {
+    outoffs[g + 1] = static_cast<T>(gstart[g + 1]) | (gna[g]? GETNA<T>() : 0);
+  }
+
+  MemoryRange strbuf = MemoryRange::mem(gstart[zgrps]);
+  uint8_t* out = static_cast<uint8_t*>(strbuf.wptr());
+  #pragma omp parallel for schedule(dynamic, 16)
+  for (int32_t g = 0; g < ngrps; ++g) {
+    size_t w = gstart[g];
+    bool first = true;
+    arg->rowindex().strided_loop(grps[g], grps[g + 1], 1,
+      [&](int64_t i) {
+        T oend = soffs[i];
+        if (ISNA<T>(oend)) return;
+        T ostart = soffs[i - 1] & ~GETNA<T>();
+        size_t len = static_cast<size_t>(oend - ostart);
+        if (!first) out[w++] = static_cast<uint8_t>(SEP);
+        std::memcpy(out + w, strdata + ostart, len);
+        w += len;
+        first = false;
+      });
+  }
+
+  return Column::new_mbuf_column(arg->stype(), std::move(offbuf),
+                                 std::move(strbuf));
+}
+
+
+static Column* reduce_concat0(Column* arg, const Groupby& groupby) {
+  switch (arg->stype()) {
+    case SType::STR32: return reduce_concat<uint32_t>(arg, groupby);
+    case SType::STR64: return reduce_concat<uint64_t>(arg, groupby);
+    default:
+      throw RuntimeError()
+        << "Unable to apply reduce function " << OpCode::Concat
+        << " to column(stype=" << arg->stype() << ")";
+  }
+}
+
+
+
 //------------------------------------------------------------------------------
 // Mean calculation
 //------------------------------------------------------------------------------
@@ -216,6 +439,206 @@ static void max_skipna(const int32_t* groups, int32_t grp, void** params) {
 
 
 
+//------------------------------------------------------------------------------
+// Grouped string min/max
+//------------------------------------------------------------------------------
+
+/**
+ * Select each group's smallest (or largest) string, skipping NAs. Strings
+ * are compared in place with `compare_offstrings`, and only the winning
+ * row number per group is recorded, so no string data is ever copied: the
+ * result is a shallow copy of the argument under a new rowindex, same as
+ * in `reduce_first`. A group with no valid values keeps its first row,
+ * which is then necessarily an NA.
+ */
+template <typename T>
+static Column* reduce_strminmax(const Column* arg, const Groupby& groupby,
+                                bool ismin) {
+  if (arg->nrows == 0) {
+    return Column::new_data_column(arg->stype(), 0);
+  }
+  auto col = static_cast<const StringColumn<T>*>(arg);
+  const T* soffs = col->offsets();
+  const uint8_t* strdata = col->ustrdata();
+  int32_t ngrps = static_cast<int32_t>(groupby.ngroups());
+  if (ngrps == 0) ngrps = 1;
+  int32_t _grps[2] = {0, static_cast<int32_t>(arg->nrows)};
+  const int32_t* grps = ngrps == 1? _grps : groupby.offsets_r();
+
+  arr32_t winners(static_cast<size_t>(ngrps));
+  int32_t* wdata = winners.data();
+  #pragma omp parallel for schedule(dynamic, 16)
+  for (int32_t g = 0; g < ngrps; ++g) {
+    int32_t best_pos = grps[g];
+    int64_t best_row = -1;  // physical row of the current winner
+    arg->rowindex().strided_loop2(grps[g], grps[g + 1], 1,
+      [&](int64_t pos, int64_t i) {
+        T oend = soffs[i];
+        if (ISNA<T>(oend)) return;
+        if (best_row >= 0) {
+          T ostart = soffs[i - 1] & ~GETNA<T>();
+          T bend = soffs[best_row];
+          T bstart = soffs[best_row - 1] & ~GETNA<T>();
+          int cmp = compare_offstrings(strdata, ostart, oend, bstart, bend);
+          // `compare_offstrings` returns +1 when the first string orders
+          // before the second; on ties the earlier row is kept.
+          if (ismin? cmp <= 0 : cmp >= 0) return;
+        }
+        best_row = i;
+        best_pos = static_cast<int32_t>(pos);
+      });
+    wdata[g] = best_pos;
+  }
+
+  RowIndex ri = RowIndex::from_array32(std::move(winners), false)
+                .uplift(arg->rowindex());
+  Column* res = arg->shallowcopy(ri);
+  if (ngrps == 1) res->reify();
+  return res;
+}
+
+
+static Column* reduce_strminmax0(Column* arg, const Groupby& groupby,
+                                 bool ismin) {
+  switch (arg->stype()) {
+    case SType::STR32: return reduce_strminmax<uint32_t>(arg, groupby, ismin);
+    case SType::STR64: return reduce_strminmax<uint64_t>(arg, groupby, ismin);
+    default:
+      throw RuntimeError()
+        << "Unable to apply reduce function " << (ismin? OpCode::Min : OpCode::Max)
+        << " to column(stype=" << arg->stype() << ")";
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+// Scatter-reduce mode
+//------------------------------------------------------------------------------
+
+// A low-cardinality groupby (few groups over many rows) parallelizes poorly
+// over groups. Below these limits the Sum/Count/Min/Max reducers switch to a
+// scatter-reduce scan instead: every thread keeps a private accumulator
+// array of `ngrps` slots (small enough to stay in L1), streams linearly
+// through its own row range, and the per-thread accumulators are merged at
+// the end.
+static constexpr int32_t SCATTER_REDUCE_MAX_GROUPS = 4096;
+static constexpr int64_t SCATTER_REDUCE_MIN_ROWS = 1 << 20;
+
+typedef void (*greducefn)(const int32_t* groups, int32_t ngrps,
+                          void** params);
+
+
+template<typename IT, typename OT, int OP>
+static void scatter_reduce(const int32_t* groups, int32_t ngrps,
+                           void** params)
+{
+  Column* col0 = static_cast<Column*>(params[0]);
+  Column* col1 = static_cast<Column*>(params[1]);
+  const IT* inputs = static_cast<const IT*>(col0->data());
+  if (OP == OpCode::Count &&
+      (std::is_same<uint32_t, IT>::value ||
+       std::is_same<uint64_t, IT>::value)) inputs++;
+  OT* outputs = static_cast<OT*>(col1->data_w());
+  OT init = OP == OpCode::Min? infinity<OT>() :
+            OP == OpCode::Max? -infinity<OT>() : OT(0);
+  for (int32_t g = 0; g < ngrps; ++g) outputs[g] = init;
+  int32_t nrows = groups[ngrps];
+
+  #pragma omp parallel
+  {
+    int ith = omp_get_thread_num();
+    int nths = omp_get_num_threads();
+    int32_t chunklen = (nrows + nths - 1) / nths;
+    int32_t row0 = ith * chunklen;
+    int32_t row1 = std::min(row0 + chunklen, nrows);
+    std::vector<OT> acc(static_cast<size_t>(ngrps), init);
+    if (row0 < row1) {
+      // Find the group containing row `row0`; groups occupy contiguous row
+      // ranges, so from there the scan only ever steps `g` forward.
+      int32_t glo = 0, ghi = ngrps;
+      while (ghi - glo > 1) {
+        int32_t gmid = (glo + ghi) >> 1;
+        if (groups[gmid] > row0) ghi = gmid; else glo = gmid;
+      }
+      int32_t g = glo;
+      col0->rowindex().strided_loop2(row0, row1, 1,
+        [&](int64_t pos, int64_t i) {
+          while (pos >= groups[g + 1]) g++;
+          IT x = inputs[i];
+          if (OP == OpCode::Count) {
+            acc[g] += !ISNA<IT>(x);
+          } else if (!ISNA<IT>(x)) {
+            OT y = static_cast<OT>(x);
+            if (OP == OpCode::Sum) acc[g] += y;
+            if (OP == OpCode::Min && y < acc[g]) acc[g] = y;
+            if (OP == OpCode::Max && y > acc[g]) acc[g] = y;
+          }
+        });
+    }
+    #pragma omp critical
+    {
+      for (int32_t g = 0; g < ngrps; ++g) {
+        if (OP == OpCode::Sum || OP == OpCode::Count) outputs[g] += acc[g];
+        if (OP == OpCode::Min && acc[g] < outputs[g]) outputs[g] = acc[g];
+        if (OP == OpCode::Max && acc[g] > outputs[g]) outputs[g] = acc[g];
+      }
+    }
+  }
+}
+
+
+static greducefn scatter_resolve(int opcode, SType stype) {
+  if (opcode == OpCode::Sum) {
+    switch (stype) {
+      case SType::BOOL:
+      case SType::INT8:    return scatter_reduce<int8_t, int64_t, OpCode::Sum>;
+      case SType::INT16:   return scatter_reduce<int16_t, int64_t, OpCode::Sum>;
+      case SType::INT32:   return scatter_reduce<int32_t, int64_t, OpCode::Sum>;
+      case SType::INT64:   return scatter_reduce<int64_t, int64_t, OpCode::Sum>;
+      case SType::FLOAT32: return scatter_reduce<float, double, OpCode::Sum>;
+      case SType::FLOAT64: return scatter_reduce<double, double, OpCode::Sum>;
+      default:             return nullptr;
+    }
+  }
+  if (opcode == OpCode::Count) {
+    switch (stype) {
+      case SType::BOOL:
+      case SType::INT8:    return scatter_reduce<int8_t, int64_t, OpCode::Count>;
+      case SType::INT16:   return scatter_reduce<int16_t, int64_t, OpCode::Count>;
+      case SType::INT32:   return scatter_reduce<int32_t, int64_t, OpCode::Count>;
+      case SType::INT64:   return scatter_reduce<int64_t, int64_t, OpCode::Count>;
+      case SType::FLOAT32: return scatter_reduce<float, int64_t, OpCode::Count>;
+      case SType::FLOAT64: return scatter_reduce<double, int64_t, OpCode::Count>;
+      case SType::STR32:   return scatter_reduce<uint32_t, int64_t, OpCode::Count>;
+      case SType::STR64:   return scatter_reduce<uint64_t, int64_t, OpCode::Count>;
+      default:             return nullptr;
+    }
+  }
+  if (opcode == OpCode::Min || opcode == OpCode::Max) {
+    bool ismin = opcode == OpCode::Min;
+    switch (stype) {
+      case SType::BOOL:
+      case SType::INT8:    return ismin? scatter_reduce<int8_t, int8_t, OpCode::Min>
+                                       : scatter_reduce<int8_t, int8_t, OpCode::Max>;
+      case SType::INT16:   return ismin? scatter_reduce<int16_t, int16_t, OpCode::Min>
+                                       : scatter_reduce<int16_t, int16_t, OpCode::Max>;
+      case SType::INT32:   return ismin? scatter_reduce<int32_t, int32_t, OpCode::Min>
+                                       : scatter_reduce<int32_t, int32_t, OpCode::Max>;
+      case SType::INT64:   return ismin? scatter_reduce<int64_t, int64_t, OpCode::Min>
+                                       : scatter_reduce<int64_t, int64_t, OpCode::Max>;
+      case SType::FLOAT32: return ismin? scatter_reduce<float, float, OpCode::Min>
+                                       : scatter_reduce<float, float, OpCode::Max>;
+      case SType::FLOAT64: return ismin? scatter_reduce<double, double, OpCode::Min>
+                                       : scatter_reduce<double, double, OpCode::Max>;
+      default:             return nullptr;
+    }
+  }
+  return nullptr;
+}
+
+
+
 //------------------------------------------------------------------------------
 // Resolve template function
 //------------------------------------------------------------------------------
@@ -263,6 +686,21 @@ static gmapperfn resolve0(int opcode, SType stype) {
     }
   }
 
+  if (opcode == OpCode::Nunique) {
+    switch (stype) {
+      case SType::BOOL:
+      case SType::INT8:    return nunique_fw<int8_t>;
+      case SType::INT16:   return nunique_fw<int16_t>;
+      case SType::INT32:   return nunique_fw<int32_t>;
+      case SType::INT64:   return nunique_fw<int64_t>;
+      case SType::FLOAT32: return nunique_fw<float>;
+      case SType::FLOAT64: return nunique_fw<double>;
+      case SType::STR32:   return nunique_str<uint32_t>;
+      case SType::STR64:   return nunique_str<uint64_t>;
+      default:             return nullptr;
+    }
+  }
+
   switch (stype) {
     case SType::BOOL:
     case SType::INT8:    return resolve1<int8_t, double>(opcode);
@@ -281,12 +719,7 @@ static gmapperfn resolve0(int opcode, SType stype) {
 // External API
 //------------------------------------------------------------------------------
 
-Column* reduceop(int opcode, Column* arg, const Groupby& groupby)
-{
-  if (opcode == OpCode::First) {
-    return reduce_first(arg, groupby);
-  }
-  SType arg_type = arg->stype();
+static SType resolve_res_type(int opcode, SType arg_type) {
   SType res_type = opcode == OpCode::Min || opcode == OpCode::Max ||
                    arg_type == SType::FLOAT32 ? arg_type : SType::FLOAT64;
   if (opcode == OpCode::Sum) {
@@ -296,10 +729,33 @@ Column* reduceop(int opcode, Column* arg, const Groupby& groupby)
       res_type = SType::INT64;
     }
   }
-
-  if (opcode == OpCode::Count) {
+  if (opcode == OpCode::Count || opcode == OpCode::Nunique) {
     res_type = SType::INT64;
   }
+  return res_type;
+}
+
+
+Column* reduceop(int opcode, Column* arg, const Groupby& groupby)
+{
+  dt::perf::OpTimer optimer("groupby.reduce");
+  optimer.set_bytes(static_cast<int64_t>(arg->alloc_size()));
+  optimer.set_nchunks(static_cast<int32_t>(groupby.ngroups()));
+  if (opcode == OpCode::First) {
+    return reduce_first(arg, groupby);
+  }
+  if (opcode == OpCode::Concat) {
+    return reduce_concat0(arg, groupby);
+  }
+  if (opcode == OpCode::Last) {
+    return reduce_last(arg, groupby);
+  }
+  SType arg_type = arg->stype();
+  if ((opcode == OpCode::Min || opcode == OpCode::Max) &&
+      (arg_type == SType::STR32 || arg_type == SType::STR64)) {
+    return reduce_strminmax0(arg, groupby, opcode == OpCode::Min);
+  }
+  SType res_type = resolve_res_type(opcode, arg_type);
 
   int32_t ngrps = static_cast<int32_t>(groupby.ngroups());
   if (ngrps == 0) ngrps = 1;
@@ -308,6 +764,18 @@ Column* reduceop(int opcode, Column* arg, const Groupby& groupby)
   params[0] = arg;
   params[1] = Column::new_data_column(res_type, ngrps);
 
+  int32_t _grps[2] = {0, static_cast<int32_t>(arg->nrows)};
+  const int32_t* grps = ngrps == 1? _grps : groupby.offsets_r();
+
+  if (ngrps <= SCATTER_REDUCE_MAX_GROUPS &&
+      arg->nrows >= SCATTER_REDUCE_MIN_ROWS) {
+    greducefn sfn = scatter_resolve(opcode, arg_type);
+    if (sfn) {
+      (*sfn)(grps, ngrps, params);
+      return static_cast<Column*>(params[1]);
+    }
+  }
+
   gmapperfn fn = resolve0(opcode, arg_type);
   if (!fn) {
     throw RuntimeError()
@@ -315,8 +783,6 @@ Column* reduceop(int opcode, Column* arg, const Groupby& groupby)
       << " to column(stype=" << arg_type << ")";
   }
 
-  int32_t _grps[2] = {0, static_cast<int32_t>(arg->nrows)};
-  const int32_t* grps = ngrps == 1? _grps : groupby.offsets_r();
   for (int32_t g = 0; g < ngrps; ++g) {
     (*fn)(grps, g, params);
   }
@@ -324,4 +790,254 @@ Column* reduceop(int opcode, Column* arg, const Groupby& groupby)
   return static_cast<Column*>(params[1]);
 }
 
+
+std::vector<Column*> reduceop_fused(
+  const std::vector<std::pair<int, Column*>>& ops, const Groupby& groupby)
+{
+  dt::perf::OpTimer optimer("groupby.reduce");
+  optimer.set_nchunks(static_cast<int32_t>(groupby.ngroups()));
+  size_t nops = ops.size();
+  int32_t ngrps = static_cast<int32_t>(groupby.ngroups());
+  if (ngrps == 0) ngrps = 1;
+
+  // Resolve all kernels and allocate all output columns up front. "First"
+  // reductions are not per-group kernels and are evaluated outside of the
+  // sweep (they only gather one value per group anyway).
+  std::vector<Column*> outputs(nops, nullptr);
+  std::vector<gmapperfn> fns(nops, nullptr);
+  for (size_t k = 0; k < nops; ++k) {
+    int opcode = ops[k].first;
+    Column* arg = ops[k].second;
+    if (opcode == OpCode::First) {
+      outputs[k] = reduce_first(arg, groupby);
+      continue;
+    }
+    if (opcode == OpCode::Concat) {
+      outputs[k] = reduce_concat0(arg, groupby);
+      continue;
+    }
+    if (opcode == OpCode::Last) {
+      outputs[k] = reduce_last(arg, groupby);
+      continue;
+    }
+    SType arg_type = arg->stype();
+    if ((opcode == OpCode::Min || opcode == OpCode::Max) &&
+        (arg_type == SType::STR32 || arg_type == SType::STR64)) {
+      outputs[k] = reduce_strminmax0(arg, groupby, opcode == OpCode::Min);
+      continue;
+    }
+    fns[k] = resolve0(opcode, arg_type);
+    if (!fns[k]) {
+      throw RuntimeError()
+        << "Unable to apply reduce function " << opcode
+        << " to column(stype=" << arg_type << ")";
+    }
+    outputs[k] = Column::new_data_column(resolve_res_type(opcode, arg_type),
+                                         ngrps);
+  }
+
+  // Single sweep over the grouped data: each thread takes a range of groups
+  // and evaluates all reductions for a group before moving on to the next,
+  // so every group's rows are walked once while still hot in cache. Each
+  // kernel writes only its group's slot of its own output column, hence no
+  // merging between threads is needed.
+  int32_t _grps[2] = {0, nops? static_cast<int32_t>(ops[0].second->nrows) : 0};
+  const int32_t* grps = ngrps == 1? _grps : groupby.offsets_r();
+  #pragma omp parallel for schedule(dynamic, 16)
+  for (int32_t g = 0; g < ngrps; ++g) {
+    for (size_t k = 0; k < nops; ++k) {
+      if (!fns[k]) continue;
+      void* params[2] = { ops[k].second, outputs[k] };
+      (*fns[k])(grps, g, params);
+    }
+  }
+
+  return outputs;
+}
+
+
+
+//------------------------------------------------------------------------------
+// Cumulative aggregates
+//------------------------------------------------------------------------------
+// Unlike the reducers above, cumulative ops produce one value per row: the
+// aggregate of all rows from the start of the row's group up to and
+// including the row itself. NA inputs yield NA at their own position but do
+// not interrupt the running aggregate.
+//
+// Grouped data is scanned one group per task, which parallelizes the
+// "running balance per account" pattern directly. A single ungrouped scan
+// is parallelized with the classic two-pass prefix scan: every chunk is
+// scanned locally while recording its final accumulator, the per-chunk
+// carries are combined into exclusive prefixes, and a second pass folds
+// each chunk's prefix into its local results. All four ops are associative,
+// so the fix-up is exact.
+
+template <typename OT, int OP>
+static inline OT cum_identity() {
+  return OP == CumOpCode::CumSum?  static_cast<OT>(0) :
+         OP == CumOpCode::CumProd? static_cast<OT>(1) : GETNA<OT>();
+}
+
+// Fold the valid value `v` into the accumulator state `a` (which may still
+// be the identity/NA state).
+template <typename OT, int OP>
+static inline OT cum_combine(OT a, OT v) {
+  if (OP == CumOpCode::CumSum)  return a + v;
+  if (OP == CumOpCode::CumProd) return a * v;
+  if (ISNA<OT>(a)) return v;
+  if (OP == CumOpCode::CumMin) return v < a? v : a;
+  return v > a? v : a;
+}
+
+// Merge two accumulator states; either may still be the identity/NA state.
+template <typename OT, int OP>
+static inline OT cum_merge(OT a, OT b) {
+  if ((OP == CumOpCode::CumMin || OP == CumOpCode::CumMax) && ISNA<OT>(b)) {
+    return a;
+  }
+  return cum_combine<OT, OP>(a, b);
+}
+
+
+template <typename IT, typename OT, int OP>
+static OT cum_scan_range(const Column* col, OT* out, int64_t r0, int64_t r1)
+{
+  const IT* in = static_cast<const IT*>(col->data());
+  OT acc = cum_identity<OT, OP>();
+  col->rowindex().strided_loop2(r0, r1, 1,
+    [&](int64_t i, int64_t j) {
+      IT x = in[j];
+      if (ISNA<IT>(x)) {
+        out[i] = GETNA<OT>();
+        return;
+      }
+      acc = cum_combine<OT, OP>(acc, static_cast<OT>(x));
+      out[i] = acc;
+    });
+  return acc;
+}
+
+
+template <typename OT, int OP>
+static void cum_fixup_range(OT* out, int64_t r0, int64_t r1, OT p)
+{
+  if (ISNA<OT>(p)) return;
+  for (int64_t i = r0; i < r1; ++i) {
+    if (!ISNA<OT>(out[i])) out[i] = cum_combine<OT, OP>(p, out[i]);
+  }
+}
+
+
+template <typename IT, typename OT, int OP>
+static void cum_exec(const Column* arg, void* outbuf,
+                     const int32_t* grps, int32_t ngrps)
+{
+  OT* out = static_cast<OT*>(outbuf);
+  int64_t n = arg->nrows;
+  if (ngrps > 1) {
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (int32_t g = 0; g < ngrps; ++g) {
+      cum_scan_range<IT, OT, OP>(arg, out, grps[g], grps[g + 1]);
+    }
+    return;
+  }
+  int nth = omp_get_max_threads();
+  if (n < 65536 || nth <= 1) {
+    cum_scan_range<IT, OT, OP>(arg, out, 0, n);
+    return;
+  }
+  int64_t chunklen = (n + nth - 1) / nth;
+  std::vector<OT> carries(static_cast<size_t>(nth));
+  #pragma omp parallel num_threads(nth)
+  {
+    int k = omp_get_thread_num();
+    int64_t i0 = k * chunklen;
+    int64_t i1 = std::min(i0 + chunklen, n);
+    OT c = cum_identity<OT, OP>();
+    if (i0 < i1) c = cum_scan_range<IT, OT, OP>(arg, out, i0, i1);
+    carries[static_cast<size_t>(k)] = c;
+    #pragma omp barrier
+    #pragma omp single
+    {
+      // Turn the per-chunk carries into exclusive prefixes.
+      OT p = cum_identity<OT, OP>();
+      for (int t = 0; t < nth; ++t) {
+        OT c2 = carries[static_cast<size_t>(t)];
+        carries[static_cast<size_t>(t)] = p;
+        p = cum_merge<OT, OP>(p, c2);
+      }
+    }  // implicit barrier
+    if (k > 0 && i0 < i1) {
+      cum_fixup_range<OT, OP>(out, i0, i1, carries[static_cast<size_t>(k)]);
+    }
+  }
+}
+
+
+typedef void (*cumfn)(const Column*, void*, const int32_t*, int32_t);
+
+template <typename IT>
+static cumfn cum_resolve1(int opcode) {
+  using ST = typename std::conditional<std::is_integral<IT>::value,
+                                       int64_t, double>::type;
+  switch (opcode) {
+    case CumOpCode::CumSum:  return cum_exec<IT, ST, CumOpCode::CumSum>;
+    case CumOpCode::CumProd: return cum_exec<IT, ST, CumOpCode::CumProd>;
+    case CumOpCode::CumMin:  return cum_exec<IT, IT, CumOpCode::CumMin>;
+    case CumOpCode::CumMax:  return cum_exec<IT, IT, CumOpCode::CumMax>;
+  }
+  return nullptr;
+}
+
+static cumfn cum_resolve0(int opcode, SType stype) {
+  switch (stype) {
+    case SType::BOOL:
+    case SType::INT8:    return cum_resolve1<int8_t>(opcode);
+    case SType::INT16:   return cum_resolve1<int16_t>(opcode);
+    case SType::INT32:   return cum_resolve1<int32_t>(opcode);
+    case SType::INT64:   return cum_resolve1<int64_t>(opcode);
+    case SType::FLOAT32: return cum_resolve1<float>(opcode);
+    case SType::FLOAT64: return cum_resolve1<double>(opcode);
+    default: return nullptr;
+  }
+}
+
+static SType cum_res_type(int opcode, SType arg_type) {
+  if (opcode == CumOpCode::CumMin || opcode == CumOpCode::CumMax) {
+    return arg_type;
+  }
+  if (arg_type == SType::FLOAT32 || arg_type == SType::FLOAT64) {
+    return SType::FLOAT64;
+  }
+  return SType::INT64;
+}
+
+
+Column* cumulativeop(int opcode, Column* arg, const Groupby& groupby)
+{
+  dt::perf::OpTimer optimer("groupby.cumulative");
+  optimer.set_bytes(static_cast<int64_t>(arg->alloc_size()));
+  optimer.set_nchunks(static_cast<int32_t>(groupby.ngroups()));
+
+  SType arg_type = arg->stype();
+  cumfn fn = cum_resolve0(opcode, arg_type);
+  if (!fn) {
+    throw TypeError()
+      << "Unable to apply cumulative function " << opcode
+      << " to column(stype=" << arg_type << ")";
+  }
+  Column* res = Column::new_data_column(cum_res_type(opcode, arg_type),
+                                        arg->nrows);
+  if (arg->nrows == 0) return res;
+
+  int32_t ngrps = static_cast<int32_t>(groupby.ngroups());
+  if (ngrps == 0) ngrps = 1;
+  int32_t _grps[2] = {0, static_cast<int32_t>(arg->nrows)};
+  const int32_t* grps = ngrps == 1? _grps : groupby.offsets_r();
+
+  (*fn)(arg, res->data_w(), grps, ngrps);
+  return res;
+}
+
 };  // namespace expr
@@ -0,0 +1,212 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include "expr/py_expr.h"
+#include <deque>
+#include <utility>    // std::pair
+#include <vector>
+#include "types.h"
+#include "utils/omp.h"
+
+namespace expr
+{
+
+// Synchronize with expr/consts.py
+enum OpCode {
+  Mean    = 1,
+  Min     = 2,
+  Max     = 3,
+  Stdev   = 4,
+  First   = 5,
+  Sum     = 6,
+  Count   = 7,
+  Nunique = 8,
+  Concat  = 9,
+};
+
+typedef void (*wmapperfn)(const int32_t* groups, int32_t grp, int64_t window,
+                          void** params);
+
+
+//------------------------------------------------------------------------------
+// Rolling sum / mean
+//------------------------------------------------------------------------------
+
+// The sliding update is O(1) per row: the value leaving the window is kept
+// in a ring buffer of `window` entries and subtracted from the running sum.
+// NA values do not contribute; if a window contains no valid values the
+// output is NA.
+template<typename IT, typename OT, bool MEAN>
+static void roll_sum(const int32_t* groups, int32_t grp, int64_t window,
+                     void** params)
+{
+  Column* col0 = static_cast<Column*>(params[0]);
+  Column* col1 = static_cast<Column*>(params[1]);
+  const IT* inputs = static_cast<const IT*>(col0->data());
+  OT* outputs = static_cast<OT*>(col1->data_w());
+  int32_t row0 = groups[grp];
+  int32_t row1 = groups[grp + 1];
+  OT sum = 0;
+  int64_t cnt = 0;
+  std::vector<IT> ring(static_cast<size_t>(window));
+  col0->rowindex().strided_loop2(row0, row1, 1,
+    [&](int64_t pos, int64_t i) {
+      int64_t p = pos - row0;
+      if (p >= window) {
+        IT old = ring[static_cast<size_t>(p % window)];
+        if (!ISNA<IT>(old)) {
+          sum -= static_cast<OT>(old);
+          cnt--;
+        }
+      }
+      IT x = inputs[i];
+      ring[static_cast<size_t>(p % window)] = x;
+      if (!ISNA<IT>(x)) {
+        sum += static_cast<OT>(x);
+        cnt++;
+      }
+      outputs[pos] = cnt == 0? GETNA<OT>()
+                             : MEAN? sum / cnt : sum;
+    });
+}
+
+
+
+//------------------------------------------------------------------------------
+// Rolling min / max
+//------------------------------------------------------------------------------
+
+// Classic monotonic-deque algorithm: the deque holds (position, value) pairs
+// whose values are strictly increasing (for min) or decreasing (for max), so
+// the window's extremum is always at the front. Each row is pushed and
+// popped at most once, i.e. amortized O(1) per row.
+template<typename T, bool MIN>
+static void roll_minmax(const int32_t* groups, int32_t grp, int64_t window,
+                        void** params)
+{
+  Column* col0 = static_cast<Column*>(params[0]);
+  Column* col1 = static_cast<Column*>(params[1]);
+  const T* inputs = static_cast<const T*>(col0->data());
+  T* outputs = static_cast<T*>(col1->data_w());
+  int32_t row0 = groups[grp];
+  int32_t row1 = groups[grp + 1];
+  std::deque<std::pair<int64_t, T>> dq;
+  col0->rowindex().strided_loop2(row0, row1, 1,
+    [&](int64_t pos, int64_t i) {
+      int64_t p = pos - row0;
+      while (!dq.empty() && dq.front().first <= p - window) {
+        dq.pop_front();
+      }
+      T x = inputs[i];
+      if (!ISNA<T>(x)) {
+        while (!dq.empty() &&
+               (MIN? dq.back().second >= x : dq.back().second <= x)) {
+          dq.pop_back();
+        }
+        dq.push_back({p, x});
+      }
+      outputs[pos] = dq.empty()? GETNA<T>() : dq.front().second;
+    });
+}
+
+
+
+//------------------------------------------------------------------------------
+// Resolve template function
+//------------------------------------------------------------------------------
+
+template<typename T1, typename T2>
+static wmapperfn roll_resolve1(int opcode) {
+  switch (opcode) {
+    case OpCode::Mean: return roll_sum<T1, T2, true>;
+    case OpCode::Min:  return roll_minmax<T1, true>;
+    case OpCode::Max:  return roll_minmax<T1, false>;
+    default:           return nullptr;
+  }
+}
+
+
+static wmapperfn roll_resolve0(int opcode, SType stype) {
+  if (opcode == OpCode::Sum) {
+    switch (stype) {
+      case SType::BOOL:
+      case SType::INT8:    return roll_sum<int8_t, int64_t, false>;
+      case SType::INT16:   return roll_sum<int16_t, int64_t, false>;
+      case SType::INT32:   return roll_sum<int32_t, int64_t, false>;
+      case SType::INT64:   return roll_sum<int64_t, int64_t, false>;
+      case SType::FLOAT32: return roll_sum<float, double, false>;
+      case SType::FLOAT64: return roll_sum<double, double, false>;
+      default:             return nullptr;
+    }
+  }
+  switch (stype) {
+    case SType::BOOL:
+    case SType::INT8:    return roll_resolve1<int8_t, double>(opcode);
+    case SType::INT16:   return roll_resolve1<int16_t, double>(opcode);
+    case SType::INT32:   return roll_resolve1<int32_t, double>(opcode);
+    case SType::INT64:   return roll_resolve1<int64_t, double>(opcode);
+    case SType::FLOAT32: return roll_resolve1<float, float>(opcode);
+    case SType::FLOAT64: return roll_resolve1<double, double>(opcode);
+    default:             return nullptr;
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+// External API
+//------------------------------------------------------------------------------
+
+/**
+ * Compute a rolling (windowed) aggregate of `arg` over the trailing `window`
+ * rows within each group. The rows of each group must already be in the
+ * desired order (which the groupby sort guarantees). The result has one
+ * value per row of `arg`, laid out in grouped row order, and the windows
+ * never cross group boundaries. Groups are processed in parallel.
+ */
+Column* rollingop(int opcode, Column* arg, const Groupby& groupby,
+                  int64_t window)
+{
+  if (window <= 0) {
+    throw ValueError() << "Rolling window size must be positive: " << window;
+  }
+  SType arg_type = arg->stype();
+  SType res_type = opcode == OpCode::Min || opcode == OpCode::Max ||
+                   arg_type == SType::FLOAT32 ? arg_type : SType::FLOAT64;
+  if (opcode == OpCode::Sum && arg_type != SType::FLOAT32 &&
+      arg_type != SType::FLOAT64) {
+    res_type = SType::INT64;
+  }
+  if (opcode == OpCode::Sum && res_type == SType::FLOAT32) {
+    res_type = SType::FLOAT64;
+  }
+
+  int32_t ngrps = static_cast<int32_t>(groupby.ngroups());
+  if (ngrps == 0) ngrps = 1;
+
+  void* params[2];
+  params[0] = arg;
+  params[1] = Column::new_data_column(res_type, arg->nrows);
+
+  wmapperfn fn = roll_resolve0(opcode, arg_type);
+  if (!fn) {
+    throw RuntimeError()
+      << "Unable to apply rolling function " << opcode
+      << " to column(stype=" << arg_type << ")";
+  }
+
+  int32_t _grps[2] = {0, static_cast<int32_t>(arg->nrows)};
+  const int32_t* grps = ngrps == 1? _grps : groupby.offsets_r();
+  #pragma omp parallel for schedule(dynamic, 16)
+  for (int32_t g = 0; g < ngrps; ++g) {
+    (*fn)(grps, g, window, params);
+  }
+
+  return static_cast<Column*>(params[1]);
+}
+
+};  // namespace expr
@@ -0,0 +1,81 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+// This file implements the lag/lead operation
+//     shift(col, k)
+// which returns the value of the column `k` rows earlier (or later, when
+// `k` is negative), with NA at the boundary rows that have no such
+// neighbour. When a Groupby is provided, rows never look across group
+// boundaries, so the first `k` rows of every group become NA.
+//
+// The shifted column is materialized: a rowindex maps every output row
+// to the physical row holding its shifted value (boundary rows point at
+// themselves as a placeholder), the view is reified, and the boundary
+// rows are then overwritten with NA via `apply_na_mask`. NA entries in a
+// RowIndex are only legal inside the join materialization path, so the
+// result must not be left as a view with NA-bearing indices.
+//------------------------------------------------------------------------------
+#include "expr/py_expr.h"
+#include "types.h"
+#include "utils/omp.h"
+
+
+namespace expr
+{
+
+Column* shiftop(Column* arg, int64_t k, const Groupby& groupby)
+{
+  int64_t n = arg->nrows;
+  Column* res = arg->shallowcopy();
+  if (k == 0 || n == 0) return res;
+  if (n > std::numeric_limits<int32_t>::max()) {
+    throw NotImplError() << "shift() cannot be applied to a column with "
+        << n << " rows";
+  }
+
+  // Logical-to-physical map of the argument: the shifted index must point
+  // at physical rows of the argument's data buffer.
+  arr32_t src;
+  const int32_t* srcp = nullptr;
+  if (arg->rowindex()) {
+    src = arg->rowindex().extract_as_array32();
+    srcp = src.data();
+  }
+
+  int32_t ngrps = static_cast<int32_t>(groupby.ngroups());
+  if (ngrps == 0) ngrps = 1;
+  int32_t _grps[2] = {0, static_cast<int32_t>(n)};
+  const int32_t* grps = ngrps == 1? _grps : groupby.offsets_r();
+
+  // Boundary rows have no source row; they temporarily point at themselves
+  // (any in-range row would do) and are recorded in `mask`, to be turned
+  // into NAs once the view is materialized.
+  BoolColumn* mask = new BoolColumn(n);
+  int8_t* maskp = mask->elements_w();
+  arr32_t ind(static_cast<size_t>(n));
+  int32_t* indp = ind.data();
+  #pragma omp parallel for schedule(dynamic, 16)
+  for (int32_t g = 0; g < ngrps; ++g) {
+    int64_t r0 = grps[g];
+    int64_t r1 = grps[g + 1];
+    for (int64_t i = r0; i < r1; ++i) {
+      int64_t s = i - k;
+      bool inrange = (s >= r0 && s < r1);
+      if (!inrange) s = i;
+      indp[i] = srcp? srcp[s] : static_cast<int32_t>(s);
+      maskp[i] = !inrange;
+    }
+  }
+
+  res->replace_rowindex(RowIndex::from_array32(std::move(ind)));
+  res->reify();
+  res->apply_na_mask(mask);
+  delete mask;
+  return res;
+}
+
+};  // namespace expr
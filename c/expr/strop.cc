@@ -0,0 +1,225 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+// This file implements native transforms on string columns: upper, lower,
+// strip and slice. The ops work directly on the offsets + strdata buffers of
+// a StringColumn, without ever round-tripping through Python objects.
+//
+// The column is processed in parallel chunks of rows. Since the size of each
+// output string is not known in advance, every thread appends its results to
+// its own growing byte buffer; afterwards the per-chunk buffers are merged
+// into the final strdata buffer with one memcpy per chunk, and the per-row
+// lengths recorded during the parallel pass are folded into the cumulative
+// offsets. Rows are processed in order within each chunk and chunks are laid
+// out in order, so the merge preserves the row order of the column.
+//
+// Case conversion is ASCII-only: bytes of multi-byte UTF-8 sequences are
+// outside the a-z/A-Z ranges and pass through unchanged, so the output is
+// always valid UTF-8. Slicing operates on code points, not bytes, with
+// Python-style negative index semantics.
+//------------------------------------------------------------------------------
+#include "expr/py_expr.h"
+#include <algorithm>           // std::min
+#include <cstring>             // std::memcpy
+#include <vector>
+#include "types.h"
+#include "utils/exceptions.h"
+#include "utils/omp.h"
+
+
+namespace expr
+{
+
+// Should be in sync with the map in str_expr.py
+enum OpCode {
+  Upper = 1,
+  Lower = 2,
+  Strip = 3,
+  Slice = 4,
+};
+
+
+//------------------------------------------------------------------------------
+// Per-string transforms
+//------------------------------------------------------------------------------
+// Each transform appends its output to `buf` and returns the number of bytes
+// written.
+
+static size_t str_upper(const char* s, size_t len, std::vector<char>& buf) {
+  size_t n0 = buf.size();
+  buf.resize(n0 + len);
+  char* o = buf.data() + n0;
+  for (size_t j = 0; j < len; ++j) {
+    char c = s[j];
+    o[j] = (c >= 'a' && c <= 'z')? static_cast<char>(c - 32) : c;
+  }
+  return len;
+}
+
+
+static size_t str_lower(const char* s, size_t len, std::vector<char>& buf) {
+  size_t n0 = buf.size();
+  buf.resize(n0 + len);
+  char* o = buf.data() + n0;
+  for (size_t j = 0; j < len; ++j) {
+    char c = s[j];
+    o[j] = (c >= 'A' && c <= 'Z')? static_cast<char>(c + 32) : c;
+  }
+  return len;
+}
+
+
+inline static bool is_strippable(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' ||
+         c == '\f' || c == '\v';
+}
+
+static size_t str_strip(const char* s, size_t len, std::vector<char>& buf) {
+  size_t a = 0;
+  size_t b = len;
+  while (a < b && is_strippable(s[a])) a++;
+  while (b > a && is_strippable(s[b - 1])) b--;
+  buf.insert(buf.end(), s + a, s + b);
+  return b - a;
+}
+
+
+static size_t str_slice(const char* s, size_t len, int64_t start, int64_t stop,
+                        std::vector<char>& buf)
+{
+  // Count code points: every byte except UTF-8 continuation bytes (10xxxxxx)
+  // starts a new character.
+  int64_t nchars = 0;
+  for (size_t j = 0; j < len; ++j) {
+    nchars += ((static_cast<uint8_t>(s[j]) & 0xC0) != 0x80);
+  }
+  int64_t i0 = start;
+  int64_t i1 = stop;
+  if (i0 < 0) { i0 += nchars; if (i0 < 0) i0 = 0; }
+  else if (i0 > nchars) i0 = nchars;
+  if (i1 < 0) { i1 += nchars; if (i1 < 0) i1 = 0; }
+  else if (i1 > nchars) i1 = nchars;
+  if (i1 <= i0) return 0;
+
+  // Locate the byte positions of characters `i0` and `i1`.
+  size_t b0 = len;
+  size_t b1 = len;
+  int64_t c = 0;
+  for (size_t j = 0; j < len; ++j) {
+    if ((static_cast<uint8_t>(s[j]) & 0xC0) != 0x80) {
+      if (c == i0) b0 = j;
+      if (c == i1) { b1 = j; break; }
+      c++;
+    }
+  }
+  buf.insert(buf.end(), s + b0, s + b1);
+  return b1 - b0;
+}
+
+
+
+//------------------------------------------------------------------------------
+// Main driver
+//------------------------------------------------------------------------------
+
+template <typename T>
+static Column* stringop_str(int opcode, Column* arg,
+                            int64_t sstart, int64_t sstop)
+{
+  auto col = static_cast<StringColumn<T>*>(arg);
+  const T* soffs = col->offsets();
+  const char* strdata = col->strdata();
+  int64_t n = arg->nrows;
+  size_t zn = static_cast<size_t>(n);
+
+  int nchunks = omp_get_max_threads();
+  int64_t chunklen = (n + nchunks - 1) / nchunks;
+  if (chunklen <= 0) { nchunks = 1; chunklen = 1; }
+  std::vector<std::vector<char>> tbufs(static_cast<size_t>(nchunks));
+
+  MemoryRange offbuf = MemoryRange::mem((zn + 1) * sizeof(T));
+  T* outoffs = static_cast<T*>(offbuf.wptr());
+  outoffs[0] = 0;
+  // During the parallel pass `lens[i]` holds the output length of row `i`
+  // (GETNA for NA rows); afterwards the lengths are folded into cumulative
+  // offsets in place.
+  T* lens = outoffs + 1;
+
+  #pragma omp parallel for schedule(static, 1)
+  for (int k = 0; k < nchunks; ++k) {
+    int64_t i0 = k * chunklen;
+    int64_t i1 = std::min(i0 + chunklen, n);
+    std::vector<char>& buf = tbufs[static_cast<size_t>(k)];
+    arg->rowindex().strided_loop2(i0, i1, 1,
+      [&](int64_t i, int64_t j) {
+        T oend = soffs[j];
+        if (ISNA<T>(oend)) {
+          lens[i] = GETNA<T>();
+          return;
+        }
+        T ostart = soffs[j - 1] & ~GETNA<T>();
+        const char* s = strdata + ostart;
+        size_t len = static_cast<size_t>(oend - ostart);
+        size_t outlen = 0;
+        switch (opcode) {
+          case OpCode::Upper: outlen = str_upper(s, len, buf); break;
+          case OpCode::Lower: outlen = str_lower(s, len, buf); break;
+          case OpCode::Strip: outlen = str_strip(s, len, buf); break;
+          case OpCode::Slice: outlen = str_slice(s, len, sstart, sstop, buf);
+                              break;
+        }
+        lens[i] = static_cast<T>(outlen);
+      });
+  }
+
+  // Merge the per-thread buffers into the final strdata buffer.
+  std::vector<size_t> chunk_off(static_cast<size_t>(nchunks) + 1);
+  for (int k = 0; k < nchunks; ++k) {
+    size_t zk = static_cast<size_t>(k);
+    chunk_off[zk + 1] = chunk_off[zk] + tbufs[zk].size();
+  }
+  MemoryRange strbuf = MemoryRange::mem(chunk_off[static_cast<size_t>(nchunks)]);
+  char* out = static_cast<char*>(strbuf.wptr());
+  #pragma omp parallel for schedule(static, 1)
+  for (int k = 0; k < nchunks; ++k) {
+    size_t zk = static_cast<size_t>(k);
+    if (!tbufs[zk].empty()) {
+      std::memcpy(out + chunk_off[zk], tbufs[zk].data(), tbufs[zk].size());
+    }
+  }
+
+  // Fold the per-row lengths into cumulative offsets.
+  size_t cum = 0;
+  for (int64_t i = 0; i < n; ++i) {
+    if (lens[i] == GETNA<T>()) {
+      outoffs[i + 1] = static_cast<T>(cum) | GETNA<T>();
+    } else {
+      cum += static_cast<size_t>(lens[i]);
+      outoffs[i + 1] = static_cast<T>(cum);
+    }
+  }
+
+  return Column::new_mbuf_column(arg->stype(), std::move(offbuf),
+                                 std::move(strbuf));
+}
+
+
+Column* stringop(int opcode, Column* arg, int64_t start, int64_t stop)
+{
+  if (opcode < OpCode::Upper || opcode > OpCode::Slice) {
+    throw ValueError() << "Unknown string op " << opcode;
+  }
+  switch (arg->stype()) {
+    case SType::STR32: return stringop_str<uint32_t>(opcode, arg, start, stop);
+    case SType::STR64: return stringop_str<uint64_t>(opcode, arg, start, stop);
+    default:
+      throw TypeError() << "String op " << opcode << " cannot be applied to "
+          "a column of stype " << arg->stype();
+  }
+}
+
+};  // namespace expr
@@ -0,0 +1,251 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+// This file implements the ternary select operation
+//     ifelse(cond, a, b)
+// which picks, for every row, the value of `a` where the boolean column
+// `cond` is true, the value of `b` where it is false, and NA where it is NA.
+//
+// The Python layer guarantees that `a` and `b` arrive with the same stype
+// (inserting casts where the user supplied different but compatible types),
+// so only one value type needs to be dispatched here. For fixed-width
+// columns the blend is a single branch-free pass that the compiler
+// vectorizes into masked selects. For string columns the output is
+// assembled with the same chunked offsets-merge scheme as the string ops in
+// "strop.cc": each thread copies the chosen strings of its chunk into a
+// private buffer, the buffers are concatenated, and the recorded per-row
+// lengths are folded into cumulative offsets.
+//
+// Either value operand may also be a single-row column (a literal), in
+// which case it is broadcast against the other rows.
+//------------------------------------------------------------------------------
+#include "expr/py_expr.h"
+#include <algorithm>           // std::max, std::min
+#include <cstring>             // std::memcpy
+#include <vector>
+#include "perf.h"
+#include "types.h"
+#include "utils/exceptions.h"
+#include "utils/omp.h"
+
+
+namespace expr
+{
+
+
+//------------------------------------------------------------------------------
+// Fixed-width blend
+//------------------------------------------------------------------------------
+
+// A condition row is NA either when it holds the NA sentinel, or when the
+// condition column carries a validity mask (attached by the relational ops
+// in "binaryop.cc", whose kernels return false for NA operands) with the
+// row's bit cleared.
+static inline bool cond_isna(const int8_t* c, const uint8_t* cmask,
+                             int64_t j) {
+  return ISNA<int8_t>(c[j]) ||
+         (cmask && !((cmask[j >> 3] >> (j & 7)) & 1));
+}
+
+
+template <typename T>
+static void blend_fw(const int8_t* c, const uint8_t* cmask, int64_t cstep,
+                     const T* a, int64_t astep,
+                     const T* b, int64_t bstep,
+                     T* out, int64_t n)
+{
+  T na = GETNA<T>();
+  #pragma omp parallel for schedule(static)
+  for (int64_t i = 0; i < n; ++i) {
+    int64_t j = i * cstep;
+    out[i] = cond_isna(c, cmask, j)? na : c[j]? a[i * astep] : b[i * bstep];
+  }
+}
+
+
+//------------------------------------------------------------------------------
+// String blend
+//------------------------------------------------------------------------------
+
+template <typename T>
+static Column* blend_str(const int8_t* c, const uint8_t* cmask,
+                         int64_t cstep,
+                         Column* acol, int64_t astep,
+                         Column* bcol, int64_t bstep,
+                         int64_t n)
+{
+  auto sa = static_cast<StringColumn<T>*>(acol);
+  auto sb = static_cast<StringColumn<T>*>(bcol);
+  const T* aoffs = sa->offsets();
+  const T* boffs = sb->offsets();
+  const char* adata = sa->strdata();
+  const char* bdata = sb->strdata();
+  size_t zn = static_cast<size_t>(n);
+
+  int nchunks = omp_get_max_threads();
+  int64_t chunklen = (n + nchunks - 1) / nchunks;
+  if (chunklen <= 0) { nchunks = 1; chunklen = 1; }
+  std::vector<std::vector<char>> tbufs(static_cast<size_t>(nchunks));
+
+  MemoryRange offbuf = MemoryRange::mem((zn + 1) * sizeof(T));
+  T* outoffs = static_cast<T*>(offbuf.wptr());
+  outoffs[0] = 0;
+  // During the parallel pass `lens[i]` holds the output length of row `i`
+  // (GETNA for NA rows); afterwards the lengths are folded into cumulative
+  // offsets in place.
+  T* lens = outoffs + 1;
+
+  #pragma omp parallel for schedule(static, 1)
+  for (int k = 0; k < nchunks; ++k) {
+    int64_t i0 = k * chunklen;
+    int64_t i1 = std::min(i0 + chunklen, n);
+    std::vector<char>& buf = tbufs[static_cast<size_t>(k)];
+    for (int64_t i = i0; i < i1; ++i) {
+      if (cond_isna(c, cmask, i * cstep)) {
+        lens[i] = GETNA<T>();
+        continue;
+      }
+      int8_t v = c[i * cstep];
+      const T* offs = v? aoffs : boffs;
+      const char* data = v? adata : bdata;
+      int64_t j = v? i * astep : i * bstep;
+      T oend = offs[j];
+      if (ISNA<T>(oend)) {
+        lens[i] = GETNA<T>();
+        continue;
+      }
+      T ostart = offs[j - 1] & ~GETNA<T>();
+      buf.insert(buf.end(), data + ostart, data + oend);
+      lens[i] = static_cast<T>(oend - ostart);
+    }
+  }
+
+  // Merge the per-thread buffers into the final strdata buffer.
+  std::vector<size_t> chunk_off(static_cast<size_t>(nchunks) + 1);
+  for (int k = 0; k < nchunks; ++k) {
+    size_t zk = static_cast<size_t>(k);
+    chunk_off[zk + 1] = chunk_off[zk] + tbufs[zk].size();
+  }
+  MemoryRange strbuf = MemoryRange::mem(chunk_off[static_cast<size_t>(nchunks)]);
+  char* out = static_cast<char*>(strbuf.wptr());
+  #pragma omp parallel for schedule(static, 1)
+  for (int k = 0; k < nchunks; ++k) {
+    size_t zk = static_cast<size_t>(k);
+    if (!tbufs[zk].empty()) {
+      std::memcpy(out + chunk_off[zk], tbufs[zk].data(), tbufs[zk].size());
+    }
+  }
+
+  // Fold the per-row lengths into cumulative offsets.
+  size_t cum = 0;
+  for (int64_t i = 0; i < n; ++i) {
+    if (lens[i] == GETNA<T>()) {
+      outoffs[i + 1] = static_cast<T>(cum) | GETNA<T>();
+    } else {
+      cum += static_cast<size_t>(lens[i]);
+      outoffs[i + 1] = static_cast<T>(cum);
+    }
+  }
+
+  return Column::new_mbuf_column(acol->stype(), std::move(offbuf),
+                                 std::move(strbuf));
+}
+
+
+//------------------------------------------------------------------------------
+// Main driver
+//------------------------------------------------------------------------------
+
+Column* ternaryop(Column* cond, Column* acol, Column* bcol)
+{
+  dt::perf::OpTimer optimer("expr.ternaryop");
+  optimer.set_bytes(static_cast<int64_t>(acol->alloc_size()) +
+                    static_cast<int64_t>(bcol->alloc_size()));
+
+  if (cond->stype() != SType::BOOL) {
+    throw TypeError() << "The condition of ifelse() must be a boolean "
+        "column, got stype " << cond->stype();
+  }
+  if (acol->stype() != bcol->stype()) {
+    throw TypeError() << "The branches of ifelse() must have the same stype, "
+        "got " << acol->stype() << " and " << bcol->stype();
+  }
+  int64_t n = std::max(cond->nrows, std::max(acol->nrows, bcol->nrows));
+  if ((cond->nrows != n && cond->nrows != 1) ||
+      (acol->nrows != n && acol->nrows != 1) ||
+      (bcol->nrows != n && bcol->nrows != 1)) {
+    throw ValueError() << "Cannot apply ifelse() to columns of incompatible "
+        "lengths " << cond->nrows << ", " << acol->nrows << " and "
+        << bcol->nrows;
+  }
+  cond->reify();
+  acol->reify();
+  bcol->reify();
+
+  const int8_t* c = static_cast<const int8_t*>(cond->data());
+  const uint8_t* cmask = cond->has_validity_mask()? cond->validity_mask()
+                                                  : nullptr;
+  int64_t cstep = (cond->nrows == n)? 1 : 0;
+  int64_t astep = (acol->nrows == n)? 1 : 0;
+  int64_t bstep = (bcol->nrows == n)? 1 : 0;
+  const void* a = acol->data();
+  const void* b = bcol->data();
+
+  SType st = acol->stype();
+  switch (st) {
+    case SType::STR32:
+      return blend_str<uint32_t>(c, cmask, cstep, acol, astep,
+                                 bcol, bstep, n);
+    case SType::STR64:
+      return blend_str<uint64_t>(c, cmask, cstep, acol, astep,
+                                 bcol, bstep, n);
+    default: break;
+  }
+
+  Column* res = Column::new_data_column(st, n);
+  void* out = res->data_w();
+  switch (st) {
+    case SType::BOOL:
+    case SType::INT8:
+      blend_fw<int8_t>(c, cmask, cstep, static_cast<const int8_t*>(a), astep,
+                       static_cast<const int8_t*>(b), bstep,
+                       static_cast<int8_t*>(out), n);
+      break;
+    case SType::INT16:
+      blend_fw<int16_t>(c, cmask, cstep, static_cast<const int16_t*>(a), astep,
+                        static_cast<const int16_t*>(b), bstep,
+                        static_cast<int16_t*>(out), n);
+      break;
+    case SType::INT32:
+      blend_fw<int32_t>(c, cmask, cstep, static_cast<const int32_t*>(a), astep,
+                        static_cast<const int32_t*>(b), bstep,
+                        static_cast<int32_t*>(out), n);
+      break;
+    case SType::INT64:
+      blend_fw<int64_t>(c, cmask, cstep, static_cast<const int64_t*>(a), astep,
+                        static_cast<const int64_t*>(b), bstep,
+                        static_cast<int64_t*>(out), n);
+      break;
+    case SType::FLOAT32:
+      blend_fw<float>(c, cmask, cstep, static_cast<const float*>(a), astep,
+                      static_cast<const float*>(b), bstep,
+                      static_cast<float*>(out), n);
+      break;
+    case SType::FLOAT64:
+      blend_fw<double>(c, cmask, cstep, static_cast<const double*>(a), astep,
+                       static_cast<const double*>(b), bstep,
+                       static_cast<double*>(out), n);
+      break;
+    default:
+      delete res;
+      throw TypeError() << "ifelse() cannot be applied to columns of stype "
+          << st;
+  }
+  return res;
+}
+
+};  // namespace expr
@@ -6,7 +6,12 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include "expr/py_expr.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
 #include "types.h"
+#include "utils/omp.h"
 
 namespace expr
 {
@@ -16,6 +21,14 @@ enum OpCode {
   Minus  = 2,
   Plus   = 3,
   Invert = 4,
+  Abs    = 5,
+  Exp    = 6,
+  Log    = 7,
+  Log10  = 8,
+  Sqrt   = 9,
+  Round  = 10,
+  Floor  = 11,
+  Ceil   = 12,
 };
 
 
@@ -29,6 +42,7 @@ static void map_n(int64_t row0, int64_t row1, void** params) {
   Column* col1 = static_cast<Column*>(params[1]);
   const IT* arg_data = static_cast<const IT*>(col0->data());
   OT* res_data = static_cast<OT*>(col1->data_w());
+  #pragma omp simd
   for (int64_t i = row0; i < row1; ++i) {
     res_data[i] = OP(arg_data[i]);
   }
@@ -81,6 +95,28 @@ inline static int8_t bool_inverse(int8_t x) {
   return ISNA<int8_t>(x)? x : !x;
 }
 
+template<typename T>
+inline static T op_abs(T x) {
+  return IsIntNA<T>(x)? x : (x < 0? -x : x);
+}
+
+// Math functions are float/double only (integer arguments are cast to
+// FLOAT64 by the driver). The float NA is a NaN, which propagates through
+// all of these on its own; out-of-domain arguments (log of a negative
+// number, etc) produce a NaN as well and therefore come out as NA.
+template<typename T> inline static T op_exp(T x)   { return std::exp(x); }
+template<typename T> inline static T op_log(T x)   { return std::log(x); }
+template<typename T> inline static T op_log10(T x) { return std::log10(x); }
+template<typename T> inline static T op_sqrt(T x)  { return std::sqrt(x); }
+
+// Rounding (also float/double only; on integer columns these are identity
+// transforms and the driver returns a shallow copy instead). `round` uses
+// rint(), i.e. round-half-to-even in the default FP environment, matching
+// numpy.
+template<typename T> inline static T op_round(T x) { return std::rint(x); }
+template<typename T> inline static T op_floor(T x) { return std::floor(x); }
+template<typename T> inline static T op_ceil(T x)  { return std::ceil(x); }
+
 
 
 //------------------------------------------------------------------------------
@@ -92,6 +128,7 @@ static mapperfn resolve1(int opcode) {
   switch (opcode) {
     case IsNa:    return map_n<IT, int8_t, op_isna<IT>>;
     case Minus:   return map_n<IT, IT, op_minus<IT>>;
+    case Abs:     return map_n<IT, IT, op_abs<IT>>;
     case Invert:
       if (std::is_floating_point<IT>::value) return nullptr;
       return map_n<IT, IT, Inverse<IT>::impl>;
@@ -99,6 +136,20 @@ static mapperfn resolve1(int opcode) {
   return nullptr;
 }
 
+template<typename T>
+static mapperfn resolve_math(int opcode) {
+  switch (opcode) {
+    case Exp:   return map_n<T, T, op_exp<T>>;
+    case Log:   return map_n<T, T, op_log<T>>;
+    case Log10: return map_n<T, T, op_log10<T>>;
+    case Sqrt:  return map_n<T, T, op_sqrt<T>>;
+    case Round: return map_n<T, T, op_round<T>>;
+    case Floor: return map_n<T, T, op_floor<T>>;
+    case Ceil:  return map_n<T, T, op_ceil<T>>;
+  }
+  return nullptr;
+}
+
 template<typename T>
 static mapperfn resolve_str(int opcode) {
   if (opcode == OpCode::IsNa) {
@@ -117,8 +168,14 @@ static mapperfn resolve0(SType stype, int opcode) {
     case SType::INT16:   return resolve1<int16_t>(opcode);
     case SType::INT32:   return resolve1<int32_t>(opcode);
     case SType::INT64:   return resolve1<int64_t>(opcode);
-    case SType::FLOAT32: return resolve1<float>(opcode);
-    case SType::FLOAT64: return resolve1<double>(opcode);
+    case SType::FLOAT32: {
+      mapperfn fn = resolve_math<float>(opcode);
+      return fn? fn : resolve1<float>(opcode);
+    }
+    case SType::FLOAT64: {
+      mapperfn fn = resolve_math<double>(opcode);
+      return fn? fn : resolve1<double>(opcode);
+    }
     case SType::STR32:   return resolve_str<uint32_t>(opcode);
     case SType::STR64:   return resolve_str<uint64_t>(opcode);
     default: break;
@@ -130,13 +187,32 @@ static mapperfn resolve0(SType stype, int opcode) {
 Column* unaryop(int opcode, Column* arg)
 {
   if (opcode == OpCode::Plus) return arg->shallowcopy();
+  if (opcode >= OpCode::Round && opcode <= OpCode::Ceil &&
+      arg->stype() != SType::FLOAT32 && arg->stype() != SType::FLOAT64) {
+    // Rounding an integer (or boolean) column is an identity transform.
+    return arg->shallowcopy();
+  }
   arg->reify();
 
   SType arg_type = arg->stype();
+  // The math ops work on floating point data only: integer/boolean columns
+  // are cast to FLOAT64 first.
+  Column* tmp = nullptr;
+  if (opcode >= OpCode::Exp && opcode <= OpCode::Sqrt &&
+      (arg_type == SType::BOOL  || arg_type == SType::INT8 ||
+       arg_type == SType::INT16 || arg_type == SType::INT32 ||
+       arg_type == SType::INT64))
+  {
+    tmp = arg->cast(SType::FLOAT64);
+    arg = tmp;
+    arg_type = SType::FLOAT64;
+  }
+
   SType res_type = arg_type;
   if (opcode == OpCode::IsNa) {
     res_type = SType::BOOL;
-  } else if (arg_type == SType::BOOL && opcode == OpCode::Minus) {
+  } else if (arg_type == SType::BOOL &&
+             (opcode == OpCode::Minus || opcode == OpCode::Abs)) {
     res_type = SType::INT8;
   }
   void* params[2];
@@ -145,15 +221,161 @@ Column* unaryop(int opcode, Column* arg)
 
   mapperfn fn = resolve0(arg_type, opcode);
   if (!fn) {
+    delete tmp;
     throw RuntimeError()
       << "Unable to apply unary op " << opcode << " to column(stype="
       << arg_type << ")";
   }
 
-  (*fn)(0, arg->nrows, params);
+  int64_t nrows = arg->nrows;
+  int nchunks = omp_get_max_threads();
+  int64_t chunklen = (nrows + nchunks - 1) / nchunks;
+  if (chunklen <= 0) { nchunks = 1; chunklen = 1; }
+  #pragma omp parallel for schedule(static, 1)
+  for (int k = 0; k < nchunks; ++k) {
+    int64_t i0 = k * chunklen;
+    int64_t i1 = std::min(i0 + chunklen, nrows);
+    if (i0 < i1) (*fn)(i0, i1, params);
+  }
 
+  delete tmp;
   return static_cast<Column*>(params[1]);
 }
 
 
+//------------------------------------------------------------------------------
+// Clip
+//------------------------------------------------------------------------------
+
+template <typename T>
+static Column* clip_fw(Column* arg, double lo, double hi,
+                       bool has_lo, bool has_hi)
+{
+  // Convert the bounds into the column's own type, rounding inward for
+  // integer types (a lower bound of 2.3 clips to 3) and keeping them clear
+  // of the NA sentinel at the type minimum.
+  T tlo = T();
+  T thi = T();
+  if (std::is_integral<T>::value) {
+    double dmin = static_cast<double>(std::numeric_limits<T>::min() + 1);
+    double dmax = static_cast<double>(std::numeric_limits<T>::max());
+    if (has_lo) {
+      tlo = static_cast<T>(std::min(std::max(std::ceil(lo), dmin), dmax));
+    }
+    if (has_hi) {
+      thi = static_cast<T>(std::min(std::max(std::floor(hi), dmin), dmax));
+    }
+  } else {
+    tlo = static_cast<T>(lo);
+    thi = static_cast<T>(hi);
+  }
+  int64_t n = arg->nrows;
+  Column* res = Column::new_data_column(arg->stype(), n);
+  const T* in = static_cast<const T*>(arg->data());
+  T* out = static_cast<T*>(res->data_w());
+  #pragma omp parallel for schedule(static)
+  for (int64_t i = 0; i < n; ++i) {
+    T x = in[i];
+    if (!ISNA<T>(x)) {
+      if (has_lo && x < tlo) x = tlo;
+      if (has_hi && x > thi) x = thi;
+    }
+    out[i] = x;
+  }
+  return res;
+}
+
+
+Column* clipop(Column* arg, double lo, double hi, bool has_lo, bool has_hi)
+{
+  if (!has_lo && !has_hi) return arg->shallowcopy();
+  arg->reify();
+  switch (arg->stype()) {
+    case SType::BOOL:
+    case SType::INT8:    return clip_fw<int8_t>(arg, lo, hi, has_lo, has_hi);
+    case SType::INT16:   return clip_fw<int16_t>(arg, lo, hi, has_lo, has_hi);
+    case SType::INT32:   return clip_fw<int32_t>(arg, lo, hi, has_lo, has_hi);
+    case SType::INT64:   return clip_fw<int64_t>(arg, lo, hi, has_lo, has_hi);
+    case SType::FLOAT32: return clip_fw<float>(arg, lo, hi, has_lo, has_hi);
+    case SType::FLOAT64: return clip_fw<double>(arg, lo, hi, has_lo, has_hi);
+    default:
+      throw TypeError() << "clip() cannot be applied to a column of stype "
+          << arg->stype();
+  }
+}
+
+
+//------------------------------------------------------------------------------
+// Bucketize
+//------------------------------------------------------------------------------
+
+template <typename T>
+static void bucketize_fw(const T* in, int32_t* out, int64_t n,
+                         double vmin, double inv_width, int32_t nbins)
+{
+  #pragma omp parallel for schedule(static)
+  for (int64_t i = 0; i < n; ++i) {
+    T x = in[i];
+    if (ISNA<T>(x)) {
+      out[i] = GETNA<int32_t>();
+      continue;
+    }
+    double b = (static_cast<double>(x) - vmin) * inv_width;
+    out[i] = b <= 0.0? 0 :
+             b >= nbins? nbins - 1 : static_cast<int32_t>(b);
+  }
+}
+
+
+Column* bucketizeop(Column* arg, int nbins, double lo, double hi)
+{
+  if (nbins < 1) {
+    throw ValueError() << "The number of bins must be positive, got "
+        << nbins;
+  }
+  if (!(hi > lo)) {
+    throw ValueError() << "Invalid bucketize() range: the upper bound "
+        << hi << " must exceed the lower bound " << lo;
+  }
+  arg->reify();
+  int64_t n = arg->nrows;
+  Column* res = Column::new_data_column(SType::INT32, n);
+  int32_t* out = static_cast<int32_t*>(res->data_w());
+  double inv_width = nbins / (hi - lo);
+  const void* in = arg->data();
+  switch (arg->stype()) {
+    case SType::BOOL:
+    case SType::INT8:
+      bucketize_fw<int8_t>(static_cast<const int8_t*>(in), out, n,
+                           lo, inv_width, nbins);
+      break;
+    case SType::INT16:
+      bucketize_fw<int16_t>(static_cast<const int16_t*>(in), out, n,
+                            lo, inv_width, nbins);
+      break;
+    case SType::INT32:
+      bucketize_fw<int32_t>(static_cast<const int32_t*>(in), out, n,
+                            lo, inv_width, nbins);
+      break;
+    case SType::INT64:
+      bucketize_fw<int64_t>(static_cast<const int64_t*>(in), out, n,
+                            lo, inv_width, nbins);
+      break;
+    case SType::FLOAT32:
+      bucketize_fw<float>(static_cast<const float*>(in), out, n,
+                          lo, inv_width, nbins);
+      break;
+    case SType::FLOAT64:
+      bucketize_fw<double>(static_cast<const double*>(in), out, n,
+                           lo, inv_width, nbins);
+      break;
+    default:
+      delete res;
+      throw TypeError() << "bucketize() cannot be applied to a column of "
+          "stype " << arg->stype();
+  }
+  return res;
+}
+
+
 };  // namespace expr
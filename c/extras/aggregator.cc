@@ -7,13 +7,17 @@
 //------------------------------------------------------------------------------
 #define dt_EXTRAS_AGGREGATOR_cc
 #include "extras/aggregator.h"
+#include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include "frame/py_frame.h"
+#include "options.h"
 #include "py_utils.h"
 #include "python/obj.h"
 #include "rowindex.h"
 #include "types.h"
 #include "utils/omp.h"
+#include "utils/shared_mutex.h"
 #include <map>
 
 
@@ -78,12 +82,30 @@ DataTablePtr Aggregator::aggregate(DataTable* dt) {
     Column** cols_double = dt::amalloc<Column*>(dt->ncols + 1);
     int32_t ncols = 0;
 
+    // Count the prospective columns first: with more than `max_dimensions`
+    // of them the grouping goes through the blocked projection stage, which
+    // reads the data one column group at a time. In that case the columns
+    // are converted to double inside `project_rows()` incrementally,
+    // instead of materializing a double-precision copy of the whole frame
+    // up front (2x memory amplification on our widest runs).
+    int32_t ncols0 = 0;
+    for (int64_t i = 0; i < dt->ncols; ++i) {
+      LType ltype = info(dt->columns[i]->stype()).ltype();
+      if (ltype == LType::BOOL || ltype == LType::INT ||
+          ltype == LType::REAL) ++ncols0;
+      else if (dt->ncols < 3) ++ncols0;
+    }
+    bool stream_columns = ncols0 > max_dimensions && ncols0 > 2;
+
     for (int64_t i = 0; i < dt->ncols; ++i) {
       LType ltype = info(dt->columns[i]->stype()).ltype();
       switch (ltype) {
         case LType::BOOL:
         case LType::INT:
-        case LType::REAL: cols_double[ncols++] = dt->columns[i]->cast(SType::FLOAT64); break;
+        case LType::REAL: cols_double[ncols++] = stream_columns
+                              ? dt->columns[i]->shallowcopy()
+                              : dt->columns[i]->cast(SType::FLOAT64);
+                          break;
         default:          if (dt->ncols < 3) cols_double[ncols++] = dt->columns[i]->shallowcopy();
       }
     }
@@ -382,16 +404,26 @@ void Aggregator::group_2d_mixed(bool cont_index, DataTablePtr& dt_exemplars,
 void Aggregator::group_nd(DataTablePtr& dt_exemplars, DataTablePtr& dt_members) {
   auto d = static_cast<int32_t>(dt_exemplars->ncols);
   int64_t ndims = std::min(max_dimensions, d);
-  int64_t i_step = (dt_exemplars->nrows > PBSTEPS)? dt_exemplars->nrows / PBSTEPS : 1;
-  DoublePtr member = DoublePtr(new double[ndims]);
+  int64_t nrows = dt_exemplars->nrows;
+  int64_t i_step = (nrows > PBSTEPS)? nrows / PBSTEPS : 1;
   DoublePtr pmatrix = nullptr;
+  DoublePtr projections = nullptr;
   std::vector<ExPtr> exemplars;
   std::vector<int64_t> ids;
+  std::vector<double> norms;  // per-exemplar norm, for the coarse pre-filter
   auto d_members = static_cast<int32_t*>(dt_members->columns[0]->data_w());
-  if (d > max_dimensions) pmatrix = generate_pmatrix(dt_exemplars);
-
-  // This is to ensure that the first row is saved as an exemplar
-  double distance = std::numeric_limits<double>::max();
+  if (d > max_dimensions) {
+    pmatrix = generate_pmatrix(dt_exemplars);
+    projections = project_rows(dt_exemplars, pmatrix);
+  } else {
+    // Column stats are computed lazily; trigger the computation now, so
+    // that the worker threads below only ever read them.
+    for (int64_t j = 0; j < dt_exemplars->ncols; ++j) {
+      auto c_real = static_cast<RealColumn<double>*>(dt_exemplars->columns[j]);
+      c_real->min();
+      c_real->max();
+    }
+  }
 
   // Radius calculations
   // double radius2 = (d / 6.0) - 1.744 * sqrt(7.0 * d / 180.0);
@@ -402,35 +434,152 @@ void Aggregator::group_nd(DataTablePtr& dt_exemplars, DataTablePtr& dt_members)
   // double delta = radius * radius;
   double delta = epsilon;
 
-  // Main loop
-  for (int32_t i = 0; i < dt_exemplars->nrows; ++i) {
-    if (d > max_dimensions) project_row(dt_exemplars, member, i, pmatrix);
-    else normalize_row(dt_exemplars, member, i);
-    for (size_t j = 0; j < exemplars.size(); ++j) {
-      distance = calculate_distance(member, exemplars[j]->coords, ndims, delta);
-      if (distance < delta) {
-        d_members[i] = static_cast<int32_t>(exemplars[j]->id);
-        break;
+  // Appends a new exemplar for row `i`, merging exemplars and adjusting
+  // `delta` when their number exceeds `nd_max_bins`. When running inside
+  // the parallel section below, the caller must hold the exclusive lock.
+  auto add_exemplar = [&](int64_t i, DoublePtr& member, double norm) {
+    ExPtr e = ExPtr(new ex{static_cast<int64_t>(ids.size()),
+                           std::move(member)});
+    member = DoublePtr(new double[ndims]);
+    ids.push_back(e->id);
+    d_members[i] = static_cast<int32_t>(e->id);
+    norms.push_back(norm);
+    exemplars.push_back(std::move(e));
+    if (exemplars.size() > static_cast<size_t>(nd_max_bins)) {
+      adjust_delta(delta, exemplars, ids, ndims);
+      // `adjust_delta` may merge exemplars away: rebuild the norm cache
+      // for the survivors.
+      norms.resize(exemplars.size());
+      for (size_t j = 0; j < exemplars.size(); ++j) {
+        norms[j] = calculate_norm(exemplars[j]->coords, ndims);
       }
     }
-    if (distance >= delta) {
-      ExPtr e = ExPtr(new ex{static_cast<int64_t>(ids.size()), std::move(member)});
-      member = DoublePtr(new double[ndims]);
-      ids.push_back(e->id);
-      d_members[i] = static_cast<int32_t>(e->id);
-      exemplars.push_back(std::move(e));
-      if (exemplars.size() > static_cast<size_t>(nd_max_bins)) {
-        adjust_delta(delta, exemplars, ids, ndims);
+  };
+
+  // Seeding pass: taking exemplars in row order skews them towards the
+  // leading rows on sorted inputs, causing many delta adjustments later.
+  // Sample up to `nd_max_bins` candidate rows uniformly (reservoir
+  // sampling over the row indices) and run them through the exemplar test
+  // first, so that the initial exemplars cover the whole value range and
+  // `delta` is calibrated from an unbiased sample. The pass only runs
+  // when an explicit seed is supplied: with the default seed of 0 the
+  // exemplars are taken in row order as before, so the default output
+  // stays deterministic and unchanged.
+  if (seed) {
+    size_t k = std::min(static_cast<size_t>(nd_max_bins),
+                        static_cast<size_t>(nrows));
+    std::vector<int64_t> candidates(k);
+    for (size_t c = 0; c < k; ++c) candidates[c] = static_cast<int64_t>(c);
+    std::default_random_engine generator(seed);
+    for (int64_t i = static_cast<int64_t>(k); i < nrows; ++i) {
+      std::uniform_int_distribution<int64_t> dist(0, i);
+      int64_t j = dist(generator);
+      if (j < static_cast<int64_t>(k)) candidates[static_cast<size_t>(j)] = i;
+    }
+
+    DoublePtr member = DoublePtr(new double[ndims]);
+    for (size_t c = 0; c < k; ++c) {
+      int64_t i = candidates[c];
+      bool is_exemplar = true;
+      if (d > max_dimensions) {
+        std::memcpy(member.get(), projections.get() + i * ndims,
+                    static_cast<size_t>(ndims) * sizeof(double));
+      }
+      else normalize_row(dt_exemplars, member, static_cast<int32_t>(i));
+      double norm = calculate_norm(member, ndims);
+      for (size_t j = 0; j < exemplars.size(); ++j) {
+        double dnorm = norm - norms[j];
+        if (dnorm * dnorm >= delta) continue;
+        double distance = calculate_distance(member, exemplars[j]->coords,
+                                             ndims, delta);
+        if (distance < delta) {
+          d_members[i] = static_cast<int32_t>(exemplars[j]->id);
+          is_exemplar = false;
+          break;
+        }
+      }
+      if (is_exemplar) {
+        add_exemplar(i, member, norm);
       }
     }
-    if (i % i_step == 0) {
-      progress(static_cast<double>(i+1)/dt_exemplars->nrows);
+  }
+
+  // Main loop, parallelized over the rows. Each thread scans the shared
+  // exemplar list under a shared lock; an exclusive lock is taken only when
+  // a thread wants to add a new exemplar. Since other threads may have added
+  // exemplars between the scan and the lock acquisition, the scan is redone
+  // for those newcomers before committing. The `norms` pre-filter relies on
+  // the reverse triangle inequality: `dist(a, b) >= (|a| - |b|)^2`, so
+  // exemplars whose norm differs from the row's by more than sqrt(delta)
+  // are skipped without computing the full distance.
+  dt::shared_mutex shmutex;
+  config::thread_grant tgrant;
+  #pragma omp parallel num_threads(tgrant.nthreads())
+  {
+    int ith = omp_get_thread_num();
+    int nth = omp_get_num_threads();
+    DoublePtr member = DoublePtr(new double[ndims]);
+    size_t ecounter_local;
+
+    for (int64_t i = ith; i < nrows; i += nth) {
+      bool is_exemplar = true;
+      auto irow = static_cast<int32_t>(i);
+      if (d > max_dimensions) {
+        std::memcpy(member.get(), projections.get() + i * ndims,
+                    static_cast<size_t>(ndims) * sizeof(double));
+      }
+      else normalize_row(dt_exemplars, member, irow);
+      double norm = calculate_norm(member, ndims);
+
+      test_member: {
+        dt::shared_lock lock(shmutex);
+        ecounter_local = exemplars.size();
+        for (size_t j = 0; j < ecounter_local; ++j) {
+          double dnorm = norm - norms[j];
+          if (dnorm * dnorm >= delta) continue;
+          double distance = calculate_distance(member, exemplars[j]->coords,
+                                               ndims, delta);
+          if (distance < delta) {
+            d_members[i] = static_cast<int32_t>(exemplars[j]->id);
+            is_exemplar = false;
+            break;
+          }
+        }
+      }
+
+      if (is_exemplar) {
+        dt::shared_lock lock(shmutex, /* exclusive = */ true);
+        if (exemplars.size() == ecounter_local) {
+          add_exemplar(i, member, norm);
+        } else {
+          // Other threads have appended new exemplars while we were waiting
+          // for the exclusive lock: re-test against them first.
+          goto test_member;
+        }
+      }
+
+      if (ith == 0 && i % i_step == 0) {
+        progress(static_cast<double>(i+1)/nrows);
+      }
     }
   }
   adjust_members(ids, dt_members);
 }
 
 
+/*
+*  Calculate the Euclidean norm of a point, used by the `group_nd`
+*  pre-filter.
+*/
+double Aggregator::calculate_norm(DoublePtr& p, int64_t ndims) {
+  double sum = 0.0;
+  for (int64_t i = 0; i < ndims; ++i) {
+    sum += p[i] * p[i];
+  }
+  return std::sqrt(sum);
+}
+
+
 /*
 *  Adjust `delta` (i.e. `radius^2`) based on the mean distance between
 *  the gathered exemplars and merge all the exemplars within that distance.
@@ -524,10 +673,35 @@ size_t Aggregator::calculate_map(std::vector<int64_t>& ids, size_t id) {
 double Aggregator::calculate_distance(DoublePtr& e1, DoublePtr& e2,
                                       int64_t ndims, double delta,
                                       bool early_exit /*=true*/) {
+  constexpr size_t BLOCK = 8;
+  size_t zdims = static_cast<size_t>(ndims);
   double sum = 0.0;
-  int32_t n = 0;
+  size_t i = 0;
+
+  // Fast path: accumulate the squared differences in blocks of BLOCK
+  // dimensions with a branch-free loop that the compiler vectorizes
+  // (fused multiply-adds over the whole block), checking the early-exit
+  // threshold once per block instead of once per dimension. An NA in
+  // either point turns the block sum into NaN, in which case the block is
+  // discarded and we drop to the scalar NA-aware loop below.
+  while (i + BLOCK <= zdims) {
+    double bsum = 0.0;
+    #pragma omp simd reduction(+:bsum)
+    for (size_t k = 0; k < BLOCK; ++k) {
+      double diff = e1[i + k] - e2[i + k];
+      bsum += diff * diff;
+    }
+    if (std::isnan(bsum)) break;
+    sum += bsum;
+    i += BLOCK;
+    if (early_exit && sum > delta) return sum;
+  }
 
-  for (size_t i = 0; i < static_cast<size_t>(ndims); ++i) {
+  // Scalar loop: handles the remaining dimensions, i.e. the tail that did
+  // not fill a whole block, or everything from the first NA-bearing block
+  // onwards. All dimensions before `i` are known to be valid.
+  int32_t n = static_cast<int32_t>(i);
+  for (; i < zdims; ++i) {
     if (ISNA<double>(e1[i]) || ISNA<double>(e2[i])) continue;
     ++n;
     sum += (e1[i] - e2[i]) * (e1[i] - e2[i]);
@@ -558,10 +732,35 @@ void Aggregator::normalize_row(DataTablePtr& dt, DoublePtr& r, int32_t row_id) {
 /*
 *  Generate projection matrix.
 */
+/**
+ * Single-slot cache for the generated projection matrix. Streaming
+ * workloads repeatedly aggregate batches of the same shape with a fixed
+ * seed, and the matrix depends only on (ncols, max_dimensions, seed), so
+ * those calls can reuse it instead of regenerating. Matrices produced
+ * from a random seed (seed = 0) are never cached.
+ */
+static struct {
+  int64_t ncols = 0;
+  int32_t max_dimensions = 0;
+  unsigned int seed = 0;
+  std::vector<double> matrix;
+} pmatrix_cache;
+
+
 DoublePtr Aggregator::generate_pmatrix(DataTablePtr& dt_exemplars) {
   std::default_random_engine generator;
+  size_t zsize = static_cast<size_t>((dt_exemplars->ncols) * max_dimensions);
   DoublePtr pmatrix = DoublePtr(new double[(dt_exemplars->ncols) * max_dimensions]);
 
+  if (seed && seed == pmatrix_cache.seed &&
+      dt_exemplars->ncols == pmatrix_cache.ncols &&
+      max_dimensions == pmatrix_cache.max_dimensions) {
+    std::memcpy(pmatrix.get(), pmatrix_cache.matrix.data(),
+                zsize * sizeof(double));
+    return pmatrix;
+  }
+
+  unsigned int seed0 = seed;
   if (!seed) {
     std::random_device rd;
     seed = rd();
@@ -577,6 +776,13 @@ DoublePtr Aggregator::generate_pmatrix(DataTablePtr& dt_exemplars) {
     pmatrix[i] = distribution(generator);
   }
 
+  if (seed0) {
+    pmatrix_cache.ncols = dt_exemplars->ncols;
+    pmatrix_cache.max_dimensions = max_dimensions;
+    pmatrix_cache.seed = seed0;
+    pmatrix_cache.matrix.assign(pmatrix.get(), pmatrix.get() + zsize);
+  }
+
   return pmatrix;
 }
 
@@ -611,6 +817,87 @@ void Aggregator::project_row(DataTablePtr& dt_exemplars, DoublePtr& r,
 }
 
 
+/*
+*  Project all the rows onto the `max_dimensions` subspace in blocked
+*  passes, returning a buffer of `nrows x max_dimensions` doubles. The
+*  columns are processed in groups of CBLOCK: only the current group is
+*  ever converted to double (a cheap shallow copy when a column already is
+*  FLOAT64), which keeps the conversion memory bounded regardless of the
+*  frame's width. Within a group the rows are processed in chunks of
+*  RBLOCK, streaming the source column data contiguously while the
+*  matching stripe of the projection matrix stays hot in cache --
+*  effectively a small cache-tiled GEMM. Chunks are independent and run in
+*  parallel.
+*/
+DoublePtr Aggregator::project_rows(DataTablePtr& dt_exemplars,
+                                   DoublePtr& pmatrix) {
+  constexpr size_t RBLOCK = 32;  // rows per parallel chunk
+  constexpr size_t CBLOCK = 8;   // columns converted and streamed per pass
+  size_t md = static_cast<size_t>(max_dimensions);
+  size_t nrows = static_cast<size_t>(dt_exemplars->nrows);
+  size_t ncols = static_cast<size_t>(dt_exemplars->ncols);
+  DoublePtr proj = DoublePtr(new double[nrows * md]);
+  std::memset(proj.get(), 0, nrows * md * sizeof(double));
+  std::vector<int32_t> counts(nrows, 0);
+  config::thread_grant tgrant;
+
+  for (size_t i0 = 0; i0 < ncols; i0 += CBLOCK) {
+    size_t i1 = std::min(i0 + CBLOCK, ncols);
+
+    // Convert this group of columns to double and compute their
+    // normalization coefficients. The lazy min/max stats are forced here,
+    // so the parallel loop below only ever reads them.
+    std::vector<Column*> dcols(i1 - i0);
+    std::vector<const double*> cdata(i1 - i0);
+    std::vector<double> nfactors(i1 - i0);
+    std::vector<double> nshifts(i1 - i0);
+    for (size_t i = i0; i < i1; ++i) {
+      Column* c = dt_exemplars->columns[i]->cast(SType::FLOAT64);
+      auto c_real = static_cast<RealColumn<double>*>(c);
+      set_norm_coeffs(nfactors[i - i0], nshifts[i - i0],
+                      c_real->min(), c_real->max(), 1);
+      dcols[i - i0] = c;
+      cdata[i - i0] = c_real->elements_r();
+    }
+
+    #pragma omp parallel for schedule(static) num_threads(tgrant.nthreads())
+    for (size_t r0 = 0; r0 < nrows; r0 += RBLOCK) {
+      size_t r1 = std::min(r0 + RBLOCK, nrows);
+      double* out = proj.get() + r0 * md;
+
+      for (size_t i = i0; i < i1; ++i) {
+        const double* d_real = cdata[i - i0];
+        const double* prow = pmatrix.get() + i * md;
+        for (size_t r = r0; r < r1; ++r) {
+          double value = d_real[r];
+          if (ISNA<double>(value)) continue;
+          double norm_row = nfactors[i - i0] * value + nshifts[i - i0];
+          double* outr = out + (r - r0) * md;
+          #pragma omp simd
+          for (size_t j = 0; j < md; ++j) {
+            outr[j] += prow[j] * norm_row;
+          }
+          counts[r]++;
+        }
+      }
+    }
+
+    for (size_t i = i0; i < i1; ++i) {
+      delete dcols[i - i0];
+    }
+  }
+
+  #pragma omp parallel for schedule(static) num_threads(tgrant.nthreads())
+  for (size_t r = 0; r < nrows; ++r) {
+    double* outr = proj.get() + r * md;
+    for (size_t j = 0; j < md; ++j) {
+      outr[j] /= counts[r];
+    }
+  }
+  return proj;
+}
+
+
 /*
 *  To normalize a continuous column x to [0; 1] range we use
 *  the following formula: x_i_new = (x_i - min) / (max - min),
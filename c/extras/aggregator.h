@@ -59,8 +59,10 @@ class Aggregator {
     DoublePtr generate_pmatrix(DataTablePtr&);
     void normalize_row(DataTablePtr&, DoublePtr&, int32_t);
     void project_row(DataTablePtr&, DoublePtr&, int32_t, DoublePtr&);
+    DoublePtr project_rows(DataTablePtr&, DoublePtr&);
     double calculate_distance(DoublePtr&, DoublePtr&, int64_t, double,
                               bool early_exit=true);
+    static double calculate_norm(DoublePtr&, int64_t);
     void adjust_delta(double&, std::vector<ExPtr>&, std::vector<int64_t>&,
                       int64_t);
     void adjust_members(std::vector<int64_t>&, DataTablePtr&);
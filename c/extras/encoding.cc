@@ -0,0 +1,212 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#define dt_EXTRAS_ENCODING_cc
+#include "extras/encoding.h"
+#include <cstring>
+#include "column.h"
+#include "frame/py_frame.h"
+#include "memrange.h"
+#include "options.h"
+#include "python/obj.h"
+#include "rowindex.h"
+#include "utils/exceptions.h"
+#include "utils/omp.h"
+
+
+/**
+ * Dictionary of a single string column: the rows in sorted order, the group
+ * boundaries delimiting equal values, and the distinct values themselves in
+ * dictionary (i.e. sorted) order. NA values, if present, form their own group
+ * (`na_group`) and are excluded from `values`.
+ */
+struct ColumnDictionary {
+  Groupby gb;
+  arr32_t riarr;           // row numbers, sorted by value
+  const int32_t* offsets;  // `ngroups + 1` boundaries into `riarr`
+  std::vector<std::string> values;
+  int64_t na_group;        // index of the NA group, or -1 if no NAs
+
+  ColumnDictionary() : offsets(nullptr), na_group(-1) {}
+};
+
+
+template <typename T>
+static void extract_values(const StringColumn<T>* col, ColumnDictionary& dict) {
+  const T* offs = col->offsets();
+  const char* strs = col->strdata();
+  size_t ngroups = dict.gb.ngroups();
+  for (size_t g = 0; g < ngroups; ++g) {
+    int32_t row = dict.riarr[static_cast<size_t>(dict.offsets[g])];
+    T off = offs[row];
+    if (ISNA<T>(off)) {
+      dict.na_group = static_cast<int64_t>(g);
+      continue;
+    }
+    T start = offs[row - 1] & ~GETNA<T>();
+    dict.values.push_back(std::string(strs + start,
+                                      static_cast<size_t>(off - start)));
+  }
+}
+
+
+/**
+ * Group the frame's single string column via the sort machinery and read out
+ * the distinct values. Returns a materialized copy of the column (the caller
+ * takes ownership), whose rows are in the same order as `dict.riarr` indexes.
+ */
+static Column* build_dictionary(DataTable* dt, ColumnDictionary& dict) {
+  arr32_t cols(1);
+  cols[0] = 0;
+  RowIndex ri = dt->sortby(cols, &dict.gb);
+  dict.offsets = dict.gb.offsets_r();
+  dict.riarr = ri.extract_as_array32();
+
+  Column* col = dt->columns[0]->shallowcopy();
+  col->reify();
+  if (col->stype() == SType::STR32) {
+    extract_values(static_cast<const StringColumn<uint32_t>*>(col), dict);
+  } else {
+    extract_values(static_cast<const StringColumn<uint64_t>*>(col), dict);
+  }
+  return col;
+}
+
+
+static void check_input(const DataTable* dt) {
+  if (dt->ncols != 1) {
+    throw ValueError() << "Frame must have a single column to be encoded, "
+                          "got " << dt->ncols << " columns";
+  }
+  SType st = dt->columns[0]->stype();
+  if (st != SType::STR32 && st != SType::STR64) {
+    throw TypeError() << "Column of type `" << info(st).name()
+                      << "` cannot be encoded: a string column is required";
+  }
+}
+
+
+/**
+ * Expand the column into one boolean indicator column per distinct value.
+ * All indicator columns are carved out of a single arena buffer, so the
+ * result costs one allocation of `nrows * ncategories` bytes instead of one
+ * allocation per category. Rows with NA values are zero in every indicator.
+ */
+static DataTable* encode_onehot(DataTable* dt) {
+  ColumnDictionary dict;
+  delete build_dictionary(dt, dict);  // only the values are needed here
+  int64_t nrows = dt->nrows;
+  int64_t ngroups = static_cast<int64_t>(dict.gb.ngroups());
+  size_t ncats = dict.values.size();
+  size_t zrows = static_cast<size_t>(nrows);
+
+  MemoryRange arena = MemoryRange::mem(zrows * ncats);
+  auto data = static_cast<int8_t*>(arena.wptr());
+  std::memset(data, 0, arena.size());
+
+  config::thread_grant tgrant;
+  #pragma omp parallel for schedule(dynamic) num_threads(tgrant.nthreads())
+  for (int64_t g = 0; g < ngroups; ++g) {
+    if (g == dict.na_group) continue;
+    size_t cat = static_cast<size_t>(
+        g - (dict.na_group >= 0 && g > dict.na_group));
+    int8_t* out = data + cat * zrows;
+    for (int32_t j = dict.offsets[g]; j < dict.offsets[g + 1]; ++j) {
+      out[dict.riarr[static_cast<size_t>(j)]] = 1;
+    }
+  }
+
+  Column** outcols = dt::amalloc<Column*>(static_cast<int64_t>(ncats) + 1);
+  for (size_t i = 0; i < ncats; ++i) {
+    outcols[i] = Column::new_mbuf_column(
+        SType::BOOL, MemoryRange::view(arena, zrows, i * zrows));
+  }
+  outcols[ncats] = nullptr;
+  return new DataTable(outcols, dict.values);
+}
+
+
+/**
+ * Replace the column's values with dense int32 codes: the position of each
+ * value in the sorted dictionary. NA values map to NA codes. The second
+ * output frame lists the distinct values themselves, so that `categories`
+ * row `k` is the value encoded as `k`.
+ */
+static void encode_label(DataTable* dt, DataTable** out_codes,
+                         DataTable** out_cats) {
+  ColumnDictionary dict;
+  Column* col = build_dictionary(dt, dict);
+  int64_t ngroups = static_cast<int64_t>(dict.gb.ngroups());
+
+  Column* codes_col = Column::new_data_column(SType::INT32, dt->nrows);
+  auto d_codes = static_cast<int32_t*>(codes_col->data_w());
+
+  config::thread_grant tgrant;
+  #pragma omp parallel for schedule(dynamic) num_threads(tgrant.nthreads())
+  for (int64_t g = 0; g < ngroups; ++g) {
+    int32_t code = (g == dict.na_group)
+        ? GETNA<int32_t>()
+        : static_cast<int32_t>(g - (dict.na_group >= 0 && g > dict.na_group));
+    for (int32_t j = dict.offsets[g]; j < dict.offsets[g + 1]; ++j) {
+      d_codes[dict.riarr[static_cast<size_t>(j)]] = code;
+    }
+  }
+
+  Column** ccols = dt::amalloc<Column*>(static_cast<int64_t>(2));
+  ccols[0] = codes_col;
+  ccols[1] = nullptr;
+  *out_codes = new DataTable(ccols, {"code"});
+
+  // The categories frame is a view of the materialized column, selecting the
+  // first row of every non-NA group in dictionary order.
+  size_t ncats = dict.values.size();
+  arr32_t cat_rows(ncats);
+  size_t k = 0;
+  for (int64_t g = 0; g < ngroups; ++g) {
+    if (g == dict.na_group) continue;
+    cat_rows[k++] = dict.riarr[static_cast<size_t>(dict.offsets[g])];
+  }
+  Column** kcols = dt::amalloc<Column*>(static_cast<int64_t>(2));
+  kcols[0] = col;
+  kcols[1] = nullptr;
+  *out_cats = new DataTable(kcols, {"category"});
+  // The rows are in dictionary (value) order, not in ascending row order,
+  // so the index must not claim to be sorted.
+  (*out_cats)->replace_rowindex(RowIndex::from_array32(std::move(cat_rows),
+                                                       false));
+}
+
+
+PyObject* onehot(PyObject*, PyObject* args) {
+  PyObject* arg1;
+  if (!PyArg_ParseTuple(args, "O:onehot", &arg1)) return nullptr;
+  DataTable* dt = py::obj(arg1).to_frame();
+  check_input(dt);
+  return py::Frame::from_datatable(encode_onehot(dt));
+}
+
+
+PyObject* label_encode(PyObject*, PyObject* args) {
+  PyObject* arg1;
+  if (!PyArg_ParseTuple(args, "O:label_encode", &arg1)) return nullptr;
+  DataTable* dt = py::obj(arg1).to_frame();
+  check_input(dt);
+
+  DataTable* dt_codes = nullptr;
+  DataTable* dt_cats = nullptr;
+  encode_label(dt, &dt_codes, &dt_cats);
+
+  PyObject* res = PyTuple_New(2);
+  if (!res) {
+    delete dt_codes;
+    delete dt_cats;
+    return nullptr;
+  }
+  PyTuple_SET_ITEM(res, 0, py::Frame::from_datatable(dt_codes));
+  PyTuple_SET_ITEM(res, 1, py::Frame::from_datatable(dt_cats));
+  return res;
+}
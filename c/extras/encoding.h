@@ -0,0 +1,22 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include <string>
+#include <vector>
+#include "datatable.h"
+#include "types.h"
+#include "py_datatable.h"
+
+DECLARE_FUNCTION(
+  onehot,
+  "onehot(frame)\n\n",
+  dt_EXTRAS_ENCODING_cc)
+
+DECLARE_FUNCTION(
+  label_encode,
+  "label_encode(frame)\n\n",
+  dt_EXTRAS_ENCODING_cc)
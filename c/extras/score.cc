@@ -0,0 +1,169 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#define dt_EXTRAS_SCORE_cc
+#include "extras/score.h"
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "column.h"
+#include "frame/py_frame.h"
+#include "options.h"
+#include "python/list.h"
+#include "python/obj.h"
+#include "utils/exceptions.h"
+#include "utils/omp.h"
+
+
+/**
+ * FNV-1a hash over a character range. We roll our own instead of using
+ * `std::hash` because feature hashes must be stable across processes and
+ * library versions: the weights were trained against these very indices.
+ */
+static uint64_t hash_feature(const char* s, size_t len) {
+  uint64_t h = 14695981039346656037ULL;
+  for (size_t i = 0; i < len; ++i) {
+    h ^= static_cast<uint8_t>(s[i]);
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+
+template <typename T>
+static void score_fixed(const Column* col, double w, double* out,
+                        int64_t row0, int64_t row1) {
+  auto d = static_cast<const T*>(col->data());
+  for (int64_t i = row0; i < row1; ++i) {
+    T x = d[i];
+    if (!ISNA<T>(x)) out[i] += w * static_cast<double>(x);
+  }
+}
+
+
+template <typename T>
+static void score_string(const StringColumn<T>* col, const double* w,
+                         size_t nw, double* out, int64_t row0, int64_t row1) {
+  const T* offs = col->offsets();
+  const char* strs = col->strdata();
+  for (int64_t i = row0; i < row1; ++i) {
+    T off = offs[i];
+    if (ISNA<T>(off)) continue;
+    T start = offs[i - 1] & ~GETNA<T>();
+    uint64_t h = hash_feature(strs + start, static_cast<size_t>(off - start));
+    out[i] += w[h % nw];
+  }
+}
+
+
+/**
+ * Evaluate `intercept + sum_j contribution(column_j)` for every row, over
+ * row chunks in parallel. Numeric column `j` contributes `weights[j] * x`;
+ * string columns hash each value into the weight vector and contribute the
+ * weight at the hashed index. NA values contribute nothing. If `sigmoid` is
+ * true, the result is passed through the logistic function.
+ */
+static DataTable* score_impl(DataTable* dt, const std::vector<double>& weights,
+                             double intercept, bool sigmoid) {
+  int64_t nrows = dt->nrows;
+  int64_t ncols = dt->ncols;
+
+  // Materialize views once up-front, so that the chunk workers can read the
+  // column buffers directly without going through a rowindex.
+  std::vector<Column*> cols;
+  cols.reserve(static_cast<size_t>(ncols));
+  for (int64_t i = 0; i < ncols; ++i) {
+    Column* c = dt->columns[i]->shallowcopy();
+    c->reify();
+    cols.push_back(c);
+  }
+
+  Column* ocol = Column::new_data_column(SType::FLOAT64, nrows);
+  auto out = static_cast<double*>(ocol->data_w());
+
+  config::thread_grant tgrant;
+  #pragma omp parallel num_threads(tgrant.nthreads())
+  {
+    int ith = omp_get_thread_num();
+    int nth = omp_get_num_threads();
+    int64_t chunk = (nrows + nth - 1) / nth;
+    int64_t row0 = ith * chunk;
+    int64_t row1 = std::min(row0 + chunk, nrows);
+
+    for (int64_t i = row0; i < row1; ++i) out[i] = intercept;
+
+    for (int64_t j = 0; j < ncols; ++j) {
+      const Column* c = cols[static_cast<size_t>(j)];
+      double w = weights[static_cast<size_t>(j)];
+      switch (c->stype()) {
+        case SType::BOOL:
+        case SType::INT8:    score_fixed<int8_t>(c, w, out, row0, row1); break;
+        case SType::INT16:   score_fixed<int16_t>(c, w, out, row0, row1); break;
+        case SType::INT32:   score_fixed<int32_t>(c, w, out, row0, row1); break;
+        case SType::INT64:   score_fixed<int64_t>(c, w, out, row0, row1); break;
+        case SType::FLOAT32: score_fixed<float>(c, w, out, row0, row1); break;
+        case SType::FLOAT64: score_fixed<double>(c, w, out, row0, row1); break;
+        case SType::STR32:
+          score_string(static_cast<const StringColumn<uint32_t>*>(c),
+                       weights.data(), weights.size(), out, row0, row1);
+          break;
+        case SType::STR64:
+          score_string(static_cast<const StringColumn<uint64_t>*>(c),
+                       weights.data(), weights.size(), out, row0, row1);
+          break;
+        default: break;  // checked before the parallel region
+      }
+    }
+
+    if (sigmoid) {
+      for (int64_t i = row0; i < row1; ++i) {
+        out[i] = 1.0 / (1.0 + std::exp(-out[i]));
+      }
+    }
+  }
+
+  for (Column* c : cols) delete c;
+
+  Column** outcols = dt::amalloc<Column*>(static_cast<int64_t>(2));
+  outcols[0] = ocol;
+  outcols[1] = nullptr;
+  return new DataTable(outcols, {"score"});
+}
+
+
+PyObject* score_linear(PyObject*, PyObject* args) {
+  PyObject* arg1;
+  PyObject* arg_weights;
+  double intercept = 0.0;
+  int sigmoid = 0;
+  if (!PyArg_ParseTuple(args, "OO|di:score_linear", &arg1, &arg_weights,
+                        &intercept, &sigmoid)) return nullptr;
+  DataTable* dt = py::obj(arg1).to_frame();
+
+  py::olist wlist = py::obj(arg_weights).to_pylist();
+  std::vector<double> weights;
+  weights.reserve(wlist.size());
+  for (size_t i = 0; i < wlist.size(); ++i) {
+    weights.push_back(wlist[i].to_double());
+  }
+  if (weights.size() < static_cast<size_t>(dt->ncols)) {
+    throw ValueError() << "Weights vector has " << weights.size()
+        << " entries, which is less than the number of columns in the frame ("
+        << dt->ncols << ")";
+  }
+  for (int64_t i = 0; i < dt->ncols; ++i) {
+    LType lt = info(dt->columns[i]->stype()).ltype();
+    if (lt != LType::BOOL && lt != LType::INT && lt != LType::REAL &&
+        lt != LType::STRING) {
+      throw TypeError() << "Column " << i << " of type `"
+          << info(dt->columns[i]->stype()).name() << "` cannot be scored";
+    }
+  }
+
+  DataTable* dt_scores = score_impl(dt, weights, intercept, sigmoid != 0);
+  return py::Frame::from_datatable(dt_scores);
+}
@@ -0,0 +1,15 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include "datatable.h"
+#include "types.h"
+#include "py_datatable.h"
+
+DECLARE_FUNCTION(
+  score_linear,
+  "score_linear(frame, weights, intercept=0.0, sigmoid=False)\n\n",
+  dt_EXTRAS_SCORE_cc)
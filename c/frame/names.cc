@@ -6,6 +6,7 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include "frame/py_frame.h"
+#include <atomic>
 #include <unordered_set>
 #include "python/dict.h"
 #include "python/int.h"
@@ -204,11 +205,18 @@ Error Frame::_name_not_found_error(const std::string& name) {
 // DataTable names API
 //------------------------------------------------------------------------------
 
+static std::atomic<uint64_t> names_version_counter;
+
+DataTable::NamesInfo::NamesInfo()
+  : py_inames(nullptr),
+    version(names_version_counter.fetch_add(1) + 1) {}
+
+
 /**
  * Return DataTable column names as a C++ vector of strings.
  */
 const std::vector<std::string>& DataTable::get_names() const {
-  return names;
+  return ninfo->names;
 }
 
 
@@ -216,30 +224,47 @@ const std::vector<std::string>& DataTable::get_names() const {
  * Return DataTable column names as a python tuple.
  */
 py::otuple DataTable::get_pynames() const {
-  if (!py_names) _init_pynames();
-  return py_names;
+  if (!ninfo->py_names) _init_pynames();
+  return ninfo->py_names;
+}
+
+
+/**
+ * Return the version tag of this Frame's names. The tag is shared by all
+ * shallow copies of the Frame, and changes whenever the names are replaced,
+ * so caches can detect renames without comparing the name lists.
+ */
+uint64_t DataTable::names_version() const {
+  return ninfo->version;
 }
 
 
 /**
  * Return the index of a column given its name; or -1 if such column does not
- * exist in the DataTable.
+ * exist in the DataTable. The lookup goes through the native `name_index`
+ * hash map, avoiding the Python dict machinery on every access.
  */
 int64_t DataTable::colindex(const py::_obj& pyname) const {
-  if (!py_inames) _init_pynames();
-  py::obj pyindex = py_inames.get(pyname);
-  return pyindex? pyindex.to_int64_strict() : -1;
+  CString cname = pyname.to_cstring();
+  return colindex(std::string(cname.ch, static_cast<size_t>(cname.size)));
+}
+
+
+int64_t DataTable::colindex(const std::string& name) const {
+  if (ninfo->name_index.size() != ninfo->names.size()) _init_name_index();
+  auto it = ninfo->name_index.find(name);
+  return it == ninfo->name_index.end()? -1
+            : static_cast<int64_t>(it->second);
 }
 
 
 /**
  * Copy names without checking for validity, since we know they were already
- * verified in DataTable `other`.
+ * verified in DataTable `other`. This is a pure pointer copy: both frames
+ * share a single `NamesInfo` instance until one of them renames its columns.
  */
 void DataTable::copy_names_from(const DataTable* other) {
-  names = other->names;
-  py_names = other->py_names;
-  py_inames = other->py_inames;
+  ninfo = other->ninfo;
 }
 
 
@@ -250,9 +275,10 @@ void DataTable::set_names_to_default() {
   auto index0 = static_cast<size_t>(config::frame_names_auto_index);
   auto prefix = config::frame_names_auto_prefix;
   auto zcols  = static_cast<size_t>(ncols);
-  py_names  = py::otuple();
-  py_inames = py::odict(nullptr);
-  names.clear();
+  // Install a fresh NamesInfo, detaching from any frames that share the
+  // current one (copy-on-write).
+  ninfo = std::make_shared<NamesInfo>();
+  std::vector<std::string>& names = ninfo->names;
   names.reserve(zcols);
   for (size_t i = 0; i < zcols; ++i) {
     names.push_back(prefix + std::to_string(i + index0));
@@ -276,13 +302,14 @@ void DataTable::set_names(const std::vector<std::string>& names_list) {
 void DataTable::replace_names(py::odict replacements) {
   py::olist newnames(ncols);
 
+  if (!ninfo->py_names) _init_pynames();
   for (int64_t i = 0; i < ncols; ++i) {
-    newnames.set(i, py_names[i]);
+    newnames.set(i, ninfo->py_names[i]);
   }
   for (auto kv : replacements) {
     py::obj key = kv.first;
     py::obj val = kv.second;
-    py::obj idx = py_inames.get(key);
+    py::obj idx = ninfo->py_inames.get(key);
     if (idx.is_undefined()) {
       throw ValueError() << "Cannot find column `" << key.str()
         << "` in the Frame";
@@ -304,16 +331,28 @@ void DataTable::replace_names(py::odict replacements) {
 //------------------------------------------------------------------------------
 
 void DataTable::_init_pynames() const {
-  if (py_names) return;
+  if (ninfo->py_names) return;
   size_t zcols = static_cast<size_t>(ncols);
+  const std::vector<std::string>& names = ninfo->names;
   xassert(names.size() == zcols);
 
-  py_names = py::otuple(zcols);
-  py_inames = py::odict();
+  ninfo->py_names = py::otuple(zcols);
+  ninfo->py_inames = py::odict();
   for (size_t i = 0; i < zcols; ++i) {
     py::ostring pyname(names[i]);
-    py_inames.set(pyname, py::oint(i));
-    py_names.set(i, std::move(pyname));
+    ninfo->py_inames.set(pyname, py::oint(i));
+    ninfo->py_names.set(i, std::move(pyname));
+  }
+}
+
+
+void DataTable::_init_name_index() const {
+  const std::vector<std::string>& names = ninfo->names;
+  auto& name_index = ninfo->name_index;
+  name_index.clear();
+  name_index.reserve(names.size());
+  for (size_t i = 0; i < names.size(); ++i) {
+    name_index.emplace(names[i], i);
   }
 }
 
@@ -332,11 +371,18 @@ void DataTable::_set_names_impl(NameProvider* nameslist) {
         << zcols << " column" << (zcols == 1? "" : "s");
   }
 
-  // Prepare the containers for placing the new column names there
+  // Prepare the containers for placing the new column names there. A fresh
+  // NamesInfo is installed, so that any frames sharing the current one are
+  // unaffected (copy-on-write).
+  ninfo = std::make_shared<NamesInfo>();
+  std::vector<std::string>& names = ninfo->names;
+  py::otuple& py_names  = ninfo->py_names;
+  py::odict&  py_inames = ninfo->py_inames;
+  auto& name_index = ninfo->name_index;
   py_names  = py::otuple(zcols);
   py_inames = py::odict();
-  names.clear();
   names.reserve(zcols);
+  name_index.reserve(zcols);
   std::vector<std::string> duplicates;
 
   // If any name is empty or None, it will be replaced with the default name
@@ -383,12 +429,14 @@ void DataTable::_set_names_impl(NameProvider* nameslist) {
     if (!name_mangled) {
       resname = std::string(strname, namelen);
     }
-    py::oobj newname = name_mangled? py::ostring(resname)
-                                   : nameslist->item_as_pyoobj(i);
     // Check for name duplicates. If the name was already seen before, we
     // replace it with a modified name (by incrementing the name's digital
-    // suffix if it has one, or otherwise by adding such a suffix).
-    if (py_inames.has(newname)) {
+    // suffix if it has one, or otherwise by adding such a suffix). The
+    // membership tests go through the native `name_index` map, so that
+    // deduplicating even a very wide frame requires no Python machinery.
+    bool name_deduped = false;
+    if (name_index.count(resname)) {
+      name_deduped = true;
       duplicates.push_back(resname);
       size_t j = namelen;
       for (; j > 0; --j) {
@@ -405,15 +453,18 @@ void DataTable::_set_names_impl(NameProvider* nameslist) {
       } else {
         basename += ".";
       }
-      while (py_inames.has(newname)) {
+      do {
         count++;
         resname = basename + std::to_string(count);
-        newname = py::ostring(resname);
-      }
+      } while (name_index.count(resname));
     }
+    py::oobj newname = (name_mangled || name_deduped)
+                          ? py::ostring(resname)
+                          : nameslist->item_as_pyoobj(i);
 
     // Store the name in all containers
-    names.push_back(resname);
+    name_index.emplace(resname, i);
+    names.push_back(std::move(resname));
     py_inames.set(newname, py::oint(i));
     py_names.set(i, std::move(newname));
   }
@@ -452,6 +503,7 @@ void DataTable::_set_names_impl(NameProvider* nameslist) {
       if (!names[i].empty()) continue;
       names[i] = prefix + std::to_string(index0);
       py::oobj newname = py::ostring(names[i]);
+      name_index.emplace(names[i], i);
       py_inames.set(newname, py::oint(i));
       py_names.set(i, std::move(newname));
       index0++;
@@ -480,12 +532,15 @@ void DataTable::_set_names_impl(NameProvider* nameslist) {
   xassert(zcols == names.size());
   xassert(zcols == py_names.size());
   xassert(zcols == py_inames.size());
+  xassert(zcols == name_index.size());
 }
 
 
 
 void DataTable::_integrity_check_names() const {
   size_t zcols = static_cast<size_t>(ncols);
+  const std::vector<std::string>& names = ninfo->names;
+  const auto& name_index = ninfo->name_index;
   if (names.size() != zcols) {
     throw AssertionError() << "DataTable.names has size " << names.size()
       << ", however there are " << zcols << " columns in the Frame";
@@ -506,10 +561,26 @@ void DataTable::_integrity_check_names() const {
       }
     }
   }
+  if (!name_index.empty()) {
+    if (name_index.size() != names.size()) {
+      throw AssertionError() << "DataTable.name_index has " << name_index.size()
+          << " entries, while there are " << names.size() << " column names";
+    }
+    for (size_t i = 0; i < names.size(); ++i) {
+      auto it = name_index.find(names[i]);
+      if (it == name_index.end() || it->second != i) {
+        throw AssertionError() << "Column " << i << " '" << names[i] << "' is "
+            "not mapped correctly in DataTable.name_index";
+      }
+    }
+  }
 }
 
 
 void DataTable::_integrity_check_pynames() const {
+  const std::vector<std::string>& names = ninfo->names;
+  const py::otuple& py_names  = ninfo->py_names;
+  const py::odict&  py_inames = ninfo->py_inames;
   if (!py_names && !py_inames) return;
   if (!py_names || !py_inames) {
     throw AssertionError() << "One of DataTable.py_names or DataTable.py_inames"
@@ -662,42 +733,42 @@ namespace dttest {
     auto check1 = [dt]() { dt->_integrity_check_names(); };
     test_assert(check1, "DataTable.names has size 0, however there are 2 "
                         "columns in the Frame");
-    dt->names = { "foo", "foo" };
+    dt->ninfo->names = { "foo", "foo" };
     test_assert(check1, "Duplicate name 'foo' for column 1");
-    dt->names = { "foo", "f\x0A\x0D" };
+    dt->ninfo->names = { "foo", "f\x0A\x0D" };
     test_assert(check1, "Invalid character '\\x0a' in column 1's name");
-    dt->names = { "one", "two" };
+    dt->ninfo->names = { "one", "two" };
 
     auto check2 = [dt]() { dt->_integrity_check_pynames(); };
     py::oobj q = py::None();
-    dt->py_names = *reinterpret_cast<const py::otuple*>(&q);
+    dt->ninfo->py_names = *reinterpret_cast<const py::otuple*>(&q);
     test_assert(check2, "One of DataTable.py_names or DataTable.py_inames"
                         " is not properly computed");
-    dt->py_inames = *reinterpret_cast<const py::odict*>(&q);
+    dt->ninfo->py_inames = *reinterpret_cast<const py::odict*>(&q);
     test_assert(check2, "DataTable.py_names is not a tuple");
-    dt->py_names = py::otuple(1);
+    dt->ninfo->py_names = py::otuple(1);
     test_assert(check2, "DataTable.py_inames is not a dict");
-    dt->py_inames = py::odict();
+    dt->ninfo->py_inames = py::odict();
     test_assert(check2, "len(.py_names) is 1, whereas .ncols = 2");
-    dt->py_names = py::otuple(2);
+    dt->ninfo->py_names = py::otuple(2);
     test_assert(check2, ".py_inames has 0 elements, while the Frame has "
                         "2 columns");
-    dt->py_inames.set(py::ostring("one"), py::oint(0));
-    dt->py_inames.set(py::ostring("TWO"), py::oint(2));
-    dt->py_names.set(0, py::oint(1));
-    dt->py_names.set(1, py::ostring("two"));
+    dt->ninfo->py_inames.set(py::ostring("one"), py::oint(0));
+    dt->ninfo->py_inames.set(py::ostring("TWO"), py::oint(2));
+    dt->ninfo->py_names.set(0, py::oint(1));
+    dt->ninfo->py_names.set(1, py::ostring("two"));
     test_assert(check2, "Element 0 of .py_names is a <class 'int'>");
-    dt->py_names.set(0, py::ostring("1"));
+    dt->ninfo->py_names.set(0, py::ostring("1"));
     test_assert(check2, "Element 0 of .py_names is '1', but the actual "
                         "column name is 'one'");
-    dt->py_names.set(0, py::ostring("one"));
+    dt->ninfo->py_names.set(0, py::ostring("one"));
     test_assert(check2, "Column 1 'two' is absent from the .py_inames "
                         "dictionary");
-    dt->py_inames.del(py::ostring("TWO"));
-    dt->py_inames.set(py::ostring("two"), py::oint(2));
+    dt->ninfo->py_inames.del(py::ostring("TWO"));
+    dt->ninfo->py_inames.set(py::ostring("two"), py::oint(2));
     test_assert(check2, "Column 1 'two' maps to 2 in the .py_inames "
                         "dictionary");
-    dt->py_inames.set(py::ostring("two"), py::oint(1));
+    dt->ninfo->py_inames.set(py::ostring("two"), py::oint(1));
     dt->verify_integrity();
   }
 
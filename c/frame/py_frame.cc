@@ -89,6 +89,14 @@ void Frame::Type::init_getsetters(GetSetters& gs)
     ">>> d0.names\n"
     "('C0', 'C1', 'C2')");
 
+  gs.add<&Frame::get_cow_counters>("cow_counters",
+    "Tuple (ncopies, nbytes) of copy-on-write statistics for this Frame:\n"
+    "how many times this Frame's data buffers were deep-copied by the\n"
+    "copy-on-write mechanism over their history, and how many bytes those\n"
+    "copies moved. Use together with core.cow_stats(), which breaks the\n"
+    "process-wide counters down by triggering operation, to locate\n"
+    "operations that copy data unexpectedly.\n");
+
   gs.add<&Frame::get_key>("key");
   gs.add<&Frame::get_internal>("internal", "[DEPRECATED]");
   gs.add<&Frame::get_internal>("_dt");
@@ -228,6 +236,19 @@ oobj Frame::get_ltypes() const {
 }
 
 
+oobj Frame::get_cow_counters() const {
+  size_t ncopies = 0;
+  size_t nbytes = 0;
+  for (int64_t i = 0; i < dt->ncols; ++i) {
+    dt->columns[i]->cow_counters(&ncopies, &nbytes);
+  }
+  py::otuple res(2);
+  res.set(0, py::oint(ncopies));
+  res.set(1, py::oint(nbytes));
+  return res;
+}
+
+
 oobj Frame::get_key() const {
   py::otuple key(dt->nkeys);
   // Fill in the keys...
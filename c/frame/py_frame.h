@@ -62,6 +62,7 @@ class Frame : public PyObject {
     oobj get_stypes() const;
     oobj get_ltypes() const;
     oobj get_names() const;
+    oobj get_cow_counters() const;
     oobj get_key() const;
     oobj get_internal() const;
     void set_nrows(obj);
@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #include "groupby.h"
 #include "utils/exceptions.h"
+#include "utils/omp.h"
 
 
 Groupby::Groupby() : n(0) {}
@@ -45,6 +46,48 @@ size_t Groupby::ngroups() const {
 }
 
 
+RowIndex Groupby::select_groupwise(
+  size_t k, bool from_last, const RowIndex& sortorder) const
+{
+  if (k == 0 || n == 0) {
+    return RowIndex::from_array32(arr32_t(0), /* sorted = */ true);
+  }
+  const int32_t* offs = offsets_r();
+  int32_t kk = static_cast<int32_t>(k);
+
+  // Prefix-scan the (clamped) group sizes to find where each group's rows
+  // land in the output.
+  arr32_t dests(n + 1);
+  int32_t* dest = dests.data();
+  dest[0] = 0;
+  for (size_t g = 0; g < n; ++g) {
+    int32_t size = offs[g + 1] - offs[g];
+    dest[g + 1] = dest[g] + (size < kk? size : kk);
+  }
+
+  int32_t total = dest[n];
+  arr32_t indices(static_cast<size_t>(total));
+  int32_t* data = indices.data();
+  bool absent = sortorder.isabsent();
+  #pragma omp parallel for schedule(static)
+  for (size_t g = 0; g < n; ++g) {
+    int32_t cnt = dest[g + 1] - dest[g];
+    int32_t pos0 = from_last? offs[g + 1] - cnt : offs[g];
+    int32_t* out = data + dest[g];
+    if (absent) {
+      for (int32_t i = 0; i < cnt; ++i) {
+        out[i] = pos0 + i;
+      }
+    } else {
+      for (int32_t i = 0; i < cnt; ++i) {
+        out[i] = static_cast<int32_t>(sortorder.nth(pos0 + i));
+      }
+    }
+  }
+  return RowIndex::from_array32(std::move(indices), /* sorted = */ absent);
+}
+
+
 const RowIndex& Groupby::ungroup_rowindex() {
   if (!ungroup_ri) compute_ungroup_rowindex();
   return ungroup_ri;
@@ -40,6 +40,17 @@ class Groupby {
     //
     const RowIndex& ungroup_rowindex();
 
+    // Return a RowIndex that selects at most `k` rows out of every group:
+    // the first `k` rows when `from_last` is false, or the last `k` rows
+    // otherwise. Groups smaller than `k` are included whole. If `sortorder`
+    // is non-empty, it must be the RowIndex produced by the sort that
+    // created this Groupby; the selected positions are then mapped through
+    // it, so that the result refers to rows of the original frame. The
+    // relative order of rows within each group is preserved.
+    //
+    RowIndex select_groupwise(size_t k, bool from_last,
+                              const RowIndex& sortorder) const;
+
   private:
     void compute_ungroup_rowindex();
 };
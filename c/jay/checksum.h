@@ -0,0 +1,54 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_JAY_CHECKSUM_h
+#define dt_JAY_CHECKSUM_h
+#include <cstdint>
+#include <cstring>
+
+namespace jay {
+
+
+/**
+ * 64-bit checksum of a memory region, used to detect truncated / corrupted
+ * data regions in Jay files (see `Column.data_hash` in jay.fbs).
+ *
+ * This is a simple multiply-xor hash processing 8 bytes per step, in the
+ * spirit of murmur's finalizer: not cryptographic, but any single flipped
+ * or zeroed byte changes the result with overwhelming probability, and it
+ * runs at memory speed. The length participates in the seed, so a region
+ * truncated to a prefix of zeros is also detected.
+ *
+ * The value 0 is reserved to mean "no checksum recorded", so a computed
+ * hash of 0 is mapped to 1.
+ */
+inline uint64_t checksum(const void* data, size_t size) {
+  constexpr uint64_t M = 0x9E3779B97F4A7C15ULL;  // 2^64 / golden ratio
+  const uint8_t* ptr = static_cast<const uint8_t*>(data);
+  uint64_t h = 0x8B72E0F355B1AA4DULL ^ (static_cast<uint64_t>(size) * M);
+  size_t nchunks = size / 8;
+  for (size_t i = 0; i < nchunks; ++i) {
+    uint64_t k;
+    std::memcpy(&k, ptr + i * 8, 8);
+    k *= M;
+    k ^= k >> 29;
+    h = (h ^ k) * M;
+  }
+  if (size & 7) {
+    uint64_t tail = 0;
+    std::memcpy(&tail, ptr + nchunks * 8, size & 7);
+    h = (h ^ (tail * M)) * M;
+  }
+  h ^= h >> 32;
+  h *= M;
+  h ^= h >> 29;
+  return h? h : 1;
+}
+
+
+}  // namespace jay
+#endif
@@ -22,12 +22,45 @@ struct StatsFloat32;
 
 struct StatsFloat64;
 
+struct StatsMoments;
+
+struct GroupStats;
+
 struct Frame;
 
 struct Column;
 
 struct Buffer;
 
+enum Codec {
+  Codec_None = 0,
+  Codec_Zlib = 1,
+  Codec_MIN = Codec_None,
+  Codec_MAX = Codec_Zlib
+};
+
+inline const Codec (&EnumValuesCodec())[2] {
+  static const Codec values[] = {
+    Codec_None,
+    Codec_Zlib
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesCodec() {
+  static const char * const names[] = {
+    "None",
+    "Zlib",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameCodec(Codec e) {
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesCodec()[index];
+}
+
 enum Type {
   Type_Bool8 = 0,
   Type_Int8 = 1,
@@ -282,6 +315,81 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(8) StatsFloat64 FLATBUFFERS_FINAL_CLASS {
 };
 FLATBUFFERS_STRUCT_END(StatsFloat64, 16);
 
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(8) GroupStats FLATBUFFERS_FINAL_CLASS {
+ private:
+  int64_t min_i_;
+  int64_t max_i_;
+  double min_f_;
+  double max_f_;
+
+ public:
+  GroupStats() {
+    memset(this, 0, sizeof(GroupStats));
+  }
+  GroupStats(int64_t _min_i, int64_t _max_i, double _min_f, double _max_f)
+      : min_i_(flatbuffers::EndianScalar(_min_i)),
+        max_i_(flatbuffers::EndianScalar(_max_i)),
+        min_f_(flatbuffers::EndianScalar(_min_f)),
+        max_f_(flatbuffers::EndianScalar(_max_f)) {
+  }
+  int64_t min_i() const {
+    return flatbuffers::EndianScalar(min_i_);
+  }
+  int64_t max_i() const {
+    return flatbuffers::EndianScalar(max_i_);
+  }
+  double min_f() const {
+    return flatbuffers::EndianScalar(min_f_);
+  }
+  double max_f() const {
+    return flatbuffers::EndianScalar(max_f_);
+  }
+};
+FLATBUFFERS_STRUCT_END(GroupStats, 32);
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(8) StatsMoments FLATBUFFERS_FINAL_CLASS {
+ private:
+  int64_t sum_i_;
+  double sum_f_;
+  double mean_;
+  double sd_;
+  double skew_;
+  double kurt_;
+
+ public:
+  StatsMoments() {
+    memset(this, 0, sizeof(StatsMoments));
+  }
+  StatsMoments(int64_t _sum_i, double _sum_f, double _mean, double _sd,
+               double _skew, double _kurt)
+      : sum_i_(flatbuffers::EndianScalar(_sum_i)),
+        sum_f_(flatbuffers::EndianScalar(_sum_f)),
+        mean_(flatbuffers::EndianScalar(_mean)),
+        sd_(flatbuffers::EndianScalar(_sd)),
+        skew_(flatbuffers::EndianScalar(_skew)),
+        kurt_(flatbuffers::EndianScalar(_kurt)) {
+  }
+  int64_t sum_i() const {
+    return flatbuffers::EndianScalar(sum_i_);
+  }
+  double sum_f() const {
+    return flatbuffers::EndianScalar(sum_f_);
+  }
+  double mean() const {
+    return flatbuffers::EndianScalar(mean_);
+  }
+  double sd() const {
+    return flatbuffers::EndianScalar(sd_);
+  }
+  double skew() const {
+    return flatbuffers::EndianScalar(skew_);
+  }
+  double kurt() const {
+    return flatbuffers::EndianScalar(kurt_);
+  }
+};
+FLATBUFFERS_STRUCT_END(StatsMoments, 48);
+
 FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(8) Buffer FLATBUFFERS_FINAL_CLASS {
  private:
   uint64_t offset_;
@@ -309,7 +417,8 @@ struct Frame FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_NROWS = 4,
     VT_NCOLS = 6,
     VT_NKEYS = 8,
-    VT_COLUMNS = 10
+    VT_COLUMNS = 10,
+    VT_ROWGROUP_SIZE = 12
   };
   uint64_t nrows() const {
     return GetField<uint64_t>(VT_NROWS, 0);
@@ -323,6 +432,9 @@ struct Frame FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<Column>> *columns() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Column>> *>(VT_COLUMNS);
   }
+  uint64_t rowgroup_size() const {
+    return GetField<uint64_t>(VT_ROWGROUP_SIZE, 0);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<uint64_t>(verifier, VT_NROWS) &&
@@ -331,6 +443,7 @@ struct Frame FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_COLUMNS) &&
            verifier.Verify(columns()) &&
            verifier.VerifyVectorOfTables(columns()) &&
+           VerifyField<uint64_t>(verifier, VT_ROWGROUP_SIZE) &&
            verifier.EndTable();
   }
 };
@@ -351,6 +464,9 @@ struct FrameBuilder {
   void add_columns(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Column>>> columns) {
     fbb_.AddOffset(Frame::VT_COLUMNS, columns);
   }
+  void add_rowgroup_size(uint64_t rowgroup_size) {
+    fbb_.AddElement<uint64_t>(Frame::VT_ROWGROUP_SIZE, rowgroup_size, 0);
+  }
   explicit FrameBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -368,8 +484,10 @@ inline flatbuffers::Offset<Frame> CreateFrame(
     uint64_t nrows = 0,
     uint64_t ncols = 0,
     int32_t nkeys = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Column>>> columns = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Column>>> columns = 0,
+    uint64_t rowgroup_size = 0) {
   FrameBuilder builder_(_fbb);
+  builder_.add_rowgroup_size(rowgroup_size);
   builder_.add_ncols(ncols);
   builder_.add_nrows(nrows);
   builder_.add_columns(columns);
@@ -382,13 +500,15 @@ inline flatbuffers::Offset<Frame> CreateFrameDirect(
     uint64_t nrows = 0,
     uint64_t ncols = 0,
     int32_t nkeys = 0,
-    const std::vector<flatbuffers::Offset<Column>> *columns = nullptr) {
+    const std::vector<flatbuffers::Offset<Column>> *columns = nullptr,
+    uint64_t rowgroup_size = 0) {
   return jay::CreateFrame(
       _fbb,
       nrows,
       ncols,
       nkeys,
-      columns ? _fbb.CreateVector<flatbuffers::Offset<Column>>(*columns) : 0);
+      columns ? _fbb.CreateVector<flatbuffers::Offset<Column>>(*columns) : 0,
+      rowgroup_size);
 }
 
 struct Column FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -399,7 +519,16 @@ struct Column FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_NAME = 10,
     VT_NULLCOUNT = 12,
     VT_STATS_TYPE = 14,
-    VT_STATS = 16
+    VT_STATS = 16,
+    VT_TAILS = 18,
+    VT_STRTAILS = 20,
+    VT_CODEC = 22,
+    VT_DATA_ORIG = 24,
+    VT_STRDATA_ORIG = 26,
+    VT_MOMENTS = 28,
+    VT_GROUPS = 30,
+    VT_DATA_HASH = 32,
+    VT_STRDATA_HASH = 34
   };
   Type type() const {
     return static_cast<Type>(GetField<uint8_t>(VT_TYPE, 0));
@@ -422,6 +551,33 @@ struct Column FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const void *stats() const {
     return GetPointer<const void *>(VT_STATS);
   }
+  const flatbuffers::Vector<const Buffer *> *tails() const {
+    return GetPointer<const flatbuffers::Vector<const Buffer *> *>(VT_TAILS);
+  }
+  const flatbuffers::Vector<const Buffer *> *strtails() const {
+    return GetPointer<const flatbuffers::Vector<const Buffer *> *>(VT_STRTAILS);
+  }
+  Codec codec() const {
+    return static_cast<Codec>(GetField<uint8_t>(VT_CODEC, 0));
+  }
+  uint64_t data_orig() const {
+    return GetField<uint64_t>(VT_DATA_ORIG, 0);
+  }
+  uint64_t strdata_orig() const {
+    return GetField<uint64_t>(VT_STRDATA_ORIG, 0);
+  }
+  const StatsMoments *moments() const {
+    return GetStruct<const StatsMoments *>(VT_MOMENTS);
+  }
+  const flatbuffers::Vector<const GroupStats *> *groups() const {
+    return GetPointer<const flatbuffers::Vector<const GroupStats *> *>(VT_GROUPS);
+  }
+  uint64_t data_hash() const {
+    return GetField<uint64_t>(VT_DATA_HASH, 0);
+  }
+  uint64_t strdata_hash() const {
+    return GetField<uint64_t>(VT_STRDATA_HASH, 0);
+  }
   template<typename T> const T *stats_as() const;
   const StatsBool *stats_as_Bool() const {
     return stats_type() == Stats_Bool ? static_cast<const StatsBool *>(stats()) : nullptr;
@@ -455,6 +611,18 @@ struct Column FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<uint8_t>(verifier, VT_STATS_TYPE) &&
            VerifyOffset(verifier, VT_STATS) &&
            VerifyStats(verifier, stats(), stats_type()) &&
+           VerifyOffset(verifier, VT_TAILS) &&
+           verifier.Verify(tails()) &&
+           VerifyOffset(verifier, VT_STRTAILS) &&
+           verifier.Verify(strtails()) &&
+           VerifyField<uint8_t>(verifier, VT_CODEC) &&
+           VerifyField<uint64_t>(verifier, VT_DATA_ORIG) &&
+           VerifyField<uint64_t>(verifier, VT_STRDATA_ORIG) &&
+           VerifyField<StatsMoments>(verifier, VT_MOMENTS) &&
+           VerifyOffset(verifier, VT_GROUPS) &&
+           verifier.Verify(groups()) &&
+           VerifyField<uint64_t>(verifier, VT_DATA_HASH) &&
+           VerifyField<uint64_t>(verifier, VT_STRDATA_HASH) &&
            verifier.EndTable();
   }
 };
@@ -484,6 +652,33 @@ struct ColumnBuilder {
   void add_stats(flatbuffers::Offset<void> stats) {
     fbb_.AddOffset(Column::VT_STATS, stats);
   }
+  void add_tails(flatbuffers::Offset<flatbuffers::Vector<const Buffer *>> tails) {
+    fbb_.AddOffset(Column::VT_TAILS, tails);
+  }
+  void add_strtails(flatbuffers::Offset<flatbuffers::Vector<const Buffer *>> strtails) {
+    fbb_.AddOffset(Column::VT_STRTAILS, strtails);
+  }
+  void add_codec(Codec codec) {
+    fbb_.AddElement<uint8_t>(Column::VT_CODEC, static_cast<uint8_t>(codec), 0);
+  }
+  void add_data_orig(uint64_t data_orig) {
+    fbb_.AddElement<uint64_t>(Column::VT_DATA_ORIG, data_orig, 0);
+  }
+  void add_strdata_orig(uint64_t strdata_orig) {
+    fbb_.AddElement<uint64_t>(Column::VT_STRDATA_ORIG, strdata_orig, 0);
+  }
+  void add_moments(const StatsMoments *moments) {
+    fbb_.AddStruct(Column::VT_MOMENTS, moments);
+  }
+  void add_groups(flatbuffers::Offset<flatbuffers::Vector<const GroupStats *>> groups) {
+    fbb_.AddOffset(Column::VT_GROUPS, groups);
+  }
+  void add_data_hash(uint64_t data_hash) {
+    fbb_.AddElement<uint64_t>(Column::VT_DATA_HASH, data_hash, 0);
+  }
+  void add_strdata_hash(uint64_t strdata_hash) {
+    fbb_.AddElement<uint64_t>(Column::VT_STRDATA_HASH, strdata_hash, 0);
+  }
   explicit ColumnBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
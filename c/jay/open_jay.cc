@@ -5,10 +5,15 @@
 //
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
+#include <algorithm>            // std::min
 #include <string>
 #include <cstring>              // std::memcmp
+#include <zlib.h>               // uncompress
 #include "jay/jay_generated.h"
+#include "jay/checksum.h"
 #include "datatable.h"
+#include "options.h"
+#include "rowindex.h"
 
 
 // Helper functions
@@ -21,9 +26,60 @@ static Column* column_from_jay(const jay::Column* jaycol, MemoryRange& jaybuf);
 //------------------------------------------------------------------------------
 
 DataTable* DataTable::open_jay(const std::string& path)
+{
+  return open_jay(path, std::string(), 0.0, 0.0);
+}
+
+
+/**
+ * Open a Jay file, skipping row groups whose [min, max] range (recorded in
+ * the footer when the file was saved, see `Frame.rowgroup_size`) does not
+ * intersect [filter_min, filter_max] on the column `filter_column`. The
+ * result is a view frame containing all rows of the qualifying groups --
+ * i.e. a superset of the rows actually matching the predicate -- and the
+ * data pages of the skipped groups are never read. When the file has no
+ * row-group statistics, the full frame is returned.
+ */
+DataTable* DataTable::open_jay(
+    const std::string& path, const std::string& filter_column,
+    double filter_min, double filter_max)
+{
+  return open_jay_impl(MemoryRange::mmap(path), path,
+                       filter_column, filter_min, filter_max);
+}
+
+
+/**
+ * Open a frame from an in-memory buffer containing Jay-format data, such
+ * as the one produced by `DataTable::save_jay_memory`. The columns become
+ * views into the buffer, so no data is copied; the buffer (and whatever
+ * Python object may back it) is kept alive by the columns' refcounts.
+ */
+DataTable* DataTable::open_jay_buffer(MemoryRange&& mbuf)
+{
+  return open_jay_impl(std::move(mbuf), "<memory buffer>",
+                       std::string(), 0.0, 0.0);
+}
+
+
+/**
+ * Attach to a frame previously placed in named shared memory with
+ * `DataTable::save_jay_shmem`. The columns become read-only views into
+ * the shared mapping: no data is copied, and all attached processes share
+ * one physical copy.
+ */
+DataTable* DataTable::open_jay_shmem(const std::string& name)
+{
+  return open_jay_impl(MemoryRange::shmem(name), name,
+                       std::string(), 0.0, 0.0);
+}
+
+
+DataTable* DataTable::open_jay_impl(
+    MemoryRange&& mbuf, const std::string& source,
+    const std::string& filter_column, double filter_min, double filter_max)
 {
   std::vector<std::string> colnames;
-  MemoryRange mbuf = MemoryRange::mmap(path);
 
   const uint8_t* ptr = static_cast<const uint8_t*>(mbuf.rptr());
   const size_t len = mbuf.size();
@@ -70,6 +126,67 @@ DataTable* DataTable::open_jay(const std::string& path)
   auto dt = new DataTable(columns);
   dt->nkeys = frame->nkeys();
   dt->set_names(colnames);
+
+  if (!filter_column.empty()) {
+    size_t grpsize = static_cast<size_t>(frame->rowgroup_size());
+    const jay::Column* fcol = nullptr;
+    for (size_t j = 0; j < ncols; ++j) {
+      if (colnames[j] == filter_column) {
+        fcol = msg_columns->Get(static_cast<flatbuffers::uoffset_t>(j));
+        break;
+      }
+    }
+    if (!fcol) {
+      throw ValueError() << "Column `" << filter_column << "` does not exist "
+          "in the file " << source;
+    }
+    if (fcol->type() > jay::Type_Float64) {
+      throw ValueError() << "Column `" << filter_column << "` is not numeric "
+          "and cannot be used for row-group filtering";
+    }
+    auto jgroups = fcol->groups();
+    if (grpsize && jgroups && jgroups->size() > 0) {
+      bool integer = (fcol->type() <= jay::Type_Int64);
+      std::vector<int64_t> starts, counts;
+      bool all_qualify = true;
+      for (flatbuffers::uoffset_t g = 0; g < jgroups->size(); ++g) {
+        const jay::GroupStats* gs = jgroups->Get(g);
+        bool ok;
+        if (integer) {
+          ok = gs->min_i() <= gs->max_i() &&
+               static_cast<double>(gs->min_i()) <= filter_max &&
+               static_cast<double>(gs->max_i()) >= filter_min;
+        } else {
+          ok = gs->min_f() <= gs->max_f() &&
+               gs->min_f() <= filter_max &&
+               gs->max_f() >= filter_min;
+        }
+        if (!ok) {
+          all_qualify = false;
+          continue;
+        }
+        int64_t row0 = static_cast<int64_t>(g * grpsize);
+        int64_t len  = std::min(static_cast<int64_t>(grpsize),
+                                static_cast<int64_t>(nrows) - row0);
+        if (!starts.empty() && starts.back() + counts.back() == row0) {
+          counts.back() += len;  // merge with the previous adjacent group
+        } else {
+          starts.push_back(row0);
+          counts.push_back(len);
+        }
+      }
+      if (!all_qualify) {
+        size_t n = starts.size();
+        arr64_t astarts(n), acounts(n), asteps(n);
+        for (size_t k = 0; k < n; ++k) {
+          astarts[k] = starts[k];
+          acounts[k] = counts[k];
+          asteps[k] = 1;
+        }
+        dt->replace_rowindex(RowIndex::from_slices(astarts, acounts, asteps));
+      }
+    }
+  }
   return dt;
 }
 
@@ -86,15 +203,123 @@ static MemoryRange extract_buffer(MemoryRange& src, const jay::Buffer* jbuf) {
 }
 
 
+/**
+ * Throw on a checksum mismatch of a column's stored data region. A mismatch
+ * almost always means the file was truncated or had pages zeroed / flipped
+ * after it was written; reading the region as-is would silently produce
+ * garbage values (typically NAs or zeros).
+ */
+static void verify_checksum(const void* data, size_t size, uint64_t expected) {
+  if (jay::checksum(data, size) == expected) return;
+  throw IOError() << "Checksum mismatch in a data region of a Jay file: "
+      "the file appears to be truncated or corrupted";
+}
+
+
+/**
+ * Assemble a column's buffer from its main region and any "tail" regions
+ * created by appending to the file (see DataTable::save_jay_append). When
+ * there are no tails, this returns a view into the file, same as
+ * `extract_buffer`; otherwise a "computed" memory range is returned which
+ * stitches the pieces into a contiguous buffer on first access. In either
+ * case no data is read at open time.
+ *
+ * `hash`, when nonzero, is the checksum of the main region recorded at save
+ * time. For a column with tails it is verified inside the stitching pass,
+ * at the cost of one extra read of bytes already being copied. A tailless
+ * column is normally a zero-copy view into the file, with no first-access
+ * hook to verify from; when `jay.verify_checksums` is enabled such columns
+ * are instead copied out on first access, verifying as they go.
+ */
+static MemoryRange assemble_buffer(
+    MemoryRange& src, const jay::Buffer* jbuf,
+    const flatbuffers::Vector<const jay::Buffer*>* tails,
+    uint64_t hash)
+{
+  if (!tails || tails->size() == 0) {
+    MemoryRange buf = extract_buffer(src, jbuf);
+    if (hash && config::jay_verify_checksums) {
+      size_t len = buf.size();
+      return MemoryRange::computed(len,
+        [buf, len, hash](void* out) {
+          verify_checksum(buf.rptr(), len, hash);
+          std::memcpy(out, buf.rptr(), len);
+        });
+    }
+    return buf;
+  }
+  std::vector<std::pair<size_t, size_t>> regions;  // (offset, length) pairs
+  regions.emplace_back(jbuf->offset() + 8, jbuf->length());
+  size_t total = jbuf->length();
+  for (const jay::Buffer* t : *tails) {
+    if (t->offset() + 8 + t->length() > src.size()) {
+      throw IOError() << "Invalid tail region in a Jay file";
+    }
+    regions.emplace_back(t->offset() + 8, t->length());
+    total += t->length();
+  }
+  return MemoryRange::computed(total,
+    [src, regions, hash](void* out) {
+      const char* srcptr = static_cast<const char*>(src.rptr());
+      if (hash) {
+        // Only the main region carries a checksum: the tails were written
+        // by append operations, which do not checksum (see jay.fbs).
+        verify_checksum(srcptr + regions[0].first, regions[0].second, hash);
+      }
+      char* outptr = static_cast<char*>(out);
+      for (const auto& r : regions) {
+        std::memcpy(outptr, srcptr + r.first, r.second);
+        outptr += r.second;
+      }
+    });
+}
+
+
+/**
+ * Return a "computed" memory range of `origlen` bytes which decompresses a
+ * column's data region (stored with codec Zlib) on first access. Until then
+ * no pages of the file are touched. When `hash` is nonzero, the compressed
+ * bytes are verified against it right before decompressing.
+ */
+static MemoryRange decompress_buffer(
+    MemoryRange& src, const jay::Buffer* jbuf, size_t origlen, uint64_t hash)
+{
+  MemoryRange zbuf = extract_buffer(src, jbuf);
+  return MemoryRange::computed(origlen,
+    [zbuf, origlen, hash](void* out) {
+      if (hash) {
+        verify_checksum(zbuf.rptr(), zbuf.size(), hash);
+      }
+      uLongf outlen = static_cast<uLongf>(origlen);
+      int ret = uncompress(static_cast<Bytef*>(out), &outlen,
+                           static_cast<const Bytef*>(zbuf.rptr()),
+                           static_cast<uLong>(zbuf.size()));
+      if (ret != Z_OK || outlen != origlen) {
+        throw IOError() << "Unable to decompress a data region in a Jay "
+                           "file (zlib error " << ret << ")";
+      }
+    });
+}
+
+
 template <typename T, typename A, typename JStats>
 static void initStats(Stats* stats, const jay::Column* jcol) {
   auto tstats = static_cast<NumericalStats<T, A>*>(stats);
   auto jstats = static_cast<const JStats*>(jcol->stats());
   if (jstats) {
-    tstats->set_countna(static_cast<int64_t>(jcol->nullcount()));
     tstats->set_min(jstats->min());
     tstats->set_max(jstats->max());
   }
+  auto jmoments = jcol->moments();
+  if (jmoments) {
+    tstats->set_sum(std::is_integral<A>::value
+                    ? static_cast<A>(jmoments->sum_i())
+                    : static_cast<A>(jmoments->sum_f()));
+    tstats->set_mean(jmoments->mean());
+    tstats->set_sd(jmoments->sd());
+    tstats->set_skew(jmoments->skew());
+    tstats->set_kurt(jmoments->kurt());
+  }
 }
 
 
@@ -114,15 +339,29 @@ static Column* column_from_jay(const jay::Column* jcol, MemoryRange& jaybuf) {
     case jay::Type_Str64:   col = new StringColumn<uint64_t>(0); break;
   }
 
-  MemoryRange databuf = extract_buffer(jaybuf, jcol->data());
+  jay::Codec codec = jcol->codec();
+  if (codec != jay::Codec_None && codec != jay::Codec_Zlib) {
+    throw IOError() << "Unknown codec " << codec << " in a Jay file";
+  }
+  MemoryRange databuf = (codec == jay::Codec_Zlib)
+      ? decompress_buffer(jaybuf, jcol->data(), jcol->data_orig(),
+                          jcol->data_hash())
+      : assemble_buffer(jaybuf, jcol->data(), jcol->tails(),
+                        jcol->data_hash());
   if (jtype == jay::Type_Str32 || jtype == jay::Type_Str64) {
-    MemoryRange strbuf = extract_buffer(jaybuf, jcol->strdata());
+    MemoryRange strbuf = (codec == jay::Codec_Zlib)
+        ? decompress_buffer(jaybuf, jcol->strdata(), jcol->strdata_orig(),
+                            jcol->strdata_hash())
+        : assemble_buffer(jaybuf, jcol->strdata(), jcol->strtails(),
+                          jcol->strdata_hash());
     col->replace_buffer(std::move(databuf), std::move(strbuf));
   } else {
     col->replace_buffer(std::move(databuf));
   }
 
   Stats* stats = col->get_stats();
+  // The NA count is always recorded in the file, for all column types.
+  stats->set_countna(static_cast<int64_t>(jcol->nullcount()));
   switch (jtype) {
     case jay::Type_Bool8:   initStats<int8_t,  int64_t, jay::StatsBool>(stats, jcol); break;
     case jay::Type_Int8:    initStats<int8_t,  int64_t, jay::StatsInt8>(stats, jcol); break;
@@ -5,7 +5,11 @@
 //
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
+#include <algorithm>   // std::min
+#include <cstring>     // std::memcmp
+#include <zlib.h>      // compress2, compressBound
 #include "jay/jay_generated.h"
+#include "jay/checksum.h"
 #include "datatable.h"
 #include "utils/assert.h"
 #include "writebuf.h"
@@ -13,14 +17,79 @@
 void init_jay();  // called once from datatablemodule.c
 
 using WritableBufferPtr = std::unique_ptr<WritableBuffer>;
+
+// Default number of rows in a row group. Row-group min/max statistics are
+// recorded for numeric columns whenever the frame has more than one group,
+// enabling `open_jay` to skip groups that fail a range predicate.
+static constexpr size_t JAY_ROWGROUP_SIZE = 1 << 24;
+
 static jay::Type stype_to_jaytype[DT_STYPES_COUNT];
+
+/**
+ * A column's payload prepared for writing: shallow copies of the data
+ * buffers, the compressed form (when compression succeeded), per-row-group
+ * statistics, and -- once the file layout is known -- the descriptors of
+ * the regions where the payload lands. Preparing is pure CPU work and is
+ * safe to run for many columns concurrently; only the final metadata
+ * record (which involves the FlatBufferBuilder) must be built serially.
+ */
+struct PreparedColumn {
+  MemoryRange mbuf;
+  MemoryRange sbuf;
+  std::vector<char> zdata;
+  std::vector<char> zstr;
+  std::vector<jay::GroupStats> groups;
+  jay::Buffer saved_mbuf;
+  jay::Buffer saved_strbuf;
+  uint64_t data_hash = 0;
+  uint64_t strdata_hash = 0;
+  jay::Codec codec = jay::Codec_None;
+  bool is_string = false;
+  int64_t : 48;
+
+  const void* data_ptr() const {
+    return codec == jay::Codec_None? mbuf.rptr() : zdata.data();
+  }
+  size_t data_size() const {
+    return codec == jay::Codec_None? mbuf.size() : zdata.size();
+  }
+  const void* str_ptr() const {
+    return codec == jay::Codec_None? sbuf.rptr() : zstr.data();
+  }
+  size_t str_size() const {
+    return codec == jay::Codec_None? sbuf.size() : zstr.size();
+  }
+};
+
+static void prepare_column(Column* col, bool compress, size_t grpsize,
+                           PreparedColumn& pc);
+static flatbuffers::Offset<jay::Column> column_meta_to_jay(
+    Column* col, const std::string& name, flatbuffers::FlatBufferBuilder& fbb,
+    const PreparedColumn& pc);
 static flatbuffers::Offset<jay::Column> column_to_jay(
     Column* col, const std::string& name, flatbuffers::FlatBufferBuilder& fbb,
+    WritableBufferPtr& wb, bool compress, size_t grpsize);
+template <typename T>
+static void computeGroupStats(const T* data, size_t nrows, size_t grpsize,
+                              std::vector<jay::GroupStats>& out);
+static bool compress_buffer(const void* data, size_t len,
+                            std::vector<char>& out);
+static flatbuffers::Offset<jay::Column> column_append_to_jay(
+    Column* col, const jay::Column* jcol, const std::string& name,
+    uint64_t strbase, flatbuffers::FlatBufferBuilder& fbb,
     WritableBufferPtr& wb);
-static jay::Buffer saveMemoryRange(const MemoryRange*, WritableBufferPtr&);
+static void write_jay_footer(flatbuffers::FlatBufferBuilder& fbb,
+                             WritableBufferPtr& wb);
+static jay::Buffer saveRawBuffer(const void* data, size_t len,
+                                 WritableBufferPtr& wb);
+template <typename T>
+static jay::Buffer saveRebasedOffsets(Column* col, uint64_t strbase,
+                                      WritableBufferPtr& wb);
 template <typename T, typename A, typename StatBuilder>
 static flatbuffers::Offset<void> saveStats(
     Stats* stats, flatbuffers::FlatBufferBuilder& fbb);
+template <typename T, typename A>
+static bool saveMoments(Stats* stats, jay::StatsMoments* out);
 
 
 //------------------------------------------------------------------------------
@@ -29,26 +98,150 @@ static flatbuffers::Offset<void> saveStats(
 
 void DataTable::save_jay(const std::string& path,
                          const std::vector<std::string>& colnames,
-                         WritableBuffer::Strategy wstrategy)
+                         WritableBuffer::Strategy wstrategy,
+                         bool compress, size_t rowgroup_size)
 {
   // Cannot store a view frame, so materialize first.
   reify();
 
+  size_t grpsize = rowgroup_size? rowgroup_size : JAY_ROWGROUP_SIZE;
+  if (static_cast<size_t>(nrows) <= grpsize) grpsize = 0;
+
   size_t sizehint = (wstrategy == WritableBuffer::Strategy::Auto)
                     ? memory_footprint() : 0;
   auto wb = WritableBuffer::create_target(path, sizehint, wstrategy);
+  save_jay_impl(wb, colnames, compress, grpsize);
+}
+
+
+/**
+ * Serialize the frame in Jay format into an in-memory buffer, and return
+ * that buffer. Used for pickling: the result can be reopened with
+ * `DataTable::open_jay_buffer` without copying the data out. Row-group
+ * statistics and compression are not used here -- the buffer is meant to
+ * be consumed immediately, typically by another process on the same
+ * machine.
+ */
+MemoryRange DataTable::save_jay_memory(
+    const std::vector<std::string>& colnames)
+{
+  reify();
+  auto wb = WritableBufferPtr(new MemoryWritableBuffer(memory_footprint()));
+  save_jay_impl(wb, colnames, /* compress= */ false, /* rowgroup_size= */ 0);
+  auto mwb = static_cast<MemoryWritableBuffer*>(wb.get());
+  return mwb->get_mbuf();
+}
+
+
+/**
+ * Serialize the frame in Jay format into a named POSIX shared memory
+ * object. Other processes can then attach to the frame with
+ * `DataTable::open_jay_shmem`, all of them mapping the single physical
+ * copy of the data. The shared object persists until removed with
+ * `shm_unlink`; creation fails if the name is already in use.
+ */
+void DataTable::save_jay_shmem(const std::string& name,
+                               const std::vector<std::string>& colnames)
+{
+  reify();
+  auto wb = WritableBufferPtr(
+      new ShmemWritableBuffer(name, memory_footprint()));
+  save_jay_impl(wb, colnames, /* compress= */ false, /* rowgroup_size= */ 0);
+}
+
+
+void DataTable::save_jay_impl(WritableBufferPtr& wb,
+                              const std::vector<std::string>& colnames,
+                              bool compress, size_t grpsize)
+{
   wb->write(8, "JAY1\0\0\0\0");
 
   flatbuffers::FlatBufferBuilder fbb(1024);
 
   std::vector<flatbuffers::Offset<jay::Column>> msg_columns;
-  for (size_t i = 0; i < static_cast<size_t>(ncols); ++i) {
-    Column* col = columns[i];
-    if (col->stype() == SType::OBJ) {
-      Warning() << "Column '" << colnames[i] << "' of type obj64 was not saved";
-    } else {
-      auto saved_col = column_to_jay(col, colnames[i], fbb, wb);
-      msg_columns.push_back(saved_col);
+  auto twb = dynamic_cast<ThreadsafeWritableBuffer*>(wb.get());
+  if (twb && ncols > 1) {
+    // The target supports concurrent positional writes: prepare all column
+    // payloads in parallel (compression, row-group statistics), lay out the
+    // file in one pass once every payload's size is known, then copy the
+    // regions into place concurrently. Only the flatbuffer metadata is
+    // built serially at the end.
+    std::vector<Column*> save_cols;
+    std::vector<std::string> save_names;
+    for (size_t i = 0; i < static_cast<size_t>(ncols); ++i) {
+      Column* col = columns[i];
+      if (col->stype() == SType::OBJ) {
+        Warning() << "Column '" << colnames[i] << "' of type obj64 was not "
+                     "saved";
+      } else {
+        save_cols.push_back(col);
+        save_names.push_back(colnames[i]);
+        msg_columns.push_back(0);  // filled in below, in order
+      }
+    }
+    size_t nsave = save_cols.size();
+    std::vector<PreparedColumn> prepared(nsave);
+
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t j = 0; j < static_cast<int64_t>(nsave); ++j) {
+      size_t zj = static_cast<size_t>(j);
+      prepare_column(save_cols[zj], compress, grpsize, prepared[zj]);
+    }
+
+    // Compute the layout: regions are assigned in column order, each padded
+    // to an 8-byte boundary, matching what sequential writing would produce.
+    size_t pos = wb->size();
+    for (size_t j = 0; j < nsave; ++j) {
+      PreparedColumn& pc = prepared[j];
+      size_t dlen = pc.data_size();
+      pc.saved_mbuf = jay::Buffer(pos - 8, dlen);
+      pos += (dlen + 7) & ~size_t(7);
+      if (pc.is_string) {
+        size_t slen = pc.str_size();
+        pc.saved_strbuf = jay::Buffer(pos - 8, slen);
+        pos += (slen + 7) & ~size_t(7);
+      }
+    }
+    wb->prep_write(pos - wb->size(), nullptr);
+
+    // One writing task per region; the trailing padding is written
+    // explicitly, since a freshly grown buffer is not guaranteed zeroed.
+    constexpr uint64_t zero = 0;
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t j = 0; j < static_cast<int64_t>(nsave); ++j) {
+      const PreparedColumn& pc = prepared[static_cast<size_t>(j)];
+      size_t dlen = pc.data_size();
+      wb->write_at(pc.saved_mbuf.offset() + 8, dlen, pc.data_ptr());
+      if (dlen & 7) {
+        wb->write_at(pc.saved_mbuf.offset() + 8 + dlen, 8 - (dlen & 7), &zero);
+      }
+      if (pc.is_string) {
+        size_t slen = pc.str_size();
+        wb->write_at(pc.saved_strbuf.offset() + 8, slen, pc.str_ptr());
+        if (slen & 7) {
+          wb->write_at(pc.saved_strbuf.offset() + 8 + slen, 8 - (slen & 7),
+                       &zero);
+        }
+      }
+    }
+
+    for (size_t j = 0; j < nsave; ++j) {
+      msg_columns[j] = column_meta_to_jay(save_cols[j], save_names[j], fbb,
+                                          prepared[j]);
+    }
+  } else {
+    // FileWritableBuffer performs the actual writing inside `prep_write`
+    // and cannot write from multiple threads; keep the sequential path.
+    for (size_t i = 0; i < static_cast<size_t>(ncols); ++i) {
+      Column* col = columns[i];
+      if (col->stype() == SType::OBJ) {
+        Warning() << "Column '" << colnames[i] << "' of type obj64 was not "
+                     "saved";
+      } else {
+        auto saved_col = column_to_jay(col, colnames[i], fbb, wb, compress,
+                                       grpsize);
+        msg_columns.push_back(saved_col);
+      }
     }
   }
   xassert((wb->size() & 7) == 0);
@@ -57,20 +250,127 @@ void DataTable::save_jay(const std::string& path,
                   static_cast<size_t>(nrows),
                   msg_columns.size(),
                   static_cast<int>(nkeys),
-                  &msg_columns);
+                  &msg_columns,
+                  grpsize);
   fbb.Finish(frame);
 
-  uint8_t* metaBytes = fbb.GetBufferPointer();
-  size_t   metaSize = fbb.GetSize();
-  wb->write(metaSize, metaBytes);
-  if (metaSize & 7) {
-    wb->write(8 - (metaSize & 7), "\0\0\0\0\0\0\0");
-    metaSize += 8 - (metaSize & 7);
+  write_jay_footer(fbb, wb);
+}
+
+
+
+//------------------------------------------------------------------------------
+// Append to an existing Jay file
+//------------------------------------------------------------------------------
+
+void DataTable::save_jay_append(const std::string& path,
+                                const std::vector<std::string>& colnames)
+{
+  reify();
+  if (nrows == 0) return;  // nothing to append
+
+  // Read the footer of the existing file, copying it out of the file before
+  // the file is reopened for writing. The data regions themselves are not
+  // touched: appending only writes the new "tail" regions, and then a new
+  // footer. For string columns we also need the last stored offset (the total
+  // length of the string data accumulated so far), which serves as the base
+  // for rebasing the offsets being appended; this must be read while the old
+  // file is still mapped.
+  std::vector<uint8_t> meta;
+  std::vector<uint64_t> strbases;
+  size_t data_end;  // file offset where the old footer begins
+  {
+    MemoryRange mbuf = MemoryRange::mmap(path);
+    const uint8_t* ptr = static_cast<const uint8_t*>(mbuf.rptr());
+    const size_t len = mbuf.size();
+    if (len < 24 ||
+        std::memcmp(ptr, "JAY1\0\0\0\0", 8) != 0 ||
+        std::memcmp(ptr + len - 8, "\0\0\0\0" "1JAY", 8) != 0) {
+      throw IOError() << "File " << path << " is not a valid Jay file, and "
+                         "cannot be appended to";
+    }
+    size_t meta_size = *reinterpret_cast<const size_t*>(ptr + len - 16);
+    if (meta_size > len - 24) {
+      throw IOError() << "Invalid Jay file: meta information is expected to "
+          "be " << meta_size << " bytes, however file size is only " << len;
+    }
+    data_end = len - 16 - meta_size;
+    meta.assign(ptr + data_end, ptr + data_end + meta_size);
+
+    auto frame = jay::GetFrame(meta.data());
+    flatbuffers::Verifier verifier(meta.data(), meta.size());
+    if (!frame->Verify(verifier)) {
+      throw IOError() << "Invalid meta record in Jay file " << path;
+    }
+    for (const jay::Column* jcol : *frame->columns()) {
+      uint64_t base = 0;
+      if (jcol->type() == jay::Type_Str32 ||
+          jcol->type() == jay::Type_Str64) {
+        const jay::Buffer* last = jcol->data();
+        if (jcol->tails() && jcol->tails()->size() > 0) {
+          last = jcol->tails()->Get(jcol->tails()->size() - 1);
+        }
+        size_t elemsize = (jcol->type() == jay::Type_Str32)? 4 : 8;
+        size_t regend = 8 + last->offset() + last->length();
+        if (last->length() < elemsize || regend > data_end) {
+          throw IOError() << "Invalid data region in Jay file " << path;
+        }
+        if (jcol->type() == jay::Type_Str32) {
+          uint32_t o = *reinterpret_cast<const uint32_t*>(ptr + regend - 4);
+          base = o & ~GETNA<uint32_t>();
+        } else {
+          uint64_t o = *reinterpret_cast<const uint64_t*>(ptr + regend - 8);
+          base = o & ~GETNA<uint64_t>();
+        }
+      }
+      strbases.push_back(base);
+    }
+  }
+  auto oldframe = jay::GetFrame(meta.data());
+  if (oldframe->nkeys() != 0) {
+    throw ValueError() << "Cannot append to Jay file " << path << ": the "
+        "frame stored there is keyed, and appending would break the key";
   }
 
-  wb->write(8, &metaSize);
-  wb->write(8, "\0\0\0\0" "1JAY");
-  wb->finalize();
+  size_t n_to_save = 0;
+  for (size_t i = 0; i < static_cast<size_t>(ncols); ++i) {
+    n_to_save += (columns[i]->stype() != SType::OBJ);
+  }
+  if (n_to_save != static_cast<size_t>(oldframe->ncols())) {
+    throw ValueError() << "Cannot append to Jay file " << path << ": it "
+        "contains " << oldframe->ncols() << " columns, while the frame "
+        "being appended has " << n_to_save;
+  }
+
+  auto wb = WritableBufferPtr(new FileWritableBuffer(path, data_end));
+
+  flatbuffers::FlatBufferBuilder fbb(1024);
+  std::vector<flatbuffers::Offset<jay::Column>> msg_columns;
+  size_t j = 0;  // columns are indexed differently if obj columns are present
+  for (size_t i = 0; i < static_cast<size_t>(ncols); ++i) {
+    Column* col = columns[i];
+    if (col->stype() == SType::OBJ) {
+      Warning() << "Column '" << colnames[i] << "' of type obj64 was not "
+                   "saved";
+      continue;
+    }
+    const jay::Column* jcol = oldframe->columns()->Get(
+                                  static_cast<flatbuffers::uoffset_t>(j));
+    auto saved_col = column_append_to_jay(col, jcol, colnames[i], strbases[j],
+                                          fbb, wb);
+    msg_columns.push_back(saved_col);
+    j++;
+  }
+  xassert((wb->size() & 7) == 0);
+
+  auto frame = jay::CreateFrameDirect(fbb,
+                  oldframe->nrows() + static_cast<size_t>(nrows),
+                  msg_columns.size(),
+                  0,
+                  &msg_columns);
+  fbb.Finish(frame);
+
+  write_jay_footer(fbb, wb);
 }
 
 
@@ -79,73 +379,275 @@ void DataTable::save_jay(const std::string& path,
 // Save a column
 //------------------------------------------------------------------------------
 
-static flatbuffers::Offset<jay::Column> column_to_jay(
+/**
+ * CPU-only part of saving a column: take shallow copies of the data
+ * buffers, compute row-group statistics, and attempt compression when
+ * requested. Thread-safe with respect to other columns.
+ */
+static void prepare_column(Column* col, bool compress, size_t grpsize,
+                           PreparedColumn& pc)
+{
+  pc.mbuf = col->data_buf();  // shallow copy of col's `mbuf`
+
+  if (grpsize) {
+    size_t n = static_cast<size_t>(col->nrows);
+    const void* cdata = pc.mbuf.rptr();
+    switch (col->stype()) {
+      case SType::BOOL:
+      case SType::INT8:
+        computeGroupStats(static_cast<const int8_t*>(cdata), n, grpsize,
+                          pc.groups); break;
+      case SType::INT16:
+        computeGroupStats(static_cast<const int16_t*>(cdata), n, grpsize,
+                          pc.groups); break;
+      case SType::INT32:
+        computeGroupStats(static_cast<const int32_t*>(cdata), n, grpsize,
+                          pc.groups); break;
+      case SType::INT64:
+        computeGroupStats(static_cast<const int64_t*>(cdata), n, grpsize,
+                          pc.groups); break;
+      case SType::FLOAT32:
+        computeGroupStats(static_cast<const float*>(cdata), n, grpsize,
+                          pc.groups); break;
+      case SType::FLOAT64:
+        computeGroupStats(static_cast<const double*>(cdata), n, grpsize,
+                          pc.groups); break;
+      default: break;  // no group statistics for string columns
+    }
+  }
+
+  if (col->stype() == SType::STR32) {
+    pc.sbuf = static_cast<StringColumn<uint32_t>*>(col)->str_buf();
+    pc.is_string = true;
+  }
+  if (col->stype() == SType::STR64) {
+    pc.sbuf = static_cast<StringColumn<uint64_t>*>(col)->str_buf();
+    pc.is_string = true;
+  }
+
+  // When compression is requested, the column is stored compressed only if
+  // this actually makes it smaller; otherwise it falls back to the plain
+  // representation (codec None).
+  if (compress) {
+    bool ok = compress_buffer(pc.mbuf.rptr(), pc.mbuf.size(), pc.zdata);
+    if (ok && pc.is_string) {
+      ok = compress_buffer(pc.sbuf.rptr(), pc.sbuf.size(), pc.zstr);
+    }
+    if (ok) {
+      pc.codec = jay::Codec_Zlib;
+    }
+  }
+
+  // Checksums are taken over the stored form of the data (the compressed
+  // bytes when compression kicked in), so that the reader can verify a
+  // region without decompressing it first. `jay::checksum` never returns
+  // 0, which in the file means "no checksum recorded".
+  pc.data_hash = jay::checksum(pc.data_ptr(), pc.data_size());
+  if (pc.is_string) {
+    pc.strdata_hash = jay::checksum(pc.str_ptr(), pc.str_size());
+  }
+}
+
+
+/**
+ * Build the flatbuffer metadata record of a column whose payload has
+ * already been prepared and written (i.e. `pc.saved_mbuf` / `saved_strbuf`
+ * point at valid file regions). Must be called from one thread at a time,
+ * since the FlatBufferBuilder is not thread-safe.
+ */
+static flatbuffers::Offset<jay::Column> column_meta_to_jay(
     Column* col, const std::string& name, flatbuffers::FlatBufferBuilder& fbb,
-    WritableBufferPtr& wb)
+    const PreparedColumn& pc)
 {
   jay::Stats jsttype = jay::Stats_NONE;
   flatbuffers::Offset<void> jsto;
+  jay::StatsMoments moments;
+  bool has_moments = false;
   Stats* colstats = col->get_stats_if_exist();
   switch (col->stype()) {
     case SType::BOOL:
       jsto = saveStats<int8_t,  int64_t, jay::StatsBool>(colstats, fbb);
       jsttype = jay::Stats_Bool;
+      has_moments = saveMoments<int8_t,  int64_t>(colstats, &moments);
       break;
     case SType::INT8:
       jsto = saveStats<int8_t,  int64_t, jay::StatsInt8>(colstats, fbb);
       jsttype = jay::Stats_Int8;
+      has_moments = saveMoments<int8_t,  int64_t>(colstats, &moments);
       break;
     case SType::INT16:
       jsto = saveStats<int16_t, int64_t, jay::StatsInt16>(colstats, fbb);
       jsttype = jay::Stats_Int16;
+      has_moments = saveMoments<int16_t, int64_t>(colstats, &moments);
       break;
     case SType::INT32:
       jsto = saveStats<int32_t, int64_t, jay::StatsInt32>(colstats, fbb);
       jsttype = jay::Stats_Int32;
+      has_moments = saveMoments<int32_t, int64_t>(colstats, &moments);
       break;
     case SType::INT64:
       jsto = saveStats<int64_t, int64_t, jay::StatsInt64>(colstats, fbb);
       jsttype = jay::Stats_Int64;
+      has_moments = saveMoments<int64_t, int64_t>(colstats, &moments);
       break;
     case SType::FLOAT32:
       jsto = saveStats<float,   double,  jay::StatsFloat32>(colstats, fbb);
       jsttype = jay::Stats_Float32;
+      has_moments = saveMoments<float,   double>(colstats, &moments);
       break;
     case SType::FLOAT64:
       jsto = saveStats<double,  double,  jay::StatsFloat64>(colstats, fbb);
       jsttype = jay::Stats_Float64;
+      has_moments = saveMoments<double,  double>(colstats, &moments);
       break;
     default: break;
   }
 
   auto sname = fbb.CreateString(name.c_str());
 
+  flatbuffers::Offset<flatbuffers::Vector<const jay::GroupStats*>> vgroups;
+  if (!pc.groups.empty()) {
+    vgroups = fbb.CreateVectorOfStructs(pc.groups);
+  }
+
   jay::ColumnBuilder cbb(fbb);
   cbb.add_type(stype_to_jaytype[static_cast<int>(col->stype())]);
   cbb.add_name(sname);
   cbb.add_nullcount(static_cast<uint64_t>(col->countna()));
-
-  MemoryRange mbuf = col->data_buf();  // shallow copt of col's `mbuf`
-  jay::Buffer saved_mbuf = saveMemoryRange(&mbuf, wb);
-  cbb.add_data(&saved_mbuf);
+  cbb.add_data(&pc.saved_mbuf);
   if (jsttype != jay::Stats_NONE) {
     cbb.add_stats_type(jsttype);
     cbb.add_stats(jsto);
   }
+  if (has_moments) {
+    cbb.add_moments(&moments);
+  }
+  if (pc.is_string) {
+    cbb.add_strdata(&pc.saved_strbuf);
+  }
+  if (pc.codec != jay::Codec_None) {
+    cbb.add_codec(pc.codec);
+    cbb.add_data_orig(pc.mbuf.size());
+    if (pc.is_string) {
+      cbb.add_strdata_orig(pc.sbuf.size());
+    }
+  }
+  if (!pc.groups.empty()) {
+    cbb.add_groups(vgroups);
+  }
+  cbb.add_data_hash(pc.data_hash);
+  if (pc.is_string) {
+    cbb.add_strdata_hash(pc.strdata_hash);
+  }
+
+  return cbb.Finish();
+}
+
+
+/**
+ * Prepare, write and describe a single column, sequentially. Used with
+ * targets that cannot write from multiple threads (FileWritableBuffer),
+ * and for single-column frames.
+ */
+static flatbuffers::Offset<jay::Column> column_to_jay(
+    Column* col, const std::string& name, flatbuffers::FlatBufferBuilder& fbb,
+    WritableBufferPtr& wb, bool compress, size_t grpsize)
+{
+  PreparedColumn pc;
+  prepare_column(col, compress, grpsize, pc);
+  pc.saved_mbuf = saveRawBuffer(pc.data_ptr(), pc.data_size(), wb);
+  if (pc.is_string) {
+    pc.saved_strbuf = saveRawBuffer(pc.str_ptr(), pc.str_size(), wb);
+  }
+  return column_meta_to_jay(col, name, fbb, pc);
+}
+
+
+/**
+ * Write a column's data as a new "tail" region at the end of an existing Jay
+ * file, and return the descriptor of the combined column. The old data
+ * regions are referenced as-is; only the delta is written. Stats stored in
+ * the old file are dropped, since they are no longer valid for the combined
+ * column.
+ */
+static flatbuffers::Offset<jay::Column> column_append_to_jay(
+    Column* col, const jay::Column* jcol, const std::string& name,
+    uint64_t strbase, flatbuffers::FlatBufferBuilder& fbb,
+    WritableBufferPtr& wb)
+{
+  jay::Type jtype = stype_to_jaytype[static_cast<int>(col->stype())];
+  if (jcol->type() != jtype) {
+    throw ValueError() << "Cannot append column '" << name << "': its type "
+        "does not match the type stored in the file; re-save the frame in "
+        "full instead";
+  }
+  if (!jcol->name() || jcol->name()->str() != name) {
+    throw ValueError() << "Cannot append column '" << name << "': the file "
+        "stores a different column at this position";
+  }
+  if (jcol->codec() != jay::Codec_None) {
+    throw ValueError() << "Cannot append column '" << name << "': the file "
+        "stores this column compressed; re-save the frame in full instead";
+  }
+
+  std::vector<jay::Buffer> tails;
+  std::vector<jay::Buffer> strtails;
+  if (jcol->tails()) {
+    for (const jay::Buffer* b : *jcol->tails()) tails.push_back(*b);
+  }
+  if (jcol->strtails()) {
+    for (const jay::Buffer* b : *jcol->strtails()) strtails.push_back(*b);
+  }
 
   if (col->stype() == SType::STR32) {
     auto scol = static_cast<StringColumn<uint32_t>*>(col);
-    MemoryRange sbuf = scol->str_buf();
-    jay::Buffer saved_strbuf = saveMemoryRange(&sbuf, wb);
-    cbb.add_strdata(&saved_strbuf);
+    if (strbase + scol->datasize() >= GETNA<uint32_t>()) {
+      throw ValueError() << "Cannot append column '" << name << "': the "
+          "combined string data would exceed the str32 limit; re-save the "
+          "frame in full instead";
+    }
+    tails.push_back(saveRebasedOffsets<uint32_t>(col, strbase, wb));
+    strtails.push_back(saveRawBuffer(scol->strdata(), scol->datasize(), wb));
   }
-  if (col->stype() == SType::STR64) {
+  else if (col->stype() == SType::STR64) {
     auto scol = static_cast<StringColumn<uint64_t>*>(col);
-    MemoryRange sbuf = scol->str_buf();
-    jay::Buffer saved_strbuf = saveMemoryRange(&sbuf, wb);
-    cbb.add_strdata(&saved_strbuf);
+    tails.push_back(saveRebasedOffsets<uint64_t>(col, strbase, wb));
+    strtails.push_back(saveRawBuffer(scol->strdata(), scol->datasize(), wb));
+  }
+  else {
+    MemoryRange mbuf = col->data_buf();
+    tails.push_back(saveRawBuffer(mbuf.rptr(), mbuf.size(), wb));
+  }
+
+  auto sname = fbb.CreateString(name.c_str());
+  auto vtails = fbb.CreateVectorOfStructs(tails);
+  flatbuffers::Offset<flatbuffers::Vector<const jay::Buffer*>> vstrtails;
+  if (!strtails.empty()) {
+    vstrtails = fbb.CreateVectorOfStructs(strtails);
   }
 
+  jay::ColumnBuilder cbb(fbb);
+  cbb.add_type(jtype);
+  cbb.add_name(sname);
+  cbb.add_nullcount(jcol->nullcount() + static_cast<uint64_t>(col->countna()));
+  jay::Buffer jdata = *jcol->data();
+  cbb.add_data(&jdata);
+  if (jcol->strdata()) {
+    jay::Buffer jstrdata = *jcol->strdata();
+    cbb.add_strdata(&jstrdata);
+  }
+  cbb.add_tails(vtails);
+  if (!strtails.empty()) {
+    cbb.add_strtails(vstrtails);
+  }
+  // Appending does not touch the main data regions, so their checksums
+  // remain valid; the tail regions being written are not checksummed.
+  if (jcol->data_hash()) {
+    cbb.add_data_hash(jcol->data_hash());
+  }
+  if (jcol->strdata_hash()) {
+    cbb.add_strdata_hash(jcol->strdata_hash());
+  }
   return cbb.Finish();
 }
 
@@ -168,12 +670,29 @@ void init_jay() {
 }
 
 
-static jay::Buffer saveMemoryRange(
-    const MemoryRange* mbuf, WritableBufferPtr& wb)
+/**
+ * Compress `data` with zlib into `out`. Returns false (leaving `out` in an
+ * unspecified state) if the data is incompressible, i.e. if the compressed
+ * form would not be smaller than the original.
+ */
+static bool compress_buffer(
+    const void* data, size_t len, std::vector<char>& out)
+{
+  if (len == 0) return false;
+  uLongf zlen = compressBound(static_cast<uLong>(len));
+  out.resize(zlen);
+  int ret = compress2(reinterpret_cast<Bytef*>(out.data()), &zlen,
+                      static_cast<const Bytef*>(data),
+                      static_cast<uLong>(len), Z_DEFAULT_COMPRESSION);
+  if (ret != Z_OK || zlen >= len) return false;
+  out.resize(zlen);
+  return true;
+}
+
+
+static jay::Buffer saveRawBuffer(
+    const void* data, size_t len, WritableBufferPtr& wb)
 {
-  if (!mbuf) return jay::Buffer();
-  size_t len = mbuf->size();
-  const void* data = mbuf->rptr();
   size_t pos = wb->prep_write(len, data);
   wb->write_at(pos, len, data);
   xassert(pos >= 8);
@@ -186,6 +705,84 @@ static jay::Buffer saveMemoryRange(
 }
 
 
+/**
+ * Write the offsets of string column `col` shifted by `strbase` (the total
+ * length of the string data already stored in the file), preserving the NA
+ * flag in the high bit. The leading zero element of the offsets buffer is
+ * not written: when the tail is concatenated after the previous region, the
+ * last offset of that region takes its place.
+ */
+template <typename T>
+static jay::Buffer saveRebasedOffsets(
+    Column* col, uint64_t strbase, WritableBufferPtr& wb)
+{
+  auto scol = static_cast<StringColumn<T>*>(col);
+  const T* offsets = scol->offsets();
+  size_t n = static_cast<size_t>(col->nrows);
+  std::vector<T> rebased(n);
+  for (size_t i = 0; i < n; ++i) {
+    T o = offsets[i];
+    rebased[i] = static_cast<T>(((o & ~GETNA<T>()) + strbase) |
+                                (o & GETNA<T>()));
+  }
+  return saveRawBuffer(rebased.data(), n * sizeof(T), wb);
+}
+
+
+/**
+ * Compute per-row-group min/max of a numeric column. NA values are skipped;
+ * a group consisting of NAs only records min > max, so that it fails every
+ * range predicate when the reader prunes groups.
+ */
+template <typename T>
+static void computeGroupStats(const T* data, size_t nrows, size_t grpsize,
+                              std::vector<jay::GroupStats>& out)
+{
+  size_t ngroups = (nrows + grpsize - 1) / grpsize;
+  out.resize(ngroups);
+  #pragma omp parallel for schedule(static)
+  for (int64_t g = 0; g < static_cast<int64_t>(ngroups); ++g) {
+    size_t row0 = static_cast<size_t>(g) * grpsize;
+    size_t row1 = std::min(row0 + grpsize, nrows);
+    T mn = T(0), mx = T(0);
+    bool valid = false;
+    for (size_t i = row0; i < row1; ++i) {
+      T x = data[i];
+      if (ISNA<T>(x)) continue;
+      if (!valid || x < mn) mn = x;
+      if (!valid || x > mx) mx = x;
+      valid = true;
+    }
+    if (!valid) {
+      out[g] = jay::GroupStats(1, 0, 1.0, 0.0);
+    } else if (std::is_integral<T>::value) {
+      out[g] = jay::GroupStats(static_cast<int64_t>(mn),
+                               static_cast<int64_t>(mx), 0.0, 0.0);
+    } else {
+      out[g] = jay::GroupStats(0, 0, static_cast<double>(mn),
+                               static_cast<double>(mx));
+    }
+  }
+}
+
+
+static void write_jay_footer(
+    flatbuffers::FlatBufferBuilder& fbb, WritableBufferPtr& wb)
+{
+  uint8_t* metaBytes = fbb.GetBufferPointer();
+  size_t   metaSize = fbb.GetSize();
+  wb->write(metaSize, metaBytes);
+  if (metaSize & 7) {
+    wb->write(8 - (metaSize & 7), "\0\0\0\0\0\0\0");
+    metaSize += 8 - (metaSize & 7);
+  }
+
+  wb->write(8, &metaSize);
+  wb->write(8, "\0\0\0\0" "1JAY");
+  wb->finalize();
+}
+
+
 template <typename T, typename A, typename StatBuilder>
 static flatbuffers::Offset<void> saveStats(
     Stats* stats, flatbuffers::FlatBufferBuilder& fbb)
@@ -200,3 +797,26 @@ static flatbuffers::Offset<void> saveStats(
   flatbuffers::Offset<void> o = fbb.CreateStruct(ss).Union();
   return o;
 }
+
+
+/**
+ * Fill `out` with the moment statistics of a column, if they were computed.
+ * All moments are produced together by `compute_numerical_stats()`, so it is
+ * sufficient to check the Mean / StDev flags.
+ */
+template <typename T, typename A>
+static bool saveMoments(Stats* stats, jay::StatsMoments* out) {
+  if (!stats ||
+      !(stats->is_computed(Stat::Mean) && stats->is_computed(Stat::StDev)))
+    return false;
+  auto nstat = static_cast<NumericalStats<T, A>*>(stats);
+  A sum = nstat->sum(nullptr);
+  *out = jay::StatsMoments(
+      std::is_integral<A>::value? static_cast<int64_t>(sum) : 0,
+      static_cast<double>(sum),
+      nstat->mean(nullptr),
+      nstat->stdev(nullptr),
+      nstat->skew(nullptr),
+      nstat->kurt(nullptr));
+  return true;
+}
@@ -6,16 +6,113 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include "memrange.h"
+#include <algorithm>           // std::max, std::min
 #include <cerrno>              // errno
+#include <cstdint>             // uintptr_t
+#include <cstring>             // std::memcpy, std::strerror
+#include <map>                 // std::map
 #include <mutex>               // std::mutex, std::lock_guard
-#include <sys/mman.h>          // mmap, munmap
+#include <vector>              // std::vector
+#include <fcntl.h>             // O_RDONLY
+#include <sys/mman.h>          // mmap, munmap, madvise, shm_open
+#include <sys/stat.h>          // fstat
+#include <unistd.h>            // sysconf, close
 #include "mmm.h"               // MemoryMapWorker, MemoryMapManager
+#include "options.h"           // config::memory_hugepage_threshold
 #include "utils.h"             // malloc_size
 #include "utils/alloc.h"       // dt::malloc, dt::realloc
+#include "utils/omp.h"         // omp_in_parallel
 #include "utils/exceptions.h"  // ValueError, MemoryError
 
 
 
+/**
+ * Forward an `MmmAdvice` hint to the kernel as `madvise()` on the given
+ * memory-mapped region. The address is aligned down to a page boundary as
+ * required by `madvise`; the extra bytes belong to the same mapping, so
+ * advising them too is harmless. `DontNeed` is suppressed for writable
+ * regions: dropping the pages of a writable private mapping would silently
+ * discard any modifications made through it.
+ */
+static void madvise_region(void* ptr, size_t n, MmmAdvice a, bool writable) {
+  if (!ptr || !n) return;
+  int adv;
+  switch (a) {
+    case MmmAdvice::Normal:     adv = MADV_NORMAL; break;
+    case MmmAdvice::Sequential: adv = MADV_SEQUENTIAL; break;
+    case MmmAdvice::Random:     adv = MADV_RANDOM; break;
+    case MmmAdvice::WillNeed:   adv = MADV_WILLNEED; break;
+    case MmmAdvice::DontNeed:   adv = MADV_DONTNEED; break;
+    default: return;
+  }
+  if (a == MmmAdvice::DontNeed && writable) return;
+  static const size_t pagesize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  size_t addr = reinterpret_cast<size_t>(ptr);
+  size_t shift = addr & (pagesize - 1);
+  // Advisory only: if the kernel rejects the hint, we simply run unhinted
+  madvise(reinterpret_cast<void*>(addr - shift), n + shift, adv);
+}
+
+
+
+//==============================================================================
+// Copy-on-write accounting
+//==============================================================================
+
+namespace dt {
+namespace cow {
+
+  // Materializations are rare (that is the point of this accounting), so a
+  // plain mutex-protected map is sufficient here.
+  static std::mutex stats_lock;
+  static std::map<std::string, Counters>& stats_map() {
+    static std::map<std::string, Counters> stats;
+    return stats;
+  }
+  static thread_local const char* current_op = nullptr;
+
+  Operation::Operation(const char* op) {
+    owner = (current_op == nullptr);
+    if (owner) current_op = op;
+  }
+
+  Operation::~Operation() {
+    if (owner) current_op = nullptr;
+  }
+
+  void record(size_t bytes_copied) {
+    std::lock_guard<std::mutex> lg(stats_lock);
+    Counters& c = stats_map()[current_op? current_op : "?"];
+    c.ncopies++;
+    c.bytes_copied += bytes_copied;
+  }
+
+  Counters totals() {
+    std::lock_guard<std::mutex> lg(stats_lock);
+    Counters res { 0, 0 };
+    for (const auto& kv : stats_map()) {
+      res.ncopies += kv.second.ncopies;
+      res.bytes_copied += kv.second.bytes_copied;
+    }
+    return res;
+  }
+
+  std::vector<std::pair<std::string, Counters>> by_operation() {
+    std::lock_guard<std::mutex> lg(stats_lock);
+    return std::vector<std::pair<std::string, Counters>>(
+               stats_map().begin(), stats_map().end());
+  }
+
+  void reset() {
+    std::lock_guard<std::mutex> lg(stats_lock);
+    stats_map().clear();
+  }
+
+}  // namespace cow
+}  // namespace dt
+
+
+
 //==============================================================================
 // Implementation classes
 //==============================================================================
@@ -35,6 +132,10 @@
       void clear_pyobjects();
 
       virtual void resize(size_t) {}
+      virtual bool reserve_capacity(size_t) { return false; }
+      virtual size_t capacity() const { return bufsize; }
+      virtual void advise(MmmAdvice) {}
+      virtual bool is_mmapped() const { return false; }
       virtual size_t size() const { return bufsize; }
       virtual void* ptr() const { return bufdata; }
       virtual size_t memory_footprint() const = 0;
@@ -45,24 +146,90 @@
 
   struct MemoryRange::internal {
     std::unique_ptr<BaseMRI> impl;
+    // CoW accounting, carried over from the previous `internal` whenever
+    // the buffer is materialized (see MemoryRange::materialize)
+    size_t cow_count = 0;
+    size_t cow_bytes = 0;
 
     internal(BaseMRI* _impl) : impl(std::move(_impl)) {}
   };
 
 
   class MemoryMRI : public BaseMRI {
+    private:
+      // Allocated capacity: equal to `bufsize` unless `reserve_capacity()`
+      // created slack, in which case resizes within the capacity only
+      // adjust `bufsize` (see MemoryRange::reserve).
+      size_t allocsize;
+      bool reserved;
+      int64_t : 56;
+
     public:
       MemoryMRI(size_t n);
       MemoryMRI(size_t n, void* ptr);
       ~MemoryMRI() override;
 
       void resize(size_t n) override;
+      bool reserve_capacity(size_t n) override;
+      size_t capacity() const override { return allocsize; }
       size_t memory_footprint() const override;
       const char* name() const override { return "ram"; }
       void verify_integrity() const override;
   };
 
 
+  /**
+   * Implementation class for a large heap allocation backed by an anonymous
+   * memory map. The region is rounded up to a multiple of 2MB and marked
+   * with `madvise(MADV_HUGEPAGE)`, inviting the kernel to serve it with
+   * transparent huge pages; random-access phases (radix reorder, rowindex
+   * gathers) then take far fewer TLB misses than with 4KB pages. The advice
+   * is best-effort: if the kernel ignores it, the buffer still works as a
+   * plain anonymous mapping. Only used on Linux, for buffers of at least
+   * `config::memory_hugepage_threshold` bytes (see `MemoryRange::mem`).
+   */
+  #ifdef __linux__
+  class HugepageMRI : public BaseMRI {
+    private:
+      size_t allocsize;  // bufsize rounded up to a multiple of the page size
+
+    public:
+      HugepageMRI(size_t n);
+      ~HugepageMRI() override;
+
+      void resize(size_t n) override;
+      size_t memory_footprint() const override;
+      const char* name() const override { return "hugemem"; }
+
+    private:
+      static size_t round_allocsize(size_t n);
+  };
+  #endif
+
+
+  /**
+   * Implementation class for a read-only buffer attached to a named POSIX
+   * shared memory object (`shm_open`). One process creates and fills the
+   * region (see `ShmemWritableBuffer` in writebuf.h), and any number of
+   * other processes attach to the same name through `MemoryRange::shmem`,
+   * all mapping a single physical copy of the data. Destroying the
+   * MemoryRange merely unmaps the region; the shared object itself lives
+   * until explicitly removed with `shm_unlink`.
+   */
+  class ShmemMRI : public BaseMRI {
+    private:
+      const std::string shmname;
+
+    public:
+      ShmemMRI(const std::string& name);
+      ~ShmemMRI() override;
+
+      bool is_mmapped() const override { return true; }
+      size_t memory_footprint() const override;
+      const char* name() const override { return "shmem"; }
+  };
+
+
   class ExternalMRI : public BaseMRI {
     private:
       Py_buffer* pybufinfo;
@@ -114,6 +281,7 @@
       virtual ~ViewMRI() override;
 
       void resize(size_t n) override;
+      void advise(MmmAdvice a) override;
       size_t memory_footprint() const override;
       const char* name() const override { return "view"; }
       void verify_integrity() const override;
@@ -131,6 +299,7 @@
       void release();
 
       bool is_writable() const;
+      bool is_mmapped() const override;
       size_t memory_footprint() const override;
       const char* name() const override { return "viewed"; }
 
@@ -159,6 +328,9 @@
       void save_entry_index(size_t i) override;
       void evict() override;
       void resize(size_t n) override;
+      void advise(MmmAdvice a) override;
+      void memory_advise(MmmAdvice a) override;
+      bool is_mmapped() const override { return mapped; }
       size_t memory_footprint() const override;
       const char* name() const override { return "mmap"; }
       void verify_integrity() const override;
@@ -186,6 +358,77 @@
   };
 
 
+  // ComputedMRI is a "lazy" memory region: its size is known upfront, but no
+  // memory is allocated and no work is done until the data is first accessed.
+  // At that point the stored function is invoked once to fill a freshly
+  // allocated buffer, after which the function (and any resources captured by
+  // it) is released and the region behaves like plain memory. This is the
+  // same materialize-on-first-access scheme that MmapMRI uses for files,
+  // applied to computed data.
+  //
+  class ComputedMRI : public BaseMRI {
+    private:
+      std::function<void(void*)> compute;
+      mutable std::mutex compute_lock;
+
+    public:
+      ComputedMRI(size_t n, std::function<void(void*)> fn);
+      ~ComputedMRI() override;
+
+      void* ptr() const override;
+      size_t memory_footprint() const override;
+      const char* name() const override { return "lazy"; }
+      void verify_integrity() const override;
+  };
+
+
+  // Arena is a thread-local pool that small short-lived scratch buffers are
+  // carved out of with a simple bump-pointer, instead of each of them going
+  // through the global allocator. Memory is only reclaimed in bulk: when the
+  // last scratch buffer drawn from the arena is released, the arena rewinds
+  // (keeping its first block for reuse). This makes allocation of transient
+  // buffers during an operation essentially free, at the cost of the arena
+  // holding its high-water mark of memory until the operation ends.
+  //
+  // Each ArenaMRI remembers which arena it came from, so a scratch buffer
+  // may be released from a different thread than the one that allocated it;
+  // it must not, however, outlive the allocating thread itself.
+  //
+  class Arena {
+    private:
+      struct Block {
+        void* data;
+        size_t size;
+        size_t used;
+      };
+      std::vector<Block> blocks;
+      size_t nlive;
+      std::mutex lock;
+      static constexpr size_t BLOCK_SIZE = 1 << 20;
+
+    public:
+      Arena() : nlive(0) {}
+      ~Arena();
+
+      void* allocate(size_t n);
+      void release();
+      static Arena& local();
+  };
+
+
+  class ArenaMRI : public BaseMRI {
+    private:
+      Arena* arena;
+
+    public:
+      ArenaMRI(size_t n);
+      ~ArenaMRI() override;
+
+      size_t memory_footprint() const override;
+      const char* name() const override { return "arena"; }
+  };
+
+
 
 
 //==============================================================================
@@ -200,12 +443,42 @@
 
   MemoryRange::MemoryRange() : MemoryRange(new MemoryMRI(0)) {}
 
+  /**
+   * Touch one byte in every page of a freshly allocated buffer, from all
+   * OpenMP threads in a static round-robin. Under the kernel's first-touch
+   * policy this spreads the buffer's pages across the NUMA nodes that the
+   * threads run on, so that subsequent statically-scheduled parallel loops
+   * over the buffer read mostly node-local memory. The buffer's contents are
+   * uninitialized at this point, so the writes are harmless.
+   */
+  static void first_touch(void* ptr, size_t n) {
+    constexpr size_t pagesize = 4096;
+    size_t npages = (n + pagesize - 1) / pagesize;
+    char* data = static_cast<char*>(ptr);
+    #pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < npages; ++i) {
+      data[i * pagesize] = 0;
+    }
+  }
+
+
   MemoryRange MemoryRange::mem(size_t n) {
-    return MemoryRange(new MemoryMRI(n));
+    BaseMRI* impl = nullptr;
+    #ifdef __linux__
+      size_t threshold = config::memory_hugepage_threshold;
+      if (threshold && n >= threshold) {
+        impl = new HugepageMRI(n);
+      }
+    #endif
+    if (!impl) impl = new MemoryMRI(n);
+    if (config::memory_first_touch && n >= (1 << 20) && !omp_in_parallel()) {
+      first_touch(impl->ptr(), n);
+    }
+    return MemoryRange(impl);
   }
 
   MemoryRange MemoryRange::mem(int64_t n) {
-    return MemoryRange(new MemoryMRI(static_cast<size_t>(n)));
+    return mem(static_cast<size_t>(n));
   }
 
   MemoryRange MemoryRange::acquire(void* ptr, size_t n) {
@@ -224,7 +497,30 @@
     return MemoryRange(new ViewMRI(n, src, offset));
   }
 
+  MemoryRange MemoryRange::shmem(const std::string& name) {
+    return MemoryRange(new ShmemMRI(name));
+  }
+
   MemoryRange MemoryRange::mmap(const std::string& path) {
+    // Files residing on storage with poor random-read performance (see the
+    // option `memory.sequential_paths`) are not handed out as plain
+    // mappings: random-touching an HDD-backed mapping turns every page
+    // fault into a seek. Instead the file is staged into anonymous memory
+    // with a single sequential read-ahead pass, performed lazily when the
+    // data is first accessed.
+    if (config::is_sequential_path(path)) {
+      size_t n = File::asize(path);
+      if (n) {
+        MemoryRange src(new MmapMRI(path));
+        return MemoryRange::computed(n,
+          [src, n](void* out) {
+            const void* ptr = src.rptr();   // maps the file
+            src.advise(MmmAdvice::Sequential);
+            src.advise(MmmAdvice::WillNeed);
+            std::memcpy(out, ptr, std::min(n, src.size()));
+          });
+      }
+    }
     return MemoryRange(new MmapMRI(path));
   }
 
@@ -238,6 +534,14 @@
     return MemoryRange(new OvermapMRI(path, extra_n, fd));
   }
 
+  MemoryRange MemoryRange::computed(size_t n, std::function<void(void*)> fn) {
+    return MemoryRange(new ComputedMRI(n, std::move(fn)));
+  }
+
+  MemoryRange MemoryRange::scratch(size_t n) {
+    return MemoryRange(new ArenaMRI(n));
+  }
+
 
   //---- Basic properties ------------------------
 
@@ -265,6 +569,41 @@
     return sizeof(MemoryRange) + sizeof(internal) + o->impl->memory_footprint();
   }
 
+  const char* MemoryRange::resource_type() const {
+    return o->impl->name();
+  }
+
+  size_t MemoryRange::share_count() const {
+    return static_cast<size_t>(o.use_count());
+  }
+
+  size_t MemoryRange::resident_size() const {
+    size_t n = o->impl->size();
+    const void* ptr = o->impl->ptr();
+    if (!ptr || !n) return 0;
+    #ifndef _WIN32
+      size_t pagesize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+      uintptr_t addr = reinterpret_cast<uintptr_t>(ptr);
+      size_t shift = addr % pagesize;
+      size_t len = n + shift;
+      size_t npages = (len + pagesize - 1) / pagesize;
+      std::vector<unsigned char> pageflags(npages);
+      int ret = mincore(reinterpret_cast<void*>(addr - shift), len,
+                        #ifdef __linux__
+                          pageflags.data()
+                        #else
+                          reinterpret_cast<char*>(pageflags.data())
+                        #endif
+                        );
+      if (ret == 0) {
+        size_t resident = 0;
+        for (unsigned char flag : pageflags) resident += (flag & 1);
+        return std::min(resident * pagesize, n);
+      }
+    #endif
+    return n;
+  }
+
 
   //---- Main data accessors ---------------------
 
@@ -278,7 +617,10 @@
   }
 
   void* MemoryRange::wptr() {
-    if (!is_writable()) materialize();
+    if (!is_writable()) {
+      dt::cow::Operation cowop("write");
+      materialize();
+    }
     return o->impl->ptr();
   }
 
@@ -339,12 +681,27 @@
         }
       } else {
         size_t copysize = keep_data? std::min(newsize, oldsize) : 0;
+        dt::cow::Operation cowop("resize");
         materialize(newsize, copysize);
       }
     }
     return *this;
   }
 
+  MemoryRange& MemoryRange::reserve(size_t newcap) {
+    if (!(is_resizable() && o->impl->reserve_capacity(newcap))) {
+      // The current backend cannot carry spare capacity (or is shared /
+      // read-only): materialize into a plain RAM buffer and reserve there.
+      materialize();
+      o->impl->reserve_capacity(newcap);
+    }
+    return *this;
+  }
+
+  size_t MemoryRange::capacity() const {
+    return o->impl->capacity();
+  }
+
 
   //---- Utility functions -----------------------
 
@@ -356,6 +713,11 @@
   }
 
 
+  void MemoryRange::advise(MmmAdvice a) const {
+    o->impl->advise(a);
+  }
+
+
   PyObject* MemoryRange::pyrepr() const {
     return PyUnicode_FromFormat("<MemoryRange:%s %p+%zu (ref=%zu)>",
                                 o->impl->name(), o->impl->ptr(), o->impl->size(),
@@ -390,7 +752,20 @@
       for (; i < n_new; ++i) newdata[i] = Py_None;
       Py_None->ob_refcnt += n_new - n_copy;
     }
-    o = std::make_shared<internal>(std::move(newimpl));
+    auto newo = std::make_shared<internal>(std::move(newimpl));
+    newo->cow_count = o->cow_count + 1;
+    newo->cow_bytes = o->cow_bytes + copysize;
+    dt::cow::record(copysize);
+    o = std::move(newo);
+  }
+
+
+  size_t MemoryRange::cow_count() const {
+    return o->cow_count;
+  }
+
+  size_t MemoryRange::cow_bytes() const {
+    return o->cow_bytes;
   }
 
 
@@ -509,9 +884,13 @@
   MemoryMRI::MemoryMRI(size_t n) {
     bufsize = n;
     bufdata = dt::malloc<void>(n);
+    allocsize = n;
+    reserved = false;
   }
 
   MemoryMRI::MemoryMRI(size_t n, void* ptr) {
+    allocsize = n;
+    reserved = false;
     if (n) {
       if (!ptr) throw ValueError() << "Unallocated memory region provided";
       bufsize = n;
@@ -530,8 +909,22 @@
 
   void MemoryMRI::resize(size_t n) {
     if (n == bufsize) return;
+    if (reserved && n <= allocsize) {
+      bufsize = n;
+      return;
+    }
     bufdata = dt::realloc(bufdata, n);
     bufsize = n;
+    allocsize = n;
+  }
+
+  bool MemoryMRI::reserve_capacity(size_t n) {
+    if (n > allocsize) {
+      bufdata = dt::realloc(bufdata, n);
+      allocsize = n;
+    }
+    reserved = true;
+    return true;
   }
 
   void MemoryMRI::verify_integrity() const {
@@ -550,6 +943,132 @@
 
 
 
+//==============================================================================
+// HugepageMRI
+//==============================================================================
+#ifdef __linux__
+
+  size_t HugepageMRI::round_allocsize(size_t n) {
+    // Round up to a multiple of 2MB (the x86 huge page size), so that the
+    // kernel is able to promote the entire region to huge pages.
+    constexpr size_t HUGEPAGE_SIZE = 2 * 1024 * 1024;
+    return (n + HUGEPAGE_SIZE - 1) & ~(HUGEPAGE_SIZE - 1);
+  }
+
+  HugepageMRI::HugepageMRI(size_t n) {
+    allocsize = 0;
+    bufsize = n;
+    if (n) {
+      allocsize = round_allocsize(n);
+      bufdata = ::mmap(/* address = */ nullptr,
+                       /* length = */ allocsize,
+                       /* protection = */ PROT_WRITE|PROT_READ,
+                       /* flags = */ MAP_PRIVATE|MAP_ANONYMOUS,
+                       /* fd = */ -1,
+                       /* offset = */ 0);
+      if (bufdata == MAP_FAILED) {
+        bufdata = nullptr;
+        throw MemoryError() << "Unable to allocate " << allocsize
+                            << " bytes of anonymous memory" << Errno;
+      }
+      // Purely advisory: failure (e.g. THP disabled in the kernel) is not
+      // an error, the mapping just stays on regular pages.
+      madvise(bufdata, allocsize, MADV_HUGEPAGE);
+    }
+  }
+
+  HugepageMRI::~HugepageMRI() {
+    clear_pyobjects();
+    if (bufdata) {
+      munmap(bufdata, allocsize);
+    }
+  }
+
+  void HugepageMRI::resize(size_t n) {
+    if (n == bufsize) return;
+    if (n == 0) {
+      munmap(bufdata, allocsize);
+      bufdata = nullptr;
+      allocsize = 0;
+      bufsize = 0;
+      return;
+    }
+    size_t newallocsize = round_allocsize(n);
+    if (newallocsize != allocsize) {
+      void* ptr = bufdata
+          ? mremap(bufdata, allocsize, newallocsize, MREMAP_MAYMOVE)
+          : ::mmap(nullptr, newallocsize, PROT_WRITE|PROT_READ,
+                   MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+      if (ptr == MAP_FAILED) {
+        throw MemoryError() << "Unable to resize anonymous memory map from "
+            << allocsize << " to " << newallocsize << " bytes" << Errno;
+      }
+      bufdata = ptr;
+      allocsize = newallocsize;
+      madvise(bufdata, allocsize, MADV_HUGEPAGE);
+    }
+    bufsize = n;
+  }
+
+  size_t HugepageMRI::memory_footprint() const {
+    return sizeof(HugepageMRI) + allocsize;
+  }
+
+#endif
+
+
+
+//==============================================================================
+// ShmemMRI
+//==============================================================================
+
+  ShmemMRI::ShmemMRI(const std::string& name) : shmname(name) {
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd == -1) {
+      throw RuntimeError() << "Cannot open shared memory object `" << name
+          << "`" << Errno;
+    }
+    struct stat statbuf;
+    if (fstat(fd, &statbuf) == -1) {
+      ::close(fd);
+      throw RuntimeError() << "Cannot stat shared memory object `" << name
+          << "`" << Errno;
+    }
+    size_t n = static_cast<size_t>(statbuf.st_size);
+    void* ptr = nullptr;
+    if (n) {
+      ptr = ::mmap(nullptr, n, PROT_READ, MAP_SHARED, fd, 0);
+      if (ptr == MAP_FAILED) {
+        ::close(fd);
+        throw RuntimeError() << "Memory map failed for shared memory object `"
+            << name << "` of size " << n << Errno;
+      }
+    }
+    ::close(fd);
+    bufdata = ptr;
+    bufsize = n;
+    resizable = false;
+    writable = false;
+  }
+
+  ShmemMRI::~ShmemMRI() {
+    if (bufdata) {
+      int ret = munmap(bufdata, bufsize);
+      if (ret) {
+        printf("Error unmapping shared memory object %s (%p..+%zu): "
+               "[errno %d] %s", shmname.c_str(), bufdata, bufsize,
+               errno, strerror(errno));
+      }
+      bufdata = nullptr;
+    }
+  }
+
+  size_t ShmemMRI::memory_footprint() const {
+    return sizeof(ShmemMRI) + bufsize + shmname.size();
+  }
+
+
+
 //==============================================================================
 // ExternalMRI
 //==============================================================================
@@ -623,6 +1142,15 @@
     throw RuntimeError() << "ViewMRI cannot be resized";
   }
 
+  void ViewMRI::advise(MmmAdvice a) {
+    // Only forward the hint if the viewed region is actually memory-mapped;
+    // advising a sub-range of a heap buffer would touch pages that do not
+    // belong to this view.
+    if (base->is_mmapped()) {
+      madvise_region(bufdata, bufsize, a, writable);
+    }
+  }
+
   void ViewMRI::verify_integrity() const {
     BaseMRI::verify_integrity();
     if (resizable) {
@@ -679,6 +1207,10 @@
     return original_impl->writable;
   }
 
+  bool ViewedMRI::is_mmapped() const {
+    return original_impl && original_impl->is_mmapped();
+  }
+
   size_t ViewedMRI::memory_footprint() const {
     return 0;
   }
@@ -715,6 +1247,14 @@
 
   void* MmapMRI::ptr() const {
     const_cast<MmapMRI*>(this)->memmap();
+    // Refresh the LRU stamp of this mapping, so that budget-driven
+    // eviction targets regions that are actually cold. Only done when a
+    // budget is set: without one the stamp assigned at map time (see
+    // MemoryMapManager::add_entry) is sufficient for emergency eviction,
+    // and pointer acquisition stays free of locking.
+    if (mmm_index && MemoryMapManager::get()->has_budget()) {
+      MemoryMapManager::get()->touch_entry(mmm_index, this);
+    }
     return bufdata;
   }
 
@@ -725,6 +1265,16 @@
     memmap();
   }
 
+  void MmapMRI::advise(MmmAdvice a) {
+    if (mapped) {
+      madvise_region(bufdata, bufsize, a, writable);
+    }
+  }
+
+  void MmapMRI::memory_advise(MmmAdvice a) {
+    advise(a);
+  }
+
   size_t MmapMRI::memory_footprint() const {
     return sizeof(MmapMRI) + filename.size() + (mapped? bufsize : 0);
   }
@@ -848,7 +1398,9 @@
 
   void MmapMRI::save_entry_index(size_t i) {
     mmm_index = i;
-    xassert(MemoryMapManager::get()->check_entry(mmm_index, this));
+    // This callback runs from inside the MemoryMapManager, which already
+    // holds its (non-recursive) mutex -- the check must not re-lock it.
+    xassert(MemoryMapManager::get()->check_entry_unlocked(mmm_index, this));
   }
 
   void MmapMRI::evict() {
@@ -982,6 +1534,127 @@
 
 
 
+
+//==============================================================================
+// ComputedMRI
+//==============================================================================
+
+  ComputedMRI::ComputedMRI(size_t n, std::function<void(void*)> fn)
+    : compute(std::move(fn))
+  {
+    bufdata = nullptr;
+    bufsize = n;
+    writable = false;
+    resizable = false;
+  }
+
+  ComputedMRI::~ComputedMRI() {
+    std::free(bufdata);
+  }
+
+  void* ComputedMRI::ptr() const {
+    if (!bufdata) {
+      std::lock_guard<std::mutex> lock(compute_lock);
+      if (!bufdata) {
+        void* buf = dt::malloc<void>(bufsize);
+        compute(buf);
+        ComputedMRI* self = const_cast<ComputedMRI*>(this);
+        self->bufdata = buf;
+        self->compute = nullptr;  // release any captured resources
+      }
+    }
+    return bufdata;
+  }
+
+  size_t ComputedMRI::memory_footprint() const {
+    return sizeof(ComputedMRI) + (bufdata? bufsize : 0);
+  }
+
+  void ComputedMRI::verify_integrity() const {
+    if (bufdata) {
+      BaseMRI::verify_integrity();
+    } else if (!compute) {
+      throw AssertionError()
+          << "Lazy MemoryRange has no data and no compute function";
+    }
+    if (pyobjects) {
+      throw AssertionError() << "Lazy MemoryRange cannot contain pyobjects";
+    }
+    if (resizable) {
+      throw AssertionError() << "Lazy MemoryRange cannot be resizable";
+    }
+  }
+
+
+
+
+//==============================================================================
+// ArenaMRI
+//==============================================================================
+
+  Arena::~Arena() {
+    for (Block& b : blocks) {
+      std::free(b.data);
+    }
+  }
+
+
+  void* Arena::allocate(size_t n) {
+    n = (n + 7) & ~static_cast<size_t>(7);  // keep allocations 8-aligned
+    std::lock_guard<std::mutex> lg(lock);
+    if (blocks.empty() || blocks.back().used + n > blocks.back().size) {
+      size_t sz = (n > BLOCK_SIZE)? n : BLOCK_SIZE;
+      blocks.push_back(Block { dt::malloc<void>(sz), sz, 0 });
+    }
+    Block& b = blocks.back();
+    void* res = static_cast<char*>(b.data) + b.used;
+    b.used += n;
+    nlive++;
+    return res;
+  }
+
+
+  void Arena::release() {
+    std::lock_guard<std::mutex> lg(lock);
+    if (--nlive == 0) {
+      // Bulk release: rewind the first block for reuse, drop the others.
+      while (blocks.size() > 1) {
+        std::free(blocks.back().data);
+        blocks.pop_back();
+      }
+      if (!blocks.empty()) blocks.front().used = 0;
+    }
+  }
+
+
+  Arena& Arena::local() {
+    static thread_local Arena arena;
+    return arena;
+  }
+
+
+  ArenaMRI::ArenaMRI(size_t n) {
+    arena = nullptr;
+    resizable = false;
+    if (n) {
+      arena = &Arena::local();
+      bufdata = arena->allocate(n);
+      bufsize = n;
+    }
+  }
+
+  ArenaMRI::~ArenaMRI() {
+    clear_pyobjects();
+    if (arena) arena->release();
+  }
+
+  size_t ArenaMRI::memory_footprint() const {
+    return sizeof(ArenaMRI) + bufsize;
+  }
+
+
+
+
 //==============================================================================
 // Template instantiations
 //==============================================================================
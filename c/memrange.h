@@ -7,9 +7,13 @@
 //------------------------------------------------------------------------------
 #ifndef dt_MEMRANGE_h
 #define dt_MEMRANGE_h
+#include <functional>         // std::function
 #include <string>             // std::string
 #include <type_traits>        // std::is_same
+#include <utility>            // std::pair
+#include <vector>             // std::vector
 #include <Python.h>
+#include "mmm.h"              // MmmAdvice
 #include "utils/assert.h"
 #include "utils/exceptions.h"
 #include "writebuf.h"
@@ -88,7 +92,11 @@ class MemoryRange
     // MemoryRange::mem(n)
     //   Allocate memory region of size `n` in memory (on the heap). The memory
     //   will be freed when the MemoryRange object goes out of scope (assuming
-    //   no shallow copies were created).
+    //   no shallow copies were created). On Linux, if the option
+    //   `memory.hugepage_threshold` is nonzero and `n` is at least that big,
+    //   the buffer is instead carved out of an anonymous memory map marked
+    //   with MADV_HUGEPAGE, so that the kernel may back it with transparent
+    //   huge pages (fewer TLB misses during random-access scans).
     //
     // MemoryRange::acquire(ptr, n)
     //   Create MemoryRange from an existing pointer `ptr` to a memory buffer
@@ -125,16 +133,36 @@ class MemoryRange
     //   over-allocated for `nextra` bytes above the size of the file. This is
     //   used mostly in fread.
     //
+    // MemoryRange::computed(n, fn)
+    //   Create a "lazy" MemoryRange of size `n`: no memory is allocated and
+    //   `fn` is not invoked until the first time the data is accessed. At
+    //   that point a buffer of `n` bytes is allocated, `fn(buf)` is called
+    //   once to fill it, and the function object (together with whatever
+    //   resources it captured) is released. This mirrors how memory-mapped
+    //   ranges materialize on first access.
+    //
+    // MemoryRange::scratch(n)
+    //   Allocate `n` bytes from a thread-local arena, via a cheap
+    //   bump-pointer instead of the global allocator. Intended for transient
+    //   scratch buffers inside a single operation (sorting, expression
+    //   evaluation): the arena's memory is reclaimed in bulk once the last
+    //   scratch buffer drawn from it is released. A scratch MemoryRange may
+    //   be released from any thread, but must not outlive the thread that
+    //   allocated it, and is not resizable.
+    //
     static MemoryRange mem(size_t n);
     static MemoryRange mem(int64_t n);
     static MemoryRange acquire(void* ptr, size_t n);
     static MemoryRange external(const void* ptr, size_t n);
     static MemoryRange external(const void* ptr, size_t n, Py_buffer* pybuf);
     static MemoryRange view(MemoryRange& src, size_t n, size_t offset);
+    static MemoryRange shmem(const std::string& name);
     static MemoryRange mmap(const std::string& path);
     static MemoryRange mmap(const std::string& path, size_t n, int fd = -1);
     static MemoryRange overmap(const std::string& path, size_t nextra,
                                int fd = -1);
+    static MemoryRange computed(size_t n, std::function<void(void*)> fn);
+    static MemoryRange scratch(size_t n);
 
     // Basic properties of the MemoryRange:
     //
@@ -167,12 +195,32 @@ class MemoryRange
     //   includes the size of the memory buffer itself, plus the sizes of all
     //   auxiliary variables.
     //
+    // resource_type()
+    //   Short name of the resource backing this buffer: "ram", "hugemem",
+    //   "mmap", "view", "ext", "shmem", etc. For introspection only.
+    //
+    // share_count()
+    //   Number of MemoryRange objects currently sharing this buffer. A
+    //   value above 1 means the data is held copy-on-write and will be
+    //   duplicated on the first write through any of the sharers.
+    //
+    // resident_size()
+    //   Number of bytes of the buffer currently resident in physical
+    //   memory, probed page-by-page with mincore(). This is smaller than
+    //   `size()` for memory-mapped files that have not been fully paged
+    //   in, or for regions that were swapped out / reclaimed (see
+    //   `DataTable::release_memory`). On platforms without mincore() the
+    //   full size is reported.
+    //
     size_t size() const;
     operator bool() const;
     bool is_writable() const;
     bool is_resizable() const;
     bool is_pyobjects() const;
     size_t memory_footprint() const;
+    const char* resource_type() const;
+    size_t share_count() const;
+    size_t resident_size() const;
 
     // Main data accessors
     //
@@ -233,17 +281,41 @@ class MemoryRange
     //   (default is true) then the implementation *may* replace the current
     //   data with garbage bytes or it may leave them intact.
     //
+    // reserve(newcap)
+    //   Ensure the buffer has at least `newcap` bytes of allocated capacity
+    //   without changing its size. Subsequent `resize()`s within the
+    //   reserved capacity adjust the size only, with no reallocation and no
+    //   copying -- the amortized-growth primitive behind repeated small
+    //   appends. If the current backend cannot carry spare capacity (it is
+    //   not a plain RAM buffer, or is shared / read-only), the data is
+    //   first materialized into one that can.
+    //
+    // capacity()
+    //   The allocated capacity in bytes: >= size(), with equality unless a
+    //   `reserve()` created slack.
+    //
     // save_to_disk(file, strategy)
     //   Write the content of the memory range to `file`. If the file already
     //   exists, it will be overwritten.
     //
+    // advise(a)
+    //   Declare the expected access pattern for this buffer (see `MmmAdvice`
+    //   in "mmm.h"). For memory-mapped buffers the hint is forwarded to the
+    //   kernel via `madvise()`: `Sequential`/`WillNeed` before a linear scan
+    //   enables aggressive read-ahead, `Random` before a gather disables it,
+    //   and `DontNeed` lets the kernel reclaim the pages of a buffer that
+    //   left the working set. For all other buffer kinds this is a no-op.
+    //   The hint is purely advisory and never affects correctness.
     //
     MemoryRange& set_pyobjects(bool clear_data);
     MemoryRange& resize(size_t newsize, bool keep_data = true);
+    MemoryRange& reserve(size_t newcap);
+    size_t capacity() const;
     void save_to_disk(
       const std::string& file,
       WritableBuffer::Strategy strategy = WritableBuffer::Strategy::Auto
     );
+    void advise(MmmAdvice a) const;
 
     // Utility functions
     //
@@ -257,6 +329,13 @@ class MemoryRange
     PyObject* pyrepr() const;
     void verify_integrity() const;
 
+    // Copy-on-write accounting: the number of times this buffer was deep-
+    // copied by `materialize()`, and the total number of bytes copied. The
+    // counters survive materialization (they are carried over onto the new
+    // buffer), so they accumulate over the buffer's whole history.
+    size_t cow_count() const;
+    size_t cow_bytes() const;
+
   private:
     explicit MemoryRange(BaseMRI* impl);
 
@@ -272,6 +351,44 @@ class MemoryRange
 };
 
 
+//==============================================================================
+// Copy-on-write accounting
+//==============================================================================
+
+namespace dt {
+namespace cow {
+
+  struct Counters {
+    size_t ncopies;       // number of CoW materializations
+    size_t bytes_copied;  // total bytes deep-copied by them
+  };
+
+  /**
+   * RAII tag naming the operation on whose behalf the current thread is
+   * working, e.g. `dt::cow::Operation cowop("reify");`. Any CoW
+   * materialization on this thread while the tag is alive is accounted
+   * under that name. The outermost tag wins: nested tags are ignored, so
+   * low-level primitives may tag themselves without masking their callers.
+   */
+  class Operation {
+    private:
+      bool owner;
+
+    public:
+      Operation(const char* op);
+      ~Operation();
+  };
+
+  // Process-wide totals / per-operation breakdown of all CoW
+  // materializations since start-up (or since the last `reset()`).
+  Counters totals();
+  std::vector<std::pair<std::string, Counters>> by_operation();
+  void reset();
+
+}  // namespace cow
+}  // namespace dt
+
+
 template <> void MemoryRange::set_element(int64_t, PyObject*);
 extern template int32_t MemoryRange::get_element(int64_t) const;
 extern template int64_t MemoryRange::get_element(int64_t) const;
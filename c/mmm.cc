@@ -12,7 +12,9 @@
 
 
 
-MemoryMapManager::MemoryMapManager(size_t nelems) {
+MemoryMapManager::MemoryMapManager(size_t nelems)
+  : total_size(0), budget(0), use_counter(0)
+{
   entries.reserve(nelems);
   entries.push_back(MmmEntry());
 }
@@ -25,14 +27,21 @@ MemoryMapManager* MemoryMapManager::get() {
 
 
 void MemoryMapManager::add_entry(MemoryMapWorker* obj, size_t mmapsize) {
-  entries.push_back(MmmEntry(mmapsize, obj));
+  dt::shared_lock lock(shmutex, /* exclusive = */ true);
+  entries.push_back(MmmEntry(mmapsize, ++use_counter, obj));
   obj->save_entry_index(entries.size() - 1);
+  total_size += mmapsize;
+  if (budget && total_size > budget) {
+    enforce_budget(entries.size() - 1);
+  }
 }
 
 
 // Careful not to throw any exceptions here: this method is called from
 // MmapMRI's destructor, and an uncaught exception will cause SIGABRT.
 void MemoryMapManager::del_entry(size_t i) {
+  dt::shared_lock lock(shmutex, /* exclusive = */ true);
+  total_size -= entries[i].size;
   // Move the last entry into the now-empty slot <i>
   std::swap(entries[i], entries.back());
   entries[i].obj->save_entry_index(i);
@@ -41,19 +50,95 @@ void MemoryMapManager::del_entry(size_t i) {
 
 
 bool MemoryMapManager::check_entry(size_t i, const MemoryMapWorker* obj) {
+  dt::shared_lock lock(shmutex);
+  return check_entry_unlocked(i, obj);
+}
+
+
+bool MemoryMapManager::check_entry_unlocked(
+    size_t i, const MemoryMapWorker* obj) const
+{
   return (i > 0 && i < entries.size() && entries[i].obj == obj);
 }
 
 
+/**
+ * Mark entry <i> as just-used, pushing it to the front of the LRU order.
+ * Called every time a mapped region's pointer is acquired (but only when a
+ * budget is set, see MmapMRI::ptr), so this must stay cheap: a shared lock
+ * plus a plain store of the counter value. The store is unsynchronized
+ * between touching threads; a lost update merely makes the LRU order
+ * slightly stale, which only affects which region is evicted first.
+ */
+void MemoryMapManager::touch_entry(size_t i, const MemoryMapWorker* obj) {
+  dt::shared_lock lock(shmutex);
+  if (i > 0 && i < entries.size() && entries[i].obj == obj) {
+    entries[i].last_used = ++use_counter;
+  }
+}
+
+
+/**
+ * Set the combined-size budget for memory-mapped regions, in bytes (0 to
+ * disable budgeting). When a new mapping pushes the total over the budget,
+ * the least-recently-used regions are unmapped until the total fits again;
+ * re-acquiring an unmapped region's pointer transparently remaps it. This
+ * keeps the resident set of out-of-core workloads bounded, instead of
+ * letting the kernel swap under memory pressure.
+ */
+void MemoryMapManager::set_budget(size_t nbytes) {
+  dt::shared_lock lock(shmutex, /* exclusive = */ true);
+  budget = nbytes;
+  if (budget && total_size > budget) {
+    enforce_budget(0);
+  }
+}
+
+
+/**
+ * Unmap least-recently-used entries until `total_size` fits the budget.
+ * The entry <keep> (the one being added, when called from `add_entry`) is
+ * never evicted, and neither is the last remaining mapping. The caller
+ * must hold the exclusive lock.
+ */
+void MemoryMapManager::enforce_budget(size_t keep) {
+  while (total_size > budget && entries.size() > 2) {
+    size_t victim = 0;
+    for (size_t i = 1; i < entries.size(); ++i) {
+      if (i == keep) continue;
+      if (!victim || entries[i].last_used < entries[victim].last_used) {
+        victim = i;
+      }
+    }
+    if (!victim) break;
+    total_size -= entries[victim].size;
+    // Give the kernel an early heads-up that the pages are expendable,
+    // then unmap. `evict()` zeroes the worker's entry index first, so it
+    // will not call `del_entry()` back into the locked manager.
+    entries[victim].obj->memory_advise(MmmAdvice::DontNeed);
+    entries[victim].obj->evict();
+    if (keep == entries.size() - 1) keep = victim;
+    std::swap(entries[victim], entries.back());
+    entries.pop_back();
+    if (victim < entries.size()) {
+      entries[victim].obj->save_entry_index(victim);
+    }
+  }
+}
+
+
 void MemoryMapManager::freeup_memory() {
+  dt::shared_lock lock(shmutex, /* exclusive = */ true);
   #ifndef NDEBUG
     size_t size0 = entries.size();
   #endif
-  // Sort the entries by size in descending order
+  // Sort the entries by recency of use, so that the least-recently-used
+  // mappings end up at the back of the array
   sort_entries();
-  // Evict the entries at the top of the array
+  // Evict the coldest entries
   for (size_t j = 0; j < n_entries_to_purge; ++j) {
     if (entries.size() <= 1) break;
+    total_size -= entries.back().size;
     entries.back().obj->evict();
     xassert(entries.size() == size0 - j);
     entries.pop_back();
@@ -61,6 +146,14 @@ void MemoryMapManager::freeup_memory() {
 }
 
 
+void MemoryMapManager::advise_all(MmmAdvice a) {
+  dt::shared_lock lock(shmutex);
+  for (size_t i = 1; i < entries.size(); ++i) {
+    entries[i].obj->memory_advise(a);
+  }
+}
+
+
 void MemoryMapManager::sort_entries() {
   std::sort(entries.begin() + 1, entries.end());
   for (size_t i = 1; i < entries.size(); ++i) {
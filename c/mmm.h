@@ -7,7 +7,27 @@
 //------------------------------------------------------------------------------
 #ifndef dt_MMM_h
 #define dt_MMM_h
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
+#include "utils/shared_mutex.h"
+
+
+/**
+ * Expected access pattern for a memory-mapped region. A worker translates
+ * these into `madvise()` calls on its mapping, allowing the kernel to
+ * read-ahead aggressively for sequential scans, to stop read-ahead for
+ * random gathers, and to drop the pages of regions that left the working
+ * set. All hints are advisory: ignoring them is always correct, just slow.
+ */
+enum class MmmAdvice : int {
+  Normal,      // reset to the default kernel policy
+  Sequential,  // region will be scanned once, front to back
+  Random,      // region will be gathered from in arbitrary order
+  WillNeed,    // region will be needed soon: prefetch it
+  DontNeed,    // region left the working set: its pages may be reclaimed
+};
 
 
 class MemoryMapWorker {
@@ -15,37 +35,65 @@ public:
   virtual ~MemoryMapWorker();
   virtual void save_entry_index(size_t i) = 0;
   virtual void evict() = 0;
+  virtual void memory_advise(MmmAdvice) {}
 };
 
 
 class MmmEntry {
 public:
   size_t size;
+  // LRU stamp: the value of the manager's use counter when the region was
+  // last mapped or touched. Written without synchronization from
+  // `touch_entry()`; a lost update merely perturbs the eviction order.
+  uint64_t last_used;
   MemoryMapWorker* obj;
 
-  MmmEntry() : size(0), obj(nullptr) {}
+  MmmEntry() : size(0), last_used(0), obj(nullptr) {}
   MmmEntry(MmmEntry&&) = default;
   MmmEntry& operator=(MmmEntry&&) = default;
-  MmmEntry(size_t s , MemoryMapWorker* o) : size(s), obj(o) {}
-  ~MmmEntry() { size = 0; obj = nullptr; }
-  bool operator<(const MmmEntry& rhs) const { return size > rhs.size; }
+  MmmEntry(size_t s, uint64_t t, MemoryMapWorker* o)
+    : size(s), last_used(t), obj(o) {}
+  ~MmmEntry() { size = 0; last_used = 0; obj = nullptr; }
+  // Order by recency of use, most recent first, so that after sorting the
+  // least-recently-used entries are at the back of the array.
+  bool operator<(const MmmEntry& rhs) const {
+    return last_used > rhs.last_used;
+  }
 };
 
 
 class MemoryMapManager {
   std::vector<MmmEntry> entries;  // 0th entry always remains empty.
+  size_t total_size;   // combined size of all registered mappings
+  size_t budget;       // resident-size budget in bytes; 0 = unlimited
+  std::atomic<uint64_t> use_counter;  // source of the entries' LRU stamps
+  // The manager is a process-wide singleton, and once the GIL is released
+  // around native phases, mapped buffers get created and destroyed from
+  // several threads at once. Registration and eviction take the mutex
+  // exclusively; the read-only queries take it shared.
+  dt::shared_mutex shmutex;
 
 public:
   static MemoryMapManager* get();
   void add_entry(MemoryMapWorker* obj, size_t size);
   void del_entry(size_t i);
+  void touch_entry(size_t i, const MemoryMapWorker* obj);
+  void set_budget(size_t nbytes);
+  bool has_budget() const { return budget != 0; }
   void freeup_memory();
+  void advise_all(MmmAdvice a);
   bool check_entry(size_t i, const MemoryMapWorker* obj);
+  // Same check without taking `shmutex`: for use from code that is already
+  // running under the manager's lock (e.g. callbacks invoked by the
+  // manager itself), where re-locking the non-recursive mutex would
+  // self-deadlock.
+  bool check_entry_unlocked(size_t i, const MemoryMapWorker* obj) const;
 
 private:
   static const size_t n_entries_to_purge = 128;
   MemoryMapManager(size_t nelems);
   void sort_entries();
+  void enforce_budget(size_t keep);  // requires exclusive lock being held
 };
 
 
@@ -7,7 +7,16 @@
 //------------------------------------------------------------------------------
 #define dt_OPTIONS_cc
 #include "options.h"
+#ifdef __linux__
+  #include <pthread.h>  // pthread_setaffinity_np
+  #include <sched.h>    // cpu_set_t, CPU_SET
+  #include <unistd.h>   // sysconf
+#endif
+#include <atomic>
+#include "mmm.h"
+#include "perf.h"
 #include "python/obj.h"
+#include "utils/alloc.h"
 #include "utils/omp.h"
 
 
@@ -22,9 +31,47 @@ size_t sort_max_chunk_length = 1 << 20;
 int8_t sort_max_radix_bits = 16;
 int8_t sort_over_radix_bits = 16;
 int32_t sort_nthreads = 1;
+// Sort scratch buffers of at least this many bytes are spilled to temporary
+// memory-mapped files instead of RAM; 0 disables spilling.
+size_t sort_spill_threshold = 0;
 bool fread_anonymize = false;
+// Compression parameter of the t-digest sketches used for approximate
+// quantile stats: higher values give more accurate quantiles at the cost
+// of a proportionally larger sketch. The default is sufficient for about
+// 3 significant digits at the quartiles.
+size_t stats_quantile_compression = 200;
+// When true, the NUnique stat of numeric columns is computed with a
+// hash-set / HyperLogLog scan instead of a full sort: exact for low
+// cardinalities, ~0.8% relative error otherwise.
+bool stats_nunique_approx = false;
+// Allocations of at least this many bytes are backed by anonymous memory
+// maps marked MADV_HUGEPAGE (Linux only); 0 disables huge-page backing.
+size_t memory_hugepage_threshold = 0;
+// When true, large fresh allocations are page-touched from all OpenMP
+// threads in a static round-robin, so that on a NUMA machine the pages are
+// spread across the nodes the threads run on (kernel first-touch policy)
+// instead of all landing on the allocating thread's node.
+bool memory_first_touch = false;
 int64_t frame_names_auto_index = 0;
 std::string frame_names_auto_prefix = "C";
+// When true, newly created view columns are materialized eagerly on a
+// background thread (see Column::reify_async), overlapping the reify()
+// cost with Python-side think time instead of paying it on first access.
+bool view_materialize_async = false;
+// Governs when view columns created by row filtering / slicing are
+// materialized (see columns_from_slice): Lazy keeps them as views until
+// first access (the default), Eager reifies them immediately, and Auto
+// decides per selection based on its size and selectivity.
+MaterializationPolicy view_materialization = MaterializationPolicy::Lazy;
+// When true, plain (uncompressed, tailless) Jay columns are copied out of
+// the file on first access so that their stored checksum can be verified;
+// compressed and appended-to columns always verify, since they copy anyway.
+bool jay_verify_checksums = false;
+// Colon-separated list of path prefixes that reside on storage with poor
+// random-read performance (e.g. an HDD tier). Files under these prefixes
+// are not memory-mapped directly: see MemoryRange::mmap.
+std::string memory_sequential_paths = "";
+static std::vector<std::string> sequential_path_list;
 
 
 int32_t normalize_nthreads(int32_t nth) {
@@ -50,6 +97,24 @@ void set_nthreads(int32_t n) {
 }
 
 
+// Number of budget threads currently claimed by running kernels, *not*
+// counting the claiming threads themselves (so an idle process is at 0,
+// and a single kernel using the full budget is at `nthreads - 1`).
+static std::atomic<int32_t> threads_claimed(0);
+
+int32_t acquire_thread_grant(int32_t nwanted) {
+  int32_t avail = nthreads - threads_claimed.load(std::memory_order_relaxed);
+  if (avail < 1) avail = 1;
+  int32_t grant = (nwanted <= 0 || nwanted > avail)? avail : nwanted;
+  threads_claimed.fetch_add(grant - 1, std::memory_order_relaxed);
+  return grant;
+}
+
+void release_thread_grant(int32_t ngranted) {
+  threads_claimed.fetch_sub(ngranted - 1, std::memory_order_relaxed);
+}
+
+
 void set_core_logger(PyObject* o) {
   if (o == Py_None) {
     logger = nullptr;
@@ -90,10 +155,92 @@ void set_sort_nthreads(int32_t n) {
   sort_nthreads = normalize_nthreads(n);
 }
 
+void set_sort_spill_threshold(int64_t n) {
+  if (n < 0) n = 0;
+  sort_spill_threshold = static_cast<size_t>(n);
+}
+
 void set_fread_anonymize(int8_t v) {
   fread_anonymize = v;
 }
 
+void set_stats_quantile_compression(int64_t n) {
+  if (n < 20)
+    throw ValueError() << "Invalid stats.quantile_compression parameter: " << n;
+  stats_quantile_compression = static_cast<size_t>(n);
+}
+
+void set_memory_hugepage_threshold(int64_t n) {
+  if (n < 0) n = 0;
+  memory_hugepage_threshold = static_cast<size_t>(n);
+}
+
+void set_memory_mmap_budget(int64_t n) {
+  if (n < 0) n = 0;
+  MemoryMapManager::get()->set_budget(static_cast<size_t>(n));
+}
+
+void set_view_materialization(const std::string& policy) {
+  if (policy == "lazy") {
+    view_materialization = MaterializationPolicy::Lazy;
+  } else if (policy == "eager") {
+    view_materialization = MaterializationPolicy::Eager;
+  } else if (policy == "auto") {
+    view_materialization = MaterializationPolicy::Auto;
+  } else {
+    throw ValueError() << "Invalid value `" << policy << "` for option "
+        "`view.materialization`: must be one of \"lazy\", \"eager\" or "
+        "\"auto\"";
+  }
+}
+
+void set_memory_sequential_paths(const std::string& paths) {
+  memory_sequential_paths = paths;
+  sequential_path_list.clear();
+  size_t start = 0;
+  while (start <= paths.size()) {
+    size_t end = paths.find(':', start);
+    if (end == std::string::npos) end = paths.size();
+    if (end > start) {
+      sequential_path_list.push_back(paths.substr(start, end - start));
+    }
+    start = end + 1;
+  }
+}
+
+bool is_sequential_path(const std::string& path) {
+  for (const std::string& prefix : sequential_path_list) {
+    if (path.compare(0, prefix.size(), prefix) == 0) return true;
+  }
+  return false;
+}
+
+/**
+ * Pin each OpenMP thread to a single CPU (or release the pinning if `v` is
+ * false). Pinned threads keep running on the same core / NUMA node, which
+ * makes the first-touch page placement (see `memory_first_touch`) stable
+ * across parallel regions. Only effective on Linux; a no-op elsewhere.
+ */
+void set_thread_affinity(int8_t v) {
+  #ifdef __linux__
+    int ncpus = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+    if (ncpus <= 0) return;
+    #pragma omp parallel
+    {
+      cpu_set_t cpuset;
+      CPU_ZERO(&cpuset);
+      if (v) {
+        CPU_SET(omp_get_thread_num() % ncpus, &cpuset);
+      } else {
+        for (int i = 0; i < ncpus; ++i) CPU_SET(i, &cpuset);
+      }
+      pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+    }
+  #else
+    (void) v;
+  #endif
+}
+
 
 
 PyObject* set_option(PyObject*, PyObject* args) {
@@ -125,12 +272,54 @@ PyObject* set_option(PyObject*, PyObject* args) {
   } else if (name == "sort.nthreads") {
     set_sort_nthreads(value.to_int32_strict());
 
+  } else if (name == "sort.spill_threshold") {
+    set_sort_spill_threshold(value.to_int64_strict());
+
   } else if (name == "core_logger") {
     set_core_logger(py::oobj(value).release());
 
   } else if (name == "fread.anonymize") {
     set_fread_anonymize(value.to_bool_strict());
 
+  } else if (name == "stats.quantile_compression") {
+    set_stats_quantile_compression(value.to_int64_strict());
+
+  } else if (name == "stats.nunique_approx") {
+    stats_nunique_approx = value.to_bool_strict();
+
+  } else if (name == "memory.hugepage_threshold") {
+    set_memory_hugepage_threshold(value.to_int64_strict());
+
+  } else if (name == "memory.mmap_budget") {
+    set_memory_mmap_budget(value.to_int64_strict());
+
+  } else if (name == "memory.sequential_paths") {
+    set_memory_sequential_paths(value.to_string());
+
+  } else if (name == "memory.first_touch") {
+    memory_first_touch = value.to_bool_strict();
+
+  } else if (name == "memory.alloc_trace") {
+    dt::alloctrace::enabled = value.to_bool_strict();
+
+  } else if (name == "view.materialize_async") {
+    view_materialize_async = value.to_bool_strict();
+
+  } else if (name == "view.materialization") {
+    set_view_materialization(value.to_string());
+
+  } else if (name == "jay.verify_checksums") {
+    jay_verify_checksums = value.to_bool_strict();
+
+  } else if (name == "perf.track") {
+    dt::perf::enabled = value.to_bool_strict();
+
+  } else if (name == "perf.hw_counters") {
+    dt::perf::hw_counters = value.to_bool_strict();
+
+  } else if (name == "thread_affinity") {
+    set_thread_affinity(value.to_bool_strict());
+
   } else if (name == "frame.names_auto_index") {
     frame_names_auto_index = value.to_int64_strict();
 
@@ -21,12 +21,59 @@ extern size_t sort_max_chunk_length;
 extern int8_t sort_max_radix_bits;
 extern int8_t sort_over_radix_bits;
 extern int32_t sort_nthreads;
+extern size_t sort_spill_threshold;
 extern bool fread_anonymize;
+extern size_t stats_quantile_compression;
+extern bool stats_nunique_approx;
+extern size_t memory_hugepage_threshold;
+extern bool memory_first_touch;
 extern int64_t frame_names_auto_index;
 extern std::string frame_names_auto_prefix;
+extern bool view_materialize_async;
+enum class MaterializationPolicy : int8_t { Lazy, Eager, Auto };
+extern MaterializationPolicy view_materialization;
+extern bool jay_verify_checksums;
+extern std::string memory_sequential_paths;
 
 int32_t normalize_nthreads(int32_t nth);
 void set_nthreads(int32_t n);
+
+/**
+ * Thread-budget manager: kernels that spawn a parallel region ask for a
+ * grant out of the global `nthreads` budget, so that composed operations
+ * (a parallel cast inside fread's type-bumping, per-group work inside a
+ * groupby) share the machine instead of multiplying team sizes.
+ *
+ * `acquire_thread_grant(nwanted)` returns how many threads the caller may
+ * use: at most `nwanted` (pass -1 or 0 for "as many as available"), at
+ * most what remains unclaimed of the budget, and always at least 1 --
+ * when the budget is exhausted the caller simply runs serially on its own
+ * thread. The caller's own thread is part of the grant, so an outermost
+ * kernel gets the full budget. Every acquire must be paired with a
+ * `release_thread_grant()` of the same amount; the RAII `thread_grant`
+ * wrapper below is the usual way to guarantee that.
+ *
+ * The accounting is advisory and intentionally racy-but-benign: two
+ * kernels acquiring simultaneously may briefly overcommit by a few
+ * threads, which is harmless; what the budget prevents is the systematic
+ * NxN explosion of unconstrained nesting.
+ */
+int32_t acquire_thread_grant(int32_t nwanted);
+void release_thread_grant(int32_t ngranted);
+
+class thread_grant {
+  public:
+    explicit thread_grant(int32_t nwanted = -1)
+      : granted(acquire_thread_grant(nwanted)) {}
+    ~thread_grant() { release_thread_grant(granted); }
+    thread_grant(const thread_grant&) = delete;
+    thread_grant& operator=(const thread_grant&) = delete;
+    int32_t nthreads() const { return granted; }
+  private:
+    int32_t granted;
+    int : 32;
+};
+
 void set_core_logger(PyObject*);
 void set_sort_insert_method_threshold(int64_t n);
 void set_sort_thread_multiplier(int64_t n);
@@ -34,7 +81,15 @@ void set_sort_max_chunk_length(int64_t n);
 void set_sort_max_radix_bits(int64_t n);
 void set_sort_over_radix_bits(int64_t n);
 void set_sort_nthreads(int32_t n);
+void set_sort_spill_threshold(int64_t n);
 void set_fread_anonymize(int8_t v);
+void set_stats_quantile_compression(int64_t n);
+void set_memory_hugepage_threshold(int64_t n);
+void set_memory_mmap_budget(int64_t n);
+void set_memory_sequential_paths(const std::string& paths);
+bool is_sequential_path(const std::string& path);
+void set_thread_affinity(int8_t v);
+void set_view_materialization(const std::string& policy);
 
 
 DECLARE_FUNCTION(
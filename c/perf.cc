@@ -0,0 +1,167 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include "perf.h"
+#include <algorithm>  // std::sort
+#include <atomic>
+#include <chrono>
+#include <cstring>    // std::memset
+#ifdef __linux__
+  #include <linux/perf_event.h>
+  #include <sys/syscall.h>    // __NR_perf_event_open
+  #include <unistd.h>         // syscall, read
+#endif
+
+namespace dt {
+namespace perf {
+
+bool enabled = false;
+bool hw_counters = false;
+
+// The ring is a seqlock-lite: a writer claims a slot with one atomic
+// increment, fills the payload, and publishes the sequence number last
+// (release). A reader accepts a slot only if the sequence number is the
+// same non-zero value before and after copying the payload, so a record
+// that is being overwritten concurrently is simply skipped.
+static std::atomic<int64_t> seq_counter { 0 };
+static Record ring[RING_SIZE];
+static std::atomic<int64_t> ring_seq[RING_SIZE];
+
+
+//------------------------------------------------------------------------------
+// Hardware counters (perf_event, Linux only)
+//------------------------------------------------------------------------------
+
+#ifdef __linux__
+
+static int open_counter(uint64_t config) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = config;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  // Follow threads created after the counter is opened, so that OpenMP
+  // worker threads are included in the aggregate.
+  attr.inherit = 1;
+  return static_cast<int>(
+      syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+// -2 = not opened yet, -1 = perf_event unavailable (permissions, VM, ...)
+static int cachemiss_fd = -2;
+static int branchmiss_fd = -2;
+
+static void ensure_counters_open() {
+  if (cachemiss_fd != -2) return;
+  cachemiss_fd = open_counter(PERF_COUNT_HW_CACHE_MISSES);
+  branchmiss_fd = open_counter(PERF_COUNT_HW_BRANCH_MISSES);
+}
+
+static int64_t read_counter(int fd) {
+  if (fd < 0) return -1;
+  uint64_t value = 0;
+  if (::read(fd, &value, sizeof(value)) != sizeof(value)) return -1;
+  return static_cast<int64_t>(value);
+}
+
+#else
+
+static void ensure_counters_open() {}
+static int64_t read_counter(int) { return -1; }
+static constexpr int cachemiss_fd = -1;
+static constexpr int branchmiss_fd = -1;
+
+#endif
+
+
+static int64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int64_t clock_ns() {
+  return now_ns();
+}
+
+
+OpTimer::OpTimer(const char* op_)
+  : op(op_), t0(0), bytes(0), cm0(-1), bm0(-1), busy_total(0), busy_max(0),
+    nthreads(0), nchunks(0), alloc_tag(op_), active(enabled)
+{
+  if (active) {
+    if (hw_counters) {
+      ensure_counters_open();
+      cm0 = read_counter(cachemiss_fd);
+      bm0 = read_counter(branchmiss_fd);
+    }
+    t0 = now_ns();
+  }
+}
+
+
+void OpTimer::add_thread_busy(int64_t ns) {
+  busy_total.fetch_add(ns, std::memory_order_relaxed);
+  int64_t prev = busy_max.load(std::memory_order_relaxed);
+  while (ns > prev &&
+         !busy_max.compare_exchange_weak(prev, ns,
+                                         std::memory_order_relaxed)) {}
+}
+
+
+OpTimer::~OpTimer() {
+  if (!active) return;
+  int64_t elapsed = now_ns() - t0;
+  int64_t cmisses = (cm0 >= 0)? read_counter(cachemiss_fd) - cm0 : -1;
+  int64_t bmisses = (bm0 >= 0)? read_counter(branchmiss_fd) - bm0 : -1;
+  int64_t s = seq_counter.fetch_add(1, std::memory_order_relaxed) + 1;
+  size_t slot = static_cast<size_t>(s - 1) % RING_SIZE;
+  ring_seq[slot].store(0, std::memory_order_release);
+  Record& r = ring[slot];
+  r.seq = s;
+  r.walltime_ns = elapsed;
+  r.bytes = bytes;
+  r.cache_misses = cmisses;
+  r.branch_misses = bmisses;
+  r.busy_total_ns = busy_total.load(std::memory_order_relaxed);
+  r.busy_max_ns = busy_max.load(std::memory_order_relaxed);
+  r.nthreads = nthreads;
+  r.nchunks = nchunks;
+  r.op = op;
+  ring_seq[slot].store(s, std::memory_order_release);
+}
+
+
+std::vector<Record> records() {
+  std::vector<Record> res;
+  res.reserve(RING_SIZE);
+  for (size_t i = 0; i < RING_SIZE; ++i) {
+    int64_t s1 = ring_seq[i].load(std::memory_order_acquire);
+    if (!s1) continue;
+    Record r = ring[i];
+    int64_t s2 = ring_seq[i].load(std::memory_order_acquire);
+    if (s1 != s2) continue;
+    r.seq = s1;
+    res.push_back(r);
+  }
+  std::sort(res.begin(), res.end(),
+            [](const Record& a, const Record& b) { return a.seq < b.seq; });
+  return res;
+}
+
+
+void reset() {
+  for (size_t i = 0; i < RING_SIZE; ++i) {
+    ring_seq[i].store(0, std::memory_order_release);
+  }
+  seq_counter.store(0, std::memory_order_relaxed);
+}
+
+
+}  // namespace perf
+}  // namespace dt
@@ -0,0 +1,106 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_PERF_h
+#define dt_PERF_h
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "utils/alloc.h"   // alloctrace::Tag
+
+namespace dt {
+namespace perf {
+
+  // Toggled via `options.perf.track`; off by default, so that instrumented
+  // operations pay nothing but a single branch.
+  extern bool enabled;
+
+  // Toggled via `options.perf.hw_counters`: when also tracking, each record
+  // additionally carries hardware cache-miss / branch-miss deltas obtained
+  // from the kernel's perf_event interface (Linux only). Enable this early:
+  // the counters follow threads created after they are opened, so worker
+  // threads spawned before the first tracked operation are not counted.
+  extern bool hw_counters;
+
+  // Number of most recent operations retained; older entries are
+  // overwritten in ring-buffer fashion.
+  constexpr size_t RING_SIZE = 256;
+
+  struct Record {
+    int64_t seq;          // global completion order, starting from 1
+    int64_t walltime_ns;
+    int64_t bytes;        // bytes touched, as reported by the operation
+    int64_t cache_misses;   // -1 when hardware counters are unavailable
+    int64_t branch_misses;  // -1 when hardware counters are unavailable
+    int64_t busy_total_ns;  // sum of per-thread busy times (0 if unreported)
+    int64_t busy_max_ns;    // busiest thread's busy time (0 if unreported)
+    int32_t nthreads;     // threads used (0 when not reported)
+    int32_t nchunks;      // parallel chunks / groups (0 when not reported)
+    const char* op;       // static name: "sort", "groupby", "fread", ...
+  };
+
+  /**
+   * RAII timer for one instrumented operation:
+   *
+   *   perf::OpTimer optimer("sort");
+   *   optimer.set_bytes(...);     // optional details, any time before
+   *   optimer.set_nthreads(...);  // the timer goes out of scope
+   *
+   * The destructor publishes the record into the process-wide ring buffer.
+   * When tracking is off at construction time the timer is inert, so the
+   * per-operation overhead is one branch plus, when enabled, two clock
+   * reads and one atomic increment.
+   */
+  class OpTimer {
+    public:
+      explicit OpTimer(const char* op_);
+      ~OpTimer();
+      OpTimer(const OpTimer&) = delete;
+      OpTimer& operator=(const OpTimer&) = delete;
+
+      void set_bytes(int64_t n)    { bytes = n; }
+      void set_nthreads(int32_t n) { nthreads = n; }
+      void set_nchunks(int32_t n)  { nchunks = n; }
+      bool is_active() const       { return active; }
+
+      // Report how long one worker thread was busy inside this
+      // operation's parallel region(s). May be called concurrently from
+      // multiple threads; the record then carries the total and the
+      // maximum, from which an imbalance metric max/mean is derived.
+      void add_thread_busy(int64_t ns);
+
+    private:
+      const char* op;
+      int64_t t0;
+      int64_t bytes;
+      int64_t cm0;   // hardware counter values at construction time,
+      int64_t bm0;   // or -1 when counting is off / unavailable
+      std::atomic<int64_t> busy_total;
+      std::atomic<int64_t> busy_max;
+      int32_t nthreads;
+      int32_t nchunks;
+      // Attribute allocations made while the timer is alive to this
+      // operation (see utils/alloc.h)
+      alloctrace::Tag alloc_tag;
+      bool active;
+      int64_t : 56;
+  };
+
+  // Monotonic clock used by the timers, in nanoseconds. Exposed so that
+  // kernels measuring their own per-thread busy time use the same clock.
+  int64_t clock_ns();
+
+  // Snapshot of the ring, oldest to newest. Entries that are being
+  // overwritten concurrently are skipped rather than returned torn.
+  std::vector<Record> records();
+  void reset();
+
+}  // namespace perf
+}  // namespace dt
+
+#endif
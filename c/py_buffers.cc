@@ -17,9 +17,11 @@
 #include "py_datatable.h"
 #include "py_types.h"
 #include "py_utils.h"
+#include "options.h"
 #include "python/obj.h"
 #include "utils/assert.h"
 #include "utils/exceptions.h"
+#include "utils/omp.h"
 
 // Forward declarations
 static Column* try_to_resolve_object_column(Column* col);
@@ -107,7 +109,11 @@ Column* Column::from_buffer(const py::obj& obuffer)
   Column* res = nullptr;
   if (stype == SType::STR32) {
     res = convert_fwchararray_to_column(view);
-  } else if (view->strides == nullptr) {
+  } else if (view->strides == nullptr ||
+             view->strides[0] == view->itemsize) {
+    // The buffer's layout matches ours exactly: wrap it zero-copy. The
+    // second condition catches exporters that only support the
+    // PyBUF_STRIDES request but whose data is nevertheless contiguous.
     res = Column::new_xbuf_column(stype, nrows, view);
   } else {
     res = Column::new_data_column(stype, nrows);
@@ -149,55 +155,167 @@ static Column* convert_fwchararray_to_column(Py_buffer* view)
   int64_t stride = view->strides? view->strides[0]/4 : k;
   uint32_t* input = reinterpret_cast<uint32_t*>(view->buf);
 
-  size_t maxsize = static_cast<size_t>(view->len);
-  MemoryRange strbuf = MemoryRange::mem(maxsize);
   MemoryRange offbuf = MemoryRange::mem((nrows + 1) * 4);
-  char* strptr = static_cast<char*>(strbuf.wptr());
-  uint32_t* offptr = static_cast<uint32_t*>(offbuf.wptr());
-  *offptr++ = 0;
-  uint32_t offset = 0;
+  uint32_t* offsets = static_cast<uint32_t*>(offbuf.wptr());
+  offsets[0] = 0;
+
+  // Pass 1 (parallel): compute the UTF-8 length of each element; a serial
+  // prefix sum then turns the lengths into offsets, so that the string
+  // buffer can be allocated exactly-sized up front.
+  #pragma omp parallel for schedule(static)
   for (int64_t j = 0; j < nrows; ++j) {
     uint32_t* start = input + j*stride;
-    int64_t bytes_len = utf32_to_utf8(start, k, strptr);
-    offset += bytes_len;
-    strptr += bytes_len;
-    *offptr++ = offset;
+    int64_t len = 0;
+    for (int64_t t = 0; t < k; ++t) {
+      uint32_t code = start[t];
+      if (!code) break;
+      len += 1 + (code > 0x7F) + (code > 0x7FF) + (code > 0xFFFF);
+    }
+    offsets[j + 1] = static_cast<uint32_t>(len);
+  }
+  uint32_t total = 0;
+  for (int64_t j = 1; j <= nrows; ++j) {
+    total += offsets[j];
+    offsets[j] = total;
+  }
+
+  // Pass 2 (parallel): each element is encoded into its own slot of the
+  // string buffer, at the offset computed above.
+  MemoryRange strbuf = MemoryRange::mem(static_cast<size_t>(total));
+  char* strptr = static_cast<char*>(strbuf.wptr());
+  #pragma omp parallel for schedule(static)
+  for (int64_t j = 0; j < nrows; ++j) {
+    utf32_to_utf8(input + j*stride, k, strptr + offsets[j]);
   }
 
-  strbuf.resize(static_cast<size_t>(offset));
   return new StringColumn<uint32_t>(nrows, std::move(offbuf), std::move(strbuf));
 }
 
 
 
+/**
+ * Convert a column of Py_None / exact ints into the given integer stype.
+ * The caller guarantees that every value fits into T.
+ */
+template <typename T>
+static Column* convert_pyint_column(PyObject* const* data, int64_t nrows,
+                                    SType stype)
+{
+  Column* out = Column::new_data_column(stype, nrows);
+  T* vals = static_cast<T*>(out->data_w());
+  for (int64_t i = 0; i < nrows; ++i) {
+    PyObject* p = data[i];
+    if (p == Py_None) {
+      vals[i] = GETNA<T>();
+    } else {
+      int overflow = 0;
+      vals[i] = static_cast<T>(PyLong_AsInt64AndOverflow(p, &overflow));
+    }
+  }
+  return out;
+}
+
+
 /**
  * If a column was created from Pandas series, it may end up having
- * dtype='object' (because Pandas doesn't support string columns). This function
- * will attempt to convert such column to the string type (or some other type
- * if more appropriate), and return either the original or the new modified
- * column. If a new column is returned, the original one is decrefed.
+ * dtype='object' (because Pandas doesn't support string columns, and
+ * sometimes stores plain numbers in object arrays too). This function
+ * will attempt to convert such column to a native type, and return either
+ * the original or the new modified column. If a new column is returned,
+ * the original one is deleted.
+ *
+ * The conversion is batched: a single classification pass tallies the
+ * types of all elements (exact-type checks only -- one field comparison
+ * each), and then a single type-specific bulk loop converts the whole
+ * column: to BOOL if all elements are bools, to the smallest suitable
+ * integer stype if all are ints, to FLOAT64 for ints mixed with floats,
+ * or to STR32 if all are strings (Nones are allowed everywhere). Columns
+ * with any other content, or with strings mixed with numbers, are
+ * returned unmodified.
  */
 static Column* try_to_resolve_object_column(Column* col)
 {
   PyObject* const* data = static_cast<PyObject* const*>(col->data());
   int64_t nrows = col->nrows;
 
-  int all_strings = 1;
+  // Single classification pass over the column.
+  int64_t nbools = 0, nints = 0, nfloats = 0, nstrs = 0;
+  bool int_overflow = false;
+  int64_t vmin = 0, vmax = 0;
   // Approximate total length of all strings. Do not take into account
   // possibility that the strings may expand in UTF-8 -- if needed, we'll
   // realloc the buffer later.
   int64_t total_length = 10;
   for (int64_t i = 0; i < nrows; ++i) {
-    if (data[i] == Py_None) continue;
-    if (!PyUnicode_Check(data[i])) {
-      all_strings = 0;
-      break;
+    PyObject* p = data[i];
+    if (p == Py_None) continue;
+    if (p == Py_True || p == Py_False) {
+      nbools++;
+    } else if (PyLong_CheckExact(p)) {
+      int overflow = 0;
+      int64_t x = PyLong_AsInt64AndOverflow(p, &overflow);
+      if (overflow) int_overflow = true;
+      else if (!nints) { vmin = vmax = x; }
+      else if (x < vmin) vmin = x;
+      else if (x > vmax) vmax = x;
+      nints++;
+    } else if (PyFloat_CheckExact(p)) {
+      nfloats++;
+    } else if (PyUnicode_Check(p)) {
+      nstrs++;
+      total_length += PyUnicode_GetLength(p);
+    } else {
+      // Unconvertible element => the column remains OBJ
+      return col;
     }
-    total_length += PyUnicode_GetLength(data[i]);
   }
 
-  // Not all elements were strings -- return the original column unmodified
-  if (!all_strings) {
+  bool any_numeric = nbools || nints || nfloats;
+  if (nstrs && any_numeric) return col;
+  if (int_overflow) return col;
+
+  if (nbools && !nints && !nfloats) {
+    Column* out = Column::new_data_column(SType::BOOL, nrows);
+    int8_t* vals = static_cast<int8_t*>(out->data_w());
+    for (int64_t i = 0; i < nrows; ++i) {
+      PyObject* p = data[i];
+      vals[i] = (p == Py_None)? GETNA<int8_t>() : (p == Py_True);
+    }
+    delete col;
+    return out;
+  }
+  if (nints && !nbools && !nfloats) {
+    // Integer bounds are symmetric: the smallest value is the NA sentinel.
+    Column* out =
+      (vmin >= -127 && vmax <= 127)?
+          convert_pyint_column<int8_t>(data, nrows, SType::INT8) :
+      (vmin >= -32767 && vmax <= 32767)?
+          convert_pyint_column<int16_t>(data, nrows, SType::INT16) :
+      (vmin >= -2147483647LL && vmax <= 2147483647LL)?
+          convert_pyint_column<int32_t>(data, nrows, SType::INT32) :
+          convert_pyint_column<int64_t>(data, nrows, SType::INT64);
+    delete col;
+    return out;
+  }
+  if (nfloats && !nbools) {
+    Column* out = Column::new_data_column(SType::FLOAT64, nrows);
+    double* vals = static_cast<double*>(out->data_w());
+    for (int64_t i = 0; i < nrows; ++i) {
+      PyObject* p = data[i];
+      if (p == Py_None) {
+        vals[i] = GETNA<double>();
+      } else if (PyFloat_CheckExact(p)) {
+        vals[i] = PyFloat_AS_DOUBLE(p);
+      } else {
+        int overflow = 0;
+        vals[i] = static_cast<double>(PyLong_AsInt64AndOverflow(p, &overflow));
+      }
+    }
+    delete col;
+    return out;
+  }
+  if (any_numeric) {
+    // bools mixed with wider numbers: leave as OBJ
     return col;
   }
 
@@ -429,16 +547,22 @@ static int getbuffer_DataTable(
 
   // First, find the common stype for all columns in the DataTable.
   SType stype = self->use_stype_for_buffers;
+  bool has_obj_columns = false;
   if (stype == SType::VOID) {
     // Auto-detect common stype
     uint64_t stypes_mask = 0;
     for (size_t i = 0; i < ncols; ++i) {
       SType next_stype = dt->columns[i]->stype();
+      has_obj_columns |= (next_stype == SType::OBJ);
       uint64_t unstype = static_cast<uint64_t>(next_stype);
       if (stypes_mask & (1 << unstype)) continue;
       stypes_mask |= 1 << unstype;
       stype = common_stype_for_buffer(stype, next_stype);
     }
+  } else {
+    for (size_t i = 0; i < ncols; ++i) {
+      has_obj_columns |= (dt->columns[i]->stype() == SType::OBJ);
+    }
   }
 
   // Allocate the final buffer
@@ -448,37 +572,59 @@ static int getbuffer_DataTable(
   MemoryRange memr = MemoryRange::mem(ncols * colsize);
   const char* fmt = format_from_stype(stype);
 
-  // Construct the data buffer
+  // Construct the data buffer. Each column casts+copies into its own
+  // region of the destination, so the columns become independent parallel
+  // tasks. Columns holding (or being cast into) Python objects must be
+  // processed from the master thread only.
+  bool go_wide = !has_obj_columns && stype != SType::OBJ && ncols > 1;
+  OmpExceptionManager oem;
+  config::thread_grant tgrant;
+  #pragma omp parallel for schedule(dynamic) if (go_wide) \
+          num_threads(tgrant.nthreads())
   for (size_t i = 0; i < ncols; ++i) {
-    // either a shallow copy, or "materialized" column
-    Column* col = dt->columns[i]->shallowcopy();
-    col->reify();
-    if (col->stype() == stype) {
-      xassert(col->alloc_size() == colsize);
-      std::memcpy(memr.wptr(i*colsize), col->data(), colsize);
-    } else {
-      // xmb becomes a "view" on a portion of the buffer `mbuf`. An
-      // ExternelMemBuf object is documented to be readonly; however in
-      // practice it can still be written to, just not resized (this is
-      // hacky, maybe fix in the future).
-      MemoryRange xmb = MemoryRange::view(memr, colsize, i*colsize);
-      // Now we create a `newcol` by casting `col` into `stype`, using
-      // the buffer `xmb`. Since `xmb` already has the correct size, this
-      // is possible. The effect of this call is that `newcol` will be
-      // created having the converted data; but the side-effect of this is
-      // that `mbuf` will have the same data, and in the right place.
-      Column* newcol = col->cast(stype, std::move(xmb));
-      xassert(newcol->alloc_size() == colsize);
-      // We can now delete the new column: this will delete `xmb` as well,
-      // however an ExternalMemBuf object does not attempt to free its
-      // memory buffer. The converted data that was written to `mbuf` will
-      // thus remain intact. No need to delete `xmb` either.
-      delete newcol;
+    if (oem.stop_requested()) continue;
+    try {
+      Column* colsrc = dt->columns[i];
+      if (colsrc->stype() == stype && colsrc->rowindex().isabsent()) {
+        // Nothing to materialize or cast: copy straight from the source.
+        xassert(colsrc->alloc_size() == colsize);
+        std::memcpy(memr.wptr(i*colsize), colsrc->data(), colsize);
+        continue;
+      }
+      // either a shallow copy, or "materialized" column
+      Column* col = colsrc->shallowcopy();
+      col->reify();
+      if (col->stype() == stype) {
+        xassert(col->alloc_size() == colsize);
+        std::memcpy(memr.wptr(i*colsize), col->data(), colsize);
+      } else {
+        // xmb becomes a "view" on a portion of the buffer `mbuf`. An
+        // ExternelMemBuf object is documented to be readonly; however in
+        // practice it can still be written to, just not resized (this is
+        // hacky, maybe fix in the future).
+        MemoryRange xmb = MemoryRange::view(memr, colsize, i*colsize);
+        // Now we create a `newcol` by casting `col` into `stype`, using
+        // the buffer `xmb`. Since `xmb` already has the correct size, this
+        // is possible. The effect of this call is that `newcol` will be
+        // created having the converted data; but the side-effect of this is
+        // that `mbuf` will have the same data, and in the right place.
+        Column* newcol = col->cast(stype, std::move(xmb));
+        xassert(newcol->alloc_size() == colsize);
+        // We can now delete the new column: this will delete `xmb` as well,
+        // however an ExternalMemBuf object does not attempt to free its
+        // memory buffer. The converted data that was written to `mbuf` will
+        // thus remain intact. No need to delete `xmb` either.
+        delete newcol;
+      }
+      // Delete the `col` pointer, which was extracted from the i-th column
+      // of the DataTable.
+      delete col;
+    } catch (...) {
+      oem.capture_exception();
+      oem.stop_iterations();
     }
-    // Delete the `col` pointer, which was extracted from the i-th column
-    // of the DataTable.
-    delete col;
   }
+  oem.rethrow_exception_if_any();
 
   xinfo = new XInfo();
   xinfo->mbuf = std::move(memr);
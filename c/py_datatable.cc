@@ -7,8 +7,10 @@
 //------------------------------------------------------------------------------
 #define dt_PY_DATATABLE_cc
 #include "py_datatable.h"
+#include <cstdlib>     // std::calloc, std::free
 #include <exception>
 #include <iostream>
+#include <sys/mman.h>  // shm_unlink
 #include <vector>
 #include "datatable.h"
 #include "frame/py_frame.h"
@@ -22,6 +24,7 @@
 #include "python/int.h"
 #include "python/list.h"
 #include "python/string.h"
+#include "utils/omp.h"
 
 
 namespace pydatatable
@@ -93,11 +96,93 @@ PyObject* datatable_load(PyObject*, PyObject* args) {
 
 
 PyObject* open_jay(PyObject*, PyObject* args) {
+  PyObject* arg1, *arg2 = nullptr;
+  double fmin = 0.0, fmax = 0.0;
+  if (!PyArg_ParseTuple(args, "O|Odd:open_jay", &arg1, &arg2, &fmin, &fmax))
+    return nullptr;
+  std::string filename = py::obj(arg1).to_string();
+
+  DataTable* dt = arg2
+      ? DataTable::open_jay(filename, py::obj(arg2).to_string(), fmin, fmax)
+      : DataTable::open_jay(filename);
+  py::Frame* frame = py::Frame::from_datatable(dt);
+  return frame;
+}
+
+
+PyObject* open_jay_buffer(PyObject*, PyObject* args) {
+  PyObject* arg1;
+  if (!PyArg_ParseTuple(args, "O:open_jay_buffer", &arg1))
+    return nullptr;
+
+  Py_buffer* view = static_cast<Py_buffer*>(std::calloc(1, sizeof(Py_buffer)));
+  if (!view) throw PyError();
+  if (PyObject_GetBuffer(arg1, view, PyBUF_SIMPLE) != 0) {
+    std::free(view);
+    throw PyError();
+  }
+  // The MemoryRange holds on to the Py_buffer, keeping the source object
+  // alive for as long as any column references the buffer.
+  MemoryRange mbuf = MemoryRange::external(
+      view->buf, static_cast<size_t>(view->len), view);
+  DataTable* dt = DataTable::open_jay_buffer(std::move(mbuf));
+  py::Frame* frame = py::Frame::from_datatable(dt);
+  return frame;
+}
+
+
+PyObject* open_jay_shmem(PyObject*, PyObject* args) {
+  PyObject* arg1;
+  if (!PyArg_ParseTuple(args, "O:open_jay_shmem", &arg1))
+    return nullptr;
+  std::string name = py::obj(arg1).to_string();
+
+  DataTable* dt = DataTable::open_jay_shmem(name);
+  py::Frame* frame = py::Frame::from_datatable(dt);
+  return frame;
+}
+
+
+PyObject* shmem_unlink(PyObject*, PyObject* args) {
+  PyObject* arg1;
+  if (!PyArg_ParseTuple(args, "O:shmem_unlink", &arg1))
+    return nullptr;
+  std::string name = py::obj(arg1).to_string();
+
+  if (::shm_unlink(name.c_str()) == -1) {
+    throw ValueError() << "Cannot unlink shared memory object `" << name
+        << "`" << Errno;
+  }
+  Py_RETURN_NONE;
+}
+
+
+PyObject* open_feather(PyObject*, PyObject* args) {
   PyObject* arg1;
-  if (!PyArg_ParseTuple(args, "O:open_jay", &arg1)) return nullptr;
+  if (!PyArg_ParseTuple(args, "O:open_feather", &arg1))
+    return nullptr;
   std::string filename = py::obj(arg1).to_string();
 
-  DataTable* dt = DataTable::open_jay(filename);
+  DataTable* dt = DataTable::open_feather(filename);
+  py::Frame* frame = py::Frame::from_datatable(dt);
+  return frame;
+}
+
+
+PyObject* merge_sorted(PyObject*, PyObject* args) {
+  int64_t keycol;
+  PyObject* frames;
+  if (!PyArg_ParseTuple(args, "nO!:merge_sorted",
+                        &keycol, &PyList_Type, &frames))
+    return nullptr;
+
+  Py_ssize_t n = PyList_Size(frames);
+  std::vector<DataTable*> parts(static_cast<size_t>(n));
+  for (Py_ssize_t i = 0; i < n; ++i) {
+    if (!unwrap(PyList_GET_ITEM(frames, i), &parts[static_cast<size_t>(i)]))
+      return nullptr;
+  }
+  DataTable* dt = DataTable::merge_sorted(parts, keycol);
   py::Frame* frame = py::Frame::from_datatable(dt);
   return frame;
 }
@@ -164,6 +249,11 @@ PyObject* get_datatable_ptr(obj* self) {
 }
 
 
+PyObject* get_cache_version(obj* self) {
+  return PyLong_FromUnsignedLongLong(self->ref->cache_version());
+}
+
+
 /**
  * Return size of the referenced DataTable, and the current `pydatatable::obj`.
  */
@@ -213,6 +303,168 @@ PyObject* window(obj* self, PyObject* args) {
 }
 
 
+template <typename T, typename F>
+static bool _fill_column_list(const T* data, PyObject* list, int64_t n,
+                              const int64_t* rowmap, F conv)
+{
+  for (int64_t j = 0; j < n; ++j) {
+    int64_t irow = rowmap? rowmap[j] : j;
+    PyObject* value = conv(data[irow]);
+    if (!value) return false;
+    PyList_SET_ITEM(list, j, value);
+  }
+  return true;
+}
+
+
+template <typename T>
+static bool _fill_column_strlist(Column* col, PyObject* list, int64_t n,
+                                 const int64_t* rowmap)
+{
+  auto scol = static_cast<StringColumn<T>*>(col);
+  const T* offsets = scol->offsets();
+  const char* strdata = scol->strdata();
+  // Native prep: resolve each string's (start, length) slice with the GIL
+  // released, then create the PyUnicode objects in a GIL-held pass.
+  std::vector<const char*> starts(static_cast<size_t>(n));
+  std::vector<Py_ssize_t> lens(static_cast<size_t>(n));
+  {
+    GILReleased gil;
+    #pragma omp parallel for schedule(static)
+    for (int64_t j = 0; j < n; ++j) {
+      int64_t irow = rowmap? rowmap[j] : j;
+      T end = offsets[irow];
+      if (ISNA<T>(end)) {
+        starts[j] = nullptr;
+        lens[j] = 0;
+      } else {
+        T start = offsets[irow - 1] & ~GETNA<T>();
+        starts[j] = strdata + start;
+        lens[j] = static_cast<Py_ssize_t>(end - start);
+      }
+    }
+  }
+  for (int64_t j = 0; j < n; ++j) {
+    PyObject* value = starts[j]
+        ? PyUnicode_FromStringAndSize(starts[j], lens[j])
+        : none();
+    if (!value) return false;
+    PyList_SET_ITEM(list, j, value);
+  }
+  return true;
+}
+
+
+/**
+ * Convert the DataTable into a Python list of lists (one inner list per
+ * column). Unlike `window()`, which converts cell-by-cell through the
+ * per-stype formatters, this exporter works one column at a time: the
+ * rowindex is resolved in a single native pass (parallel, GIL released),
+ * and the Python objects are then created in a tight typed loop, which
+ * keeps CPython's int/float freelists hot. For string columns the
+ * (start, length) slices are likewise precomputed natively before the
+ * GIL-held PyUnicode construction pass.
+ */
+PyObject* to_pylist(obj* self, PyObject*) {
+  DataTable* dt = self->ref;
+  int64_t nrows = dt->nrows;
+
+  RowIndex rindex(dt->rowindex);
+  std::vector<int64_t> rowmap;
+  if (!rindex.isabsent()) {
+    rowmap.resize(static_cast<size_t>(nrows));
+    int64_t* rm = rowmap.data();
+    GILReleased gil;
+    if (rindex.isarr32()) {
+      const int32_t* ind = rindex.indices32();
+      #pragma omp parallel for schedule(static)
+      for (int64_t j = 0; j < nrows; ++j) rm[j] = ind[j];
+    } else if (rindex.isarr64()) {
+      const int64_t* ind = rindex.indices64();
+      #pragma omp parallel for schedule(static)
+      for (int64_t j = 0; j < nrows; ++j) rm[j] = ind[j];
+    } else if (rindex.isslice()) {
+      int64_t start = rindex.slice_start();
+      int64_t step = rindex.slice_step();
+      #pragma omp parallel for schedule(static)
+      for (int64_t j = 0; j < nrows; ++j) rm[j] = start + step * j;
+    } else {
+      rindex.strided_loop2(0, nrows, 1,
+        [&](int64_t j, int64_t i) { rm[j] = i; });
+    }
+  }
+  const int64_t* rmap = rowmap.empty()? nullptr : rowmap.data();
+
+  PyObject* result = PyList_New(dt->ncols);
+  if (!result) throw PyError();
+  try {
+    for (int64_t i = 0; i < dt->ncols; ++i) {
+      Column* col = dt->columns[i];
+      PyObject* list = PyList_New(nrows);
+      if (!list) throw PyError();
+      PyList_SET_ITEM(result, i, list);
+      bool ok = true;
+      switch (col->stype()) {
+        case SType::BOOL:
+          ok = _fill_column_list(static_cast<const int8_t*>(col->data()),
+                  list, nrows, rmap, [](int8_t x) { return bool_to_py(x); });
+          break;
+        case SType::INT8:
+          ok = _fill_column_list(static_cast<const int8_t*>(col->data()),
+                  list, nrows, rmap, [](int8_t x) { return int_to_py(x); });
+          break;
+        case SType::INT16:
+          ok = _fill_column_list(static_cast<const int16_t*>(col->data()),
+                  list, nrows, rmap, [](int16_t x) { return int_to_py(x); });
+          break;
+        case SType::INT32:
+          ok = _fill_column_list(static_cast<const int32_t*>(col->data()),
+                  list, nrows, rmap, [](int32_t x) { return int_to_py(x); });
+          break;
+        case SType::INT64:
+          ok = _fill_column_list(static_cast<const int64_t*>(col->data()),
+                  list, nrows, rmap, [](int64_t x) { return int_to_py(x); });
+          break;
+        case SType::FLOAT32:
+          ok = _fill_column_list(static_cast<const float*>(col->data()),
+                  list, nrows, rmap, [](float x) { return float_to_py(x); });
+          break;
+        case SType::FLOAT64:
+          ok = _fill_column_list(static_cast<const double*>(col->data()),
+                  list, nrows, rmap, [](double x) { return float_to_py(x); });
+          break;
+        case SType::STR32:
+          ok = _fill_column_strlist<uint32_t>(col, list, nrows, rmap);
+          break;
+        case SType::STR64:
+          ok = _fill_column_strlist<uint64_t>(col, list, nrows, rmap);
+          break;
+        case SType::OBJ:
+          ok = _fill_column_list(static_cast<PyObject* const*>(col->data()),
+                  list, nrows, rmap, [](PyObject* x) { return incref(x); });
+          break;
+        default: {
+          // Not all stypes have a bulk loop; fall back to the formatter.
+          auto f = py_stype_formatters[static_cast<int>(col->stype())];
+          for (int64_t j = 0; j < nrows; ++j) {
+            int64_t irow = rmap? rmap[j] : j;
+            PyObject* value = f(col, irow);
+            if (!value) { ok = false; break; }
+            PyList_SET_ITEM(list, j, value);
+          }
+          break;
+        }
+      }
+      if (!ok) throw PyError();
+    }
+  } catch (...) {
+    Py_DECREF(result);
+    throw;
+  }
+  return result;
+}
+
+
 PyObject* to_scalar(obj* self, PyObject*) {
   DataTable* dt = self->ref;
   if (dt->ncols == 1 && dt->nrows == 1) {
@@ -432,6 +684,32 @@ PyObject* replace_column_array(obj* self, PyObject* args) {
 }
 
 
+PyObject* replace_values(obj* self, PyObject* args) {
+  DataTable* dt = self->ref;
+  int64_t j;
+  PyObject *arg2, *arg3;
+  if (!PyArg_ParseTuple(args, "lOO:replace_values", &j, &arg2, &arg3))
+    return nullptr;
+  DataTable* mdt = py::obj(arg2).to_frame();
+  DataTable* rdt = py::obj(arg3).to_frame();
+
+  if (j < 0 || j >= dt->ncols) {
+    throw ValueError() << "Invalid column index " << j << " for a Frame "
+                          "with " << dt->ncols << " columns";
+  }
+  if (mdt->ncols != 1 || rdt->ncols != 1 || mdt->nrows != rdt->nrows) {
+    throw ValueError() << "Replacement rules must be given as two "
+                          "single-column Frames of the same length";
+  }
+  dt->reify();
+  mdt->reify();
+  rdt->reify();
+  dt->columns[j]->replace_values_batch(mdt->columns[0], rdt->columns[0]);
+  _clear_types(self);
+  Py_RETURN_NONE;
+}
+
+
 PyObject* rbind(obj* self, PyObject* args) {
   DataTable* dt = self->ref;
   int64_t final_ncols;
@@ -509,18 +787,136 @@ PyObject* cbind(obj* self, PyObject* args) {
 }
 
 
+PyObject* melt(obj* self, PyObject* args) {
+  int64_t nid = 0;
+  if (!PyArg_ParseTuple(args, "L:melt", &nid)) return nullptr;
+  DataTable* dt = self->ref;
+  DataTable* res = nullptr;
+  {
+    GILReleased gil;
+    res = dt->melt(nid);
+  }
+  return py::Frame::from_datatable(res);
+}
+
+
+PyObject* cross_join(obj* self, PyObject* args) {
+  PyObject* arg1;
+  if (!PyArg_ParseTuple(args, "O!:cross_join", &pydatatable::type, &arg1))
+    return nullptr;
+  DataTable* dt = self->ref;
+  DataTable* other = static_cast<pydatatable::obj*>(
+      static_cast<void*>(arg1))->ref;
+  DataTable* res = dt->cross_join(other);
+  return py::Frame::from_datatable(res);
+}
+
+
+PyObject* value_counts(obj* self, PyObject* args) {
+  int64_t icol = 0;
+  int sort_by_count = 1;
+  if (!PyArg_ParseTuple(args, "|Li:value_counts", &icol, &sort_by_count))
+    return nullptr;
+  DataTable* dt = self->ref;
+  if (icol < 0 || icol >= dt->ncols) {
+    throw ValueError() << "Invalid column index " << icol
+                       << " for a frame with " << dt->ncols << " columns";
+  }
+  Column* col = dt->columns[icol];
+  DataTable* res = nullptr;
+  {
+    GILReleased gil;
+    res = col->value_counts(sort_by_count != 0);
+  }
+  return py::Frame::from_datatable(res);
+}
+
+
+PyObject* categorize(obj* self, PyObject* args) {
+  int64_t icol = -1;
+  if (!PyArg_ParseTuple(args, "|L:categorize", &icol))
+    return nullptr;
+  DataTable* dt = self->ref;
+  if (icol >= dt->ncols) {
+    throw ValueError() << "Invalid column index " << icol
+                       << " for a frame with " << dt->ncols << " columns";
+  }
+  {
+    GILReleased gil;
+    // The encoded columns come out as data columns; materialize the frame
+    // first so that the untouched columns agree with the frame's rowindex.
+    dt->reify();
+    for (int64_t i = 0; i < dt->ncols; ++i) {
+      if (icol >= 0 && i != icol) continue;
+      SType st = dt->columns[i]->stype();
+      if (icol < 0 && st != SType::STR32 && st != SType::STR64) continue;
+      Column* newcol = CategoricalColumn::from_strings(dt->columns[i]);
+      delete dt->columns[i];
+      dt->columns[i] = newcol;
+    }
+  }
+  _clear_types(self);
+  Py_RETURN_NONE;
+}
+
+
+PyObject* pivot(obj* self, PyObject*) {
+  DataTable* dt = self->ref;
+  DataTable* res = nullptr;
+  {
+    GILReleased gil;
+    res = dt->pivot();
+  }
+  return py::Frame::from_datatable(res);
+}
+
+
 
 PyObject* sort(obj* self, PyObject* args) {
   DataTable* dt = self->ref;
-  int idx = 0;
+  PyObject* colsarg = nullptr;
   int make_groups = 0;
-  if (!PyArg_ParseTuple(args, "i|i:sort", &idx, &make_groups))
+  int case_fold = 0;
+  if (!PyArg_ParseTuple(args, "O|ii:sort", &colsarg, &make_groups, &case_fold))
     return nullptr;
 
-  arr32_t cols(1);
-  cols[0] = idx;
+  arr32_t cols;
+  if (PyLong_Check(colsarg)) {
+    cols.resize(1);
+    cols[0] = static_cast<int32_t>(PyLong_AsLong(colsarg));
+  } else if (PyList_Check(colsarg) || PyTuple_Check(colsarg)) {
+    PyObject* seq = PySequence_Fast(colsarg, "sort()");
+    if (!seq) return nullptr;
+    size_t seq_n = static_cast<size_t>(PySequence_Fast_GET_SIZE(seq));
+    cols.resize(seq_n);
+    for (size_t i = 0; i < seq_n; ++i) {
+      cols[i] = static_cast<int32_t>(
+          PyLong_AsLong(PySequence_Fast_GET_ITEM(seq, i)));
+    }
+    Py_DECREF(seq);
+    if (seq_n == 0) {
+      throw ValueError() << "sort() requires at least one column";
+    }
+  } else {
+    throw TypeError() << "sort() expects a column index, or a list/tuple "
+        "of column indices";
+  }
+  // Sorting of non-object columns never touches Python state, so the GIL
+  // can be released for the duration of the sort.
+  bool native_only = true;
+  for (size_t k = 0; k < cols.size(); ++k) {
+    int32_t icol = cols[k];
+    native_only &= (icol >= 0 && icol < dt->ncols &&
+                    dt->columns[icol]->stype() != SType::OBJ);
+  }
   Groupby grpby;
-  RowIndex ri = dt->sortby(cols, make_groups? &grpby : nullptr);
+  RowIndex ri;
+  if (native_only) {
+    GILReleased gil;
+    ri = dt->sortby(cols, make_groups? &grpby : nullptr, case_fold != 0);
+  } else {
+    ri = dt->sortby(cols, make_groups? &grpby : nullptr, case_fold != 0);
+  }
   // return pyrowindex::wrap(ri);
   return Py_BuildValue("NN", pyrowindex::wrap(ri),
                              make_groups? pygroupby::wrap(grpby) : none());
@@ -548,25 +944,192 @@ PyObject* join(obj* self, PyObject* args) {
 
   Column* col = dt->columns[i]->shallowcopy();
   if (ri) col->replace_rowindex(ri);
-  RowIndex join_ri = col->join(jdt->columns[0]);
+
+  // Join planning: `join()` binary-searches the sorted key column once per
+  // probe row, while `hash_join()` builds a hash table over the keys and
+  // probes it in O(1). Prefer the hash path when the key table is large
+  // enough for the binary search to take many cache-missing steps, or when
+  // the probe column repeats few distinct values, so that the hot part of
+  // the hash table stays cache-resident.
+  Column* kcol = jdt->columns[0];
+  Column* kcol_cast = nullptr;
+  // A filtered str64 column may have been demoted to str32 (see
+  // `Column::compact()`), so the two sides of a string join can
+  // legitimately disagree; align them by casting the narrower side up.
+  if (col->stype() != kcol->stype() &&
+      info(col->stype()).ltype() == LType::STRING &&
+      info(kcol->stype()).ltype() == LType::STRING) {
+    if (col->stype() == SType::STR32) {
+      col->reify();  // cast() does not accept a rowindexed column
+      Column* recast = col->cast(SType::STR64);
+      delete col;
+      col = recast;
+    } else {
+      kcol_cast = kcol->cast(SType::STR64);
+      kcol = kcol_cast;
+    }
+  }
+  RowIndex join_ri;
+  auto do_join = [&]() {
+    bool use_hash = kcol->nrows > 4096 &&
+                    (kcol->nrows > 1048576 ||
+                     col->nunique_estimate() * 16 < col->nrows);
+    join_ri = use_hash? col->hash_join(kcol) : col->join(kcol);
+  };
+  if (col->stype() == SType::OBJ || kcol->stype() == SType::OBJ) {
+    do_join();
+  } else {
+    GILReleased gil;
+    do_join();
+  }
   delete col;
+  delete kcol_cast;
 
   return pyrowindex::wrap(join_ri);
 }
 
 
 
-PyObject* get_min    (obj* self, PyObject*) { return py::Frame::from_datatable(self->ref->min_datatable()); }
-PyObject* get_max    (obj* self, PyObject*) { return py::Frame::from_datatable(self->ref->max_datatable()); }
-PyObject* get_mode   (obj* self, PyObject*) { return py::Frame::from_datatable(self->ref->mode_datatable()); }
-PyObject* get_mean   (obj* self, PyObject*) { return py::Frame::from_datatable(self->ref->mean_datatable()); }
-PyObject* get_sd     (obj* self, PyObject*) { return py::Frame::from_datatable(self->ref->sd_datatable()); }
-PyObject* get_skew   (obj* self, PyObject*) { return py::Frame::from_datatable(self->ref->skew_datatable()); }
-PyObject* get_kurt   (obj* self, PyObject*) { return py::Frame::from_datatable(self->ref->kurt_datatable()); }
-PyObject* get_sum    (obj* self, PyObject*) { return py::Frame::from_datatable(self->ref->sum_datatable()); }
-PyObject* get_countna(obj* self, PyObject*) { return py::Frame::from_datatable(self->ref->countna_datatable()); }
-PyObject* get_nunique(obj* self, PyObject*) { return py::Frame::from_datatable(self->ref->nunique_datatable()); }
-PyObject* get_nmodal (obj* self, PyObject*) { return py::Frame::from_datatable(self->ref->nmodal_datatable()); }
+PyObject* str_filter(obj* self, PyObject* args) {
+  int64_t icol;
+  int method;
+  const char* pattern;
+  // Without PY_SSIZE_T_CLEAN (which this codebase does not define), the
+  // "s#" format writes an `int` length, not a Py_ssize_t.
+  int patlen;
+  if (!PyArg_ParseTuple(args, "Lis#:str_filter",
+                        &icol, &method, &pattern, &patlen)) return nullptr;
+
+  DataTable* dt = self->ref;
+  if (icol < 0 || icol >= dt->ncols) {
+    throw ValueError() << "Invalid column index " << icol
+        << " for a Frame with " << dt->ncols << " columns";
+  }
+  if (method < 0 || method > 2) {
+    throw ValueError() << "Invalid str_filter method " << method;
+  }
+
+  Column* col = dt->columns[icol];
+  RowIndex res;
+  {
+    GILReleased gil;
+    res = col->str_match(method, reinterpret_cast<const uint8_t*>(pattern),
+                         static_cast<size_t>(patlen));
+  }
+  return pyrowindex::wrap(res);
+}
+
+
+
+PyObject* isin_filter(obj* self, PyObject* args) {
+  int64_t icol;
+  int invert;
+  PyObject* arg3;
+  if (!PyArg_ParseTuple(args, "LpO:isin_filter",
+                        &icol, &invert, &arg3)) return nullptr;
+
+  DataTable* dt = self->ref;
+  DataTable* kdt = py::obj(arg3).to_frame();
+  if (icol < 0 || icol >= dt->ncols) {
+    throw ValueError() << "Invalid column index " << icol
+        << " for a Frame with " << dt->ncols << " columns";
+  }
+  if (kdt->ncols != 1) {
+    throw ValueError() << "Expected a single-column Frame of values, got "
+        << kdt->ncols << " columns";
+  }
+  Column* col = dt->columns[icol];
+  Column* kcol = kdt->columns[0];
+  if (kcol->stype() != col->stype()) {
+    throw TypeError() << "The values have stype " << kcol->stype()
+        << ", incompatible with the column's stype " << col->stype();
+  }
+  kcol->reify();
+
+  RowIndex res;
+  if (col->stype() == SType::OBJ) {
+    res = col->semi_join(kcol, invert != 0);
+  } else {
+    GILReleased gil;
+    res = col->semi_join(kcol, invert != 0);
+  }
+  return pyrowindex::wrap(res);
+}
+
+
+
+PyObject* sample_rows(obj* self, PyObject* args) {
+  int64_t k;
+  double frac;
+  unsigned long long seed;
+  if (!PyArg_ParseTuple(args, "LdK:sample_rows",
+                        &k, &frac, &seed)) return nullptr;
+
+  DataTable* dt = self->ref;
+  RowIndex res;
+  {
+    GILReleased gil;
+    res = (k >= 0)? RowIndex::sample(dt->nrows, k, seed)
+                  : RowIndex::sample_frac(dt->nrows, frac, seed);
+  }
+  return pyrowindex::wrap(res);
+}
+
+
+
+PyObject* unique_rows(obj* self, PyObject* args) {
+  if (!PyArg_ParseTuple(args, ":unique_rows")) return nullptr;
+
+  DataTable* dt = self->ref;
+  RowIndex res;
+  {
+    GILReleased gil;
+    res = dt->unique_rowindex();
+  }
+  return pyrowindex::wrap(res);
+}
+
+
+
+/**
+ * True if any column of the frame holds Python objects: those frames must
+ * be processed with the GIL held.
+ */
+static bool has_pyobjects(const DataTable* dt) {
+  for (int64_t i = 0; i < dt->ncols; ++i) {
+    if (dt->columns[i]->stype() == SType::OBJ) return true;
+  }
+  return false;
+}
+
+/**
+ * Compute one of the whole-frame statistics, releasing the GIL for the
+ * duration of the native computation so that other queries can proceed
+ * concurrently.
+ */
+static PyObject* statframe(obj* self, DataTable* (DataTable::*method)() const) {
+  DataTable* dt = self->ref;
+  DataTable* res = nullptr;
+  if (has_pyobjects(dt)) {
+    res = (dt->*method)();
+  } else {
+    GILReleased gil;
+    res = (dt->*method)();
+  }
+  return py::Frame::from_datatable(res);
+}
+
+PyObject* get_min    (obj* self, PyObject*) { return statframe(self, &DataTable::min_datatable); }
+PyObject* get_max    (obj* self, PyObject*) { return statframe(self, &DataTable::max_datatable); }
+PyObject* get_mode   (obj* self, PyObject*) { return statframe(self, &DataTable::mode_datatable); }
+PyObject* get_mean   (obj* self, PyObject*) { return statframe(self, &DataTable::mean_datatable); }
+PyObject* get_sd     (obj* self, PyObject*) { return statframe(self, &DataTable::sd_datatable); }
+PyObject* get_skew   (obj* self, PyObject*) { return statframe(self, &DataTable::skew_datatable); }
+PyObject* get_kurt   (obj* self, PyObject*) { return statframe(self, &DataTable::kurt_datatable); }
+PyObject* get_sum    (obj* self, PyObject*) { return statframe(self, &DataTable::sum_datatable); }
+PyObject* get_countna(obj* self, PyObject*) { return statframe(self, &DataTable::countna_datatable); }
+PyObject* get_nunique(obj* self, PyObject*) { return statframe(self, &DataTable::nunique_datatable); }
+PyObject* get_nmodal (obj* self, PyObject*) { return statframe(self, &DataTable::nmodal_datatable); }
 
 typedef PyObject* (Column::*scalarstatfn)() const;
 static PyObject* _scalar_stat(DataTable* dt, scalarstatfn f) {
@@ -586,6 +1149,72 @@ PyObject* sum1    (obj* self, PyObject*) { return _scalar_stat(self->ref, &Colum
 
 
 
+// Describe one column buffer for `memory_footprint()`. The column holds
+// one reference to the buffer and the local copy made to call this helper
+// holds another, so a share count above 2 means the buffer is also used
+// by other columns or frames.
+static PyObject* _buffer_info(const MemoryRange& mr) {
+  return Py_BuildValue("{s:s, s:n, s:n, s:O}",
+      "type", mr.resource_type(),
+      "size", static_cast<Py_ssize_t>(mr.size()),
+      "resident", static_cast<Py_ssize_t>(mr.resident_size()),
+      "shared", mr.share_count() > 2? Py_True : Py_False);
+}
+
+PyObject* memory_footprint(obj* self, PyObject*) {
+  DataTable* dt = self->ref;
+  PyObject* cols = PyList_New(static_cast<Py_ssize_t>(dt->ncols));
+  if (!cols) return nullptr;
+  for (int64_t i = 0; i < dt->ncols; ++i) {
+    Column* col = dt->columns[i];
+    PyObject* strinfo = nullptr;
+    SType st = col->stype();
+    if (st == SType::STR32) {
+      auto scol = static_cast<StringColumn<uint32_t>*>(col);
+      strinfo = _buffer_info(scol->str_buf());
+    } else if (st == SType::STR64) {
+      auto scol = static_cast<StringColumn<uint64_t>*>(col);
+      strinfo = _buffer_info(scol->str_buf());
+    } else {
+      strinfo = none();
+    }
+    PyObject* item = Py_BuildValue("{s:N, s:N, s:n}",
+        "data", _buffer_info(col->data_buf()),
+        "strdata", strinfo,
+        "footprint", static_cast<Py_ssize_t>(col->memory_footprint()));
+    if (!item) {
+      Py_DECREF(cols);
+      return nullptr;
+    }
+    PyList_SET_ITEM(cols, static_cast<Py_ssize_t>(i), item);
+  }
+  size_t ri_size = dt->rowindex.isabsent()
+                   ? 0 : dt->rowindex.memory_footprint();
+  return Py_BuildValue("{s:N, s:n, s:n}",
+      "columns", cols,
+      "rowindex", static_cast<Py_ssize_t>(ri_size),
+      "total", static_cast<Py_ssize_t>(dt->memory_footprint()));
+}
+
+
+PyObject* release_memory(obj* self, PyObject*) {
+  self->ref->release_memory();
+  return none();
+}
+
+
+PyObject* reserve(obj* self, PyObject* args) {
+  int64_t new_nrows = 0;
+  if (!PyArg_ParseTuple(args, "l:reserve", &new_nrows))
+    return nullptr;
+  if (new_nrows < 0) {
+    throw ValueError() << "Cannot reserve a negative number of rows";
+  }
+  self->ref->reserve(new_nrows);
+  Py_RETURN_NONE;
+}
+
+
 PyObject* materialize(obj* self, PyObject*) {
   DataTable* dt = self->ref;
 
@@ -595,6 +1224,12 @@ PyObject* materialize(obj* self, PyObject*) {
     Column* newcol = oldcol->shallowcopy();
     newcol->reify();
     delete oldcol;
+    // A filtered str64 column may now fit within 32-bit offsets
+    Column* compacted = newcol->compact();
+    if (compacted != newcol) {
+      delete newcol;
+      newcol = compacted;
+    }
     dt->columns[i] = newcol;
   }
   dt->rowindex.clear();
@@ -612,9 +1247,89 @@ PyObject* use_stype_for_buffers(obj* self, PyObject* args) {
 }
 
 PyObject* save_jay(obj* self, PyObject* args) {
+  DataTable* dt = self->ref;
+  PyObject* arg1, *arg2, *arg3, *arg4 = nullptr, *arg5 = nullptr;
+  if (!PyArg_ParseTuple(args, "OOO|OO:save_jay",
+                        &arg1, &arg2, &arg3, &arg4, &arg5))
+    return nullptr;
+
+  auto filename = py::obj(arg1).to_string();
+  auto colnames = py::obj(arg2).to_stringlist();
+  auto strategy = py::obj(arg3).to_string();
+  bool compress = arg4? py::obj(arg4).to_bool() : false;
+  size_t rowgroup_size = arg5
+      ? static_cast<size_t>(py::obj(arg5).to_int64()) : 0;
+  auto sstrategy = (strategy == "mmap")  ? WritableBuffer::Strategy::Mmap :
+                   (strategy == "write") ? WritableBuffer::Strategy::Write :
+                                           WritableBuffer::Strategy::Auto;
+
+  if (colnames.size() != static_cast<size_t>(dt->ncols)) {
+    throw ValueError()
+      << "The list of column names has wrong length: " << colnames.size();
+  }
+
+  dt->save_jay(filename, colnames, sstrategy, compress, rowgroup_size);
+  Py_RETURN_NONE;
+}
+
+PyObject* save_jay_append(obj* self, PyObject* args) {
+  DataTable* dt = self->ref;
+  PyObject* arg1, *arg2;
+  if (!PyArg_ParseTuple(args, "OO:save_jay_append", &arg1, &arg2))
+    return nullptr;
+
+  auto filename = py::obj(arg1).to_string();
+  auto colnames = py::obj(arg2).to_stringlist();
+
+  if (colnames.size() != static_cast<size_t>(dt->ncols)) {
+    throw ValueError()
+      << "The list of column names has wrong length: " << colnames.size();
+  }
+
+  dt->save_jay_append(filename, colnames);
+  Py_RETURN_NONE;
+}
+
+PyObject* save_jay_memory(obj* self, PyObject* args) {
+  DataTable* dt = self->ref;
+  PyObject* arg1;
+  if (!PyArg_ParseTuple(args, "O:save_jay_memory", &arg1))
+    return nullptr;
+  auto colnames = py::obj(arg1).to_stringlist();
+  if (colnames.size() != static_cast<size_t>(dt->ncols)) {
+    throw ValueError()
+      << "The list of column names has wrong length: " << colnames.size();
+  }
+
+  MemoryRange mbuf = dt->save_jay_memory(colnames);
+  // Wrap the buffer into an int8 Column, so that the serialized data can
+  // be exposed to Python through the buffer protocol without copying.
+  Column* col = Column::new_mbuf_column(SType::INT8, std::move(mbuf));
+  return reinterpret_cast<PyObject*>(
+            pycolumn::from_column(col, nullptr, 0));
+}
+
+PyObject* save_jay_shmem(obj* self, PyObject* args) {
+  DataTable* dt = self->ref;
+  PyObject* arg1, *arg2;
+  if (!PyArg_ParseTuple(args, "OO:save_jay_shmem", &arg1, &arg2))
+    return nullptr;
+
+  auto name = py::obj(arg1).to_string();
+  auto colnames = py::obj(arg2).to_stringlist();
+  if (colnames.size() != static_cast<size_t>(dt->ncols)) {
+    throw ValueError()
+      << "The list of column names has wrong length: " << colnames.size();
+  }
+
+  dt->save_jay_shmem(name, colnames);
+  Py_RETURN_NONE;
+}
+
+PyObject* save_feather(obj* self, PyObject* args) {
   DataTable* dt = self->ref;
   PyObject* arg1, *arg2, *arg3;
-  if (!PyArg_ParseTuple(args, "OOO:save_jay", &arg1, &arg2, &arg3))
+  if (!PyArg_ParseTuple(args, "OOO:save_feather", &arg1, &arg2, &arg3))
     return nullptr;
 
   auto filename = py::obj(arg1).to_string();
@@ -629,7 +1344,7 @@ PyObject* save_jay(obj* self, PyObject* args) {
       << "The list of column names has wrong length: " << colnames.size();
   }
 
-  dt->save_jay(filename, colnames, sstrategy);
+  dt->save_feather(filename, colnames, sstrategy);
   Py_RETURN_NONE;
 }
 
@@ -654,6 +1369,7 @@ static void dealloc(obj* self) {
 
 static PyMethodDef datatable_methods[] = {
   METHODv(window),
+  METHOD0(to_pylist),
   METHOD0(to_scalar),
   METHOD0(check),
   METHODv(column),
@@ -661,10 +1377,20 @@ static PyMethodDef datatable_methods[] = {
   METHODv(replace_rowindex),
   METHODv(replace_column_slice),
   METHODv(replace_column_array),
+  METHODv(replace_values),
   METHODv(rbind),
   METHODv(cbind),
+  METHODv(melt),
+  METHOD0(pivot),
+  METHODv(cross_join),
+  METHODv(value_counts),
+  METHODv(categorize),
   METHODv(sort),
   METHODv(join),
+  METHODv(str_filter),
+  METHODv(isin_filter),
+  METHODv(sample_rows),
+  METHODv(unique_rows),
   METHOD0(get_min),
   METHOD0(get_max),
   METHOD0(get_mode),
@@ -686,8 +1412,15 @@ static PyMethodDef datatable_methods[] = {
   METHOD0(mean1),
   METHOD0(sd1),
   METHOD0(materialize),
+  METHOD0(memory_footprint),
+  METHOD0(release_memory),
+  METHODv(reserve),
   METHODv(use_stype_for_buffers),
   METHODv(save_jay),
+  METHODv(save_jay_append),
+  METHODv(save_jay_memory),
+  METHODv(save_jay_shmem),
+  METHODv(save_feather),
   {nullptr, nullptr, 0, nullptr}           /* sentinel */
 };
 
@@ -699,6 +1432,7 @@ static PyGetSetDef datatable_getseters[] = {
   GETTER(rowindex_type),
   GETTER(datatable_ptr),
   GETTER(alloc_size),
+  GETTER(cache_version),
   {nullptr, nullptr, nullptr, nullptr, nullptr}  /* sentinel */
 };
 
@@ -91,6 +91,12 @@ DECLARE_GETTER(
   alloc_size,
   "DataTable's internal size, in bytes")
 
+DECLARE_GETTER(
+  cache_version,
+  "Version stamp of the DataTable's content: changes whenever the data,\n"
+  "the set of columns, or their order changes. Used to key caches of\n"
+  "results derived from the frame.")
+
 
 
 //---- Methods -----------------------------------------------------------------
@@ -100,6 +106,13 @@ DECLARE_METHOD(
   "window(row0, row1, col0, col1)\n\n"
   "Retrieve DataTable's data within a window")
 
+DECLARE_METHOD(
+  to_pylist,
+  "to_pylist()\n\n"
+  "Convert the DataTable into a Python list of lists, one inner list per \n"
+  "column. Unlike `window(...)`, this converts each column in a single \n"
+  "typed bulk pass, which is considerably faster for large frames.")
+
 DECLARE_METHOD(
   to_scalar,
   "to_scalar()\n\n"
@@ -149,6 +162,15 @@ DECLARE_METHOD(
   "have to be replaced. If `repl_at` is given, then `arr` cannot contain\n"
   "out-of-bounds column indices.\n")
 
+DECLARE_METHOD(
+  replace_values,
+  "replace_values(col, matches, repls)\n\n"
+  "Apply a batch of value-replacement rules to column `col`, in a single\n"
+  "parallel pass. `matches` and `repls` are single-column Frames of the\n"
+  "same length, read as parallel rule lists: every cell of the target\n"
+  "column equal to `matches[k]` is overwritten with `repls[k]`. All rules\n"
+  "apply simultaneously, against the original values.\n")
+
 DECLARE_METHOD(
   rbind,
   "Append rows of other datatables to the current")
@@ -157,18 +179,83 @@ DECLARE_METHOD(
   cbind,
   "Append columns of other datatables to the current")
 
+DECLARE_METHOD(
+  melt,
+  "melt(nid)\n\n"
+  "Reshape the DataTable from wide to long format: the first `nid` columns\n"
+  "are carried over as identifiers, and the remaining (numeric) columns are\n"
+  "stacked into a pair of `variable` / `value` columns.")
+
+DECLARE_METHOD(
+  pivot,
+  "pivot()\n\n"
+  "Reshape a long-format DataTable with columns (id, variable, value) into\n"
+  "wide format: one row per distinct id, one float64 column per distinct\n"
+  "variable.")
+
+DECLARE_METHOD(
+  cross_join,
+  "cross_join(other)\n\n"
+  "Cartesian product of two DataTables: every row of this table paired\n"
+  "with every row of `other`. The rows are generated through virtual\n"
+  "repeat rowindexes, so no index arrays are materialized.")
+
+DECLARE_METHOD(
+  value_counts,
+  "value_counts(icol=0, sort_by_count=True)\n\n"
+  "Count how many times each distinct value (including NA) occurs in the\n"
+  "given column, returning a new (value, count) DataTable. Fixed-width\n"
+  "columns are counted in one parallel hashing pass; strings fall back to\n"
+  "a groupby sort.")
+
+DECLARE_METHOD(
+  categorize,
+  "categorize(icol=-1)\n\n"
+  "Convert the given string column (or, with the default `icol=-1`, all\n"
+  "string columns) into dictionary-encoded categorical columns, in place.\n"
+  "Each distinct string is stored once in a shared dictionary and the\n"
+  "rows hold int32 codes; sorting, grouping and filtering then operate on\n"
+  "the codes without ever re-hashing the strings.")
+
 DECLARE_METHOD(
   sort,
-  "sort(col, makegroups=False)\n\n"
-  "Sort datatable by the specified column and return the RowIndex object\n"
-  "corresponding to the col's ordering. If `makegroups` is True, then\n"
-  "grouping information will also be computed and stored in the RowIndex.")
+  "sort(cols, makegroups=False, casefold=False)\n\n"
+  "Sort datatable by the specified column (or list/tuple of columns, in\n"
+  "which case the composite key is sorted lexicographically) and return\n"
+  "the RowIndex object corresponding to that ordering. If `makegroups` is\n"
+  "True, then grouping information will also be computed and stored in\n"
+  "the RowIndex. If `casefold` is True (single string column only), the\n"
+  "ordering treats ASCII upper- and lowercase letters as equal.")
 
 DECLARE_METHOD(
   materialize,
   "materialize()\n\n"
   "Convert DataTable from 'view' into 'data' representation.\n")
 
+DECLARE_METHOD(
+  memory_footprint,
+  "memory_footprint()\n\n"
+  "Return a dict describing how much memory the DataTable actually\n"
+  "holds: a per-column list of buffer descriptions (backing resource\n"
+  "type, virtual size, bytes resident in physical memory, whether the\n"
+  "buffer is shared copy-on-write with other frames), plus the rowindex\n"
+  "overhead and the grand total.\n")
+
+DECLARE_METHOD(
+  release_memory,
+  "release_memory()\n\n"
+  "Advise the kernel that the pages of this DataTable's memory-mapped\n"
+  "column buffers may be reclaimed. Use after a pipeline stage is done\n"
+  "with the frame, to hand its RAM over to the next stage. The frame\n"
+  "stays fully usable: evicted pages are re-read from disk on access.\n")
+
+DECLARE_METHOD(
+  reserve,
+  "reserve(nrows)\n\n"
+  "Preallocate capacity for `nrows` rows in every column's buffer, so\n"
+  "that subsequent rbinds staying within this capacity append in-place\n"
+  "instead of reallocating. Does not change the current number of rows.\n")
+
 DECLARE_METHOD(
   use_stype_for_buffers,
   "use_stype_for_buffers(stype)\n\n")
@@ -178,10 +265,64 @@ DECLARE_METHOD(
   "save_jay(file, colnames)\n\n"
   "Save DataTable into a .jay file.\n")
 
+DECLARE_METHOD(
+  save_jay_append,
+  "save_jay_append(file, colnames)\n\n"
+  "Append DataTable to an existing .jay file.\n")
+
+DECLARE_METHOD(
+  save_jay_memory,
+  "save_jay_memory(colnames)\n\n"
+  "Serialize the DataTable in Jay format into an in-memory buffer, and\n"
+  "return it as an object supporting the buffer protocol (used for\n"
+  "pickling). The result can be reopened with `open_jay_buffer`.\n")
+
+DECLARE_METHOD(
+  save_jay_shmem,
+  "save_jay_shmem(name, colnames)\n\n"
+  "Serialize the DataTable in Jay format into a named POSIX shared\n"
+  "memory object, to which other processes can attach with\n"
+  "`open_jay_shmem`. Fails if the name is already in use.\n")
+
+DECLARE_METHOD(
+  save_feather,
+  "save_feather(file, colnames)\n\n"
+  "Save DataTable into a .feather file.\n")
+
 DECLARE_METHOD(
   join,
   "join(rowindex, join_frame, cols)\n\n")
 
+DECLARE_METHOD(
+  str_filter,
+  "str_filter(icol, method, pattern)\n\n"
+  "Return a RowIndex of the rows of string column `icol` whose value\n"
+  "contains (method=0), starts with (method=1) or ends with (method=2)\n"
+  "the given pattern. NA rows never match.")
+
+DECLARE_METHOD(
+  isin_filter,
+  "isin_filter(icol, invert, values_frame)\n\n"
+  "Return a RowIndex of the rows of column `icol` whose value appears\n"
+  "(invert=False) or does not appear (invert=True) in the single column\n"
+  "of `values_frame`, which must have the same stype.")
+
+DECLARE_METHOD(
+  sample_rows,
+  "sample_rows(k, frac, seed)\n\n"
+  "Return a RowIndex holding a random sample of the Frame's rows: `k`\n"
+  "rows without replacement when `k >= 0` (in random order), otherwise a\n"
+  "Bernoulli sample where every row is selected independently with\n"
+  "probability `frac`. The sample is reproducible for a given seed.")
+
+DECLARE_METHOD(
+  unique_rows,
+  "unique_rows()\n\n"
+  "Return a RowIndex selecting the first occurrence of every distinct\n"
+  "row of the Frame, in the original row order. Rows are compared by\n"
+  "value across all columns; the operation is hash-based and does not\n"
+  "sort.")
+
 
 DECLARE_METHOD(
    get_min,
@@ -278,6 +419,40 @@ DECLARE_FUNCTION(
   "Open a Frame from the provided .jay file.\n",
   HOMEFLAG)
 
+DECLARE_FUNCTION(
+  open_jay_buffer,
+  "open_jay_buffer(buf)\n--\n\n"
+  "Open a Frame from a buffer containing Jay-format data. The buffer is\n"
+  "not copied: the frame's columns reference it directly.\n",
+  HOMEFLAG)
+
+DECLARE_FUNCTION(
+  open_jay_shmem,
+  "open_jay_shmem(name)\n--\n\n"
+  "Attach to a Frame stored in the named shared memory object. The data\n"
+  "is not copied: all attached processes share one physical copy.\n",
+  HOMEFLAG)
+
+DECLARE_FUNCTION(
+  shmem_unlink,
+  "shmem_unlink(name)\n--\n\n"
+  "Remove the named shared memory object. Processes already attached to\n"
+  "it keep their mappings; the memory is freed when the last one detaches.\n",
+  HOMEFLAG)
+
+DECLARE_FUNCTION(
+  open_feather,
+  "open_feather(file)\n--\n\n"
+  "Open a Frame from the provided .feather file.\n",
+  HOMEFLAG)
+
+DECLARE_FUNCTION(
+  merge_sorted,
+  "merge_sorted(keycol, frames)\n--\n\n"
+  "Merge a list of Frames, each already sorted by the column with index\n"
+  "`keycol`, into a single Frame sorted by that column.\n",
+  HOMEFLAG)
+
 
 DECLARE_FUNCTION(
   install_buffer_hooks,
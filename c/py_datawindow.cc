@@ -9,6 +9,7 @@
 #include "py_datawindow.h"
 #include <Python.h>
 #include <structmember.h>
+#include <vector>
 #include "datatable.h"
 #include "rowindex.h"
 #include "py_datatable.h"
@@ -19,6 +20,53 @@
 namespace pydatawindow
 {
 
+/**
+ * Single-slot cache of the most recently converted viewport. The notebook
+ * grid widget re-requests the same window on every repaint (and nearby
+ * windows while scrolling), so keeping the converted PyObject lists around
+ * makes those repaints free. The cache is valid while the viewport
+ * coordinates, the frame's rowindex, and the mutation ids of the viewed
+ * columns are all unchanged; any mismatch simply rebuilds and replaces the
+ * slot. A strong reference is kept on the source pydatatable object, so
+ * the cached pointers can never dangle.
+ */
+struct ViewportCache {
+  PyObject* pydt = nullptr;
+  PyObject* data = nullptr;
+  PyObject* stypes = nullptr;
+  PyObject* ltypes = nullptr;
+  std::vector<uint64_t> mutids;
+  int64_t row0 = 0, row1 = 0, col0 = 0, col1 = 0;
+  int ri_type = 0;
+  const void* ri_ptr = nullptr;
+  int64_t ri_start = 0, ri_step = 0;
+
+  void clear() {
+    Py_XDECREF(pydt);
+    Py_XDECREF(data);
+    Py_XDECREF(stypes);
+    Py_XDECREF(ltypes);
+    pydt = data = stypes = ltypes = nullptr;
+    mutids.clear();
+  }
+};
+
+static ViewportCache vcache;
+
+static void _describe_rowindex(const RowIndex& rindex, int* ri_type,
+                               const void** ri_ptr, int64_t* ri_start,
+                               int64_t* ri_step)
+{
+  *ri_type = rindex.isabsent()? 0 : rindex.isarr32()? 1 :
+             rindex.isarr64()? 2 : 3;
+  *ri_ptr = rindex.isarr32()? static_cast<const void*>(rindex.indices32()) :
+            rindex.isarr64()? static_cast<const void*>(rindex.indices64()) :
+            nullptr;
+  *ri_start = rindex.isslice()? rindex.slice_start() : 0;
+  *ri_step = rindex.isslice()? rindex.slice_step() : 0;
+}
+
+
 /**
  * DataWindow object constructor. This constructor takes a datatable, and
  * coordinates of a data window, and extracts the data from the datatable
@@ -83,6 +131,45 @@ static int _init_(obj* self, PyObject* args, PyObject* kwds)
   int64_t rindexstart = rindex_is_slice? rindex.slice_start() : 0;
   int64_t rindexstep = rindex_is_slice? rindex.slice_step() : 0;
 
+  // Check whether the previously converted viewport can be reused: same
+  // frame, same window coordinates, same rowindex, and none of the viewed
+  // columns mutated in the meantime.
+  {
+    int ri_type;
+    const void* ri_ptr;
+    int64_t ri_start, ri_step;
+    _describe_rowindex(rindex, &ri_type, &ri_ptr, &ri_start, &ri_step);
+    if (vcache.pydt == reinterpret_cast<PyObject*>(pydt) &&
+        vcache.row0 == row0 && vcache.row1 == row1 &&
+        vcache.col0 == col0 && vcache.col1 == col1 &&
+        vcache.ri_type == ri_type && vcache.ri_ptr == ri_ptr &&
+        vcache.ri_start == ri_start && vcache.ri_step == ri_step &&
+        vcache.mutids.size() == static_cast<size_t>(ncols))
+    {
+      bool fresh = true;
+      for (int64_t s = 0; s < ncols; ++s) {
+        int64_t i = s < dt->nkeys? s : s + col0;
+        if (dt->columns[i]->mutation_id() != vcache.mutids[s]) {
+          fresh = false;
+          break;
+        }
+      }
+      if (fresh) {
+        self->row0 = row0;
+        self->row1 = row1;
+        self->col0 = col0;
+        self->col1 = col1;
+        Py_INCREF(vcache.ltypes);
+        Py_INCREF(vcache.stypes);
+        Py_INCREF(vcache.data);
+        self->types = reinterpret_cast<PyListObject*>(vcache.ltypes);
+        self->stypes = reinterpret_cast<PyListObject*>(vcache.stypes);
+        self->data = reinterpret_cast<PyListObject*>(vcache.data);
+        return 0;
+      }
+    }
+  }
+
   stypes = PyList_New(ncols);
   ltypes = PyList_New(ncols);
   view = PyList_New(ncols);
@@ -97,14 +184,17 @@ static int _init_(obj* self, PyObject* args, PyObject* kwds)
     if (py_coldata == nullptr) goto fail;
     PyList_SET_ITEM(view, s, py_coldata);
 
+    // The formatter is fixed per column; hoist its selection out of the
+    // row loop.
+    int itype = static_cast<int>(col->stype());
+    auto formatter = py_stype_formatters[itype];
     int n_init_rows = 0;
     for (int64_t j = row0; j < row1; ++j) {
       int64_t irow = no_rindex? j :
                rindex_is_arr32? rindexarr32[j] :
                rindex_is_arr64? rindexarr64[j] :
                       rindexstart + rindexstep * j;
-      int itype = static_cast<int>(col->stype());
-      PyObject *value = py_stype_formatters[itype](col, irow);
+      PyObject *value = formatter(col, irow);
       if (value == nullptr) goto fail;
       PyList_SET_ITEM(py_coldata, n_init_rows++, value);
     }
@@ -115,6 +205,28 @@ static int _init_(obj* self, PyObject* args, PyObject* kwds)
     PyList_SET_ITEM(stypes, s, info_stype.py_stype().release());
   }
 
+  // Store the freshly converted viewport into the cache slot.
+  vcache.clear();
+  Py_INCREF(pydt);
+  Py_INCREF(view);
+  Py_INCREF(stypes);
+  Py_INCREF(ltypes);
+  vcache.pydt = reinterpret_cast<PyObject*>(pydt);
+  vcache.data = view;
+  vcache.stypes = stypes;
+  vcache.ltypes = ltypes;
+  vcache.row0 = row0;
+  vcache.row1 = row1;
+  vcache.col0 = col0;
+  vcache.col1 = col1;
+  _describe_rowindex(rindex, &vcache.ri_type, &vcache.ri_ptr,
+                     &vcache.ri_start, &vcache.ri_step);
+  vcache.mutids.resize(static_cast<size_t>(ncols));
+  for (int64_t s = 0; s < ncols; ++s) {
+    int64_t i = s < dt->nkeys? s : s + col0;
+    vcache.mutids[static_cast<size_t>(s)] = dt->columns[i]->mutation_id();
+  }
+
   self->row0 = row0;
   self->row1 = row1;
   self->col0 = col0;
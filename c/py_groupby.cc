@@ -7,8 +7,12 @@
 //------------------------------------------------------------------------------
 #define dt_PY_GROUPBY_cc
 #include "py_groupby.h"
+#include <cstring>
+#include "datatable.h"
+#include "frame/py_frame.h"
 #include "python/int.h"
 #include "python/list.h"
+#include "python/obj.h"
 
 namespace pygroupby
 {
@@ -82,6 +86,36 @@ static void dealloc(obj* self) {
 }
 
 
+PyObject* stats_frame(obj* self, PyObject* args) {
+  PyObject *arg1, *arg2;
+  const char* statname;
+  if (!PyArg_ParseTuple(args, "OOs:stats_frame", &arg1, &arg2, &statname))
+    return nullptr;
+
+  DataTable* dt = py::obj(arg1).to_frame();
+  RowIndex sortri = py::obj(arg2).to_rowindex();
+
+  colmakerfn f = nullptr;
+  if      (!std::strcmp(statname, "min"))     f = &Column::min_column;
+  else if (!std::strcmp(statname, "max"))     f = &Column::max_column;
+  else if (!std::strcmp(statname, "mode"))    f = &Column::mode_column;
+  else if (!std::strcmp(statname, "sum"))     f = &Column::sum_column;
+  else if (!std::strcmp(statname, "mean"))    f = &Column::mean_column;
+  else if (!std::strcmp(statname, "sd"))      f = &Column::sd_column;
+  else if (!std::strcmp(statname, "skew"))    f = &Column::skew_column;
+  else if (!std::strcmp(statname, "kurt"))    f = &Column::kurt_column;
+  else if (!std::strcmp(statname, "countna")) f = &Column::countna_column;
+  else if (!std::strcmp(statname, "nunique")) f = &Column::nunique_column;
+  else if (!std::strcmp(statname, "nmodal"))  f = &Column::nmodal_column;
+  else {
+    throw ValueError() << "Unknown stat `" << statname << "` in stats_frame()";
+  }
+
+  DataTable* res = dt->groupwise_statdt(f, *self->ref, sortri);
+  return py::Frame::from_datatable(res);
+}
+
+
 
 //==============================================================================
 // DataTable type definition
@@ -94,6 +128,11 @@ static PyGetSetDef groupby_getsetters[] = {
   {nullptr, nullptr, nullptr, nullptr, nullptr}  /* sentinel */
 };
 
+static PyMethodDef groupby_methods[] = {
+  METHODv(stats_frame),
+  {nullptr, nullptr, 0, nullptr}  /* sentinel */
+};
+
 
 PyTypeObject type = {
   PyVarObject_HEAD_INIT(nullptr, 0)
@@ -123,7 +162,7 @@ PyTypeObject type = {
   0,                                  /* tp_weaklistoffset */
   nullptr,                            /* tp_iter */
   nullptr,                            /* tp_iternext */
-  nullptr,                            /* tp_methods */
+  groupby_methods,                    /* tp_methods */
   nullptr,                            /* tp_members */
   groupby_getsetters,                 /* tp_getset */
   nullptr,                            /* tp_base */
@@ -65,6 +65,21 @@ DECLARE_GETTER(
 
 
 
+//---- Methods -----------------------------------------------------------------
+
+DECLARE_METHOD(
+  stats_frame,
+  "stats_frame(frame, rowindex, stat)\n\n"
+  "Compute the statistic `stat` separately within each group, for every\n"
+  "column of `frame`, returning a new Frame with one row per group (all\n"
+  "groups are processed in a single native pass). `rowindex` must be the\n"
+  "RowIndex produced by the sort that created this Groupby, or None if the\n"
+  "frame is already laid out in group order. Supported stats: 'min', 'max',\n"
+  "'mode', 'sum', 'mean', 'sd', 'skew', 'kurt', 'countna', 'nunique',\n"
+  "'nmodal'.\n")
+
+
+
 };  // namespace pygroupby
 #undef HOMEFLAG
 #undef BASECLS
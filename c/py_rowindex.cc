@@ -199,6 +199,10 @@ static PyObject* repr(obj* self)
     return PyUnicode_FromFormat("_RowIndex(%ld/%ld/%ld)",
         rz.slice_start(), rz.length(), rz.slice_step());
   }
+  if (rz.isrepeat()) {
+    return PyUnicode_FromFormat("_RowIndex(repeat %ld x%ld [%ld])",
+        rz.repeat_period(), rz.repeat_inner(), rz.length());
+  }
   return nullptr;
 }
 
@@ -230,6 +234,13 @@ PyObject* tolist(obj* self, PyObject*)
       PyList_SET_ITEM(list, i, PyLong_FromLong(start + i*step));
     }
   }
+  if (ri.isrepeat()) {
+    int64_t period = ri.repeat_period();
+    int64_t inner = ri.repeat_inner();
+    for (int64_t i = 0; i < n; ++i) {
+      PyList_SET_ITEM(list, i, PyLong_FromLong((i / inner) % period));
+    }
+  }
   return list;
 }
 
@@ -98,6 +98,14 @@ static PyObject* stype_vchar_T_tostring(Column* col, int64_t row) {
   return PyUnicode_FromStringAndSize(str_col->strdata() + start, len);
 }
 
+static PyObject* stype_cat32_tostring(Column* col, int64_t row) {
+  auto cat_col = static_cast<CategoricalColumn*>(col);
+  int32_t code = static_cast<const int32_t*>(col->data())[row];
+  CString val = cat_col->level(code);
+  return val.size < 0? none()
+                     : PyUnicode_FromStringAndSize(val.ch, val.size);
+}
+
 static PyObject* stype_object_pyptr_tostring(Column* col, int64_t row)
 {
   PyObject* x = static_cast<PyObject* const*>(col->data())[row];
@@ -134,7 +142,7 @@ int init_py_types(PyObject*)
   py_stype_formatters[int(SType::FSTR)]    = stype_notimpl;
   py_stype_formatters[int(SType::CAT8)]    = stype_notimpl;
   py_stype_formatters[int(SType::CAT16)]   = stype_notimpl;
-  py_stype_formatters[int(SType::CAT32)]   = stype_notimpl;
+  py_stype_formatters[int(SType::CAT32)]   = stype_cat32_tostring;
   py_stype_formatters[int(SType::DATE64)]  = stype_notimpl;
   py_stype_formatters[int(SType::TIME32)]  = stype_notimpl;
   py_stype_formatters[int(SType::DATE32)]  = stype_notimpl;
@@ -25,6 +25,26 @@ extern char logger_msg[];
 void log_call(const char* msg);
 
 
+/**
+ * RAII guard that releases the GIL for the duration of its scope, so that
+ * other Python threads can run queries concurrently while this one is in a
+ * pure-native phase. The guarded code must not touch any PyObject (in
+ * particular, the frame must not contain obj64 columns) and must re-acquire
+ * the GIL -- by letting the guard go out of scope -- before building the
+ * Python result. Exception-safe: the destructor runs during unwinding.
+ */
+class GILReleased {
+  private:
+    PyThreadState* save;
+
+  public:
+    GILReleased() : save(PyEval_SaveThread()) {}
+    ~GILReleased() { PyEval_RestoreThread(save); }
+    GILReleased(const GILReleased&) = delete;
+    GILReleased& operator=(const GILReleased&) = delete;
+};
+
+
 #define ES_FUNCTION(decl, call, log_msg)                                       \
   decl {                                                                       \
     try {                                                                      \
@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include "read/buffer_pool.h"
+
+namespace dt {
+namespace read {
+
+
+// Index of the smallest size class whose buffers are guaranteed to hold
+// `nbytes` bytes, i.e. ceil(log2(nbytes)) clamped to [MIN_CLASS, MAX_CLASS].
+// Returns a value > MAX_CLASS for requests too large to pool.
+size_t BufferPool::class_for_request(size_t nbytes) {
+  size_t k = MIN_CLASS;
+  while (k <= MAX_CLASS && (size_t(1) << k) < nbytes) k++;
+  return k;
+}
+
+
+BufferPool& BufferPool::get() {
+  static BufferPool pool;
+  return pool;
+}
+
+
+dt::array<char> BufferPool::acquire(size_t nbytes) {
+  size_t k = class_for_request(nbytes);
+  if (k <= MAX_CLASS) {
+    std::lock_guard<std::mutex> lg(lock);
+    auto& cls = classes[k - MIN_CLASS];
+    if (!cls.empty()) {
+      dt::array<char> res = std::move(cls.back());
+      cls.pop_back();
+      return res;
+    }
+    nbytes = size_t(1) << k;  // round fresh allocations up to the class size
+  }
+  return dt::array<char>(nbytes);
+}
+
+
+void BufferPool::release(dt::array<char>&& buf) {
+  size_t n = buf.size();
+  if (n >= (size_t(1) << MIN_CLASS) && n <= (size_t(1) << MAX_CLASS)) {
+    // File under the largest class the buffer can fully satisfy: the
+    // largest k with 2^k <= n.
+    size_t k = class_for_request(n);
+    if ((size_t(1) << k) > n) k--;
+    if (k <= MAX_CLASS) {
+      std::lock_guard<std::mutex> lg(lock);
+      auto& cls = classes[k - MIN_CLASS];
+      if (cls.size() < MAX_PER_CLASS) {
+        cls.push_back(std::move(buf));
+        return;
+      }
+    }
+  }
+  // Unpoolable or the class is full: let the buffer free itself
+}
+
+
+}  // namespace read
+}  // namespace dt
@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_READ_BUFFERPOOL_h
+#define dt_READ_BUFFERPOOL_h
+#include <mutex>           // std::mutex
+#include <vector>          // std::vector
+#include "utils/array.h"   // dt::array
+
+namespace dt {
+namespace read {
+
+
+/**
+ * Size-classed pool of parse buffers, shared by all reader threads and kept
+ * alive across successive fread calls. Thread contexts allocate and free
+ * their `tbuf`/`sbuf` buffers at every read pass; for repeated ingestion
+ * this allocator churn is pure overhead, since the next call needs buffers
+ * of roughly the same size. The pool keeps a bounded number of retired
+ * buffers in power-of-two size classes and hands them back out instead of
+ * going to the allocator.
+ *
+ * `acquire(n)` returns a buffer of at least `n` bytes (possibly larger: the
+ * true size is `result.size()`); `release()` returns a buffer of any size to
+ * the pool, where it is filed under the largest class it can fully satisfy.
+ * Buffers released into a full size class are simply freed. All methods are
+ * thread-safe.
+ */
+class BufferPool {
+  private:
+    // Size classes are 2^MIN_CLASS .. 2^MAX_CLASS bytes (4KB .. 256MB);
+    // requests outside this range bypass the pool.
+    static constexpr size_t MIN_CLASS = 12;
+    static constexpr size_t MAX_CLASS = 28;
+    static constexpr size_t MAX_PER_CLASS = 8;
+
+    std::vector<dt::array<char>> classes[MAX_CLASS - MIN_CLASS + 1];
+    std::mutex lock;
+
+  public:
+    static BufferPool& get();
+
+    dt::array<char> acquire(size_t nbytes);
+    void release(dt::array<char>&& buf);
+
+  private:
+    BufferPool() = default;
+    BufferPool(const BufferPool&) = delete;
+    static size_t class_for_request(size_t nbytes);
+};
+
+
+}  // namespace read
+}  // namespace dt
+
+#endif
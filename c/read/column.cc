@@ -24,12 +24,14 @@ Column::Column() {
   typeBumped = false;
   presentInOutput = true;
   presentInBuffer = true;
+  bytes_per_row = 0.0;
 }
 
 Column::Column(Column&& o)
   : name(std::move(o.name)), databuf(std::move(o.databuf)), strbuf(o.strbuf),
     ptype(o.ptype), rtype(o.rtype), typeBumped(o.typeBumped),
-    presentInOutput(o.presentInOutput), presentInBuffer(o.presentInBuffer)
+    presentInOutput(o.presentInOutput), presentInBuffer(o.presentInBuffer),
+    bytes_per_row(o.bytes_per_row)
 {
   o.strbuf = nullptr;
 }
@@ -53,7 +55,19 @@ void Column::allocate(size_t nrows) {
     else
       databuf.set_element<int64_t>(0, 0);
     if (!strbuf) {
-      strbuf = new MemoryWritableBuffer(allocsize);
+      size_t strbuf_size = allocsize;
+      if (bytes_per_row > 0) {
+        // Pre-size the string buffer according to the average field width
+        // observed during the sampling pass (+25% headroom), so that the
+        // buffer does not have to be repeatedly reallocated while the chunks
+        // are pushed. If the sample proves unrepresentative, `prep_write()`
+        // will still grow the buffer on demand.
+        double estimate = bytes_per_row * nrows * 1.25;
+        if (estimate > strbuf_size) {
+          strbuf_size = static_cast<size_t>(estimate);
+        }
+      }
+      strbuf = new MemoryWritableBuffer(strbuf_size);
     }
   }
 }
@@ -190,6 +204,10 @@ void Column::set_in_buffer(bool f) {
   presentInBuffer = f;
 }
 
+void Column::set_bytes_per_row(double b) {
+  bytes_per_row = b;
+}
+
 
 
 //---- Misc --------------------------------------------------------------------
@@ -43,6 +43,11 @@ class Column {
     bool presentInBuffer;
     int32_t : 24;
 
+    // Average number of field bytes per row, as measured by the sampling
+    // pass in `FreadReader::detect_column_types()`. Used for pre-sizing the
+    // string data buffer in `allocate()`; 0 when no estimate is available.
+    double bytes_per_row;
+
     class ptype_iterator {
       private:
         int8_t* pqr;
@@ -95,6 +100,7 @@ class Column {
     size_t elemsize() const;
     void reset_type_bumped();
     void set_in_buffer(bool f);
+    void set_bytes_per_row(double b);
 
     // Misc
     void convert_to_str64();
@@ -13,8 +13,9 @@ namespace dt {
 namespace read {
 
 
-FreadParallelReader::FreadParallelReader(FreadReader& reader, PT* types_)
-    : ParallelReader(reader, reader.get_mean_line_len()),
+FreadParallelReader::FreadParallelReader(FreadReader& reader, PT* types_,
+                                         ChunkJournal* journal_)
+    : ParallelReader(reader, reader.get_mean_line_len(), journal_),
       f(reader),
       types(types_) {}
 
@@ -22,6 +23,8 @@ FreadParallelReader::FreadParallelReader(FreadReader& reader, PT* types_)
 void FreadParallelReader::read_all() {
   ParallelReader::read_all();
   f.fo.read_data_nthreads = static_cast<size_t>(nthreads);
+  f.fo.n_chunks += chunkCount;
+  f.fo.n_reallocs += n_reallocs;
 }
 
 
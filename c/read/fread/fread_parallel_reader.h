@@ -27,7 +27,8 @@ class FreadParallelReader : public ParallelReader {
     PT* types;
 
   public:
-    FreadParallelReader(FreadReader& reader, PT* types_);
+    FreadParallelReader(FreadReader& reader, PT* types_,
+                        ChunkJournal* journal_ = nullptr);
     virtual ~FreadParallelReader() override = default;
 
     virtual void read_all() override;
@@ -37,6 +37,15 @@ FreadThreadContext::FreadThreadContext(
   fill = f.fill;
   skipEmptyLines = f.skip_blank_lines;
   numbersMayBeNAs = f.number_is_na;
+  skipcol.resize(columns.size());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    // A column is field-skipped if it is not in the buffer: either dropped
+    // by the user, or (on a type-bump reread) already read successfully on
+    // the previous pass. In the latter case its final type was validated
+    // against every row of the input, so there is no need to run the real
+    // parser again just to find the end of the field.
+    skipcol[i] = !columns[i].is_in_buffer();
+  }
 }
 
 FreadThreadContext::~FreadThreadContext() {
@@ -81,7 +90,7 @@ void FreadThreadContext::read_chunk(
       // Try most common and fastest branch first: no whitespace, no numeric NAs, blank means NA
       while (j < ncols) {
         fieldStart = tch;
-        parsers[types[j]](tokenizer);
+        (skipcol[j]? parse_skip : parsers[types[j]])(tokenizer);
         if (*tch != sep) break;
         tokenizer.target += columns[j].is_in_buffer();
         tch++;
@@ -120,7 +129,7 @@ void FreadThreadContext::read_chunk(
         while (true) {
           tch = fieldStart;
           bool quoted = false;
-          if (!ParserLibrary::info(*ptype_iter).isstring()) {
+          if (!skipcol[j] && !ParserLibrary::info(*ptype_iter).isstring()) {
             tokenizer.skip_whitespace();
             const char* afterSpace = tch;
             tch = tokenizer.end_NA_string(tch);
@@ -128,7 +137,7 @@ void FreadThreadContext::read_chunk(
             if (!tokenizer.end_of_field()) tch = afterSpace;
             if (*tch==quote) { quoted=true; tch++; }
           }
-          parsers[*ptype_iter](tokenizer);
+          (skipcol[j]? parse_skip : parsers[*ptype_iter])(tokenizer);
           if (quoted) {
             if (*tch==quote) tch++;
             else goto typebump;
@@ -241,8 +250,57 @@ void FreadThreadContext::postprocess() {
     if (!col.is_in_buffer()) continue;
     if (col.is_string() && !col.is_type_bumped()) {
       strinfo[j].start = output_offset;
+      strinfo[j].direct = true;
       field64* coldata = tbuf.data() + j;
-      for (size_t n = 0; n < used_nrows; ++n) {
+
+      // First pass: validate the fields without copying them. As long as
+      // every field is correct UTF-8 and does not require un-escaping (the
+      // overwhelmingly common case), the entries are left pointing into the
+      // source buffer and push_buffers() will copy them from there directly,
+      // so this chunk's strings never go through `sbuf`.
+      size_t n = 0;
+      for (; n < used_nrows; ++n) {
+        int32_t entry_length = coldata->str32.length;
+        if (entry_length > 0) {
+          const uint8_t* src = zanchor + coldata->str32.offset;
+          size_t zlen = static_cast<size_t>(entry_length);
+          if (check_escaped_string(src, zlen, echar) != 0) break;
+        }
+        coldata += tbuf_ncols;
+      }
+      if (n == used_nrows) { ++j; continue; }
+
+      // Some field needs repair: fall back to staging the column through
+      // `sbuf`. The already-validated prefix is copied verbatim, after which
+      // the normal field-by-field decoding loop resumes from row `n`.
+      strinfo[j].direct = false;
+      coldata = tbuf.data() + j;
+      size_t prefix_size = 0;
+      for (size_t k = 0; k < n; ++k) {
+        int32_t len = (coldata + k * tbuf_ncols)->str32.length;
+        if (len > 0) prefix_size += static_cast<size_t>(len);
+      }
+      if (sbuf.size() < output_offset + prefix_size) {
+        sbuf.resize(output_offset + prefix_size + sbuf.size());
+      }
+      for (size_t k = 0; k < n; ++k) {
+        uint32_t entry_offset = coldata->str32.offset;
+        int32_t entry_length = coldata->str32.length;
+        if (entry_length > 0) {
+          size_t zlen = static_cast<size_t>(entry_length);
+          std::memcpy(sbuf.data() + output_offset,
+                      zanchor + entry_offset, zlen);
+          output_offset += static_cast<uint32_t>(zlen);
+          coldata->str32.offset = output_offset;
+        } else if (entry_length == 0) {
+          coldata->str32.offset = output_offset;
+        } else {
+          xassert(coldata->str32.isna());
+          coldata->str32.offset = output_offset | GETNA<uint32_t>();
+        }
+        coldata += tbuf_ncols;
+      }
+      for (; n < used_nrows; ++n) {
         // Initially, offsets of all entries are given relative to `zanchor`.
         // If a string is NA, its length will be INT_MIN.
         uint32_t entry_offset = coldata->str32.offset;
@@ -298,13 +356,27 @@ void FreadThreadContext::orderBuffer() {
       // offset of the last element. This quantity cannot be calculated in the
       // postprocess() step, since `used_nrows` may some times change affecting
       // this size after the post-processing.
-      uint32_t offset0 = static_cast<uint32_t>(strinfo[j].start);
-      uint32_t offsetL = tbuf[j + tbuf_ncols * (used_nrows - 1)].str32.offset;
-      size_t sz = (offsetL - offset0) & ~GETNA<uint32_t>();
+      size_t sz;
+      if (strinfo[j].direct) {
+        // In direct mode the entries still hold source offsets, which are not
+        // cumulative; the content size is the sum of the field lengths.
+        sz = 0;
+        const field64* lo = tbuf.data() + j;
+        for (size_t n = 0; n < used_nrows; ++n) {
+          int32_t len = lo->str32.length;
+          if (len > 0) sz += static_cast<size_t>(len);
+          lo += tbuf_ncols;
+        }
+      } else {
+        uint32_t offset0 = static_cast<uint32_t>(strinfo[j].start);
+        uint32_t offsetL = tbuf[j + tbuf_ncols * (used_nrows - 1)].str32.offset;
+        sz = (offsetL - offset0) & ~GETNA<uint32_t>();
+      }
       strinfo[j].size = sz;
 
       WritableBuffer* wb = col.strdata_w();
-      size_t write_at = wb->prep_write(sz, sbuf.data() + offset0);
+      size_t write_at = wb->prep_write(
+          sz, strinfo[j].direct? nullptr : sbuf.data() + strinfo[j].start);
       strinfo[j].write_at = write_at;
 
       if (col.get_ptype() == PT::Str32 && write_at + sz > 0x80000000) {
@@ -342,6 +414,49 @@ void FreadThreadContext::push_buffers() {
       SInfo& si = strinfo[j];
       field64* lo = tbuf.data() + j;
 
+      if (si.direct) {
+        // Clean column chunk: copy each field's bytes straight from the
+        // source buffer into the output, computing the cumulative offsets on
+        // the fly. This avoids the intermediate `sbuf` copy altogether.
+        size_t cum = si.write_at;
+        if (elemsize == 4) {
+          uint32_t* dest = static_cast<uint32_t*>(data) + row0 + 1;
+          for (size_t n = 0; n < used_nrows; ++n) {
+            int32_t len = lo->str32.length;
+            if (len > 0) {
+              wb->write_at(cum, static_cast<size_t>(len),
+                           anchor + lo->str32.offset);
+              cum += static_cast<size_t>(len);
+              *dest++ = static_cast<uint32_t>(cum);
+            } else if (len == 0) {
+              *dest++ = static_cast<uint32_t>(cum);
+            } else {
+              *dest++ = static_cast<uint32_t>(cum) | GETNA<uint32_t>();
+            }
+            lo += tbuf_ncols;
+          }
+        } else {
+          uint64_t* dest = static_cast<uint64_t*>(data) + row0 + 1;
+          for (size_t n = 0; n < used_nrows; ++n) {
+            int32_t len = lo->str32.length;
+            if (len > 0) {
+              wb->write_at(cum, static_cast<size_t>(len),
+                           anchor + lo->str32.offset);
+              cum += static_cast<size_t>(len);
+              *dest++ = static_cast<uint64_t>(cum);
+            } else if (len == 0) {
+              *dest++ = static_cast<uint64_t>(cum);
+            } else {
+              // same NA encoding as the `soff + delta` arithmetic below
+              *dest++ = static_cast<uint64_t>(cum) + GETNA<uint32_t>();
+            }
+            lo += tbuf_ncols;
+          }
+        }
+        j++;
+        continue;
+      }
+
       wb->write_at(si.write_at, si.size, sbuf.data() + si.start);
 
       if (elemsize == 4) {
@@ -47,6 +47,11 @@ class FreadThreadContext : public ThreadContext
     FreadTokenizer tokenizer;
     const ParserFnPtr* parsers;
 
+    // Entry j is 1 if column j is not in the buffer (dropped by the user,
+    // or not selected for the current reread pass); such columns are only
+    // scanned to the end of the field (`parse_skip`), never converted.
+    std::vector<uint8_t> skipcol;
+
   public:
     FreadThreadContext(size_t bcols, size_t brows, FreadReader&, PT* types,
                        dt::shared_mutex&);
@@ -8,6 +8,8 @@
 #include "read/parallel_reader.h"
 #include <algorithm>           // std::max
 #include "csv/reader.h"
+#include "options.h"
+#include "perf.h"
 #include "utils/assert.h"
 
 extern double wallclock();
@@ -17,9 +19,12 @@ namespace read {
 
 
 
-ParallelReader::ParallelReader(GenericReader& reader, double meanLineLen)
+ParallelReader::ParallelReader(GenericReader& reader, double meanLineLen,
+                               ChunkJournal* journal_)
   : g(reader)
 {
+  journal = journal_;
+  replaying = journal_ && !journal_->empty();
   chunkSize = 0;
   chunkCount = 0;
   inputStart = g.sof;
@@ -30,6 +35,7 @@ ParallelReader::ParallelReader(GenericReader& reader, double meanLineLen)
   nrows_written = 0;
   nrows_allocated = g.columns.get_nrows();
   nrows_max = g.max_nrows;
+  n_reallocs = 0;
   xassert(nrows_allocated <= nrows_max);
 
   determine_chunking_strategy();
@@ -37,6 +43,16 @@ ParallelReader::ParallelReader(GenericReader& reader, double meanLineLen)
 
 
 void ParallelReader::determine_chunking_strategy() {
+  if (replaying) {
+    // The exact boundaries of every chunk were recorded by the previous
+    // pass over this input, so there is nothing to guess here: the journal
+    // will be replayed verbatim in `compute_chunk_boundaries()`.
+    chunkCount = journal->size();
+    chunkSize = static_cast<size_t>(inputEnd - inputStart) / chunkCount;
+    g.trace("The input will be re-read in %zu chunks recorded in the journal",
+            chunkCount);
+    return;
+  }
   size_t inputSize = static_cast<size_t>(inputEnd - inputStart);
   size_t zThreads = static_cast<size_t>(nthreads);
   double maxrowsSize = nrows_max * lineLength;
@@ -55,6 +71,19 @@ void ParallelReader::determine_chunking_strategy() {
               );
   chunkCount = std::max<size_t>(inputSize / chunkSize, 1);
   if (chunkCount > zThreads) {
+    // Chunks are claimed dynamically from a shared cursor (see read_all()),
+    // so many small chunks balance skewed line lengths much better than
+    // `zThreads` equal slabs: a thread that draws slow-parsing chunks simply
+    // claims fewer of them, and the tail imbalance is bounded by a single
+    // chunk. Aim for ~8 chunks per thread, as long as each chunk remains
+    // large enough to amortize the per-chunk overheads (line-boundary
+    // detection and the ordered commit).
+    size_t minChunkSize = std::max<size_t>(
+        static_cast<size_t>(100 * lineLength), 1 << 16);
+    size_t targetCount = zThreads * 8;
+    if (chunkCount < targetCount && inputSize / targetCount >= minChunkSize) {
+      chunkCount = targetCount;
+    }
     chunkCount = zThreads * (1 + (chunkCount - 1)/zThreads);
     chunkSize = inputSize / chunkCount;
   } else {
@@ -82,6 +111,12 @@ ChunkCoordinates ParallelReader::compute_chunk_boundaries(
   size_t i, ThreadContext* ctx) const
 {
   xassert(i < chunkCount);
+  if (replaying) {
+    // Both `start_exact` and `end_exact` were set when the chunk was
+    // journaled, so `adjust_chunk_coordinates()` will leave it alone, and
+    // `order_chunk()` will never have to re-read it.
+    return (*journal)[i];
+  }
   ChunkCoordinates c;
 
   bool isFirstChunk = (i == 0);
@@ -131,6 +166,23 @@ void ParallelReader::read_all()
   // exception that was thrown and manually propagate it outwards.
   OmpExceptionManager oem;
 
+  // Shared scheduling state. Chunks are claimed by the threads out of a
+  // common atomic counter, and committed (ordered bookkeeping: `row0`
+  // assignment, `order_chunk()`, output reallocation) strictly in chunk
+  // order, gated by the `commit_turn` ticket. Unlike `#pragma omp for
+  // ordered`, a thread is not forced to sit at the ordering point after
+  // every chunk: each thread parses into two alternating contexts, so it
+  // can already read chunk `i+1` while chunk `i` is still waiting for its
+  // predecessors to commit.
+  size_t chunk_counter = 0;
+  size_t commit_turn = 0;
+
+  // Claim the reading team out of the global thread budget, so that any
+  // parallel work triggered from within (e.g. type-bump re-reads casting
+  // columns) sees the remaining budget rather than the whole machine.
+  config::thread_grant tgrant(nthreads);
+  if (tgrant.nthreads() < nthreads) nthreads = tgrant.nthreads();
+
   #pragma omp parallel num_threads(nthreads)
   {
     bool tMaster = false;
@@ -162,46 +214,56 @@ void ParallelReader::read_all()
     bool tShowAlways = tShowProgress && (inputEnd - inputStart > (1 << 28));
     double tShowWhen = tShowProgress? wallclock() + 0.75 : 0;
 
-    // Thread-local parse context. This object does most of the parsing job.
-    auto tctx = init_thread_context();
-
-    // Helper variables for keeping track of chunk's coordinates:
-    // `txcc` has the expected chunk coordinates (i.e. as determined ex ante
-    // in `compute_chunk_coordinates()`), and `tacc` the actual chunk
-    // coordinates (i.e. how much data was actually read in `read_chunk()`).
-    // These two are very often the same; however when they do differ, it is
-    // the job of `order_chunk()` to reconcile the differences.
-    ChunkCoordinates txcc;
-    ChunkCoordinates tacc;
-
-    // Main data reading loop
-    #pragma omp for ordered schedule(dynamic)
-    for (size_t i = 0; i < chunkCount; ++i) {
-      if (oem.stop_requested()) continue;
-      try {
-        if (tMaster) g.emit_delayed_messages();
-        if (tShowAlways || (tShowProgress && wallclock() >= tShowWhen)) {
-          g.progress(work_done_amount());
-          tShowAlways = true;
-        }
-
-        tctx->push_buffers();
-        txcc = compute_chunk_boundaries(i, tctx.get());
-        tctx->read_chunk(txcc, tacc);
-
-      } catch (...) {
-        oem.capture_exception();
-      }
-
-      #pragma omp ordered
-      do {
-        if (oem.stop_requested()) {
-          tctx->used_nrows = 0;
-          break;
-        }
+    // Two thread-local parse contexts, used in alternation ("double
+    // buffering"). Each slot also keeps the coordinates of the chunk that
+    // was parsed into it: `txcc` has the expected chunk coordinates (i.e.
+    // as determined ex ante in `compute_chunk_coordinates()`), and `tacc`
+    // the actual chunk coordinates (i.e. how much data was actually read in
+    // `read_chunk()`). These two are very often the same; however when they
+    // do differ, it is the job of `order_chunk()` to reconcile the
+    // differences.
+    constexpr size_t NO_CHUNK = size_t(-1);
+    bool tTimed = (g.perf_timer != nullptr);
+    int64_t tbusy = 0;
+    ThreadContextPtr tctxs[2] = { init_thread_context(),
+                                  init_thread_context() };
+    size_t tpending[2] = { NO_CHUNK, NO_CHUNK };
+    ChunkCoordinates txcc[2];
+    ChunkCoordinates tacc[2];
+
+    auto get_turn = [&]() -> size_t {
+      size_t turn;
+      #pragma omp flush
+      #pragma omp atomic read
+      turn = commit_turn;
+      return turn;
+    };
+
+    // Perform the ordered bookkeeping for the chunk stored in slot `k`,
+    // then release the ticket and push the parsed data into the output
+    // columns. Must only be called when `commit_turn` equals the chunk's
+    // index: all preceding chunks have been committed, so `nrows_written`
+    // and `lastChunkEnd` are final for this chunk.
+    auto commit = [&](int k) {
+      int64_t t0 = tTimed? dt::perf::clock_ns() : 0;
+      size_t i = tpending[k];
+      auto& tctx = tctxs[k];
+      if (oem.stop_requested()) {
+        tctx->used_nrows = 0;
+      } else {
         try {
           tctx->row0 = nrows_written;
-          order_chunk(tacc, txcc, tctx);
+          order_chunk(tacc[k], txcc[k], tctx);
+
+          // Journal the reconciled coordinates of this chunk. Commits are
+          // serialized by the ticket, so the journal is filled in chunk
+          // order without further synchronization.
+          if (journal && !replaying) {
+            ChunkCoordinates jcc(tacc[k].start, tacc[k].end);
+            jcc.start_exact = true;
+            jcc.end_exact = true;
+            journal->push_back(jcc);
+          }
 
           size_t nrows_new = nrows_written + tctx->used_nrows;
           if (nrows_new > nrows_allocated) {
@@ -224,26 +286,91 @@ void ParallelReader::read_all()
         } catch (...) {
           oem.capture_exception();
         }
-      } while (0);  // #pragma omp ordered
-    }  // #pragma omp for ordered
-
-    // Stopped early because of error. Discard the content of the buffers,
-    // because they were not ordered, and trying to push them may lead to
-    // unexpected bugs...
-    if (oem.exception_caught()) {
-      tctx->used_nrows = 0;
-    }
+      }
+      tpending[k] = NO_CHUNK;
+      #pragma omp flush
+      #pragma omp atomic write
+      commit_turn = i + 1;
+      #pragma omp flush
+
+      // The ticket is released: push the buffers right away, concurrently
+      // with other threads' parsing and committing.
+      if (tctx->used_nrows) {
+        try {
+          tctx->push_buffers();
+        } catch (...) {
+          tctx->used_nrows = 0;
+          oem.capture_exception();
+        }
+      }
+      if (tTimed) tbusy += dt::perf::clock_ns() - t0;
+    };
+
+    // Main data reading loop
+    size_t titer = 0;
+    while (true) {
+      size_t i;
+      #pragma omp atomic capture
+      i = chunk_counter++;
+      if (i >= chunkCount) break;
+
+      int k = static_cast<int>(titer & 1);
+      titer++;
+
+      // If this slot still holds an uncommitted chunk (parsed two
+      // iterations ago), we have to wait for its turn and commit it before
+      // the context can be reused. This is done outside the try block:
+      // `commit()` captures its own exceptions, and the slot must never be
+      // overwritten while uncommitted, or the ticket would stall forever.
+      if (tpending[k] != NO_CHUNK) {
+        while (get_turn() != tpending[k]) {}
+        commit(k);
+      }
 
-    // Push out the buffers one last time.
-    if (tctx->used_nrows) {
+      int64_t t0 = tTimed? dt::perf::clock_ns() : 0;
       try {
-        tctx->push_buffers();
+        if (tMaster) g.emit_delayed_messages();
+        if (tShowAlways || (tShowProgress && wallclock() >= tShowWhen)) {
+          g.progress(work_done_amount());
+          tShowAlways = true;
+        }
+
+        if (oem.stop_requested()) {
+          tctxs[k]->used_nrows = 0;
+        } else {
+          txcc[k] = compute_chunk_boundaries(i, tctxs[k].get());
+          tctxs[k]->read_chunk(txcc[k], tacc[k]);
+        }
       } catch (...) {
-        tctx->used_nrows = 0;
         oem.capture_exception();
+        tctxs[k]->used_nrows = 0;
+      }
+      tpending[k] = i;
+      if (tTimed) tbusy += dt::perf::clock_ns() - t0;
+
+      // Opportunistically commit the other slot (which holds the previous
+      // chunk) if its turn has already come, so that the commit train does
+      // not have to wait for this thread's next iteration.
+      int k2 = k ^ 1;
+      if (tpending[k2] != NO_CHUNK && get_turn() == tpending[k2]) {
+        commit(k2);
       }
     }
 
+    // Drain the still-pending chunks, oldest first. Every claimed chunk
+    // must pass through `commit()` -- even after an error -- otherwise the
+    // ticket would never reach the chunks claimed by other threads.
+    for (int pass = 0; pass < 2; ++pass) {
+      int k = (tpending[0] == NO_CHUNK)? 1 :
+              (tpending[1] == NO_CHUNK)? 0 :
+              (tpending[0] < tpending[1])? 0 : 1;
+      if (tpending[k] == NO_CHUNK) break;
+      while (get_turn() != tpending[k]) {}
+      commit(k);
+    }
+
+    if (tTimed) g.perf_timer->add_thread_busy(tbusy);
+
     // Report progress one last time
     if (tMaster) g.emit_delayed_messages();
     if (tShowAlways) {
@@ -285,6 +412,7 @@ void ParallelReader::realloc_output_columns(size_t ichunk, size_t new_alloc)
     new_alloc = nrows_max;
   }
   nrows_allocated = new_alloc;
+  n_reallocs++;
   g.trace("Too few rows allocated, reallocating to %zu rows", nrows_allocated);
 
   dt::shared_lock lock(shmutex, /* exclusive = */ true);
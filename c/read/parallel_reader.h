@@ -8,6 +8,7 @@
 #ifndef dt_READ_PARALLELREADER_h
 #define dt_READ_PARALLELREADER_h
 #include <memory>                  // std::unique_ptr
+#include <vector>                  // std::vector
 #include "read/thread_context.h"   // ThreadContext
 
 class GenericReader;
@@ -41,6 +42,15 @@ struct ChunkCoordinates {
 };
 
 
+/**
+ * Journal of the chunks committed during one pass over the input: the exact
+ * coordinates of each chunk, in chunk order. When a type bump forces the data
+ * to be re-read, the second pass replays the journal verbatim instead of
+ * re-guessing chunk boundaries and reconciling them in `order_chunk()`.
+ */
+using ChunkJournal = std::vector<ChunkCoordinates>;
+
+
 
 /**
  * This class' responsibility is to execute parallel reading of its input,
@@ -57,17 +67,30 @@ class ParallelReader {
     const char* lastChunkEnd;
     double lineLength;
 
+    // Chunk journal shared between the passes over the same input (may be
+    // nullptr if the caller does not need rereads). During the first pass
+    // the journal is filled as the chunks are committed; if it is already
+    // non-empty on construction, the reader is in "replay" mode and takes
+    // all chunk coordinates from the journal.
+    ChunkJournal* journal;
+    bool replaying;
+    size_t : 56;
+
   protected:
     GenericReader& g;
     dt::shared_mutex shmutex;
     size_t nrows_max;
     size_t nrows_allocated;
     size_t nrows_written;
+    // Number of times the output columns had to be re-allocated because
+    // the initial row-count estimate proved too low
+    size_t n_reallocs;
     int nthreads;
     int : 32;
 
   public:
-    ParallelReader(GenericReader& reader, double len);
+    ParallelReader(GenericReader& reader, double len,
+                   ChunkJournal* journal = nullptr);
     ParallelReader(const ParallelReader&) = delete;
     ParallelReader& operator=(const ParallelReader&) = delete;
     virtual ~ParallelReader() {}
@@ -6,6 +6,7 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include "read/thread_context.h"
+#include "read/buffer_pool.h"
 #include "utils/assert.h"
 
 namespace dt {
@@ -13,7 +14,10 @@ namespace read {
 
 
 ThreadContext::ThreadContext(size_t ncols, size_t nrows)
-  : tbuf(ncols * nrows + 1), sbuf(0), strinfo(ncols)
+  : tbuf(BufferPool::get()
+             .acquire((ncols * nrows + 1) * sizeof(field64))
+             .cast<field64>()),
+    sbuf(0), strinfo(ncols)
 {
   tbuf_ncols = ncols;
   tbuf_nrows = nrows;
@@ -24,11 +28,21 @@ ThreadContext::ThreadContext(size_t ncols, size_t nrows)
 
 ThreadContext::~ThreadContext() {
   weak_assert(used_nrows == 0);
+  // Retire the parse buffers into the shared pool, so that subsequent read
+  // passes (and subsequent fread calls) can reuse them
+  BufferPool& pool = BufferPool::get();
+  if (tbuf) pool.release(tbuf.cast<char>());
+  if (sbuf) pool.release(sbuf.cast<char>());
 }
 
 
 void ThreadContext::allocate_tbuf(size_t ncols, size_t nrows) {
-  tbuf.resize(ncols * nrows + 1);
+  // Grow-only: the pool may have handed us a buffer larger than requested,
+  // and shrinking it back would only cause reallocation churn
+  size_t needed = ncols * nrows + 1;
+  if (tbuf.size() < needed) {
+    tbuf.resize(needed);
+  }
   tbuf_ncols = ncols;
   tbuf_nrows = nrows;
 }
@@ -40,7 +40,11 @@ struct ChunkCoordinates;
  */
 class ThreadContext {
   public:
-    struct SInfo { size_t start, size, write_at; };
+    // If `direct` is true, the string entries of this column did not require
+    // any unescaping or re-encoding, and were left in the parse buffer with
+    // offsets pointing into the source data; push_buffers() will copy them
+    // straight from the (memory-mapped) input, bypassing `sbuf` entirely.
+    struct SInfo { size_t start, size, write_at; bool direct; };
 
     dt::array<field64> tbuf;
     dt::array<uint8_t> sbuf;
@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #include "rowindex.h"
 #include <cstring>     // std::memcpy
+#include "column.h"    // Column (for stype-based collapsing)
 #include "utils.h"
 #include "utils/assert.h"
 #include "utils/omp.h"
@@ -57,6 +58,11 @@ RowIndex RowIndex::from_slices(const arr64_t& starts,
 }
 
 
+RowIndex RowIndex::from_repeat(int64_t period, int64_t inner, int64_t length) {
+  return RowIndex(new RepeatRowIndexImpl(period, inner, length));
+}
+
+
 RowIndex RowIndex::from_array32(arr32_t&& arr, bool sorted) {
   return RowIndex(new ArrayRowIndexImpl(std::move(arr), sorted));
 }
@@ -67,18 +73,44 @@ RowIndex RowIndex::from_array64(arr64_t&& arr, bool sorted) {
 }
 
 
+/**
+ * If an array rowindex known to hold strictly increasing indices covers the
+ * full range `[min; max]`, replace it with the equivalent slice: O(1) memory
+ * instead of an index per row, and `reify()` on a step-1 slice is a single
+ * memcpy. Filters on (time-)sorted data routinely select one contiguous
+ * block of rows, making this a common case.
+ */
+static RowIndexImpl* _collapse_contiguous(RowIndexImpl* impl) {
+  if (impl->length > 0 && impl->max - impl->min + 1 == impl->length) {
+    RowIndexImpl* slice = new SliceRowIndexImpl(impl->min, impl->length, 1);
+    impl->release();
+    return slice;
+  }
+  return impl;
+}
+
+
 RowIndex RowIndex::from_filterfn32(filterfn32* f, int64_t n, bool sorted) {
-  return RowIndex(new ArrayRowIndexImpl(f, n, sorted));
+  RowIndexImpl* impl = new ArrayRowIndexImpl(f, n, sorted);
+  if (sorted) impl = _collapse_contiguous(impl);
+  return RowIndex(impl);
 }
 
 
 RowIndex RowIndex::from_filterfn64(filterfn64* f, int64_t n, bool sorted) {
-  return RowIndex(new ArrayRowIndexImpl(f, n, sorted));
+  RowIndexImpl* impl = new ArrayRowIndexImpl(f, n, sorted);
+  if (sorted) impl = _collapse_contiguous(impl);
+  return RowIndex(impl);
 }
 
 
 RowIndex RowIndex::from_column(Column* col) {
-  return RowIndex(new ArrayRowIndexImpl(col));
+  RowIndexImpl* impl = new ArrayRowIndexImpl(col);
+  // A boolean mask selects rows in strictly ascending order, so the
+  // contiguity check is valid; an integer column may list rows in any
+  // order (and with repeats), hence no collapsing there.
+  if (col->stype() == SType::BOOL) impl = _collapse_contiguous(impl);
+  return RowIndex(impl);
 }
 
 
@@ -127,6 +159,18 @@ arr32_t RowIndex::extract_as_array32() const
       }
       break;
     }
+    case RI_REPEAT: {
+      if (szlen <= INT32_MAX) {
+        int64_t period = repeat_period();
+        int64_t inner = repeat_inner();
+        #pragma omp parallel for schedule(static)
+        for (size_t i = 0; i < szlen; ++i) {
+          res[i] = static_cast<int32_t>(
+              (static_cast<int64_t>(i) / inner) % period);
+        }
+      }
+      break;
+    }
     default:
       break;
   }
@@ -137,6 +181,15 @@ arr32_t RowIndex::extract_as_array32() const
 RowIndex RowIndex::uplift(const RowIndex& ri2) const {
   if (isabsent()) return RowIndex(ri2);
   if (ri2.isabsent()) return RowIndex(*this);
+  // Composing with an identity selection on either side is a no-op: skip
+  // materializing a new index array in that case.
+  if (ri2.isslice() && ri2.slice_start() == 0 && ri2.slice_step() == 1) {
+    return RowIndex(*this);
+  }
+  if (isslice() && slice_start() == 0 && slice_step() == 1 &&
+      length() == ri2.length()) {
+    return RowIndex(ri2);
+  }
   return RowIndex(impl->uplift_from(ri2.impl));
 }
 
@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #ifndef dt_ROWINDEX_h
 #define dt_ROWINDEX_h
+#include <atomic>
 #include "utils/array.h"
 
 class Column;
@@ -22,6 +23,7 @@ enum RowIndexType {
   RI_ARR32 = 1,
   RI_ARR64 = 2,
   RI_SLICE = 3,
+  RI_REPEAT = 4,
 };
 
 typedef int (filterfn32)(int64_t, int64_t, int32_t*, int32_t*);
@@ -36,7 +38,9 @@ typedef int (filterfn64)(int64_t, int64_t, int64_t*, int32_t*);
 class RowIndexImpl {
   public:
     RowIndexType type;
-    int32_t refcount;
+    // Atomic, so that shallow copies of columns sharing one rowindex may be
+    // acquired/released from parallel regions (e.g. the per-column rbind).
+    std::atomic<int32_t> refcount;
     int64_t length;
     int64_t min;
     int64_t max;
@@ -135,6 +139,40 @@ class SliceRowIndexImpl : public RowIndexImpl {
 
 
 
+//==============================================================================
+// "Repeat" RowIndexImpl class
+//==============================================================================
+
+/**
+ * A virtual rowindex of arbitrary length over a frame of `period` rows:
+ * output row `i` maps to source row `(i / inner) % period`. With `inner == 1`
+ * the source rows are tiled end-to-end; with `inner == k` every source row
+ * is repeated `k` times in a row. The mapping is pure arithmetic, so the
+ * index takes O(1) memory regardless of its length -- this is what makes
+ * lazy repeat/tile and cross-join row selections cheap.
+ */
+class RepeatRowIndexImpl : public RowIndexImpl {
+  public:
+    int64_t period;
+    int64_t inner;
+
+  public:
+    RepeatRowIndexImpl(int64_t period, int64_t inner, int64_t length);
+
+    int64_t nth(int64_t i) const override;
+    RowIndexImpl* uplift_from(RowIndexImpl*) override;
+    RowIndexImpl* inverse(int64_t nrows) const override;
+    void shrink(int64_t n) override;
+    RowIndexImpl* shrunk(int64_t n) override;
+    size_t memory_footprint() const override;
+    void verify_integrity() const override;
+
+  protected:
+    friend RowIndex;
+};
+
+
+
 //==============================================================================
 // Main RowIndex class
 //==============================================================================
@@ -182,6 +220,14 @@ class RowIndex {
     static RowIndex from_slices(const arr64_t& starts, const arr64_t& counts,
                                 const arr64_t& steps);
 
+    /**
+     * Construct a virtual "repeat" RowIndex of `length` rows over a frame of
+     * `period` rows (see `RepeatRowIndexImpl`). Typical uses:
+     *   from_repeat(n, 1, n * k)  -- tile all n rows k times over;
+     *   from_repeat(n, k, n * k)  -- repeat each row k times in a row.
+     */
+    static RowIndex from_repeat(int64_t period, int64_t inner, int64_t length);
+
     /**
      * Construct a RowIndex object using an external filter function. The
      * provided filter function is expected to take a range of rows `row0:row1`
@@ -209,6 +255,25 @@ class RowIndex {
 
     static RowIndex from_column(Column* col);
 
+    /**
+     * Construct a RowIndex holding a random sample of `k` out of `nrows`
+     * rows, drawn without replacement (a partial Fisher-Yates shuffle; the
+     * sampled rows come out in random order). The sample is reproducible
+     * for a given `seed`. Only O(k) extra memory is used when `k` is much
+     * smaller than `nrows`, so taking a small sample of a billion-row frame
+     * never materializes a permutation of all the rows.
+     */
+    static RowIndex sample(int64_t nrows, int64_t k, uint64_t seed);
+
+    /**
+     * Construct a RowIndex selecting each of the `nrows` rows independently
+     * with probability `frac` (a Bernoulli sample). The decision for every
+     * row is a pure hash of the row number and the seed, so the selection
+     * is reproducible and is computed in parallel without any shared state.
+     * The resulting index is sorted.
+     */
+    static RowIndex sample_frac(int64_t nrows, double frac, uint64_t seed);
+
     bool operator==(const RowIndex& other) { return impl == other.impl; }
     bool operator!=(const RowIndex& other) { return impl != other.impl; }
     operator bool() const { return impl != nullptr; }
@@ -218,10 +283,19 @@ class RowIndex {
     bool isarr32() const { return impl && impl->type == RI_ARR32; }
     bool isarr64() const { return impl && impl->type == RI_ARR64; }
     bool isarray() const { return isarr32() || isarr64(); }
+    bool isrepeat() const { return impl && impl->type == RI_REPEAT; }
     const void* ptr() const { return static_cast<const void*>(impl); }
 
     int64_t length() const { return impl? impl->length : 0; }
     size_t zlength() const { return static_cast<size_t>(length()); }
+
+    /**
+     * Exact bounds of the indices: every implementation computes these at
+     * construction and maintains them through `uplift`/`shrink`. Consumers
+     * may rely on them to skip per-element checks, e.g. `min() >= 0`
+     * guarantees there are no NA indices, and `max() < nrows` makes bounds
+     * checks inside gather loops redundant.
+     */
     int64_t min() const { return impl? impl->min : 0; }
     int64_t max() const { return impl? impl->max : 0; }
     int64_t nth(int64_t i) const { return impl? impl->nth(i) : 0; }
@@ -229,6 +303,8 @@ class RowIndex {
     const int64_t* indices64() const { return impl_asarray()->indices64(); }
     int64_t slice_start() const { return impl_asslice()->start; }
     int64_t slice_step() const { return impl_asslice()->step; }
+    int64_t repeat_period() const { return impl_asrepeat()->period; }
+    int64_t repeat_inner() const { return impl_asrepeat()->inner; }
 
     arr32_t extract_as_array32() const;
     RowIndex inverse(int64_t nrows) const;
@@ -275,6 +351,9 @@ class RowIndex {
     SliceRowIndexImpl* impl_asslice() const {
       return static_cast<SliceRowIndexImpl*>(impl);
     }
+    RepeatRowIndexImpl* impl_asrepeat() const {
+      return static_cast<RepeatRowIndexImpl*>(impl);
+    }
 };
 
 
@@ -317,6 +396,14 @@ void RowIndex::strided_loop(
       }
       break;
     }
+    case RI_REPEAT: {
+      int64_t period = repeat_period();
+      int64_t inner = repeat_inner();
+      for (int64_t i = istart; i < iend; i += istep) {
+        f((i / inner) % period);
+      }
+      break;
+    }
   }
 }
 
@@ -358,6 +445,14 @@ void RowIndex::strided_loop2(
       }
       break;
     }
+    case RI_REPEAT: {
+      int64_t period = repeat_period();
+      int64_t inner = repeat_inner();
+      for (int64_t i = istart; i < iend; i += istep) {
+        f(i, (i / inner) % period);
+      }
+      break;
+    }
   }
 }
 
@@ -14,6 +14,8 @@
 #include "utils/exceptions.h"  // ValueError, RuntimeError
 #include "utils/assert.h"
 #include "utils/omp.h"
+#include <random>              // std::mt19937_64, std::uniform_int_distribution
+#include <unordered_map>
 
 
 
@@ -270,6 +272,50 @@ void ArrayRowIndexImpl::set_min_max(const dt::array<T>& arr, bool sorted) {
 }
 
 
+/**
+ * Extract the indices of 1-valued entries from the boolean mask `data` into
+ * the output array `out`, in parallel. This treats the mask as a bitmap and
+ * computes each chunk's write position as the "rank" of its first element:
+ * the first pass counts the selected rows within each chunk, an exclusive
+ * prefix sum over the chunk counts then gives every chunk its output offset,
+ * and the second pass writes the indices with no inter-thread coordination.
+ */
+template <typename T>
+static void _fill_from_mask(const int8_t* data, int64_t n, dt::array<T>& out) {
+  int64_t rows_per_chunk = 65536;
+  int64_t num_chunks = (n + rows_per_chunk - 1) / rows_per_chunk;
+  dt::array<int64_t> counts(static_cast<size_t>(num_chunks));
+
+  #pragma omp parallel for schedule(static)
+  for (int64_t c = 0; c < num_chunks; ++c) {
+    int64_t row0 = c * rows_per_chunk;
+    int64_t row1 = std::min(row0 + rows_per_chunk, n);
+    int64_t cnt = 0;
+    for (int64_t i = row0; i < row1; ++i) {
+      cnt += (data[i] == 1);
+    }
+    counts[static_cast<size_t>(c)] = cnt;
+  }
+
+  int64_t total = 0;
+  for (int64_t c = 0; c < num_chunks; ++c) {
+    int64_t t = counts[static_cast<size_t>(c)];
+    counts[static_cast<size_t>(c)] = total;
+    total += t;
+  }
+
+  #pragma omp parallel for schedule(static)
+  for (int64_t c = 0; c < num_chunks; ++c) {
+    int64_t row0 = c * rows_per_chunk;
+    int64_t row1 = std::min(row0 + rows_per_chunk, n);
+    size_t k = static_cast<size_t>(counts[static_cast<size_t>(c)]);
+    for (int64_t i = row0; i < row1; ++i) {
+      if (data[i] == 1) out[k++] = static_cast<T>(i);
+    }
+  }
+}
+
+
 void ArrayRowIndexImpl::init_from_boolean_column(BoolColumn* col) {
   const int8_t* data = col->elements_r();
   length = col->sum();  // total # of 1s in the column
@@ -280,25 +326,34 @@ void ArrayRowIndexImpl::init_from_boolean_column(BoolColumn* col) {
     type = RowIndexType::RI_ARR32;
     return;
   }
+  bool plain = !col->rowindex();
   if (length <= INT32_MAX && col->nrows <= INT32_MAX) {
     type = RowIndexType::RI_ARR32;
     ind32.resize(zlen);
-    size_t k = 0;
-    col->rowindex().strided_loop(0, col->nrows, 1,
-      [&](int64_t i) {
-        if (data[i] == 1)
-          ind32[k++] = static_cast<int32_t>(i);
-      });
+    if (plain) {
+      _fill_from_mask<int32_t>(data, col->nrows, ind32);
+    } else {
+      size_t k = 0;
+      col->rowindex().strided_loop(0, col->nrows, 1,
+        [&](int64_t i) {
+          if (data[i] == 1)
+            ind32[k++] = static_cast<int32_t>(i);
+        });
+    }
     set_min_max(ind32, true);
   } else {
     type = RowIndexType::RI_ARR64;
     ind64.resize(zlen);
-    size_t k = 0;
-    col->rowindex().strided_loop(0, col->nrows, 1,
-      [&](int64_t i) {
-        if (data[i] == 1)
-          ind64[k++] = i;
-      });
+    if (plain) {
+      _fill_from_mask<int64_t>(data, col->nrows, ind64);
+    } else {
+      size_t k = 0;
+      col->rowindex().strided_loop(0, col->nrows, 1,
+        [&](int64_t i) {
+          if (data[i] == 1)
+            ind64[k++] = i;
+        });
+    }
     set_min_max(ind64, true);
   }
 }
@@ -351,11 +406,13 @@ RowIndexImpl* ArrayRowIndexImpl::uplift_from(RowIndexImpl* rii) {
     int64_t step  = srii->step;
     arr64_t rowsres(zlen);
     if (type == RowIndexType::RI_ARR32) {
-      for (size_t i = 0; i < zlen; ++i) {
+      #pragma omp parallel for schedule(static)
+      for (int64_t i = 0; i < length; ++i) {
         rowsres[i] = start + static_cast<int64_t>(ind32[i]) * step;
       }
     } else {
-      for (size_t i = 0; i < zlen; ++i) {
+      #pragma omp parallel for schedule(static)
+      for (int64_t i = 0; i < length; ++i) {
         rowsres[i] = start + ind64[i] * step;
       }
     }
@@ -368,7 +425,8 @@ RowIndexImpl* ArrayRowIndexImpl::uplift_from(RowIndexImpl* rii) {
     arr32_t rowsres(zlen);
     int32_t* rows_ab = arii->ind32.data();
     int32_t* rows_bc = ind32.data();
-    for (size_t i = 0; i < zlen; ++i) {
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < length; ++i) {
       rowsres[i] = rows_ab[rows_bc[i]];
     }
     return new ArrayRowIndexImpl(std::move(rowsres), false);
@@ -379,21 +437,24 @@ RowIndexImpl* ArrayRowIndexImpl::uplift_from(RowIndexImpl* rii) {
     if (uptype == RowIndexType::RI_ARR32 && type == RowIndexType::RI_ARR64) {
       int32_t* rows_ab = arii->ind32.data();
       int64_t* rows_bc = ind64.data();
-      for (size_t i = 0; i < zlen; ++i) {
+      #pragma omp parallel for schedule(static)
+      for (int64_t i = 0; i < length; ++i) {
         rowsres[i] = rows_ab[rows_bc[i]];
       }
     }
     if (uptype == RowIndexType::RI_ARR64 && type == RowIndexType::RI_ARR32) {
       int64_t* rows_ab = arii->ind64.data();
       int32_t* rows_bc = ind32.data();
-      for (size_t i = 0; i < zlen; ++i) {
+      #pragma omp parallel for schedule(static)
+      for (int64_t i = 0; i < length; ++i) {
         rowsres[i] = rows_ab[rows_bc[i]];
       }
     }
     if (uptype == RowIndexType::RI_ARR64 && type == RowIndexType::RI_ARR64) {
       int64_t* rows_ab = arii->ind64.data();
       int64_t* rows_bc = ind64.data();
-      for (size_t i = 0; i < zlen; ++i) {
+      #pragma omp parallel for schedule(static)
+      for (int64_t i = 0; i < length; ++i) {
         rowsres[i] = rows_ab[rows_bc[i]];
       }
     }
@@ -478,6 +539,13 @@ void ArrayRowIndexImpl::shrink(int64_t n) {
     ind64.resize(static_cast<size_t>(n));
   }
   length = n;
+  // Recompute the bounds: consumers rely on `min`/`max` being exact (not
+  // merely conservative) to elide per-element checks in gather loops.
+  if (type == RowIndexType::RI_ARR32) {
+    set_min_max(ind32, false);
+  } else {
+    set_min_max(ind64, false);
+  }
 }
 
 RowIndexImpl* ArrayRowIndexImpl::shrunk(int64_t n) {
@@ -555,3 +623,147 @@ void ArrayRowIndexImpl::verify_integrity() const {
         << "ind32 and ind64 are both non-empty in an ArrayRowIndex";
   }
 }
+
+
+
+//==============================================================================
+// Random sampling
+//==============================================================================
+
+// Mix a 64-bit value into a well-distributed hash (splitmix64 finalizer).
+// Used to make independent per-row Bernoulli decisions without any RNG
+// state shared between threads.
+static inline uint64_t mix64(uint64_t x) {
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4B9F9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+
+// Fill `out` (an array of `k` elements) with a uniform random sample of
+// `k` distinct values from the range [0; nrows), in random order.
+//
+// When the sample is a sizable portion of the range we run a plain partial
+// Fisher-Yates shuffle over a materialized identity array: after `k` swap
+// steps its first `k` entries are the sample. When `k` is small relative
+// to `nrows` the identity array is kept virtual instead: a hash map
+// records only the entries displaced by the swaps, so the memory cost is
+// O(k) no matter how large the frame is.
+template <typename T>
+static void sample_fill(T* out, int64_t nrows, int64_t k, uint64_t seed)
+{
+  std::mt19937_64 rng(seed);
+  if (k >= nrows / 64) {
+    dt::array<T> pool(static_cast<size_t>(nrows));
+    T* poolp = pool.data();
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < nrows; ++i) {
+      poolp[i] = static_cast<T>(i);
+    }
+    for (int64_t i = 0; i < k; ++i) {
+      std::uniform_int_distribution<int64_t> dist(i, nrows - 1);
+      std::swap(poolp[i], poolp[dist(rng)]);
+      out[i] = poolp[i];
+    }
+  } else {
+    std::unordered_map<int64_t, int64_t> displaced;
+    displaced.reserve(static_cast<size_t>(2 * k));
+    for (int64_t i = 0; i < k; ++i) {
+      std::uniform_int_distribution<int64_t> dist(i, nrows - 1);
+      int64_t j = dist(rng);
+      auto itj = displaced.find(j);
+      int64_t vj = (itj == displaced.end())? j : itj->second;
+      auto iti = displaced.find(i);
+      int64_t vi = (iti == displaced.end())? i : iti->second;
+      displaced[j] = vi;
+      out[i] = static_cast<T>(vj);
+    }
+  }
+}
+
+
+RowIndex RowIndex::sample(int64_t nrows, int64_t k, uint64_t seed)
+{
+  if (nrows < 0 || k < 0 || k > nrows) {
+    throw ValueError() << "Cannot sample " << k << " rows out of " << nrows;
+  }
+  if (k == 0) {
+    return RowIndex::from_slice(0, 0, 1);
+  }
+  if (nrows <= std::numeric_limits<int32_t>::max()) {
+    arr32_t ind(static_cast<size_t>(k));
+    sample_fill<int32_t>(ind.data(), nrows, k, seed);
+    return RowIndex::from_array32(std::move(ind));
+  } else {
+    arr64_t ind(static_cast<size_t>(k));
+    sample_fill<int64_t>(ind.data(), nrows, k, seed);
+    return RowIndex::from_array64(std::move(ind));
+  }
+}
+
+
+// Two-pass chunked Bernoulli selection: every chunk first counts its
+// selected rows, the counts are turned into output offsets, and a second
+// pass writes the row numbers. The per-row decision re-hashes (row, seed),
+// so both passes agree without storing any intermediate flags.
+template <typename T>
+static void sample_frac_fill(dt::array<T>& ind, int64_t nrows,
+                             uint64_t threshold, uint64_t seed)
+{
+  int nchunks = omp_get_max_threads();
+  int64_t chunklen = (nrows + nchunks - 1) / nchunks;
+  if (chunklen <= 0) { nchunks = 1; chunklen = 1; }
+  std::vector<int64_t> counts(static_cast<size_t>(nchunks + 1), 0);
+
+  #pragma omp parallel for schedule(static, 1)
+  for (int c = 0; c < nchunks; ++c) {
+    int64_t i0 = c * chunklen;
+    int64_t i1 = std::min(i0 + chunklen, nrows);
+    int64_t cnt = 0;
+    for (int64_t i = i0; i < i1; ++i) {
+      cnt += (mix64(static_cast<uint64_t>(i) ^ seed) < threshold);
+    }
+    counts[static_cast<size_t>(c) + 1] = cnt;
+  }
+  for (int c = 0; c < nchunks; ++c) {
+    counts[static_cast<size_t>(c) + 1] += counts[static_cast<size_t>(c)];
+  }
+
+  ind.resize(static_cast<size_t>(counts[static_cast<size_t>(nchunks)]));
+  T* indp = ind.data();
+  #pragma omp parallel for schedule(static, 1)
+  for (int c = 0; c < nchunks; ++c) {
+    int64_t i0 = c * chunklen;
+    int64_t i1 = std::min(i0 + chunklen, nrows);
+    int64_t o = counts[static_cast<size_t>(c)];
+    for (int64_t i = i0; i < i1; ++i) {
+      if (mix64(static_cast<uint64_t>(i) ^ seed) < threshold) {
+        indp[o++] = static_cast<T>(i);
+      }
+    }
+  }
+}
+
+
+RowIndex RowIndex::sample_frac(int64_t nrows, double frac, uint64_t seed)
+{
+  if (nrows < 0 || frac < 0 || frac > 1) {
+    throw ValueError() << "Invalid sampling fraction " << frac
+        << ": must be in the range [0; 1]";
+  }
+  if (frac >= 1.0) {
+    return RowIndex::from_slice(0, nrows, 1);
+  }
+  // Select row i iff hash(i, seed) < frac * 2^64.
+  uint64_t threshold = static_cast<uint64_t>(frac * 18446744073709551616.0);
+  if (nrows <= std::numeric_limits<int32_t>::max()) {
+    arr32_t ind;
+    sample_frac_fill<int32_t>(ind, nrows, threshold, seed);
+    return RowIndex::from_array32(std::move(ind), true);
+  } else {
+    arr64_t ind;
+    sample_frac_fill<int64_t>(ind, nrows, threshold, seed);
+    return RowIndex::from_array64(std::move(ind), true);
+  }
+}
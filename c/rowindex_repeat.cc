@@ -0,0 +1,161 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include "rowindex.h"
+#include <algorithm>           // std::min
+#include "utils/assert.h"      // xassert
+#include "utils/exceptions.h"  // ValueError, RuntimeError
+#include "utils/omp.h"
+
+
+//------------------------------------------------------------------------------
+// RepeatRowIndexImpl implementation
+//------------------------------------------------------------------------------
+
+RepeatRowIndexImpl::RepeatRowIndexImpl(int64_t period_, int64_t inner_,
+                                       int64_t length_) {
+  if (period_ <= 0 || inner_ <= 0 || length_ < 0) {
+    throw ValueError() << "Invalid repeat RowIndex [period=" << period_
+                       << ", inner=" << inner_ << ", length=" << length_
+                       << "]";
+  }
+  type = RowIndexType::RI_REPEAT;
+  period = period_;
+  inner = inner_;
+  length = length_;
+  if (length == 0) {
+    min = max = 0;
+  } else {
+    min = 0;
+    max = std::min(period - 1, (length - 1) / inner);
+  }
+}
+
+
+int64_t RepeatRowIndexImpl::nth(int64_t i) const {
+  return (i / inner) % period;
+}
+
+
+/**
+ * Composition of a repeat index with any parent selection is no longer
+ * expressible arithmetically in general, so it materializes into an
+ * explicit array (32-bit whenever both the parent's indices and our length
+ * permit it). In the common lazy pipelines the repeat index sits directly
+ * over plain data columns and this is never reached.
+ */
+RowIndexImpl* RepeatRowIndexImpl::uplift_from(RowIndexImpl* rii) {
+  RowIndexType uptype = rii->type;
+  size_t zlen = static_cast<size_t>(length);
+  int64_t period_ = period;
+  int64_t inner_ = inner;
+
+  if (uptype == RI_SLICE) {
+    SliceRowIndexImpl* srii = static_cast<SliceRowIndexImpl*>(rii);
+    int64_t ustart = srii->start;
+    int64_t ustep = srii->step;
+    if (rii->max <= INT32_MAX && length <= INT32_MAX) {
+      arr32_t res(zlen);
+      #pragma omp parallel for schedule(static)
+      for (int64_t i = 0; i < length; ++i) {
+        res[static_cast<size_t>(i)] =
+            static_cast<int32_t>(ustart + ((i / inner_) % period_) * ustep);
+      }
+      return new ArrayRowIndexImpl(std::move(res), false);
+    }
+    arr64_t res(zlen);
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < length; ++i) {
+      res[static_cast<size_t>(i)] = ustart + ((i / inner_) % period_) * ustep;
+    }
+    return new ArrayRowIndexImpl(std::move(res), false);
+  }
+
+  if (uptype == RI_ARR32) {
+    ArrayRowIndexImpl* arii = static_cast<ArrayRowIndexImpl*>(rii);
+    const int32_t* srcrows = arii->indices32();
+    arr32_t res(zlen);
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < length; ++i) {
+      res[static_cast<size_t>(i)] = srcrows[(i / inner_) % period_];
+    }
+    return new ArrayRowIndexImpl(std::move(res), false);
+  }
+
+  if (uptype == RI_ARR64) {
+    ArrayRowIndexImpl* arii = static_cast<ArrayRowIndexImpl*>(rii);
+    const int64_t* srcrows = arii->indices64();
+    arr64_t res(zlen);
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < length; ++i) {
+      res[static_cast<size_t>(i)] = srcrows[(i / inner_) % period_];
+    }
+    return new ArrayRowIndexImpl(std::move(res), false);
+  }
+
+  if (uptype == RI_REPEAT) {
+    RepeatRowIndexImpl* rrii = static_cast<RepeatRowIndexImpl*>(rii);
+    arr64_t res(zlen);
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < length; ++i) {
+      res[static_cast<size_t>(i)] = rrii->nth((i / inner_) % period_);
+    }
+    return new ArrayRowIndexImpl(std::move(res), false);
+  }
+
+  throw RuntimeError() << "Unknown RowIndexType " << uptype;
+}
+
+
+RowIndexImpl* RepeatRowIndexImpl::inverse(int64_t) const {
+  // A repeat mapping selects source rows multiple times, so there is no
+  // well-defined complement.
+  throw RuntimeError() << "Cannot invert a repeat RowIndex";
+}
+
+
+void RepeatRowIndexImpl::shrink(int64_t n) {
+  length = n;
+  if (length == 0) {
+    min = max = 0;
+  } else {
+    min = 0;
+    max = std::min(period - 1, (length - 1) / inner);
+  }
+}
+
+RowIndexImpl* RepeatRowIndexImpl::shrunk(int64_t n) {
+  return new RepeatRowIndexImpl(period, inner, n);
+}
+
+
+size_t RepeatRowIndexImpl::memory_footprint() const {
+  return sizeof(*this);
+}
+
+
+void RepeatRowIndexImpl::verify_integrity() const {
+  RowIndexImpl::verify_integrity();
+
+  if (type != RowIndexType::RI_REPEAT) {
+    throw AssertionError() << "Invalid type = " << type
+                           << " in a RepeatRowIndex";
+  }
+  if (period <= 0 || inner <= 0) {
+    throw AssertionError() << "Invalid repeat rowindex: period = " << period
+                           << ", inner = " << inner;
+  }
+  if (length > 0) {
+    int64_t maxrow = std::min(period - 1, (length - 1) / inner);
+    if (min != 0 || max != maxrow) {
+      throw AssertionError()
+          << "Invalid min/max values in a Repeat RowIndex [period=" << period
+          << ", inner=" << inner << ", length=" << length << "]: min = "
+          << min << ", max = " << max;
+    }
+  }
+}
@@ -9,6 +9,7 @@
 #include <algorithm>           // std::swap, std::move
 #include "utils/assert.h"      // xassert
 #include "utils/exceptions.h"  // ValueError, RuntimeError
+#include "utils/omp.h"
 
 
 /**
@@ -101,10 +102,9 @@ RowIndexImpl* SliceRowIndexImpl::uplift_from(RowIndexImpl* rii) {
     ArrayRowIndexImpl* arii = static_cast<ArrayRowIndexImpl*>(rii);
     arr32_t res(zlen);
     const int32_t* srcrows = arii->indices32();
-    int64_t j = start;
-    for (size_t i = 0; i < zlen; ++i) {
-      res[i] = srcrows[j];
-      j += step;
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < length; ++i) {
+      res[i] = srcrows[start + i * step];
     }
     return new ArrayRowIndexImpl(std::move(res), false);
   }
@@ -113,10 +113,9 @@ RowIndexImpl* SliceRowIndexImpl::uplift_from(RowIndexImpl* rii) {
     ArrayRowIndexImpl* arii = static_cast<ArrayRowIndexImpl*>(rii);
     arr64_t res(zlen);
     const int64_t* srcrows = arii->indices64();
-    int64_t j = start;
-    for (size_t i = 0; i < zlen; ++i) {
-      res[i] = srcrows[j];
-      j += step;
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < length; ++i) {
+      res[i] = srcrows[start + i * step];
     }
     return new ArrayRowIndexImpl(std::move(res), false);
   }
@@ -198,6 +197,14 @@ RowIndexImpl* SliceRowIndexImpl::inverse(int64_t nrows) const {
 
 void SliceRowIndexImpl::shrink(int64_t n) {
   length = n;
+  // Keep the bounds exact after truncation (see ArrayRowIndexImpl::shrink).
+  if (length == 0) {
+    min = max = 0;
+  } else {
+    min = start;
+    max = start + step * (length - 1);
+    if (step < 0) std::swap(min, max);
+  }
 }
 
 RowIndexImpl* SliceRowIndexImpl::shrunk(int64_t n) {
@@ -49,7 +49,7 @@
 //    For integers, this transformation is merely subtracting the min value and
 //    relocating NA to the beginning of the range. For floats, we perform a
 //    more complicated bit twiddling (see description below). For strings the
-//    data cannot be prepared "fully", so we merely map the first byte into `x`.
+//    data cannot be prepared "fully", so we pack the first two bytes into `x`.
 //
 // 2. Build histogram.
 //
@@ -71,8 +71,8 @@
 //    computed in the previous step. Also, update values of `x` if further
 //    sorting is needed. Here "updating" involves removing the initial radix
 //    prefix (which was already sorted), sometimes also reducing the elemsize
-//    of `x`. For strings we copy the next character of each string into the
-//    buffer `x`.
+//    of `x`. For strings we pack the next two characters of each string into
+//    the buffer `x`.
 //
 // 4. Recursion.
 //
@@ -112,17 +112,83 @@
 #include <algorithm>  // std::min
 #include <cstdlib>    // std::abs
 #include <cstring>    // std::memset, std::memcpy
+#include <limits>     // std::numeric_limits
+#include <string>     // std::string, std::to_string
 #include <vector>     // std::vector
+#include <unistd.h>   // getpid
 #include "column.h"
 #include "datatable.h"
+#include "memrange.h"
 #include "options.h"
+#include "perf.h"
 #include "rowindex.h"
 #include "types.h"
 #include "utils.h"
 #include "utils/alloc.h"
 #include "utils/array.h"
 #include "utils/assert.h"
+#include "utils/interrupts.h"
 #include "utils/omp.h"
+#include "utils/progress.h"
+
+
+/**
+ * Stable sort for "medium"-sized radix subgroups: too big for insertion
+ * sort's O(n²) behavior, yet too small to be worth a one-at-a-time parallel
+ * radix pass. These are sorted with std::stable_sort inside the parallel
+ * small-groups loop of `_radix_recurse()`, so that skewed radix
+ * distributions do not serialize the whole sort.
+ *
+ * `x` is the array of prepared keys for this subgroup (indexed by position),
+ * `o` is the subgroup's slice of the global ordering, and `oo` is scratch
+ * space of at least `n` elements.
+ */
+template <typename T, typename V>
+static void stable_sort_keys(const T* x, V* o, V* oo, int n, GroupGatherer& gg)
+{
+  for (int i = 0; i < n; ++i) oo[i] = static_cast<V>(i);
+  std::stable_sort(oo, oo + n,
+                   [=](V a, V b) { return x[a] < x[b]; });
+  std::vector<V> tmp(o, o + n);
+  for (int i = 0; i < n; ++i) o[i] = tmp[static_cast<size_t>(oo[i])];
+  if (gg) gg.from_data(x, oo, static_cast<size_t>(n));
+}
+
+template <typename T, typename V>
+static void stable_sort_keys_str(
+    const uint8_t* strdata, const T* stroffs, T ss, V* o, int n,
+    GroupGatherer& gg, const uint8_t* xform)
+{
+  std::stable_sort(o, o + n,
+      [=](V a, V b) {
+        // compare_offstrings() returns +1 when string `a` orders before `b`
+        return compare_offstrings<T>(
+                  strdata,
+                  (stroffs[a - 1] & ~GETNA<T>()) + ss, stroffs[a],
+                  (stroffs[b - 1] & ~GETNA<T>()) + ss, stroffs[b],
+                  xform) > 0;
+      });
+  if (gg) gg.from_data(strdata, stroffs, ss, o, static_cast<size_t>(n), xform);
+}
+
+
+/**
+ * ASCII case-folding table for case-insensitive sorts: maps 'A'..'Z' onto
+ * 'a'..'z' and leaves every other byte -- including UTF-8 lead and
+ * continuation bytes -- unchanged. The table is applied to bytes as they are
+ * read during key extraction and comparisons, so no folded copy of the
+ * column is ever materialized. A locale-collation sort would plug in here as
+ * a different table (or a multi-byte variant of the same hook).
+ */
+static const uint8_t* casefold_table() {
+  static const uint8_t* table = []() -> const uint8_t* {
+    static uint8_t t[256];
+    for (int i = 0; i < 256; ++i) t[i] = static_cast<uint8_t>(i);
+    for (int i = 'A'; i <= 'Z'; ++i) t[i] = static_cast<uint8_t>(i + 32);
+    return t;
+  }();
+  return table;
+}
 
 
 /**
@@ -236,6 +302,10 @@ class SortContext {
     GroupGatherer gg;
     const uint8_t* strdata;
     const void* stroffs;
+    // Optional 256-byte translation table applied to string bytes during key
+    // extraction and comparisons (see `casefold_table()`); nullptr when the
+    // sort is plain byte order.
+    const uint8_t* strxform;
     size_t strstart;
     size_t n;
     size_t nth;
@@ -249,55 +319,117 @@ class SortContext {
     int8_t shift;
     int8_t strtype;
     bool use_order;
-    int : 16;
+    // When the key transform turns out to be the identity, `x` may alias the
+    // column's own buffer instead of a private copy; `unowned_x` remembers
+    // that pointer so that it is never mistaken for scratch memory. Aliasing
+    // is only permitted for single-column sorts (`may_alias_input`).
+    void* unowned_x;
+    bool may_alias_input;
+    int : 8;
+    // When set, the radix recursion reports per-thread busy times to this
+    // timer, from which the imbalance metric is derived (see perf.h)
+    dt::perf::OpTimer* optimer = nullptr;
+    // Transient buffers (`x`, `next_x`, `histogram`) are drawn from the
+    // thread-local arena via `alloc_scratch()`; this vector keeps them alive
+    // for the duration of the sort, and releases them in bulk at the end.
+    std::vector<MemoryRange> scratch;
 
   public:
-  SortContext(const Column* col, bool make_groups) {
-    next_x = nullptr;
-    next_o = nullptr;
-    histogram = nullptr;
-    strdata = nullptr;
-    histogram_size = 0;
-    strtype = 0;
+  size_t n_threads_used() const { return nth; }
+  size_t n_chunks_used() const { return nchunks; }
+  void set_optimer(dt::perf::OpTimer* t) { optimer = t; }
+
+  SortContext(const Column* col, bool make_groups, bool case_fold = false) {
+    _init_common(col, make_groups);
+    may_alias_input = !case_fold;
+    if (case_fold) strxform = casefold_table();
+    _prepare_input(col);
+  }
 
-    nth = static_cast<size_t>(config::sort_nthreads);
-    n = static_cast<size_t>(col->nrows);
-    order = (col->rowindex()).extract_as_array32();
-    use_order = static_cast<bool>(order);
-    if (!use_order) order.resize(n);
-    o = order.data();
-    if (make_groups) {
-      groups.resize(n + 1);
-      groups[0] = 0;
-      gg.init(groups.data() + 1, 0);
-    }
-    // These will initialize `x`, `elemsize` and `nsigbits`, and also
-    // `strdata`, `stroffs`, `strstart` for string columns
-    SType stype = col->stype();
-    switch (stype) {
-      case SType::BOOL:    _initB(col); break;
-      case SType::INT8:    _initI<int8_t,  uint8_t>(col); break;
-      case SType::INT16:   _initI<int16_t, uint16_t>(col); break;
-      case SType::INT32:   _initI<int32_t, uint32_t>(col); break;
-      case SType::INT64:   _initI<int64_t, uint64_t>(col); break;
-      case SType::FLOAT32: _initF<uint32_t>(col); break;
-      case SType::FLOAT64: _initF<uint64_t>(col); break;
-      case SType::STR32:   _initS<uint32_t>(col); break;
-      case SType::STR64:   _initS<uint64_t>(col); break;
-      default:
-        throw NotImplError() << "Unable to sort Column of stype " << stype;
+  /**
+   * Multi-column sorting constructor: the prepared keys of all columns are
+   * fused into a single composite radix stream, so that a sort by several
+   * keys is performed in one pass over the data instead of one pass per key.
+   * All columns must be fixed-width, and the total number of significant
+   * bits across all keys must not exceed 64 (the caller is expected to have
+   * verified this via `sort_key_bitwidth()`).
+   */
+  SortContext(const std::vector<const Column*>& cols, bool make_groups) {
+    xassert(cols.size() > 1);
+    _init_common(cols[0], make_groups);
+
+    // Prepare each column separately, stashing away its key buffer. Each
+    // `_prepare_input()` call fills `x` / `elemsize` / `nsigbits` for one
+    // column; we collect those triples and then fuse them.
+    std::vector<void*>  xs;
+    std::vector<int8_t> elemsizes;
+    std::vector<int8_t> bits;
+    int8_t totalbits = 0;
+    for (const Column* col : cols) {
+      x = nullptr;
+      _prepare_input(col);
+      xassert(strtype == 0);
+      xs.push_back(x);
+      elemsizes.push_back(elemsize);
+      bits.push_back(nsigbits);
+      totalbits += nsigbits;
     }
+    x = nullptr;
+    xassert(totalbits <= 64);
+
+    if (totalbits > 32)      _fuse_keys<uint64_t>(xs, elemsizes, bits);
+    else if (totalbits > 16) _fuse_keys<uint32_t>(xs, elemsizes, bits);
+    else if (totalbits > 8)  _fuse_keys<uint16_t>(xs, elemsizes, bits);
+    else                     _fuse_keys<uint8_t >(xs, elemsizes, bits);
+    nsigbits = totalbits;
+    // The per-column key buffers in `xs` are arena scratch; they are
+    // released in bulk when the context is destroyed.
   }
 
   SortContext(const SortContext&) = delete;
   SortContext& operator=(const SortContext&) = delete;
 
   ~SortContext() {
-    std::free(x);
-    std::free(next_x);
-    std::free(histogram);
+    // `x`, `next_x` and `histogram` are owned by the `scratch` vector
     // Note: `o` is not owned by this class, see `initialize()`
     delete[] next_o;
+    config::release_thread_grant(static_cast<int32_t>(nth));
+  }
+
+
+  /**
+   * Allocate `nbytes` of transient memory from the thread-local arena (see
+   * MemoryRange::scratch). The returned pointer is valid until the
+   * SortContext is destroyed; individual buffers are never freed one by one.
+   *
+   * If `sort.spill_threshold` is set and the request is at least that big,
+   * the buffer is instead backed by a temporary memory-mapped file (removed
+   * automatically when the sort ends). The kernel then pages the scratch in
+   * and out on demand, so the sort's physical memory use stays within a
+   * fixed envelope at some I/O cost. Since `_radix_recurse` processes large
+   * radix partitions one at a time, only the current partition's pages need
+   * to be resident at any moment.
+   */
+  void* alloc_scratch(size_t nbytes) {
+    size_t spill = config::sort_spill_threshold;
+    if (spill && nbytes >= spill) {
+      scratch.push_back(MemoryRange::mmap(scratch_file_path(), nbytes));
+    } else {
+      scratch.push_back(MemoryRange::scratch(nbytes));
+    }
+    return scratch.back().wptr();
+  }
+
+  // Unique path for a spilled scratch file, in TMPDIR (default /tmp)
+  static std::string scratch_file_path() {
+    static int seq = 0;
+    int id;
+    #pragma omp atomic capture
+    id = seq++;
+    const char* tmpdir = std::getenv("TMPDIR");
+    if (!tmpdir) tmpdir = "/tmp";
+    return std::string(tmpdir) + "/datatable-sort-" +
+           std::to_string(getpid()) + "-" + std::to_string(id) + ".tmp";
   }
 
 
@@ -308,9 +440,90 @@ class SortContext {
       } else {
         vinsert_sort();
       }
+    } else if (!strtype && nsigbits <= 16) {
+      counting_sort();
     } else {
+      // The radix path can run for minutes on billions of rows, so it is
+      // cancellable: the recursion polls for pending Python signals once
+      // per radix range, and an interrupt makes the remaining ranges
+      // no-ops. The (garbage) ordering is discarded here by rethrowing
+      // the KeyboardInterrupt after all phases have wound down.
+      dt::clear_interrupt();
+      // Progress is counted in rows: a row is "done" once it has reached
+      // its final position in some leaf of the radix recursion.
+      dt::progress::work pjob("sort", static_cast<int64_t>(n));
       radix_psort();
+      dt::throw_if_interrupted();
+    }
+  }
+
+
+  /**
+   * Instead of sorting, select the `k` extreme elements of the data and
+   * return their row numbers, in sorted order. When `smallest` is true the
+   * `k` smallest elements are returned (NAs, which map to 0 during key
+   * preparation, come first just like in a full sort); otherwise the `k`
+   * largest. This is O(n log k) work instead of a full radix sort.
+   */
+  RowIndex select_topk(size_t k, bool smallest) {
+    xassert(k > 0 && k < n);
+    switch (elemsize) {
+      case 1: return _topk_impl<uint8_t >(k, smallest);
+      case 2: return _topk_impl<uint16_t>(k, smallest);
+      case 4: return _topk_impl<uint32_t>(k, smallest);
+      case 8: return _topk_impl<uint64_t>(k, smallest);
     }
+    throw RuntimeError() << "Invalid elemsize in select_topk: " << elemsize;
+  }
+
+  template <typename T>
+  RowIndex _topk_impl(size_t k, bool smallest) {
+    const T* xt = static_cast<const T*>(x);
+    // Comparator over element indices: ties are broken by the index itself,
+    // which both makes the selection deterministic and keeps it stable.
+    auto compare = [=](int32_t a, int32_t b) -> bool {
+      T xa = xt[a], xb = xt[b];
+      if (xa != xb) return smallest? (xa < xb) : (xa > xb);
+      return a < b;
+    };
+
+    // Each thread selects the top-k within its own chunk, then the per-chunk
+    // candidates are merged with one final partial sort. The candidate array
+    // is laid out as `nchunks` consecutive stripes of size `k`.
+    size_t nchunks = std::min(nth, (n - 1) / k + 1);
+    size_t chunklen_ = (n - 1) / nchunks + 1;
+    arr32_t candidates(nchunks * k);
+    std::vector<size_t> ncands(nchunks);
+    int32_t* cand = candidates.data();
+
+    #pragma omp parallel for schedule(static) num_threads(nchunks)
+    for (size_t i = 0; i < nchunks; ++i) {
+      size_t j0 = i * chunklen_;
+      size_t j1 = std::min(j0 + chunklen_, n);
+      std::vector<int32_t> idx(j1 - j0);
+      for (size_t j = j0; j < j1; ++j) idx[j - j0] = static_cast<int32_t>(j);
+      size_t kk = std::min(k, idx.size());
+      std::partial_sort(idx.begin(), idx.begin() + static_cast<long>(kk),
+                        idx.end(), compare);
+      std::memcpy(cand + i * k, idx.data(), kk * sizeof(int32_t));
+      ncands[i] = kk;
+    }
+
+    // Compact the per-chunk stripes (the last one may be incomplete), then
+    // merge all candidates with one final partial sort.
+    size_t ncand = ncands[0];
+    for (size_t i = 1; i < nchunks; ++i) {
+      std::memmove(cand + ncand, cand + i * k, ncands[i] * sizeof(int32_t));
+      ncand += ncands[i];
+    }
+    std::partial_sort(cand, cand + static_cast<long>(k), cand + ncand, compare);
+
+    arr32_t res(k);
+    for (size_t t = 0; t < k; ++t) {
+      int32_t j = cand[t];
+      res[t] = use_order? o[j] : j;
+    }
+    return RowIndex::from_array32(std::move(res));
   }
 
 
@@ -330,6 +543,101 @@ class SortContext {
   // Data preparation
   //============================================================================
 
+  /**
+   * Initialize fields that are common to both single-column and multi-column
+   * sorting: the ordering array `o` (taken from the column's rowindex), and
+   * the group-gathering machinery if `make_groups` is requested.
+   */
+  void _init_common(const Column* col, bool make_groups) {
+    next_x = nullptr;
+    next_o = nullptr;
+    histogram = nullptr;
+    strdata = nullptr;
+    strxform = nullptr;
+    histogram_size = 0;
+    strtype = 0;
+    unowned_x = nullptr;
+    may_alias_input = false;
+
+    // The sort's team size is a grant out of the global thread budget, so
+    // that e.g. per-group sorts launched from parallel callers don't stack
+    // full-sized teams on top of each other. Released in the destructor.
+    nth = static_cast<size_t>(
+              config::acquire_thread_grant(config::sort_nthreads));
+    n = static_cast<size_t>(col->nrows);
+    order = (col->rowindex()).extract_as_array32();
+    use_order = static_cast<bool>(order);
+    if (!use_order) order.resize(n);
+    o = order.data();
+    if (make_groups) {
+      groups.resize(n + 1);
+      groups[0] = 0;
+      gg.init(groups.data() + 1, 0);
+    }
+  }
+
+  /**
+   * Initialize `x`, `elemsize` and `nsigbits` from the column's data, and
+   * also `strdata`, `stroffs`, `strstart` for string columns.
+   */
+  void _prepare_input(const Column* col) {
+    SType stype = col->stype();
+    switch (stype) {
+      case SType::BOOL:    _initB(col); break;
+      case SType::INT8:    _initI<int8_t,  uint8_t>(col); break;
+      case SType::INT16:   _initI<int16_t, uint16_t>(col); break;
+      case SType::INT32:   _initI<int32_t, uint32_t>(col); break;
+      case SType::INT64:   _initI<int64_t, uint64_t>(col); break;
+      // Categoricals sort by their codes: the dictionary is kept in
+      // ascending value order, so code order == string order.
+      case SType::CAT32:   _initI<int32_t, uint32_t>(col); break;
+      case SType::FLOAT32: _initF<uint32_t>(col); break;
+      case SType::FLOAT64: _initF<uint64_t>(col); break;
+      case SType::STR32:   _initS<uint32_t>(col); break;
+      case SType::STR64:   _initS<uint64_t>(col); break;
+      default:
+        throw NotImplError() << "Unable to sort Column of stype " << stype;
+    }
+  }
+
+  /**
+   * Concatenate the prepared key arrays `xs` into a single array of composite
+   * keys of type `TO`, stored in `x`. Key `k` of column 0 is placed into the
+   * most significant position, so that the composite keys order the rows
+   * lexicographically by (col0, col1, ...). Each individual key occupies
+   * `bits[k]` bits within the composite; since every prepared key is an
+   * unsigned integer in the range `[0; 2**bits[k])`, the fusion preserves
+   * the relative order of each column's values (including NAs, which map
+   * to 0 during preparation).
+   */
+  template <typename TO>
+  void _fuse_keys(const std::vector<void*>& xs,
+                  const std::vector<int8_t>& elemsizes,
+                  const std::vector<int8_t>& bits)
+  {
+    size_t ncols = xs.size();
+    TO* xo = static_cast<TO*>(alloc_scratch(n * sizeof(TO)));
+    x = static_cast<void*>(xo);
+    elemsize = sizeof(TO);
+
+    #pragma omp parallel for schedule(static) num_threads(nth)
+    for (size_t j = 0; j < n; ++j) {
+      TO key = 0;
+      for (size_t k = 0; k < ncols; ++k) {
+        TO part = 0;
+        switch (elemsizes[k]) {
+          case 1: part = static_cast<TO>(static_cast<uint8_t* >(xs[k])[j]); break;
+          case 2: part = static_cast<TO>(static_cast<uint16_t*>(xs[k])[j]); break;
+          case 4: part = static_cast<TO>(static_cast<uint32_t*>(xs[k])[j]); break;
+          case 8: part = static_cast<TO>(static_cast<uint64_t*>(xs[k])[j]); break;
+        }
+        key = static_cast<TO>(key << bits[k]) | part;
+      }
+      xo[j] = key;
+    }
+  }
+
+
   /**
    * Boolean columns have only 3 distinct values: -128, 0 and 1. The transform
    * `(x + 0xBF) >> 6` converts these to 0, 2 and 3 respectively, provided that
@@ -337,7 +645,7 @@ class SortContext {
    */
   void _initB(const Column* col) {
     const uint8_t* xi = static_cast<const uint8_t*>(col->data());
-    uint8_t* xo = new uint8_t[n];
+    uint8_t* xo = static_cast<uint8_t*>(alloc_scratch(n));
     x = static_cast<void*>(xo);
     elemsize = 1;
     nsigbits = 2;
@@ -371,34 +679,60 @@ class SortContext {
     xassert(sizeof(T) == sizeof(TU));
     T min = icol->min();
     T max = icol->max();
+    // `min()` computes all numerical stats in one pass, so the NA count is
+    // available here for free. Without NAs the 0 key need not be reserved,
+    // and the prepared keys become simply `t - min`.
+    bool has_nas = col->get_stats()->countna(col) > 0;
+    TU top = static_cast<TU>(max - min) + has_nas;
     nsigbits = sizeof(T) * 8;
-    nsigbits -= dt::nlz(static_cast<TU>(max - min + 1));
-    if (nsigbits > 32)      _initI_impl<T, TU, uint64_t>(icol, min);
-    else if (nsigbits > 16) _initI_impl<T, TU, uint32_t>(icol, min);
-    else if (nsigbits > 8)  _initI_impl<T, TU, uint16_t>(icol, min);
-    else                    _initI_impl<T, TU, uint8_t >(icol, min);
+    nsigbits -= dt::nlz(top);
+    if (nsigbits == 0) nsigbits = 1;
+    if (nsigbits > 32)      _initI_impl<T, TU, uint64_t>(icol, min, has_nas);
+    else if (nsigbits > 16) _initI_impl<T, TU, uint32_t>(icol, min, has_nas);
+    else if (nsigbits > 8)  _initI_impl<T, TU, uint16_t>(icol, min, has_nas);
+    else                    _initI_impl<T, TU, uint8_t >(icol, min, has_nas);
   }
 
   template <typename T, typename TI, typename TO>
-  void _initI_impl(const Column* col, T min) {
+  void _initI_impl(const Column* col, T min, bool has_nas) {
     TI una = static_cast<TI>(GETNA<T>());
     TI umin = static_cast<TI>(min);
     const TI* xi = static_cast<const TI*>(col->data());
-    TO* xo = new TO[n];
+
+    // For clean data (no NAs, min == 0, no narrowing of the element size)
+    // the transform is the identity: alias the column's buffer directly
+    // instead of copying it, halving the memory traffic of this step.
+    // Aliasing is only safe when the sort completes in a single radix
+    // pass: with multiple passes `x` and `next_x` swap roles and the
+    // aliased buffer would be written into as scratch, corrupting the
+    // column being sorted. Predict the radix size the same way
+    // determine_sorting_parameters() will.
+    int8_t nradixbits = nsigbits < config::sort_max_radix_bits
+                        ? nsigbits : config::sort_over_radix_bits;
+    if (!has_nas && umin == 0 && sizeof(TO) == sizeof(TI) &&
+        !use_order && may_alias_input && nsigbits == nradixbits) {
+      x = const_cast<void*>(static_cast<const void*>(xi));
+      unowned_x = x;
+      elemsize = sizeof(TO);
+      return;
+    }
+
+    TO* xo = static_cast<TO*>(alloc_scratch(n * sizeof(TO)));
     x = static_cast<void*>(xo);
     elemsize = sizeof(TO);
+    const TO na_off = has_nas? 1 : 0;
 
     if (use_order) {
       #pragma omp parallel for schedule(static) num_threads(nth)
       for (size_t j = 0; j < n; ++j) {
         TI t = xi[o[j]];
-        xo[j] = t == una? 0 : static_cast<TO>(t - umin + 1);
+        xo[j] = t == una? 0 : static_cast<TO>(static_cast<TO>(t - umin) + na_off);
       }
     } else {
       #pragma omp parallel for schedule(static) num_threads(nth)
       for (size_t j = 0; j < n; j++) {
         TI t = xi[j];
-        xo[j] = t == una? 0 : static_cast<TO>(t - umin + 1);
+        xo[j] = t == una? 0 : static_cast<TO>(static_cast<TO>(t - umin) + na_off);
       }
     }
   }
@@ -436,7 +770,7 @@ class SortContext {
   template <typename TO>
   void _initF(const Column* col) {
     const TO* xi = static_cast<const TO*>(col->data());
-    TO* xo = new TO[n];
+    TO* xo = static_cast<TO*>(alloc_scratch(n * sizeof(TO)));
     x = static_cast<void*>(xo);
     elemsize = sizeof(TO);
     nsigbits = elemsize * 8;
@@ -468,15 +802,25 @@ class SortContext {
 
 
   /**
-   * For strings, we fill array `x` with the values of the first 2 characters in
-   * each string. We also set up auxiliary variables `strdata`, `stroffs`,
-   * `strstart` and `strtype`.
+   * For strings, we fill array `x` with 16-bit keys packing the first 2
+   * characters of each string, so that every radix pass discriminates two
+   * characters at once. We also set up auxiliary variables `strdata`,
+   * `stroffs`, `strstart` and `strtype`.
    *
-   * More specifically, for each string item, if it is NA then we map it to 0;
-   * if it is an empty string we map it to 1, otherwise we map it to `ch[i] + 2`
-   * where `ch[i]` is the i-th character of the string. This doesn't overflow
-   * because in UTF-8 the largest legal byte is 0xF7.
+   * The upper byte of each key encodes the first character: 0 if the string
+   * is NA, 1 if it is empty, otherwise `ch[0] + 2` (this doesn't overflow
+   * because in UTF-8 the largest legal byte is 0xF7). The lower byte encodes
+   * the second character as `ch[1] + 2`, or 0 if the string has fewer than 2
+   * characters -- which correctly sorts shorter strings first.
    */
+  // A single string byte as the sort sees it: folded through `strxform`
+  // when a transformed ordering was requested.
+  template <typename T>
+  inline uint8_t _strbyte(T pos) const {
+    uint8_t c = strdata[pos];
+    return strxform? strxform[c] : c;
+  }
+
   template <typename T>
   void _initS(const Column* col) {
     auto scol = static_cast<const StringColumn<T>*>(col);
@@ -485,14 +829,31 @@ class SortContext {
     stroffs = static_cast<const void*>(offs);
     strtype = sizeof(T) / 4;
     strstart = 0;
-    uint8_t* xo = new uint8_t[n];
-    x = static_cast<void*>(xo);
-    elemsize = 1;
-    nsigbits = 8;
 
+    // Scan the offsets alone to find the longest string in the column.
+    // Short codes (2-8 characters) are extremely common as grouping keys,
+    // and for those the inline layout below beats the generic scheme.
     T maxlen = 0;
     #pragma omp parallel for schedule(static) num_threads(nth) \
             reduction(max:maxlen)
+    for (size_t j = 0; j < n; ++j) {
+      int32_t k = use_order? o[j] : static_cast<int32_t>(j);
+      T offend = offs[k];
+      if (ISNA<T>(offend)) continue;
+      T len = offend - (offs[k - 1] & ~GETNA<T>());
+      if (len > maxlen) maxlen = len;
+    }
+    if (maxlen <= 8) {
+      _initS_inline<T>(offs);
+      return;
+    }
+
+    uint16_t* xo = static_cast<uint16_t*>(alloc_scratch(n * 2));
+    x = static_cast<void*>(xo);
+    elemsize = 2;
+    nsigbits = 16;
+
+    #pragma omp parallel for schedule(static) num_threads(nth)
     for (size_t j = 0; j < n; ++j) {
       int32_t k = use_order? o[j] : static_cast<int32_t>(j);
       T offend = offs[k];
@@ -501,15 +862,61 @@ class SortContext {
       } else {
         T offstart = offs[k - 1] & ~GETNA<T>();
         if (offend > offstart) {
-          xo[j] = strdata[offstart] + 2;
           T len = offend - offstart;
-          if (len > maxlen) maxlen = len;
+          uint16_t hi = static_cast<uint16_t>(_strbyte(offstart) + 2);
+          uint16_t lo = len >= 2
+              ? static_cast<uint16_t>(_strbyte(offstart + 1) + 2) : 0;
+          xo[j] = static_cast<uint16_t>((hi << 8) | lo);
+        } else {
+          xo[j] = 1 << 8;  // empty string
+        }
+      }
+    }
+    next_elemsize = 2;  // maxlen > 8, so more character passes will follow
+  }
+
+
+  /**
+   * Small-string optimization: when no string in the column is longer than
+   * 8 bytes, pack each string into a single big-endian uint64 key. Byte `i`
+   * of the key is `ch[i] + 2`, with zero padding past the end of the string;
+   * the leading byte is 0 for an NA string and 1 for an empty one, exactly
+   * like in the generic scheme above. This encoding is order-preserving and
+   * injective, so the sort (and any grouping) proceeds entirely through the
+   * fixed-width integer path: one radix pass over inline 8-byte slots, with
+   * no further indirections into the string data.
+   */
+  template <typename T>
+  void _initS_inline(const T* offs) {
+    uint64_t* xo = static_cast<uint64_t*>(alloc_scratch(n * 8));
+    x = static_cast<void*>(xo);
+    elemsize = 8;
+    nsigbits = 64;
+    next_elemsize = 0;  // computed by build_histogram, as for integers
+
+    #pragma omp parallel for schedule(static) num_threads(nth)
+    for (size_t j = 0; j < n; ++j) {
+      int32_t k = use_order? o[j] : static_cast<int32_t>(j);
+      T offend = offs[k];
+      uint64_t key = 0;
+      if (!ISNA<T>(offend)) {
+        T offstart = offs[k - 1] & ~GETNA<T>();
+        if (offend == offstart) {
+          key = uint64_t(1) << 56;
         } else {
-          xo[j] = 1;  // empty string
+          for (T i = 0; i < offend - offstart; ++i) {
+            key |= static_cast<uint64_t>(_strbyte(offstart + i) + 2)
+                   << (8 * (7 - i));
+          }
         }
       }
+      xo[j] = key;
     }
-    next_elemsize = (maxlen > 1);
+
+    // From here on the sort sees a plain fixed-width integer column
+    strdata = nullptr;
+    stroffs = nullptr;
+    strtype = 0;
   }
 
 
@@ -545,6 +952,16 @@ class SortContext {
     shift = nsigbits - nradixbits;
     nradixes = 1 << nradixbits;
 
+    if (strdata && shift) {
+      // String keys pack two characters per pass, and a radix pass must
+      // consume whole characters: the recursion rebuilds the next keys
+      // from the following characters, so any leftover bits of a
+      // half-consumed character would be lost. When the configured radix
+      // cap is below the full 16 bits, sort one 8-bit character per pass.
+      shift = 8;
+      nradixes = 1 << 8;
+    }
+
     if (!strdata) {
       // The remaining number of sig.bits is `shift`. Thus, this value will
       // determine the `next_elemsize`.
@@ -571,7 +988,10 @@ class SortContext {
   void build_histogram() {
     size_t counts_size = nchunks * nradixes;
     if (histogram_size < counts_size) {
-      histogram = dt::arealloc<size_t>(histogram, counts_size);
+      // The previous (smaller) histogram is simply abandoned into the arena;
+      // it is reclaimed together with all other scratch at the end of sorting
+      histogram = static_cast<size_t*>(
+                      alloc_scratch(counts_size * sizeof(size_t)));
       histogram_size = counts_size;
     }
     std::memset(histogram, 0, counts_size * sizeof(size_t));
@@ -586,7 +1006,9 @@ class SortContext {
 
   template<typename T> void _histogram_gather() {
     T* tx = static_cast<T*>(x);
-    #pragma omp parallel for schedule(dynamic) num_threads(nth)
+    // Static schedule: the chunks are equal-sized, and a fixed chunk->thread
+    // mapping keeps each thread on the pages it first-touched (NUMA-local)
+    #pragma omp parallel for schedule(static) num_threads(nth)
     for (size_t i = 0; i < nchunks; ++i) {
       size_t* cnts = histogram + (nradixes * i);
       size_t j0 = i * chunklen;
@@ -632,8 +1054,7 @@ class SortContext {
   void reorder_data() {
     if (!next_x && next_elemsize) {
       size_t sz = static_cast<size_t>(next_elemsize);
-      // Allocate as `int64_t` to ensure 8-byte alignment
-      next_x = new int64_t[(n * sz + 7) / 8];
+      next_x = alloc_scratch(n * sz);  // arena memory is always 8-aligned
     }
     if (!next_o) {
       next_o = new int32_t[n];
@@ -642,7 +1063,7 @@ class SortContext {
       if (next_x) {
         if (strtype == 1) _reorder_str<uint32_t>();
         else              _reorder_str<uint64_t>();
-      } else _reorder_impl<uint8_t, char, false>();
+      } else _reorder_impl<uint16_t, char, false>();
     } else {
       switch (elemsize) {
         case 8:
@@ -698,9 +1119,11 @@ class SortContext {
   }
 
   template <typename T> void _reorder_str() {
-    uint8_t* xi = static_cast<uint8_t*>(x);
-    uint8_t* xo = static_cast<uint8_t*>(next_x);
-    const T sstart = static_cast<T>(strstart) + 1;
+    uint16_t* xi = static_cast<uint16_t*>(x);
+    uint16_t* xo = static_cast<uint16_t*>(next_x);
+    // With shift == 8 only the high character of the packed key was
+    // consumed by this pass, so the next keys start one character earlier.
+    const T sstart = static_cast<T>(strstart) + (shift? 1 : 2);
     const T* soffs = static_cast<const T*>(stroffs);
 
     T maxlen = 0;
@@ -711,7 +1134,7 @@ class SortContext {
       size_t j1 = std::min(j0 + chunklen, n);
       size_t* tcounts = histogram + (nradixes * i);
       for (size_t j = j0; j < j1; ++j) {
-        size_t k = tcounts[xi[j]]++;
+        size_t k = tcounts[xi[j] >> shift]++;
         xassert(k < n);
         int32_t w = use_order? o[j] : static_cast<int32_t>(j);
         T offend = soffs[w];
@@ -719,16 +1142,82 @@ class SortContext {
         if (ISNA<T>(offend)) {
           xo[k] = 0;
         } else if (offend > offstart) {
-          xo[k] = strdata[offstart] + 2;
           T len = offend - offstart;
+          uint16_t hi = static_cast<uint16_t>(_strbyte(offstart) + 2);
+          uint16_t lo = len >= 2
+              ? static_cast<uint16_t>(_strbyte(offstart + 1) + 2) : 0;
+          xo[k] = static_cast<uint16_t>((hi << 8) | lo);
           if (len > maxlen) maxlen = len;
         } else {
-          xo[k] = 1;  // string is shorter than sstart
+          xo[k] = 1 << 8;  // string is shorter than sstart
         }
         next_o[k] = w;
       }
     }
-    next_elemsize = maxlen > 0;
+    next_elemsize = (maxlen > 2)? 2 : 0;
+    xassert(histogram[nchunks * nradixes - 1] == n);
+  }
+
+
+
+  //============================================================================
+  // Counting sort
+  //============================================================================
+
+  /**
+   * Specialized sorting path for narrow keys (`nsigbits <= 16`), i.e. bool,
+   * int8/int16, and any integer column whose observed range fits in 16 bits.
+   * For such keys a single radix pass covers the entire key, so the MSB
+   * recursion machinery is unnecessary: we compute per-chunk histograms,
+   * merge them with a prefix-scan (`_histogram_cumulate`), and scatter the
+   * ordering directly into `next_o`. Unlike the generic `radix_psort()`
+   * path, no `next_x` scratch buffer is ever allocated, and the group
+   * offsets are read straight off the histogram.
+   */
+  void counting_sort() {
+    xassert(strtype == 0 && nsigbits <= 16);
+    int32_t* ores = o;
+    determine_sorting_parameters();
+    // A single pass must cover the entire key, regardless of the configured
+    // radix size.
+    shift = 0;
+    nradixes = size_t(1) << nsigbits;
+    next_elemsize = 0;
+    build_histogram();
+
+    if (!next_o) {
+      next_o = new int32_t[n];
+    }
+    switch (elemsize) {
+      case 1: _counting_scatter<uint8_t >(); break;
+      case 2: _counting_scatter<uint16_t>(); break;
+    }
+    std::swap(o, next_o);
+    use_order = true;
+
+    if (groups) {
+      gg.from_histogram(histogram, nchunks, nradixes);
+    }
+    if (ores && o != ores) {
+      std::memcpy(ores, o, n * sizeof(int32_t));
+      next_o = o;
+      o = ores;
+    }
+  }
+
+  template <typename T> void _counting_scatter() {
+    T* xi = static_cast<T*>(x);
+    #pragma omp parallel for schedule(dynamic) num_threads(nth)
+    for (size_t i = 0; i < nchunks; ++i) {
+      size_t j0 = i * chunklen;
+      size_t j1 = std::min(j0 + chunklen, n);
+      size_t* tcounts = histogram + (nradixes * i);
+      for (size_t j = j0; j < j1; ++j) {
+        size_t k = tcounts[xi[j]]++;
+        xassert(k < n);
+        next_o[k] = use_order? o[j] : static_cast<int32_t>(j);
+      }
+    }
     xassert(histogram[nchunks * nradixes - 1] == n);
   }
 
@@ -759,6 +1248,9 @@ class SortContext {
    *      contents may be altered arbitrarily.
    */
   void radix_psort() {
+    dt::poll_interrupts();
+    if (dt::interrupt_requested()) return;
+    dt::progress::update();
     int32_t* ores = o;
     determine_sorting_parameters();
     build_histogram();
@@ -772,9 +1264,13 @@ class SortContext {
       } else {
         _radix_recurse<false>();
       }
-    } else if (groups) {
+    } else {
       // Otherwise groups can be computed directly from the histogram
-      gg.from_histogram(histogram, nchunks, nradixes);
+      if (groups) {
+        gg.from_histogram(histogram, nchunks, nradixes);
+      }
+      // Every row of this range is now in its final position.
+      dt::progress::add_done(static_cast<int64_t>(n));
     }
 
     // Done. Save to array `o` the computed ordering of the input vector `x`.
@@ -854,14 +1350,22 @@ class SortContext {
     size_t size0 = 0;
     size_t nsmallgroups = 0;
     size_t rrlarge = config::sort_insert_method_threshold;  // for now
-    xassert(GROUPED > rrlarge);
-
-    strstart = _strstart + 1;
-    nsigbits = strdata? 8 : shift;
+    // Groups of up to `rrmedium` elements are sorted within the parallel
+    // loop below (medium ones with std::stable_sort); only larger groups
+    // are worth a one-at-a-time parallel radix pass.
+    size_t rrmedium = rrlarge * 16;
+    xassert(GROUPED > rrmedium);
+
+    // How many characters of each string the pass just completed has fully
+    // consumed: 2 when the whole 16-bit packed key was used as the radix,
+    // 1 when only its high character was (shift == 8).
+    size_t stradv = (strdata && shift)? 1 : 2;
+    strstart = _strstart + stradv;
+    nsigbits = strdata? 16 : shift;
 
     for (size_t rri = 0; rri < _nradixes; ++rri) {
       size_t sz = rrmap[rri].size;
-      if (sz > rrlarge) {
+      if (sz > rrmedium) {
         size_t off = rrmap[rri].offset;
         n = sz;
         x = static_cast<void*>(static_cast<char*>(_x) + off * zelemsize);
@@ -912,35 +1416,54 @@ class SortContext {
       int tnum = omp_get_thread_num();
       int32_t* oo = tmp + tnum * static_cast<int32_t>(size0);
       GroupGatherer tgg;
+      int64_t tbusy = 0;
 
       #pragma omp for schedule(dynamic)
       for (size_t i = 0; i < _nradixes; ++i) {
+        if (tnum == 0) dt::poll_interrupts();
+        if (dt::interrupt_requested()) continue;
+        int64_t t0 = optimer? dt::perf::clock_ns() : 0;
         size_t zn  = rrmap[i].size;
         size_t off = rrmap[i].offset;
-        if (zn > rrlarge) {
+        if (zn > rrmedium) {
           rrmap[i].size = zn & ~GROUPED;
         } else if (zn > 1) {
           int32_t  tn = static_cast<int32_t>(zn);
           void*    tx = static_cast<char*>(_x) + off * zelemsize;
           int32_t* to = _o + off;
+          bool medium = (zn > rrlarge);
           if (make_groups) {
             tgg.init(ggdata0 + off, static_cast<int32_t>(off) + ggoff0);
           }
           if (strtype == 0) {
             switch (_elemsize) {
-              case 1: insert_sort_keys<>(static_cast<uint8_t*>(tx), to, oo, tn, tgg); break;
-              case 2: insert_sort_keys<>(static_cast<uint16_t*>(tx), to, oo, tn, tgg); break;
-              case 4: insert_sort_keys<>(static_cast<uint32_t*>(tx), to, oo, tn, tgg); break;
-              case 8: insert_sort_keys<>(static_cast<uint64_t*>(tx), to, oo, tn, tgg); break;
+              case 1:
+                if (medium) stable_sort_keys(static_cast<uint8_t*>(tx), to, oo, tn, tgg);
+                else insert_sort_keys<>(static_cast<uint8_t*>(tx), to, oo, tn, tgg);
+                break;
+              case 2:
+                if (medium) stable_sort_keys(static_cast<uint16_t*>(tx), to, oo, tn, tgg);
+                else insert_sort_keys<>(static_cast<uint16_t*>(tx), to, oo, tn, tgg);
+                break;
+              case 4:
+                if (medium) stable_sort_keys(static_cast<uint32_t*>(tx), to, oo, tn, tgg);
+                else insert_sort_keys<>(static_cast<uint32_t*>(tx), to, oo, tn, tgg);
+                break;
+              case 8:
+                if (medium) stable_sort_keys(static_cast<uint64_t*>(tx), to, oo, tn, tgg);
+                else insert_sort_keys<>(static_cast<uint64_t*>(tx), to, oo, tn, tgg);
+                break;
             }
           } else if (strtype == 1) {
             const uint32_t* soffs = static_cast<const uint32_t*>(stroffs);
-            uint32_t ss = static_cast<uint32_t>(_strstart + 1);
-            insert_sort_keys_str(strdata, soffs, ss, to, oo, tn, tgg);
+            uint32_t ss = static_cast<uint32_t>(_strstart + stradv);
+            if (medium) stable_sort_keys_str(strdata, soffs, ss, to, tn, tgg, strxform);
+            else insert_sort_keys_str(strdata, soffs, ss, to, oo, tn, tgg, strxform);
           } else {
             const uint64_t* soffs = static_cast<const uint64_t*>(stroffs);
-            uint64_t ss = static_cast<uint64_t>(_strstart + 1);
-            insert_sort_keys_str(strdata, soffs, ss, to, oo, tn, tgg);
+            uint64_t ss = static_cast<uint64_t>(_strstart + stradv);
+            if (medium) stable_sort_keys_str(strdata, soffs, ss, to, tn, tgg, strxform);
+            else insert_sort_keys_str(strdata, soffs, ss, to, oo, tn, tgg, strxform);
           }
           if (make_groups) {
             rrmap[i].size = static_cast<size_t>(tgg.size());
@@ -949,7 +1472,13 @@ class SortContext {
           ggdata0[off] = static_cast<int32_t>(off) + ggoff0 + 1;
           rrmap[i].size = 1;
         }
+        // Rows of the large (recursed) ranges were counted inside the
+        // recursion already.
+        if (zn <= rrmedium) dt::progress::add_done(static_cast<int64_t>(zn));
+        if (tnum == 0) dt::progress::update();
+        if (optimer) tbusy += dt::perf::clock_ns() - t0;
       }
+      if (optimer) optimer->add_thread_busy(tbusy);
     }
 
     // Consolidate groups into a single contiguous chunk
@@ -980,10 +1509,10 @@ class SortContext {
       }
     } else if (strtype == 1) {
       const uint32_t* soffs = static_cast<const uint32_t*>(stroffs);
-      insert_sort_keys_str(strdata, soffs, uint32_t(0), o, tmp, nn, gg);
+      insert_sort_keys_str(strdata, soffs, uint32_t(0), o, tmp, nn, gg, strxform);
     } else {
       const uint64_t* soffs = static_cast<const uint64_t*>(stroffs);
-      insert_sort_keys_str(strdata, soffs, uint64_t(0), o, tmp, nn, gg);
+      insert_sort_keys_str(strdata, soffs, uint64_t(0), o, tmp, nn, gg, strxform);
     }
   }
 
@@ -998,11 +1527,11 @@ class SortContext {
     } else if (strtype == 1) {
       int32_t nn = static_cast<int32_t>(n);
       const uint32_t* soffs = static_cast<const uint32_t*>(stroffs);
-      insert_sort_values_str(strdata, soffs, uint32_t(0), o, nn, gg);
+      insert_sort_values_str(strdata, soffs, uint32_t(0), o, nn, gg, strxform);
     } else {
       int32_t nn = static_cast<int32_t>(n);
       const uint64_t* soffs = static_cast<const uint64_t*>(stroffs);
-      insert_sort_values_str(strdata, soffs, uint64_t(0), o, nn, gg);
+      insert_sort_values_str(strdata, soffs, uint64_t(0), o, nn, gg, strxform);
     }
   }
 
@@ -1022,23 +1551,289 @@ class SortContext {
 
 
 
+//==============================================================================
+// Sortedness detection
+//==============================================================================
+
+/**
+ * Parallel monotonicity check for fixed-width data: returns true if all NA
+ * values form a prefix of the array, and the non-NA values are in
+ * non-decreasing order. Each thread checks one stretch of the data,
+ * including the pair that straddles its left boundary.
+ */
+template <typename T>
+static bool _is_sorted_fw(const T* data, size_t n, size_t nth) {
+  bool sorted = true;
+  #pragma omp parallel for schedule(static) num_threads(nth) \
+          reduction(&&:sorted)
+  for (size_t i = 0; i < nth; ++i) {
+    size_t j0 = std::max(i * n / nth, size_t(1));
+    size_t j1 = (i + 1) * n / nth;
+    for (size_t j = j0; j < j1; ++j) {
+      T a = data[j - 1];
+      T b = data[j];
+      if (ISNA<T>(b)) {
+        if (!ISNA<T>(a)) { sorted = false; break; }
+      } else {
+        if (!ISNA<T>(a) && !(a <= b)) { sorted = false; break; }
+      }
+    }
+  }
+  return sorted;
+}
+
+
+template <typename T>
+static bool _is_sorted_str(const uint8_t* strdata, const T* offs, size_t n,
+                           size_t nth) {
+  bool sorted = true;
+  #pragma omp parallel for schedule(static) num_threads(nth) \
+          reduction(&&:sorted)
+  for (size_t i = 0; i < nth; ++i) {
+    size_t j0 = std::max(i * n / nth, size_t(1));
+    size_t j1 = (i + 1) * n / nth;
+    for (size_t j = j0; j < j1; ++j) {
+      // `compare_offstrings` returns +1 if string `a` orders before `b`,
+      // 0 if they are equal, and -1 otherwise; NAs order first.
+      int cmp = compare_offstrings<T>(strdata,
+                                      offs[j - 2] & ~GETNA<T>(), offs[j - 1],
+                                      offs[j - 1] & ~GETNA<T>(), offs[j]);
+      if (cmp < 0) { sorted = false; break; }
+    }
+  }
+  return sorted;
+}
+
+
+bool Column::is_sorted() const {
+  if (sortedness) return sortedness == 1;
+  if (ri) return false;  // do not cache: the verdict describes `mbuf` only
+  size_t zn = static_cast<size_t>(nrows);
+  size_t nth = static_cast<size_t>(config::sort_nthreads);
+  bool sorted;
+  switch (stype()) {
+    case SType::BOOL:
+    case SType::INT8:
+      sorted = _is_sorted_fw(static_cast<const int8_t*>(data()), zn, nth);
+      break;
+    case SType::INT16:
+      sorted = _is_sorted_fw(static_cast<const int16_t*>(data()), zn, nth);
+      break;
+    case SType::INT32:
+    case SType::CAT32:
+      sorted = _is_sorted_fw(static_cast<const int32_t*>(data()), zn, nth);
+      break;
+    case SType::INT64:
+      sorted = _is_sorted_fw(static_cast<const int64_t*>(data()), zn, nth);
+      break;
+    case SType::FLOAT32:
+      sorted = _is_sorted_fw(static_cast<const float*>(data()), zn, nth);
+      break;
+    case SType::FLOAT64:
+      sorted = _is_sorted_fw(static_cast<const double*>(data()), zn, nth);
+      break;
+    case SType::STR32: {
+      auto scol = static_cast<const StringColumn<uint32_t>*>(this);
+      sorted = _is_sorted_str(scol->ustrdata(), scol->offsets(), zn, nth);
+      break;
+    }
+    case SType::STR64: {
+      auto scol = static_cast<const StringColumn<uint64_t>*>(this);
+      sorted = _is_sorted_str(scol->ustrdata(), scol->offsets(), zn, nth);
+      break;
+    }
+    default:
+      return false;  // not comparable: leave the cached state as "unknown"
+  }
+  sortedness = sorted? 1 : 2;
+  return sorted;
+}
+
+
+/**
+ * Compute the Groupby of an already-sorted column with a single O(n) scan
+ * over its data, comparing the adjacent elements for equality (two NAs are
+ * considered equal).
+ */
+template <typename T>
+static void _sorted_groups_fw(const T* data, size_t n, arr32_t& offs,
+                              size_t& g) {
+  for (size_t j = 1; j < n; ++j) {
+    T a = data[j - 1];
+    T b = data[j];
+    bool equal = (ISNA<T>(a) && ISNA<T>(b)) ||
+                 (!ISNA<T>(a) && !ISNA<T>(b) && a == b);
+    if (!equal) offs[++g] = static_cast<int32_t>(j);
+  }
+}
+
+template <typename T>
+static void _sorted_groups_str(const uint8_t* strdata, const T* soffs,
+                               size_t n, arr32_t& offs, size_t& g) {
+  for (size_t j = 1; j < n; ++j) {
+    int cmp = compare_offstrings<T>(strdata,
+                                    soffs[j - 2] & ~GETNA<T>(), soffs[j - 1],
+                                    soffs[j - 1] & ~GETNA<T>(), soffs[j]);
+    if (cmp != 0) offs[++g] = static_cast<int32_t>(j);
+  }
+}
+
+static Groupby groups_from_sorted(const Column* col) {
+  size_t n = static_cast<size_t>(col->nrows);
+  arr32_t offs(n + 1);
+  offs[0] = 0;
+  size_t g = 0;
+  const void* data = col->data();
+  switch (col->stype()) {
+    case SType::BOOL:
+    case SType::INT8:
+      _sorted_groups_fw(static_cast<const int8_t*>(data), n, offs, g); break;
+    case SType::INT16:
+      _sorted_groups_fw(static_cast<const int16_t*>(data), n, offs, g); break;
+    case SType::INT32:
+    case SType::CAT32:
+      _sorted_groups_fw(static_cast<const int32_t*>(data), n, offs, g); break;
+    case SType::INT64:
+      _sorted_groups_fw(static_cast<const int64_t*>(data), n, offs, g); break;
+    case SType::FLOAT32:
+      _sorted_groups_fw(static_cast<const float*>(data), n, offs, g); break;
+    case SType::FLOAT64:
+      _sorted_groups_fw(static_cast<const double*>(data), n, offs, g); break;
+    case SType::STR32: {
+      auto scol = static_cast<const StringColumn<uint32_t>*>(col);
+      _sorted_groups_str(scol->ustrdata(), scol->offsets(), n, offs, g);
+      break;
+    }
+    case SType::STR64: {
+      auto scol = static_cast<const StringColumn<uint64_t>*>(col);
+      _sorted_groups_str(scol->ustrdata(), scol->offsets(), n, offs, g);
+      break;
+    }
+    default:
+      throw RuntimeError() << "Cannot compute groups for Column of stype "
+                           << col->stype();
+  }
+  offs[++g] = static_cast<int32_t>(n);
+  offs.resize(g + 1);
+  return Groupby(g, offs.to_memoryrange());
+}
+
+
+
 //==============================================================================
 // Main sorting routines
 //==============================================================================
 
+static RowIndex sort_tiny(const Column* col, Groupby* out_grps) {
+  int64_t i = col->rowindex().nth(0);
+  if (out_grps) {
+    *out_grps = Groupby::single_group(col->nrows);
+  }
+  return RowIndex::from_slice(i, col->nrows, 1);
+}
+
+
 /**
- * Sort the column, and return its ordering as a RowIndex object. This function
- * will choose the most appropriate algorithm for sorting. The data in column
- * `col` will not be modified.
- *
- * The function returns nullptr if there is a runtime error (for example an
- * intermediate buffer cannot be allocated).
+ * Compute the number of significant bits that the column's prepared sort key
+ * occupies (see `SortContext::_prepare_input`). Returns -1 for columns whose
+ * keys cannot be fused into a fixed-width composite (i.e. strings).
  */
-RowIndex DataTable::sortby(const arr32_t& colindices, Groupby* out_grps) const
+template <typename T, typename TU>
+static int _int_key_bitwidth(const Column* col) {
+  auto icol = static_cast<const IntColumn<T>*>(col);
+  TU range = static_cast<TU>(icol->max() - icol->min() + 1);
+  return static_cast<int>(sizeof(T) * 8) - dt::nlz(range);
+}
+
+static int sort_key_bitwidth(const Column* col) {
+  switch (col->stype()) {
+    case SType::BOOL:    return 2;
+    case SType::INT8:    return _int_key_bitwidth<int8_t,  uint8_t >(col);
+    case SType::INT16:   return _int_key_bitwidth<int16_t, uint16_t>(col);
+    case SType::INT32:   return _int_key_bitwidth<int32_t, uint32_t>(col);
+    case SType::INT64:   return _int_key_bitwidth<int64_t, uint64_t>(col);
+    case SType::CAT32:   return _int_key_bitwidth<int32_t, uint32_t>(col);
+    case SType::FLOAT32: return 32;
+    case SType::FLOAT64: return 64;
+    default:             return -1;
+  }
+}
+
+
+/**
+ * Fallback multi-column sorting: sort by the first column collecting the
+ * groups, then stably re-sort the rows within each group by the next column,
+ * refining the groups at each step. This handles arbitrary key columns
+ * (including strings), at the cost of one sorting pass per key column.
+ */
+static RowIndex sort_bygroups(const DataTable* dt, const arr32_t& colindices,
+                              Groupby* out_grps)
 {
-  if (colindices.size() != 1) {
-    throw NotImplError() << "Sorting by multiple columns is not supported yet";
+  size_t n = static_cast<size_t>(dt->nrows);
+  Groupby grps;
+  RowIndex ri = dt->columns[colindices[0]]->sort(&grps);
+
+  for (size_t k = 1; k < colindices.size(); ++k) {
+    Column* colk = dt->columns[colindices[k]];
+    arr32_t order = ri.extract_as_array32();
+    const int32_t* goffs = grps.offsets_r();
+    size_t ngrps = grps.ngroups();
+    arr32_t neworder(n);
+    arr32_t newoffs(n + 1);
+    newoffs[0] = 0;
+    size_t gcount = 0;
+
+    for (size_t g = 0; g < ngrps; ++g) {
+      int32_t off = goffs[g];
+      int32_t size = goffs[g + 1] - off;
+      if (size == 1) {
+        neworder[off] = order[off];
+        newoffs[++gcount] = off + 1;
+        continue;
+      }
+      // The group's slice of `order` contains final row numbers; use it as
+      // the rowindex of a shallow copy of `colk`, so that sorting the copy
+      // yields those same row numbers reordered by the values of `colk`.
+      arr32_t subind(static_cast<size_t>(size));
+      std::memcpy(subind.data(), order.data() + off,
+                  static_cast<size_t>(size) * sizeof(int32_t));
+      Column* subcol = colk->shallowcopy(RowIndex::from_array32(std::move(subind)));
+      Groupby subgrps;
+      RowIndex subri = subcol->sort(&subgrps);
+      arr32_t suborder = subri.extract_as_array32();
+      std::memcpy(neworder.data() + off, suborder.data(),
+                  static_cast<size_t>(size) * sizeof(int32_t));
+      const int32_t* soffs = subgrps.offsets_r();
+      for (size_t i = 1; i <= subgrps.ngroups(); ++i) {
+        newoffs[++gcount] = off + soffs[i];
+      }
+      delete subcol;
+    }
+    xassert(newoffs[gcount] == static_cast<int32_t>(n));
+    ri = RowIndex::from_array32(std::move(neworder));
+    newoffs.resize(gcount + 1);
+    grps = Groupby(gcount, newoffs.to_memoryrange());
   }
+
+  if (out_grps) *out_grps = grps;
+  return ri;
+}
+
+
+/**
+ * Sort the datatable by the specified columns, and return the ordering as a
+ * RowIndex object. This function will choose the most appropriate algorithm
+ * for sorting. The data in the columns will not be modified.
+ *
+ * When sorting by multiple columns, the prepared keys of all columns are
+ * fused into a single composite radix stream whenever they jointly fit into
+ * 64 bits, so that the entire multi-key sort is a single radix pass.
+ * Otherwise we fall back to sorting by one column at a time, refining the
+ * groups of the previous key at each step.
+ */
+RowIndex DataTable::sortby(const arr32_t& colindices, Groupby* out_grps,
+                           bool case_fold) const
+{
   if (nrows > INT32_MAX) {
     throw NotImplError() << "Cannot sort a datatable with " << nrows << " rows";
   }
@@ -1047,25 +1842,671 @@ RowIndex DataTable::sortby(const arr32_t& colindices, Groupby* out_grps) const
     throw NotImplError() << "Cannot sort a datatable which is based on a "
                             "datatable with >2**31 rows";
   }
-  Column* col0 = columns[colindices[0]];
-  return col0->sort(out_grps);
-}
-
+  if (case_fold) {
+    // Case-folded ordering: single string column only, and the result is
+    // never memoized -- the sort cache stores plain byte orderings.
+    if (colindices.size() != 1) {
+      throw NotImplError() << "Case-insensitive sorting is only supported "
+                              "for a single column";
+    }
+    const Column* col0 = columns[colindices[0]];
+    SType st = col0->stype();
+    if (st != SType::STR32 && st != SType::STR64) {
+      throw TypeError() << "Case-insensitive sorting requires a string "
+                           "column, not " << st;
+    }
+    return col0->sort(out_grps, true);
+  }
+  if (colindices.size() == 1) {
+    // Re-sorting a frame by the same column is common enough (dashboards,
+    // repeated groupbys) that the result is memoized per column index until
+    // the frame is next mutated.
+    int32_t idx = colindices[0];
+    {
+      // `sortby()` runs with the GIL released, so the cache may be probed by
+      // several Python threads at once; the lock covers only the map accesses,
+      // not the sort itself.
+      std::lock_guard<std::mutex> lock(sort_cache_mutex);
+      auto it = sort_cache.find(idx);
+      if (it != sort_cache.end() &&
+          it->second.mutid != columns[idx]->mutation_id()) {
+        // The column's data changed since the entry was stored (e.g. in-place
+        // value replacement, which does not invalidate the frame-level cache):
+        // the memoized ordering is stale.
+        sort_cache.erase(it);
+        it = sort_cache.end();
+      }
+      if (it != sort_cache.end() && (it->second.has_groups || !out_grps)) {
+        it->second.last_used = ++sort_cache_clock;
+        if (out_grps) *out_grps = it->second.groupby;
+        return it->second.rowindex;
+      }
+    }
+    Column* col0 = columns[idx];
+    RowIndex ri = col0->sort(out_grps);
+    {
+      std::lock_guard<std::mutex> lock(sort_cache_mutex);
+      if (sort_cache.count(idx) == 0 &&
+          sort_cache.size() >= SORT_CACHE_MAXSIZE) {
+        auto lru = sort_cache.begin();
+        for (auto jt = sort_cache.begin(); jt != sort_cache.end(); ++jt) {
+          if (jt->second.last_used < lru->second.last_used) lru = jt;
+        }
+        sort_cache.erase(lru);
+      }
+      SortCacheEntry& entry = sort_cache[idx];
+      entry.rowindex = ri;
+      entry.mutid = col0->mutation_id();
+      entry.last_used = ++sort_cache_clock;
+      entry.has_groups = (out_grps != nullptr);
+      if (out_grps) entry.groupby = *out_grps;
+    }
+    return ri;
+  }
+  if (nrows <= 1) {
+    return sort_tiny(columns[colindices[0]], out_grps);
+  }
 
-static RowIndex sort_tiny(const Column* col, Groupby* out_grps) {
-  int64_t i = col->rowindex().nth(0);
-  if (out_grps) {
-    *out_grps = Groupby::single_group(col->nrows);
+  int totalbits = 0;
+  bool fuseable = true;
+  std::vector<const Column*> cols;
+  for (size_t k = 0; k < colindices.size(); ++k) {
+    const Column* col = columns[colindices[k]];
+    int w = sort_key_bitwidth(col);
+    if (w < 0) fuseable = false;
+    totalbits += w;
+    cols.push_back(col);
   }
-  return RowIndex::from_slice(i, col->nrows, 1);
+  if (fuseable && totalbits <= 64) {
+    SortContext sc(cols, (out_grps != nullptr));
+    sc.do_sort();
+    return sc.get_result(out_grps);
+  }
+  return sort_bygroups(this, colindices, out_grps);
 }
 
 
-RowIndex Column::sort(Groupby* out_grps) const {
+RowIndex Column::sort(Groupby* out_grps, bool case_fold) const {
+  dt::perf::OpTimer optimer("sort");
+  optimer.set_bytes(static_cast<int64_t>(alloc_size()));
   if (nrows <= 1) {
     return sort_tiny(this, out_grps);
   }
-  SortContext sc(this, (out_grps != nullptr));
+  // Fast path: when the column's data is already sorted (very common for
+  // time-ordered data), skip the radix pipeline entirely. The ordering is
+  // then a unit slice, and the groups (if requested) come from one linear
+  // scan over the data. `is_sorted()` describes plain byte order, so the
+  // shortcut does not apply to a case-folded sort.
+  if (!case_fold && ri.isabsent() && is_sorted()) {
+    if (out_grps) {
+      *out_grps = groups_from_sorted(this);
+    }
+    // Consumers of sort results (e.g. the aggregator) read the ordering
+    // through `indices32()`, which is only available on array rowindexes,
+    // so the identity ordering must be materialized as an arr32 rather
+    // than returned as a slice.
+    if (nrows > std::numeric_limits<int32_t>::max()) {
+      arr64_t identity(static_cast<size_t>(nrows));
+      int64_t* idp = identity.data();
+      #pragma omp parallel for schedule(static)
+      for (int64_t i = 0; i < nrows; ++i) {
+        idp[i] = i;
+      }
+      return RowIndex::from_array64(std::move(identity), true);
+    }
+    arr32_t identity(static_cast<size_t>(nrows));
+    int32_t* idp = identity.data();
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < nrows; ++i) {
+      idp[i] = static_cast<int32_t>(i);
+    }
+    return RowIndex::from_array32(std::move(identity), true);
+  }
+  SortContext sc(this, (out_grps != nullptr), case_fold);
+  if (optimer.is_active()) sc.set_optimer(&optimer);
   sc.do_sort();
+  optimer.set_nthreads(static_cast<int32_t>(sc.n_threads_used()));
+  optimer.set_nchunks(static_cast<int32_t>(sc.n_chunks_used()));
   return sc.get_result(out_grps);
 }
+
+
+/**
+ * Return the row numbers of the `k` smallest (`ascending = true`) or largest
+ * (`ascending = false`) values in the column, as a RowIndex of length
+ * `min(k, nrows)`. The rows are returned in sorted order, with ties resolved
+ * in favor of earlier rows; NA values are ordered first, same as in `sort()`.
+ *
+ * This reuses the sorting machinery's key preparation step, but then runs a
+ * chunked partial selection instead of the full radix sort, which is roughly
+ * O(n log k) -- far cheaper than a full sort when `k << nrows`.
+ */
+RowIndex Column::topk(size_t k, bool ascending) const {
+  SType st = stype();
+  if (st == SType::STR32 || st == SType::STR64) {
+    throw NotImplError() << "Column::topk() is not supported for string "
+                            "columns";
+  }
+  if (nrows <= 1 || k == 0) {
+    return RowIndex::from_slice(k? rowindex().nth(0) : 0,
+                                std::min<int64_t>(static_cast<int64_t>(k), nrows), 1);
+  }
+  if (k >= static_cast<size_t>(nrows)) {
+    return sort(nullptr);
+  }
+  SortContext sc(this, false);
+  return sc.select_topk(k, ascending);
+}
+
+
+//==============================================================================
+// Incremental sorting of appended data
+//==============================================================================
+
+/**
+ * Three-way comparison of the values in rows `a` and `b`, using the same
+ * ordering as the main sort: returns +1 if the value in row `a` orders
+ * before the one in row `b`, 0 if they are equal, and -1 otherwise. NA
+ * values order first.
+ */
+template <typename T>
+static int compare_fw_keys(const T* data, int32_t a, int32_t b) {
+  T x = data[a];
+  T y = data[b];
+  bool xna = ISNA<T>(x);
+  bool yna = ISNA<T>(y);
+  if (xna || yna) return (xna && yna)? 0 : xna? 1 : -1;
+  return (x < y)? 1 : (y < x)? -1 : 0;
+}
+
+
+/**
+ * Merge two group-annotated sorted orderings into one. `o1`/`offs1`/`ng1`
+ * describe the primary ordering (its rows win ties, keeping the merge
+ * stable), `o2`/`offs2`/`ng2` the secondary one. The merged row order is
+ * written into `out_o`, the merged cumulative group offsets into `out_offs`
+ * (which must have room for `ng1 + ng2 + 1` entries, the worst case).
+ * `cmp(a, b)` compares the key values in rows `a` and `b` and follows the
+ * `compare_offstrings()` sign convention. Returns the number of merged
+ * groups.
+ */
+template <typename CMP>
+static size_t merge_grouped_orders(
+    const int32_t* o1, const int32_t* offs1, size_t ng1,
+    const int32_t* o2, const int32_t* offs2, size_t ng2,
+    int32_t* out_o, int32_t* out_offs, CMP cmp)
+{
+  size_t i = 0;
+  size_t j = 0;
+  size_t ng = 0;
+  int32_t written = 0;
+  out_offs[0] = 0;
+  while (i < ng1 || j < ng2) {
+    int c;
+    if (i == ng1)      c = -1;  // only secondary groups remain
+    else if (j == ng2) c = 1;   // only primary groups remain
+    else c = cmp(o1[offs1[i]], o2[offs2[j]]);
+    if (c >= 0) {
+      int32_t len = offs1[i + 1] - offs1[i];
+      std::memcpy(out_o + written, o1 + offs1[i],
+                  static_cast<size_t>(len) * sizeof(int32_t));
+      written += len;
+      i++;
+      if (c == 0) {
+        int32_t len2 = offs2[j + 1] - offs2[j];
+        std::memcpy(out_o + written, o2 + offs2[j],
+                    static_cast<size_t>(len2) * sizeof(int32_t));
+        written += len2;
+        j++;
+      }
+    } else {
+      int32_t len = offs2[j + 1] - offs2[j];
+      std::memcpy(out_o + written, o2 + offs2[j],
+                  static_cast<size_t>(len) * sizeof(int32_t));
+      written += len;
+      j++;
+    }
+    out_offs[++ng] = written;
+  }
+  return ng;
+}
+
+
+template <typename T>
+static size_t merge_fw(const Column* col,
+    const int32_t* o1, const int32_t* offs1, size_t ng1,
+    const int32_t* o2, const int32_t* offs2, size_t ng2,
+    int32_t* out_o, int32_t* out_offs)
+{
+  const T* data = static_cast<const T*>(col->data());
+  return merge_grouped_orders(o1, offs1, ng1, o2, offs2, ng2, out_o, out_offs,
+      [=](int32_t a, int32_t b) {
+        return compare_fw_keys<T>(data, a, b);
+      });
+}
+
+
+template <typename T>
+static size_t merge_str(const Column* col,
+    const int32_t* o1, const int32_t* offs1, size_t ng1,
+    const int32_t* o2, const int32_t* offs2, size_t ng2,
+    int32_t* out_o, int32_t* out_offs)
+{
+  auto scol = static_cast<const StringColumn<T>*>(col);
+  const T* soffs = scol->offsets();
+  const uint8_t* strdata = scol->ustrdata();
+  return merge_grouped_orders(o1, offs1, ng1, o2, offs2, ng2, out_o, out_offs,
+      [=](int32_t a, int32_t b) {
+        return compare_offstrings<T>(strdata,
+                  soffs[a - 1] & ~GETNA<T>(), soffs[a],
+                  soffs[b - 1] & ~GETNA<T>(), soffs[b]);
+      });
+}
+
+
+/**
+ * Incremental counterpart of `sort()` for append-only data. Given the
+ * ordering and groups computed when the column had `old_nrows` rows, sort
+ * only the newly appended tail and merge the two group-annotated orderings,
+ * instead of re-sorting the whole column. The merge keeps old rows ahead of
+ * new ones within equal keys, so the result is identical to what a full
+ * (stable) re-sort would produce.
+ */
+RowIndex Column::sort_incremental(int64_t old_nrows, const RowIndex& old_order,
+                                  const Groupby& old_grps,
+                                  Groupby* out_grps) const
+{
+  xassert(ri.isabsent());
+  int64_t delta = nrows - old_nrows;
+  if (old_nrows <= 0 || delta < 0) {
+    return sort(out_grps);
+  }
+  if (delta == 0) {
+    if (out_grps) *out_grps = old_grps;
+    return old_order;
+  }
+
+  // Sort the appended tail only.
+  Column* tailcol = shallowcopy(RowIndex::from_slice(old_nrows, delta, 1));
+  Groupby tail_grps;
+  RowIndex tail_order = tailcol->sort(&tail_grps);
+  delete tailcol;
+
+  arr32_t o1 = old_order.isabsent()
+               ? RowIndex::from_slice(0, old_nrows, 1).extract_as_array32()
+               : old_order.extract_as_array32();
+  arr32_t o2 = tail_order.extract_as_array32();
+  size_t ng1 = old_grps.ngroups();
+  size_t ng2 = tail_grps.ngroups();
+
+  arr32_t out_o(static_cast<size_t>(nrows));
+  MemoryRange offs_mr = MemoryRange::mem((ng1 + ng2 + 1) * sizeof(int32_t));
+  int32_t* out_offs = static_cast<int32_t*>(offs_mr.wptr());
+
+  size_t ng = 0;
+  switch (stype()) {
+    case SType::BOOL:
+    case SType::INT8:
+      ng = merge_fw<int8_t>(this, o1.data(), old_grps.offsets_r(), ng1,
+                            o2.data(), tail_grps.offsets_r(), ng2,
+                            out_o.data(), out_offs);
+      break;
+    case SType::INT16:
+      ng = merge_fw<int16_t>(this, o1.data(), old_grps.offsets_r(), ng1,
+                             o2.data(), tail_grps.offsets_r(), ng2,
+                             out_o.data(), out_offs);
+      break;
+    case SType::INT32:
+      ng = merge_fw<int32_t>(this, o1.data(), old_grps.offsets_r(), ng1,
+                             o2.data(), tail_grps.offsets_r(), ng2,
+                             out_o.data(), out_offs);
+      break;
+    case SType::INT64:
+      ng = merge_fw<int64_t>(this, o1.data(), old_grps.offsets_r(), ng1,
+                             o2.data(), tail_grps.offsets_r(), ng2,
+                             out_o.data(), out_offs);
+      break;
+    case SType::FLOAT32:
+      ng = merge_fw<float>(this, o1.data(), old_grps.offsets_r(), ng1,
+                           o2.data(), tail_grps.offsets_r(), ng2,
+                           out_o.data(), out_offs);
+      break;
+    case SType::FLOAT64:
+      ng = merge_fw<double>(this, o1.data(), old_grps.offsets_r(), ng1,
+                            o2.data(), tail_grps.offsets_r(), ng2,
+                            out_o.data(), out_offs);
+      break;
+    case SType::STR32:
+      ng = merge_str<uint32_t>(this, o1.data(), old_grps.offsets_r(), ng1,
+                               o2.data(), tail_grps.offsets_r(), ng2,
+                               out_o.data(), out_offs);
+      break;
+    case SType::STR64:
+      ng = merge_str<uint64_t>(this, o1.data(), old_grps.offsets_r(), ng1,
+                               o2.data(), tail_grps.offsets_r(), ng2,
+                               out_o.data(), out_offs);
+      break;
+    default:
+      throw NotImplError() << "Column::sort_incremental() is not supported "
+          "for column of type " << stype();
+  }
+
+  if (out_grps) {
+    *out_grps = Groupby(ng, std::move(offs_mr));
+  }
+  return RowIndex::from_array32(std::move(out_o));
+}
+
+
+//==============================================================================
+// Sorted merge of pre-sorted frames
+//==============================================================================
+
+/**
+ * Merge `nruns` consecutive sorted row ranges of one column into a single
+ * sorted ordering. Range `r` spans rows `starts[r] .. ends[r] - 1`; the
+ * merged row numbers are written into `out` (of size `total`). `cmp(a, b)`
+ * compares the key values in rows `a` and `b` and follows the
+ * `compare_offstrings()` sign convention. Ties between runs are broken by
+ * the run index, so rows of earlier runs stay ahead of equal rows of later
+ * ones and the merge is stable.
+ *
+ * The merge is parallelized by cutting the output into per-thread blocks at
+ * sampled "splitter" rows: for every splitter, a binary search in each run
+ * finds the first row ordering strictly after it, so rows equal to the
+ * splitter all fall into the earlier block and the blocks partition the
+ * output without overlap. Each block is then k-way merged independently
+ * using a small binary heap of run heads.
+ */
+template <typename CMP>
+static void merge_sorted_runs(const std::vector<int64_t>& starts,
+                              const std::vector<int64_t>& ends,
+                              int32_t* out, int64_t total, CMP cmp)
+{
+  size_t nruns = starts.size();
+
+  auto merge_block = [&](std::vector<int64_t> pos,
+                         const std::vector<int64_t>& stop,
+                         int64_t outpos) {
+    // Binary min-heap of run indices, ordered by the runs' current head rows.
+    auto before = [&](size_t r1, size_t r2) {
+      int c = cmp(pos[r1], pos[r2]);
+      return c > 0 || (c == 0 && r1 < r2);
+    };
+    std::vector<size_t> heap;
+    heap.reserve(nruns);
+    for (size_t r = 0; r < nruns; ++r) {
+      if (pos[r] < stop[r]) heap.push_back(r);
+    }
+    auto sift_down = [&](size_t i) {
+      size_t n = heap.size();
+      while (true) {
+        size_t l = 2 * i + 1;
+        size_t m = i;
+        if (l < n && before(heap[l], heap[m])) m = l;
+        if (l + 1 < n && before(heap[l + 1], heap[m])) m = l + 1;
+        if (m == i) break;
+        std::swap(heap[i], heap[m]);
+        i = m;
+      }
+    };
+    for (size_t i = heap.size() / 2; i-- > 0;) sift_down(i);
+    while (!heap.empty()) {
+      size_t r = heap[0];
+      out[outpos++] = static_cast<int32_t>(pos[r]++);
+      if (pos[r] == stop[r]) {
+        heap[0] = heap.back();
+        heap.pop_back();
+      }
+      sift_down(0);
+    }
+  };
+
+  int nth = omp_get_max_threads();
+  if (total < 65536 || nth <= 1 || nruns < 2) {
+    merge_block(starts, ends, 0);
+    return;
+  }
+
+  // Sample candidate splitter rows evenly from every run, then order the
+  // samples by key value.
+  std::vector<int64_t> sample;
+  for (size_t r = 0; r < nruns; ++r) {
+    int64_t len = ends[r] - starts[r];
+    int64_t nsamp = std::min<int64_t>(len, 16 * nth);
+    for (int64_t k = 0; k < nsamp; ++k) {
+      sample.push_back(starts[r] + k * len / nsamp);
+    }
+  }
+  std::sort(sample.begin(), sample.end(),
+            [&](int64_t a, int64_t b) { return cmp(a, b) > 0; });
+
+  // Per-block per-run boundaries: `bounds[t][r]` is the first row of run
+  // `r` belonging to block `t` or later. Successive splitters are
+  // non-decreasing, so each search can resume from the previous bound.
+  size_t nblocks = static_cast<size_t>(nth);
+  std::vector<std::vector<int64_t>> bounds(nblocks + 1);
+  bounds[0] = starts;
+  bounds[nblocks] = ends;
+  for (size_t t = 1; t < nblocks; ++t) {
+    int64_t splitter = sample[t * sample.size() / nblocks];
+    std::vector<int64_t> b(nruns);
+    for (size_t r = 0; r < nruns; ++r) {
+      int64_t lo = bounds[t - 1][r];
+      int64_t hi = ends[r];
+      while (lo < hi) {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (cmp(splitter, mid) > 0) hi = mid;
+        else lo = mid + 1;
+      }
+      b[r] = lo;
+    }
+    bounds[t] = std::move(b);
+  }
+
+  std::vector<int64_t> outoffs(nblocks + 1);
+  outoffs[0] = 0;
+  for (size_t t = 1; t <= nblocks; ++t) {
+    int64_t blocksize = 0;
+    for (size_t r = 0; r < nruns; ++r) {
+      blocksize += bounds[t][r] - bounds[t - 1][r];
+    }
+    outoffs[t] = outoffs[t - 1] + blocksize;
+  }
+  xassert(outoffs[nblocks] == total);
+
+  #pragma omp parallel for schedule(dynamic) num_threads(nth)
+  for (int64_t t = 0; t < static_cast<int64_t>(nblocks); ++t) {
+    size_t zt = static_cast<size_t>(t);
+    merge_block(bounds[zt], bounds[zt + 1], outoffs[zt]);
+  }
+}
+
+
+template <typename T>
+static void merge_runs_fw(const Column* col,
+                          const std::vector<int64_t>& starts,
+                          const std::vector<int64_t>& ends,
+                          int32_t* out, int64_t total)
+{
+  const T* data = static_cast<const T*>(col->data());
+  merge_sorted_runs(starts, ends, out, total,
+      [=](int64_t a, int64_t b) {
+        return compare_fw_keys<T>(data, static_cast<int32_t>(a),
+                                        static_cast<int32_t>(b));
+      });
+}
+
+
+template <typename T>
+static void merge_runs_str(const Column* col,
+                           const std::vector<int64_t>& starts,
+                           const std::vector<int64_t>& ends,
+                           int32_t* out, int64_t total)
+{
+  auto scol = static_cast<const StringColumn<T>*>(col);
+  const T* soffs = scol->offsets();
+  const uint8_t* strdata = scol->ustrdata();
+  merge_sorted_runs(starts, ends, out, total,
+      [=](int64_t a, int64_t b) {
+        return compare_offstrings<T>(strdata,
+                  soffs[a - 1] & ~GETNA<T>(), soffs[a],
+                  soffs[b - 1] & ~GETNA<T>(), soffs[b]);
+      });
+}
+
+
+/**
+ * Merge `parts` -- frames with identical column structure, each already
+ * sorted by its column `keycol` -- into a new frame that is their row-wise
+ * union, globally sorted by that column. Each input's sortedness is
+ * verified first (cheap when the cached flag is set, see
+ * `Column::is_sorted()`); the merge itself costs O(total * log nparts)
+ * comparisons instead of a full re-sort of the combined data. The merge is
+ * stable: within equal keys, rows keep the order of the input frames.
+ *
+ * The inputs are not modified: the result is a view over copies of their
+ * columns (column types are promoted as in `rbind` when the parts differ).
+ * Call `reify()` on the result to materialize it.
+ */
+DataTable* DataTable::merge_sorted(const std::vector<DataTable*>& parts,
+                                   int64_t keycol)
+{
+  size_t nparts = parts.size();
+  if (nparts == 0) {
+    throw ValueError() << "At least one Frame is required for a sorted merge";
+  }
+  int64_t ncols = parts[0]->ncols;
+  if (keycol < 0 || keycol >= ncols) {
+    throw ValueError() << "Invalid key column index " << keycol
+        << " for a Frame with " << ncols << " column(s)";
+  }
+  int64_t total = 0;
+  for (size_t p = 0; p < nparts; ++p) {
+    if (parts[p]->ncols != ncols) {
+      throw ValueError() << "Cannot merge frames with different numbers of "
+          "columns: " << ncols << " and " << parts[p]->ncols;
+    }
+    if (parts[p]->columns[keycol]->stype() == SType::OBJ) {
+      throw ValueError() << "Column of type obj64 cannot be used as the "
+          "merge key";
+    }
+    total += parts[p]->nrows;
+  }
+  if (total > std::numeric_limits<int32_t>::max()) {
+    throw NotImplError() << "Cannot merge frames with a total of " << total
+        << " rows";
+  }
+
+  // Materialized shallow copies of all columns: verifying sortedness needs
+  // plain (non-view) data, and `Column::rbind` consumes its arguments, so
+  // the originals must be left intact.
+  std::vector<std::vector<Column*>> copies(nparts);
+  auto cleanup = [&]() {
+    for (auto& partcols : copies) {
+      for (Column* c : partcols) delete c;
+    }
+  };
+  try {
+    for (size_t p = 0; p < nparts; ++p) {
+      copies[p].resize(static_cast<size_t>(ncols), nullptr);
+      for (int64_t i = 0; i < ncols; ++i) {
+        Column* c = parts[p]->columns[i]->shallowcopy();
+        copies[p][static_cast<size_t>(i)] = c;
+        c->reify();
+      }
+    }
+    for (size_t p = 0; p < nparts; ++p) {
+      Column* kc = copies[p][static_cast<size_t>(keycol)];
+      if (kc->nrows > 0 && !kc->is_sorted()) {
+        throw ValueError() << "Frame " << p << " is not sorted by column "
+            << keycol << "; sort the inputs first, or use rbind + sort";
+      }
+    }
+  } catch (...) {
+    cleanup();
+    throw;
+  }
+
+  // Combine the columns of all parts; `Column::rbind` deletes the copies
+  // it consumes, and promotes the column type when the parts disagree.
+  Column** cols = dt::amalloc<Column*>(ncols + 1);
+  cols[ncols] = nullptr;
+  int64_t ndone = 0;
+  try {
+    for (int64_t i = 0; i < ncols; ++i) {
+      size_t zi = static_cast<size_t>(i);
+      Column* col0 = copies[0][zi];
+      copies[0][zi] = nullptr;
+      if (nparts == 1) {
+        cols[i] = col0;
+      } else {
+        std::vector<const Column*> rest;
+        rest.reserve(nparts - 1);
+        for (size_t p = 1; p < nparts; ++p) {
+          rest.push_back(copies[p][zi]);
+          copies[p][zi] = nullptr;
+        }
+        cols[i] = col0->rbind(rest);
+      }
+      ndone++;
+    }
+  } catch (...) {
+    for (int64_t i = 0; i < ndone; ++i) delete cols[i];
+    dt::free(cols);
+    cleanup();
+    throw;
+  }
+
+  DataTable* res = new DataTable(cols, parts[0]);
+  if (nparts == 1 || total == 0) {
+    return res;
+  }
+  try {
+    std::vector<int64_t> starts(nparts);
+    std::vector<int64_t> ends(nparts);
+    int64_t row0 = 0;
+    for (size_t p = 0; p < nparts; ++p) {
+      starts[p] = row0;
+      row0 += parts[p]->nrows;
+      ends[p] = row0;
+    }
+    Column* kc = res->columns[keycol];
+    arr32_t out_o(static_cast<size_t>(total));
+    switch (kc->stype()) {
+      case SType::BOOL:
+      case SType::INT8:
+        merge_runs_fw<int8_t>(kc, starts, ends, out_o.data(), total);
+        break;
+      case SType::INT16:
+        merge_runs_fw<int16_t>(kc, starts, ends, out_o.data(), total);
+        break;
+      case SType::INT32:
+        merge_runs_fw<int32_t>(kc, starts, ends, out_o.data(), total);
+        break;
+      case SType::INT64:
+        merge_runs_fw<int64_t>(kc, starts, ends, out_o.data(), total);
+        break;
+      case SType::FLOAT32:
+        merge_runs_fw<float>(kc, starts, ends, out_o.data(), total);
+        break;
+      case SType::FLOAT64:
+        merge_runs_fw<double>(kc, starts, ends, out_o.data(), total);
+        break;
+      case SType::STR32:
+        merge_runs_str<uint32_t>(kc, starts, ends, out_o.data(), total);
+        break;
+      case SType::STR64:
+        merge_runs_str<uint64_t>(kc, starts, ends, out_o.data(), total);
+        break;
+      default:
+        throw NotImplError() << "Cannot merge frames by a key column of "
+            "type " << kc->stype();
+    }
+    res->replace_rowindex(RowIndex::from_array32(std::move(out_o)));
+  } catch (...) {
+    delete res;
+    throw;
+  }
+  return res;
+}
@@ -87,7 +87,7 @@ class GroupGatherer {
 
     void push(size_t grp);
     template <typename T, typename V> void from_data(const T*, V*, size_t);
-    template <typename T, typename V> void from_data(const uint8_t*, const T*, T, V*, size_t);
+    template <typename T, typename V> void from_data(const uint8_t*, const T*, T, V*, size_t, const uint8_t* xform = nullptr);
     void from_chunks(radix_range* rrmap, size_t nradixes);
     void from_histogram(size_t* histogram, size_t nchunks, size_t nradixes);
 };
@@ -105,13 +105,18 @@ template <typename T, typename V>
 void insert_sort_values(const T* x, V* o, int n, GroupGatherer& gg);
 
 template <typename T, typename V>
-void insert_sort_keys_str(const uint8_t*, const T*, T, V*, V*, int, GroupGatherer&);
+void insert_sort_keys_str(const uint8_t*, const T*, T, V*, V*, int,
+                          GroupGatherer&, const uint8_t* xform = nullptr);
 
 template <typename T, typename V>
-void insert_sort_values_str(const uint8_t*, const T*, T, V*, int, GroupGatherer&);
+void insert_sort_values_str(const uint8_t*, const T*, T, V*, int,
+                            GroupGatherer&, const uint8_t* xform = nullptr);
 
+// The optional `xform` is a 256-byte translation table applied to every data
+// byte before comparison (but never stored), used for case-folded ordering.
 template <typename T>
-int compare_offstrings(const uint8_t*, T, T, T, T);
+int compare_offstrings(const uint8_t*, T, T, T, T,
+                       const uint8_t* xform = nullptr);
 
 
 
@@ -125,20 +130,20 @@ extern template void insert_sort_values(const uint16_t*, int32_t*, int, GroupGat
 extern template void insert_sort_values(const uint32_t*, int32_t*, int, GroupGatherer&);
 extern template void insert_sort_values(const uint64_t*, int32_t*, int, GroupGatherer&);
 
-extern template void insert_sort_keys_str(  const uint8_t*, const uint32_t*, uint32_t, int32_t*, int32_t*, int, GroupGatherer&);
-extern template void insert_sort_values_str(const uint8_t*, const uint32_t*, uint32_t, int32_t*, int, GroupGatherer&);
-extern template void insert_sort_keys_str(  const uint8_t*, const uint64_t*, uint64_t, int32_t*, int32_t*, int, GroupGatherer&);
-extern template void insert_sort_values_str(const uint8_t*, const uint64_t*, uint64_t, int32_t*, int, GroupGatherer&);
+extern template void insert_sort_keys_str(  const uint8_t*, const uint32_t*, uint32_t, int32_t*, int32_t*, int, GroupGatherer&, const uint8_t*);
+extern template void insert_sort_values_str(const uint8_t*, const uint32_t*, uint32_t, int32_t*, int, GroupGatherer&, const uint8_t*);
+extern template void insert_sort_keys_str(  const uint8_t*, const uint64_t*, uint64_t, int32_t*, int32_t*, int, GroupGatherer&, const uint8_t*);
+extern template void insert_sort_values_str(const uint8_t*, const uint64_t*, uint64_t, int32_t*, int, GroupGatherer&, const uint8_t*);
 
-extern template int compare_offstrings(const uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t);
-extern template int compare_offstrings(const uint8_t*, uint64_t, uint64_t, uint64_t, uint64_t);
+extern template int compare_offstrings(const uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t, const uint8_t*);
+extern template int compare_offstrings(const uint8_t*, uint64_t, uint64_t, uint64_t, uint64_t, const uint8_t*);
 
 extern template void GroupGatherer::from_data(const uint8_t*,  int32_t*, size_t);
 extern template void GroupGatherer::from_data(const uint16_t*, int32_t*, size_t);
 extern template void GroupGatherer::from_data(const uint32_t*, int32_t*, size_t);
 extern template void GroupGatherer::from_data(const uint64_t*, int32_t*, size_t);
-extern template void GroupGatherer::from_data(const uint8_t*, const uint32_t*, uint32_t, int32_t*, size_t);
-extern template void GroupGatherer::from_data(const uint8_t*, const uint64_t*, uint64_t, int32_t*, size_t);
+extern template void GroupGatherer::from_data(const uint8_t*, const uint32_t*, uint32_t, int32_t*, size_t, const uint8_t*);
+extern template void GroupGatherer::from_data(const uint8_t*, const uint64_t*, uint64_t, int32_t*, size_t, const uint8_t*);
 
 
 #endif
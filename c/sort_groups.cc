@@ -6,8 +6,15 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include "sort.h"
+#include <cstring>  // std::memcpy, std::memmove
 #include <utility>  // std::move
 #include "utils/assert.h"
+#include "utils/omp.h"
+
+
+// Compacting group chunks below this total size is cheaper to do serially
+// than to pay for the temporary buffer and the parallel region.
+static constexpr size_t MIN_PARALLEL_GROUPS = 1 << 16;
 
 
 
@@ -47,7 +54,8 @@ void GroupGatherer::from_data(const T* data, V* o, size_t n) {
 
 template <typename T, typename V>
 void GroupGatherer::from_data(
-  const uint8_t* strdata, const T* stroffs, T start, V* o, size_t n)
+  const uint8_t* strdata, const T* stroffs, T start, V* o, size_t n,
+  const uint8_t* xform)
 {
   if (n == 0) return;
   T olast0 = (stroffs[o[0] - 1] & ~GETNA<T>()) + start;
@@ -56,7 +64,7 @@ void GroupGatherer::from_data(
   for (size_t i = 1; i < n; ++i) {
     T ocurr0 = (stroffs[o[i] - 1] & ~GETNA<T>()) + start;
     T ocurr1 = stroffs[o[i]];
-    if (compare_offstrings(strdata, olast0, olast1, ocurr0, ocurr1)) {
+    if (compare_offstrings(strdata, olast0, olast1, ocurr0, ocurr1, xform)) {
       push(i - lasti);
       olast0 = ocurr0;
       olast1 = ocurr1;
@@ -69,18 +77,52 @@ void GroupGatherer::from_data(
 
 void GroupGatherer::from_chunks(radix_range* rrmap, size_t nradixes) {
   xassert(count == 0);
-  size_t dest_off = 0;
+
+  // Determine the destination offset of each radix chunk with a prefix scan
+  // over the chunk sizes.
+  dt::array<size_t> dests(nradixes);
+  size_t total = 0;
   for (size_t i = 0; i < nradixes; ++i) {
-    size_t grp_size = rrmap[i].size;
-    if (!grp_size) continue;
-    size_t grp_off = rrmap[i].offset;
-    if (grp_off != dest_off) {
-      std::memmove(groups + dest_off, groups + grp_off,
-                   grp_size * sizeof(int32_t));
+    dests[i] = total;
+    total += rrmap[i].size;
+  }
+
+  if (total >= MIN_PARALLEL_GROUPS) {
+    // Chunks are always moved to the left, so compacting them in-place in
+    // parallel would race: the destination range of one chunk may overlap
+    // the source range of its left neighbor. Instead, gather all chunks
+    // into a temporary buffer in parallel, then copy the result back
+    // (both loops touch strictly disjoint regions per chunk).
+    dt::array<int32_t> tmp(total);
+    #pragma omp parallel for schedule(dynamic)
+    for (size_t i = 0; i < nradixes; ++i) {
+      size_t grp_size = rrmap[i].size;
+      if (!grp_size) continue;
+      std::memcpy(tmp.data() + dests[i], groups + rrmap[i].offset,
+                  grp_size * sizeof(int32_t));
+    }
+    #pragma omp parallel for schedule(dynamic)
+    for (size_t i = 0; i < nradixes; ++i) {
+      size_t grp_size = rrmap[i].size;
+      if (!grp_size) continue;
+      std::memcpy(groups + dests[i], tmp.data() + dests[i],
+                  grp_size * sizeof(int32_t));
+    }
+  } else {
+    size_t dest_off = 0;
+    for (size_t i = 0; i < nradixes; ++i) {
+      size_t grp_size = rrmap[i].size;
+      if (!grp_size) continue;
+      size_t grp_off = rrmap[i].offset;
+      if (grp_off != dest_off) {
+        std::memmove(groups + dest_off, groups + grp_off,
+                     grp_size * sizeof(int32_t));
+      }
+      dest_off += grp_size;
     }
-    dest_off += grp_size;
+    xassert(dest_off == total);
   }
-  count = static_cast<int32_t>(dest_off);
+  count = static_cast<int32_t>(total);
   xassert(count > 0);
   cumsize = groups[count - 1];
 }
@@ -107,5 +149,5 @@ template void GroupGatherer::from_data(const uint8_t*,  int32_t*, size_t);
 template void GroupGatherer::from_data(const uint16_t*, int32_t*, size_t);
 template void GroupGatherer::from_data(const uint32_t*, int32_t*, size_t);
 template void GroupGatherer::from_data(const uint64_t*, int32_t*, size_t);
-template void GroupGatherer::from_data(const uint8_t*, const uint32_t*, uint32_t, int32_t*, size_t);
-template void GroupGatherer::from_data(const uint8_t*, const uint64_t*, uint64_t, int32_t*, size_t);
+template void GroupGatherer::from_data(const uint8_t*, const uint32_t*, uint32_t, int32_t*, size_t, const uint8_t*);
+template void GroupGatherer::from_data(const uint8_t*, const uint64_t*, uint64_t, int32_t*, size_t, const uint8_t*);
@@ -37,7 +37,8 @@
  */
 template <typename T>
 int compare_offstrings(
-    const uint8_t* strdata, T aoff0, T aoff1, T boff0, T boff1)
+    const uint8_t* strdata, T aoff0, T aoff1, T boff0, T boff1,
+    const uint8_t* xform)
 {
   // Handle NAs and empty strings
   if (ISNA<T>(boff1)) return ISNA<T>(aoff1)? 0 : -1;
@@ -51,6 +52,7 @@ int compare_offstrings(
     if (t == lenb) return -1;  // b is shorter than a
     uint8_t ca = strdata[aoff0 + t];
     uint8_t cb = strdata[boff0 + t];
+    if (xform) { ca = xform[ca]; cb = xform[cb]; }
     if (ca == cb) continue;
     return (ca < cb)? 1 : -1;  // a and b differ at character t
   }
@@ -141,7 +143,7 @@ void insert_sort_keys(const T* x, V* o, V* tmp, int n, GroupGatherer& gg)
 template <typename T, typename V>
 void insert_sort_keys_str(
     const uint8_t* strdata, const T* stroffs, T strstart, V* o, V* tmp, int n,
-    GroupGatherer& gg)
+    GroupGatherer& gg, const uint8_t* xform)
 {
   int j;
   tmp[0] = 0;
@@ -152,7 +154,7 @@ void insert_sort_keys_str(
       V k = tmp[j - 1];
       T off0k = (stroffs[o[k] - 1] + strstart) & ~GETNA<T>();
       T off1k = stroffs[o[k]];
-      int cmp = compare_offstrings(strdata, off0i, off1i, off0k, off1k);
+      int cmp = compare_offstrings(strdata, off0i, off1i, off0k, off1k, xform);
       if (cmp != 1) break;
       tmp[j] = tmp[j-1];
     }
@@ -162,7 +164,8 @@ void insert_sort_keys_str(
     tmp[i] = o[tmp[i]];
   }
   if (gg) {
-    gg.from_data(strdata, stroffs, strstart, tmp, static_cast<size_t>(n));
+    gg.from_data(strdata, stroffs, strstart, tmp, static_cast<size_t>(n),
+                 xform);
   }
   std::memcpy(o, tmp, static_cast<size_t>(n) * sizeof(V));
 }
@@ -171,7 +174,7 @@ void insert_sort_keys_str(
 template <typename T, typename V>
 void insert_sort_values_str(
     const uint8_t* strdata, const T* stroffs, T strstart, V* o, int n,
-    GroupGatherer& gg)
+    GroupGatherer& gg, const uint8_t* xform)
 {
   int j;
   o[0] = 0;
@@ -182,14 +185,14 @@ void insert_sort_values_str(
       V k = o[j - 1];
       T off0k = (stroffs[k - 1] + strstart) & ~GETNA<T>();
       T off1k = stroffs[k];
-      int cmp = compare_offstrings(strdata, off0i, off1i, off0k, off1k);
+      int cmp = compare_offstrings(strdata, off0i, off1i, off0k, off1k, xform);
       if (cmp != 1) break;
       o[j] = o[j-1];
     }
     o[j] = static_cast<V>(i);
   }
   if (gg) {
-    gg.from_data(strdata, stroffs, strstart, o, static_cast<size_t>(n));
+    gg.from_data(strdata, stroffs, strstart, o, static_cast<size_t>(n), xform);
   }
 }
 
@@ -209,9 +212,9 @@ template void insert_sort_values(const uint16_t*, int32_t*, int, GroupGatherer&)
 template void insert_sort_values(const uint32_t*, int32_t*, int, GroupGatherer&);
 template void insert_sort_values(const uint64_t*, int32_t*, int, GroupGatherer&);
 
-template void insert_sort_keys_str(  const uint8_t*, const uint32_t*, uint32_t, int32_t*, int32_t*, int, GroupGatherer&);
-template void insert_sort_values_str(const uint8_t*, const uint32_t*, uint32_t, int32_t*, int, GroupGatherer&);
-template void insert_sort_keys_str(  const uint8_t*, const uint64_t*, uint64_t, int32_t*, int32_t*, int, GroupGatherer&);
-template void insert_sort_values_str(const uint8_t*, const uint64_t*, uint64_t, int32_t*, int, GroupGatherer&);
-template int compare_offstrings(const uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t);
-template int compare_offstrings(const uint8_t*, uint64_t, uint64_t, uint64_t, uint64_t);
+template void insert_sort_keys_str(  const uint8_t*, const uint32_t*, uint32_t, int32_t*, int32_t*, int, GroupGatherer&, const uint8_t*);
+template void insert_sort_values_str(const uint8_t*, const uint32_t*, uint32_t, int32_t*, int, GroupGatherer&, const uint8_t*);
+template void insert_sort_keys_str(  const uint8_t*, const uint64_t*, uint64_t, int32_t*, int32_t*, int, GroupGatherer&, const uint8_t*);
+template void insert_sort_values_str(const uint8_t*, const uint64_t*, uint64_t, int32_t*, int, GroupGatherer&, const uint8_t*);
+template int compare_offstrings(const uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t, const uint8_t*);
+template int compare_offstrings(const uint8_t*, uint64_t, uint64_t, uint64_t, uint64_t, const uint8_t*);
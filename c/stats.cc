@@ -6,11 +6,18 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include "stats.h"
+#include <algorithm>    // std::min, std::sort
 #include <cmath>        // std::isinf, std::sqrt
+#include <cstring>      // std::memcpy
 #include <limits>       // std::numeric_limits
 #include <type_traits>  // std::is_floating_point
+#include <unordered_set>
+#include <utility>      // std::pair
 #include "column.h"
+#include "datatable.h"
+#include "options.h"
 #include "rowindex.h"
+#include "sort.h"       // compare_offstrings
 #include "utils.h"
 #include "utils/omp.h"
 
@@ -49,6 +56,7 @@ static const char* stat_name(Stat s) {
 
 void Stats::reset() {
   _computed.reset();
+  _nunique_est = -1;
 }
 
 bool Stats::is_computed(Stat s) const {
@@ -70,15 +78,33 @@ int64_t Stats::countna(const Column* col) {
 }
 
 int64_t Stats::nunique(const Column* col) {
-  if (!is_computed(Stat::NUnique)) compute_sorted_stats(col);
+  if (!is_computed(Stat::NUnique)) compute_nunique_stats(col);
   return _nunique;
 }
 
+int64_t Stats::nunique_estimate(const Column* col) {
+  if (is_computed(Stat::NUnique)) return _nunique;
+  if (_nunique_est < 0) compute_nunique_estimate(col);
+  return _nunique_est;
+}
+
+void Stats::compute_nunique_estimate(const Column* col) {
+  _nunique_est = nunique(col);
+}
+
+void Stats::compute_nunique_stats(const Column* col) {
+  compute_sorted_stats(col);
+}
+
 int64_t Stats::nmodal(const Column* col) {
-  if (!is_computed(Stat::NModal)) compute_sorted_stats(col);
+  if (!is_computed(Stat::NModal)) compute_mode_stats(col);
   return _nmodal;
 }
 
+void Stats::compute_mode_stats(const Column* col) {
+  compute_sorted_stats(col);
+}
+
 void Stats::set_countna(int64_t n) {
   set_computed(Stat::NaCount, !ISNA<int64_t>(n));
   _countna = n;
@@ -89,8 +115,25 @@ size_t Stats::memory_footprint() const {
 }
 
 
-void Stats::merge_stats(const Stats*) {
-  // TODO: implement
+/**
+ * Base implementation: of the generic stats only the NA count is mergeable.
+ * The NA count of the appended chunk is computed lazily here, i.e. it costs
+ * one pass over the (typically small) chunk, not over the whole column.
+ */
+void Stats::merge_stats(const Column* other, int64_t this_nrows) {
+  (void) this_nrows;
+  bool have_na = is_computed(Stat::NaCount);
+  int64_t countna2 = 0;
+  if (have_na) {
+    countna2 = (other->stype() == SType::VOID)? other->nrows
+                                              : other->countna();
+  }
+  _computed.reset();
+  _nunique_est = -1;
+  if (have_na) {
+    _countna += countna2;
+    set_computed(Stat::NaCount);
+  }
 }
 
 
@@ -122,6 +165,263 @@ void Stats::verify_stat(Stat s, T value, F getter) const {
 
 
 
+//==============================================================================
+// TDigest
+//==============================================================================
+
+/**
+ * Minimal merging t-digest (Dunning & Ertl): an approximate, mergeable
+ * summary of a distribution. Values are buffered, then periodically sorted
+ * and merged into a bounded list of weighted centroids; the weight a
+ * centroid is allowed to carry shrinks towards the tails, so extreme
+ * quantiles stay sharp while the middle of the distribution is summarized
+ * coarsely. The `compression` parameter bounds the number of centroids
+ * (and hence the error): quantile error is O(1/compression).
+ *
+ * Digests built independently over different chunks of the data can be
+ * merged, which is what makes a single parallel pass with per-thread
+ * digests possible.
+ */
+class TDigest {
+  private:
+    struct Centroid {
+      double mean;
+      double weight;
+      bool operator<(const Centroid& o) const { return mean < o.mean; }
+    };
+    static constexpr size_t BUFFER_SIZE = 2048;
+    std::vector<Centroid> centroids;  // compressed summary, sorted by mean
+    std::vector<double> buffer;       // incoming values not yet merged
+    double total_weight;
+    double compression;
+
+  public:
+    explicit TDigest(double k) : total_weight(0), compression(k) {
+      buffer.reserve(BUFFER_SIZE);
+    }
+
+    void add(double x) {
+      buffer.push_back(x);
+      if (buffer.size() == BUFFER_SIZE) flush();
+    }
+
+    void merge(TDigest& other) {
+      other.flush();
+      flush();
+      centroids.insert(centroids.end(),
+                       other.centroids.begin(), other.centroids.end());
+      total_weight += other.total_weight;
+      compress();
+    }
+
+    /**
+     * Estimate the `q`-th quantile (0 <= q <= 1) by interpolating linearly
+     * between the means of adjacent centroids, treating each centroid's
+     * mean as located at the midpoint of its weight span.
+     */
+    double quantile(double q) {
+      flush();
+      size_t n = centroids.size();
+      if (n == 0) return GETNA<double>();
+      double target = q * total_weight;
+      double cum = 0;       // total weight of centroids before the current one
+      double prev_mid = 0;
+      double prev_mean = centroids[0].mean;
+      for (size_t i = 0; i < n; ++i) {
+        double mid = cum + centroids[i].weight / 2;
+        if (target < mid) {
+          if (i == 0) return centroids[0].mean;
+          double t = (target - prev_mid) / (mid - prev_mid);
+          return prev_mean + t * (centroids[i].mean - prev_mean);
+        }
+        prev_mid = mid;
+        prev_mean = centroids[i].mean;
+        cum += centroids[i].weight;
+      }
+      return centroids[n - 1].mean;
+    }
+
+  private:
+    void flush() {
+      if (buffer.empty()) return;
+      for (double x : buffer) {
+        centroids.push_back(Centroid { x, 1.0 });
+      }
+      total_weight += static_cast<double>(buffer.size());
+      buffer.clear();
+      compress();
+    }
+
+    void compress() {
+      if (centroids.empty()) return;
+      std::sort(centroids.begin(), centroids.end());
+      std::vector<Centroid> merged;
+      merged.push_back(centroids[0]);
+      double cum = 0;  // weight of finalized centroids before `merged.back()`
+      for (size_t i = 1; i < centroids.size(); ++i) {
+        Centroid& last = merged.back();
+        double q = (cum + last.weight / 2) / total_weight;
+        double limit = 4 * total_weight * q * (1 - q) / compression;
+        if (last.weight + centroids[i].weight <= limit) {
+          last.mean += (centroids[i].mean - last.mean) *
+                       centroids[i].weight / (last.weight + centroids[i].weight);
+          last.weight += centroids[i].weight;
+        } else {
+          cum += last.weight;
+          merged.push_back(centroids[i]);
+        }
+      }
+      centroids = std::move(merged);
+    }
+};
+
+constexpr size_t TDigest::BUFFER_SIZE;
+
+
+
+//==============================================================================
+// HLLCounter
+//==============================================================================
+
+/**
+ * HyperLogLog distinct-count estimator (Flajolet et al.). Each hashed value
+ * is routed by its top P bits into one of 2^P registers, which remembers
+ * the longest run of leading zeros seen in the remaining bits; the harmonic
+ * mean of the registers then estimates the cardinality. With P = 14 the
+ * sketch is 16KB and the relative error is about 0.8%. Registers from
+ * independently-built counters merge by taking the elementwise maximum,
+ * which allows one counter per thread in a parallel scan.
+ */
+class HLLCounter {
+  private:
+    static constexpr int P = 14;
+    static constexpr size_t NREGS = size_t(1) << P;
+    std::vector<uint8_t> regs;
+
+  public:
+    HLLCounter() : regs(NREGS, 0) {}
+
+    void add(uint64_t hash) {
+      size_t j = static_cast<size_t>(hash >> (64 - P));
+      uint64_t rest = hash << P;
+      uint8_t rank = static_cast<uint8_t>(rest? dt::nlz(rest) + 1 : 64 - P + 1);
+      if (rank > regs[j]) regs[j] = rank;
+    }
+
+    void merge(const HLLCounter& other) {
+      for (size_t j = 0; j < NREGS; ++j) {
+        if (other.regs[j] > regs[j]) regs[j] = other.regs[j];
+      }
+    }
+
+    int64_t estimate() const {
+      double m = static_cast<double>(NREGS);
+      double sum = 0;
+      size_t nzeros = 0;
+      for (uint8_t r : regs) {
+        sum += std::ldexp(1.0, -r);
+        nzeros += (r == 0);
+      }
+      double alpha = 0.7213 / (1 + 1.079 / m);
+      double e = alpha * m * m / sum;
+      // Small-range correction: fall back to linear counting
+      if (e <= 2.5 * m && nzeros > 0) {
+        e = m * std::log(m / static_cast<double>(nzeros));
+      }
+      return static_cast<int64_t>(e + 0.5);
+    }
+};
+
+constexpr size_t HLLCounter::NREGS;
+
+
+// Finalizer of the splitmix64 generator: a cheap invertible mixer with good
+// avalanche properties, sufficient for hashing raw element bit patterns.
+static uint64_t hash_uint64(uint64_t x) {
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+
+
+//==============================================================================
+// CountTable
+//==============================================================================
+
+/**
+ * Open-addressing (linear probing) hash table mapping raw 64-bit element
+ * bit patterns to occurrence counts. The table doubles when half full, and
+ * `add` refuses to grow past a caller-supplied limit on the number of
+ * distinct keys -- the caller is expected to bail out to a slower exact
+ * algorithm in that case. Tables built over disjoint chunks of data merge
+ * by adding up the counts of matching keys.
+ */
+class CountTable {
+  private:
+    struct Entry {
+      uint64_t key;
+      int64_t count;  // 0 denotes an empty slot
+    };
+    std::vector<Entry> entries;
+    size_t nentries;
+
+  public:
+    CountTable() : entries(2048), nentries(0) {}
+
+    size_t size() const { return nentries; }
+
+    bool add(uint64_t key, int64_t count, size_t limit) {
+      size_t mask = entries.size() - 1;
+      size_t j = static_cast<size_t>(hash_uint64(key)) & mask;
+      while (entries[j].count && entries[j].key != key) j = (j + 1) & mask;
+      if (entries[j].count) {
+        entries[j].count += count;
+      } else {
+        if (nentries == limit) return false;
+        if ((nentries + 1) * 2 > entries.size()) {
+          grow();
+          return add(key, count, limit);
+        }
+        entries[j].key = key;
+        entries[j].count = count;
+        nentries++;
+      }
+      return true;
+    }
+
+    bool merge(const CountTable& other, size_t limit) {
+      for (const Entry& e : other.entries) {
+        if (e.count && !add(e.key, e.count, limit)) return false;
+      }
+      return true;
+    }
+
+    template <typename F>
+    void each(F f) const {
+      for (const Entry& e : entries) {
+        if (e.count) f(e.key, e.count);
+      }
+    }
+
+  private:
+    void grow() {
+      std::vector<Entry> old;
+      old.swap(entries);
+      entries.resize(old.size() * 2);
+      size_t mask = entries.size() - 1;
+      for (const Entry& e : old) {
+        if (!e.count) continue;
+        size_t j = static_cast<size_t>(hash_uint64(e.key)) & mask;
+        while (entries[j].count) j = (j + 1) & mask;
+        entries[j] = e;
+      }
+    }
+};
+
+
+
 //==============================================================================
 // NumericalStats
 //==============================================================================
@@ -133,6 +433,8 @@ void Stats::verify_stat(Stat s, T value, F getter) const {
  */
 template <typename T, typename A>
 void NumericalStats<T, A>::compute_numerical_stats(const Column* col) {
+  // A single sequential pass over the column: hint the kernel to read ahead
+  col->memory_advise(MmmAdvice::Sequential);
   int64_t nrows = col->nrows;
   const RowIndex& rowindex = col->rowindex();
   const T* data = static_cast<const T*>(col->data());
@@ -149,6 +451,13 @@ void NumericalStats<T, A>::compute_numerical_stats(const Column* col) {
   {
     int ith = omp_get_thread_num();  // current thread index
     int nth = omp_get_num_threads(); // total number of threads
+    // Give each thread a contiguous chunk of rows (rather than interleaving
+    // rows between the threads): this way each cache line of the data is
+    // streamed into exactly one core, and the scan runs at the machine's
+    // aggregate memory bandwidth.
+    int64_t chunksize = (nrows + nth - 1) / nth;
+    int64_t chunk0 = std::min(static_cast<int64_t>(ith) * chunksize, nrows);
+    int64_t chunk1 = std::min(chunk0 + chunksize, nrows);
     int64_t t_count_notna = 0;
     int64_t n1 = 0;
     int64_t n2 = 0; // added for readability
@@ -162,7 +471,7 @@ void NumericalStats<T, A>::compute_numerical_stats(const Column* col) {
     T t_min = infinity<T>();
     T t_max = -infinity<T>();
 
-    rowindex.strided_loop(ith, nrows, nth,
+    rowindex.strided_loop(chunk0, chunk1, 1,
       [&](int64_t i) {
         if (ISNA<int64_t>(i)) return;
         T x = data[i];
@@ -288,6 +597,370 @@ void NumericalStats<T, A>::compute_sorted_stats(const Column* col) {
 }
 
 
+/**
+ * Approximate Qt25/Median/Qt75 computation: a single parallel pass over the
+ * column with a t-digest sketch per thread, merged at the end. Unlike the
+ * exact quantiles (which would need a full O(n log n) sort), this runs in
+ * O(n) and in parallel; the accuracy is controlled by the
+ * `stats.quantile_compression` option.
+ */
+template <typename T, typename A>
+void NumericalStats<T, A>::compute_approx_quantiles(const Column* col) {
+  // A single sequential pass over the column: hint the kernel to read ahead
+  col->memory_advise(MmmAdvice::Sequential);
+  int64_t nrows = col->nrows;
+  const RowIndex& rowindex = col->rowindex();
+  const T* data = static_cast<const T*>(col->data());
+  double k = static_cast<double>(config::stats_quantile_compression);
+  TDigest digest(k);
+
+  #pragma omp parallel
+  {
+    int ith = omp_get_thread_num();  // current thread index
+    int nth = omp_get_num_threads(); // total number of threads
+    // Contiguous chunks per thread: see compute_numerical_stats above.
+    int64_t chunksize = (nrows + nth - 1) / nth;
+    int64_t chunk0 = std::min(static_cast<int64_t>(ith) * chunksize, nrows);
+    int64_t chunk1 = std::min(chunk0 + chunksize, nrows);
+    TDigest tdigest(k);
+
+    rowindex.strided_loop(chunk0, chunk1, 1,
+      [&](int64_t i) {
+        if (ISNA<int64_t>(i)) return;
+        T x = data[i];
+        if (ISNA<T>(x)) return;
+        tdigest.add(static_cast<double>(x));
+      });
+
+    #pragma omp critical
+    {
+      digest.merge(tdigest);
+    }
+  }
+
+  _qt25   = digest.quantile(0.25);
+  _median = digest.quantile(0.50);
+  _qt75   = digest.quantile(0.75);
+  set_computed(Stat::Qt25);
+  set_computed(Stat::Median);
+  set_computed(Stat::Qt75);
+}
+
+
+/**
+ * NUnique without sorting, enabled by the `stats.nunique_approx` option
+ * (the default path sorts the column, which for a long id-like column is
+ * by far the most expensive stat). One parallel pass; each thread keeps
+ *   - an exact hash set of raw element bit patterns, abandoned once it
+ *     outgrows a fixed limit, and
+ *   - a HyperLogLog counter, always maintained.
+ * If the merged exact sets stayed within the limit the count is exact
+ * (typical for low-cardinality "categorical" columns); otherwise the
+ * merged HyperLogLog estimate (~0.8% relative error) is used.
+ */
+template <typename T, typename A>
+void NumericalStats<T, A>::compute_nunique_stats(const Column* col) {
+  if (!config::stats_nunique_approx) {
+    compute_sorted_stats(col);
+    return;
+  }
+  // A single sequential pass over the column: hint the kernel to read ahead
+  col->memory_advise(MmmAdvice::Sequential);
+  int64_t nrows = col->nrows;
+  const RowIndex& rowindex = col->rowindex();
+  const T* data = static_cast<const T*>(col->data());
+  constexpr size_t EXACT_LIMIT = 65536;
+  HLLCounter hll;
+  std::unordered_set<uint64_t> exact;
+  bool overflow = false;
+
+  #pragma omp parallel
+  {
+    int ith = omp_get_thread_num();  // current thread index
+    int nth = omp_get_num_threads(); // total number of threads
+    // Contiguous chunks per thread: see compute_numerical_stats above.
+    int64_t chunksize = (nrows + nth - 1) / nth;
+    int64_t chunk0 = std::min(static_cast<int64_t>(ith) * chunksize, nrows);
+    int64_t chunk1 = std::min(chunk0 + chunksize, nrows);
+    HLLCounter t_hll;
+    std::unordered_set<uint64_t> t_exact;
+    bool t_overflow = false;
+
+    rowindex.strided_loop(chunk0, chunk1, 1,
+      [&](int64_t i) {
+        if (ISNA<int64_t>(i)) return;
+        T x = data[i];
+        if (ISNA<T>(x)) return;
+        uint64_t bits = 0;
+        std::memcpy(&bits, &x, sizeof(T));
+        t_hll.add(hash_uint64(bits));
+        if (!t_overflow) {
+          t_exact.insert(bits);
+          if (t_exact.size() > EXACT_LIMIT) {
+            t_overflow = true;
+            t_exact.clear();
+          }
+        }
+      });
+
+    #pragma omp critical
+    {
+      hll.merge(t_hll);
+      overflow |= t_overflow;
+      if (!overflow) {
+        exact.insert(t_exact.begin(), t_exact.end());
+        if (exact.size() > EXACT_LIMIT) {
+          overflow = true;
+          exact.clear();
+        }
+      }
+    }
+  }
+
+  _nunique = overflow? hll.estimate() : static_cast<int64_t>(exact.size());
+  set_computed(Stat::NUnique);
+}
+
+
+/**
+ * Estimate NUnique from a systematic sample: one value is read every
+ * `nrows / SAMPLE_SIZE` rows, so the sample spans the whole column (a
+ * prefix sample badly misjudges sorted or clustered data). The sampled
+ * values are counted in a hash table, and the distinct count is scaled up
+ * with the GEE estimator of Charikar et al: values seen two or more times
+ * in the sample are likely frequent everywhere, while each value seen
+ * exactly once stands for about sqrt(nrows / sample_size) unseen ones.
+ * The result is only a planning hint; it is never reported as NUnique.
+ */
+template <typename T, typename A>
+void NumericalStats<T, A>::compute_nunique_estimate(const Column* col) {
+  constexpr int64_t SAMPLE_SIZE = 4096;
+  int64_t nrows = col->nrows;
+  const RowIndex& rowindex = col->rowindex();
+  const T* data = static_cast<const T*>(col->data());
+
+  int64_t step = nrows / SAMPLE_SIZE;
+  if (step < 1) step = 1;
+  CountTable sample;
+  int64_t nsampled = 0;
+  rowindex.strided_loop(0, nrows, step,
+    [&](int64_t i) {
+      if (ISNA<int64_t>(i)) return;
+      nsampled++;
+      T x = data[i];
+      if (ISNA<T>(x)) return;
+      uint64_t bits = 0;
+      std::memcpy(&bits, &x, sizeof(T));
+      sample.add(bits, 1, static_cast<size_t>(-1));
+    });
+
+  int64_t d = static_cast<int64_t>(sample.size());
+  if (step == 1) {
+    // The "sample" covered every row, so the count is in fact exact.
+    _nunique = d;
+    set_computed(Stat::NUnique);
+    _nunique_est = d;
+    return;
+  }
+  int64_t f1 = 0;
+  sample.each([&](uint64_t, int64_t count) { f1 += (count == 1); });
+  double scale = std::sqrt(static_cast<double>(nrows) /
+                           static_cast<double>(std::max<int64_t>(nsampled, 1)));
+  int64_t est = d - f1 + static_cast<int64_t>(static_cast<double>(f1) * scale);
+  if (est > nrows) est = nrows;
+  if (est < d) est = d;
+  _nunique_est = est;
+}
+
+
+template <typename T, typename A>
+void NumericalStats<T, A>::compute_mode_stats(const Column* col) {
+  if (compute_hashed_mode(col)) return;
+  compute_sorted_stats(col);
+}
+
+
+/**
+ * Attempt to compute Mode/NModal (and, as an exact byproduct, NUnique) by
+ * counting values in per-thread open-addressing hash tables merged at the
+ * end: O(n) instead of the full O(n log n) sort, provided the column's
+ * cardinality is low (enum-like). The cardinality is first estimated from
+ * a sample (see compute_nunique_estimate); if that looks small, the full
+ * parallel count runs, and
+ * bails out (returning false, so that the caller falls back to the sort
+ * path) if any table outgrows a fixed limit after all.
+ */
+template <typename T, typename A>
+bool NumericalStats<T, A>::compute_hashed_mode(const Column* col) {
+  constexpr size_t FULL_LIMIT = 65536;
+  int64_t nrows = col->nrows;
+  const RowIndex& rowindex = col->rowindex();
+  const T* data = static_cast<const T*>(col->data());
+
+  // Consult the sampled cardinality estimate first, leaving some headroom
+  // below the hard table limit for what the sample may have missed.
+  if (nunique_estimate(col) > static_cast<int64_t>(FULL_LIMIT) / 2) {
+    return false;
+  }
+
+  // A single sequential pass over the column: hint the kernel to read ahead
+  col->memory_advise(MmmAdvice::Sequential);
+  CountTable total;
+  bool failed = false;
+
+  #pragma omp parallel
+  {
+    int ith = omp_get_thread_num();  // current thread index
+    int nth = omp_get_num_threads(); // total number of threads
+    // Contiguous chunks per thread: see compute_numerical_stats above.
+    int64_t chunksize = (nrows + nth - 1) / nth;
+    int64_t chunk0 = std::min(static_cast<int64_t>(ith) * chunksize, nrows);
+    int64_t chunk1 = std::min(chunk0 + chunksize, nrows);
+    CountTable t_table;
+    bool t_ok = true;
+
+    rowindex.strided_loop(chunk0, chunk1, 1,
+      [&](int64_t i) {
+        if (!t_ok || ISNA<int64_t>(i)) return;
+        T x = data[i];
+        if (ISNA<T>(x)) return;
+        uint64_t bits = 0;
+        std::memcpy(&bits, &x, sizeof(T));
+        t_ok = t_table.add(bits, 1, FULL_LIMIT);
+      });
+
+    #pragma omp critical
+    {
+      if (!t_ok) failed = true;
+      if (!failed) failed = !total.merge(t_table, FULL_LIMIT);
+    }
+  }
+  if (failed) return false;
+
+  // Pick the most frequent value; ties break towards the smallest bit
+  // pattern, so that the result does not depend on thread scheduling.
+  uint64_t mode_bits = 0;
+  int64_t max_count = 0;
+  total.each([&](uint64_t key, int64_t count) {
+    if (count > max_count || (count == max_count && key < mode_bits)) {
+      max_count = count;
+      mode_bits = key;
+    }
+  });
+
+  _nmodal = max_count;
+  if (max_count) {
+    std::memcpy(&_mode, &mode_bits, sizeof(T));
+  } else {
+    _mode = GETNA<T>();
+  }
+  _nunique = static_cast<int64_t>(total.size());
+  set_computed(Stat::Mode);
+  set_computed(Stat::NModal);
+  set_computed(Stat::NUnique);
+  return true;
+}
+
+
+/**
+ * Incremental update of the numeric stats after an append (see the base
+ * class declaration). Min, max, sum and the NA count merge trivially; the
+ * moment statistics are first converted back to central moments and then
+ * combined with the same pairwise formulas used by the parallel reduction
+ * in compute_numerical_stats. Retrieving the chunk's stats below triggers
+ * their computation, which scans the appended rows only.
+ */
+template <typename T, typename A>
+void NumericalStats<T, A>::merge_stats(const Column* ocol, int64_t nrows1) {
+  bool chunk_is_na = (ocol->stype() == SType::VOID);
+  int64_t nrows2 = ocol->nrows;
+  auto other = chunk_is_na? nullptr
+             : static_cast<NumericalStats<T, A>*>(ocol->get_stats());
+
+  bool have_na  = is_computed(Stat::NaCount);
+  bool have_min = is_computed(Stat::Min);
+  bool have_max = is_computed(Stat::Max);
+  bool have_sum = is_computed(Stat::Sum);
+  bool have_mom = have_na &&
+                  is_computed(Stat::Mean) && is_computed(Stat::StDev) &&
+                  is_computed(Stat::Skew) && is_computed(Stat::Kurt) &&
+                  !ISNA<double>(_mean) && !ISNA<double>(_sd);
+
+  int64_t countna2 = nrows2;
+  T min2 = GETNA<T>();
+  T max2 = GETNA<T>();
+  A sum2 = 0;
+  double mean2 = 0, sd2 = 0, skew2 = 0, kurt2 = 0;
+  if (other) {
+    if (have_na || have_mom) countna2 = other->countna(ocol);
+    if (have_min) min2 = other->min(ocol);
+    if (have_max) max2 = other->max(ocol);
+    if (have_sum) sum2 = other->sum(ocol);
+    if (have_mom) {
+      mean2 = other->mean(ocol);
+      sd2   = other->stdev(ocol);
+      skew2 = other->skew(ocol);
+      kurt2 = other->kurt(ocol);
+      int64_t n_b = nrows2 - countna2;
+      if (n_b > 0 && (ISNA<double>(mean2) || ISNA<double>(sd2))) {
+        have_mom = false;  // e.g. a chunk containing infinities (RealStats)
+      }
+    }
+  }
+
+  if (have_mom) {
+    int64_t n_a = nrows1 - _countna;
+    int64_t n_b = nrows2 - countna2;
+    if (n_b > 0 && n_a == 0) {
+      _mean = mean2;
+      _sd   = sd2;
+      _skew = skew2;
+      _kurt = kurt2;
+    } else if (n_b > 0) {
+      double na = static_cast<double>(n_a);
+      double nb = static_cast<double>(n_b);
+      double nc = na + nb;
+      // Recover the central moments from the stored statistics (inverting
+      // the final formulas of compute_numerical_stats)
+      double m2_a = _sd * _sd * (na - 1);
+      double m3_a = m2_a > 0? _skew * std::pow(m2_a, 1.5) / std::sqrt(na) : 0;
+      double m4_a = m2_a > 0? _kurt * m2_a * m2_a / na : 0;
+      double m2_b = sd2 * sd2 * (nb - 1);
+      double m3_b = m2_b > 0? skew2 * std::pow(m2_b, 1.5) / std::sqrt(nb) : 0;
+      double m4_b = m2_b > 0? kurt2 * m2_b * m2_b / nb : 0;
+      double delta = _mean - mean2;
+      double delta2 = delta * delta;
+      double m2_c = m2_a + m2_b + delta2 * na * nb / nc;
+      double m3_c = m3_a + m3_b + delta * delta2 * na * nb * (na - nb)/(nc * nc)
+                    + 3 * delta * (na * m2_b - nb * m2_a) / nc;
+      double m4_c = m4_a + m4_b
+                    + delta2 * delta2 * na * nb * (na*na - na*nb + nb*nb)/(nc*nc*nc)
+                    + 6 * delta2 * (na*na * m2_b + nb*nb * m2_a) / (nc*nc)
+                    + 4 * delta * (na * m3_b - nb * m3_a) / nc;
+      _mean = (_mean * na + mean2 * nb) / nc;
+      _sd   = nc > 1? std::sqrt(m2_c / (nc - 1)) : 0;
+      _skew = nc > 1? std::sqrt(nc) * m3_c / std::pow(m2_c, 1.5) : 0;
+      _kurt = nc > 1? m4_c * nc / (m2_c * m2_c) : 0;
+    }
+  }
+  if (have_min && !ISNA<T>(min2) && (ISNA<T>(_min) || min2 < _min)) _min = min2;
+  if (have_max && !ISNA<T>(max2) && (ISNA<T>(_max) || max2 > _max)) _max = max2;
+  if (have_sum && other) _sum += sum2;
+  if (have_na) _countna += countna2;
+
+  _computed.reset();
+  _nunique_est = -1;
+  set_computed(Stat::NaCount, have_na);
+  set_computed(Stat::Min, have_min);
+  set_computed(Stat::Max, have_max);
+  set_computed(Stat::Sum, have_sum);
+  set_computed(Stat::Mean, have_mom);
+  set_computed(Stat::StDev, have_mom);
+  set_computed(Stat::Skew, have_mom);
+  set_computed(Stat::Kurt, have_mom);
+}
+
+
 template <typename T, typename A>
 A NumericalStats<T, A>::sum(const Column* col) {
   if (!is_computed(Stat::Sum)) compute_numerical_stats(col);
@@ -308,7 +981,7 @@ T NumericalStats<T, A>::max(const Column* col) {
 
 template <typename T, typename A>
 T NumericalStats<T, A>::mode(const Column* col) {
-  if (!is_computed(Stat::Mode)) compute_sorted_stats(col);
+  if (!is_computed(Stat::Mode)) compute_mode_stats(col);
   return _mode;
 }
 
@@ -336,9 +1009,72 @@ double NumericalStats<T, A>::kurt(const Column* col) {
   return _kurt;
 }
 
+template <typename T, typename A>
+double NumericalStats<T, A>::qt25(const Column* col) {
+  if (!is_computed(Stat::Qt25)) compute_approx_quantiles(col);
+  return _qt25;
+}
+
+template <typename T, typename A>
+double NumericalStats<T, A>::median(const Column* col) {
+  if (!is_computed(Stat::Median)) compute_approx_quantiles(col);
+  return _median;
+}
+
+template <typename T, typename A>
+double NumericalStats<T, A>::qt75(const Column* col) {
+  if (!is_computed(Stat::Qt75)) compute_approx_quantiles(col);
+  return _qt75;
+}
+
+/**
+ * Dedicated NA-counting kernel. The NA count gates many query plans, yet
+ * it used to be obtained only as a byproduct of the full moment scan. The
+ * count is a pure equality test against the NA sentinel, so on a
+ * materialized column a tight indexed loop is enough for the compiler to
+ * vectorize it into SIMD compare+accumulate and run at memory bandwidth.
+ * One-byte columns (BOOL/INT8, NA sentinel 0x80) are counted eight
+ * elements per 64-bit word with the standard SWAR zero-byte test
+ * (Hacker's Delight 6-1), after XORing so that NA bytes become zero.
+ */
 template<typename T, typename A>
 void NumericalStats<T, A>::compute_countna(const Column* col) {
-  compute_numerical_stats(col);
+  if (col->rowindex()) {
+    // For views the count comes with the rest of the numerical stats
+    compute_numerical_stats(col);
+    return;
+  }
+  // A single sequential pass over the column: hint the kernel to read ahead
+  col->memory_advise(MmmAdvice::Sequential);
+  int64_t nrows = col->nrows;
+  const T* data = static_cast<const T*>(col->data());
+  int64_t countna = 0;
+
+  if (sizeof(T) == 1) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    constexpr uint64_t NAS  = 0x8080808080808080ULL;
+    constexpr uint64_t ONES = 0x0101010101010101ULL;
+    int64_t nwords = nrows / 8;
+    #pragma omp parallel for schedule(static) reduction(+:countna)
+    for (int64_t w = 0; w < nwords; ++w) {
+      uint64_t v;
+      std::memcpy(&v, bytes + w * 8, 8);
+      v ^= NAS;  // NA bytes become zero
+      uint64_t zeros = (v - ONES) & ~v & NAS;
+      countna += static_cast<int64_t>(((zeros >> 7) * ONES) >> 56);
+    }
+    for (int64_t i = nwords * 8; i < nrows; ++i) {
+      countna += (bytes[i] == 0x80);
+    }
+  } else {
+    #pragma omp parallel for schedule(static) reduction(+:countna)
+    for (int64_t i = 0; i < nrows; ++i) {
+      countna += ISNA<T>(data[i]);
+    }
+  }
+
+  _countna = countna;
+  set_computed(Stat::NaCount);
 }
 
 template<typename T, typename A>
@@ -353,6 +1089,36 @@ void NumericalStats<T, A>::set_max(T value) {
   _max = value;
 }
 
+template<typename T, typename A>
+void NumericalStats<T, A>::set_sum(A value) {
+  set_computed(Stat::Sum, !ISNA<A>(value));
+  _sum = value;
+}
+
+template<typename T, typename A>
+void NumericalStats<T, A>::set_mean(double value) {
+  set_computed(Stat::Mean, !ISNA<double>(value));
+  _mean = value;
+}
+
+template<typename T, typename A>
+void NumericalStats<T, A>::set_sd(double value) {
+  set_computed(Stat::StDev, !ISNA<double>(value));
+  _sd = value;
+}
+
+template<typename T, typename A>
+void NumericalStats<T, A>::set_skew(double value) {
+  set_computed(Stat::Skew, !ISNA<double>(value));
+  _skew = value;
+}
+
+template<typename T, typename A>
+void NumericalStats<T, A>::set_kurt(double value) {
+  set_computed(Stat::Kurt, !ISNA<double>(value));
+  _kurt = value;
+}
+
 
 template<typename T, typename A>
 void NumericalStats<T, A>::verify_more(Stats* test, const Column* col) const
@@ -447,9 +1213,13 @@ void BooleanStats::compute_numerical_stats(const Column *col) {
   {
     int ith = omp_get_thread_num();  // current thread index
     int nth = omp_get_num_threads(); // total number of threads
+    // Contiguous chunks per thread: see NumericalStats above.
+    int64_t chunksize = (nrows + nth - 1) / nth;
+    int64_t chunk0 = std::min(static_cast<int64_t>(ith) * chunksize, nrows);
+    int64_t chunk1 = std::min(chunk0 + chunksize, nrows);
     size_t tcount0 = 0, tcount1 = 0;
 
-    rowindex.strided_loop(ith, nrows, nth,
+    rowindex.strided_loop(chunk0, chunk1, 1,
       [&](int64_t i) {
         int8_t x = data[i];
         tcount0 += (x == 0);
@@ -504,19 +1274,36 @@ BooleanStats* BooleanStats::make() const {
 
 template <typename T>
 void StringStats<T>::compute_countna(const Column* col) {
+  col->memory_advise(MmmAdvice::Sequential);
   const StringColumn<T>* scol = static_cast<const StringColumn<T>*>(col);
   const RowIndex& rowindex = col->rowindex();
   int64_t nrows = scol->nrows;
   int64_t countna = 0;
   const T* data = scol->offsets();
 
+  if (!rowindex) {
+    // Materialized column: a plain indexed loop over the NA bits of the
+    // offsets vectorizes into SIMD shift+accumulate.
+    #pragma omp parallel for schedule(static) reduction(+:countna)
+    for (int64_t i = 0; i < nrows; ++i) {
+      countna += static_cast<int64_t>(data[i] >> (sizeof(T)*8 - 1));
+    }
+    _countna = countna;
+    set_computed(Stat::NaCount);
+    return;
+  }
+
   #pragma omp parallel
   {
     int ith = omp_get_thread_num();  // current thread index
     int nth = omp_get_num_threads(); // total number of threads
+    // Contiguous chunks per thread: see NumericalStats above.
+    int64_t chunksize = (nrows + nth - 1) / nth;
+    int64_t chunk0 = std::min(static_cast<int64_t>(ith) * chunksize, nrows);
+    int64_t chunk1 = std::min(chunk0 + chunksize, nrows);
     size_t tcountna = 0;
 
-    rowindex.strided_loop(ith, nrows, nth,
+    rowindex.strided_loop(chunk0, chunk1, 1,
       [&](int64_t i) {
         tcountna += data[i] >> (sizeof(T)*8 - 1);
       });
@@ -532,6 +1319,86 @@ void StringStats<T>::compute_countna(const Column* col) {
 }
 
 
+/**
+ * Ordered min/max for string columns, computed without sorting: each thread
+ * scans a contiguous chunk of rows keeping only the physical row of its best
+ * candidate, and the per-thread winners are merged under a critical section.
+ * Strings are compared in place via `compare_offstrings`, so no values are
+ * copied. NA rows are skipped; an all-NA (or empty) column yields NA for
+ * both stats.
+ */
+template <typename T>
+void StringStats<T>::compute_minmax(const Column* col) {
+  col->memory_advise(MmmAdvice::Sequential);
+  const StringColumn<T>* scol = static_cast<const StringColumn<T>*>(col);
+  const RowIndex& rowindex = col->rowindex();
+  int64_t nrows = scol->nrows;
+  const T* offsets = scol->offsets();
+  const uint8_t* strdata = scol->ustrdata();
+  int64_t minrow = -1;
+  int64_t maxrow = -1;
+
+  #pragma omp parallel
+  {
+    int ith = omp_get_thread_num();  // current thread index
+    int nth = omp_get_num_threads(); // total number of threads
+    int64_t chunksize = (nrows + nth - 1) / nth;
+    int64_t chunk0 = std::min(static_cast<int64_t>(ith) * chunksize, nrows);
+    int64_t chunk1 = std::min(chunk0 + chunksize, nrows);
+    int64_t tmin = -1;
+    int64_t tmax = -1;
+
+    rowindex.strided_loop(chunk0, chunk1, 1,
+      [&](int64_t i) {
+        T oend = offsets[i];
+        if (ISNA<T>(oend)) return;
+        T ostart = offsets[i - 1] & ~GETNA<T>();
+        // `compare_offstrings` returns +1 if the first string orders before
+        // the second one; ties keep the row seen first.
+        if (tmin < 0 ||
+            compare_offstrings(strdata, ostart, oend,
+                               offsets[tmin - 1] & ~GETNA<T>(),
+                               offsets[tmin]) > 0) tmin = i;
+        if (tmax < 0 ||
+            compare_offstrings(strdata, ostart, oend,
+                               offsets[tmax - 1] & ~GETNA<T>(),
+                               offsets[tmax]) < 0) tmax = i;
+      });
+
+    #pragma omp critical
+    {
+      if (tmin >= 0 && (minrow < 0 ||
+          compare_offstrings(strdata,
+                             offsets[tmin - 1] & ~GETNA<T>(), offsets[tmin],
+                             offsets[minrow - 1] & ~GETNA<T>(),
+                             offsets[minrow]) > 0)) minrow = tmin;
+      if (tmax >= 0 && (maxrow < 0 ||
+          compare_offstrings(strdata,
+                             offsets[tmax - 1] & ~GETNA<T>(), offsets[tmax],
+                             offsets[maxrow - 1] & ~GETNA<T>(),
+                             offsets[maxrow]) < 0)) maxrow = tmax;
+    }
+  }
+
+  if (minrow >= 0) {
+    // FIXME: same caveat as for `_mode`: these point into strdata().
+    T o0 = offsets[minrow - 1] & ~GETNA<T>();
+    _min.ch = scol->strdata() + o0;
+    _min.size = static_cast<int64_t>(offsets[minrow] - o0);
+    o0 = offsets[maxrow - 1] & ~GETNA<T>();
+    _max.ch = scol->strdata() + o0;
+    _max.size = static_cast<int64_t>(offsets[maxrow] - o0);
+  } else {
+    _min.ch = nullptr;
+    _min.size = -1;
+    _max.ch = nullptr;
+    _max.size = -1;
+  }
+  set_computed(Stat::Min);
+  set_computed(Stat::Max);
+}
+
+
 template <typename T>
 void StringStats<T>::compute_sorted_stats(const Column* col) {
   const StringColumn<T>* scol = static_cast<const StringColumn<T>*>(col);
@@ -578,6 +1445,66 @@ void StringStats<T>::compute_sorted_stats(const Column* col) {
 }
 
 
+/**
+ * NUnique estimate for string columns: the same systematic sampling and
+ * GEE scale-up as the numeric version (see NumericalStats), except that
+ * each sampled string is first reduced to a 64-bit FNV-1a hash. A hash
+ * collision can only shrink the estimate, which is acceptable in a
+ * planning hint, so the count is never promoted to an exact NUnique.
+ */
+template <typename T>
+void StringStats<T>::compute_nunique_estimate(const Column* col) {
+  constexpr int64_t SAMPLE_SIZE = 4096;
+  const StringColumn<T>* scol = static_cast<const StringColumn<T>*>(col);
+  const RowIndex& rowindex = col->rowindex();
+  int64_t nrows = col->nrows;
+  const T* offsets = scol->offsets();
+  const char* strdata = scol->strdata();
+
+  int64_t step = nrows / SAMPLE_SIZE;
+  if (step < 1) step = 1;
+  CountTable sample;
+  int64_t nsampled = 0;
+  rowindex.strided_loop(0, nrows, step,
+    [&](int64_t i) {
+      if (ISNA<int64_t>(i)) return;
+      nsampled++;
+      T oend = offsets[i];
+      if (ISNA<T>(oend)) return;
+      T ostart = offsets[i - 1] & ~GETNA<T>();
+      uint64_t h = 14695981039346656037ULL;
+      for (T k = ostart; k < oend; ++k) {
+        h = (h ^ static_cast<uint8_t>(strdata[k])) * 1099511628211ULL;
+      }
+      sample.add(h, 1, static_cast<size_t>(-1));
+    });
+
+  int64_t d = static_cast<int64_t>(sample.size());
+  int64_t f1 = 0;
+  sample.each([&](uint64_t, int64_t count) { f1 += (count == 1); });
+  double scale = std::sqrt(static_cast<double>(nrows) /
+                           static_cast<double>(std::max<int64_t>(nsampled, 1)));
+  int64_t est = d - f1 + static_cast<int64_t>(static_cast<double>(f1) * scale);
+  if (est > nrows) est = nrows;
+  if (est < d) est = d;
+  _nunique_est = est;
+}
+
+
+template <typename T>
+CString StringStats<T>::min(const Column* col) {
+  if (!is_computed(Stat::Min)) compute_minmax(col);
+  return _min;
+}
+
+
+template <typename T>
+CString StringStats<T>::max(const Column* col) {
+  if (!is_computed(Stat::Max)) compute_minmax(col);
+  return _max;
+}
+
+
 template <typename T>
 CString StringStats<T>::mode(const Column* col) {
   if (!is_computed(Stat::Mode)) compute_sorted_stats(col);
@@ -611,9 +1538,13 @@ void PyObjectStats::compute_countna(const Column* col) {
   {
     int ith = omp_get_thread_num();  // current thread index
     int nth = omp_get_num_threads(); // total number of threads
+    // Contiguous chunks per thread: see NumericalStats above.
+    int64_t chunksize = (nrows + nth - 1) / nth;
+    int64_t chunk0 = std::min(static_cast<int64_t>(ith) * chunksize, nrows);
+    int64_t chunk1 = std::min(chunk0 + chunksize, nrows);
     size_t tcountna = 0;
 
-    rowindex.strided_loop(ith, nrows, nth,
+    rowindex.strided_loop(chunk0, chunk1, 1,
       [&](int64_t i) {
         tcountna += (data[i] == Py_None);
       });
@@ -636,3 +1567,186 @@ void PyObjectStats::compute_sorted_stats(const Column*) {
 PyObjectStats* PyObjectStats::make() const {
   return new PyObjectStats();
 }
+
+
+
+//==============================================================================
+// Column::value_counts
+//==============================================================================
+
+/**
+ * Groupby-sort implementation of value counts: used for string columns, and
+ * as the fallback when the hash-count path bails out on cardinality. The
+ * value column of the result is a view of the source data (first row of
+ * each group), so no values are copied.
+ */
+static DataTable* value_counts_sorted(const Column* col, bool sort_by_count) {
+  Column* c = col->shallowcopy();
+  c->reify();
+  Column** tmpcols = dt::amalloc<Column*>(static_cast<int64_t>(2));
+  tmpcols[0] = c;
+  tmpcols[1] = nullptr;
+  DataTablePtr tmp(new DataTable(tmpcols, {"value"}));
+
+  arr32_t sortcols(1);
+  sortcols[0] = 0;
+  Groupby gb;
+  RowIndex ri = tmp->sortby(sortcols, &gb);
+  const int32_t* offsets = gb.offsets_r();
+  const arr32_t rows = ri.extract_as_array32();
+  int64_t ngroups = static_cast<int64_t>(gb.ngroups());
+
+  // Emit the groups in their final order up front: `DataTable::
+  // replace_rowindex` would *replace* the value column's view index rather
+  // than compose with it, so reordering the result frame after the fact is
+  // not an option.
+  arr32_t order(static_cast<size_t>(ngroups));
+  for (int64_t g = 0; g < ngroups; ++g) {
+    order[static_cast<size_t>(g)] = static_cast<int32_t>(g);
+  }
+  if (sort_by_count) {
+    // Decreasing count; groups are in value order already, so equal counts
+    // tie-break by value.
+    std::sort(order.data(), order.data() + ngroups,
+              [&](int32_t a, int32_t b) {
+                int64_t ca = offsets[a + 1] - offsets[a];
+                int64_t cb = offsets[b + 1] - offsets[b];
+                return ca > cb || (ca == cb && a < b);
+              });
+  }
+
+  arr32_t first_rows(static_cast<size_t>(ngroups));
+  Column* countcol = Column::new_data_column(SType::INT64, ngroups);
+  auto d_counts = static_cast<int64_t*>(countcol->data_w());
+  for (int64_t i = 0; i < ngroups; ++i) {
+    int32_t g = order[static_cast<size_t>(i)];
+    first_rows[static_cast<size_t>(i)] =
+        rows[static_cast<size_t>(offsets[g])];
+    d_counts[i] = offsets[g + 1] - offsets[g];
+  }
+
+  Column** outcols = dt::amalloc<Column*>(static_cast<int64_t>(3));
+  outcols[0] = c->shallowcopy(RowIndex::from_array32(std::move(first_rows),
+                                                     false));
+  outcols[1] = countcol;
+  outcols[2] = nullptr;
+  return new DataTable(outcols, {"value", "count"});
+}
+
+
+/**
+ * Hash-count implementation for fixed-width columns: one pass over the data
+ * with per-thread CountTables merged at the end, O(n) instead of the full
+ * sort. NA values are counted too, normalized to a single key (so that all
+ * float NaN payloads collapse into one row). Returns nullptr if the column
+ * turns out to have more than `LIMIT` distinct values, in which case the
+ * caller falls back to the sort path.
+ */
+template <typename T>
+static DataTable* value_counts_fixed(const Column* col, bool sort_by_count) {
+  constexpr size_t LIMIT = 1048576;
+  int64_t nrows = col->nrows;
+  const RowIndex& rowindex = col->rowindex();
+  const T* data = static_cast<const T*>(col->data());
+
+  // A single sequential pass over the column: hint the kernel to read ahead
+  col->memory_advise(MmmAdvice::Sequential);
+  CountTable total;
+  bool failed = false;
+
+  #pragma omp parallel
+  {
+    int ith = omp_get_thread_num();  // current thread index
+    int nth = omp_get_num_threads(); // total number of threads
+    // Contiguous chunks per thread: see NumericalStats above.
+    int64_t chunksize = (nrows + nth - 1) / nth;
+    int64_t chunk0 = std::min(static_cast<int64_t>(ith) * chunksize, nrows);
+    int64_t chunk1 = std::min(chunk0 + chunksize, nrows);
+    CountTable t_table;
+    bool t_ok = true;
+
+    rowindex.strided_loop(chunk0, chunk1, 1,
+      [&](int64_t i) {
+        if (!t_ok || ISNA<int64_t>(i)) return;
+        T x = data[i];
+        if (ISNA<T>(x)) x = GETNA<T>();
+        uint64_t bits = 0;
+        std::memcpy(&bits, &x, sizeof(T));
+        t_ok = t_table.add(bits, 1, LIMIT);
+      });
+
+    #pragma omp critical
+    {
+      if (!t_ok) failed = true;
+      if (!failed) failed = !total.merge(t_table, LIMIT);
+    }
+  }
+  if (failed) return nullptr;
+
+  std::vector<std::pair<T, int64_t>> pairs;
+  pairs.reserve(total.size());
+  total.each([&](uint64_t key, int64_t count) {
+    T v;
+    std::memcpy(&v, &key, sizeof(T));
+    pairs.push_back({v, count});
+  });
+
+  // Value order puts NA first, matching the groupby-sort path.
+  auto value_less = [](T a, T b) {
+    if (ISNA<T>(a)) return !ISNA<T>(b);
+    if (ISNA<T>(b)) return false;
+    return a < b;
+  };
+  if (sort_by_count) {
+    std::sort(pairs.begin(), pairs.end(),
+              [&](const std::pair<T, int64_t>& a,
+                  const std::pair<T, int64_t>& b) {
+                return a.second > b.second ||
+                       (a.second == b.second &&
+                        value_less(a.first, b.first));
+              });
+  } else {
+    std::sort(pairs.begin(), pairs.end(),
+              [&](const std::pair<T, int64_t>& a,
+                  const std::pair<T, int64_t>& b) {
+                return value_less(a.first, b.first);
+              });
+  }
+
+  int64_t n = static_cast<int64_t>(pairs.size());
+  Column* valcol = Column::new_data_column(col->stype(), n);
+  Column* countcol = Column::new_data_column(SType::INT64, n);
+  auto d_vals = static_cast<T*>(valcol->data_w());
+  auto d_counts = static_cast<int64_t*>(countcol->data_w());
+  for (int64_t i = 0; i < n; ++i) {
+    d_vals[i] = pairs[static_cast<size_t>(i)].first;
+    d_counts[i] = pairs[static_cast<size_t>(i)].second;
+  }
+
+  Column** outcols = dt::amalloc<Column*>(static_cast<int64_t>(3));
+  outcols[0] = valcol;
+  outcols[1] = countcol;
+  outcols[2] = nullptr;
+  return new DataTable(outcols, {"value", "count"});
+}
+
+
+DataTable* Column::value_counts(bool sort_by_count) const {
+  DataTable* res = nullptr;
+  switch (stype()) {
+    case SType::BOOL:
+    case SType::INT8:    res = value_counts_fixed<int8_t>(this, sort_by_count); break;
+    case SType::INT16:   res = value_counts_fixed<int16_t>(this, sort_by_count); break;
+    case SType::INT32:   res = value_counts_fixed<int32_t>(this, sort_by_count); break;
+    case SType::INT64:   res = value_counts_fixed<int64_t>(this, sort_by_count); break;
+    case SType::FLOAT32: res = value_counts_fixed<float>(this, sort_by_count); break;
+    case SType::FLOAT64: res = value_counts_fixed<double>(this, sort_by_count); break;
+    case SType::STR32:
+    case SType::STR64:   break;
+    default:
+      throw NotImplError() << "value_counts() is not supported for a column "
+          "of type `" << info(stype()).name() << "`";
+  }
+  if (!res) res = value_counts_sorted(this, sort_by_count);
+  return res;
+}
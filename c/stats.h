@@ -75,6 +75,7 @@ class Stats {
     int64_t _countna;
     int64_t _nunique;
     int64_t _nmodal;
+    int64_t _nunique_est = -1;  // cached estimate; -1 = not computed yet
 
   public:
     Stats() = default;
@@ -86,10 +87,28 @@ class Stats {
     int64_t nunique(const Column*);
     int64_t nmodal(const Column*);
 
+    /**
+     * Cheap estimate of the NUnique stat, suitable for planning decisions
+     * (choosing a join algorithm, bailing out of hash-based paths, etc).
+     * If the exact value is already known it is returned; otherwise the
+     * cardinality is estimated from a small sample of the column's values
+     * and cached, without ever scanning the full column.
+     */
+    int64_t nunique_estimate(const Column*);
+
     bool is_computed(Stat s) const;
     void reset();
     void set_countna(int64_t n);
-    virtual void merge_stats(const Stats*);
+
+    /**
+     * Update these stats to describe the column after the rows of `other`
+     * (which must have the same stype, or be a VoidColumn denoting an
+     * all-NA run) were appended to it. `this_nrows` is the number of rows
+     * the column had before the append. Statistics that are mergeable and
+     * already computed here are updated from stats computed over the
+     * appended chunk alone; everything else is invalidated.
+     */
+    virtual void merge_stats(const Column* other, int64_t this_nrows);
 
     virtual size_t memory_footprint() const = 0;
     virtual void verify_integrity(const Column*) const;
@@ -101,6 +120,15 @@ class Stats {
 
     virtual void compute_countna(const Column*) = 0;
     virtual void compute_sorted_stats(const Column*) = 0;
+    // Computes the NUnique stat; the default implementation simply sorts
+    // the column, but subclasses may provide a cheaper path.
+    virtual void compute_nunique_stats(const Column*);
+    // Computes the Mode/NModal stats; the default implementation simply
+    // sorts the column, but subclasses may provide a cheaper path.
+    virtual void compute_mode_stats(const Column*);
+    // Computes the cached NUnique estimate; the default implementation
+    // falls back to the exact computation, but subclasses may sample.
+    virtual void compute_nunique_estimate(const Column*);
     void set_computed(Stat s);
     void set_computed(Stat s, bool flag);
 };
@@ -128,6 +156,9 @@ class NumericalStats : public Stats {
     double _sd;
     double _skew;
     double _kurt;
+    double _qt25;
+    double _median;
+    double _qt75;
     A _sum;
     T _min;
     T _max;
@@ -141,6 +172,9 @@ class NumericalStats : public Stats {
     double stdev(const Column*);
     double skew(const Column*);
     double kurt(const Column*);
+    double qt25(const Column*);
+    double median(const Column*);
+    double qt75(const Column*);
     T min(const Column*);
     T max(const Column*);
     T mode(const Column*);
@@ -148,6 +182,13 @@ class NumericalStats : public Stats {
 
     void set_min(T value);
     void set_max(T value);
+    void set_sum(A value);
+    void set_mean(double value);
+    void set_sd(double value);
+    void set_skew(double value);
+    void set_kurt(double value);
+
+    void merge_stats(const Column* other, int64_t this_nrows) override;
 
     // void verify_integrity(const Column*) const override;
 
@@ -156,6 +197,15 @@ class NumericalStats : public Stats {
 
     // Helper method that computes min, max, sum, mean, sd, and countna
     virtual void compute_numerical_stats(const Column*);
+    // Computes approximate Qt25/Median/Qt75 from a t-digest sketch
+    void compute_approx_quantiles(const Column*);
+    // NUnique via an exact hash set / HyperLogLog estimator (see .cc)
+    void compute_nunique_stats(const Column*) override;
+    // Mode/NModal via parallel hash counting for low-cardinality columns
+    void compute_mode_stats(const Column*) override;
+    bool compute_hashed_mode(const Column*);
+    // NUnique estimate from a systematic sample of the values
+    void compute_nunique_estimate(const Column*) override;
     virtual void compute_sorted_stats(const Column*) override;
     virtual void compute_countna(const Column*) override;
 };
@@ -238,16 +288,24 @@ template <typename T>
 class StringStats : public Stats {
   private:
     CString _mode;
+    CString _min;
+    CString _max;
 
   public:
     virtual size_t memory_footprint() const override { return sizeof(*this); }
 
+    CString min(const Column*);
+    CString max(const Column*);
     CString mode(const Column*);
 
   protected:
     StringStats<T>* make() const override;
     void compute_countna(const Column*) override;
+    // Ordered min/max without sorting: a single parallel comparison pass
+    void compute_minmax(const Column*);
     void compute_sorted_stats(const Column*) override;
+    // NUnique estimate from hashes of a systematic sample of the strings
+    void compute_nunique_estimate(const Column*) override;
 };
 
 extern template class StringStats<uint32_t>;
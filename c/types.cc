@@ -108,9 +108,9 @@ void init_types(void)
   STI(SType::STR32,   "i4s", "s4", 4, 1, LType::STRING,   nullptr);
   STI(SType::STR64,   "i8s", "s8", 8, 1, LType::STRING,   nullptr);
   STI(SType::FSTR,    "c#s", "sx", 0, 0, LType::STRING,   nullptr);
-  STI(SType::CAT8,    "u1e", "e1", 1, 1, LType::STRING,   &NA_U1);
-  STI(SType::CAT16,   "u2e", "e2", 2, 1, LType::STRING,   &NA_U2);
-  STI(SType::CAT32,   "u4e", "e4", 4, 1, LType::STRING,   &NA_U4);
+  STI(SType::CAT8,    "u1e", "e1", 1, 1, LType::STRING,   &NA_I1);
+  STI(SType::CAT16,   "u2e", "e2", 2, 1, LType::STRING,   &NA_I2);
+  STI(SType::CAT32,   "u4e", "e4", 4, 1, LType::STRING,   &NA_I4);
   STI(SType::DATE64,  "i8d", "t8", 8, 0, LType::DATETIME, &NA_I8);
   STI(SType::TIME32,  "i4t", "T4", 4, 0, LType::DATETIME, &NA_I4);
   STI(SType::DATE32,  "i4d", "t4", 4, 0, LType::DATETIME, &NA_I4);
@@ -209,34 +209,30 @@ constexpr size_t DT_LTYPES_COUNT = static_cast<size_t>(LType::OBJECT) + 1;
  *     bytes, which is not a valid UTF-8 string.
  *
  * SType::CAT8
- *     elem: uint8_t (1 byte)
- *     NA:   255
+ *     elem: int8_t (1 byte)
+ *     NA:   -2**7
  *     String column stored as a categorical variable (aka "factor" or "enum").
- *     This type is suitable for columns with low cardinality, i.e. having no
- *     more than 255 distinct string values.
- *     The data is stored in a buffer with 3 regions: first comes the string
- *     data, padded to a multiple of 8 bytes; then comes the array of int32
- *     offsets within the data buffer, these offsets describe the boundaries of
- *     individual strings within the data section (this array is also padded
- *     to a multiple of 8 bytes); finally comes the array of categorical
- *     indices. Meta information contains offsets of the second and the third
- *     sections. The layout of the first 2 sections is exactly the same as
- *     that of the SType::STR32 type.
+ *     Reserved for columns with no more than 127 distinct string values; not
+ *     implemented yet (see SType::CAT32 for the implemented layout).
  *
  * SType::CAT16
- *     elem: uint16_t (2 bytes)
- *     NA:   65535
- *     Strings stored as a categorical variable with no more than 65535 distinct
- *     levels. The layout is exactly the same as that of CAT8, only
- *     the last section uses 2 bytes per element instead of just 1 byte.
+ *     elem: int16_t (2 bytes)
+ *     NA:   -2**15
+ *     Strings stored as a categorical variable with no more than 32767
+ *     distinct levels; reserved, not implemented yet.
  *
  * SType::CAT32
- *     elem: uint32_t (4 bytes)
- *     NA:   2**32-1
- *     Strings stored as a categorical variable with no more than 2**32-1
- *     distinct levels. (The combined size of all categorical strings may not
- *     exceed 2**32 too). The layout is same as that of CAT8, only
- *     the last section uses 4 bytes per element instead of just 1 byte.
+ *     elem: int32_t (4 bytes)
+ *     NA:   -2**31
+ *     Strings stored as a categorical variable (see CategoricalColumn in
+ *     "column.h"). The main data buffer holds int32 codes using the same NA
+ *     sentinel as SType::INT32; in addition the column carries a dictionary
+ *     of distinct values ("levels") in two shared buffers laid out exactly
+ *     like an SType::STR32 column without NAs. The levels are stored in
+ *     ascending string order, so comparing two codes is equivalent to
+ *     comparing the strings they stand for: sorting, grouping and filtering
+ *     all operate on the codes directly. The combined size of the level
+ *     strings may not exceed 2**31 - 1 bytes.
  *
  *
  * -----------------------------------------------------------------------------
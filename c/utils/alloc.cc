@@ -6,20 +6,123 @@
 // © H2O.ai 2018
 //------------------------------------------------------------------------------
 #include "utils/alloc.h"
+#include <atomic>
 #include <cerrno>              // errno
 #include <cstdlib>             // std::realloc, std::free
+#include <mutex>
+#include "utils.h"             // malloc_size
 #include "utils/exceptions.h"  // MemoryError
 #include "mmm.h"               // MemoryMapManager
 
 namespace dt
 {
 
+//------------------------------------------------------------------------------
+// Allocation tracing
+//------------------------------------------------------------------------------
+
+namespace alloctrace {
+
+bool enabled = false;
+
+static std::atomic<size_t> current_bytes { 0 };
+static std::atomic<size_t> peak_bytes { 0 };
+static std::atomic<size_t> total_allocs { 0 };
+static std::atomic<size_t> total_bytes { 0 };
+static std::atomic<size_t> histogram[NBUCKETS];
+
+// Per-tag stats are merged under a mutex: tagged allocations are rare
+// compared to the hot untraced path, and tracing itself is opt-in.
+static std::mutex tags_mutex;
+static std::map<std::string, TagStats> tags;
+
+static thread_local const char* current_tag = nullptr;
+
+
+Tag::Tag(const char* name) : saved(current_tag) {
+  current_tag = name;
+}
+
+Tag::~Tag() {
+  current_tag = saved;
+}
+
+
+static size_t size_bucket(size_t n) {
+  size_t b = 0;
+  while ((n >> b) > 1 && b < NBUCKETS - 1) b++;
+  return b;
+}
+
+
+// Record an allocation (or growth) of `delta` bytes; `delta` may be
+// negative when a realloc shrinks the buffer.
+static void record_alloc(int64_t delta, size_t requested) {
+  size_t cur;
+  if (delta >= 0) {
+    cur = current_bytes.fetch_add(static_cast<size_t>(delta)) +
+          static_cast<size_t>(delta);
+  } else {
+    size_t dec = static_cast<size_t>(-delta);
+    size_t prev = current_bytes.fetch_sub(dec);
+    cur = (prev >= dec)? prev - dec : 0;
+  }
+  size_t peak = peak_bytes.load();
+  while (cur > peak && !peak_bytes.compare_exchange_weak(peak, cur)) {}
+  if (delta <= 0) return;
+  total_allocs.fetch_add(1);
+  total_bytes.fetch_add(requested);
+  histogram[size_bucket(requested)].fetch_add(1);
+  const char* tag = current_tag? current_tag : "(untagged)";
+  std::lock_guard<std::mutex> lock(tags_mutex);
+  TagStats& ts = tags[tag];
+  ts.nallocs++;
+  ts.bytes += requested;
+}
+
+
+static void record_free(size_t released) {
+  current_bytes.fetch_sub(std::min(released, current_bytes.load()));
+}
+
+
+Snapshot snapshot() {
+  Snapshot res;
+  res.current_bytes = current_bytes.load();
+  res.peak_bytes = peak_bytes.load();
+  res.total_allocs = total_allocs.load();
+  res.total_bytes = total_bytes.load();
+  for (size_t i = 0; i < NBUCKETS; ++i) {
+    res.histogram[i] = histogram[i].load();
+  }
+  std::lock_guard<std::mutex> lock(tags_mutex);
+  res.by_tag = tags;
+  return res;
+}
+
+
+void reset() {
+  current_bytes.store(0);
+  peak_bytes.store(0);
+  total_allocs.store(0);
+  total_bytes.store(0);
+  for (size_t i = 0; i < NBUCKETS; ++i) histogram[i].store(0);
+  std::lock_guard<std::mutex> lock(tags_mutex);
+  tags.clear();
+}
+
+}  // namespace alloctrace
+
 
 void* _realloc(void* ptr, size_t n) {
   if (!n) {
-    std::free(ptr);
+    dt::free(ptr);
     return nullptr;
   }
+  size_t oldsize = 0;
+  if (alloctrace::enabled && ptr) {
+    oldsize = malloc_size(ptr);
+  }
   int attempts = 3;
   while (true) {
     // The documentation for `void* realloc(void* ptr, size_t new_size);` says
@@ -33,6 +136,11 @@ void* _realloc(void* ptr, size_t n) {
     // | C11 DR 400.
     void* newptr = std::realloc(ptr, n);
     if (newptr) {
+      if (alloctrace::enabled) {
+        alloctrace::record_alloc(
+            static_cast<int64_t>(malloc_size(newptr)) -
+            static_cast<int64_t>(oldsize), n);
+      }
       return newptr;
     }
     if (errno == 12 && attempts--) {
@@ -50,6 +158,9 @@ void* _realloc(void* ptr, size_t n) {
 
 
 void free(void* ptr) {
+  if (alloctrace::enabled && ptr) {
+    alloctrace::record_free(malloc_size(ptr));
+  }
   std::free(ptr);
 }
 
@@ -7,7 +7,10 @@
 //------------------------------------------------------------------------------
 #ifndef dt_UTILS_ALLLOC_h
 #define dt_UTILS_ALLLOC_h
+#include <cstdint>
 #include <cstdlib>
+#include <map>
+#include <string>
 
 namespace dt
 {
@@ -15,6 +18,55 @@ void free(void*);
 void* _realloc(void*, size_t);
 
 
+//------------------------------------------------------------------------------
+// Allocation tracing
+//------------------------------------------------------------------------------
+
+namespace alloctrace {
+
+  // Toggled via `options.memory.alloc_trace`; off by default, in which
+  // case the allocator pays a single branch per call.
+  extern bool enabled;
+
+  // Log2 size classes: bucket `i` counts allocations of
+  // 2^i <= size < 2^(i+1) bytes.
+  constexpr size_t NBUCKETS = 48;
+
+  struct TagStats {
+    size_t nallocs = 0;       // allocation / growth events
+    size_t bytes = 0;         // cumulative bytes requested
+  };
+
+  struct Snapshot {
+    size_t current_bytes;     // bytes currently held through dt::malloc
+    size_t peak_bytes;        // high-water mark of `current_bytes`
+    size_t total_allocs;
+    size_t total_bytes;
+    size_t histogram[NBUCKETS];
+    std::map<std::string, TagStats> by_tag;
+  };
+
+  // Tag all allocations made by the current thread (and the current
+  // scope) with the name of the operation responsible for them, so that
+  // transient spikes can be attributed to a kernel. Used by
+  // `perf::OpTimer`, hence every instrumented operation is tagged
+  // automatically; untagged allocations are accounted under "(untagged)".
+  class Tag {
+    public:
+      explicit Tag(const char* name);
+      ~Tag();
+      Tag(const Tag&) = delete;
+      Tag& operator=(const Tag&) = delete;
+    private:
+      const char* saved;
+  };
+
+  Snapshot snapshot();
+  void reset();
+
+}  // namespace alloctrace
+
+
 
 template <typename T> inline T* malloc(size_t n) {
   return static_cast<T*>(_realloc(nullptr, n));
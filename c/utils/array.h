@@ -51,6 +51,9 @@ template <typename T> class array
     bool owned;
     int64_t : 56;
 
+    // Allow `cast<S>()` to poke at the privates of a different instantiation
+    template <typename> friend class array;
+
   public:
     array(size_t len = 0) : x(nullptr), n(0), owned(true) { resize(len); }
     array(size_t len, const T* ptr)
@@ -0,0 +1,75 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include "utils/interrupts.h"
+#include <Python.h>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include "utils/exceptions.h"
+
+namespace dt {
+
+// The abort flag is process-wide: nested cancellable operations are not a
+// thing (parallel kernels never start other parallel kernels), so a single
+// token suffices and kernels don't have to thread a context object through
+// every call signature.
+static std::atomic<bool> abort_requested(false);
+static std::exception_ptr pending_exception;
+static std::mutex pending_mutex;
+
+
+bool interrupt_requested() {
+  return abort_requested.load(std::memory_order_relaxed);
+}
+
+
+void poll_interrupts() noexcept {
+  if (abort_requested.load(std::memory_order_relaxed)) return;
+  // `PyGILState_Ensure` is safe both when the caller holds the GIL and when
+  // it was released via `PyEval_SaveThread()` (see class GILReleased).
+  PyGILState_STATE gstate = PyGILState_Ensure();
+  if (PyErr_CheckSignals() != 0) {
+    // A signal handler raised (normally KeyboardInterrupt). Capture it as a
+    // PyError so that the eventual rethrow carries the original Python
+    // exception and OmpExceptionManager::is_keyboard_interrupt() keeps
+    // working.
+    try {
+      throw PyError();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(pending_mutex);
+      pending_exception = std::current_exception();
+    }
+    abort_requested.store(true, std::memory_order_relaxed);
+  }
+  PyGILState_Release(gstate);
+}
+
+
+void throw_if_interrupted() {
+  if (!abort_requested.load(std::memory_order_relaxed)) return;
+  std::exception_ptr eptr;
+  {
+    std::lock_guard<std::mutex> lock(pending_mutex);
+    eptr = pending_exception;
+    pending_exception = nullptr;
+  }
+  abort_requested.store(false, std::memory_order_relaxed);
+  if (eptr) std::rethrow_exception(eptr);
+  // The flag can be raised without a captured exception only through
+  // programmer error; still, don't swallow the abort.
+  throw RuntimeError() << "Operation was interrupted";
+}
+
+
+void clear_interrupt() noexcept {
+  abort_requested.store(false, std::memory_order_relaxed);
+  std::lock_guard<std::mutex> lock(pending_mutex);
+  pending_exception = nullptr;
+}
+
+}  // namespace dt
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_UTILS_INTERRUPTS_H
+#define dt_UTILS_INTERRUPTS_H
+
+
+namespace dt {
+
+/**
+ * Cooperative cancellation token for long-running parallel kernels.
+ *
+ * Python delivers Ctrl+C as a pending signal that is only noticed when
+ * someone calls `PyErr_CheckSignals()`; a multi-hour sort or filter that
+ * never does so is simply unkillable. The protocol here keeps the check
+ * off the hot path by polling once per *chunk*, not per row:
+ *
+ *   - The master thread (thread 0 of a parallel region, or any serial
+ *     code between phases) calls `poll_interrupts()`. This briefly takes
+ *     the GIL, runs the pending-signal check, and if a KeyboardInterrupt
+ *     (or any other signal-handler exception) fired, captures it and
+ *     raises the shared abort flag. It never throws.
+ *
+ *   - Worker threads call `interrupt_requested()` -- a single relaxed
+ *     atomic load -- and stop claiming chunks when it returns true.
+ *
+ *   - After the parallel phase, the serial caller invokes
+ *     `throw_if_interrupted()`, which rethrows the captured Python
+ *     exception (so `PyError::is_keyboard_interrupt()` works as usual)
+ *     once all per-call buffers have been cleaned up.
+ *
+ * `clear_interrupt()` resets a stale flag at the start of a cancellable
+ * operation, so that an interrupt which arrived between operations does
+ * not abort the next one spuriously.
+ */
+bool interrupt_requested();
+void poll_interrupts() noexcept;
+void throw_if_interrupted();
+void clear_interrupt() noexcept;
+
+}  // namespace dt
+
+#endif
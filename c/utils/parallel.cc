@@ -0,0 +1,316 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include "utils/parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "options.h"
+#include "utils/omp.h"
+
+
+namespace dt {
+
+
+class ThreadPool {
+  private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable cv_work;
+    std::condition_variable cv_done;
+    const std::function<void(int, int)>* job;
+    std::exception_ptr error;
+    size_t generation;
+    int nworking;
+    int nth;
+    bool started;
+    bool shutdown;
+    std::atomic<bool> running;  // detects re-entry from within a pool job
+
+  public:
+    static ThreadPool& get() {
+      static ThreadPool pool;
+      return pool;
+    }
+
+    bool busy() const {
+      return running;
+    }
+
+    void run(const std::function<void(int, int)>& f) {
+      if (!started) start();
+      // The job's team size is a grant out of the global thread budget:
+      // when part of the budget is already claimed by an enclosing kernel,
+      // only the first `gnth` pool threads do any work; the rest wake up,
+      // see an out-of-range index and go straight back to sleep.
+      config::thread_grant grant(nth);
+      int gnth = grant.nthreads();
+      if (nth == 1 || gnth == 1) {
+        f(0, 1);
+        return;
+      }
+      std::function<void(int, int)> clipped;
+      const std::function<void(int, int)>* todo = &f;
+      if (gnth < nth) {
+        clipped = [&f, gnth](int ith, int) {
+          if (ith < gnth) f(ith, gnth);
+        };
+        todo = &clipped;
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = todo;
+        error = nullptr;
+        generation++;
+        nworking = nth - 1;
+        running = true;
+      }
+      cv_work.notify_all();
+
+      // The calling thread participates as thread 0. Its exception, if
+      // any, must not propagate before the workers are done with `f`.
+      std::exception_ptr master_error;
+      try {
+        (*todo)(0, nth);
+      } catch (...) {
+        master_error = std::current_exception();
+      }
+
+      std::unique_lock<std::mutex> lock(mutex);
+      cv_done.wait(lock, [&]{ return nworking == 0; });
+      job = nullptr;
+      running = false;
+      if (master_error) std::rethrow_exception(master_error);
+      if (error) {
+        std::exception_ptr e = error;
+        error = nullptr;
+        std::rethrow_exception(e);
+      }
+    }
+
+  private:
+    ThreadPool()
+      : job(nullptr), generation(0), nworking(0), nth(1),
+        started(false), shutdown(false), running(false) {}
+
+    ~ThreadPool() {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        shutdown = true;
+      }
+      cv_work.notify_all();
+      for (std::thread& t : workers) t.join();
+    }
+
+    void start() {
+      nth = omp_get_max_threads();
+      if (nth < 1) nth = 1;
+      for (int i = 1; i < nth; ++i) {
+        workers.emplace_back(&ThreadPool::worker_main, this, i);
+      }
+      started = true;
+    }
+
+    void worker_main(int ith) {
+      size_t seen = 0;
+      while (true) {
+        const std::function<void(int, int)>* myjob = nullptr;
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          cv_work.wait(lock, [&]{ return shutdown || generation != seen; });
+          if (shutdown) return;
+          seen = generation;
+          myjob = job;
+        }
+        std::exception_ptr e;
+        try {
+          (*myjob)(ith, nth);
+        } catch (...) {
+          e = std::current_exception();
+        }
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          if (e && !error) error = e;
+          nworking--;
+        }
+        cv_done.notify_one();
+      }
+    }
+};
+
+
+void run_parallel(const std::function<void(int, int)>& f) {
+  ThreadPool& pool = ThreadPool::get();
+  bool nested = pool.busy();
+  #ifndef DTNOOPENMP
+    nested = nested || omp_in_parallel();
+  #endif
+  if (nested) {
+    f(0, 1);
+    return;
+  }
+  pool.run(f);
+}
+
+
+//------------------------------------------------------------------------------
+// Background task executor
+//------------------------------------------------------------------------------
+
+class BackgroundQueue {
+  private:
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable cv_work;
+    std::condition_variable cv_done;
+    std::deque<std::pair<const void*, std::function<void()>>> tasks;
+    const void* running_token;
+    bool started;
+    bool shutdown;
+
+  public:
+    static BackgroundQueue& get() {
+      static BackgroundQueue q;
+      return q;
+    }
+
+    void submit(const void* token, std::function<void()>&& task) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!started) {
+          worker = std::thread(&BackgroundQueue::worker_main, this);
+          started = true;
+        }
+        tasks.emplace_back(token, std::move(task));
+      }
+      cv_work.notify_one();
+    }
+
+    bool steal(const void* token) {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (auto it = tasks.begin(); it != tasks.end(); ++it) {
+        if (it->first == token) {
+          tasks.erase(it);
+          return true;
+        }
+      }
+      return false;
+    }
+
+    void wait(const void* token) {
+      // A task waiting for its own token (e.g. a reify accessing the very
+      // column it materializes) must not deadlock on itself.
+      if (std::this_thread::get_id() == worker.get_id()) return;
+      std::unique_lock<std::mutex> lock(mutex);
+      cv_done.wait(lock, [&]{
+        if (running_token == token) return false;
+        for (const auto& t : tasks) {
+          if (t.first == token) return false;
+        }
+        return true;
+      });
+    }
+
+  private:
+    BackgroundQueue()
+      : running_token(nullptr), started(false), shutdown(false) {}
+
+    ~BackgroundQueue() {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        shutdown = true;
+      }
+      cv_work.notify_one();
+      if (started) worker.join();
+    }
+
+    void worker_main() {
+      while (true) {
+        std::function<void()> task;
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          cv_work.wait(lock, [&]{ return shutdown || !tasks.empty(); });
+          if (shutdown) return;
+          running_token = tasks.front().first;
+          task = std::move(tasks.front().second);
+          tasks.pop_front();
+        }
+        try {
+          task();
+        } catch (...) {}
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          running_token = nullptr;
+        }
+        cv_done.notify_all();
+      }
+    }
+};
+
+
+void parallel_for_static(int64_t n, int64_t chunksize, const rangefn& f) {
+  if (n <= 0) return;
+  if (chunksize < 1) chunksize = 1;
+  if (n <= chunksize) {
+    f(0, n, 0);
+    return;
+  }
+  int64_t nchunks = (n + chunksize - 1) / chunksize;
+  run_parallel(
+    [&](int ith, int nth) {
+      // The partition is a pure function of (ith, nth), so as long as the
+      // team size is stable, each pool thread walks the same rows in every
+      // kernel invoked over the same range.
+      int64_t c0 = nchunks * ith / nth;
+      int64_t c1 = nchunks * (ith + 1) / nth;
+      for (int64_t ci = c0; ci < c1; ++ci) {
+        int64_t i0 = ci * chunksize;
+        f(i0, std::min(i0 + chunksize, n), ith);
+      }
+    });
+}
+
+
+void bg_submit(const void* token, std::function<void()> task) {
+  BackgroundQueue::get().submit(token, std::move(task));
+}
+
+bool bg_steal(const void* token) {
+  return BackgroundQueue::get().steal(token);
+}
+
+void bg_wait(const void* token) {
+  BackgroundQueue::get().wait(token);
+}
+
+
+void parallel_for(int64_t n, int64_t chunksize, const rangefn& f) {
+  if (n <= 0) return;
+  if (chunksize < 1) chunksize = 1;
+  if (n <= chunksize) {
+    f(0, n, 0);
+    return;
+  }
+  int64_t nchunks = (n + chunksize - 1) / chunksize;
+  std::atomic<int64_t> cursor(0);
+  run_parallel(
+    [&](int ith, int) {
+      int64_t ci;
+      while ((ci = cursor.fetch_add(1, std::memory_order_relaxed)) < nchunks) {
+        int64_t i0 = ci * chunksize;
+        f(i0, std::min(i0 + chunksize, n), ith);
+      }
+    });
+}
+
+
+}  // namespace dt
@@ -0,0 +1,96 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_UTILS_PARALLEL_H
+#define dt_UTILS_PARALLEL_H
+#include <cstdint>
+#include <functional>
+
+
+namespace dt {
+
+/**
+ * Persistent thread pool, shared by all parallel kernels.
+ *
+ * An OpenMP `parallel` region re-assembles its team on every entry, which
+ * costs tens of microseconds -- negligible for a long scan, but a real tax
+ * on a workload of thousands of small operations per second. The pool
+ * below creates its threads once, on first use, and puts them to sleep on
+ * a condition variable between jobs, so a small parallel operation pays
+ * only a notify/wait handshake.
+ *
+ * `run_parallel(f)` executes `f(ith, nth)` once on every pool thread, with
+ * the calling thread participating as thread 0 -- the same shape as an
+ * `#pragma omp parallel` region, so kernels migrate by moving their region
+ * body into the lambda. Work distribution stays with the kernel: the usual
+ * pattern is a shared atomic chunk cursor, which gives dynamic scheduling
+ * (idle threads steal chunks that busy ones have not claimed). Exceptions
+ * thrown by `f` are captured and the first one is rethrown on the calling
+ * thread, although kernels should prefer OmpExceptionManager so that the
+ * remaining threads can wind down early.
+ *
+ * When called from inside another parallel region (OpenMP or the pool
+ * itself), or when only one thread is configured, `f(0, 1)` runs serially
+ * in place -- nested parallelism is never spawned, mirroring OpenMP's
+ * default behavior.
+ */
+void run_parallel(const std::function<void(int ith, int nth)>& f);
+
+
+/**
+ * Convenience wrapper over `run_parallel`: invoke `f(i0, i1, ith)` for
+ * consecutive chunks `[i0, i1)` of the range `[0, n)`, at most `chunksize`
+ * long, claimed dynamically by the pool threads. Runs serially when the
+ * range fits into a single chunk.
+ */
+using rangefn = std::function<void(int64_t i0, int64_t i1, int ith)>;
+void parallel_for(int64_t n, int64_t chunksize, const rangefn& f);
+
+
+/**
+ * Variant of `parallel_for` with static scheduling: the range is split into
+ * `nth` contiguous blocks and thread `ith` always receives block `ith`,
+ * delivered to `f` in chunksize-long pieces. Because the pool threads are
+ * persistent, the row-range -> thread assignment is identical across
+ * consecutive kernels over the same `n`, so the cache lines a thread pulled
+ * in while computing `a + b` are still in its core's L2 when `> 0` runs
+ * next. Use this for kernels with uniform per-row cost; when the cost is
+ * skewed (e.g. data-dependent group sizes), the dynamic chunk-stealing of
+ * `parallel_for` load-balances better and should be preferred.
+ */
+void parallel_for_static(int64_t n, int64_t chunksize, const rangefn& f);
+
+
+/**
+ * Background task executor: a single lazily-started worker thread that
+ * runs submitted tasks one at a time, in submission order, while the
+ * main thread goes on to do something else (typically: return to the
+ * Python interpreter).
+ *
+ * Each task is identified by an opaque `token` (normally the address of
+ * the object the task operates on), through which the submitter can
+ * later synchronize with it:
+ *
+ *   - `bg_steal(token)` removes the task if it has not started yet, and
+ *     tells the caller (by returning true) that the work is now theirs
+ *     to do -- or not do -- synchronously.
+ *   - `bg_wait(token)` blocks until the task is neither queued nor
+ *     running. The usual protocol is steal-else-wait, so that a consumer
+ *     arriving early does not sit behind unrelated queued tasks.
+ *
+ * Tasks must not touch the Python runtime (the worker never holds the
+ * GIL) and must not throw; escaped exceptions are swallowed. The
+ * submitter is responsible for keeping the operands alive until the
+ * task has been stolen or waited for.
+ */
+void bg_submit(const void* token, std::function<void()> task);
+bool bg_steal(const void* token);
+void bg_wait(const void* token);
+
+}  // namespace dt
+
+#endif
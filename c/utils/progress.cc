@@ -0,0 +1,98 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#include "utils/progress.h"
+#include <atomic>
+#include <chrono>
+
+namespace dt {
+namespace progress {
+
+using clock = std::chrono::steady_clock;
+
+// Minimum interval between two callback invocations. At a 100ms cadence
+// even a microseconds-cheap Python callback stays far below 0.1% of the
+// kernel's runtime.
+static constexpr std::chrono::milliseconds REPORT_INTERVAL(100);
+
+static PyObject* callback = nullptr;
+
+// State of the currently active (outermost) job. `work` objects are only
+// created from master serial code, so a plain depth counter suffices;
+// only the unit counter is touched concurrently.
+static int depth = 0;
+static const char* job_name = nullptr;
+static int64_t units_total = 0;
+static std::atomic<int64_t> units_done(0);
+static clock::time_point last_report;
+static bool reported = false;
+
+
+void set_callback(PyObject* fn) {
+  Py_XDECREF(callback);
+  callback = fn;
+}
+
+
+static void emit(double fraction) noexcept {
+  // Safe whether the caller holds the GIL or released it (GILReleased).
+  PyGILState_STATE gstate = PyGILState_Ensure();
+  PyObject* res = PyObject_CallFunction(callback, "sd", job_name, fraction);
+  if (res) {
+    Py_DECREF(res);
+  } else {
+    // A broken progress handler must not take the operation down with it.
+    PyErr_Clear();
+  }
+  PyGILState_Release(gstate);
+}
+
+
+work::work(const char* name, int64_t nunits) {
+  active = (depth++ == 0) && callback && nunits > 0;
+  if (active) {
+    job_name = name;
+    units_total = nunits;
+    units_done.store(0, std::memory_order_relaxed);
+    last_report = clock::now();
+    reported = false;
+  }
+}
+
+
+work::~work() {
+  depth--;
+  if (active) {
+    // Close out the bar, but only if it was ever drawn: sub-100ms jobs
+    // should leave no trace at all.
+    if (reported) emit(1.0);
+    job_name = nullptr;
+    units_total = 0;
+  }
+}
+
+
+void add_done(int64_t units) {
+  units_done.fetch_add(units, std::memory_order_relaxed);
+}
+
+
+void update() noexcept {
+  if (!units_total) return;
+  clock::time_point now = clock::now();
+  if (now - last_report < REPORT_INTERVAL) return;
+  last_report = now;
+  double fraction = static_cast<double>(units_done.load(std::memory_order_relaxed))
+                    / static_cast<double>(units_total);
+  if (fraction > 1.0) fraction = 1.0;
+  emit(fraction);
+  reported = true;
+}
+
+
+}  // namespace progress
+}  // namespace dt
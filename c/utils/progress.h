@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifndef dt_UTILS_PROGRESS_H
+#define dt_UTILS_PROGRESS_H
+#include <Python.h>
+#include <cstdint>
+
+
+namespace dt {
+namespace progress {
+
+/**
+ * Uniform progress reporting for long-running kernels.
+ *
+ * fread has always had its own progress plumbing, but sort, groupby and
+ * CSV writing were silent for however long they took. The interface here
+ * lets any chunked kernel report progress with near-zero cost:
+ *
+ *   - A kernel wraps its run in a `work` object, declaring a short
+ *     operation name ("sort", "to_csv", ...) and the total number of
+ *     work units (typically rows).
+ *
+ *   - Threads call `add_done(units)` as chunks complete -- one relaxed
+ *     atomic add per chunk -- and the master thread calls `update()` at
+ *     the same cadence. `update()` is rate-limited to one callback
+ *     invocation per 100ms, so the instrumentation cost is well under
+ *     0.1% regardless of chunk size.
+ *
+ *   - The callback is a Python callable `fn(name, fraction)` registered
+ *     via `core.register_function(9, fn)`; when none is registered the
+ *     whole machinery reduces to a single branch. Exceptions raised by
+ *     the callback are swallowed: progress display must never abort the
+ *     operation it describes.
+ *
+ * Only the outermost `work` in a thread reports; nested kernels (a sort
+ * inside a groupby, say) contribute to no bar of their own, which keeps
+ * call sites free of "am I top-level?" bookkeeping.
+ */
+class work {
+  public:
+    work(const char* name, int64_t nunits);
+    ~work();
+    work(const work&) = delete;
+    work& operator=(const work&) = delete;
+  private:
+    bool active;
+    int64_t : 56;
+};
+
+// Register the Python callback `fn(name, fraction)`; pass nullptr to
+// disable reporting. Steals a reference to `fn`.
+void set_callback(PyObject* fn);
+
+// Record `units` completed work units (thread-safe, any thread).
+void add_done(int64_t units);
+
+// Invoke the callback if at least 100ms have passed since the last
+// invocation. Master thread only; no-op when no `work` is active.
+void update() noexcept;
+
+}  // namespace progress
+}  // namespace dt
+#endif
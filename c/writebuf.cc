@@ -8,8 +8,9 @@
 #include "writebuf.h"
 #include <cstring>     // std::memcpy
 #include <errno.h>     // errno
-#include <sys/mman.h>  // mmap
-#include <unistd.h>    // write
+#include <fcntl.h>     // O_CREAT, O_RDWR
+#include <sys/mman.h>  // mmap, shm_open, shm_unlink
+#include <unistd.h>    // write, close, ftruncate
 #include "memrange.h"
 #include "utils/alloc.h"   // dt::realloc
 #include "utils/assert.h"
@@ -71,6 +72,20 @@ FileWritableBuffer::FileWritableBuffer(const std::string& path) {
   file = new File(path, File::OVERWRITE);
 }
 
+
+FileWritableBuffer::FileWritableBuffer(const std::string& path,
+                                       size_t append_at) {
+  file = new File(path, File::READWRITE);
+  file->resize(append_at);
+  off_t pos = ::lseek(file->descriptor(), static_cast<off_t>(append_at),
+                      SEEK_SET);
+  if (pos == -1) {
+    throw RuntimeError() << "Cannot seek to position " << append_at
+                         << " in file " << path << ": " << Errno;
+  }
+  bytes_written = append_at;
+}
+
 FileWritableBuffer::~FileWritableBuffer() {
   delete file;
 }
@@ -212,6 +227,85 @@ std::string MemoryWritableBuffer::get_string() {
 
 
 
+//==============================================================================
+// ShmemWritableBuffer
+//==============================================================================
+
+ShmemWritableBuffer::ShmemWritableBuffer(const std::string& name, size_t size)
+  : ThreadsafeWritableBuffer(), shmname(name)
+{
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0666);
+  if (fd == -1) {
+    throw RuntimeError() << "Cannot create shared memory object `" << name
+        << "`" << Errno;
+  }
+  if (size) {
+    if (ftruncate(fd, static_cast<off_t>(size)) == -1) {
+      ::close(fd);
+      shm_unlink(name.c_str());
+      throw RuntimeError() << "Cannot resize shared memory object `" << name
+          << "` to " << size << " bytes" << Errno;
+    }
+    map(fd, size);
+  }
+  ::close(fd);
+}
+
+
+ShmemWritableBuffer::~ShmemWritableBuffer() {
+  unmap();
+}
+
+
+void ShmemWritableBuffer::map(int fd, size_t size) {
+  if (buffer) {
+    throw ValueError() << "buffer is not null";
+  }
+  if (size == 0) {
+    allocsize = 0;
+    return;
+  }
+  buffer = mmap(nullptr, size, PROT_WRITE|PROT_READ, MAP_SHARED, fd, 0);
+  if (buffer == MAP_FAILED) {
+    buffer = nullptr;
+    throw RuntimeError() << "Memory map failed for shared memory object "
+                         << shmname << " of size " << size << Errno;
+  }
+  allocsize = size;
+}
+
+
+void ShmemWritableBuffer::unmap() {
+  if (!buffer) return;
+  int ret = munmap(buffer, allocsize);
+  if (ret) {
+    printf("Error unmapping shared memory object %s (%p..+%zu): "
+           "[errno %d] %s",
+           shmname.c_str(), buffer, allocsize, errno, strerror(errno));
+  }
+  buffer = nullptr;
+}
+
+
+void ShmemWritableBuffer::realloc(size_t newsize)
+{
+  unmap();
+  int fd = shm_open(shmname.c_str(), O_RDWR, 0);
+  if (fd == -1) {
+    throw RuntimeError() << "Cannot reopen shared memory object `" << shmname
+        << "`" << Errno;
+  }
+  if (ftruncate(fd, static_cast<off_t>(newsize)) == -1) {
+    ::close(fd);
+    throw RuntimeError() << "Cannot resize shared memory object `" << shmname
+        << "` to " << newsize << " bytes" << Errno;
+  }
+  map(fd, newsize);
+  ::close(fd);
+}
+
+
+
 //==============================================================================
 // MmapWritableBuffer
 //==============================================================================
@@ -112,6 +112,13 @@ class FileWritableBuffer : public WritableBuffer
 
 public:
   FileWritableBuffer(const std::string& path);
+
+  /**
+   * Open an existing file for appending: the file is truncated to
+   * `append_at` bytes, and all subsequent writes continue from that
+   * position (`bytes_written` starts at `append_at`).
+   */
+  FileWritableBuffer(const std::string& path, size_t append_at);
   virtual ~FileWritableBuffer() override;
 
   virtual size_t prep_write(size_t n, const void* src) override;
@@ -166,6 +173,31 @@ private:
 
 
 
+//==============================================================================
+
+/**
+ * Writable buffer backed by a named POSIX shared memory object. The object
+ * is created anew (creation fails if the name is already in use), and after
+ * `finalize()` it remains in the system under its name, so that other
+ * processes may attach to it via `MemoryRange::shmem`. Removing the object
+ * is the caller's responsibility (`shm_unlink`).
+ */
+class ShmemWritableBuffer : public ThreadsafeWritableBuffer
+{
+  std::string shmname;
+
+public:
+  ShmemWritableBuffer(const std::string& name, size_t size);
+  ~ShmemWritableBuffer() override;
+
+private:
+  void realloc(size_t newsize) override;
+  void map(int fd, size_t size);
+  void unmap();
+};
+
+
+
 //==============================================================================
 
 class MmapWritableBuffer : public ThreadsafeWritableBuffer
@@ -8,6 +8,7 @@
 #ifndef dt_ZTEST_h
 #define dt_ZTEST_h
 #ifdef DTTEST
+#include <cstdint>
 #include <functional>
 #include <string>
 
@@ -21,6 +22,10 @@ void cover_init_FrameInitializationManager_em();
 void cover_names_FrameNameProviders();
 void cover_names_integrity_checks();
 
+// Randomized stress-test of the parallel kernels (see ztest_fuzz.cc);
+// exposed to python as `core.fuzz_parallel_kernels()` in DTTEST builds.
+void fuzz_parallel_kernels(int64_t seed, int64_t niters);
+
 
 }  // namespace dttest
 
@@ -0,0 +1,230 @@
+//------------------------------------------------------------------------------
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// © H2O.ai 2018
+//------------------------------------------------------------------------------
+#ifdef DTTEST
+#include "ztest.h"
+#include <random>
+#include "column.h"
+#include "datatable.h"
+#include "groupby.h"
+#include "python/list.h"
+#include "python/string.h"
+#include "rowindex.h"
+#include "types.h"
+#include "utils/alloc.h"
+#include "utils/array.h"
+#include "utils/exceptions.h"
+#include "utils/omp.h"
+
+namespace dttest {
+
+using rng_t = std::mt19937_64;
+
+
+/**
+ * Throw a ValueError carrying enough context to replay the failing
+ * iteration: the fuzzer is fully deterministic given (seed, iteration,
+ * thread count), so a single line from the error message is a complete
+ * reproducer.
+ */
+static void fcheck(bool cond, int64_t seed, int64_t iter, const char* what) {
+  if (cond) return;
+  throw ValueError() << "Fuzz invariant violated: " << what
+      << " (seed=" << seed << ", iteration=" << iter
+      << ", nthreads=" << omp_get_max_threads() << ")";
+}
+
+
+static int64_t randint(rng_t& rng, int64_t lo, int64_t hi) {
+  return lo + static_cast<int64_t>(rng() % static_cast<uint64_t>(hi - lo + 1));
+}
+
+
+template <typename T>
+static Column* make_fw_column(rng_t& rng, SType st, int64_t nrows) {
+  Column* col = Column::new_data_column(st, nrows);
+  T* data = static_cast<T*>(col->data_w());
+  // A small value range creates plenty of duplicates, exercising the
+  // grouping logic; 1-in-16 NAs exercise the NA-first ordering.
+  for (int64_t i = 0; i < nrows; ++i) {
+    uint64_t r = rng();
+    data[i] = (r % 16 == 0)? GETNA<T>() : static_cast<T>(r % 1000);
+  }
+  return col;
+}
+
+
+static Column* make_bool_column(rng_t& rng, int64_t nrows) {
+  Column* col = Column::new_data_column(SType::BOOL, nrows);
+  int8_t* data = static_cast<int8_t*>(col->data_w());
+  for (int64_t i = 0; i < nrows; ++i) {
+    uint64_t r = rng();
+    data[i] = (r % 16 == 0)? GETNA<int8_t>() : static_cast<int8_t>(r % 2);
+  }
+  return col;
+}
+
+
+static Column* make_str_column(rng_t& rng, int64_t nrows) {
+  static const char* words[] = {"", "a", "be", "cat", "dodo", "emu",
+                                "ferret", "gnu", "heron", "ibis"};
+  py::olist list(nrows);
+  for (int64_t i = 0; i < nrows; ++i) {
+    uint64_t r = rng();
+    if (r % 16 == 0) {
+      list.set(i, py::None());
+    } else {
+      list.set(i, py::ostring(words[r % 10]));
+    }
+  }
+  return Column::from_pylist(list);
+}
+
+
+static DataTable* make_random_frame(rng_t& rng, int64_t nrows, int64_t ncols) {
+  Column** cols = dt::amalloc<Column*>(ncols + 1);
+  for (int64_t i = 0; i < ncols; ++i) {
+    switch (rng() % 6) {
+      case 0:  cols[i] = make_bool_column(rng, nrows); break;
+      case 1:  cols[i] = make_fw_column<int8_t>(rng, SType::INT8, nrows); break;
+      case 2:  cols[i] = make_fw_column<int32_t>(rng, SType::INT32, nrows); break;
+      case 3:  cols[i] = make_fw_column<int64_t>(rng, SType::INT64, nrows); break;
+      case 4:  cols[i] = make_fw_column<double>(rng, SType::FLOAT64, nrows); break;
+      default: cols[i] = make_str_column(rng, nrows); break;
+    }
+  }
+  cols[ncols] = nullptr;
+  return new DataTable(cols, nullptr);
+}
+
+
+/**
+ * Sort `dt` by `sortcols` twice, at two different thread counts, and check
+ * that both the resulting row order and the group boundaries are identical:
+ * any divergence means the parallel sort has a scheduling-dependent (i.e.
+ * racy) merge step.
+ */
+static void fuzz_sort(DataTable* dt, const arr32_t& sortcols, bool with_groups,
+                      int maxth, rng_t& rng, int64_t seed, int64_t iter) {
+  int th1 = static_cast<int>(randint(rng, 1, maxth));
+  int th2 = static_cast<int>(randint(rng, 1, maxth));
+  Groupby gb1, gb2;
+  omp_set_num_threads(th1);
+  dt->invalidate_sort_cache();  // force an actual re-sort, not a cache hit
+  RowIndex ri1 = dt->sortby(sortcols, with_groups? &gb1 : nullptr);
+  omp_set_num_threads(th2);
+  dt->invalidate_sort_cache();
+  RowIndex ri2 = dt->sortby(sortcols, with_groups? &gb2 : nullptr);
+
+  fcheck(ri1.length() == dt->nrows, seed, iter,
+         "sort rowindex length != nrows");
+  fcheck(ri1.length() == ri2.length(), seed, iter,
+         "sort rowindex lengths differ across thread counts");
+  fcheck(ri1.min() >= 0 && ri1.max() < dt->nrows, seed, iter,
+         "sort rowindex contains out-of-range indices");
+  for (int64_t i = 0; i < ri1.length(); ++i) {
+    fcheck(ri1.nth(i) == ri2.nth(i), seed, iter,
+           "sort order differs across thread counts");
+  }
+  if (with_groups) {
+    fcheck(gb1.ngroups() == gb2.ngroups(), seed, iter,
+           "group count differs across thread counts");
+    const int32_t* off1 = gb1.offsets_r();
+    const int32_t* off2 = gb2.offsets_r();
+    size_t ng = gb1.ngroups();
+    fcheck(off1[0] == 0 && off1[ng] == dt->nrows, seed, iter,
+           "group offsets do not span [0, nrows]");
+    for (size_t g = 0; g <= ng; ++g) {
+      fcheck(off1[g] == off2[g], seed, iter,
+             "group offsets differ across thread counts");
+      if (g) {
+        fcheck(off1[g] > off1[g - 1], seed, iter,
+               "group offsets are not strictly increasing");
+      }
+    }
+  }
+
+  // Materialize the sorted order and re-verify all column invariants:
+  // this runs the parallel gather kernels in reify().
+  dt->replace_rowindex(ri1);
+  dt->reify();
+  dt->verify_integrity();
+}
+
+
+/**
+ * Apply a random slice rowindex and materialize it.
+ */
+static void fuzz_slice(DataTable* dt, rng_t& rng, int64_t seed, int64_t iter) {
+  int64_t nrows = dt->nrows;
+  int64_t step = randint(rng, -2, 2);
+  int64_t start = randint(rng, 0, nrows - 1);
+  int64_t maxcount = step > 0? (nrows - start - 1) / step + 1 :
+                     step < 0? start / (-step) + 1 : nrows;
+  int64_t count = randint(rng, 0, maxcount);
+  dt->replace_rowindex(RowIndex::from_slice(start, count, step));
+  fcheck(dt->nrows == count, seed, iter,
+         "slice rowindex produced wrong nrows");
+  dt->verify_integrity();
+  dt->reify();
+  fcheck(dt->nrows == count, seed, iter, "reify() changed nrows");
+  dt->verify_integrity();
+}
+
+
+/**
+ * Run `niters` iterations of randomized stress-testing of the parallel
+ * kernels (multi-threaded sort, grouping, and rowindex materialization):
+ * each iteration builds a random frame, applies a random operation at
+ * randomly chosen thread counts, and checks both the structural invariants
+ * (via `verify_integrity()`) and that the results are independent of the
+ * number of threads. Deterministic for a given seed.
+ */
+void fuzz_parallel_kernels(int64_t seed, int64_t niters) {
+  rng_t rng(static_cast<uint64_t>(seed));
+  int maxth = omp_get_max_threads();
+  try {
+    for (int64_t iter = 0; iter < niters; ++iter) {
+      int64_t nrows = randint(rng, 1, 3000);
+      int64_t ncols = randint(rng, 1, 4);
+      DataTable* dt = make_random_frame(rng, nrows, ncols);
+      dt->verify_integrity();
+      switch (rng() % 3) {
+        case 0: {
+          arr32_t sortcols(1);
+          sortcols[0] = static_cast<int32_t>(randint(rng, 0, ncols - 1));
+          fuzz_sort(dt, sortcols, /* with_groups = */ true,
+                    maxth, rng, seed, iter);
+          break;
+        }
+        case 1: {
+          size_t nsort = static_cast<size_t>(randint(rng, 1, ncols));
+          arr32_t sortcols(nsort);
+          for (size_t k = 0; k < nsort; ++k) {
+            sortcols[k] = static_cast<int32_t>(randint(rng, 0, ncols - 1));
+          }
+          fuzz_sort(dt, sortcols, /* with_groups = */ false,
+                    maxth, rng, seed, iter);
+          break;
+        }
+        default: {
+          fuzz_slice(dt, rng, seed, iter);
+          break;
+        }
+      }
+      delete dt;
+    }
+  } catch (...) {
+    omp_set_num_threads(maxth);
+    throw;
+  }
+  omp_set_num_threads(maxth);
+}
+
+
+}  // namespace dttest
+#endif
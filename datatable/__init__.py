@@ -6,13 +6,21 @@
 #-------------------------------------------------------------------------------
 
 from .__version__ import version as __version__
-from .dt_append import rbind, cbind
+from .dt_append import rbind, cbind, merge_sorted
 from .frame import Frame
-from .expr import mean, min, max, sd, isna, sum, count, first
+from .expr import mean, min, max, sd, ifelse, isna, sum, count, first, last
+from .expr import cumsum, cummin, cummax, cumprod
+from .expr import shift
+from .expr import fillna
+from .expr import str_upper, str_lower, str_strip, str_slice
+from .expr import abs, exp, log, log10, sqrt
+from .expr import round, floor, ceil, clip, bucketize
 from .fread import fread, GenericReader, FreadWarning
 from .graph import f, g, join
-from .nff import save, open
+from .nff import save, open, open_buffer, attach, shmem_unlink
 from .options import options
+from .partitioned import PartitionedFrame
+from .progress import register_progress_handler, clear_progress_handlers
 from .types import stype, ltype
 from .utils.typechecks import TTypeError as TypeError
 from .utils.typechecks import TValueError as ValueError
@@ -24,14 +32,20 @@ except:
 
 
 __all__ = ("__version__", "__git_revision__",
-           "Frame", "max", "mean", "min", "open", "sd", "sum", "count", "first",
-           "isna", "fread", "GenericReader", "save", "stype", "ltype", "f", "g",
+           "Frame", "max", "mean", "min", "open", "open_buffer", "attach",
+           "shmem_unlink", "sd", "sum", "count", "first", "last",
+           "cumsum", "cummin", "cummax", "cumprod", "shift", "fillna",
+           "ifelse", "isna", "str_upper", "str_lower", "str_strip", "str_slice",
+           "abs", "exp", "log", "log10", "sqrt",
+           "round", "floor", "ceil", "clip", "bucketize",
+           "fread", "GenericReader", "save", "stype", "ltype", "f", "g",
            "join",
            "TypeError", "ValueError", "DatatableWarning", "FreadWarning",
-           "DataTable", "options",
+           "DataTable", "options", "PartitionedFrame",
+           "register_progress_handler", "clear_progress_handlers",
            "bool8", "int8", "int16", "int32", "int64",
            "float32", "float64", "str32", "str64", "obj64",
-           "cbind", "rbind")
+           "cbind", "rbind", "merge_sorted")
 
 bool8 = stype.bool8
 int8 = stype.int8
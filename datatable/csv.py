@@ -7,13 +7,15 @@
 import os
 from datatable.lib import core
 from datatable.utils.terminal import term
+from datatable.utils.typechecks import TValueError
 _log_color = term.bright_black
 
 __all__ = ("write_csv", "CsvWriter")
 
 
 
-def write_csv(dt, path="", nthreads=0, hex=False, verbose=False, **kwargs):
+def write_csv(dt, path="", nthreads=0, hex=False, verbose=False, append=False,
+              **kwargs):
     """
     Write the Frame into the provided file in CSV format.
 
@@ -26,6 +28,9 @@ def write_csv(dt, path="", nthreads=0, hex=False, verbose=False, **kwargs):
         Path to the output CSV file that will be created. If the file already
         exists, it will be overwritten. If path is not given, then the Frame
         will be serialized into a string, and that string will be returned.
+        If the path ends with ".gz", the file will be written in the gzip
+        format: each chunk of the output is compressed (in parallel) into its
+        own gzip member.
 
     nthreads: int
         How many threads to use for writing. The value of 0 means to use all
@@ -41,10 +46,18 @@ def write_csv(dt, path="", nthreads=0, hex=False, verbose=False, **kwargs):
     verbose: bool
         If True, some extra information will be printed to the console, which
         may help to debug the inner workings of the algorithm.
+
+    append: bool
+        If True, append the rows of the Frame to an already existing CSV file
+        at `path`, without writing the header row again. When the file does
+        not exist yet, this is the same as a normal write.
     """
     if path.startswith("~"):
         path = os.path.expanduser(path)
-    writer = CsvWriter(dt, path, nthreads, hex, verbose, **kwargs)
+    if append and not path:
+        raise TValueError("Parameter `append` requires a file path")
+    append = append and os.path.exists(path)
+    writer = CsvWriter(dt, path, nthreads, hex, verbose, append, **kwargs)
     return writer.write()
 
 
@@ -52,13 +65,15 @@ def write_csv(dt, path="", nthreads=0, hex=False, verbose=False, **kwargs):
 class CsvWriter(object):
 
     def __init__(self, datatable, path, nthreads=None, hex=False, verbose=False,
-                 _strategy="auto"):
+                 append=False, _strategy="auto"):
         self.datatable = datatable.internal
         self.column_names = datatable.names
         self.nthreads = nthreads
         self.path = path
+        self.compress = path.endswith(".gz")
         self.hex = hex
         self.verbose = verbose
+        self.append = append
         self._strategy = _strategy
         self._log_newline = False
 
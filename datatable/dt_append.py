@@ -5,8 +5,9 @@
 #   file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #-------------------------------------------------------------------------------
 import datatable as dt
+from datatable.lib import core
 from datatable.utils.misc import plural_form as plural
-from datatable.utils.typechecks import typed, Frame_t, TValueError
+from datatable.utils.typechecks import typed, Frame_t, TValueError, TTypeError
 
 def rbind(*frames, force=False, bynames=True):
     return _rbind(dt.Frame(), *frames, force=force, bynames=bynames)
@@ -15,6 +16,49 @@ def cbind(*frames, force=False):
     return _cbind(dt.Frame(), *frames, force=force)
 
 
+def merge_sorted(by, *frames):
+    """
+    Merge Frames pre-sorted by the column `by` into a single sorted Frame.
+
+    All `frames` must have the same column names, and each must already be
+    sorted by column `by` (in the same order as `.sort()` produces: NA
+    values first, then ascending) -- an unsorted input raises a ValueError.
+    The result is the same as `dt.rbind(*frames).sort(by)`, but is computed
+    with a single k-way merge pass over the data instead of a full re-sort,
+    which is much faster when the inputs are large. The merge is stable:
+    rows with equal keys keep the order in which their frames were given.
+
+    Parameters
+    ----------
+    by: str or int
+        Name or index of the column by which every input Frame is sorted.
+
+    frames: one or more Frames
+        The Frames to merge. Columns of mismatched types are promoted to
+        the larger type, same as in `rbind()`.
+    """
+    if not frames:
+        raise TValueError("At least one Frame is required")
+    names = frames[0].names
+    for frame in frames:
+        if not isinstance(frame, dt.Frame):
+            raise TTypeError("merge_sorted() expects a sequence of Frames, "
+                             "got %r" % type(frame))
+        if frame.names != names:
+            raise TValueError("Cannot merge frames with different column "
+                              "names")
+    if isinstance(by, int):
+        keycol = by
+    else:
+        if by not in names:
+            raise TValueError("Column `%s` does not exist in the frames "
+                              "being merged" % by)
+        keycol = names.index(by)
+    res = core.merge_sorted(keycol, [frame.internal for frame in frames])
+    res.names = names
+    return res
+
+
 @typed(frames=Frame_t, force=bool, bynames=bool)
 def _rbind(self, *frames, force=False, bynames=True):
     """
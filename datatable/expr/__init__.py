@@ -10,14 +10,21 @@ from .base_expr import BaseExpr
 from .binary_expr import BinaryOpExpr
 from .cast_expr import CastExpr
 from .column_expr import ColSelectorExpr, NewColumnExpr
+from .fillna_expr import FillNaExpr, fillna
+from .ifelse_expr import IfElseExpr, ifelse
 from .isna_expr import isna
 from .literal_expr import LiteralExpr
 from .mean_expr import MeanReducer, mean
 from .minmax_expr import MinMaxReducer, min, max
-from .reduce_expr import ReduceExpr, sum, count, first
+from .reduce_expr import (ReduceExpr, CumulativeExpr, sum, count, first,
+                          last, cumsum, cummin, cummax, cumprod)
 from .relop_expr import RelationalOpExpr
 from .sd_expr import StdevReducer, sd
-from .unary_expr import UnaryOpExpr
+from .shift_expr import ShiftExpr, shift
+from .str_expr import StringOpExpr, str_upper, str_lower, str_strip, str_slice
+from .unary_expr import (UnaryOpExpr, ClipExpr, BucketizeExpr, abs, exp,
+                         log, log10, sqrt, round, floor, ceil, clip,
+                         bucketize)
 
 __all__ = (
     "max",
@@ -26,8 +33,32 @@ __all__ = (
     "sd",
     "sum",
     "count",
+    "cumsum",
+    "cummin",
+    "cummax",
+    "cumprod",
     "first",
+    "last",
+    "ifelse",
+    "fillna",
     "isna",
+    "shift",
+    "abs",
+    "IfElseExpr",
+    "FillNaExpr",
+    "exp",
+    "log",
+    "log10",
+    "sqrt",
+    "round",
+    "floor",
+    "ceil",
+    "clip",
+    "bucketize",
+    "str_upper",
+    "str_lower",
+    "str_strip",
+    "str_slice",
     "BinaryOpExpr",
     "CastExpr",
     "ColSelectorExpr",
@@ -40,5 +71,10 @@ __all__ = (
     "ReduceExpr",
     "RelationalOpExpr",
     "StdevReducer",
+    "StringOpExpr",
     "UnaryOpExpr",
+    "ClipExpr",
+    "BucketizeExpr",
+    "CumulativeExpr",
+    "ShiftExpr",
 )
@@ -10,6 +10,7 @@ from .literal_expr import LiteralExpr
 from .consts import ops_rules, division_ops
 from datatable.utils.typechecks import TTypeError, TValueError
 from datatable.lib import core
+from datatable.types import stype
 
 
 class BinaryOpExpr(BaseExpr):
@@ -81,6 +82,18 @@ class BinaryOpExpr(BaseExpr):
     #---------------------------------------------------------------------------
 
     def evaluate_eager(self, ee):
+        # When this node is the root of a tree of fusable binary ops, flatten
+        # the whole tree into a postfix program and evaluate it in a single
+        # pass: this avoids materializing a full-size column for every
+        # intermediate node.
+        if self._is_fusable():
+            program = []
+            columns = []
+            self._fused_flatten(ee, program, columns)
+            if len(columns) > 2:
+                nrows = max(col.nrows for col in columns)
+                if all(col.nrows in (1, nrows) for col in columns):
+                    return core.expr_fused_binaryop(program, columns)
         lhs = self._lhs.evaluate_eager(ee)
         rhs = self._rhs.evaluate_eager(ee)
         nl = lhs.nrows
@@ -93,6 +106,22 @@ class BinaryOpExpr(BaseExpr):
                               "of sizes %d and %d" % (self._op, nl, nr))
 
 
+    def _is_fusable(self):
+        return (self._op in fusable_binary_ops and
+                self._lhs.stype in fusable_stypes and
+                self._rhs.stype in fusable_stypes)
+
+
+    def _fused_flatten(self, ee, program, columns):
+        for child in (self._lhs, self._rhs):
+            if isinstance(child, BinaryOpExpr) and child._is_fusable():
+                child._fused_flatten(ee, program, columns)
+            else:
+                program.append(len(columns))
+                columns.append(child.evaluate_eager(ee))
+        program.append(-binary_op_codes[self._op])
+
+
 #-------------------------------------------------------------------------------
 # Should be in sync with enum in "expr/binaryop.cc"
 binary_op_codes = {
@@ -100,3 +129,11 @@ binary_op_codes = {
     "&": 8, "|": 9, "<<": 10, ">>": 11,
     "==": 12, "!=": 13, ">": 14, "<": 15, ">=": 16, "<=": 17
 }
+
+# Ops and operand stypes which the fused single-pass evaluator
+# (core.expr_fused_binaryop) can handle; everything else is evaluated
+# node-at-a-time.
+fusable_binary_ops = {"+", "-", "*", "/", "//", "%", "&", "|",
+                      "==", "!=", ">", "<", ">=", "<="}
+fusable_stypes = {stype.bool8, stype.int8, stype.int16, stype.int32,
+                  stype.int64, stype.float32, stype.float64}
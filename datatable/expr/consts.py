@@ -106,6 +106,16 @@ for st in stypes_ladder:
     ops_rules[("min", st)] = st
     ops_rules[("max", st)] = st
     ops_rules[("first", st)] = st
+    ops_rules[("last", st)] = st
+    ops_rules[("nunique", st)] = stype.int64
+    if st in (stype.float32, stype.float64):
+        ops_rules[("cumsum", st)] = stype.float64
+        ops_rules[("cumprod", st)] = stype.float64
+    else:
+        ops_rules[("cumsum", st)] = stype.int64
+        ops_rules[("cumprod", st)] = stype.int64
+    ops_rules[("cummin", st)] = st
+    ops_rules[("cummax", st)] = st
 
 ops_rules[("+", stype.bool8, stype.bool8)] = stype.int8
 ops_rules[("-", stype.bool8, stype.bool8)] = stype.int8
@@ -117,10 +127,20 @@ ops_rules[("//", stype.bool8, stype.bool8)] = None
 ops_rules[("%", stype.bool8, stype.bool8)] = None
 ops_rules[("first", stype.str32)] = stype.str32
 ops_rules[("first", stype.str64)] = stype.str64
+ops_rules[("last", stype.str32)] = stype.str32
+ops_rules[("last", stype.str64)] = stype.str64
+ops_rules[("min", stype.str32)] = stype.str32
+ops_rules[("min", stype.str64)] = stype.str64
+ops_rules[("max", stype.str32)] = stype.str32
+ops_rules[("max", stype.str64)] = stype.str64
 ops_rules[("sum", stype.float32)] = stype.float64
 ops_rules[("sum", stype.float64)] = stype.float64
 ops_rules[("count", stype.str32)] = stype.int64
 ops_rules[("count", stype.str64)] = stype.int64
+ops_rules[("nunique", stype.str32)] = stype.int64
+ops_rules[("nunique", stype.str64)] = stype.int64
+ops_rules[("concat", stype.str32)] = stype.str32
+ops_rules[("concat", stype.str64)] = stype.str64
 
 division_ops = {"//", "/", "%"}
 
@@ -132,6 +152,26 @@ for st in stype_bool | stype_int:
 for st in stype_int | stype_float:
     unary_ops_rules[("-", st)] = st
     unary_ops_rules[("+", st)] = st
+    unary_ops_rules[("abs", st)] = st
+
+for st in stype_bool | stype_int:
+    unary_ops_rules[("exp", st)] = stype.float64
+    unary_ops_rules[("log", st)] = stype.float64
+    unary_ops_rules[("log10", st)] = stype.float64
+    unary_ops_rules[("sqrt", st)] = stype.float64
+
+for st in stype_float:
+    unary_ops_rules[("exp", st)] = st
+    unary_ops_rules[("log", st)] = st
+    unary_ops_rules[("log10", st)] = st
+    unary_ops_rules[("sqrt", st)] = st
+
+# Rounding an integer (or boolean) column is an identity transform, but it
+# is still allowed so that e.g. `floor(f.A)` works uniformly.
+for st in stype_bool | stype_int | stype_float:
+    unary_ops_rules[("round", st)] = st
+    unary_ops_rules[("floor", st)] = st
+    unary_ops_rules[("ceil", st)] = st
 
 # Synchronize with OpCode in c/expr/unaryop.cc
 unary_op_codes = {
@@ -140,10 +180,26 @@ unary_op_codes = {
     "+": 3,
     "~": 4,
     "!": 4,  # same as '~'
+    "abs": 5,
+    "exp": 6,
+    "log": 7,
+    "log10": 8,
+    "sqrt": 9,
+    "round": 10,
+    "floor": 11,
+    "ceil": 12,
 }
 
 
 # Synchronize with reduceop.cc
+# Synchronize with CumOpCode in expr/reduceop.cc
+cumulative_opcodes = {
+    "cumsum": 1,
+    "cummin": 2,
+    "cummax": 3,
+    "cumprod": 4,
+}
+
 reduce_opcodes = {
     "mean": 1,
     "min": 2,
@@ -152,4 +208,7 @@ reduce_opcodes = {
     "first": 5,
     "sum": 6,
     "count": 7,
+    "nunique": 8,
+    "concat": 9,
+    "last": 10,
 }
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+
+from .base_expr import BaseExpr
+from .cast_expr import CastExpr
+from .literal_expr import LiteralExpr
+from .consts import ops_rules
+from ..types import stype
+from datatable.utils.typechecks import TTypeError, TValueError
+from datatable.lib import core
+
+__all__ = ("fillna", )
+
+
+class FillNaExpr(BaseExpr):
+    """
+    NA imputation of an expression: either every NA is replaced with a
+    constant value (a single fused pass over the data), or with the
+    nearest preceding / following non-NA value (a virtual view, no data
+    copied). In a grouped select the forward/backward fill never crosses
+    group boundaries.
+    """
+    __slots__ = ["_arg", "_value", "_backward"]
+
+    def __init__(self, arg, value, backward):
+        super().__init__()
+        self._arg = arg
+        if value is not None and not isinstance(value, BaseExpr):
+            value = LiteralExpr(value)
+        self._value = value
+        self._backward = backward
+
+    def is_reduce_expr(self, ee):
+        return False
+
+    def resolve(self):
+        self._arg.resolve()
+        if self._value is None:
+            self._stype = self._arg.stype
+            return
+        self._value.resolve()
+        sta = self._arg.stype
+        stv = self._value.stype
+        if sta == stv:
+            self._stype = sta
+        else:
+            # Same numeric promotion as arithmetic binary ops
+            self._stype = ops_rules.get(("+", sta, stv))
+            if self._stype is None:
+                raise TTypeError("fillna() value of type %s is incompatible "
+                                 "with a column of type %s" % (stv, sta))
+
+    def evaluate_eager(self, ee):
+        if self._value is None:
+            col = self._arg.evaluate_eager(ee)
+            return core.expr_fillna_dir(col, self._backward, ee.groupby)
+        arg = self._arg
+        value = self._value
+        if arg.stype != self._stype:
+            arg = CastExpr(arg, self._stype)
+        if value.stype != self._stype or isinstance(value, LiteralExpr):
+            # A literal is always cast explicitly: the stype inferred for a
+            # python value at resolve time may differ from the stype of the
+            # single-element column it evaluates to (e.g. `0` resolves as
+            # int8 but evaluates as bool8).
+            value = CastExpr(value, self._stype)
+        return core.expr_fillna_const(arg.evaluate_eager(ee),
+                                      value.evaluate_eager(ee))
+
+    def __str__(self):
+        if self._value is None:
+            return "fillna(%s, method=%s)" % (
+                self._arg, "backward" if self._backward else "forward")
+        return "fillna(%s, %s)" % (self._arg, self._value)
+
+
+def fillna(x, value=None, method=None):
+    """
+    Replace NA values in the expression `x`: either with the constant
+    `value`, or — when `method` is "forward" or "backward" — with the
+    nearest preceding (resp. following) non-NA value. Exactly one of
+    `value` and `method` must be given. In a grouped select the
+    forward/backward fill restarts at every group boundary.
+    """
+    if (value is None) == (method is None):
+        raise TValueError("Exactly one of `value` and `method` must be "
+                          "given in fillna()")
+    if method is not None and method not in ("forward", "backward"):
+        raise TValueError("fillna() method must be 'forward' or 'backward', "
+                          "got %r" % (method, ))
+    return FillNaExpr(x, value, method == "backward")
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+
+from .base_expr import BaseExpr
+from .cast_expr import CastExpr
+from .literal_expr import LiteralExpr
+from .consts import ops_rules
+from ..types import stype
+from datatable.utils.typechecks import TTypeError
+from datatable.lib import core
+
+__all__ = ("ifelse", )
+
+
+class IfElseExpr(BaseExpr):
+    __slots__ = ["_cond", "_a", "_b"]
+
+    def __init__(self, cond, a, b):
+        super().__init__()
+        if not isinstance(cond, BaseExpr):
+            cond = LiteralExpr(cond)
+        if not isinstance(a, BaseExpr):
+            a = LiteralExpr(a)
+        if not isinstance(b, BaseExpr):
+            b = LiteralExpr(b)
+        self._cond = cond
+        self._a = a
+        self._b = b
+
+    def resolve(self):
+        self._cond.resolve()
+        self._a.resolve()
+        self._b.resolve()
+        if self._cond.stype != stype.bool8:
+            raise TTypeError("The condition in ifelse() must be a boolean "
+                             "expression, got %s" % self._cond.stype)
+        sta = self._a.stype
+        stb = self._b.stype
+        strtypes = (stype.str32, stype.str64)
+        if sta == stb:
+            self._stype = sta
+        elif sta in strtypes and stb in strtypes:
+            self._stype = stype.str64
+        else:
+            # Same numeric promotion as arithmetic binary ops
+            self._stype = ops_rules.get(("+", sta, stb))
+            if self._stype is None:
+                raise TTypeError("The branches of ifelse() have incompatible "
+                                 "types %s and %s" % (sta, stb))
+
+    def is_reduce_expr(self, ee):
+        return (self._cond.is_reduce_expr(ee) and
+                self._a.is_reduce_expr(ee) and
+                self._b.is_reduce_expr(ee))
+
+    def evaluate_eager(self, ee):
+        a = self._a
+        b = self._b
+        # A literal branch is always cast explicitly: the stype inferred for
+        # a python value at resolve time may differ from the stype of the
+        # single-element column it evaluates to (e.g. `0` resolves as int8
+        # but evaluates as bool8).
+        if a.stype != self._stype or isinstance(a, LiteralExpr):
+            a = CastExpr(a, self._stype)
+        if b.stype != self._stype or isinstance(b, LiteralExpr):
+            b = CastExpr(b, self._stype)
+        cond = self._cond.evaluate_eager(ee)
+        return core.expr_ternaryop(cond,
+                                   a.evaluate_eager(ee),
+                                   b.evaluate_eager(ee))
+
+
+    #---------------------------------------------------------------------------
+    # LLVM evaluation
+    #---------------------------------------------------------------------------
+
+    def _isna(self, key, inode):
+        cond_isna = self._cond.isna(inode)
+        a_isna = self._a.isna(inode)
+        b_isna = self._b.isna(inode)
+        if cond_isna is True:
+            return True
+        if a_isna is False and b_isna is False:
+            return cond_isna
+        conditions = []
+        if cond_isna is not False:
+            conditions.append(cond_isna)
+        conditions.append("(%s? %s : %s)"
+                          % (self._cond.notna(inode),
+                             int(a_isna) if isinstance(a_isna, bool)
+                             else a_isna,
+                             int(b_isna) if isinstance(b_isna, bool)
+                             else b_isna))
+        isna = inode.make_keyvar(key, "isna")
+        expr = "int %s = %s;" % (isna, " | ".join(conditions))
+        inode.addto_mainloop(expr)
+        return isna
+
+    def _notna(self, key, inode):
+        return ("(%s? %s : %s)"
+                % (self._cond.notna(inode),
+                   self._a.notna(inode),
+                   self._b.notna(inode)))
+
+    def __str__(self):
+        return "ifelse(%s, %s, %s)" % (self._cond, self._a, self._b)
+
+
+def ifelse(cond, a, b):
+    """
+    Row-wise conditional selection: values of `a` where `cond` is true,
+    of `b` where it is false, and NA where it is NA.
+    """
+    return IfElseExpr(cond, a, b)
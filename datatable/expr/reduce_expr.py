@@ -7,7 +7,7 @@
 # mean_expr, sd_expr, minmax_expr can eventually be merged into here too
 
 from .base_expr import BaseExpr
-from .consts import reduce_opcodes, ops_rules
+from .consts import reduce_opcodes, cumulative_opcodes, ops_rules
 from datatable.lib import core
 from datatable.types import stype
 
@@ -35,6 +35,16 @@ def first(iterable):
     else:
         for x in iterable:
             return x
+
+
+def last(iterable):
+    if isinstance(iterable, BaseExpr):
+        return ReduceExpr("last", iterable)
+    else:
+        ret = None
+        for x in iterable:
+            ret = x
+        return ret
               
               
 class CountExpr(BaseExpr):
@@ -81,3 +91,59 @@ class ReduceExpr(BaseExpr):
     def __str__(self):
         return "%s(%s)" % (self._op, self._expr)
 
+
+
+
+class CumulativeExpr(BaseExpr):
+    """
+    Running aggregate of an expression: one value per row, combining all
+    rows from the start of the row's group up to and including the row
+    itself. Unlike ReduceExpr this does not collapse groups, so it can be
+    mixed with plain column selectors in a grouped select.
+    """
+    __slots__ = ["_op", "_expr"]
+
+    def __init__(self, op, expr):
+        super().__init__()
+        self._op = op
+        self._expr = expr
+
+    def is_reduce_expr(self, ee):
+        return False
+
+    def resolve(self):
+        self._expr.resolve()
+        expr_stype = self._expr.stype
+        self._stype = ops_rules.get((self._op, expr_stype))
+        if self._stype is None:
+            raise ValueError(
+                "Cannot compute %s of a variable of type %s"
+                % (self._op, expr_stype))
+
+    def evaluate_eager(self, ee):
+        col = self._expr.evaluate_eager(ee)
+        opcode = cumulative_opcodes[self._op]
+        return core.expr_cumulativeop(opcode, col, ee.groupby)
+
+    def __str__(self):
+        return "%s(%s)" % (self._op, self._expr)
+
+
+def cumsum(expr):
+    """Running total of the expression within each group."""
+    return CumulativeExpr("cumsum", expr)
+
+
+def cummin(expr):
+    """Running minimum of the expression within each group."""
+    return CumulativeExpr("cummin", expr)
+
+
+def cummax(expr):
+    """Running maximum of the expression within each group."""
+    return CumulativeExpr("cummax", expr)
+
+
+def cumprod(expr):
+    """Running product of the expression within each group."""
+    return CumulativeExpr("cumprod", expr)
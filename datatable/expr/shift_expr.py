@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+
+from .base_expr import BaseExpr
+from datatable.lib import core
+
+__all__ = ("shift", )
+
+
+class ShiftExpr(BaseExpr):
+    """
+    Lag/lead of an expression: the value from `n` rows earlier (later when
+    `n` is negative), NA at the rows that have no such neighbour. In a
+    grouped select the shift never crosses group boundaries. The result is
+    a virtual view over the argument's data, so no values are copied.
+    """
+    __slots__ = ["_expr", "_n"]
+
+    def __init__(self, expr, n):
+        super().__init__()
+        self._expr = expr
+        self._n = n
+
+    def is_reduce_expr(self, ee):
+        return False
+
+    def resolve(self):
+        self._expr.resolve()
+        self._stype = self._expr.stype
+
+    def evaluate_eager(self, ee):
+        col = self._expr.evaluate_eager(ee)
+        return core.expr_shiftop(col, self._n, ee.groupby)
+
+    def __str__(self):
+        return "shift(%s, %d)" % (self._expr, self._n)
+
+
+def shift(expr, n=1):
+    """
+    Shift the expression `n` rows down (a lag); a negative `n` shifts it
+    up (a lead). The vacated boundary rows become NA, and in a grouped
+    select the shift restarts at every group boundary.
+    """
+    if not isinstance(n, int):
+        raise TypeError("The shift amount `n` must be an integer, got %r"
+                        % (n, ))
+    return ShiftExpr(expr, n)
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+
+from .base_expr import BaseExpr
+from ..types import stype
+from datatable.utils.typechecks import TTypeError
+from datatable.lib import core
+
+__all__ = ("str_upper", "str_lower", "str_strip", "str_slice")
+
+
+# Should be in sync with enum in "expr/strop.cc"
+str_op_codes = {
+    "upper": 1, "lower": 2, "strip": 3, "slice": 4
+}
+
+
+class StringOpExpr(BaseExpr):
+    __slots__ = ["_op", "_arg", "_start", "_stop"]
+
+    def __init__(self, op, arg, start=0, stop=None):
+        super().__init__()
+        self._op = op
+        self._arg = arg
+        self._start = start
+        self._stop = stop
+
+    def resolve(self):
+        self._arg.resolve()
+        if self._arg.stype not in (stype.str32, stype.str64):
+            raise TTypeError("Function `%s` cannot be applied to a `%s` column"
+                             % (self._op, self._arg.stype.name))
+        self._stype = self._arg.stype
+
+    def is_reduce_expr(self, ee):
+        return self._arg.is_reduce_expr(ee)
+
+    def evaluate_eager(self, ee):
+        arg = self._arg.evaluate_eager(ee)
+        opcode = str_op_codes[self._op]
+        start = self._start if self._start is not None else 0
+        stop = self._stop if self._stop is not None else (1 << 62)
+        return core.expr_stringop(opcode, arg, start, stop)
+
+    def __str__(self):
+        if self._op == "slice":
+            return "slice(%s,%r,%r)" % (self._arg, self._start, self._stop)
+        return "%s(%s)" % (self._op, self._arg)
+
+
+def str_upper(x):
+    """Convert all ASCII letters in a string column to upper case."""
+    return StringOpExpr("upper", x)
+
+
+def str_lower(x):
+    """Convert all ASCII letters in a string column to lower case."""
+    return StringOpExpr("lower", x)
+
+
+def str_strip(x):
+    """Remove leading and trailing whitespace in a string column."""
+    return StringOpExpr("strip", x)
+
+
+def str_slice(x, start=0, stop=None):
+    """
+    Take the substring ``[start:stop]`` of every value in a string column.
+    Indices count code points, and may be negative (Python semantics).
+    """
+    return StringOpExpr("slice", x, start, stop)
@@ -48,3 +48,127 @@ class UnaryOpExpr(BaseExpr):
 
     def __str__(self):
         return "(%s %s)" % (self._op, self._arg)
+
+
+def abs(x):
+    """Compute the absolute value of each element in a numeric column."""
+    return UnaryOpExpr("abs", x)
+
+
+def exp(x):
+    """Compute e raised to the power of each element in a numeric column."""
+    return UnaryOpExpr("exp", x)
+
+
+def log(x):
+    """Compute the natural logarithm of each element in a numeric column."""
+    return UnaryOpExpr("log", x)
+
+
+def log10(x):
+    """Compute the base-10 logarithm of each element in a numeric column."""
+    return UnaryOpExpr("log10", x)
+
+
+def sqrt(x):
+    """Compute the square root of each element in a numeric column."""
+    return UnaryOpExpr("sqrt", x)
+
+
+def round(x):
+    """Round each element to the nearest integer (half-to-even)."""
+    return UnaryOpExpr("round", x)
+
+
+def floor(x):
+    """Round each element down to the nearest integer."""
+    return UnaryOpExpr("floor", x)
+
+
+def ceil(x):
+    """Round each element up to the nearest integer."""
+    return UnaryOpExpr("ceil", x)
+
+
+class ClipExpr(BaseExpr):
+    """
+    Limit the values of an expression to the range [lower, upper]. Either
+    bound may be None to leave that side unclipped. NA values remain NA,
+    and the result keeps the stype of the argument.
+    """
+    __slots__ = ["_arg", "_lower", "_upper"]
+
+    def __init__(self, arg, lower, upper):
+        super().__init__()
+        self._arg = arg
+        self._lower = lower
+        self._upper = upper
+
+    def is_reduce_expr(self, ee):
+        return self._arg.is_reduce_expr(ee)
+
+    def resolve(self):
+        self._arg.resolve()
+        self._stype = self._arg.stype
+
+    def evaluate_eager(self, ee):
+        col = self._arg.evaluate_eager(ee)
+        lo = None if self._lower is None else float(self._lower)
+        hi = None if self._upper is None else float(self._upper)
+        return core.expr_clip(col, lo, hi)
+
+    def __str__(self):
+        return "clip(%s, %r, %r)" % (self._arg, self._lower, self._upper)
+
+
+def clip(x, lower=None, upper=None):
+    """
+    Limit the values of `x` to the range [lower, upper]; either bound may
+    be omitted to clip on one side only.
+    """
+    return ClipExpr(x, lower, upper)
+
+
+class BucketizeExpr(BaseExpr):
+    """
+    Map every value of an expression into one of `nbins` equal-width bins
+    spanning [lower, upper), producing an int32 column of bin indices
+    clamped to [0, nbins - 1] -- ready for use as a groupby key. NA values
+    map to NA.
+    """
+    __slots__ = ["_arg", "_nbins", "_lower", "_upper"]
+
+    def __init__(self, arg, nbins, lower, upper):
+        super().__init__()
+        self._arg = arg
+        self._nbins = nbins
+        self._lower = lower
+        self._upper = upper
+
+    def is_reduce_expr(self, ee):
+        return self._arg.is_reduce_expr(ee)
+
+    def resolve(self):
+        self._arg.resolve()
+        self._stype = stype.int32
+
+    def evaluate_eager(self, ee):
+        col = self._arg.evaluate_eager(ee)
+        return core.expr_bucketize(col, self._nbins,
+                                   float(self._lower), float(self._upper))
+
+    def __str__(self):
+        return "bucketize(%s, %d, %r, %r)" % (self._arg, self._nbins,
+                                              self._lower, self._upper)
+
+
+def bucketize(x, nbins, lower, upper):
+    """
+    Assign every value of `x` to one of `nbins` equal-width bins spanning
+    [lower, upper), returning the bin indices as an int32 column. Values
+    outside the range go into the first or the last bin.
+    """
+    if not isinstance(nbins, int) or nbins < 1:
+        raise TTypeError("The number of bins must be a positive integer, "
+                         "got %r" % (nbins, ))
+    return BucketizeExpr(x, nbins, lower, upper)
@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+from datatable.lib import core
+
+
+def onehot(self):
+    """
+    One-hot encode a single-column string Frame.
+
+    Parameters
+    ----------
+    self: Frame
+        A Frame with a single string column.
+
+    Returns
+    -------
+    A new Frame with one boolean column per distinct value of the source
+    column, named after that value and containing 1 in the rows where the
+    source column has the value, 0 elsewhere. The columns appear in sorted
+    order of the values. Rows with NA values are 0 in every column.
+    """
+    return core.onehot(self)
+
+
+def label_encode(self):
+    """
+    Encode a single-column string Frame as dense integer labels.
+
+    Parameters
+    ----------
+    self: Frame
+        A Frame with a single string column.
+
+    Returns
+    -------
+    A tuple `(codes, categories)` of two Frames. `codes` has a single int32
+    column `code` aligned with the source rows, where each value is replaced
+    by its position in the sorted list of distinct values (NA values map to
+    NA codes). `categories` has a single string column `category` listing
+    the distinct values, so that row `k` is the value encoded as `k`.
+    """
+    return core.label_encode(self)
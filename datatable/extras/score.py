@@ -0,0 +1,34 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+from datatable.lib import core
+
+
+def score_linear(self, weights, intercept=0.0, sigmoid=False):
+    """
+    Score a linear model over the frame, in parallel over row chunks.
+
+    Parameters
+    ----------
+    self: Frame
+        The frame of features. Numeric and string columns are supported.
+    weights: List[float]
+        The model weights. Numeric column `j` contributes
+        `weights[j] * value` to each row's score; string columns hash each
+        value into the weight vector (stable FNV-1a) and contribute the
+        weight at the hashed index. Must have at least as many entries as
+        there are columns. NA values contribute nothing.
+    intercept: float
+        Constant added to every row's score.
+    sigmoid: bool
+        If True, pass the scores through the logistic function, as when
+        scoring an FTRL-trained classifier.
+
+    Returns
+    -------
+    A new one-column float64 Frame `score` with one prediction per row.
+    """
+    return core.score_linear(self, list(weights), intercept, int(sigmoid))
@@ -5,6 +5,7 @@
 #   file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #-------------------------------------------------------------------------------
 import collections
+import os
 import time
 
 from datatable.lib import core
@@ -13,6 +14,8 @@ from .widget import DataFrameWidget
 
 from datatable.dt_append import _rbind, _cbind
 from datatable.nff import save as dt_save
+from datatable.nff import save_stream as dt_save_stream
+from datatable.nff import to_shmem as dt_to_shmem
 from datatable.utils.misc import plural_form as plural
 from datatable.utils.misc import load_module
 from datatable.utils.typechecks import (
@@ -278,6 +281,25 @@ class Frame(core.Frame):
         return make_datatable(self, *resolve_selector(item))
 
 
+    def explain(self, item):
+        """
+        Evaluate ``df[item]`` and report which evaluation path was chosen.
+
+        The selector is executed exactly as in ``__getitem__``, but instead
+        of the result Frame a dict is returned describing the plan: the
+        rowfilter kernel ("rows"), the columnset kernel ("columns"), the
+        groupby / join strategies, the evaluation engine, source vs result
+        row counts, and whether the result is a zero-copy view of the
+        source data ("result_is_view"). The result Frame itself is
+        available under the "result" key.
+
+        Example:
+            df.explain((slice(None, 10), slice(None)))["rows"]
+            # 'slice rowindex (zero-copy)'
+        """
+        return make_datatable(self, *resolve_selector(item), explain=True)
+
+
     def __setitem__(self, item, value):
         """
         Update values in Frame, in-place.
@@ -321,10 +343,12 @@ class Frame(core.Frame):
     cbind = _cbind
     to_csv = write_csv
     save = dt_save
+    save_stream = dt_save_stream
+    to_shmem = dt_to_shmem
 
 
     @typed(by=U(str, int))
-    def sort(self, by):
+    def sort(self, by, case_insensitive=False):
         """
         Sort datatable by the specified column.
 
@@ -332,6 +356,10 @@ class Frame(core.Frame):
         ----------
         by: str or int
             Name or index of the column to sort by.
+        case_insensitive: bool
+            If True, order a string column as if it were lowercased,
+            without actually materializing a lowercase copy. Ties between
+            case variants keep their original row order.
 
         Returns
         -------
@@ -339,11 +367,252 @@ class Frame(core.Frame):
         remains unmodified.
         """
         idx = self.colindex(by)
-        ri = self._dt.sort(idx)[0]
+        ri = self._dt.sort(idx, False, case_insensitive)[0]
+        cs = core.columns_from_slice(self._dt, ri, 0, self.ncols, 1)
+        return cs.to_frame(self.names)
+
+
+    def cross_join(self, other):
+        """
+        Cartesian product of two Frames.
+
+        Parameters
+        ----------
+        other: Frame
+            The Frame to pair with.
+
+        Returns
+        -------
+        A new Frame with ``self.nrows * other.nrows`` rows, where every row
+        of this Frame is paired with every row of `other` (this Frame's
+        rows vary slowest). The columns of both Frames are carried over.
+        The row pairing is expressed through constant-memory virtual
+        rowindexes, so no index arrays are built.
+        """
+        return self._dt.cross_join(other.internal)
+
+
+    def isin(self, col, values, invert=False):
+        """
+        Select the rows where column `col` takes one of the given values.
+
+        Parameters
+        ----------
+        col: str or int
+            Name or index of the column to test.
+        values: iterable
+            The values to look for. They are converted to the column's
+            stype up front, so membership is tested natively, without
+            crossing into Python per row.
+        invert: bool
+            If True, select the rows whose value is NOT among `values`.
+
+        Returns
+        -------
+        A new Frame with only the selected rows. The value set is compiled
+        once (into a bitset when the values are integers within a small
+        range, or a hash table otherwise) and the column is scanned in
+        parallel chunks. A None among `values` matches NA rows, except in
+        float columns where NA never matches (NaN compares unequal).
+        """
+        idx = self.colindex(col)
+        keyframe = Frame([list(values)], stype=self.stypes[idx])
+        ri = self._dt.isin_filter(idx, invert, keyframe.internal)
+        cs = core.columns_from_slice(self._dt, ri, 0, self.ncols, 1)
+        return cs.to_frame(self.names)
+
+
+    def sample(self, n=None, frac=None, seed=None):
+        """
+        Select a random sample of the Frame's rows.
+
+        Parameters
+        ----------
+        n: int
+            Number of rows to sample, without replacement. The rows come
+            out in random order, so ``DT.sample(n=DT.nrows)`` is a full
+            shuffle of the frame.
+        frac: float
+            Alternatively, the fraction of rows to select: every row is
+            included independently with this probability, preserving the
+            original row order. Exactly one of `n` and `frac` must be
+            given.
+        seed: int
+            Seed for the sample, making it reproducible. If not given, a
+            fresh random seed is drawn.
+
+        Returns
+        -------
+        A new Frame with the sampled rows. The sample is computed natively
+        as a compact RowIndex: taking a small sample of a very large frame
+        needs O(n) memory, not a permutation of all the rows.
+        """
+        if (n is None) == (frac is None):
+            raise TValueError("Exactly one of `n` and `frac` must be given "
+                              "in sample()")
+        if n is not None:
+            if not isinstance(n, int) or isinstance(n, bool):
+                raise TTypeError("`n` must be an integer, got %r" % (n, ))
+            if not (0 <= n <= self.nrows):
+                raise TValueError("Cannot sample %d rows out of %d"
+                                  % (n, self.nrows))
+        else:
+            if not isinstance(frac, (int, float)) or isinstance(frac, bool):
+                raise TTypeError("`frac` must be a number, got %r" % (frac, ))
+            if not (0 <= frac <= 1):
+                raise TValueError("`frac` must be in the range [0; 1], got %r"
+                                  % (frac, ))
+        if seed is None:
+            seed = int.from_bytes(os.urandom(8), "little")
+        k = -1 if n is None else n
+        ri = self._dt.sample_rows(k, 0.0 if frac is None else float(frac),
+                                  seed & ((1 << 64) - 1))
+        cs = core.columns_from_slice(self._dt, ri, 0, self.ncols, 1)
+        return cs.to_frame(self.names)
+
+
+    def unique(self):
+        """
+        Select the distinct rows of the Frame.
+
+        Rows are compared by value across all columns; the first
+        occurrence of every distinct row is kept, in the original row
+        order. The operation is hash-based -- one parallel hashing pass
+        over the columns plus a set insert per row -- so on mostly-unique
+        frames it is much cheaper than a sort by all columns.
+
+        Returns
+        -------
+        A new Frame with the duplicate rows removed.
+        """
+        ri = self._dt.unique_rows()
         cs = core.columns_from_slice(self._dt, ri, 0, self.ncols, 1)
         return cs.to_frame(self.names)
 
 
+    def str_contains(self, col, pattern):
+        """
+        Select the rows where string column `col` contains `pattern`.
+
+        Parameters
+        ----------
+        col: str or int
+            Name or index of the column to search (must be a string column).
+        pattern: str
+            Plain substring to look for (not a regular expression).
+
+        Returns
+        -------
+        A new Frame with only the matching rows. NA strings never match;
+        an empty pattern matches every non-NA row. The search runs natively
+        over the column's string buffer, without crossing into Python per
+        row.
+        """
+        return self._str_filter(col, 0, pattern)
+
+
+    def str_startswith(self, col, pattern):
+        """
+        Select the rows where string column `col` starts with `pattern`.
+        See :meth:`str_contains` for details.
+        """
+        return self._str_filter(col, 1, pattern)
+
+
+    def str_endswith(self, col, pattern):
+        """
+        Select the rows where string column `col` ends with `pattern`.
+        See :meth:`str_contains` for details.
+        """
+        return self._str_filter(col, 2, pattern)
+
+
+    def _str_filter(self, col, method, pattern):
+        ri = self._dt.str_filter(self.colindex(col), method, pattern)
+        cs = core.columns_from_slice(self._dt, ri, 0, self.ncols, 1)
+        return cs.to_frame(self.names)
+
+
+    def value_counts(self, col=0, sort_by_count=True):
+        """
+        Count occurrences of each distinct value in the given column.
+
+        Parameters
+        ----------
+        col: str or int
+            Name or index of the column to profile.
+        sort_by_count: bool
+            If True (default), order the result by decreasing count (ties
+            broken by value); otherwise by value, with NA first.
+
+        Returns
+        -------
+        A new two-column Frame ``(value, count)``, one row per distinct
+        value of the column (including NA if present).
+        """
+        return self._dt.value_counts(self.colindex(col), sort_by_count)
+
+
+    def categorize(self, col=None):
+        """
+        Convert string columns into dictionary-encoded categoricals.
+
+        Parameters
+        ----------
+        col: str or int, optional
+            Name or index of the column to convert (must be a string
+            column). If omitted, all string columns of the Frame are
+            converted.
+
+        The conversion happens in place: each affected column becomes
+        ``stype.cat32``, storing every distinct string once in a shared
+        dictionary and an int32 code per row. The column still reads and
+        displays as strings, but sorting, grouping and filtering operate
+        on the codes, so repeated strings are never hashed or compared
+        again.
+        """
+        if col is None:
+            self._dt.categorize()
+        else:
+            self._dt.categorize(self.colindex(col))
+
+
+    def melt(self, nid=0):
+        """
+        Reshape the Frame from wide to long format.
+
+        Parameters
+        ----------
+        nid: int
+            Number of leading columns to carry over as identifiers. All
+            remaining columns must be numeric; they are stacked into a
+            string `variable` column holding the source column's name and
+            a float64 `value` column holding its values.
+
+        Returns
+        -------
+        A new Frame with ``nrows * (ncols - nid)`` rows: one block of rows
+        per melted column, in column order. The target Frame remains
+        unmodified.
+        """
+        return self._dt.melt(nid)
+
+
+    def pivot(self):
+        """
+        Reshape the Frame from long to wide format.
+
+        The Frame must have exactly three columns: an identifier column, a
+        string variable column, and a numeric value column. The result has
+        one row per distinct identifier (sorted) and one float64 column per
+        distinct variable (sorted, named after the variable), preceded by
+        the identifier column. Cells with no matching row are NA; rows
+        whose variable is NA are dropped. The target Frame remains
+        unmodified.
+        """
+        return self._dt.pivot()
+
+
     #---------------------------------------------------------------------------
     # Stats
     #---------------------------------------------------------------------------
@@ -544,7 +813,7 @@ class Frame(core.Frame):
         """
         Convert the Frame into a python list-of-lists.
         """
-        return self._dt.window(0, self.nrows, 0, self.ncols).data
+        return self._dt.to_pylist()
 
 
     def scalar(self):
@@ -561,6 +830,111 @@ class Frame(core.Frame):
             self._dt.materialize()
 
 
+    def replace(self, replacements):
+        """
+        Replace values in this Frame, in-place.
+
+        Parameters
+        ----------
+        replacements: dict
+            Mapping of current values to their replacements, for example
+            ``{-999: None, 0: 1, None: 0}``. Keys and values must be numeric
+            (bool / int / float) or None (meaning NA).
+
+        All rules are compiled together and applied in a single parallel
+        pass over each column, simultaneously against the original values:
+        a value newly written by one rule is never re-matched by another,
+        so ``{0: 1, 1: 0}`` swaps zeros and ones. The replacement applies
+        to every boolean, integer and real column of the Frame; columns of
+        other types are left untouched. Rules whose key cannot be
+        represented exactly in a column's storage type are skipped for
+        that column, so e.g. ``{0.5: 1}`` does not affect integer columns.
+        """
+        if not isinstance(replacements, dict):
+            raise TTypeError("`replacements` should be a dict of "
+                             "{value: replacement} rules")
+        for old, new in replacements.items():
+            for v in (old, new):
+                if not (v is None or isinstance(v, (bool, int, float))):
+                    raise TTypeError("Invalid value %r in `replacements`: "
+                                     "only numeric values and None are "
+                                     "supported" % (v,))
+        if not replacements:
+            return
+        # The smallest value of each integer stype is its NA sentinel, hence
+        # the ranges here are symmetric.
+        int_bounds = {stype.bool8: (0, 1),
+                      stype.int8: (-2**7 + 1, 2**7 - 1),
+                      stype.int16: (-2**15 + 1, 2**15 - 1),
+                      stype.int32: (-2**31 + 1, 2**31 - 1),
+                      stype.int64: (-2**63 + 1, 2**63 - 1)}
+        for j, st in enumerate(self.stypes):
+            if st in int_bounds:
+                lo, hi = int_bounds[st]
+                rules = [(k, v) for k, v in replacements.items()
+                         if k is None or
+                            (not (isinstance(k, float) and not k.is_integer())
+                             and lo <= k <= hi)]
+            elif st in (stype.float32, stype.float64):
+                rules = list(replacements.items())
+            else:
+                continue
+            if not rules:
+                continue
+            mframe = datatable.Frame([[k for k, _ in rules]])
+            rframe = datatable.Frame([[v for _, v in rules]])
+            self._dt.replace_values(j, mframe.internal, rframe.internal)
+
+
+    def release_memory(self):
+        """
+        Advise the OS that this Frame's memory-mapped data is no longer part
+        of the working set, allowing its pages to be reclaimed.
+
+        Use this when a pipeline stage has finished with a large Frame opened
+        from disk (e.g. a Jay file), so that its pages do not push the next
+        stage's data out of RAM. The Frame remains fully usable afterwards:
+        evicted pages are transparently re-read from disk on next access.
+        In-memory (non-mapped) Frames are unaffected.
+        """
+        self._dt.release_memory()
+
+
+    def reserve(self, nrows):
+        """
+        Preallocate capacity for `nrows` rows in this Frame's columns.
+
+        The number of rows in the Frame does not change; however subsequent
+        `rbind()` calls that keep the Frame within the reserved capacity
+        will append data in-place instead of reallocating the columns'
+        buffers. Use this when growing a Frame through many small appends
+        whose total size is known (or can be estimated) in advance.
+        """
+        self._dt.reserve(nrows)
+
+
+    def snapshot(self):
+        """
+        Return a read-only snapshot of this Frame, for use by readers that
+        run concurrently with appends to it.
+
+        The snapshot is an O(ncols) operation: it captures the current
+        number of rows and references to the columns' data buffers, without
+        copying any data. Subsequent `rbind()` calls on this Frame never
+        modify a buffer that a snapshot references -- an append into a
+        shared buffer reallocates instead (copy-on-write) -- so reading
+        from the snapshot requires no synchronization with the writer.
+        Buffers retired by such appends are freed automatically once the
+        last snapshot referencing them is deleted.
+
+        Note that the snapshot itself must still be taken while no append
+        is in flight (e.g. on the thread that performs the appends, or
+        under the same lock).
+        """
+        cs = core.columns_from_slice(self._dt, None, 0, self.ncols, 1)
+        return cs.to_frame(self.names)
+
+
     def __sizeof__(self):
         """
         Return the size of this Frame in memory.
@@ -585,6 +959,49 @@ class Frame(core.Frame):
         return self._dt.alloc_size
 
 
+    def memory_footprint(self):
+        """
+        Return a detailed breakdown of the memory held by the Frame.
+
+        The result is a dict with keys "columns", "rowindex" and "total".
+        The "columns" entry is a list with one dict per column, giving the
+        column's name, its overall footprint in bytes, and a description of
+        each of its buffers ("data" for the main data buffer, "strdata" for
+        the character data of string columns, None otherwise). Each buffer
+        description reports the backing resource type (e.g. "ram" or
+        "mmap"), its virtual size, the number of bytes currently resident
+        in physical memory, and whether the buffer is shared
+        copy-on-write with other columns or frames.
+        """
+        info = self._dt.memory_footprint()
+        for name, colinfo in zip(self.names, info["columns"]):
+            colinfo["name"] = name
+        return info
+
+
+    def __reduce_ex__(self, protocol):
+        """
+        Support for pickling a Frame.
+
+        The Frame is serialized in Jay format into an in-memory buffer,
+        and unpickled with :func:`datatable.open_buffer`, which reopens
+        the buffer without copying. With pickle protocol 5 the buffer is
+        passed out-of-band (PEP 574), so that consumers providing a
+        `buffer_callback` -- such as multiprocessing -- can transfer the
+        frame with near-zero copies.
+
+        Note: columns of stype obj64 cannot be serialized and will be
+        dropped (with a warning), same as when saving to a Jay file.
+        """
+        jaybuf = self._dt.save_jay_memory(list(self.names))
+        if protocol >= 5:
+            import pickle
+            buf = pickle.PickleBuffer(jaybuf)
+        else:
+            buf = bytes(memoryview(jaybuf))
+        return (datatable.open_buffer, (buf,))
+
+
 
 
 
@@ -633,6 +1050,117 @@ options.register_option(
 options.register_option(
     "sort.nthreads", xtype=int, default=4, core=True)
 
+options.register_option(
+    "sort.spill_threshold", xtype=int, default=0, core=True,
+    doc="Sort scratch buffers of at least this many bytes are backed by "
+        "temporary memory-mapped files instead of RAM, letting sorts of "
+        "columns comparable to the machine's memory size run within a "
+        "fixed memory envelope at some I/O cost. The value of 0 (default) "
+        "disables spilling.")
+
+options.register_option(
+    "thread_affinity", xtype=bool, default=False, core=True,
+    doc="If True, pin each OpenMP thread to a single CPU. Pinned threads "
+        "stay on the same NUMA node across parallel regions, which makes "
+        "first-touch page placement (see options.memory.first_touch) "
+        "effective. Only has an effect on Linux.")
+
+options.register_option(
+    "memory.first_touch", xtype=bool, default=False, core=True,
+    doc="If True, large column allocations are initialized in parallel so "
+        "that their pages are spread across NUMA nodes instead of all "
+        "residing on the allocating thread's node. Useful on multi-socket "
+        "machines, together with options.thread_affinity.")
+
+options.register_option(
+    "memory.alloc_trace", xtype=bool, default=False, core=True,
+    doc="If True, every allocation that goes through the library's "
+        "allocator is recorded: a size-class histogram, the peak number "
+        "of live bytes, and a per-operation attribution of allocated "
+        "bytes. Query the collected statistics with core.alloc_stats() "
+        "and clear them with core.alloc_stats_reset(). Useful for "
+        "tracking down transient memory spikes.")
+
+options.register_option(
+    "view.materialize_async", xtype=bool, default=False, core=True,
+    doc="If True, view columns created by row filtering / slicing start "
+        "materializing immediately on a background thread, overlapping the "
+        "work with whatever the program does next. A consumer that needs "
+        "the materialized data earlier simply blocks until it is ready; "
+        "consumers that never need it are unaffected, since the column "
+        "remains a valid view throughout.")
+
+options.register_option(
+    "view.materialization", xtype=str, default="lazy", core=True,
+    doc="When to materialize view columns created by row filtering / "
+        "slicing. \"lazy\" (the default) keeps them as views until first "
+        "access; \"eager\" copies the selected data out immediately; "
+        "\"auto\" decides per selection: small results and highly "
+        "selective filters are materialized (a long-lived view would pin "
+        "the much larger source in memory), while large low-selectivity "
+        "slices remain views. Batch pipelines that scan each intermediate "
+        "result exactly once typically want \"eager\"; interactive "
+        "sessions are usually best served by \"lazy\" or \"auto\".")
+
+options.register_option(
+    "jay.verify_checksums", xtype=bool, default=False, core=True,
+    doc="Controls checksum verification of plain (uncompressed) column data "
+        "when opening a Jay file. Columns stored compressed, or extended by "
+        "appending, verify their checksum on first access in any case, "
+        "since their data is copied out of the file anyway; plain columns "
+        "are normally zero-copy views into the memory-mapped file, and "
+        "verifying them requires copying the data out, which this option "
+        "enables. Checksums are verified lazily, at first access of each "
+        "column, so opening a file remains free of I/O either way.")
+
+options.register_option(
+    "perf.track", xtype=bool, default=False, core=True,
+    doc="If True, every major operation (sort, groupby reduction, fread, "
+        "view materialization, expression evaluation) records its wall "
+        "time, bytes touched, and parallelism details into a small ring "
+        "buffer queryable via core.perf_records(). The overhead per "
+        "operation is a few atomic updates; when False (default) the "
+        "instrumentation is a single branch.")
+
+options.register_option(
+    "perf.hw_counters", xtype=bool, default=False, core=True,
+    doc="If True (and options.perf.track is enabled), every record also "
+        "carries the operation's hardware cache-miss and branch-miss "
+        "deltas, read from the kernel's perf_event counters. Requires "
+        "Linux and permission to open perf events; elsewhere the fields "
+        "are reported as -1. Enable this before the first operation so "
+        "that worker threads are covered by the counters.")
+
+options.register_option(
+    "memory.hugepage_threshold", xtype=int, default=0, core=True,
+    doc="Heap allocations of at least this many bytes will be backed by "
+        "transparent huge pages, reducing TLB pressure in random-access "
+        "operations over very large frames. The value of 0 (default) "
+        "disables huge-page backing. Only effective on Linux; on other "
+        "platforms the option is accepted but has no effect.")
+
+options.register_option(
+    "memory.mmap_budget", xtype=int, default=0, core=True,
+    doc="Combined-size budget, in bytes, for memory-mapped column data "
+        "(disk-backed frames, string buffers spilled to disk, etc). When "
+        "mapping a new region would exceed the budget, the least recently "
+        "used regions are unmapped, returning their pages to the OS; they "
+        "are transparently remapped if accessed again. This keeps the "
+        "resident set of larger-than-memory workloads bounded, degrading "
+        "to re-reads from disk instead of swapping. The value of 0 "
+        "(default) disables budgeting.")
+
+options.register_option(
+    "memory.sequential_paths", xtype=str, default="", core=True,
+    doc="Colon-separated list of path prefixes that reside on storage "
+        "with poor random-read performance, such as an HDD tier of a "
+        "mixed-storage setup. Files under these prefixes are not "
+        "memory-mapped directly; instead each is staged into anonymous "
+        "memory with a single sequential read-ahead pass when its data "
+        "is first accessed, so that subsequent random access hits RAM "
+        "rather than seeking the disk. Files elsewhere are mapped "
+        "lazily as usual.")
+
 options.register_option(
     "frame.names_auto_index", xtype=int, default=0, core=True,
     doc="When Frame needs to auto-name columns, they will be assigned "
@@ -58,6 +58,7 @@ def fread(
         save_to: str = None,
         nthreads: int = None,
         logger=None,
+        rbind: bool = False,
         **extra) -> Frame:
     params = {**locals(), **extra}
     del params["extra"]
@@ -77,7 +78,7 @@ class GenericReader(object):
                  fill=False, show_progress=None, encoding=None, dec=".",
                  skip_to_string=None, skip_to_line=None, save_to=None,
                  nthreads=None, logger=None, skip_blank_lines=True,
-                 strip_whitespace=True, quotechar='"', **args):
+                 strip_whitespace=True, quotechar='"', rbind=False, **args):
         self._src = None            # type: str
         self._file = None           # type: str
         self._files = None          # type: List[str]
@@ -104,11 +105,13 @@ class GenericReader(object):
         self._save_to = save_to
         self._nthreads = nthreads
         self._logger = None
+        self._rbind = bool(rbind)
 
         self._colnames = None
         self._bar_ends = None
         self._bar_symbols = None
         self._result = None
+        self._read_report = None
 
         if show_progress is None:
             show_progress = term.is_a_tty
@@ -209,7 +212,9 @@ class GenericReader(object):
                 elif is_str and re.search(_glob_regex, src):
                     if self.verbose:
                         self.logger.debug("Input is a glob pattern.")
-                    self._resolve_source_list_of_files(glob.glob(src))
+                    # Sort the glob results so that the order of the files (and
+                    # hence the row order when rbind=True) is deterministic.
+                    self._resolve_source_list_of_files(sorted(glob.glob(src)))
                 else:
                     if self.verbose:
                         self.logger.debug("Input is assumed to be a "
@@ -365,13 +370,12 @@ class GenericReader(object):
             self._file = self._tempfiles[-1]
 
         elif ext == ".gz":
-            import gzip
-            zf = gzip.GzipFile(filename, mode="rb")
+            # Gzip streams are inflated natively by the C reader, straight
+            # from the memory-mapped file into the parse buffer.
             if self._verbose:
-                self.logger.debug("Extracting %s into memory" % filename)
-            self._text = zf.read()
-            if self._verbose:
-                self.logger.debug("Extracted: size = %d" % len(self._text))
+                self.logger.debug("File %s will be decompressed by the "
+                                  "native reader" % filename)
+            self._file = filename
 
         elif ext == ".bz2":
             import bz2
@@ -453,6 +457,25 @@ class GenericReader(object):
         return self._src
 
 
+    @property
+    def read_report(self) -> Optional[dict]:
+        """
+        Structured report about the most recent read performed by this
+        reader, or None if nothing has been read yet.
+
+        The report is a dict of counters gathered by the C parser: input
+        size, rows/columns read and allocated, the number of parallel
+        chunks and threads used, how many output re-allocations and
+        out-of-sample type bumps occurred (with the affected columns
+        listed in "messages"), the time spent in each parsing phase, the
+        average fraction of the reading phase that worker threads were
+        busy, and the overall read speed in bytes per second. Intended
+        for programmatic detection of degraded parses, complementing the
+        human-readable verbose log.
+        """
+        return self._read_report
+
+
     @property
     def file(self) -> Optional[str]:
         """
@@ -707,6 +730,22 @@ class GenericReader(object):
             if self._result:
                 return self._result
             if self._files:
+                if self._rbind:
+                    # Read all shards through this single reader object (the
+                    # parse parameters are resolved once for the whole batch),
+                    # then combine them natively in a single rbind call.
+                    # `force=True` reconciles the shards' column types using
+                    # the normal rbind promotion rules.
+                    frames = []
+                    for src, filename, fileno, txt in self._files:
+                        self._src = src
+                        self._file = filename
+                        self._fileno = fileno
+                        self._txt = txt
+                        self._colnames = None
+                        frames.append(core.gread(self))
+                    import datatable
+                    return datatable.Frame().rbind(*frames, force=True)
                 res = {}
                 for src, filename, fileno, txt in self._files:
                     self._src = src
@@ -7,7 +7,7 @@
 import datatable
 from .rows_node import AllRFNode, SortedRFNode, make_rowfilter
 from .cols_node import SliceCSNode, ArrayCSNode, make_columnset
-from .context import make_engine
+from .context import make_engine, LlvmEvaluationEngine
 from .groupby_node import make_groupby
 from .sort_node import make_sort
 from .join_node import join
@@ -22,17 +22,49 @@ __all__ = ("make_datatable",
 
 
 
+# Human-readable descriptions of the rowfilter / columnset kernels, keyed
+# by node class name; used by the explain mode to name the chosen path.
+_rowfilter_kernels = {
+    "AllRFNode": "all rows (no filtering)",
+    "SliceRFNode": "slice rowindex (zero-copy)",
+    "MultiSliceRFNode": "multi-slice rowindex (materialized index array)",
+    "ArrayRFNode": "array rowindex (materialized index array)",
+    "BooleanColumnRFNode": "boolean column filter (materialized index array)",
+    "IntegerColumnRFNode": "integer column rowindex (materialized index "
+                           "array)",
+    "FilterExprRFNode": "expression filter (parallel scan)",
+    "SortedRFNode": "sort ordering (radix sort; reuses the cached ordering "
+                    "when available)",
+}
+
+_columnset_kernels = {
+    "AllCSNode": "all columns (copied by reference)",
+    "SliceCSNode": "column slice (copied by reference)",
+    "ArrayCSNode": "column list (copied by reference)",
+    "MixedCSNode": "computed columns (expression evaluation)",
+}
+
+
 def make_datatable(dt, rows, select, groupby=None, join=None, sort=None,
-                   engine=None, mode=None, replacement=None):
+                   engine=None, mode=None, replacement=None, explain=False):
     """
     Implementation of the `Frame.__call__()` method.
 
     This is the "main" function in the module; it is responsible for
     evaluating various transformations when they are applied to a target
     Frame.
+
+    If `explain` is True the call is evaluated as usual, but instead of the
+    result Frame a report dict is returned describing the chosen evaluation
+    path: which rowfilter / columnset kernels ran, whether a groupby sort
+    was needed, estimated vs actual row counts, and whether the result is a
+    zero-copy view or materialized data (see `Frame.explain()`).
     """
     update_mode = mode == "update"
     delete_mode = mode == "delete"
+    if explain and (update_mode or delete_mode):
+        raise TValueError("explain mode cannot be combined with update or "
+                          "delete")
     jframe = join.joinframe if join else None
     with f.bind_datatable(dt), g.bind_datatable(jframe):
         ee = make_engine(engine, dt, jframe)
@@ -106,6 +138,30 @@ def make_datatable(dt, rows, select, groupby=None, join=None, sort=None,
         res_dt = ee.columns.to_frame(colsnode.column_names)
         if grbynode and res_dt.nrows == dt.nrows:
             res_dt.internal.groupby = ee.groupby
+        if explain:
+            rowsname = type(rowsnode).__name__
+            colsname = type(colsnode).__name__
+            report = {
+                "rows": _rowfilter_kernels.get(rowsname, rowsname),
+                "columns": _columnset_kernels.get(colsname, colsname),
+                "groupby": ("sort on columns %r"
+                            % [dt.names[i] if isinstance(i, int) else i
+                               for i in ee.groupby_cols])
+                           if grbynode else None,
+                "join": "hash join" if join else None,
+                "engine": "llvm" if isinstance(ee, LlvmEvaluationEngine)
+                          else "eager",
+                "source_nrows": dt.nrows,
+                "estimated_nrows": ee.rowindex.nrows if ee.rowindex
+                                   else dt.nrows,
+                "result_nrows": res_dt.nrows,
+                "result_ncols": res_dt.ncols,
+                # A view result means no column data was copied: only a
+                # rowindex was created on top of the source columns
+                "result_is_view": res_dt.internal.isview,
+                "result": res_dt,
+            }
+            return report
         return res_dt
 
     raise RuntimeError("Unable to calculate the result")  # pragma: no cover
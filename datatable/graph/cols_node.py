@@ -272,9 +272,29 @@ class MixedCSNode(ColumnSetNode):
                             col = col.ungroup(ee.groupby)
                     columns[i] = col
             else:
-                columns = [core.expr_column(_dt, e, _ri) if isinstance(e, int)
-                           else e.evaluate_eager(ee)
-                           for e in self._elems]
+                # Results of computed columns are cached, keyed on the
+                # expression text plus the frame's version stamp, so repeating
+                # the same expression against an unchanged frame reuses the
+                # previously materialized column. The cache is only consulted
+                # when no row filter is applied (a RowIndex would have to be
+                # part of the key, and its identity is not stable).
+                version = _dt.cache_version if _ri is None else None
+                columns = []
+                for e in self._elems:
+                    if isinstance(e, int):
+                        columns.append(core.expr_column(_dt, e, _ri))
+                        continue
+                    key = None
+                    if version is not None:
+                        key = "%d;%s" % (version, e)
+                        col = core.expr_cache_lookup(key)
+                        if col is not None:
+                            columns.append(col)
+                            continue
+                    col = e.evaluate_eager(ee)
+                    if key is not None:
+                        core.expr_cache_store(key, col)
+                    columns.append(col)
             return core.columns_from_columns(columns)
 
     def execute_update(self):
@@ -285,6 +305,28 @@ class MixedCSNode(ColumnSetNode):
 
 #===============================================================================
 
+def _expr_colname(expr, dt):
+    """
+    Column name for a single computed-column selection: when the expression
+    is rooted in exactly one source column (e.g. ``bucketize(f.A, ...)``),
+    the result keeps that column's name; otherwise the placeholder "V0" is
+    used as before.
+    """
+    for _ in range(64):
+        if isinstance(expr, ColSelectorExpr):
+            sel = expr.col_index
+            if isinstance(sel, str):
+                return sel
+            if isinstance(sel, int) and -dt.ncols <= sel < dt.ncols:
+                return dt.names[sel]
+            return "V0"
+        arg = getattr(expr, "_arg", None)
+        if not isinstance(arg, BaseExpr):
+            return "V0"
+        expr = arg
+    return "V0"
+
+
 def make_columnset(arg, ee, new_cols_allowed=False):
     """
     Create a :class:`CSNode` object from the provided expression.
@@ -323,7 +365,7 @@ def make_columnset(arg, ee, new_cols_allowed=False):
             return ArrayCSNode(ee, [-1], [arg])
         else:
             assert isinstance(pcol, BaseExpr), "pcol: %r" % (pcol,)
-            return MixedCSNode(ee, [pcol], names=["V0"])
+            return MixedCSNode(ee, [pcol], names=[_expr_colname(pcol, dt)])
 
     if isinstance(arg, (types.GeneratorType, list, tuple)):
         isarray = True
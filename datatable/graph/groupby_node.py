@@ -12,19 +12,23 @@ from datatable.graph.dtproxy import f
 
 class SimpleGroupbyNode:
 
-    def __init__(self, ee, col):
+    def __init__(self, ee, cols):
         self._engine = ee
-        self._col = col
+        self._cols = cols
 
     def execute(self):
         ee = self._engine
         df = ee.dt.internal
-        col = self._col
+        cols = self._cols
         if ee.rowindex:
-            cf = core.columns_from_slice(df, ee.rowindex, col, 1, 1)
+            cf = core.columns_from_slice(df, ee.rowindex, cols[0], 1, 1)
+            for col in cols[1:]:
+                cf.append_columns(
+                    core.columns_from_slice(df, ee.rowindex, col, 1, 1))
             df = cf.to_frame(None).internal
-            col = 0
-        rowindex, groupby = df.sort(col, True)
+            cols = list(range(len(cols)))
+        sortarg = cols[0] if len(cols) == 1 else tuple(cols)
+        rowindex, groupby = df.sort(sortarg, True)
         f.set_rowindex(rowindex)
         ee.set_source_rowindex(rowindex)
         ee.clear_final_rowindex()
@@ -32,7 +36,7 @@ class SimpleGroupbyNode:
             ee.set_final_rowindex(rowindex, ee.rowindex)
         ee.rowindex = rowindex
         ee.groupby = groupby
-        ee.groupby_cols = [self._col]
+        ee.groupby_cols = list(self._cols)
 
 
 
@@ -40,10 +44,12 @@ def make_groupby(grby, ee):
     if grby is None:
         return None
 
-    # TODO: change to ee.make_columnset() when we can do multi-col sorts
-    grbycol = process_column(grby, ee.dt)
-    if not isinstance(grbycol, int):
-        raise TTypeError("Currently only single-column group-bys are "
+    if isinstance(grby, (list, tuple)):
+        grbycols = [process_column(g, ee.dt) for g in grby]
+    else:
+        grbycols = [process_column(grby, ee.dt)]
+    if not all(isinstance(g, int) for g in grbycols):
+        raise TTypeError("Currently only column-based group-bys are "
                          "supported")
 
-    return SimpleGroupbyNode(ee, grbycol)
+    return SimpleGroupbyNode(ee, grbycols)
@@ -4,6 +4,7 @@
 #   License, v. 2.0. If a copy of the MPL was not distributed with this
 #   file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #-------------------------------------------------------------------------------
+import collections
 import os
 import re
 import subprocess
@@ -15,13 +16,19 @@ __all__ = ("llvm", )
 
 
 class Llvm:
-    __slots__ = ["_clang", "_engine", "_binding", "_initialized"]
+    __slots__ = ["_clang", "_engine", "_binding", "_initialized", "_jit_cache"]
+
+    # Maximum number of compiled modules kept in the JIT cache. A module is
+    # just a few compiled functions, so the memory cost of keeping a handful
+    # of them around is negligible compared to the cost of recompiling.
+    JIT_CACHE_MAXSIZE = 64
 
     def __init__(self):
         self._clang = None
         self._engine = None
         self._binding = None
         self._initialized = False
+        self._jit_cache = collections.OrderedDict()
 
 
     #---------------------------------------------------------------------------
@@ -35,10 +42,27 @@ class Llvm:
 
 
     def jit(self, cc, func_names):
+        """
+        Compile C module `cc` and return the addresses of its functions
+        `func_names` (in the same order).
+
+        Compiled modules are cached, keyed on the full text of the module.
+        The generated source completely determines the compiled code -- it is
+        the flattened shape of the expression plus the addresses of the data
+        it reads -- so re-running a query with the same expression skips both
+        the Clang and the MCJIT steps and reuses the previously compiled
+        functions. The cache keeps the `JIT_CACHE_MAXSIZE` most recently used
+        modules, evicting (and unloading) the least recently used one beyond
+        that.
+        """
         self._init_all()
+        cached = self._jit_cache.get(cc)
+        if cached is not None:
+            self._jit_cache.move_to_end(cc)
+            return cached[0]
         try:
             llvmir = self._c_to_llvm(cc)
-            self._compile_llvmir(llvmir)
+            module = self._compile_llvmir(llvmir)
         except RuntimeError as e:
             mm = re.search(r"<stdin>:(\d+):(\d+):\s*(.*)", e.args[0])
             if mm:
@@ -56,7 +80,12 @@ class Llvm:
                 print(cc)
                 print()
             raise e
-        return [self._engine.get_function_address(f) for f in func_names]
+        fnptrs = [self._engine.get_function_address(f) for f in func_names]
+        if len(self._jit_cache) >= Llvm.JIT_CACHE_MAXSIZE:
+            _, (_, old_module) = self._jit_cache.popitem(last=False)
+            self._engine.remove_module(old_module)
+        self._jit_cache[cc] = (fnptrs, module)
+        return fnptrs
 
 
     #---------------------------------------------------------------------------
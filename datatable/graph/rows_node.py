@@ -9,7 +9,8 @@ import types
 import datatable
 from datatable.lib import core
 from .iterator_node import IteratorNode
-from datatable.expr import BaseExpr
+from datatable.expr import BaseExpr, BinaryOpExpr, RelationalOpExpr
+from datatable.expr.binary_expr import binary_op_codes, fusable_stypes
 from datatable.graph.dtproxy import f
 from .context import EvaluationEngine, LlvmEvaluationEngine
 from datatable.types import stype, ltype
@@ -333,8 +334,10 @@ class FilterExprRFNode(RFNode):
             ptr = ee.get_result(self._fnname)
             return core.rowindex_from_filterfn(ptr, nrows)
         else:
-            col = self._expr.evaluate_eager(self._engine)
-            rowindex = core.rowindex_from_column(col)
+            rowindex = self._make_conjunction_rowindex()
+            if rowindex is None:
+                col = self._expr.evaluate_eager(self._engine)
+                rowindex = core.rowindex_from_column(col)
             if self._inverse:
                 rowindex = rowindex.inverse(nrows)
             if ee.rowindex:
@@ -342,6 +345,42 @@ class FilterExprRFNode(RFNode):
             return rowindex
 
 
+    def _make_conjunction_rowindex(self):
+        """
+        Fast path for conjunctive filters such as `(f.a > 0) & (f.b < 5)`.
+
+        If the filter expression is an `&`-chain of simple comparisons over
+        numeric columns, the comparisons are handed to the C level together,
+        where they are evaluated chunk-wise with per-chunk early exit and
+        turned into a RowIndex directly, without materializing any of the
+        intermediate boolean columns. Returns None when the expression does
+        not have this shape (or is a single comparison, for which the fast
+        path saves nothing), leaving the generic path to handle it.
+        """
+        ee = self._engine
+        nrows = ee.dt.nrows
+        if nrows >= (1 << 31):
+            return None
+        conjuncts = []
+        if not _collect_conjuncts(self._expr, conjuncts):
+            return None
+        if len(conjuncts) < 2:
+            return None
+        opcodes = []
+        lhs_cols = []
+        rhs_cols = []
+        for c in conjuncts:
+            lhs = c._lhs.evaluate_eager(ee)
+            rhs = c._rhs.evaluate_eager(ee)
+            if not (lhs.nrows in (1, nrows) and rhs.nrows in (1, nrows)):
+                return None
+            opcodes.append(binary_op_codes[c._op])
+            lhs_cols.append(lhs)
+            rhs_cols.append(rhs)
+        return core.expr_filter_conjunction(opcodes, lhs_cols, rhs_cols,
+                                            nrows)
+
+
     def _make_source_rowindex(self):
         return NotImplemented
 
@@ -382,6 +421,26 @@ class FilterExprRFNode(RFNode):
 
 
 
+def _collect_conjuncts(expr, out):
+    """
+    Decompose `expr` into a list of comparison conjuncts, appending them to
+    `out`. Returns False if `expr` contains anything other than `&`-chains of
+    comparisons between numeric operands, in which case the decomposition is
+    abandoned.
+    """
+    if isinstance(expr, BinaryOpExpr) and expr._op == "&":
+        return (_collect_conjuncts(expr._lhs, out) and
+                _collect_conjuncts(expr._rhs, out))
+    if (isinstance(expr, RelationalOpExpr) and
+            expr._lhs.stype in fusable_stypes and
+            expr._rhs.stype in fusable_stypes):
+        out.append(expr)
+        return True
+    return False
+
+
+
+
 #===============================================================================
 
 class SortedRFNode(RFNode):
@@ -8,6 +8,7 @@ import os
 import re
 
 import datatable as dt
+from datatable.csv import write_csv
 from datatable.lib import core
 # from datatable.fread import Frame
 # from datatable.fread import fread
@@ -23,21 +24,40 @@ def _stringify(x):
     return str(x)
 
 
-@typed(dest=str, format=str, _strategy=str)
-def save(self, dest, format="nff", _strategy="auto"):
+@typed(dest=str, format=str, append=bool, compress=bool, _strategy=str,
+       _rowgroup_size=int)
+def save(self, dest, format="nff", append=False, compress=False,
+         _strategy="auto", _rowgroup_size=0):
     """
     Save Frame in binary NFF/Jay format.
 
     :param dest: destination where the Frame should be saved.
-    :param format: either "nff" or "jay"
+    :param format: one of "nff", "jay" or "feather"
+    :param append: if True (and `format` is "jay"), append the Frame to an
+        already existing Jay file at `dest`, instead of overwriting it. The
+        file must contain a frame with the same column names and types.
+    :param compress: if True (and `format` is "jay"), store the columns'
+        data zlib-compressed, trading some CPU time at save/open for a
+        smaller file. Compressed files cannot be appended to.
     :param _strategy: one of "mmap", "write" or "auto"
+    :param _rowgroup_size: override the default row group size (16M rows)
+        used for recording per-group min/max statistics in a Jay file.
     """
     if _strategy not in ("auto", "write", "mmap"):
         raise TValueError("Invalid parameter _strategy: only 'write' / 'mmap' "
                           "/ 'auto' are allowed")
-    if format not in ("nff", "jay"):
-        raise TValueError("Invalid parameter `format`: only 'nff' or 'jay' "
-                          "are supported")
+    if format not in ("nff", "jay", "feather"):
+        raise TValueError("Invalid parameter `format`: only 'nff', 'jay' or "
+                          "'feather' are supported")
+    if append and format != "jay":
+        raise TValueError("Parameter `append` is only supported for the "
+                          "'jay' format")
+    if compress and format != "jay":
+        raise TValueError("Parameter `compress` is only supported for the "
+                          "'jay' format")
+    if compress and append:
+        raise TValueError("Parameters `compress` and `append` cannot be "
+                          "used together")
     dest = os.path.expanduser(dest)
     if os.path.exists(dest):
         pass
@@ -45,7 +65,15 @@ def save(self, dest, format="nff", _strategy="auto"):
         os.makedirs(dest)
 
     if format == "jay":
-        self.internal.save_jay(dest, self.names, _strategy)
+        if append and os.path.exists(dest):
+            self.internal.save_jay_append(dest, self.names)
+        else:
+            self.internal.save_jay(dest, self.names, _strategy, compress,
+                                   _rowgroup_size)
+        return
+
+    if format == "feather":
+        self.internal.save_feather(dest, self.names, _strategy)
         return
 
     self.materialize()
@@ -75,8 +103,113 @@ def save(self, dest, format="nff", _strategy="auto"):
 
 
 
+@typed(dest=str, format=str, chunksize=int, _strategy=str)
+def save_stream(self, dest, format="csv", chunksize=1000000,
+                _strategy="auto"):
+    """
+    Save the Frame incrementally, in row-range windows of `chunksize` rows.
+
+    Unlike `save()` / `to_csv()`, which materialize the whole frame before
+    writing, this writes one window at a time: each window is a view into
+    the frame, and only that window is ever materialized. This allows
+    exporting frames much larger than the available memory, e.g. a view over
+    a join result, or a lazily-opened Jay file.
+
+    :param dest: destination file.
+    :param format: either "csv" or "jay".
+    :param chunksize: number of rows written per window.
+    """
+    if format not in ("csv", "jay"):
+        raise TValueError("Invalid parameter `format`: only 'csv' or 'jay' "
+                          "are supported")
+    if chunksize <= 0:
+        raise TValueError("Parameter `chunksize` must be positive")
+    dest = os.path.expanduser(dest)
+    first = True
+    for start in range(0, max(self.nrows, 1), chunksize):
+        chunk = self[start : start + chunksize, :]
+        if format == "jay":
+            chunk.save(dest, format="jay", append=not first)
+        else:
+            write_csv(chunk, dest, append=not first, _strategy=_strategy)
+        first = False
+
+
+
 @typed(path=str)
-def open(path):
+def to_shmem(self, name):
+    """
+    Place the frame into a named POSIX shared memory object.
+
+    :param name: the name of the shared memory object, e.g. "/mydata".
+        Creation fails if the name is already in use.
+
+    The frame is serialized in Jay format directly into the shared region.
+    Other processes can then attach to it with :func:`datatable.attach`,
+    all of them mapping a single physical copy of the data. The shared
+    object persists (even after this process exits) until removed with
+    :func:`datatable.shmem_unlink`.
+    """
+    self.internal.save_jay_shmem(name, self.names)
+
+
+def attach(name):
+    """
+    Attach to a frame stored in shared memory by :meth:`Frame.to_shmem`.
+
+    :param name: the name of the shared memory object.
+
+    The returned Frame's columns are read-only views into the shared
+    mapping: no data is copied, regardless of how many processes attach.
+    """
+    return core.open_jay_shmem(name)
+
+
+def shmem_unlink(name):
+    """
+    Remove a shared memory object created by :meth:`Frame.to_shmem`.
+
+    Processes already attached keep their mappings; the memory itself is
+    released once the last of them detaches.
+    """
+    core.shmem_unlink(name)
+
+
+def open_buffer(buf):
+    """
+    Open a Frame from an in-memory buffer with Jay-format data.
+
+    :param buf: a bytes object, or any object supporting the buffer
+        protocol, containing data previously produced by serializing a
+        Frame in Jay format. The buffer is not copied: the columns of the
+        returned Frame reference it directly.
+
+    This function is primarily used by the pickle machinery (see
+    ``Frame.__reduce_ex__``), but can also be called directly.
+    """
+    return core.open_jay_buffer(buf)
+
+
+def open(path, filter=None, columns=None):
+    """
+    Open a previously saved NFF/Jay/Feather frame.
+
+    :param path: the file (Jay or Feather) or directory (NFF) to open.
+    :param filter: optional tuple ``(colname, min, max)``. When opening a Jay
+        file saved with row-group statistics, the row groups whose recorded
+        [min, max] range on `colname` does not intersect [min, max] are
+        skipped entirely; the result contains all rows of the qualifying
+        groups, i.e. a superset of the rows actually matching the predicate.
+        When opening an NFF directory, the frame-level min/max recorded in
+        ``_meta.nff`` are consulted first: if the predicate cannot match at
+        all, a 0-row frame is returned without reading any column data;
+        otherwise only the rows satisfying the predicate are selected, and
+        since the columns are memory-mapped lazily, pages of non-matching
+        rows in the other columns are never read.
+    :param columns: optional list of column names to load; the remaining
+        columns are not even mapped. Only supported for NFF directories
+        and Jay files.
+    """
     path = os.path.expanduser(path)
     if not os.path.exists(path):
         msg = "Path %s does not exist" % path
@@ -84,8 +217,33 @@ def open(path):
             msg += " (current directory = %s)" % os.getcwd()
         raise ValueError(msg)
 
+    if columns is not None:
+        columns = list(columns)
+
     if not os.path.isdir(path):
-        return core.open_jay(path)
+        with _builtin_open(path, "rb") as inp:
+            magic = inp.read(4)
+        if magic == b"FEA1":
+            if filter is not None:
+                raise TValueError("Parameter `filter` is not supported for "
+                                  "Feather files")
+            if columns is not None:
+                raise TValueError("Parameter `columns` is not supported for "
+                                  "Feather files")
+            return core.open_feather(path)
+        if filter is not None:
+            if not (isinstance(filter, tuple) and len(filter) == 3):
+                raise TValueError("Parameter `filter` should be a tuple "
+                                  "(colname, min, max)")
+            res = core.open_jay(path, filter[0],
+                                float(filter[1]), float(filter[2]))
+        else:
+            res = core.open_jay(path)
+        if columns is not None:
+            # The Jay columns materialize lazily, so subsetting here means
+            # the dropped columns' data is never read
+            res = res[:, columns]
+        return res
 
     nff_version = None
     nrows = 0
@@ -120,9 +278,59 @@ def open(path):
     if nff_version > 1:
         coltypes += [None] * 2
     f0 = dt.fread(metafile, sep=",", columns=coltypes)
-    f1 = f0(select=["filename", "stype"])
     colnames = f0["colname"].topython()[0]
+
+    empty_result = False
+    scan_filter = False
+    if filter is not None:
+        if not (isinstance(filter, tuple) and len(filter) == 3):
+            raise TValueError("Parameter `filter` should be a tuple "
+                              "(colname, min, max)")
+        fcol, fmin, fmax = filter
+        if fcol not in colnames:
+            raise TValueError("Filter column `%s` does not exist in the "
+                              "frame" % fcol)
+        if nff_version > 1:
+            # Frame-level zone map: prune the whole load when the recorded
+            # [min, max] of the filter column cannot intersect the predicate
+            icol = colnames.index(fcol)
+            rmin = f0["min"].topython()[0][icol]
+            rmax = f0["max"].topython()[0][icol]
+            if rmin is not None and rmax is not None:
+                try:
+                    if float(rmax) < float(fmin) or float(rmin) > float(fmax):
+                        empty_result = True
+                except (TypeError, ValueError):
+                    pass
+        scan_filter = not empty_result
+
+    loadnames = colnames
+    dropcol = None
+    if columns is not None:
+        badcols = [c for c in columns if c not in colnames]
+        if badcols:
+            raise TValueError("Column `%s` does not exist in the frame"
+                              % badcols[0])
+        loadnames = list(columns)
+        if scan_filter and fcol not in loadnames:
+            # The filter column must be mapped for the scan, but is not part
+            # of the requested result
+            loadnames = loadnames + [fcol]
+            dropcol = fcol
+        rowids = [colnames.index(c) for c in loadnames]
+        f1 = f0[rowids, ["filename", "stype"]]
+        # `datatable_load` walks the colspec columns directly, so the
+        # row-subset view must be materialized first
+        f1.materialize()
+    else:
+        f1 = f0(select=["filename", "stype"])
     df = core.datatable_load(f1.internal, nrows, path, nff_version < 2,
-                             colnames)
+                             loadnames)
     assert df.nrows == nrows, "Wrong number of rows read: %d" % df.nrows
+    if empty_result:
+        return df[slice(0, 0), :]
+    if scan_filter:
+        df = df[(dt.f[fcol] >= fmin) & (dt.f[fcol] <= fmax), :]
+        if dropcol is not None:
+            df = df[:, [c for c in loadnames if c != dropcol]]
     return df
@@ -0,0 +1,265 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+import heapq
+import itertools
+import os
+
+import datatable as dt
+from datatable.graph.dtproxy import f
+from datatable.utils.typechecks import typed, TValueError
+
+__all__ = ("PartitionedFrame",)
+
+
+
+class PartitionedFrame:
+    """
+    A frame larger than memory, stored as an ordered list of Jay files
+    ("partitions") that together form one logical table.
+
+    Each partition is opened lazily through the memory-mapped Jay reader,
+    so only the pages actually touched by an operation become resident;
+    after a partition has been processed its pages are released back to the
+    OS (see ``Frame.release_memory()``). This keeps the peak working set
+    near one partition regardless of the logical frame's size.
+
+    Operations are evaluated partition-wise:
+
+      - :meth:`filter` runs a row selector on each partition and collects
+        the matching rows into an ordinary in-memory Frame;
+      - :meth:`sort` performs an external merge sort: each partition is
+        sorted independently into an on-disk run, and the runs are then
+        merged in bounded-size chunks into a new Jay file;
+      - :meth:`aggregate` computes re-aggregable statistics (sum / count /
+        min / max) per partition and then combines the partial results.
+
+    All partitions must have identical column names and stypes.
+    """
+
+    def __init__(self, paths):
+        if not paths:
+            raise TValueError("At least one partition path is required")
+        self._paths = [os.path.expanduser(p) for p in paths]
+        self._part_nrows = []
+        self._names = None
+        self._stypes = None
+        for path in self._paths:
+            frame = dt.open(path)
+            if self._names is None:
+                self._names = frame.names
+                self._stypes = frame.stypes
+            elif frame.names != self._names or frame.stypes != self._stypes:
+                raise TValueError(
+                    "Partition %s has schema %r, which differs from the "
+                    "first partition's schema %r"
+                    % (path, list(zip(frame.names, frame.stypes)),
+                       list(zip(self._names, self._stypes))))
+            self._part_nrows.append(frame.nrows)
+
+
+    @classmethod
+    @typed(dest=str, nrows_per_partition=int)
+    def from_frame(cls, frame, dest, nrows_per_partition=1000000):
+        """
+        Shard `frame` into Jay partitions of at most `nrows_per_partition`
+        rows each, stored inside the directory `dest`, and return the
+        resulting PartitionedFrame. Each window written is a view into the
+        source frame, so a frame that is itself disk-backed is never fully
+        materialized.
+        """
+        if nrows_per_partition <= 0:
+            raise TValueError("Parameter `nrows_per_partition` must be "
+                              "positive")
+        dest = os.path.expanduser(dest)
+        if not os.path.exists(dest):
+            os.makedirs(dest)
+        paths = []
+        npart = max((frame.nrows + nrows_per_partition - 1) //
+                    nrows_per_partition, 1)
+        ndigits = len(str(npart))
+        for i, start in enumerate(range(0, max(frame.nrows, 1),
+                                        nrows_per_partition)):
+            path = os.path.join(dest, "part%0*d.jay" % (ndigits, i))
+            frame[start : start + nrows_per_partition, :] \
+                .save(path, format="jay")
+            paths.append(path)
+        return cls(paths)
+
+
+    @property
+    def npartitions(self):
+        return len(self._paths)
+
+    @property
+    def paths(self):
+        return list(self._paths)
+
+    @property
+    def nrows(self):
+        return sum(self._part_nrows)
+
+    @property
+    def ncols(self):
+        return len(self._names)
+
+    @property
+    def names(self):
+        return self._names
+
+    @property
+    def stypes(self):
+        return self._stypes
+
+
+    def partition(self, i):
+        """Open and return partition `i` as a (lazily mapped) Frame."""
+        return dt.open(self._paths[i])
+
+
+    def partitions(self):
+        """
+        Yield each partition in turn, releasing the previous partition's
+        resident pages before opening the next one, so that iterating over
+        the whole logical frame keeps roughly one partition in memory.
+        """
+        prev = None
+        for path in self._paths:
+            if prev is not None:
+                prev.release_memory()
+            prev = dt.open(path)
+            yield prev
+        if prev is not None:
+            prev.release_memory()
+
+
+    def filter(self, rows):
+        """
+        Apply the row selector `rows` (anything accepted as the `rows`
+        argument of ``Frame[...]``) to every partition, and return an
+        in-memory Frame with all matching rows, in partition order. The
+        matches are materialized partition by partition, so only the result
+        needs to fit in memory.
+        """
+        parts = []
+        for frame in self.partitions():
+            res = frame[rows, :]
+            if res.nrows:
+                res.materialize()
+                parts.append(res)
+        if not parts:
+            # No matches anywhere: a 0-row frame with the right schema
+            return dt.open(self._paths[0])[slice(0, 0), :]
+        return dt.rbind(*parts)
+
+
+    @typed(by=str, dest=str, chunksize=int)
+    def sort(self, by, dest, chunksize=1000000):
+        """
+        External merge sort by column `by`, writing the fully sorted frame
+        to the Jay file `dest` and returning it as a single-partition
+        PartitionedFrame.
+
+        Pass 1 sorts each partition independently into an on-disk run.
+        Pass 2 streams the runs through an n-way merge: only the key column
+        of each run plus one `chunksize`-row output chunk are held in
+        memory at a time; each chunk is appended to `dest` and the runs'
+        resident pages are released before the next chunk.
+        """
+        if chunksize <= 0:
+            raise TValueError("Parameter `chunksize` must be positive")
+        dest = os.path.expanduser(dest)
+        rundir = dest + ".runs"
+        if not os.path.exists(rundir):
+            os.makedirs(rundir)
+        run_paths = []
+        for i, frame in enumerate(self.partitions()):
+            path = os.path.join(rundir, "run%d.jay" % i)
+            frame.sort(by).save(path, format="jay")
+            run_paths.append(path)
+
+        runs = [dt.open(p) for p in run_paths]
+        # Only the key column is pulled into memory; None (NA) keys sort
+        # first, matching the native sort's NA placement.
+        keys = [run[:, by].topython()[0] for run in runs]
+        wrap = lambda v: (0,) if v is None else (1, v)
+
+        def keygen(i, start):
+            return ((wrap(v), i) for v in keys[i][start:])
+
+        pos = [0] * len(runs)
+        total = sum(len(k) for k in keys)
+        first = True
+        while sum(pos) < total:
+            merged = heapq.merge(*[keygen(i, pos[i])
+                                   for i in range(len(runs))])
+            counts = [0] * len(runs)
+            for _, i in itertools.islice(merged, chunksize):
+                counts[i] += 1
+            chunk_parts = []
+            for i, cnt in enumerate(counts):
+                if cnt:
+                    chunk_parts.append(runs[i][pos[i] : pos[i] + cnt, :])
+                    pos[i] += cnt
+            chunk = chunk_parts[0] if len(chunk_parts) == 1 else \
+                dt.rbind(*chunk_parts)
+            chunk.sort(by).save(dest, format="jay", append=not first)
+            first = False
+            for run in runs:
+                run.release_memory()
+
+        del runs
+        for path in run_paths:
+            os.remove(path)
+        os.rmdir(rundir)
+        return PartitionedFrame([dest])
+
+
+    @typed(by=str, agg=str)
+    def aggregate(self, by, on, agg="sum"):
+        """
+        Grouped aggregation over the whole logical frame, returning an
+        in-memory Frame with one row per group.
+
+        :param by: name of the column to group by.
+        :param on: list of column names to aggregate.
+        :param agg: one of "sum", "count", "min" or "max". Only statistics
+            that can be re-aggregated are supported: each partition
+            produces a partial result, and the partials are then combined
+            (partial counts are summed, partial minima are min-ed, etc).
+        """
+        aggfns = {"sum": dt.sum, "count": dt.count,
+                  "min": dt.min, "max": dt.max}
+        if agg not in aggfns:
+            raise TValueError("Unknown aggregation %r: only %s are "
+                              "re-aggregable across partitions"
+                              % (agg, "/".join(sorted(aggfns))))
+        fn = aggfns[agg]
+        partials = []
+        for frame in self.partitions():
+            p = frame[:, [fn(f[c]) for c in on], by]
+            p.names = [by] + list(on)
+            p.materialize()
+            partials.append(p)
+        combined = partials[0] if len(partials) == 1 else dt.rbind(*partials)
+        refn = dt.sum if agg in ("sum", "count") else fn
+        res = combined[:, [refn(f[c]) for c in on], by]
+        res.names = [by] + list(on)
+        return res
+
+
+    def to_frame(self):
+        """
+        Materialize the whole logical frame in memory as a single Frame.
+        Only feasible when the data actually fits in memory; prefer the
+        partition-wise operations otherwise.
+        """
+        return dt.rbind(*[dt.open(p) for p in self._paths])
+
+
+    def __repr__(self):
+        return ("<PartitionedFrame [%d rows x %d cols] in %d partitions>"
+                % (self.nrows, self.ncols, self.npartitions))
@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+"""
+Uniform progress reporting for long-running operations.
+
+While a chunked kernel (sorting, CSV writing, ...) is running, the C
+extension invokes every registered handler as ``fn(name, fraction)`` at
+most ~10 times per second, where ``name`` is a short operation label
+such as ``"sort"`` or ``"to_csv"``, and ``fraction`` is the share of
+work completed, between 0 and 1. A final call with ``fraction == 1.0``
+is guaranteed for any operation that reported at least once; operations
+that finish quickly report nothing at all.
+
+Multiple handlers may be registered simultaneously, e.g. a console
+progress bar alongside a metrics emitter. Exceptions raised by a
+handler are suppressed: progress display must never break the operation
+it describes.
+
+Note that fread has its own, richer progress protocol (see
+``FRead._progress``) and does not report through this module.
+"""
+from datatable.lib import core
+from datatable.utils.typechecks import TTypeError
+
+__all__ = ("register_progress_handler", "clear_progress_handlers")
+
+
+_handlers = []
+_registered_with_core = False
+
+
+def _dispatch(name, fraction):
+    for fn in _handlers:
+        try:
+            fn(name, fraction)
+        except Exception:
+            pass
+
+
+def register_progress_handler(fn):
+    """
+    Add `fn(name, fraction)` to the list of progress handlers.
+
+    The handler stays registered until `clear_progress_handlers()` is
+    called. Registering the first handler is what enables progress
+    instrumentation in the C extension; with no handlers registered the
+    kernels pay nothing beyond a single branch per chunk.
+    """
+    global _registered_with_core
+    if not callable(fn):
+        raise TTypeError("`fn` argument should be a function")
+    if not _registered_with_core:
+        core.register_function(9, _dispatch)
+        _registered_with_core = True
+    _handlers.append(fn)
+
+
+def clear_progress_handlers():
+    """Remove all registered progress handlers."""
+    _handlers.clear()
@@ -67,6 +67,7 @@ class stype(enum.Enum):
     float64 = 7
     str32 = 11
     str64 = 12
+    cat32 = 16
     obj64 = 21
 
     def __repr__(self):
@@ -202,6 +203,7 @@ _stype_2_short = {
     stype.float64: "r8",
     stype.str32: "s4",
     stype.str64: "s8",
+    stype.cat32: "e4",
     stype.obj64: "o8",
 }
 
@@ -215,6 +217,7 @@ _stype_2_ltype = {
     stype.float64: ltype.real,
     stype.str32: ltype.str,
     stype.str64: ltype.str,
+    stype.cat32: ltype.str,
     stype.obj64: ltype.obj,
 }
 
@@ -228,6 +231,7 @@ _stype_2_ctype = {
     stype.float64: ctypes.c_double,
     stype.str32: ctypes.c_int32,
     stype.str64: ctypes.c_int64,
+    stype.cat32: ctypes.c_int32,
     stype.obj64: ctypes.py_object,
 }
 
@@ -250,6 +254,7 @@ def _init_numpy_transforms():
             stype.float64: np.dtype("float64"),
             stype.str32: np.dtype("object"),
             stype.str64: np.dtype("object"),
+            stype.cat32: np.dtype("object"),
             stype.obj64: np.dtype("object"),
         }
         _init_value2members_from([
@@ -277,6 +282,7 @@ _stype_2_struct = {
     stype.float64: "=d",
     stype.str32: "=i",
     stype.str64: "=q",
+    stype.cat32: "=i",
     stype.obj64: "O",
 }
 
@@ -271,6 +271,9 @@ def get_extra_link_args():
 
     flags += ["-fopenmp"]
 
+    # zlib, used for reading gzip-compressed input directly
+    flags += ["-lz"]
+
     # Omit all symbol information from the output
     # ld warns that this option is obsolete and is ignored. However with this
     # option the size of the executable is ~25% smaller...
@@ -0,0 +1,80 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+#
+# Test one-hot and label encoding of string columns
+#
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+from datatable import stype
+from datatable.extras.encode import onehot, label_encode
+
+
+#-------------------------------------------------------------------------------
+# One-hot encoding
+#-------------------------------------------------------------------------------
+
+def test_onehot_simple():
+    d_in = dt.Frame(["red", "blue", "green", "blue", "red"])
+    d_out = onehot(d_in)
+    d_out.internal.check()
+    assert d_out.shape == (5, 3)
+    assert d_out.names == ("blue", "green", "red")
+    assert d_out.stypes == (stype.bool8,) * 3
+    assert d_out.topython() == [[0, 1, 0, 1, 0],
+                                [0, 0, 1, 0, 0],
+                                [1, 0, 0, 0, 1]]
+
+
+def test_onehot_nas():
+    d_in = dt.Frame([None, "a", None, "b", "a"])
+    d_out = onehot(d_in)
+    d_out.internal.check()
+    assert d_out.names == ("a", "b")
+    assert d_out.topython() == [[0, 1, 0, 0, 1],
+                                [0, 0, 0, 1, 0]]
+
+
+def test_onehot_single_value():
+    d_in = dt.Frame(["x"] * 7)
+    d_out = onehot(d_in)
+    d_out.internal.check()
+    assert d_out.shape == (7, 1)
+    assert d_out.topython() == [[1] * 7]
+
+
+def test_onehot_bad_input():
+    with pytest.raises(ValueError):
+        onehot(dt.Frame([["a"], ["b"]]))
+    with pytest.raises(TypeError):
+        onehot(dt.Frame([1, 2, 3]))
+
+
+#-------------------------------------------------------------------------------
+# Label encoding
+#-------------------------------------------------------------------------------
+
+def test_label_encode_simple():
+    d_in = dt.Frame(["red", "blue", "green", "blue", "red"])
+    d_codes, d_cats = label_encode(d_in)
+    d_codes.internal.check()
+    d_cats.internal.check()
+    assert d_codes.shape == (5, 1)
+    assert d_codes.names == ("code",)
+    assert d_codes.stypes == (stype.int32,)
+    assert d_codes.topython() == [[2, 0, 1, 0, 2]]
+    assert d_cats.names == ("category",)
+    assert d_cats.topython() == [["blue", "green", "red"]]
+
+
+def test_label_encode_nas():
+    d_in = dt.Frame(["b", None, "a", None, "b"])
+    d_codes, d_cats = label_encode(d_in)
+    d_codes.internal.check()
+    d_cats.internal.check()
+    assert d_codes.topython() == [[1, None, 0, None, 1]]
+    assert d_cats.topython() == [["a", "b"]]
@@ -0,0 +1,57 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+#
+# Test linear-model scoring over frame columns
+#
+#-------------------------------------------------------------------------------
+import math
+import pytest
+import datatable as dt
+from datatable import stype
+from datatable.extras.score import score_linear
+
+
+def test_score_numeric():
+    d_in = dt.Frame([[1, 2, 3], [0.5, -1.0, 2.5]])
+    d_out = score_linear(d_in, [2.0, 4.0], intercept=1.0)
+    d_out.internal.check()
+    assert d_out.shape == (3, 1)
+    assert d_out.names == ("score",)
+    assert d_out.stypes == (stype.float64,)
+    assert d_out.topython() == [[5.0, 1.0, 17.0]]
+
+
+def test_score_nas():
+    d_in = dt.Frame([[1, None, 3]])
+    d_out = score_linear(d_in, [10.0])
+    d_out.internal.check()
+    assert d_out.topython() == [[10.0, 0.0, 30.0]]
+
+
+def test_score_sigmoid():
+    d_in = dt.Frame([[0, 1]])
+    d_out = score_linear(d_in, [1.0], sigmoid=True)
+    d_out.internal.check()
+    res = d_out.topython()[0]
+    assert res[0] == 0.5
+    assert abs(res[1] - 1.0 / (1.0 + math.exp(-1.0))) < 1e-12
+
+
+def test_score_strings_hashed():
+    d_in = dt.Frame([["a", "b", "a", None]])
+    d_out = score_linear(d_in, [1.0, 2.0, 3.0])
+    d_out.internal.check()
+    res = d_out.topython()[0]
+    # same value hashes to the same weight; NA contributes nothing
+    assert res[0] == res[2]
+    assert res[3] == 0.0
+    assert all(r in (1.0, 2.0, 3.0) for r in res[:3])
+
+
+def test_score_bad_weights():
+    with pytest.raises(ValueError):
+        score_linear(dt.Frame([[1], [2]]), [1.0])
@@ -372,6 +372,30 @@ def test_fread_from_glob(tempfile):
             os.remove(f)
 
 
+def test_fread_from_glob_rbind(tempfile):
+    base, ext = os.path.splitext(tempfile)
+    if not ext:
+        ext = ".csv"
+    pattern = base + "*" + ext
+    tempfiles = ["".join([base, str(i), ext]) for i in range(5)]
+    try:
+        for j in range(5):
+            with open(tempfiles[j], "w") as f:
+                # In shard 3 column B becomes a string: with rbind=True the
+                # column types are reconciled by the normal promotion rules
+                f.write("A,B\n%d,%s\n" % (j, "foo" if j == 3 else str(j)))
+        df = dt.fread(pattern, rbind=True)
+        assert isinstance(df, dt.Frame)
+        df.internal.check()
+        assert df.names == ("A", "B")
+        assert df.shape == (5, 2)
+        assert df.topython() == [[0, 1, 2, 3, 4],
+                                 ["0", "1", "2", "foo", "4"]]
+    finally:
+        for f in tempfiles:
+            os.remove(f)
+
+
 
 
 #-------------------------------------------------------------------------------
@@ -902,9 +926,10 @@ def test_fillna0():
 
 
 def test_fillna1():
-    src = ("Row,bool8,int32,int64,float32x,float64,float64+,float64x,str\n"
+    src = ("Row,bool8,int32,int64,float32x,float64,float64+,float64x,"
+           "date,timestamp,str\n"
            "1,True,1234,1234567890987654321,0x1.123p-03,2.3,-inf,"
-           "0x1.123456789abp+100,the end\n"
+           "0x1.123456789abp+100,2018-01-02,2018-01-02 03:04:05,the end\n"
            "2\n"
            "3\n"
            "4\n"
@@ -912,7 +937,7 @@ def test_fillna1():
     d = dt.fread(text=src, fill=True)
     d.internal.check()
     p = d[1:, 1:].topython()
-    assert p == [[None] * 4] * 8
+    assert p == [[None] * 4] * 10
 
 
 def test_fillna_and_skipblanklines():
@@ -977,3 +1002,41 @@ def test_anonymize2(capsys):
         assert "Column 1 (aaaaaa aaaa)" in out
     finally:
         dt.options.fread.anonymize = False
+
+
+def test_fread_read_report():
+    from datatable.fread import GenericReader
+    reader = GenericReader(text="A,B,C\n1,foo,3.5\n2,bar,0.1\n3,baz,-7\n")
+    assert reader.read_report is None
+    f0 = reader.read()
+    assert f0.shape == (3, 3)
+    report = reader.read_report
+    assert isinstance(report, dict)
+    assert report["nrows"] == 3
+    assert report["ncols"] == 3
+    assert report["input_size"] > 0
+    assert report["nthreads"] >= 1
+    assert report["nchunks"] >= 1
+    assert report["nreallocs"] >= 0
+    assert report["ntype_bumps"] == 0
+    assert report["ncols_reread"] == 0
+    assert report["time_total"] > 0
+    assert 0 <= report["thread_busy_fraction"] <= 1
+    assert report["read_speed"] > 0
+    assert set(report["phases"]) == {
+        "open_input", "detect_parse_parameters", "detect_column_types",
+        "allocate_frame", "read_data", "reread_data", "create_frame"}
+    assert all(t >= 0 for t in report["phases"].values())
+    assert report["messages"] == []
+
+
+def test_fread_read_report_type_bumps():
+    from datatable.fread import GenericReader
+    src = "A\n" + "3\n" * 200 + "elephant\n"
+    reader = GenericReader(text=src)
+    f0 = reader.read()
+    assert f0.shape == (201, 1)
+    report = reader.read_report
+    assert report["ntype_bumps"] >= 1
+    assert report["ncols_reread"] >= 1
+    assert any("bumped" in msg for msg in report["messages"])
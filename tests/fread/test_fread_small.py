@@ -376,6 +376,38 @@ def test_invalid_float_numbers():
     assert d0.topython() == [["."], ["+."], [".e"], [".e+"], ["0e"], ["e-3"]]
 
 
+def test_date_iso():
+    d0 = dt.fread("A\n1970-01-01\n2018-03-14\n1969-12-31\n2000-02-29\n")
+    d0.internal.check()
+    assert d0.ltypes == (ltype.int, )
+    assert d0.topython() == [[0, 1520985600, -86400, 951782400]]
+
+
+def test_date_iso_invalid():
+    # Invalid calendar dates must not be recognized as dates
+    d0 = dt.fread("A,B,C\n2018-02-29,2018-13-01,2018-01-32\n")
+    d0.internal.check()
+    assert d0.topython() == [["2018-02-29"], ["2018-13-01"], ["2018-01-32"]]
+
+
+def test_timestamp_iso():
+    d0 = dt.fread("A,B,C,D\n"
+                  "1970-01-01 00:00:01,2018-03-14T12:34:56,"
+                  "2018-03-14 12:34:56Z,2018-03-14 12:34:56+02:30\n")
+    d0.internal.check()
+    assert d0.ltypes == (ltype.int, ) * 4
+    t = 1521030896  # 2018-03-14 12:34:56 UTC
+    assert d0.topython() == [[1], [t], [t], [t - 2 * 3600 - 30 * 60]]
+
+
+def test_timestamp_iso_fractional():
+    # A nonzero fractional part cannot be stored in integer seconds, so such
+    # columns should be read as strings; an all-zero fraction is allowed.
+    d0 = dt.fread("A,B\n2018-03-14 12:34:56.5,2018-03-14 12:34:56.000\n")
+    d0.internal.check()
+    assert d0.topython() == [["2018-03-14 12:34:56.5"], [1521030896]]
+
+
 
 #-------------------------------------------------------------------------------
 # Tiny files
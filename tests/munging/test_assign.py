@@ -70,3 +70,21 @@ def test_assign_frame():
     f0["A"] = f1[:10, :]
     assert f0.names == ("A",)
     assert f0.ltypes == (dt.ltype.real,)
+
+
+def test_assign_string_filtered():
+    f0 = dt.Frame({"A": list(range(5)),
+                   "B": ["foo", "bar", "baz", None, "quux"]})
+    f0[f.A == 1, "B"] = "gar"
+    f0.internal.check()
+    assert f0.topython()[1] == ["foo", "gar", "baz", None, "quux"]
+    f0[f.A >= 3, "B"] = "lengthier"
+    f0.internal.check()
+    assert f0.topython()[1] == ["foo", "gar", "baz", "lengthier", "lengthier"]
+
+
+def test_assign_string_single_cell():
+    f0 = dt.Frame({"B": ["aloha", "bye", "ciao"]})
+    f0[1, 0] = "hello"
+    f0.internal.check()
+    assert f0.topython() == [["aloha", "hello", "ciao"]]
@@ -363,3 +363,59 @@ def test_rbind_modulefn():
     f3 = dt.rbind(f0, f1)
     f3.internal.check()
     assert f3.topython()[0] == f0.topython()[0] + f1.topython()[0]
+
+
+def test_rbind_str64_demotion():
+    # A str64 operand promotes the result, but when the combined string data
+    # still fits within 32-bit offsets the result is compacted back to str32.
+    f0 = dt.Frame(["alpha", "beta"])
+    f1 = dt.Frame(["gamma", None], stype=dt.str64)
+    f0.rbind(f1)
+    f0.internal.check()
+    assert f0.stypes == (dt.str32,)
+    assert f0.topython() == [["alpha", "beta", "gamma", None]]
+
+
+#-------------------------------------------------------------------------------
+# Snapshots of a frame under continuous appends
+#-------------------------------------------------------------------------------
+
+def test_snapshot_isolated_from_rbind():
+    f0 = dt.Frame(A=[1, 2, 3], B=["a", "b", "c"])
+    snap = f0.snapshot()
+    f0.rbind(dt.Frame(A=[4, 5], B=["d", "e"]))
+    f0.rbind(dt.Frame(A=[6], B=[None]))
+    f0.internal.check()
+    snap.internal.check()
+    # The snapshot still sees the data as of the moment it was taken
+    assert snap.shape == (3, 2)
+    assert snap.topython() == [[1, 2, 3], ["a", "b", "c"]]
+    assert f0.topython() == [[1, 2, 3, 4, 5, 6],
+                             ["a", "b", "c", "d", "e", None]]
+
+
+def test_snapshot_with_reserved_capacity():
+    # Appends within reserved capacity normally extend the buffer in-place;
+    # a live snapshot must force them onto the reallocating path instead.
+    f0 = dt.Frame(A=list(range(100)))
+    f0.reserve(1000)
+    snaps = []
+    for i in range(10):
+        snaps.append(f0.snapshot())
+        f0.rbind(dt.Frame(A=list(range(100 * (i + 1), 100 * (i + 2)))))
+    f0.internal.check()
+    for i, snap in enumerate(snaps):
+        snap.internal.check()
+        assert snap.nrows == 100 * (i + 1)
+        assert snap.topython() == [list(range(100 * (i + 1)))]
+    assert f0.topython() == [list(range(1100))]
+
+
+def test_snapshot_of_view():
+    f0 = dt.Frame(A=[5, 7, 1, 9, 3])
+    f1 = f0[::2, :]
+    snap = f1.snapshot()
+    f1.rbind(dt.Frame(A=[0]))
+    snap.internal.check()
+    assert snap.topython() == [[5, 1, 3]]
+    assert f1.topython() == [[5, 1, 3, 0]]
@@ -4,6 +4,7 @@
 #   License, v. 2.0. If a copy of the MPL was not distributed with this
 #   file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #-------------------------------------------------------------------------------
+import random
 import pytest
 import datatable as dt
 from datatable import stype, ltype, f
@@ -704,6 +705,72 @@ def test_chained_array(dt0):
 
 
 
+#-------------------------------------------------------------------------------
+# Range (between) filters
+#-------------------------------------------------------------------------------
+
+def test_rows_range_int(df1):
+    dt1 = df1[(f.A >= 2) & (f.A < 7), :]
+    dt1.internal.check()
+    assert dt1.names == df1.names
+    assert dt1.topython() == [[2, 3, 4, 5, 6],
+                              [1, 3, 4, 0, 2]]
+
+
+def test_rows_range_real(df1):
+    dt1 = df1[(f.B > 1.5) & (f.B <= 4), :]
+    dt1.internal.check()
+    assert dt1.topython() == [[0, 1, 3, 4, 6],
+                              [3, 2, 3, 4, 2]]
+
+
+def test_rows_range_fractional_bounds(df1):
+    # Fractional bounds on an integer column must round inward.
+    dt1 = df1[(f.A > 1.5) & (f.A < 6.5), :]
+    dt1.internal.check()
+    assert dt1.topython() == [[2, 3, 4, 5, 6],
+                              [1, 3, 4, 0, 2]]
+
+
+def test_rows_range_empty(df1):
+    dt1 = df1[(f.A >= 5) & (f.A < 5), :]
+    dt1.internal.check()
+    assert dt1.shape == (0, 2)
+
+
+def test_rows_range_with_extra_condition(df1):
+    dt1 = df1[(f.A >= 1) & (f.A <= 8) & (f.B > 2), :]
+    dt1.internal.check()
+    assert dt1.topython() == [[3, 4], [3, 4]]
+
+
+def test_rows_range_on_sorted_column():
+    df0 = dt.Frame(A=[None] * 3 + list(range(100)))
+    # Warming the sort cache marks the column as sorted, which lets a pure
+    # range filter be answered with a binary search producing a slice.
+    df0.sort("A")
+    dt1 = df0[(f.A >= 20) & (f.A < 50), :]
+    dt1.internal.check()
+    assert is_slice(dt1)
+    assert dt1.topython() == [list(range(20, 50))]
+
+
+@pytest.mark.parametrize("seed", [random.getrandbits(32)])
+def test_rows_range_random(seed):
+    random.seed(seed)
+    n = 1000
+    src = [random.choice([None, None, random.randint(-50, 50)])
+           for _ in range(n)]
+    df0 = dt.Frame(A=src)
+    lo = random.randint(-60, 40)
+    hi = lo + random.randint(0, 50)
+    dt1 = df0[(f.A >= lo) & (f.A < hi), :]
+    dt1.internal.check()
+    assert dt1.topython() == [[x for x in src
+                               if x is not None and lo <= x < hi]]
+
+
+
 #-------------------------------------------------------------------------------
 # Others
 #-------------------------------------------------------------------------------
@@ -0,0 +1,78 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+
+
+
+def test_replace_int():
+    f0 = dt.Frame([[-999, 1, 2, -999, 3]])
+    f0.replace({-999: None, 2: 20})
+    f0.internal.check()
+    assert f0.topython() == [[None, 1, 20, None, 3]]
+
+
+def test_replace_simultaneous():
+    f0 = dt.Frame([[0, 1, 0, 1, 2]])
+    f0.replace({0: 1, 1: 0})
+    f0.internal.check()
+    assert f0.topython() == [[1, 0, 1, 0, 2]]
+
+
+def test_replace_na_rule():
+    f0 = dt.Frame([[1, None, 3, None]])
+    f0.replace({None: 0})
+    f0.internal.check()
+    assert f0.topython() == [[1, 0, 3, 0]]
+
+
+def test_replace_real():
+    f0 = dt.Frame([[1.5, 2.0, -1.0, None]])
+    f0.replace({1.5: 0.0, None: -9.0})
+    f0.internal.check()
+    assert f0.topython() == [[0.0, 2.0, -1.0, -9.0]]
+
+
+def test_replace_wide_int_domain():
+    # Match values too spread out for the lookup table => hash-based path
+    f0 = dt.Frame([[0, 10**6, 5, 10**6, 7]])
+    f0.replace({10**6: -1, 5: 55})
+    f0.internal.check()
+    assert f0.topython() == [[0, -1, 55, -1, 7]]
+
+
+def test_replace_multiple_columns():
+    f0 = dt.Frame([[1, 2, 3], [1.0, 2.0, 3.0], ["a", "b", "c"]])
+    f0.replace({2: 0})
+    f0.internal.check()
+    assert f0.topython() == [[1, 0, 3], [1.0, 0.0, 3.0], ["a", "b", "c"]]
+
+
+def test_replace_skips_nonrepresentable():
+    # 0.5 is not representable as an int, so the int column is unaffected
+    f0 = dt.Frame([[0, 1, 2]])
+    f0.replace({0.5: 9})
+    f0.internal.check()
+    assert f0.topython() == [[0, 1, 2]]
+
+
+def test_replace_bad_arguments():
+    f0 = dt.Frame([[1, 2, 3]])
+    with pytest.raises(TypeError):
+        f0.replace([(1, 2)])
+    with pytest.raises(TypeError):
+        f0.replace({"a": 1})
+
+
+def test_replace_large(numpy):
+    n = 100000
+    a = numpy.arange(n) % 100
+    f0 = dt.Frame(a)
+    f0.replace({7: -7, 11: -11})
+    f0.internal.check()
+    expected = [-x if x in (7, 11) else x for x in a.tolist()]
+    assert f0.topython()[0] == expected
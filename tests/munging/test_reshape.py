@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+#
+# Test melt / pivot reshaping
+#
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+from datatable import stype
+
+
+#-------------------------------------------------------------------------------
+# Melt
+#-------------------------------------------------------------------------------
+
+def test_melt_simple():
+    d0 = dt.Frame({"a": [1, 2], "b": [3.5, 4.5]})
+    d1 = d0.melt()
+    d1.internal.check()
+    assert d1.shape == (4, 2)
+    assert d1.names == ("variable", "value")
+    assert d1.stypes[1] == stype.float64
+    assert d1.topython() == [["a", "a", "b", "b"],
+                             [1.0, 2.0, 3.5, 4.5]]
+
+
+def test_melt_with_ids():
+    d0 = dt.Frame({"id": ["x", "y"], "u": [1, 2], "v": [3, 4]})
+    d1 = d0.melt(nid=1)
+    d1.internal.check()
+    assert d1.shape == (4, 3)
+    assert d1.names == ("id", "variable", "value")
+    assert d1.topython() == [["x", "y", "x", "y"],
+                             ["u", "u", "v", "v"],
+                             [1.0, 2.0, 3.0, 4.0]]
+
+
+def test_melt_nas():
+    d0 = dt.Frame({"a": [1, None, 3]})
+    d1 = d0.melt()
+    d1.internal.check()
+    assert d1.topython() == [["a", "a", "a"], [1.0, None, 3.0]]
+
+
+def test_melt_bad_input():
+    with pytest.raises(TypeError):
+        dt.Frame({"a": ["s", "t"]}).melt()
+    with pytest.raises(ValueError):
+        dt.Frame({"a": [1]}).melt(nid=1)
+
+
+#-------------------------------------------------------------------------------
+# Pivot
+#-------------------------------------------------------------------------------
+
+def test_pivot_simple():
+    d0 = dt.Frame({"id": [1, 1, 2, 2],
+                   "var": ["a", "b", "a", "b"],
+                   "val": [1.0, 2.0, 3.0, 4.0]})
+    d1 = d0.pivot()
+    d1.internal.check()
+    assert d1.shape == (2, 3)
+    assert d1.names == ("id", "a", "b")
+    assert d1.topython() == [[1, 2], [1.0, 3.0], [2.0, 4.0]]
+
+
+def test_pivot_missing_cells():
+    d0 = dt.Frame({"id": [1, 2], "var": ["a", "b"], "val": [5, 7]})
+    d1 = d0.pivot()
+    d1.internal.check()
+    assert d1.topython() == [[1, 2], [5.0, None], [None, 7.0]]
+
+
+def test_pivot_na_variable():
+    d0 = dt.Frame({"id": [1, 1], "var": ["a", None], "val": [5, 7]})
+    d1 = d0.pivot()
+    d1.internal.check()
+    assert d1.names == ("id", "a")
+    assert d1.topython() == [[1], [5.0]]
+
+
+def test_pivot_roundtrip():
+    d0 = dt.Frame({"id": [10, 20, 30], "x": [1, 2, 3], "y": [4, 5, 6]})
+    d1 = d0.melt(nid=1).pivot()
+    d1.internal.check()
+    assert d1.names == ("id", "x", "y")
+    assert d1.topython() == [[10, 20, 30],
+                             [1.0, 2.0, 3.0],
+                             [4.0, 5.0, 6.0]]
+
+
+def test_pivot_bad_input():
+    with pytest.raises(ValueError):
+        dt.Frame({"a": [1]}).pivot()
+    with pytest.raises(TypeError):
+        dt.Frame({"id": [1], "var": [2], "val": [3]}).pivot()
+
+
+#-------------------------------------------------------------------------------
+# Cross join
+#-------------------------------------------------------------------------------
+
+def test_cross_join_simple():
+    d0 = dt.Frame({"a": [1, 2]})
+    d1 = dt.Frame({"b": ["x", "y", "z"]})
+    d2 = d0.cross_join(d1)
+    d2.internal.check()
+    assert d2.shape == (6, 2)
+    assert d2.names == ("a", "b")
+    assert d2.topython() == [[1, 1, 1, 2, 2, 2],
+                             ["x", "y", "z", "x", "y", "z"]]
+
+
+def test_cross_join_multicol():
+    d0 = dt.Frame({"a": [1, 2], "b": [0.5, 1.5]})
+    d1 = dt.Frame({"c": [True, False]})
+    d2 = d0.cross_join(d1)
+    d2.internal.check()
+    assert d2.names == ("a", "b", "c")
+    assert d2.topython() == [[1, 1, 2, 2],
+                             [0.5, 0.5, 1.5, 1.5],
+                             [True, False, True, False]]
+
+
+def test_cross_join_empty():
+    d0 = dt.Frame({"a": [1, 2]})
+    d1 = dt.Frame({"b": []})
+    d2 = d0.cross_join(d1)
+    d2.internal.check()
+    assert d2.shape == (0, 2)
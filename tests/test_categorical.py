@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+#
+# Test dictionary-encoded categorical columns
+#
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+from datatable import stype
+
+
+def test_categorize_simple():
+    d0 = dt.Frame({"a": ["red", "blue", "red", "green", "blue", "red"]})
+    d0.categorize()
+    d0.internal.check()
+    assert d0.stypes == (stype.cat32,)
+    assert d0.topython() == [["red", "blue", "red", "green", "blue", "red"]]
+
+
+def test_categorize_nas():
+    d0 = dt.Frame({"a": ["x", None, "y", None, "x"]})
+    d0.categorize()
+    d0.internal.check()
+    assert d0.stypes == (stype.cat32,)
+    assert d0.topython() == [["x", None, "y", None, "x"]]
+
+
+def test_categorize_single_column():
+    d0 = dt.Frame({"a": ["u", "v"], "b": ["p", "q"], "n": [1, 2]})
+    d0.categorize("b")
+    d0.internal.check()
+    assert d0.stypes == (stype.str32, stype.cat32, stype.int8)
+    assert d0.topython() == [["u", "v"], ["p", "q"], [1, 2]]
+
+
+def test_categorize_all_skips_nonstrings():
+    d0 = dt.Frame({"s": ["a", "b"], "n": [1.5, 2.5]})
+    d0.categorize()
+    d0.internal.check()
+    assert d0.stypes == (stype.cat32, stype.float64)
+
+
+def test_categorize_empty():
+    d0 = dt.Frame({"a": ["x", "y"]})[:0, :]
+    d0.categorize("a")
+    d0.internal.check()
+    assert d0.stypes == (stype.cat32,)
+    assert d0.topython() == [[]]
+
+
+def test_categorize_bad_input():
+    d0 = dt.Frame({"n": [1, 2, 3]})
+    with pytest.raises(TypeError):
+        d0.categorize("n")
+
+
+def test_categorical_sort():
+    d0 = dt.Frame({"a": ["pear", "apple", None, "fig", "apple"]})
+    d0.categorize()
+    d1 = d0.sort("a")
+    d1.internal.check()
+    assert d1.topython() == [[None, "apple", "apple", "fig", "pear"]]
+
+
+def test_categorical_roundtrip_order():
+    # Codes are assigned in ascending string order, so sorting a categorical
+    # column must agree with sorting the original strings.
+    src = ["delta", "alpha", "charlie", "bravo", "alpha", "delta"]
+    d0 = dt.Frame({"a": list(src)})
+    d1 = dt.Frame({"a": list(src)})
+    d1.categorize()
+    assert d0.sort("a").topython() == d1.sort("a").topython()
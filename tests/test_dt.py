@@ -1017,3 +1017,90 @@ def test_issue898():
     f1.materialize()
     res = f1.topython()
     del res
+
+
+def test_materialize_str64_demotion():
+    f0 = dt.Frame(["one", "two", "three", None, "five"], stype=dt.stype.str64)
+    f1 = f0[::2, :]
+    f1.materialize()
+    f1.internal.check()
+    assert f1.stypes == (dt.stype.str32,)
+    assert f1.topython() == [["one", "three", "five"]]
+
+
+def test_memory_footprint():
+    f0 = dt.Frame([[1, 2, 3, 4, 5],
+                   ["red", "orange", "yellow", "green", "blue"]],
+                  names=["A", "B"])
+    info = f0.memory_footprint()
+    assert set(info) == {"columns", "rowindex", "total"}
+    assert info["rowindex"] == 0
+    assert info["total"] > 0
+    cols = info["columns"]
+    assert [c["name"] for c in cols] == ["A", "B"]
+    for c in cols:
+        assert c["footprint"] > 0
+        assert c["data"]["size"] > 0
+        assert 0 <= c["data"]["resident"] <= c["data"]["size"]
+        assert isinstance(c["data"]["type"], str)
+        assert c["data"]["shared"] is False
+    assert cols[0]["strdata"] is None
+    assert cols[1]["strdata"]["size"] == sum(
+        len(x) for x in ["red", "orange", "yellow", "green", "blue"])
+    # A column-subset frame shares its buffers copy-on-write
+    f1 = f0[:, ["A", "B"]]
+    info1 = f1.memory_footprint()
+    assert all(c["data"]["shared"] is True for c in info1["columns"])
+    # A view frame reports the rowindex overhead
+    f2 = f0[::2, :]
+    info2 = f2.memory_footprint()
+    assert info2["rowindex"] > 0
+
+
+def test_mmap_budget(tempdir):
+    import os
+    # With a tiny budget, opening and reading several disk-backed frames
+    # forces the manager to evict cold mappings between accesses; the data
+    # must still read back correctly after transparent remapping.
+    paths = [os.path.join(tempdir, "f%d.jay" % i) for i in range(4)]
+    srcs = [list(range(i * 1000, i * 1000 + 5000)) for i in range(4)]
+    for path, src in zip(paths, srcs):
+        dt.Frame({"A": src}).save(path, format="jay")
+    dt.options.memory.mmap_budget = 4096
+    try:
+        frames = [dt.open(p) for p in paths]
+        for _ in range(3):
+            for frame, src in zip(frames, srcs):
+                assert frame.sum().topython() == [[sum(src)]]
+    finally:
+        dt.options.memory.mmap_budget = 0
+
+
+def test_explain():
+    f0 = dt.Frame([[1, 5, 3, 2, 4], [2, 2, 1, 1, 2]], names=["A", "B"])
+    # Slice selector: zero-copy fast path
+    rep = f0.explain((slice(None, 3), slice(None)))
+    assert set(rep) == {"rows", "columns", "groupby", "join", "engine",
+                        "source_nrows", "estimated_nrows", "result_nrows",
+                        "result_ncols", "result_is_view", "result"}
+    assert rep["rows"] == "slice rowindex (zero-copy)"
+    assert rep["columns"] == "all columns (copied by reference)"
+    assert rep["groupby"] is None
+    assert rep["join"] is None
+    assert rep["source_nrows"] == 5
+    assert rep["estimated_nrows"] == rep["result_nrows"] == 3
+    assert rep["result_is_view"] is True
+    assert rep["result"].topython() == [[1, 5, 3], [2, 2, 1]]
+    # Expression filter: slow path producing a materialized index array
+    rep = f0.explain((f.A > 2, slice(None)))
+    assert rep["rows"] == "expression filter (parallel scan)"
+    assert rep["result_nrows"] == 3
+    # Groupby requires a sort pass
+    rep = f0.explain((slice(None), "A", "B"))
+    assert rep["groupby"] == "sort on columns ['B']"
+    assert rep["rows"] == "all rows (no filtering)"
+    # Explain cannot be used for in-place modification
+    with pytest.raises(ValueError):
+        make_datatable = dt.graph.make_datatable
+        make_datatable(f0, *dt.graph.resolve_selector("A"),
+                       mode="delete", explain=True)
@@ -355,3 +355,257 @@ def test_div_mod(seed):
         [None if src2[i] == 0 else src1[i] // src2[i] for i in range(n)],
         [None if src2[i] == 0 else src1[i] % src2[i] for i in range(n)]
     ]
+
+
+
+#-------------------------------------------------------------------------------
+# ifelse
+#-------------------------------------------------------------------------------
+
+def test_ifelse_simple():
+    df0 = dt.Frame(A=[1, 5, 12, 3, 7, 14])
+    df1 = df0[:, dt.ifelse(f.A < 10, f.A, 0)]
+    df1.internal.check()
+    assert df1.topython() == [[1, 5, 0, 3, 7, 0]]
+
+
+def test_ifelse_na_condition():
+    df0 = dt.Frame(A=[True, False, None], B=[1, 2, 3], C=[4, 5, 6])
+    df1 = df0[:, dt.ifelse(f.A, f.B, f.C)]
+    assert df1.topython() == [[1, 5, None]]
+
+
+def test_ifelse_promotes_types():
+    df0 = dt.Frame(A=[1, -2, 3], B=[0.5, 2.5, -1.5])
+    df1 = df0[:, dt.ifelse(f.A > 0, f.A, f.B)]
+    assert df1.stypes == (dt.float64, )
+    assert df1.topython() == [[1.0, 2.5, 3.0]]
+
+
+def test_ifelse_strings():
+    df0 = dt.Frame(A=[1, 2, None, 4])
+    df1 = df0[:, dt.ifelse(f.A > 2, "big", "small")]
+    assert df1.topython() == [["small", "small", None, "big"]]
+
+
+def test_ifelse_string_columns():
+    df0 = dt.Frame(A=[True, False, None, True],
+                   B=["aa", "bb", "cc", None],
+                   C=["x", "y", "z", "w"])
+    df1 = df0[:, dt.ifelse(f.A, f.B, f.C)]
+    assert df1.topython() == [["aa", "y", None, None]]
+
+
+def test_ifelse_bad_condition():
+    df0 = dt.Frame(A=[1, 2, 3])
+    with pytest.raises(TypeError) as e:
+        df0[:, dt.ifelse(f.A, f.A, 0)]
+    assert "condition in ifelse() must be a boolean" in str(e.value)
+
+
+@pytest.mark.parametrize("seed", [random.getrandbits(63)])
+def test_ifelse_random(seed):
+    random.seed(seed)
+    n = 1000
+    src1 = [random.randint(-100, 100) for _ in range(n)]
+    src2 = [random.random() for _ in range(n)]
+
+    df0 = dt.Frame(x=src1, y=src2)
+    df1 = df0[:, dt.ifelse(f.x >= 0, f.x, f.y)]
+    assert df1.topython() == [
+        [src1[i] if src1[i] >= 0 else src2[i] for i in range(n)]
+    ]
+
+
+
+#-------------------------------------------------------------------------------
+# shift
+#-------------------------------------------------------------------------------
+
+def test_shift_lag():
+    df0 = dt.Frame(A=[3, 1, 4, 1, 5])
+    df1 = df0[:, dt.shift(f.A)]
+    df1.internal.check()
+    assert df1.topython() == [[None, 3, 1, 4, 1]]
+
+
+def test_shift_lead():
+    df0 = dt.Frame(A=[3, 1, 4, 1, 5])
+    df1 = df0[:, dt.shift(f.A, -2)]
+    assert df1.topython() == [[4, 1, 5, None, None]]
+
+
+def test_shift_strings():
+    df0 = dt.Frame(A=["a", "b", None, "d"])
+    df1 = df0[:, dt.shift(f.A)]
+    assert df1.topython() == [[None, "a", "b", None]]
+
+
+def test_shift_grouped():
+    df0 = dt.Frame(A=["x", "y", "x", "y", "x"], B=[1, 2, 3, 4, 5])
+    df1 = df0[:, dt.shift(f.B), "A"]
+    df1.internal.check()
+    assert df1.topython() == [["x", "x", "x", "y", "y"],
+                              [None, 1, 3, None, 2]]
+
+
+def test_shift_of_view():
+    df0 = dt.Frame(A=list(range(10)))
+    df1 = df0[::2, :]
+    df2 = df1[:, dt.shift(f.A)]
+    assert df2.topython() == [[None, 0, 2, 4, 6]]
+
+
+
+#-------------------------------------------------------------------------------
+# round / clip / bucketize
+#-------------------------------------------------------------------------------
+
+def test_round():
+    df0 = dt.Frame(A=[0.4, 2.5, -1.2, None, 7.5])
+    df1 = df0[:, dt.round(f.A)]
+    df1.internal.check()
+    # rounding is half-to-even, same as python's round()
+    assert df1.topython() == [[0.0, 2.0, -1.0, None, 8.0]]
+
+
+def test_floor_ceil():
+    df0 = dt.Frame(A=[0.4, 2.5, -1.2, None])
+    df1 = df0[:, [dt.floor(f.A), dt.ceil(f.A)]]
+    assert df1.topython() == [[0.0, 2.0, -2.0, None],
+                              [1.0, 3.0, -1.0, None]]
+
+
+def test_round_int_is_identity():
+    df0 = dt.Frame(A=[3, -7, None, 12])
+    df1 = df0[:, dt.round(f.A)]
+    assert df1.stypes == df0.stypes
+    assert df1.topython() == df0.topython()
+
+
+def test_clip_int():
+    df0 = dt.Frame(A=[-5, 0, 3, None, 100])
+    df1 = df0[:, dt.clip(f.A, 0, 10)]
+    df1.internal.check()
+    assert df1.stypes == df0.stypes
+    assert df1.topython() == [[0, 0, 3, None, 10]]
+
+
+def test_clip_one_sided():
+    df0 = dt.Frame(A=[-1.5, 0.25, 3.75, None])
+    df1 = df0[:, [dt.clip(f.A, lower=0), dt.clip(f.A, upper=1)]]
+    assert df1.topython() == [[0.0, 0.25, 3.75, None],
+                              [-1.5, 0.25, 1.0, None]]
+
+
+def test_clip_fractional_bounds_on_ints():
+    # an integer column clipped to [1.5, 7.5] can only contain 2 .. 7
+    df0 = dt.Frame(A=[0, 1, 2, 7, 8])
+    df1 = df0[:, dt.clip(f.A, 1.5, 7.5)]
+    assert df1.topython() == [[2, 2, 2, 7, 7]]
+
+
+def test_bucketize():
+    df0 = dt.Frame(A=[0.0, 0.99, 1.0, 4.5, 9.99, None])
+    df1 = df0[:, dt.bucketize(f.A, 10, 0, 10)]
+    df1.internal.check()
+    assert df1.stypes == (dt.stype.int32, )
+    assert df1.topython() == [[0, 0, 1, 4, 9, None]]
+
+
+def test_bucketize_clamps_out_of_range():
+    df0 = dt.Frame(A=[-100, 0, 5, 10, 100])
+    df1 = df0[:, dt.bucketize(f.A, 5, 0, 10)]
+    assert df1.topython() == [[0, 0, 2, 4, 4]]
+
+
+def test_bucketize_histogram():
+    random.seed(12345)
+    src = [random.random() * 10 for _ in range(1000)]
+    df0 = dt.Frame(A=src)
+    # bucket indices are groupby-ready small ints: a histogram is just
+    # count() grouped over the bucketized column
+    df1 = df0[:, dt.bucketize(f.A, 5, 0, 10)]
+    df2 = df1[:, dt.count(), "A"]
+    counts = [0] * 5
+    for x in src:
+        counts[min(int(x / 2), 4)] += 1
+    assert df2.topython() == [list(range(5)), counts]
+
+
+
+#-------------------------------------------------------------------------------
+# fillna
+#-------------------------------------------------------------------------------
+
+def test_fillna_const():
+    df0 = dt.Frame(A=[1, None, 3, None, 5])
+    df1 = df0[:, dt.fillna(f.A, 0)]
+    df1.internal.check()
+    assert df1.topython() == [[1, 0, 3, 0, 5]]
+
+
+def test_fillna_const_promotes():
+    df0 = dt.Frame(A=[1, None, 3])
+    df1 = df0[:, dt.fillna(f.A, 0.5)]
+    assert df1.stypes == (dt.stype.float64, )
+    assert df1.topython() == [[1.0, 0.5, 3.0]]
+
+
+def test_fillna_forward():
+    df0 = dt.Frame(A=[None, 1, None, None, 4, None])
+    df1 = df0[:, dt.fillna(f.A, method="forward")]
+    df1.internal.check()
+    assert df1.topython() == [[None, 1, 1, 1, 4, 4]]
+
+
+def test_fillna_backward():
+    df0 = dt.Frame(A=[None, 1, None, None, 4, None])
+    df1 = df0[:, dt.fillna(f.A, method="backward")]
+    assert df1.topython() == [[1, 1, 4, 4, 4, None]]
+
+
+def test_fillna_forward_strings():
+    df0 = dt.Frame(A=["a", None, None, "d", None])
+    df1 = df0[:, dt.fillna(f.A, method="forward")]
+    assert df1.topython() == [["a", "a", "a", "d", "d"]]
+
+
+def test_fillna_forward_grouped():
+    df0 = dt.Frame(A=["x", "y", "x", "y", "x"], B=[1, None, None, 4, None])
+    df1 = df0[:, dt.fillna(f.B, method="forward"), "A"]
+    df1.internal.check()
+    assert df1.topython() == [["x", "x", "x", "y", "y"],
+                              [1, 1, 1, None, 4]]
+
+
+def test_fillna_of_view():
+    df0 = dt.Frame(A=[1, None, None, 4, None, 6])
+    df1 = df0[::2, :]
+    df2 = df1[:, dt.fillna(f.A, method="forward")]
+    assert df2.topython() == [[1, 1, 1]]
+
+
+def test_fillna_bad_args():
+    df0 = dt.Frame(A=[1, None, 3])
+    with pytest.raises(ValueError):
+        df0[:, dt.fillna(f.A)]
+    with pytest.raises(ValueError):
+        df0[:, dt.fillna(f.A, 0, method="forward")]
+    with pytest.raises(ValueError):
+        df0[:, dt.fillna(f.A, method="sideways")]
+
+
+def test_fillna_forward_large():
+    random.seed(8877)
+    src = [random.randint(1, 100) if random.random() < 0.2 else None
+           for _ in range(100000)]
+    df0 = dt.Frame(A=src)
+    df1 = df0[:, dt.fillna(f.A, method="forward")]
+    expected = []
+    last = None
+    for x in src:
+        if x is not None:
+            last = x
+        expected.append(last)
+    assert df1.topython() == [expected]
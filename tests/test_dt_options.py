@@ -13,10 +13,11 @@ def test_options_all():
     # Update this test every time a new option is added
     assert repr(dt.options).startswith("<datatable.options.DtConfig:")
     assert set(dir(dt.options)) == {
-        "nthreads", "core_logger", "sort", "display", "frame", "fread"}
+        "nthreads", "core_logger", "thread_affinity", "sort", "display",
+        "frame", "fread", "memory", "view", "jay", "perf"}
     assert set(dir(dt.options.sort)) == {
         "insert_method_threshold", "thread_multiplier", "max_chunk_length",
-        "max_radix_bits", "over_radix_bits", "nthreads"}
+        "max_radix_bits", "over_radix_bits", "nthreads", "spill_threshold"}
     assert set(dir(dt.options.display)) == {"interactive_hint"}
     assert set(dir(dt.options.frame)) == {
         "names_auto_index", "names_auto_prefix"}
@@ -170,3 +171,131 @@ def test_frame_names_auto_prefix():
     assert f2.names == ("C0", "C1", "C2", "C3")
     with pytest.raises(TypeError):
         dt.options.frame.names_auto_prefix = 0
+
+
+@pytest.mark.run(order=1014)
+def test_view_materialize_async():
+    assert dt.options.view.materialize_async is False
+    dt.options.view.materialize_async = True
+    try:
+        f0 = dt.Frame([[5, 7, 1, 9, 3], ["a", "b", "c", "d", "e"]])
+        f1 = f0[::2, :]
+        f1.internal.check()
+        assert f1.topython() == [[5, 1, 3], ["a", "c", "e"]]
+        # Materializing must give the same data whether the background
+        # task finished, is in flight, or was never started.
+        f1.materialize()
+        f1.internal.check()
+        assert f1.topython() == [[5, 1, 3], ["a", "c", "e"]]
+    finally:
+        del dt.options.view.materialize_async
+    assert dt.options.view.materialize_async is False
+
+
+@pytest.mark.run(order=1015)
+def test_perf_track():
+    from datatable.lib import core
+    assert dt.options.perf.track is False
+    dt.options.perf.track = True
+    try:
+        core.perf_reset()
+        f0 = dt.Frame([5, 7, 1, 9, 3])
+        f0.sort(0)
+        records = core.perf_records()
+        assert any(r["op"] == "sort" for r in records)
+        for r in records:
+            assert set(r) == {"op", "seq", "time_ns", "bytes",
+                              "cache_misses", "branch_misses",
+                              "busy_total_ns", "busy_max_ns", "imbalance",
+                              "nthreads", "nchunks"}
+            assert r["busy_total_ns"] >= r["busy_max_ns"] >= 0
+            assert r["imbalance"] >= 0.0
+            assert r["time_ns"] >= 0
+        # Records are returned oldest first
+        seqs = [r["seq"] for r in records]
+        assert seqs == sorted(seqs)
+        core.perf_reset()
+        assert core.perf_records() == []
+    finally:
+        del dt.options.perf.track
+    assert dt.options.perf.track is False
+    # With tracking off, no records are collected
+    dt.Frame([2, 1, 3]).sort(0)
+    assert core.perf_records() == []
+
+
+@pytest.mark.run(order=1016)
+def test_perf_hw_counters():
+    from datatable.lib import core
+    assert dt.options.perf.hw_counters is False
+    dt.options.perf.track = True
+    dt.options.perf.hw_counters = True
+    try:
+        core.perf_reset()
+        dt.Frame([5, 7, 1, 9, 3]).sort(0)
+        records = core.perf_records()
+        assert records
+        for r in records:
+            # -1 when perf_event is unavailable (non-Linux, restricted VM)
+            assert isinstance(r["cache_misses"], int)
+            assert isinstance(r["branch_misses"], int)
+            assert r["cache_misses"] >= -1
+            assert r["branch_misses"] >= -1
+        core.perf_reset()
+    finally:
+        del dt.options.perf.hw_counters
+        del dt.options.perf.track
+
+
+@pytest.mark.run(order=1017)
+def test_memory_alloc_trace():
+    from datatable.lib import core
+    assert dt.options.memory.alloc_trace is False
+    dt.options.memory.alloc_trace = True
+    try:
+        core.alloc_stats_reset()
+        f0 = dt.Frame([[4, 2, 9, 1, 7] * 100, list("abcde") * 100])
+        f0.sort(0)
+        stats = core.alloc_stats()
+        assert set(stats) == {"current", "peak", "nallocs", "allocated",
+                              "histogram", "by_tag"}
+        assert stats["nallocs"] > 0
+        assert stats["peak"] >= stats["current"]
+        assert stats["allocated"] > 0
+        assert sum(stats["histogram"].values()) == stats["nallocs"]
+        # Allocations made inside the sort kernel are attributed to it
+        assert "sort" in stats["by_tag"]
+        nallocs, nbytes = stats["by_tag"]["sort"]
+        assert nallocs > 0 and nbytes > 0
+        core.alloc_stats_reset()
+        assert core.alloc_stats()["nallocs"] == 0
+    finally:
+        del dt.options.memory.alloc_trace
+    assert dt.options.memory.alloc_trace is False
+
+
+@pytest.mark.run(order=1018)
+def test_view_materialization():
+    assert dt.options.view.materialization == "lazy"
+    f0 = dt.Frame([[5, 7, 1, 9, 3] * 2000, list("abcde") * 2000])
+    assert f0[::2, :].internal.isview
+    dt.options.view.materialization = "eager"
+    try:
+        f1 = f0[::2, :]
+        f1.internal.check()
+        assert not f1.internal.isview
+        assert f1.nrows == 5000
+        dt.options.view.materialization = "auto"
+        # Small selections are materialized...
+        assert not f0[:100, :].internal.isview
+        # ...and so are highly selective ones
+        assert not f0[::8, :].internal.isview
+        # Large low-selectivity slices stay lazy
+        assert f0[::2, :].internal.isview
+        with pytest.raises(ValueError) as e:
+            dt.options.view.materialization = "sometimes"
+        assert "must be one of" in str(e.value)
+    finally:
+        del dt.options.view.materialization
+    assert dt.options.view.materialization == "lazy"
+    assert f0[::2, :].internal.isview
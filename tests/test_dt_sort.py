@@ -668,3 +668,126 @@ def test_strXX_large6(st):
     dt1 = dt0(sort=0)
     dt1.internal.check()
     assert dt1.topython()[0] == sorted(words)
+
+
+@pytest.mark.parametrize("st", [dt.str32, dt.str64])
+def test_strXX_shortkeys(st):
+    # All strings at most 8 characters: exercises the inline fixed-width
+    # key path in the sorter (no indirections into the string data).
+    src = ["%s%d" % (w, i % 37)
+           for i in range(500)
+           for w in ["a", "zz", "foo", "quux", ""]] + \
+          [None, "", "zzzzzzzz", "zzzzzzz", "\x01\x02"] * 3
+    d0 = dt.Frame(src, stype=st)
+    assert d0.stypes == (st, )
+    d1 = d0.sort(0)
+    d1.internal.check()
+    nnas = src.count(None)
+    res = sorted(s for s in src if s is not None)
+    assert d1.topython() == [[None] * nnas + res]
+
+
+@pytest.mark.parametrize("st", [dt.str32, dt.str64])
+def test_sort_strings_case_insensitive(st):
+    src = ["Banana", "apple", "Apple", "cherry", None, "BANANA", "apricot"]
+    d0 = dt.Frame(src, stype=st)
+    d1 = d0.sort(0, case_insensitive=True)
+    d1.internal.check()
+    assert d1.topython() == [[None, "apple", "Apple", "apricot",
+                              "Banana", "BANANA", "cherry"]]
+
+
+def test_sort_case_insensitive_long_strings():
+    # Strings longer than 8 bytes exercise the multi-pass radix path and
+    # its insertion-sort tails, not just the inline short-key encoding.
+    src = ["CaseFolding_%03d_%s" % (i % 7, c)
+           for i in range(200)
+           for c in ["x", "X", "y"]] + [None, "ZEBRA", "zebra", "Zebra"]
+    d0 = dt.Frame(src)
+    d1 = d0.sort(0, case_insensitive=True)
+    d1.internal.check()
+    res = d1.topython()[0]
+    assert res[0] is None
+    lowered = [s.lower() for s in res[1:]]
+    assert lowered == sorted(lowered)
+
+
+def test_sort_case_insensitive_nonstring():
+    d0 = dt.Frame([3, 1, 2])
+    with pytest.raises(TypeError):
+        d0.sort(0, case_insensitive=True)
+
+
+#-------------------------------------------------------------------------------
+# Sorted merge
+#-------------------------------------------------------------------------------
+
+def test_merge_sorted_ints():
+    random.seed(20180830)
+    parts = [sorted(random.randint(-1000, 1000) for _ in range(n))
+             for n in (100, 37, 0, 256)]
+    frames = [dt.Frame(A=p) for p in parts]
+    d0 = dt.merge_sorted("A", *frames)
+    d0.internal.check()
+    assert d0.names == ("A", )
+    assert d0.topython() == [sorted(sum(parts, []))]
+    # The inputs are not modified
+    for frame, p in zip(frames, parts):
+        assert frame.topython() == [p]
+
+
+def test_merge_sorted_multicolumn():
+    f0 = dt.Frame(A=[1, 5, 5, 9], B=["a", "b", "c", "d"])
+    f1 = dt.Frame(A=[None, 5, 7], B=["e", "f", "g"])
+    d0 = dt.merge_sorted("A", f0, f1)
+    d0.internal.check()
+    assert d0.topython() == [[None, 1, 5, 5, 5, 7, 9],
+                             ["e", "a", "b", "c", "f", "g", "d"]]
+
+
+@pytest.mark.parametrize("st", [dt.str32, dt.str64])
+def test_merge_sorted_strings(st):
+    src0 = [None, "apple", "banana", "cherry"]
+    src1 = ["almond", "blueberry", "date"]
+    d0 = dt.merge_sorted("A", dt.Frame(A=src0, stype=st),
+                              dt.Frame(A=src1, stype=st))
+    d0.internal.check()
+    assert d0.topython() == [[None, "almond", "apple", "banana", "blueberry",
+                              "cherry", "date"]]
+
+
+def test_merge_sorted_promotes_types():
+    f0 = dt.Frame(A=[True, True, False][::-1])
+    f1 = dt.Frame(A=[-5, 0, 8], stype=dt.int32)
+    d0 = dt.merge_sorted("A", f1, f0)
+    d0.internal.check()
+    assert d0.stypes == (dt.int32, )
+    assert d0.topython() == [[-5, 0, 0, 1, 1, 8]]
+
+
+def test_merge_sorted_large():
+    random.seed(77)
+    parts = [sorted(random.getrandbits(30) for _ in range(40000))
+             for _ in range(5)]
+    d0 = dt.merge_sorted("A", *[dt.Frame(A=p) for p in parts])
+    d0.internal.check()
+    assert d0.nrows == 200000
+    assert d0.topython() == [sorted(sum(parts, []))]
+
+
+def test_merge_sorted_bad():
+    with pytest.raises(ValueError) as e:
+        dt.merge_sorted("A")
+    assert "At least one Frame is required" in str(e.value)
+
+    with pytest.raises(ValueError) as e:
+        dt.merge_sorted("A", dt.Frame(A=[1, 2]), dt.Frame(B=[3]))
+    assert "different column names" in str(e.value)
+
+    with pytest.raises(ValueError) as e:
+        dt.merge_sorted("X", dt.Frame(A=[1, 2]))
+    assert "Column `X` does not exist" in str(e.value)
+
+    with pytest.raises(ValueError) as e:
+        dt.merge_sorted("A", dt.Frame(A=[1, 2, 3]), dt.Frame(A=[5, 4]))
+    assert "Frame 1 is not sorted by column 0" in str(e.value)
@@ -69,10 +69,26 @@ def test_min(src):
 
 
 def test_dt_str():
-    dt0 = dt.Frame([[1, 5, 3, 9, -2], list("abcde")])
+    dt0 = dt.Frame([[1, 5, 3, 9, -2], list("edcba")])
     dtr = dt0.min()
     dtr.internal.check()
-    assert dtr.topython() == [[-2], [None]]
+    assert dtr.topython() == [[-2], ["a"]]
+
+
+@pytest.mark.parametrize("src", srcs_str)
+def test_dt_str_minmax(src):
+    if isinstance(src, tuple):
+        dt0 = dt.Frame(src[1], stype=src[0])
+        src = src[1]
+    else:
+        dt0 = dt.Frame(src)
+    vals = [v for v in src if v is not None]
+    exp_min = min(vals) if vals else None
+    exp_max = max(vals) if vals else None
+    assert dt0.min().topython() == [[exp_min]]
+    assert dt0.max().topython() == [[exp_max]]
+    assert dt0.min1() == exp_min
+    assert dt0.max1() == exp_max
 
 
 
@@ -466,3 +482,31 @@ def test_stats_string_large(seed):
     assert dt0.countna1() == 0
     assert dt0.nunique1() == n_unique(a)
     # assert dt0.mode1() in t_mode(a)[1]
+
+
+#-------------------------------------------------------------------------------
+# Incremental stats across rbind
+#-------------------------------------------------------------------------------
+
+def test_stats_after_rbind():
+    dt0 = dt.Frame([1, 5, 3, 9])
+    assert dt0.sum().topython() == [[18]]
+    assert dt0.min().topython() == [[1]]
+    dt0.rbind(dt.Frame([7, None, 0]))
+    dt0.internal.check()
+    assert dt0.sum().topython() == [[25]]
+    assert dt0.min().topython() == [[0]]
+    assert dt0.max().topython() == [[9]]
+    assert dt0.countna().topython() == [[1]]
+    assert list_equals(dt0.mean().topython(), [[25 / 6]])
+
+
+def test_stats_after_rbind_moments(numpy):
+    a = numpy.random.random(size=1000)
+    b = numpy.random.random(size=337)
+    dt0 = dt.Frame(a)
+    dt0.sd()  # force stats computation before the append
+    dt0.rbind(dt.Frame(b))
+    c = numpy.concatenate([a, b])
+    assert list_equals(dt0.mean().topython(), [[c.mean()]])
+    assert list_equals(dt0.sd().topython(), [[c.std(ddof=1)]])
@@ -26,6 +26,20 @@ def test_groups_internal1():
     assert gby.group_offsets == [0, 1, 3, 7, 8, 10]
 
 
+def test_groups_stats_frame():
+    d0 = dt.Frame({"A": [2, 7, 2, 3, 7, 2, 2, 0, None, 0],
+                   "B": [5, 1, 0, 3, 2, 4, 6, -1, 7, 3]})
+    ri, gby = d0.internal.sort(0, True)
+    res = gby.stats_frame(d0.internal, ri, "sum")
+    assert res.shape == (5, 2)
+    # group order: None, 0, 2, 3, 7
+    assert res.topython() == [[0, 0, 8, 3, 14], [7, 2, 15, 3, 3]]
+    res2 = gby.stats_frame(d0.internal, ri, "countna")
+    assert res2.topython() == [[1, 0, 0, 0, 0], [0, 0, 0, 0, 0]]
+    with pytest.raises(ValueError):
+        gby.stats_frame(d0.internal, ri, "frobnicate")
+
+
 def test_groups_internal2():
     d0 = dt.DataTable([[1,   5,   3,   2,   1,    3,   1,   1,   None],
                        ["a", "b", "c", "a", None, "f", "b", "h", "d"]],
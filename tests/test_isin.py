@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+
+
+
+def test_isin_simple():
+    d0 = dt.Frame({"A": [3, 1, 4, 1, 5, 9, 2, 6, None, 3]})
+    d1 = d0.isin("A", [1, 3, 9])
+    d1.internal.check()
+    assert d1.topython() == [[3, 1, 1, 9, 3]]
+
+
+def test_isin_invert():
+    d0 = dt.Frame({"A": [3, 1, 4, 1, 5, 9, 2, 6, None, 3]})
+    d1 = d0.isin("A", [1, 3, 9], invert=True)
+    assert d1.topython() == [[4, 5, 2, 6, None]]
+
+
+def test_isin_none_value():
+    d0 = dt.Frame({"A": [3, None, 4, None]})
+    d1 = d0.isin("A", [None, 4])
+    assert d1.topython() == [[None, 4, None]]
+
+
+def test_isin_wide_range():
+    # Values too spread out for the bitset representation.
+    big = 10**12
+    d0 = dt.Frame({"A": [0, big, 5, -big, 17]})
+    d1 = d0.isin("A", [0, big, -big])
+    assert d1.topython() == [[0, big, -big]]
+
+
+def test_isin_strings():
+    d0 = dt.Frame({"A": ["a", "b", None, "c", "bb"]})
+    d1 = d0.isin("A", ["b", "c", "x"])
+    assert d1.topython() == [["b", "c"]]
+
+
+def test_isin_real():
+    d0 = dt.Frame({"A": [1.5, 2.5, None, 3.5]})
+    d1 = d0.isin("A", [2.5, 3.5])
+    assert d1.topython() == [[2.5, 3.5]]
+
+
+def test_isin_keeps_other_columns():
+    d0 = dt.Frame({"A": [1, 2, 3, 4], "B": ["w", "x", "y", "z"]})
+    d1 = d0.isin("A", [2, 4])
+    assert d1.names == ("A", "B")
+    assert d1.topython() == [[2, 4], ["x", "z"]]
+
+
+def test_isin_empty_values():
+    d0 = dt.Frame({"A": [1, 2, 3]})
+    d1 = d0.isin("A", [])
+    assert d1.shape == (0, 1)
+    d2 = d0.isin("A", [], invert=True)
+    assert d2.topython() == [[1, 2, 3]]
+
+
+@pytest.mark.parametrize("nvalues", [5, 200])
+def test_isin_large(nvalues):
+    n = 100000
+    src = [i % 997 for i in range(n)]
+    values = list(range(0, nvalues * 3, 3))
+    d0 = dt.Frame({"A": src})
+    d1 = d0.isin("A", values)
+    vset = set(values)
+    assert d1.topython() == [[x for x in src if x in vset]]
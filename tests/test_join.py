@@ -120,3 +120,52 @@ def test_join_update():
     assert d0.topython() == [[1, 2, 3, 2, 3, 1, 3, 2, 2, 1],
                              [0, 1, 2, 3, 4, 5, 6, 7, 8, 9],
                              [b, a, 4, a, 4, b, 4, a, a, b]]
+
+
+#-------------------------------------------------------------------------------
+# Key maintenance under rbind
+#-------------------------------------------------------------------------------
+
+def test_keyed_frame_rbind():
+    d1 = dt.Frame(A=[3, 1, 2], V=["three", "one", "two"])
+    d1.key = "A"
+    assert d1.topython() == [[1, 2, 3], ["one", "two", "three"]]
+    d1.rbind(dt.Frame(A=[5, 0], V=["five", "zero"]))
+    d1.internal.check()
+    # The key survives the append, and the frame is re-sorted by it
+    assert d1.key == ("A", )
+    assert d1.topython() == [[0, 1, 2, 3, 5],
+                             ["zero", "one", "two", "three", "five"]]
+    # The maintained key keeps working for joins
+    d0 = dt.Frame(A=[5, 1, 0])
+    res = d0[:, :, join(d1)]
+    res.internal.check()
+    assert res.topython() == [[5, 1, 0], ["five", "one", "zero"]]
+
+
+def test_keyed_frame_rbind_duplicates():
+    d1 = dt.Frame(A=[1, 2, 3], V=[10, 20, 30])
+    d1.key = "A"
+    with pytest.raises(ValueError) as e:
+        d1.rbind(dt.Frame(A=[4, 2], V=[40, 50]))
+    assert "duplicate keys" in str(e.value)
+    # The data was appended, but the frame is no longer keyed
+    d1.internal.check()
+    assert d1.key == ()
+    assert d1.nrows == 5
+
+
+def test_keyed_frame_rbind_many():
+    random.seed(3891)
+    d1 = dt.Frame(A=[], V=[], stypes={"A": dt.int32, "V": dt.int32})
+    d1.key = "A"
+    keys = list(range(10000))
+    random.shuffle(keys)
+    for i in range(0, 10000, 1000):
+        chunk = sorted(keys[i:i + 1000])
+        random.shuffle(chunk)
+        d1.rbind(dt.Frame(A=chunk, V=[k * 7 for k in chunk]))
+    d1.internal.check()
+    assert d1.key == ("A", )
+    assert d1.topython() == [list(range(10000)),
+                             [k * 7 for k in range(10000)]]
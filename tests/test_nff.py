@@ -86,6 +86,39 @@ def test_save_view(tempdir):
     assert dt2.topython() == dt1.topython()
 
 
+def test_open_columns(tempdir):
+    dt0 = dt.Frame({"A": [1, 2, 3, 4],
+                    "B": ["red", "green", "blue", None],
+                    "C": [0.5, 1.5, 2.5, 3.5]})
+    dt0.save(tempdir)
+    d1 = dt.open(tempdir, columns=["C", "A"])
+    d1.internal.check()
+    assert d1.names == ("C", "A")
+    assert d1.topython() == [[0.5, 1.5, 2.5, 3.5], [1, 2, 3, 4]]
+    with pytest.raises(dt.ValueError) as e:
+        dt.open(tempdir, columns=["A", "X"])
+    assert "Column `X` does not exist in the frame" in str(e.value)
+
+
+def test_open_filter(tempdir):
+    dt0 = dt.Frame({"A": [3, 7, 1, 9, 4, 5],
+                    "B": list("abcdef")})
+    dt0.save(tempdir)
+    # Predicate overlapping the recorded [min, max]: scan + select
+    d1 = dt.open(tempdir, filter=("A", 4, 7))
+    d1.internal.check()
+    assert d1.names == ("A", "B")
+    assert d1.topython() == [[7, 4, 5], ["b", "e", "f"]]
+    # Predicate outside the recorded [min, max]: pruned without a scan
+    d2 = dt.open(tempdir, filter=("A", 100, 200))
+    assert d2.shape == (0, 2)
+    assert d2.names == ("A", "B")
+    # Filter column not among the requested columns
+    d3 = dt.open(tempdir, filter=("A", 4, 7), columns=["B"])
+    assert d3.names == ("B",)
+    assert d3.topython() == [["b", "e", "f"]]
+
+
 
 #-------------------------------------------------------------------------------
 # Jay format
@@ -198,3 +231,211 @@ def test_jay_keys(tempfile):
     d1 = dt.open(tempfile)
     assert d1.key == ("x",)
     assert_equals(d0, d1)
+
+
+def test_jay_append(tempfile):
+    d0 = dt.Frame({"A": [1, 7, 100, 12],
+                   "B": [True, None, False, None],
+                   "C": ["alpha", "beta", None, "delta"]})
+    d1 = dt.Frame({"A": [-5, None],
+                   "B": [None, True],
+                   "C": ["epsilon", None]})
+    d0.save(tempfile, format="jay")
+    d1.save(tempfile, format="jay", append=True)
+    d1.save(tempfile, format="jay", append=True)
+    d2 = dt.open(tempfile)
+    d2.internal.check()
+    dall = dt.Frame({"A": [1, 7, 100, 12, -5, None, -5, None],
+                     "B": [True, None, False, None, None, True, None, True],
+                     "C": ["alpha", "beta", None, "delta",
+                           "epsilon", None, "epsilon", None]})
+    assert_equals(d2, dall)
+
+
+def test_jay_stats(tempfile):
+    d0 = dt.Frame({"A": [3, 1, 4, 1, 5, 9, 2, 6],
+                   "B": [2.7, 1.8, 2.8, None, 1.8, 2.8, 4.5, 9.0]})
+    # Force calculation of the stats, so that they get saved into Jay
+    d0.min(), d0.max(), d0.mean(), d0.sd(), d0.sum()
+    d0.save(tempfile, format="jay")
+    d1 = dt.open(tempfile)
+    assert d1.countna().topython() == d0.countna().topython()
+    assert d1.min().topython() == d0.min().topython()
+    assert d1.max().topython() == d0.max().topython()
+    assert d1.sum().topython() == d0.sum().topython()
+    assert d1.mean().topython() == d0.mean().topython()
+    assert d1.sd().topython() == d0.sd().topython()
+
+
+def test_jay_compressed(tempfile):
+    d0 = dt.Frame({"A": list(range(10000)),
+                   "B": [x / 7 for x in range(10000)],
+                   "C": ["spam", "ham", "eggs", None] * 2500})
+    d0.save(tempfile, format="jay")
+    plain_size = os.stat(tempfile).st_size
+    d0.save(tempfile, format="jay", compress=True)
+    assert os.stat(tempfile).st_size < plain_size
+    d1 = dt.open(tempfile)
+    d1.internal.check()
+    assert_equals(d0, d1)
+
+
+def test_jay_checksum_compressed(tempfile):
+    d0 = dt.Frame({"A": list(range(10000))})
+    d0.save(tempfile, format="jay", compress=True)
+    with open(tempfile, "r+b") as out:
+        out.seek(100)
+        out.write(b"\xDE\xAD\xBE\xEF")
+    # Corruption is detected lazily: opening the file succeeds, the error
+    # surfaces when the column's data is first accessed
+    d1 = dt.open(tempfile)
+    with pytest.raises(IOError) as e:
+        d1.topython()
+    assert "truncated or corrupted" in str(e.value)
+
+
+def test_jay_checksum_plain(tempfile):
+    d0 = dt.Frame({"A": list(range(10000))})
+    d0.save(tempfile, format="jay")
+    with open(tempfile, "r+b") as out:
+        out.seek(100)
+        out.write(b"\xDE\xAD\xBE\xEF")
+    # By default plain columns are zero-copy views and are not verified...
+    d1 = dt.open(tempfile)
+    assert d1.topython() != d0.topython()
+    # ...but with jay.verify_checksums enabled they are copied out of the
+    # file on first access, and the corruption is caught
+    dt.options.jay.verify_checksums = True
+    try:
+        d2 = dt.open(tempfile)
+        with pytest.raises(IOError) as e:
+            d2.topython()
+        assert "truncated or corrupted" in str(e.value)
+    finally:
+        dt.options.jay.verify_checksums = False
+
+
+def test_jay_sequential_paths(tempdir):
+    d0 = dt.Frame({"A": list(range(10000)),
+                   "B": ["v%d" % (i % 17) for i in range(10000)]})
+    path = os.path.join(tempdir, "data.jay")
+    d0.save(path, format="jay")
+    # Mark the directory as sequential-only storage: the file is then
+    # staged into anonymous memory instead of being mapped directly
+    dt.options.memory.sequential_paths = tempdir
+    try:
+        d1 = dt.open(path)
+        d1.internal.check()
+        assert_equals(d0, d1)
+    finally:
+        dt.options.memory.sequential_paths = ""
+    d2 = dt.open(path)
+    assert_equals(d0, d2)
+
+
+def test_jay_append_mismatch(tempfile):
+    d0 = dt.Frame({"A": [1, 2, 3]})
+    d0.save(tempfile, format="jay")
+    with pytest.raises(ValueError) as e:
+        dt.Frame({"A": [1.5]}).save(tempfile, format="jay", append=True)
+    assert "does not match the type stored in the file" in str(e.value)
+    with pytest.raises(ValueError) as e:
+        dt.Frame({"A": [1], "B": [2]}).save(tempfile, format="jay",
+                                            append=True)
+    assert "contains 1 columns" in str(e.value)
+
+
+def test_jay_rowgroups(tempfile):
+    d0 = dt.Frame({"A": list(range(1000))})
+    d0.save(tempfile, format="jay", _rowgroup_size=100)
+    # The filtered open returns all rows of the qualifying row groups,
+    # which is a superset of the rows matching the predicate.
+    d1 = dt.open(tempfile, filter=("A", 250, 320))
+    d1.internal.check()
+    assert d1.topython() == [list(range(200, 400))]
+    # A filter matching nothing produces an empty frame
+    d2 = dt.open(tempfile, filter=("A", 5000, 6000))
+    assert d2.shape == (0, 1)
+    # A file saved without row groups is returned in full
+    d0.save(tempfile, format="jay")
+    d3 = dt.open(tempfile, filter=("A", 250, 320))
+    assert_equals(d0, d3)
+    with pytest.raises(ValueError) as e:
+        dt.open(tempfile, filter=("Z", 0, 1))
+    assert "Column `Z` does not exist" in str(e.value)
+
+
+def test_feather_roundtrip(tempfile):
+    d0 = dt.Frame({"A": [1, 7, -3, None, 12],
+                   "B": [True, None, False, True, None],
+                   "C": [2.5, None, 3.75, -0.1, 1e100],
+                   "D": ["alpha", None, "", "gamma", "delta"]})
+    d0.save(tempfile, format="feather")
+    with open(tempfile, "rb") as inp:
+        assert inp.read(4) == b"FEA1"
+    d1 = dt.open(tempfile)
+    d1.internal.check()
+    assert d1.names == d0.names
+    assert d1.topython() == d0.topython()
+
+
+def test_feather_nonulls(tempfile):
+    d0 = dt.Frame({"A": list(range(5000)),
+                   "B": [x / 3 for x in range(5000)]})
+    d0.save(tempfile, format="feather")
+    d1 = dt.open(tempfile)
+    d1.internal.check()
+    assert_equals(d0, d1)
+
+
+def test_jay_save_stream(tempfile):
+    d0 = dt.Frame({"A": list(range(1000)),
+                   "B": [x / 9 for x in range(1000)],
+                   "C": ["row%d" % i for i in range(1000)]})
+    d0.save_stream(tempfile, format="jay", chunksize=123)
+    d1 = dt.open(tempfile)
+    d1.internal.check()
+    assert_equals(d0, d1)
+
+
+def test_pickle_roundtrip():
+    import pickle
+    d0 = dt.Frame({"A": [1, 7, 100, 12],
+                   "B": [True, None, False, None],
+                   "C": ["alpha", "beta", None, "delta"],
+                   "D": [2.5, -1e100, None, 0.0]})
+    d1 = pickle.loads(pickle.dumps(d0))
+    d1.internal.check()
+    assert_equals(d0, d1)
+
+
+def test_pickle_out_of_band():
+    import pickle
+    if pickle.HIGHEST_PROTOCOL < 5:
+        pytest.skip("pickle protocol 5 is not available")
+    d0 = dt.Frame({"A": list(range(1000)),
+                   "B": [x / 9 for x in range(1000)]})
+    buffers = []
+    data = pickle.dumps(d0, protocol=5, buffer_callback=buffers.append)
+    assert buffers  # the frame's payload was passed out-of-band
+    d1 = pickle.loads(data, buffers=buffers)
+    d1.internal.check()
+    assert_equals(d0, d1)
+
+
+def test_shmem_roundtrip():
+    import random
+    name = "/dt_test_shmem_%d" % random.getrandbits(32)
+    d0 = dt.Frame({"A": [1, 7, 100, 12],
+                   "B": [True, None, False, None],
+                   "C": ["alpha", "beta", None, "delta"]})
+    d0.to_shmem(name)
+    try:
+        d1 = dt.attach(name)
+        d1.internal.check()
+        assert_equals(d0, d1)
+        # A second attachment maps the same physical copy
+        d2 = dt.attach(name)
+        assert_equals(d0, d2)
+    finally:
+        dt.shmem_unlink(name)
@@ -0,0 +1,83 @@
+#!/usr/bin/env python
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+import os
+import random
+import pytest
+import datatable as dt
+from datatable import f
+
+
+
+def test_partitioned_from_frame(tempdir):
+    dt0 = dt.Frame({"A": list(range(100)),
+                    "B": [x % 7 for x in range(100)]})
+    pf = dt.PartitionedFrame.from_frame(dt0, tempdir, nrows_per_partition=30)
+    assert pf.npartitions == 4
+    assert pf.nrows == 100
+    assert pf.ncols == 2
+    assert pf.names == ("A", "B")
+    assert pf.stypes == dt0.stypes
+    assert all(os.path.isfile(p) for p in pf.paths)
+    assert [p.nrows for p in map(pf.partition, range(4))] == [30, 30, 30, 10]
+    assert pf.to_frame().topython() == dt0.topython()
+    # Re-opening from the partition files gives the same logical frame
+    pf2 = dt.PartitionedFrame(pf.paths)
+    assert pf2.nrows == 100
+    assert pf2.names == ("A", "B")
+
+
+def test_partitioned_bad_schema(tempdir):
+    path1 = os.path.join(tempdir, "p1.jay")
+    path2 = os.path.join(tempdir, "p2.jay")
+    dt.Frame({"A": [1, 2, 3]}).save(path1, format="jay")
+    dt.Frame({"B": [1.5, 2.5]}).save(path2, format="jay")
+    with pytest.raises(ValueError) as e:
+        dt.PartitionedFrame([path1, path2])
+    assert "differs from the first partition's schema" in str(e.value)
+
+
+def test_partitioned_filter(tempdir):
+    dt0 = dt.Frame({"A": list(range(1000)),
+                    "B": [x * 3 % 11 for x in range(1000)]})
+    pf = dt.PartitionedFrame.from_frame(dt0, tempdir, nrows_per_partition=128)
+    res = pf.filter(f.B == 0)
+    assert res.topython() == dt0[f.B == 0, :].topython()
+    empty = pf.filter(f.A < 0)
+    assert empty.nrows == 0
+    assert empty.names == ("A", "B")
+
+
+def test_partitioned_sort(tempdir):
+    random.seed(12345)
+    src = [random.randint(-1000, 1000) for _ in range(5000)]
+    src[17] = None
+    dt0 = dt.Frame({"A": src, "B": list(range(5000))})
+    pf = dt.PartitionedFrame.from_frame(dt0, os.path.join(tempdir, "parts"),
+                                        nrows_per_partition=700)
+    out = os.path.join(tempdir, "sorted.jay")
+    pfs = pf.sort("A", out, chunksize=600)
+    assert pfs.npartitions == 1
+    assert pfs.nrows == 5000
+    res = pfs.to_frame()
+    assert res.topython()[0] == dt0.sort("A").topython()[0]
+
+
+def test_partitioned_aggregate(tempdir):
+    dt0 = dt.Frame({"A": [x % 5 for x in range(300)],
+                    "B": list(range(300))})
+    pf = dt.PartitionedFrame.from_frame(dt0, tempdir, nrows_per_partition=70)
+    res = pf.aggregate("A", ["B"], agg="sum")
+    assert res.names == ("A", "B")
+    exp = dt0[:, [dt.sum(f.B)], "A"]
+    assert res.topython() == exp.topython()
+    cnt = pf.aggregate("A", ["B"], agg="count")
+    assert cnt.topython()[1] == [60] * 5
+    mx = pf.aggregate("A", ["B"], agg="max")
+    assert mx.topython()[1] == dt0[:, [dt.max(f.B)], "A"].topython()[1]
+    with pytest.raises(ValueError) as e:
+        pf.aggregate("A", ["B"], agg="mean")
+    assert "re-aggregable" in str(e.value)
@@ -5,7 +5,7 @@
 #   file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #-------------------------------------------------------------------------------
 import datatable as dt
-from datatable import f, stype, ltype, first, count
+from datatable import f, stype, ltype, first, last, count
 
 
 #-------------------------------------------------------------------------------
@@ -175,3 +175,127 @@ def test_first_2d_array():
     a_reduce = first(a_in)
     assert a_reduce == [9, 8, 2, 3, None, None, 3, 0, 5, 5, 8, None, 1]
 
+
+
+#-------------------------------------------------------------------------------
+# Last
+#-------------------------------------------------------------------------------
+
+def test_last_array():
+    a_in = [9, 8, 2, 3, None, None, 3, 0, 5, 5, 8, None, 1]
+    a_reduce = last(a_in)
+    assert a_reduce == 1
+
+
+def test_last_dt():
+    df_in = dt.Frame([9, 8, 2, 3, None, None, 3, 0, 5, 5, 8, None, 1])
+    df_reduce = df_in[:, last(f.C0)]
+    df_reduce.internal.check()
+    assert df_reduce.shape == (1, 1)
+    assert df_reduce.ltypes == (ltype.int,)
+    assert df_reduce.topython() == [[1]]
+
+
+def test_last_dt_groupby():
+    df_in = dt.Frame([9, 8, 2, 3, None, None, 3, 0, 5, 5, 8, None, 1])
+    df_reduce = df_in[:, last(f.C0), "C0"]
+    df_reduce.internal.check()
+    assert df_reduce.shape == (8, 2)
+    assert df_reduce.ltypes == (ltype.int, ltype.int,)
+    assert df_reduce.topython() == [[None, 0, 1, 2, 3, 5, 8, 9],
+                                    [None, 0, 1, 2, 3, 5, 8, 9]]
+
+
+def test_last_dt_string_groupby():
+    df_in = dt.Frame([["a", "a", "b", "b", "b"],
+                      ["x", None, "u", "v", None]],
+                     names=["A", "B"])
+    df_reduce = df_in[:, [first(f.B), last(f.B)], "A"]
+    df_reduce.internal.check()
+    assert df_reduce.shape == (2, 3)
+    assert df_reduce.topython() == [["a", "b"],
+                                    ["x", "u"],
+                                    [None, None]]
+
+
+#-------------------------------------------------------------------------------
+# Min / Max on strings
+#-------------------------------------------------------------------------------
+
+def test_minmax_dt_string():
+    df_in = dt.Frame(["pear", "plum", None, "peach", "apple", None])
+    df_reduce = df_in[:, [dt.min(f.C0), dt.max(f.C0)]]
+    df_reduce.internal.check()
+    assert df_reduce.shape == (1, 2)
+    assert df_reduce.stypes == (stype.str32, stype.str32)
+    assert df_reduce.topython() == [["apple"], ["plum"]]
+
+
+def test_minmax_dt_string_groupby():
+    df_in = dt.Frame([["a", "b", "a", "b", "a", "b"],
+                      ["pear", "plum", None, "peach", "apple", None]],
+                     names=["A", "B"])
+    df_reduce = df_in[:, [dt.min(f.B), dt.max(f.B)], "A"]
+    df_reduce.internal.check()
+    assert df_reduce.shape == (2, 3)
+    assert df_reduce.topython() == [["a", "b"],
+                                    ["apple", "peach"],
+                                    ["pear", "plum"]]
+
+
+def test_minmax_dt_string_all_na_group():
+    df_in = dt.Frame([["a", "a", "b"], [None, None, "z"]], names=["A", "B"])
+    df_reduce = df_in[:, dt.min(f.B), "A"]
+    df_reduce.internal.check()
+    assert df_reduce.topython() == [["a", "b"], [None, "z"]]
+
+
+
+#-------------------------------------------------------------------------------
+# Cumulative aggregates
+#-------------------------------------------------------------------------------
+
+def test_cumsum_simple():
+    df0 = dt.Frame(A=[2, 5, None, 1, 7])
+    df1 = df0[:, dt.cumsum(f.A)]
+    df1.internal.check()
+    assert df1.stypes == (stype.int64, )
+    assert df1.topython() == [[2, 7, None, 8, 15]]
+
+
+def test_cummin_cummax():
+    df0 = dt.Frame(A=[3, None, 1, 4, 0])
+    df1 = df0[:, [dt.cummin(f.A), dt.cummax(f.A)]]
+    df1.internal.check()
+    assert df1.topython() == [[3, None, 1, 1, 0],
+                              [3, None, 3, 4, 4]]
+
+
+def test_cumprod():
+    df0 = dt.Frame(A=[1, 2, 3, 4])
+    df1 = df0[:, dt.cumprod(f.A)]
+    assert df1.topython() == [[1, 2, 6, 24]]
+
+
+def test_cumsum_real():
+    df0 = dt.Frame(A=[0.5, None, 1.25, -0.75])
+    df1 = df0[:, dt.cumsum(f.A)]
+    assert df1.stypes == (stype.float64, )
+    assert df1.topython() == [[0.5, None, 1.75, 1.0]]
+
+
+def test_cumsum_grouped():
+    df0 = dt.Frame(A=["b", "a", "b", "a", "b"], B=[1, 2, 3, 4, 5])
+    df1 = df0[:, dt.cumsum(f.B), "A"]
+    df1.internal.check()
+    assert df1.topython() == [["a", "a", "b", "b", "b"],
+                              [2, 6, 1, 4, 9]]
+
+
+def test_cumsum_large():
+    import itertools
+    n = 200000  # large enough for the parallel two-pass scan
+    src = [i % 1000 for i in range(n)]
+    df0 = dt.Frame(A=src)
+    df1 = df0[:, dt.cumsum(f.A)]
+    assert df1.topython() == [list(itertools.accumulate(src))]
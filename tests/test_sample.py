@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+
+
+def test_sample_n():
+    df0 = dt.Frame(A=list(range(100)))
+    df1 = df0.sample(n=10, seed=1)
+    df1.internal.check()
+    assert df1.shape == (10, 1)
+    vals = df1.topython()[0]
+    assert len(set(vals)) == 10
+    assert all(0 <= x < 100 for x in vals)
+
+
+def test_sample_reproducible():
+    df0 = dt.Frame(A=list(range(1000)))
+    df1 = df0.sample(n=50, seed=1234)
+    df2 = df0.sample(n=50, seed=1234)
+    assert df1.topython() == df2.topython()
+
+
+def test_sample_full_shuffle():
+    df0 = dt.Frame(A=list(range(100)))
+    df1 = df0.sample(n=100, seed=7)
+    assert df1.shape == (100, 1)
+    assert sorted(df1.topython()[0]) == list(range(100))
+
+
+def test_sample_n_edge_cases():
+    df0 = dt.Frame(A=[1, 2, 3])
+    assert df0.sample(n=0, seed=1).shape == (0, 1)
+    assert sorted(df0.sample(n=3, seed=1).topython()[0]) == [1, 2, 3]
+
+
+def test_sample_keeps_all_columns():
+    df0 = dt.Frame(A=list(range(50)), B=[str(i) for i in range(50)])
+    df1 = df0.sample(n=5, seed=3)
+    df1.internal.check()
+    assert df1.names == ("A", "B")
+    a, b = df1.topython()
+    assert b == [str(x) for x in a]
+
+
+def test_sample_frac():
+    df0 = dt.Frame(A=list(range(10000)))
+    df1 = df0.sample(frac=0.1, seed=99)
+    df1.internal.check()
+    # every row is selected independently, so the sample size is only
+    # approximately frac * nrows
+    assert 800 <= df1.nrows <= 1200
+    vals = df1.topython()[0]
+    assert vals == sorted(vals)
+    assert df0.sample(frac=0.1, seed=99).nrows == df1.nrows
+
+
+def test_sample_frac_edge_cases():
+    df0 = dt.Frame(A=[1, 2, 3])
+    assert df0.sample(frac=0, seed=1).shape == (0, 1)
+    assert df0.sample(frac=1, seed=1).topython() == [[1, 2, 3]]
+
+
+def test_sample_bad_args():
+    df0 = dt.Frame(A=[1, 2, 3])
+    with pytest.raises(ValueError):
+        df0.sample()
+    with pytest.raises(ValueError):
+        df0.sample(n=1, frac=0.5)
+    with pytest.raises(ValueError):
+        df0.sample(n=5)
+    with pytest.raises(ValueError):
+        df0.sample(frac=1.5)
@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+import pytest
+import datatable as dt
+
+
+
+def test_str_contains_simple():
+    d0 = dt.Frame({"A": ["error: boom", "all fine", "ERROR", "an error here",
+                         None, ""]})
+    d1 = d0.str_contains("A", "error")
+    assert d1.internal.check()
+    assert d1.topython() == [["error: boom", "an error here"]]
+
+
+def test_str_contains_empty_pattern():
+    d0 = dt.Frame({"A": ["a", None, "", "bc"]})
+    d1 = d0.str_contains("A", "")
+    assert d1.topython() == [["a", "", "bc"]]
+
+
+def test_str_contains_long_pattern():
+    needle = "x" * 100
+    d0 = dt.Frame({"A": ["y" + needle + "z", needle[:-1], None]})
+    d1 = d0.str_contains("A", needle)
+    assert d1.topython() == [["y" + needle + "z"]]
+
+
+def test_str_startswith():
+    d0 = dt.Frame({"A": ["apple", "applet", "ample", None, "app"]})
+    d1 = d0.str_startswith("A", "app")
+    assert d1.topython() == [["apple", "applet", "app"]]
+
+
+def test_str_endswith():
+    d0 = dt.Frame({"A": ["note.txt", "note.csv", "txt", None, ".txt"]})
+    d1 = d0.str_endswith("A", ".txt")
+    assert d1.topython() == [["note.txt", ".txt"]]
+
+
+def test_str_filter_keeps_other_columns():
+    d0 = dt.Frame({"A": ["foo", "bar", "foobar"], "N": [1, 2, 3]})
+    d1 = d0.str_contains("A", "foo")
+    assert d1.names == ("A", "N")
+    assert d1.topython() == [["foo", "foobar"], [1, 3]]
+
+
+def test_str_filter_bad_column():
+    d0 = dt.Frame({"A": [1, 2, 3]})
+    with pytest.raises(TypeError):
+        d0.str_contains("A", "x")
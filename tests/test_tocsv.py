@@ -5,6 +5,8 @@
 #   file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #-------------------------------------------------------------------------------
 import datatable as dt
+import gzip
+import os
 import random
 import re
 import pytest
@@ -86,6 +88,24 @@ def test_strategy(capsys, tempfile):
     # assert ("Creating an empty destination file " + tempfile) in out
 
 
+def test_save_compressed(tempfile):
+    """
+    Saving to a file whose name ends with ".gz" should produce a gzip
+    archive (composed of one member per written chunk), decompressible
+    with the standard tools.
+    """
+    gzfile = tempfile + ".gz"
+    n = 100000  # force multiple chunks
+    d0 = dt.Frame({"A": list(range(n)),
+                   "B": ["str%d" % i for i in range(n)]})
+    try:
+        d0.to_csv(gzfile)
+        with gzip.open(gzfile, "rt") as inp:
+            assert inp.read() == d0.to_csv()
+    finally:
+        os.unlink(gzfile)
+
+
 @pytest.mark.parametrize("col, scol", [("col", "col"),
                                        ("", 'C0'),
                                        (" ", '" "'),
@@ -331,3 +351,41 @@ def test_save_str64():
         "baar,q\n"
         "ba,\n"
         ",bvqpoeqnperoin;dj\n")
+
+
+def test_save_append(tempfile):
+    d0 = dt.Frame({"A": [1, 2, 3], "B": ["a", "b", "c"]})
+    d1 = dt.Frame({"A": [4, 5], "B": ["d", "e"]})
+    d0.to_csv(tempfile)
+    d1.to_csv(tempfile, append=True)
+    with open(tempfile) as inp:
+        assert inp.read() == "A,B\n1,a\n2,b\n3,c\n4,d\n5,e\n"
+    # Appending to a file that does not exist writes the header row
+    os.remove(tempfile)
+    d1.to_csv(tempfile, append=True)
+    with open(tempfile) as inp:
+        assert inp.read() == "A,B\n4,d\n5,e\n"
+
+
+def test_save_stream(tempfile):
+    d0 = dt.Frame({"A": list(range(1000)),
+                   "B": ["row%d" % i for i in range(1000)]})
+    d0.save_stream(tempfile, format="csv", chunksize=137)
+    d1 = dt.fread(tempfile)
+    d1.internal.check()
+    assert d1.topython() == d0.topython()
+
+
+def test_save_strings_clean_and_quoted():
+    # A fully "clean" string column (no quotes/commas/control characters)
+    # takes the bulk-copy path; the second column forces per-cell escaping.
+    src1 = ["plain%d" % i for i in range(100)] + [None, "", " padded "]
+    src2 = ['say "hi"', "a,b", "line\nbreak"] * 34 + ["x"]
+    d0 = dt.Frame({"A": src1, "B": src2})
+    answer = d0.to_csv()
+    # NA is written as a blank field and "" as a quoted empty string; the
+    # default na_strings=["NA"] would read the blank back as "", so tell
+    # fread explicitly that blank means NA.
+    d1 = dt.fread(text=answer, na_strings=[""])
+    d1.internal.check()
+    assert d1.topython() == d0.topython()
@@ -105,9 +105,10 @@ def test_stype():
     assert stype.float64
     assert stype.str32
     assert stype.str64
+    assert stype.cat32
     assert stype.obj64
     # When new stypes are added, don't forget to update this test suite
-    assert len(stype) == 10
+    assert len(stype) == 11
 
 
 def test_stype_names():
@@ -121,6 +122,7 @@ def test_stype_names():
     assert stype.float64.name == "float64"
     assert stype.str32.name == "str32"
     assert stype.str64.name == "str64"
+    assert stype.cat32.name == "cat32"
     assert stype.obj64.name == "obj64"
 
 
@@ -289,6 +291,6 @@ def test_ltype_stypes():
     assert set(ltype.int.stypes) == {stype.int8, stype.int16, stype.int32,
                                      stype.int64}
     assert set(ltype.real.stypes) == {stype.float32, stype.float64}
-    assert set(ltype.str.stypes) == {stype.str32, stype.str64}
+    assert set(ltype.str.stypes) == {stype.str32, stype.str64, stype.cat32}
     assert set(ltype.time.stypes) == set()
     assert set(ltype.obj.stypes) == {stype.obj64}
@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+import datatable as dt
+
+
+def test_unique_simple():
+    df0 = dt.Frame(A=[1, 2, 1, 3, 2, 1])
+    df1 = df0.unique()
+    df1.internal.check()
+    assert df1.topython() == [[1, 2, 3]]
+
+
+def test_unique_multicolumn():
+    df0 = dt.Frame(A=[1, 1, 2, 1, 2], B=["a", "b", "a", "a", "a"])
+    df1 = df0.unique()
+    df1.internal.check()
+    assert df1.topython() == [[1, 1, 2], ["a", "b", "a"]]
+
+
+def test_unique_keeps_first_occurrence_order():
+    df0 = dt.Frame(A=[5, 3, 5, 1, 3, 5])
+    assert df0.unique().topython() == [[5, 3, 1]]
+
+
+def test_unique_with_nas():
+    df0 = dt.Frame(A=[None, 1, None, 1, 2])
+    assert df0.unique().topython() == [[None, 1, 2]]
+
+
+def test_unique_all_distinct():
+    df0 = dt.Frame(A=list(range(1000)))
+    df1 = df0.unique()
+    assert df1.topython() == [list(range(1000))]
+
+
+def test_unique_strings():
+    df0 = dt.Frame(A=["foo", "bar", "foo", None, "bar", None, "baz"])
+    assert df0.unique().topython() == [["foo", "bar", None, "baz"]]
+
+
+def test_unique_of_view():
+    df0 = dt.Frame(A=[1, 2, 1, 2, 3, 3])
+    df1 = df0[::2, :]  # [1, 1, 3]
+    assert df1.unique().topython() == [[1, 3]]
+
+
+def test_unique_large():
+    import random as rnd
+    rnd.seed(3456)
+    src = [rnd.randint(1, 500) for _ in range(100000)]
+    df0 = dt.Frame(A=src)
+    df1 = df0.unique()
+    expected = list(dict.fromkeys(src))
+    assert df1.topython() == [expected]
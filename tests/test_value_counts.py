@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+# © H2O.ai 2018; -*- encoding: utf-8 -*-
+#   This Source Code Form is subject to the terms of the Mozilla Public
+#   License, v. 2.0. If a copy of the MPL was not distributed with this
+#   file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#-------------------------------------------------------------------------------
+#
+# Test Frame.value_counts()
+#
+#-------------------------------------------------------------------------------
+import datatable as dt
+from datatable import stype
+
+
+def test_value_counts_int():
+    d0 = dt.Frame([3, 1, 3, 3, 1, 2])
+    d1 = d0.value_counts()
+    d1.internal.check()
+    assert d1.names == ("value", "count")
+    assert d1.stypes == (stype.int8, stype.int64)
+    assert d1.topython() == [[3, 1, 2], [3, 2, 1]]
+
+
+def test_value_counts_sorted_by_value():
+    d0 = dt.Frame([3, 1, 3, 3, 1, 2])
+    d1 = d0.value_counts(sort_by_count=False)
+    d1.internal.check()
+    assert d1.topython() == [[1, 2, 3], [2, 1, 3]]
+
+
+def test_value_counts_nas():
+    d0 = dt.Frame([None, 5, None, None, 7])
+    d1 = d0.value_counts()
+    d1.internal.check()
+    assert d1.topython() == [[None, 5, 7], [3, 1, 1]]
+    d2 = d0.value_counts(sort_by_count=False)
+    assert d2.topython() == [[None, 5, 7], [3, 1, 1]]
+
+
+def test_value_counts_floats():
+    d0 = dt.Frame([0.5, None, 0.5, 2.5])
+    d1 = d0.value_counts(sort_by_count=False)
+    d1.internal.check()
+    assert d1.stypes == (stype.float64, stype.int64)
+    assert d1.topython() == [[None, 0.5, 2.5], [1, 2, 1]]
+
+
+def test_value_counts_strings():
+    d0 = dt.Frame(["b", "a", "b", None, "b"])
+    d1 = d0.value_counts()
+    d1.internal.check()
+    assert d1.topython() == [["b", None, "a"], [3, 1, 1]]
+    d2 = d0.value_counts(sort_by_count=False)
+    assert d2.topython() == [[None, "a", "b"], [1, 1, 3]]
+
+
+def test_value_counts_by_name():
+    d0 = dt.Frame({"x": [1, 1], "y": [2, 3]})
+    d1 = d0.value_counts("y", sort_by_count=False)
+    d1.internal.check()
+    assert d1.topython() == [[2, 3], [1, 1]]